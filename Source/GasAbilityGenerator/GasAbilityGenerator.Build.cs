@@ -90,9 +90,14 @@ public class GasAbilityGenerator : ModuleRules
 
 			// v4.3: XLSX export/import support
 			"FileUtilities",
-			"XmlParser"
+
+			// v7.8.73: Manifest watch mode
+			"DirectoryWatcher"
 		});
 
+		// v7.8.79: Streaming deflate for XLSX export (XLSXStreamWriter)
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
 		// Enable exceptions for YAML parsing
 		bEnableExceptions = true;
 	}
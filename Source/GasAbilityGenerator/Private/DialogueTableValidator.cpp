@@ -7,33 +7,57 @@ FDialogueValidationResult FDialogueTableValidator::ValidateAll(const TArray<FDia
 {
 	FDialogueValidationResult Result;
 
+	// v7.8.82: One index for the whole table - reference and duplicate checks are hash lookups
+	const FNodeCounts NodeCounts = BuildNodeCounts(Rows);
+
 	// Validate each row individually
 	for (const FDialogueTableRow& Row : Rows)
 	{
-		TArray<FDialogueValidationIssue> RowIssues = ValidateRow(Row, Rows);
+		TArray<FDialogueValidationIssue> RowIssues = ValidateRow(Row, NodeCounts);
 		Result.Issues.Append(RowIssues);
 	}
 
 	// Group rows by DialogueID and validate tree structure
-	TMap<FName, TArray<FDialogueTableRow>> DialogueGroups;
+	ValidateDialogueTrees(Rows, Result.Issues);
+
+	return Result;
+}
+
+FDialogueTableValidator::FNodeCounts FDialogueTableValidator::BuildNodeCounts(const TArray<FDialogueTableRow>& AllRows)
+{
+	FNodeCounts NodeCounts;
+	NodeCounts.Reserve(AllRows.Num());
+
+	for (const FDialogueTableRow& Row : AllRows)
+	{
+		NodeCounts.FindOrAdd(MakeTuple(Row.DialogueID, Row.NodeID))++;
+	}
+	return NodeCounts;
+}
+
+void FDialogueTableValidator::ValidateDialogueTrees(const TArray<FDialogueTableRow>& Rows, TArray<FDialogueValidationIssue>& OutIssues)
+{
+	TMap<FName, TArray<const FDialogueTableRow*>> DialogueGroups;
 	for (const FDialogueTableRow& Row : Rows)
 	{
 		if (!Row.DialogueID.IsNone())
 		{
-			DialogueGroups.FindOrAdd(Row.DialogueID).Add(Row);
+			DialogueGroups.FindOrAdd(Row.DialogueID).Add(&Row);
 		}
 	}
 
 	for (const auto& Pair : DialogueGroups)
 	{
-		TArray<FDialogueValidationIssue> TreeIssues = ValidateDialogueTree(Pair.Key, Pair.Value);
-		Result.Issues.Append(TreeIssues);
+		OutIssues.Append(ValidateDialogueTree(Pair.Key, Pair.Value));
 	}
-
-	return Result;
 }
 
 TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRow(const FDialogueTableRow& Row, const TArray<FDialogueTableRow>& AllRows)
+{
+	return ValidateRow(Row, BuildNodeCounts(AllRows));
+}
+
+TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRow(const FDialogueTableRow& Row, const FNodeCounts& NodeCounts)
 {
 	TArray<FDialogueValidationIssue> Issues;
 
@@ -106,16 +130,7 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRow(const FDia
 	// Validate ParentNodeID reference exists (if specified)
 	if (!Row.ParentNodeID.IsNone())
 	{
-		bool bParentFound = false;
-		for (const FDialogueTableRow& OtherRow : AllRows)
-		{
-			if (OtherRow.DialogueID == Row.DialogueID && OtherRow.NodeID == Row.ParentNodeID)
-			{
-				bParentFound = true;
-				break;
-			}
-		}
-		if (!bParentFound)
+		if (!NodeCounts.Contains(MakeTuple(Row.DialogueID, Row.ParentNodeID)))
 		{
 			Issues.Add(FDialogueValidationIssue(
 				EDialogueValidationSeverity::Error,
@@ -133,16 +148,7 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRow(const FDia
 		{
 			continue;
 		}
-		bool bNextFound = false;
-		for (const FDialogueTableRow& OtherRow : AllRows)
-		{
-			if (OtherRow.DialogueID == Row.DialogueID && OtherRow.NodeID == NextID)
-			{
-				bNextFound = true;
-				break;
-			}
-		}
-		if (!bNextFound)
+		if (!NodeCounts.Contains(MakeTuple(Row.DialogueID, NextID)))
 		{
 			Issues.Add(FDialogueValidationIssue(
 				EDialogueValidationSeverity::Error,
@@ -154,15 +160,8 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRow(const FDia
 	}
 
 	// Check for duplicate NodeID within same dialogue
-	int32 DuplicateCount = 0;
-	for (const FDialogueTableRow& OtherRow : AllRows)
-	{
-		if (OtherRow.DialogueID == Row.DialogueID && OtherRow.NodeID == Row.NodeID)
-		{
-			DuplicateCount++;
-		}
-	}
-	if (DuplicateCount > 1)
+	const int32* NodeCount = NodeCounts.Find(MakeTuple(Row.DialogueID, Row.NodeID));
+	if (NodeCount && *NodeCount > 1)
 	{
 		Issues.Add(FDialogueValidationIssue(
 			EDialogueValidationSeverity::Error,
@@ -176,6 +175,17 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRow(const FDia
 }
 
 TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateDialogueTree(FName DialogueID, const TArray<FDialogueTableRow>& DialogueRows)
+{
+	TArray<const FDialogueTableRow*> RowPtrs;
+	RowPtrs.Reserve(DialogueRows.Num());
+	for (const FDialogueTableRow& Row : DialogueRows)
+	{
+		RowPtrs.Add(&Row);
+	}
+	return ValidateDialogueTree(DialogueID, RowPtrs);
+}
+
+TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateDialogueTree(FName DialogueID, const TArray<const FDialogueTableRow*>& DialogueRows)
 {
 	TArray<FDialogueValidationIssue> Issues;
 
@@ -190,13 +200,22 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateDialogueTree(F
 		return Issues;
 	}
 
+	// v7.8.82: NodeID -> first row with it, so following a NextNodeID is a hash lookup
+	TMap<FName, int32> NodeIndices;
+	NodeIndices.Reserve(DialogueRows.Num());
+
 	// Find root nodes (nodes with no parent)
 	TArray<const FDialogueTableRow*> RootNodes;
-	for (const FDialogueTableRow& Row : DialogueRows)
+	for (int32 RowIndex = 0; RowIndex < DialogueRows.Num(); ++RowIndex)
 	{
-		if (Row.ParentNodeID.IsNone())
+		const FDialogueTableRow* Row = DialogueRows[RowIndex];
+		if (!NodeIndices.Contains(Row->NodeID))
+		{
+			NodeIndices.Add(Row->NodeID, RowIndex);
+		}
+		if (Row->ParentNodeID.IsNone())
 		{
-			RootNodes.Add(&Row);
+			RootNodes.Add(Row);
 		}
 	}
 
@@ -226,20 +245,16 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateDialogueTree(F
 		));
 	}
 
-	// Check for circular references
-	for (const FDialogueTableRow& Row : DialogueRows)
+	// Check for circular references (only reported once per dialogue)
+	const int32 CycleRowIndex = FindCircularReference(DialogueRows, NodeIndices);
+	if (CycleRowIndex != INDEX_NONE)
 	{
-		TSet<FName> Visited;
-		if (HasCircularReference(Row, DialogueRows, Visited))
-		{
-			Issues.Add(FDialogueValidationIssue(
-				EDialogueValidationSeverity::Error,
-				DialogueID,
-				Row.NodeID,
-				TEXT("Circular reference detected in dialogue tree")
-			));
-			break; // Only report once per dialogue
-		}
+		Issues.Add(FDialogueValidationIssue(
+			EDialogueValidationSeverity::Error,
+			DialogueID,
+			DialogueRows[CycleRowIndex]->NodeID,
+			TEXT("Circular reference detected in dialogue tree")
+		));
 	}
 
 	// Check for orphan nodes (not reachable from any root)
@@ -260,31 +275,27 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateDialogueTree(F
 		ReachableNodes.Add(Current);
 
 		// Find this node and add its children
-		for (const FDialogueTableRow& Row : DialogueRows)
+		if (const int32* RowIndex = NodeIndices.Find(Current))
 		{
-			if (Row.NodeID == Current)
+			for (const FName& NextID : DialogueRows[*RowIndex]->NextNodeIDs)
 			{
-				for (const FName& NextID : Row.NextNodeIDs)
+				if (!NextID.IsNone() && !ReachableNodes.Contains(NextID))
 				{
-					if (!NextID.IsNone() && !ReachableNodes.Contains(NextID))
-					{
-						ToVisit.Add(NextID);
-					}
+					ToVisit.Add(NextID);
 				}
-				break;
 			}
 		}
 	}
 
 	// Find orphans
-	for (const FDialogueTableRow& Row : DialogueRows)
+	for (const FDialogueTableRow* Row : DialogueRows)
 	{
-		if (!ReachableNodes.Contains(Row.NodeID) && !Row.ParentNodeID.IsNone())
+		if (!ReachableNodes.Contains(Row->NodeID) && !Row->ParentNodeID.IsNone())
 		{
 			Issues.Add(FDialogueValidationIssue(
 				EDialogueValidationSeverity::Warning,
 				DialogueID,
-				Row.NodeID,
+				Row->NodeID,
 				TEXT("Node is not reachable from any root")
 			));
 		}
@@ -293,37 +304,65 @@ TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateDialogueTree(F
 	return Issues;
 }
 
-bool FDialogueTableValidator::HasCircularReference(const FDialogueTableRow& StartRow, const TArray<FDialogueTableRow>& DialogueRows, TSet<FName>& Visited)
+int32 FDialogueTableValidator::FindCircularReference(const TArray<const FDialogueTableRow*>& DialogueRows, const TMap<FName, int32>& NodeIndices)
 {
-	if (Visited.Contains(StartRow.NodeID))
+	enum class ENodeState : uint8
 	{
-		return true;
-	}
+		Unvisited,
+		OnPath,		// On the current DFS path - reaching it again closes a cycle
+		Done		// Fully explored, no cycle reachable from it
+	};
+
+	TArray<ENodeState> States;
+	States.Init(ENodeState::Unvisited, DialogueRows.Num());
 
-	Visited.Add(StartRow.NodeID);
+	// (row index, next NextNodeIDs entry to follow)
+	TArray<TPair<int32, int32>> Stack;
 
-	for (const FName& NextID : StartRow.NextNodeIDs)
+	// Start from every row in order: the first start that finds a back edge is the first row a cycle
+	// is reachable from, since everything explored by earlier starts is Done and cycle-free
+	for (int32 StartIndex = 0; StartIndex < DialogueRows.Num(); ++StartIndex)
 	{
-		if (NextID.IsNone())
+		if (States[StartIndex] != ENodeState::Unvisited)
 		{
 			continue;
 		}
 
-		for (const FDialogueTableRow& Row : DialogueRows)
+		States[StartIndex] = ENodeState::OnPath;
+		Stack.Add(MakeTuple(StartIndex, 0));
+
+		while (Stack.Num() > 0)
 		{
-			if (Row.NodeID == NextID)
+			const int32 RowIndex = Stack.Last().Key;
+			const TArray<FName>& NextNodeIDs = DialogueRows[RowIndex]->NextNodeIDs;
+
+			if (Stack.Last().Value >= NextNodeIDs.Num())
 			{
-				TSet<FName> VisitedCopy = Visited;
-				if (HasCircularReference(Row, DialogueRows, VisitedCopy))
-				{
-					return true;
-				}
-				break;
+				States[RowIndex] = ENodeState::Done;
+				Stack.Pop(EAllowShrinking::No);
+				continue;
+			}
+
+			const FName NextID = NextNodeIDs[Stack.Last().Value++];
+			const int32* NextIndex = NextID.IsNone() ? nullptr : NodeIndices.Find(NextID);
+			if (!NextIndex)
+			{
+				continue;
+			}
+
+			if (States[*NextIndex] == ENodeState::OnPath)
+			{
+				return StartIndex;
+			}
+			if (States[*NextIndex] == ENodeState::Unvisited)
+			{
+				States[*NextIndex] = ENodeState::OnPath;
+				Stack.Add(MakeTuple(*NextIndex, 0));
 			}
 		}
 	}
 
-	return false;
+	return INDEX_NONE;
 }
 
 //=============================================================================
@@ -339,9 +378,14 @@ uint32 FDialogueTableValidator::ComputeValidationInputHash(const FDialogueTableR
 }
 
 TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRowAndCache(FDialogueTableRow& Row, const TArray<FDialogueTableRow>& AllRows, const FGuid& ListsVersionGuid)
+{
+	return ValidateRowAndCache(Row, BuildNodeCounts(AllRows), ListsVersionGuid);
+}
+
+TArray<FDialogueValidationIssue> FDialogueTableValidator::ValidateRowAndCache(FDialogueTableRow& Row, const FNodeCounts& NodeCounts, const FGuid& ListsVersionGuid)
 {
 	// Run standard validation
-	TArray<FDialogueValidationIssue> Issues = ValidateRow(Row, AllRows);
+	TArray<FDialogueValidationIssue> Issues = ValidateRow(Row, NodeCounts);
 
 	// Also validate tokens if present
 	if (!Row.EventsTokenStr.IsEmpty())
@@ -443,28 +487,18 @@ FDialogueValidationResult FDialogueTableValidator::ValidateAllAndCache(TArray<FD
 {
 	FDialogueValidationResult Result;
 
+	// v7.8.82: Node ids are read before any cache field is written - validation never edits them
+	const FNodeCounts NodeCounts = BuildNodeCounts(Rows);
+
 	// Validate each row and write cache
 	for (FDialogueTableRow& Row : Rows)
 	{
-		TArray<FDialogueValidationIssue> RowIssues = ValidateRowAndCache(Row, Rows, ListsVersionGuid);
+		TArray<FDialogueValidationIssue> RowIssues = ValidateRowAndCache(Row, NodeCounts, ListsVersionGuid);
 		Result.Issues.Append(RowIssues);
 	}
 
 	// Group rows by DialogueID and validate tree structure
-	TMap<FName, TArray<FDialogueTableRow>> DialogueGroups;
-	for (const FDialogueTableRow& Row : Rows)
-	{
-		if (!Row.DialogueID.IsNone())
-		{
-			DialogueGroups.FindOrAdd(Row.DialogueID).Add(Row);
-		}
-	}
-
-	for (const auto& Pair : DialogueGroups)
-	{
-		TArray<FDialogueValidationIssue> TreeIssues = ValidateDialogueTree(Pair.Key, Pair.Value);
-		Result.Issues.Append(TreeIssues);
-	}
+	ValidateDialogueTrees(Rows, Result.Issues);
 
 	return Result;
 }
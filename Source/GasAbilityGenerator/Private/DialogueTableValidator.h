@@ -1,4 +1,5 @@
 // GasAbilityGenerator - Dialogue Table Validator
+// v7.8.82: Whole-table validation is O(n) - hashed node index, one DFS per dialogue for cycles
 // v4.5: Validates dialogue table rows with cache support
 // v4.0: Validates dialogue table rows for correctness
 
@@ -133,6 +134,9 @@ public:
 	 */
 	static TArray<FDialogueValidationIssue> ValidateDialogueTree(FName DialogueID, const TArray<FDialogueTableRow>& DialogueRows);
 
+	/** v7.8.82: Same, over the grouped rows of a whole-table pass (no row copies) */
+	static TArray<FDialogueValidationIssue> ValidateDialogueTree(FName DialogueID, const TArray<const FDialogueTableRow*>& DialogueRows);
+
 	//=========================================================================
 	// v4.5: Cache-writing validation methods
 	//=========================================================================
@@ -163,6 +167,22 @@ public:
 	static uint32 ComputeValidationInputHash(const FDialogueTableRow& Row, const FGuid& ListsVersionGuid);
 
 private:
-	/** Check for circular references in dialogue tree */
-	static bool HasCircularReference(const FDialogueTableRow& StartRow, const TArray<FDialogueTableRow>& DialogueRows, TSet<FName>& Visited);
+	/** v7.8.82: (DialogueID, NodeID) -> row count, built once per table for the reference and duplicate checks */
+	using FNodeCounts = TMap<TPair<FName, FName>, int32>;
+
+	static FNodeCounts BuildNodeCounts(const TArray<FDialogueTableRow>& AllRows);
+
+	static TArray<FDialogueValidationIssue> ValidateRow(const FDialogueTableRow& Row, const FNodeCounts& NodeCounts);
+
+	static TArray<FDialogueValidationIssue> ValidateRowAndCache(FDialogueTableRow& Row, const FNodeCounts& NodeCounts, const FGuid& ListsVersionGuid);
+
+	/** Tree checks of every dialogue in the table, grouped by pointer */
+	static void ValidateDialogueTrees(const TArray<FDialogueTableRow>& Rows, TArray<FDialogueValidationIssue>& OutIssues);
+
+	/**
+	 * v7.8.82: Single iterative DFS over one dialogue's NextNodeIDs graph (each node and edge visited once)
+	 * @param NodeIndices NodeID -> index of the first row with that NodeID
+	 * @return Index of the first row, in row order, from which a cycle is reachable (INDEX_NONE if acyclic)
+	 */
+	static int32 FindCircularReference(const TArray<const FDialogueTableRow*>& DialogueRows, const TMap<FName, int32>& NodeIndices);
 };
@@ -0,0 +1,235 @@
+// GasAbilityGenerator v7.8.84 - Name-indexed asset lookup
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.64: Session AssetName -> FAssetData index kept current by Asset Registry events, plus negative cache
+// v7.8.68: AddPendingAsset for batched registry notifications
+// v7.8.70: Registry scan/queries counted by the generation profiler
+// v7.8.83: RemovePendingAsset
+// v7.8.84: Registry event handles kept and removed in Shutdown
+
+#include "GasAbilityGeneratorAssetIndex.h"
+#include "GasAbilityGeneratorProfiler.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Misc/PackageName.h"
+
+FCriticalSection FGeneratorAssetIndex::IndexLock;
+TMap<FName, TArray<FAssetData>> FGeneratorAssetIndex::BlueprintsByName;
+TMap<FName, TArray<FAssetData>> FGeneratorAssetIndex::EnumsByName;
+TSet<FString> FGeneratorAssetIndex::MissingNames;
+int32 FGeneratorAssetIndex::NegativeHits = 0;
+bool FGeneratorAssetIndex::bBuilt = false;
+FDelegateHandle FGeneratorAssetIndex::AssetAddedHandle;
+FDelegateHandle FGeneratorAssetIndex::AssetRemovedHandle;
+FDelegateHandle FGeneratorAssetIndex::AssetRenamedHandle;
+
+void FGeneratorAssetIndex::EnsureBuilt()
+{
+	FScopeLock Lock(&IndexLock);
+	if (bBuilt)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// v6.8: NarrativePro content must be scanned for Blueprint parent classes in commandlet mode
+	// v7.8.83: Force rescan as before - the commandlet's initial registry pass may not cover plugin content
+	TArray<FString> NarrativeProPaths;
+	NarrativeProPaths.Add(TEXT("/NarrativePro/"));
+	AssetRegistry.ScanPathsSynchronous(NarrativeProPaths, true /* bForceRescan */);
+	FGeneratorProfiler::Increment(EGeneratorCounter::RegistryQuery);
+
+	// One registry query per class family, then O(1) name lookups for the rest of the session
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Assets, true);
+	FGeneratorProfiler::Increment(EGeneratorCounter::RegistryQuery);
+	for (const FAssetData& AssetData : Assets)
+	{
+		BlueprintsByName.FindOrAdd(AssetData.AssetName).Add(AssetData);
+	}
+
+	Assets.Reset();
+	AssetRegistry.GetAssetsByClass(UUserDefinedEnum::StaticClass()->GetClassPathName(), Assets, true);
+	FGeneratorProfiler::Increment(EGeneratorCounter::RegistryQuery);
+	for (const FAssetData& AssetData : Assets)
+	{
+		EnumsByName.FindOrAdd(AssetData.AssetName).Add(AssetData);
+	}
+
+	if (!AssetAddedHandle.IsValid())
+	{
+		AssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FGeneratorAssetIndex::OnAssetAdded);
+		AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FGeneratorAssetIndex::OnAssetRemoved);
+		AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FGeneratorAssetIndex::OnAssetRenamed);
+	}
+
+	bBuilt = true;
+	UE_LOG(LogTemp, Display, TEXT("[GasAbilityGenerator] Asset index built: %d Blueprint names, %d enum names"),
+		BlueprintsByName.Num(), EnumsByName.Num());
+}
+
+bool FGeneratorAssetIndex::FindBlueprints(FName AssetName, TArray<FAssetData>& OutAssets)
+{
+	EnsureBuilt();
+	FScopeLock Lock(&IndexLock);
+	if (const TArray<FAssetData>* Found = BlueprintsByName.Find(AssetName))
+	{
+		OutAssets = *Found;
+		return OutAssets.Num() > 0;
+	}
+	return false;
+}
+
+bool FGeneratorAssetIndex::FindUserDefinedEnums(FName AssetName, TArray<FAssetData>& OutAssets)
+{
+	EnsureBuilt();
+	FScopeLock Lock(&IndexLock);
+	if (const TArray<FAssetData>* Found = EnumsByName.Find(AssetName))
+	{
+		OutAssets = *Found;
+		return OutAssets.Num() > 0;
+	}
+	return false;
+}
+
+bool FGeneratorAssetIndex::IsKnownMissing(const TCHAR* Domain, const FString& Name)
+{
+	FScopeLock Lock(&IndexLock);
+	if (MissingNames.Contains(FString::Printf(TEXT("%s:%s"), Domain, *Name)))
+	{
+		NegativeHits++;
+		return true;
+	}
+	return false;
+}
+
+void FGeneratorAssetIndex::MarkMissing(const TCHAR* Domain, const FString& Name)
+{
+	FScopeLock Lock(&IndexLock);
+	MissingNames.Add(FString::Printf(TEXT("%s:%s"), Domain, *Name));
+}
+
+void FGeneratorAssetIndex::AddPendingAsset(const FAssetData& AssetData)
+{
+	EnsureBuilt();
+	FScopeLock Lock(&IndexLock);
+	AddToIndex(AssetData);
+	MissingNames.Empty();
+}
+
+void FGeneratorAssetIndex::RemovePendingAsset(const FAssetData& AssetData)
+{
+	FScopeLock Lock(&IndexLock);
+	RemoveFromIndex(AssetData.AssetName, AssetData.GetSoftObjectPath());
+}
+
+void FGeneratorAssetIndex::Reset()
+{
+	FScopeLock Lock(&IndexLock);
+	BlueprintsByName.Empty();
+	EnumsByName.Empty();
+	MissingNames.Empty();
+	NegativeHits = 0;
+	bBuilt = false;
+}
+
+void FGeneratorAssetIndex::Shutdown()
+{
+	// The registry may already be gone during engine shutdown - its delegates go with it
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	AssetAddedHandle.Reset();
+	AssetRemovedHandle.Reset();
+	AssetRenamedHandle.Reset();
+	Reset();
+}
+
+int32 FGeneratorAssetIndex::GetIndexedBlueprintCount()
+{
+	FScopeLock Lock(&IndexLock);
+	return BlueprintsByName.Num();
+}
+
+int32 FGeneratorAssetIndex::GetNegativeHitCount()
+{
+	FScopeLock Lock(&IndexLock);
+	return NegativeHits;
+}
+
+void FGeneratorAssetIndex::AddToIndex(const FAssetData& AssetData)
+{
+	if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+	{
+		TArray<FAssetData>& Entries = BlueprintsByName.FindOrAdd(AssetData.AssetName);
+		if (!Entries.ContainsByPredicate([&AssetData](const FAssetData& Existing) { return Existing.GetSoftObjectPath() == AssetData.GetSoftObjectPath(); }))
+		{
+			Entries.Add(AssetData);
+		}
+	}
+	else if (AssetData.IsInstanceOf(UUserDefinedEnum::StaticClass()))
+	{
+		TArray<FAssetData>& Entries = EnumsByName.FindOrAdd(AssetData.AssetName);
+		if (!Entries.ContainsByPredicate([&AssetData](const FAssetData& Existing) { return Existing.GetSoftObjectPath() == AssetData.GetSoftObjectPath(); }))
+		{
+			Entries.Add(AssetData);
+		}
+	}
+}
+
+void FGeneratorAssetIndex::RemoveFromIndex(FName AssetName, const FSoftObjectPath& ObjectPath)
+{
+	auto RemoveFrom = [&](TMap<FName, TArray<FAssetData>>& Map)
+	{
+		if (TArray<FAssetData>* Entries = Map.Find(AssetName))
+		{
+			Entries->RemoveAll([&ObjectPath](const FAssetData& Existing) { return Existing.GetSoftObjectPath() == ObjectPath; });
+			if (Entries->Num() == 0)
+			{
+				Map.Remove(AssetName);
+			}
+		}
+	};
+	RemoveFrom(BlueprintsByName);
+	RemoveFrom(EnumsByName);
+}
+
+void FGeneratorAssetIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+	{
+		return;
+	}
+	AddToIndex(AssetData);
+	// A new asset may satisfy a previously failed lookup
+	MissingNames.Empty();
+}
+
+void FGeneratorAssetIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+	{
+		return;
+	}
+	RemoveFromIndex(AssetData.AssetName, AssetData.GetSoftObjectPath());
+}
+
+void FGeneratorAssetIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+	{
+		return;
+	}
+	const FSoftObjectPath OldPath(OldObjectPath);
+	RemoveFromIndex(FName(*FPackageName::ObjectPathToObjectName(OldObjectPath)), OldPath);
+	AddToIndex(AssetData);
+	MissingNames.Empty();
+}
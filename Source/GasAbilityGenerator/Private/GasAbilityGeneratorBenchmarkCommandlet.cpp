@@ -0,0 +1,498 @@
+// GasAbilityGeneratorBenchmarkCommandlet.cpp
+// v7.8.71: Benchmark suite - synthesized manifests at configurable scale, per-stage timings to JSON
+// v7.8.83: Generation runs pass -force -noincremental -noparsecache so every run does the same work
+// v7.8.84: Failed generation runs (or runs without a Generate phase) are not counted as samples
+
+#include "GasAbilityGeneratorBenchmarkCommandlet.h"
+#include "GasAbilityGeneratorCommandlet.h"
+#include "GasAbilityGeneratorParser.h"
+#include "GasAbilityGeneratorPreValidator.h"
+#include "GasAbilityGeneratorScheduler.h"
+#include "GasAbilityGeneratorGenerators.h"
+#include "GasAbilityGeneratorAssetIndex.h"
+#include "GasAbilityGeneratorFunctionResolver.h"
+#include "GasAbilityGeneratorProfiler.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/StrongObjectPtr.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasAbilityGeneratorBenchmark, Log, All);
+
+// Bump when stage names or result fields change meaning, so trend tooling can tell runs apart
+static constexpr int32 BenchmarkSchemaVersion = 1;
+static const TCHAR* BenchmarkProjectRoot = TEXT("/Game/GasAbilityGeneratorBenchmark");
+
+namespace GasAbilityGeneratorBenchmark
+{
+	/** Template line split at asset-name tokens: Literals[0] Names[0] Literals[1] ... Names[N-1] Literals[N] */
+	struct FTemplateLine
+	{
+		TArray<FString> Literals;
+		TArray<FString> Names;
+		bool bEmitOnce = false;      // project_root / tags_ini_path
+		bool bProjectRoot = false;
+	};
+
+	/** One top-level section span (or the header before the first section) */
+	struct FTemplateSpan
+	{
+		TArray<FTemplateLine> Lines;
+		bool bReplicate = false;     // Defines or references manifest assets - repeated per copy
+	};
+
+	static bool IsIdentifierChar(TCHAR C)
+	{
+		return FChar::IsAlnum(C) || C == TEXT('_');
+	}
+
+	static FTemplateLine SplitLine(const FString& Line, const TSet<FString>& AssetNames)
+	{
+		FTemplateLine Result;
+		FString Literal;
+		int32 Index = 0;
+		while (Index < Line.Len())
+		{
+			if (!IsIdentifierChar(Line[Index]))
+			{
+				Literal.AppendChar(Line[Index++]);
+				continue;
+			}
+
+			const int32 Start = Index;
+			while (Index < Line.Len() && IsIdentifierChar(Line[Index]))
+			{
+				++Index;
+			}
+			const FString Token = Line.Mid(Start, Index - Start);
+
+			// Class paths reference a Blueprint asset as <Name>_C
+			const bool bClassSuffix = !AssetNames.Contains(Token) && Token.EndsWith(TEXT("_C"), ESearchCase::CaseSensitive);
+			const FString BaseName = bClassSuffix ? Token.LeftChop(2) : Token;
+			if (AssetNames.Contains(BaseName))
+			{
+				Result.Literals.Add(Literal);
+				Result.Names.Add(BaseName);
+				Literal = bClassSuffix ? TEXT("_C") : FString();
+			}
+			else
+			{
+				Literal += Token;
+			}
+		}
+		Result.Literals.Add(Literal);
+		return Result;
+	}
+
+	static void BuildTemplate(const FString& TemplateContent, const TSet<FString>& AssetNames, const FString& TemplateRoot, const FString& ProjectRoot, TArray<FTemplateSpan>& OutSpans)
+	{
+		FManifestLineStream Lines(TemplateContent);
+		TArray<FManifestSectionSpan> Sections;
+		FGasAbilityGeneratorParser::BuildSectionIndex(Lines, Sections);
+
+		auto AddSpan = [&](int32 Begin, int32 End)
+		{
+			FTemplateSpan& Span = OutSpans.AddDefaulted_GetRef();
+			for (int32 i = Begin; i < End; ++i)
+			{
+				// Comments stay in (they're part of real parse cost) but never rename or replicate anything
+				if (Lines.IsComment(i))
+				{
+					FTemplateLine& Comment = Span.Lines.AddDefaulted_GetRef();
+					Comment.Literals.Add(FString(Lines[i]));
+					continue;
+				}
+
+				FString Raw(Lines[i]);
+				if (!TemplateRoot.IsEmpty())
+				{
+					Raw.ReplaceInline(*TemplateRoot, *ProjectRoot, ESearchCase::CaseSensitive);
+				}
+
+				FTemplateLine Line = SplitLine(Raw, AssetNames);
+				const FStringView Key = Lines.GetKey(i);
+				Line.bProjectRoot = Lines.GetIndent(i) == 0 && Key == TEXTVIEW("project_root");
+				Line.bEmitOnce = Line.bProjectRoot || (Lines.GetIndent(i) == 0 && Key == TEXTVIEW("tags_ini_path"));
+				Span.bReplicate |= Line.Names.Num() > 0;
+				Span.Lines.Add(MoveTemp(Line));
+			}
+		};
+
+		AddSpan(0, Sections.Num() > 0 ? Sections[0].StartIndex : Lines.Num());
+		for (const FManifestSectionSpan& Section : Sections)
+		{
+			AddSpan(Section.StartIndex, Section.EndIndex);
+		}
+	}
+
+	/** Copy 0 emits every span; later copies only the spans holding assets (tags, config sections stay single) */
+	static void EmitManifest(const TArray<FTemplateSpan>& Spans, int32 Copies, const FString& ProjectRoot, int32 EstimatedLen, FString& OutContent)
+	{
+		OutContent.Reset(EstimatedLen);
+		for (int32 Copy = 0; Copy < Copies; ++Copy)
+		{
+			const FString Suffix = FString::Printf(TEXT("_B%04d"), Copy);
+			for (const FTemplateSpan& Span : Spans)
+			{
+				if (Copy > 0 && !Span.bReplicate)
+				{
+					continue;
+				}
+
+				for (const FTemplateLine& Line : Span.Lines)
+				{
+					if (Line.bEmitOnce)
+					{
+						if (Copy == 0)
+						{
+							OutContent += Line.bProjectRoot ? FString::Printf(TEXT("project_root: %s"), *ProjectRoot) : Line.Literals[0];
+							OutContent += TEXT("\n");
+						}
+						continue;
+					}
+
+					for (int32 i = 0; i < Line.Names.Num(); ++i)
+					{
+						OutContent += Line.Literals[i];
+						OutContent += Line.Names[i];
+						OutContent += Suffix;
+					}
+					OutContent += Line.Literals.Last();
+					OutContent += TEXT("\n");
+				}
+			}
+		}
+	}
+
+	static void ResetRunCaches()
+	{
+		FGeneratorAssetIndex::Reset();
+		FGasAbilityGeneratorFunctionResolver::ResetResolutionCache();
+	}
+
+	static bool SaveJson(const TSharedRef<FJsonObject>& Root, const FString& OutputPath)
+	{
+		FString JsonString;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+		if (!FJsonSerializer::Serialize(Root, Writer))
+		{
+			return false;
+		}
+		return FFileHelper::SaveStringToFile(JsonString, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+}
+
+UGasAbilityGeneratorBenchmarkCommandlet::UGasAbilityGeneratorBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+TSharedRef<FJsonObject> UGasAbilityGeneratorBenchmarkCommandlet::MakeStageStats(TArray<double> SamplesMs)
+{
+	TSharedRef<FJsonObject> Stats = MakeShared<FJsonObject>();
+	if (SamplesMs.Num() == 0)
+	{
+		return Stats;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> SampleValues;
+	for (double Sample : SamplesMs)
+	{
+		SampleValues.Add(MakeShared<FJsonValueNumber>(Sample));
+	}
+
+	SamplesMs.Sort();
+	const int32 Mid = SamplesMs.Num() / 2;
+	const double Median = (SamplesMs.Num() % 2 == 1) ? SamplesMs[Mid] : 0.5 * (SamplesMs[Mid - 1] + SamplesMs[Mid]);
+
+	Stats->SetNumberField(TEXT("medianMs"), Median);
+	Stats->SetNumberField(TEXT("minMs"), SamplesMs[0]);
+	Stats->SetNumberField(TEXT("maxMs"), SamplesMs.Last());
+	Stats->SetArrayField(TEXT("samplesMs"), SampleValues);
+	return Stats;
+}
+
+TSharedRef<FJsonObject> UGasAbilityGeneratorBenchmarkCommandlet::TimeStage(int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Stage)
+{
+	TArray<double> SamplesMs;
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Setup();
+		const double StartTime = FPlatformTime::Seconds();
+		Stage();
+		SamplesMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	return MakeStageStats(MoveTemp(SamplesMs));
+}
+
+TSharedRef<FJsonObject> UGasAbilityGeneratorBenchmarkCommandlet::RunGeneration(const FString& ManifestPath, bool bDryRun)
+{
+	// Rooted for the run - batched compiles collect garbage mid-generation
+	TStrongObjectPtr<UGasAbilityGeneratorCommandlet> Generator(NewObject<UGasAbilityGeneratorCommandlet>());
+	// Every run regenerates every asset: without -force/-noincremental, assets and the incremental snapshot
+	// left by an earlier run (or scale) turn later runs into the skip path; -noparsecache keeps parse time honest
+	const FString Params = FString::Printf(TEXT("-manifest=\"%s\" -assets -force -noincremental -noparsecache%s"),
+		*ManifestPath, bDryRun ? TEXT(" -dryrun") : TEXT(""));
+
+	// v7.8.84: Clear the previous run's stats - a run that exits before its own BeginSession must not report them
+	FGeneratorProfiler::BeginSession(false);
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 ExitCode = Generator->Main(Params);
+	const double WallMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	FGeneratorProfiler::EndSession();
+
+	// The generation commandlet's profiler session stays readable until the next BeginSession
+	TSharedRef<FJsonObject> PhasesObject = MakeShared<FJsonObject>();
+	for (const auto& Pair : FGeneratorProfiler::GetPhases())
+	{
+		PhasesObject->SetNumberField(Pair.Key, Pair.Value.Seconds * 1000.0);
+	}
+
+	TSharedRef<FJsonObject> Run = MakeShared<FJsonObject>();
+	Run->SetNumberField(TEXT("exitCode"), ExitCode);
+	Run->SetNumberField(TEXT("wallMs"), WallMs);
+	Run->SetObjectField(TEXT("phasesMs"), PhasesObject);
+	const FGeneratorPhaseStats* Generate = FGeneratorProfiler::GetPhases().Find(TEXT("Generate"));
+	if (ExitCode == 0 && Generate)
+	{
+		Run->SetNumberField(TEXT("generateMs"), Generate->Seconds * 1000.0);
+	}
+	Run->SetNumberField(TEXT("loads"), FGeneratorProfiler::GetCounter(EGeneratorCounter::Load));
+	Run->SetNumberField(TEXT("compiles"), FGeneratorProfiler::GetCounter(EGeneratorCounter::Compile));
+	Run->SetNumberField(TEXT("saves"), FGeneratorProfiler::GetCounter(EGeneratorCounter::Save));
+	Run->SetNumberField(TEXT("registryQueries"), FGeneratorProfiler::GetCounter(EGeneratorCounter::RegistryQuery));
+	return Run;
+}
+
+int32 UGasAbilityGeneratorBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace GasAbilityGeneratorBenchmark;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	UCommandlet::ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GasAbilityGenerator"));
+	const FString PluginVersion = Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("unknown");
+
+	// Template manifest
+	FString TemplatePath;
+	if (const FString* TemplateVal = ParamVals.Find(TEXT("template")))
+	{
+		TemplatePath = TemplateVal->TrimQuotes();
+	}
+	else if (Plugin.IsValid())
+	{
+		TemplatePath = Plugin->GetBaseDir() / TEXT("ClaudeContext/manifest.yaml");
+	}
+	if (FPaths::IsRelative(TemplatePath))
+	{
+		TemplatePath = FPaths::Combine(FPaths::ProjectDir(), TemplatePath);
+	}
+	FPaths::NormalizeFilename(TemplatePath);
+
+	FString TemplateContent;
+	if (!FFileHelper::LoadFileToString(TemplateContent, *TemplatePath))
+	{
+		UE_LOG(LogGasAbilityGeneratorBenchmark, Error, TEXT("Failed to read template manifest: %s"), *TemplatePath);
+		return 1;
+	}
+
+	FManifestData TemplateData;
+	if (!FGasAbilityGeneratorParser::ParseManifest(TemplateContent, TemplateData))
+	{
+		UE_LOG(LogGasAbilityGeneratorBenchmark, Error, TEXT("Failed to parse template manifest: %s"), *TemplatePath);
+		return 1;
+	}
+	const TSet<FString> TemplateAssets = TemplateData.GetExpectedAssetNames();
+	if (TemplateAssets.Num() == 0)
+	{
+		UE_LOG(LogGasAbilityGeneratorBenchmark, Error, TEXT("Template manifest defines no assets: %s"), *TemplatePath);
+		return 1;
+	}
+
+	TArray<FTemplateSpan> TemplateSpans;
+	BuildTemplate(TemplateContent, TemplateAssets, TemplateData.ProjectRoot, BenchmarkProjectRoot, TemplateSpans);
+
+	// Options
+	TArray<int32> Scales;
+	FString ScalesValue = TEXT("1000,10000,50000");
+	if (const FString* ScalesVal = ParamVals.Find(TEXT("scales")))
+	{
+		ScalesValue = *ScalesVal;
+	}
+	TArray<FString> ScaleStrings;
+	ScalesValue.ParseIntoArray(ScaleStrings, TEXT(","));
+	for (const FString& ScaleString : ScaleStrings)
+	{
+		const int32 Scale = FCString::Atoi(*ScaleString.TrimStartAndEnd());
+		if (Scale > 0)
+		{
+			Scales.Add(Scale);
+		}
+	}
+
+	int32 Iterations = 3;
+	if (const FString* IterationsVal = ParamVals.Find(TEXT("iterations")))
+	{
+		Iterations = FMath::Max(1, FCString::Atoi(**IterationsVal));
+	}
+
+	const bool bDryRunStage = !Switches.Contains(TEXT("nodryrun"));
+	const bool bFullStage = Switches.Contains(TEXT("full"));
+
+	const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+	const FString BenchmarkDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir()) / TEXT("GasAbilityGenerator/Benchmarks");
+	FString OutputPath = BenchmarkDir / FString::Printf(TEXT("Benchmark_%s_%s.json"), *PluginVersion, *Timestamp);
+	if (const FString* OutputVal = ParamVals.Find(TEXT("output")))
+	{
+		OutputPath = OutputVal->TrimQuotes();
+	}
+
+	UE_LOG(LogGasAbilityGeneratorBenchmark, Display, TEXT("GasAbilityGenerator benchmark v%s: template %s (%d assets), %d scale(s), %d iteration(s)"),
+		*PluginVersion, *TemplatePath, TemplateAssets.Num(), Scales.Num(), Iterations);
+
+	TArray<TSharedPtr<FJsonValue>> ScaleResults;
+	bool bAllRunsSucceeded = true;
+
+	for (const int32 TargetAssets : Scales)
+	{
+		// Synthesize
+		const int32 Copies = FMath::DivideAndRoundUp(TargetAssets, TemplateAssets.Num());
+		FString ManifestContent;
+		EmitManifest(TemplateSpans, Copies, BenchmarkProjectRoot, TemplateContent.Len() * Copies, ManifestContent);
+
+		const FString ManifestPath = BenchmarkDir / FString::Printf(TEXT("Manifest_%d.yaml"), TargetAssets);
+		if (!FFileHelper::SaveStringToFile(ManifestContent, *ManifestPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogGasAbilityGeneratorBenchmark, Error, TEXT("Failed to write synthesized manifest: %s"), *ManifestPath);
+			bAllRunsSucceeded = false;
+			continue;
+		}
+
+		TSharedRef<FJsonObject> ScaleObject = MakeShared<FJsonObject>();
+		TSharedRef<FJsonObject> StagesObject = MakeShared<FJsonObject>();
+
+		// parseManifest
+		FManifestData ManifestData;
+		StagesObject->SetObjectField(TEXT("parseManifest"), TimeStage(Iterations,
+			[&]() { ManifestData = FManifestData(); },
+			[&]() { FGasAbilityGeneratorParser::ParseManifest(ManifestContent, ManifestData); }));
+
+		const int32 AssetCount = ManifestData.GetExpectedAssetNames().Num();
+		ScaleObject->SetNumberField(TEXT("targetAssets"), TargetAssets);
+		ScaleObject->SetNumberField(TEXT("assets"), AssetCount);
+		ScaleObject->SetNumberField(TEXT("templateCopies"), Copies);
+		ScaleObject->SetNumberField(TEXT("manifestChars"), ManifestContent.Len());
+		ScaleObject->SetStringField(TEXT("manifestPath"), ManifestPath);
+		ManifestContent.Empty();
+
+		// preValidate - fresh resolver/asset index caches each run, as in a real commandlet run
+		int32 PreValidationErrors = 0;
+		StagesObject->SetObjectField(TEXT("preValidate"), TimeStage(Iterations,
+			[&]() { ResetRunCaches(); },
+			[&]() { PreValidationErrors = FPreValidator::Validate(ManifestData, ManifestPath).GetErrorCount(); }));
+		ScaleObject->SetNumberField(TEXT("preValidationErrors"), PreValidationErrors);
+
+		// dependencyGraph + prepare
+		int32 EdgeCount = 0;
+		TUniquePtr<FGenerationScheduler> Scheduler;
+		StagesObject->SetObjectField(TEXT("dependencyGraph"), TimeStage(Iterations,
+			[&]() { Scheduler = MakeUnique<FGenerationScheduler>(); },
+			[&]()
+			{
+				Scheduler->AddManifestJobs(ManifestData);
+				Scheduler->AddManifestDependencies(ManifestData);
+				EdgeCount = Scheduler->NumEdges();
+			}));
+		ScaleObject->SetNumberField(TEXT("dependencyEdges"), EdgeCount);
+
+		StagesObject->SetObjectField(TEXT("prepare"), TimeStage(Iterations,
+			[&]() { FGeneratorBase::ClearPreparedState(); },
+			[&]() { Scheduler->Prepare(); }));
+		FGeneratorBase::ClearPreparedState();
+		Scheduler.Reset();
+		ManifestData = FManifestData();
+
+		// dryRunGeneration - reported value is the commandlet's Generate phase (scheduler loop)
+		if (bDryRunStage)
+		{
+			TArray<double> GenerateMs;
+			TSharedPtr<FJsonObject> LastRun;
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				LastRun = RunGeneration(ManifestPath, true);
+				double RunGenerateMs = 0.0;
+				if (!LastRun->TryGetNumberField(TEXT("generateMs"), RunGenerateMs))
+				{
+					UE_LOG(LogGasAbilityGeneratorBenchmark, Error, TEXT("Dry-run generation %d failed (exit code %d) - no sample recorded"),
+						Iteration, static_cast<int32>(LastRun->GetIntegerField(TEXT("exitCode"))));
+					bAllRunsSucceeded = false;
+					continue;
+				}
+				GenerateMs.Add(RunGenerateMs);
+			}
+			TSharedRef<FJsonObject> DryRunStage = MakeStageStats(MoveTemp(GenerateMs));
+			DryRunStage->SetObjectField(TEXT("lastRun"), LastRun);
+			StagesObject->SetObjectField(TEXT("dryRunGeneration"), DryRunStage);
+		}
+
+		// fullGeneration - once per scale: it writes every asset to disk
+		if (bFullStage)
+		{
+			TSharedRef<FJsonObject> FullRun = RunGeneration(ManifestPath, false);
+			TArray<double> GenerateMs;
+			double RunGenerateMs = 0.0;
+			if (FullRun->TryGetNumberField(TEXT("generateMs"), RunGenerateMs))
+			{
+				GenerateMs.Add(RunGenerateMs);
+			}
+			else
+			{
+				UE_LOG(LogGasAbilityGeneratorBenchmark, Error, TEXT("Full generation failed (exit code %d) - no sample recorded"),
+					static_cast<int32>(FullRun->GetIntegerField(TEXT("exitCode"))));
+				bAllRunsSucceeded = false;
+			}
+			TSharedRef<FJsonObject> FullStage = MakeStageStats(MoveTemp(GenerateMs));
+			FullStage->SetObjectField(TEXT("lastRun"), FullRun);
+			StagesObject->SetObjectField(TEXT("fullGeneration"), FullStage);
+		}
+
+		ScaleObject->SetObjectField(TEXT("stages"), StagesObject);
+		ScaleResults.Add(MakeShared<FJsonValueObject>(ScaleObject));
+
+		UE_LOG(LogGasAbilityGeneratorBenchmark, Display, TEXT("[BENCHMARK] %d assets (%d copies): parse %.1fms, prevalidate %.1fms, graph %.1fms, prepare %.1fms"),
+			AssetCount, Copies,
+			StagesObject->GetObjectField(TEXT("parseManifest"))->GetNumberField(TEXT("medianMs")),
+			StagesObject->GetObjectField(TEXT("preValidate"))->GetNumberField(TEXT("medianMs")),
+			StagesObject->GetObjectField(TEXT("dependencyGraph"))->GetNumberField(TEXT("medianMs")),
+			StagesObject->GetObjectField(TEXT("prepare"))->GetNumberField(TEXT("medianMs")));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("schemaVersion"), BenchmarkSchemaVersion);
+	Root->SetStringField(TEXT("pluginVersion"), PluginVersion);
+	Root->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+	Root->SetStringField(TEXT("platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetStringField(TEXT("template"), TemplatePath);
+	Root->SetNumberField(TEXT("templateAssets"), TemplateAssets.Num());
+	Root->SetNumberField(TEXT("iterations"), Iterations);
+	Root->SetArrayField(TEXT("scales"), ScaleResults);
+
+	if (!SaveJson(Root, OutputPath))
+	{
+		UE_LOG(LogGasAbilityGeneratorBenchmark, Error, TEXT("Failed to write benchmark results: %s"), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogGasAbilityGeneratorBenchmark, Display, TEXT("[BENCHMARK] Results: %s"), *OutputPath);
+
+	return bAllRunsSucceeded ? 0 : 1;
+}
@@ -1,15 +1,30 @@
 // GasAbilityGeneratorCommandlet.cpp
 // Commandlet for automated asset generation from command line
 // v3.1: Fixed exit code, added dedicated log category, exception handling
+// v7.8.66: Assets generated in dependency order by FGenerationScheduler (replaces phase loops + deferred retries)
+// v7.8.67: Parallel prepare stage before the game-thread generation loop
+// v7.8.68: Package saves batched across the scheduled run and flushed once
+// v7.8.69: Blueprint compiles share one batched garbage collection schedule
+// v7.8.70: Phase/asset profiling (report timings always; -profile exports a Chrome trace + CSV)
+// v7.8.72: Incremental regeneration - change set from the previous run's definition hashes + dependents
+// v7.8.73: -watch mode - debounced re-runs on manifest/incremental/dialogue CSV saves, changed sections reparsed only
 
 #include "GasAbilityGeneratorCommandlet.h"
+#include "GasAbilityGeneratorAssetIndex.h"
+#include "GasAbilityGeneratorFunctionResolver.h"
 #include "GasAbilityGeneratorParser.h"
 #include "GasAbilityGeneratorGenerators.h"
+#include "GasAbilityGeneratorScheduler.h"  // v7.8.66: Dependency-ordered generation
 #include "Locked/GasAbilityGeneratorMetadata.h"  // v3.1: For metadata registry
 #include "GasAbilityGeneratorDialogueCSVParser.h"  // v4.0: CSV dialogue parsing
 #include "GasAbilityGeneratorReport.h"  // v4.7: Generation report system
 #include "GasAbilityGeneratorPipeline.h"  // v4.12: Mesh-to-Item Pipeline
 #include "GasAbilityGeneratorPreValidator.h"  // v4.24: Phase 4.1 Pre-Validation
+#include "GasAbilityGeneratorProfiler.h"  // v7.8.70: Generation profiler
+#include "GasAbilityGeneratorWatcher.h"  // v7.8.73: Watch mode
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/App.h"  // v4.11: For FApp::CanEverRender() in headless detection
@@ -284,8 +299,95 @@ UGasAbilityGeneratorCommandlet::UGasAbilityGeneratorCommandlet()
 
 int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 {
+	// v7.8.73: -watch keeps the commandlet alive and re-runs generation on every manifest save
+	if (FParse::Param(*Params, TEXT("watch")))
+	{
+		return RunWatchLoop(Params);
+	}
+
+	return RunGeneration(Params);
+}
+
+int32 UGasAbilityGeneratorCommandlet::RunWatchLoop(const FString& Params)
+{
+	bWatchMode = true;
+	WatchSectionCache = MakeShared<FManifestSectionCache>();
+
+	// First pass is a normal (incremental) run and primes the section cache
+	int32 ExitCode = RunGeneration(Params);
+	if (CachedManifestPath.IsEmpty())
+	{
+		// Manifest missing or unreadable - nothing to watch
+		return ExitCode;
+	}
+
+	float DebounceSeconds = FManifestWatcher::DefaultDebounceSeconds;
+	FParse::Value(*Params, TEXT("-debounce="), DebounceSeconds);
+
+	bool bChangePending = false;
+	FManifestWatcher Watcher;
+	const bool bWatching = Watcher.Start(CachedManifestPath, CachedDialogueCSVPath,
+		FOnManifestWatchTriggered::CreateLambda([this, &bChangePending](const FManifestWatchChange& Change)
+		{
+			LogMessage(FString::Printf(TEXT("[WATCH] Changed: %s"), *Change.Describe()));
+			bChangePending = true;
+		}),
+		DebounceSeconds);
+	if (!bWatching)
+	{
+		LogError(TEXT("ERROR: Watch mode could not watch the manifest folder"));
+		return 1;
+	}
+
+	LogMessage(TEXT(""));
+	LogMessage(FString::Printf(TEXT("[WATCH] Waiting for changes to %s (Ctrl+C to stop)"), *FPaths::GetCleanFilename(CachedManifestPath)));
+
+	// Commandlets don't tick the DirectoryWatcher module or the core ticker - drive both here
+	IDirectoryWatcher* DirectoryWatcher = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")).Get();
+	double LastTime = FPlatformTime::Seconds();
+	while (!IsEngineExitRequested())
+	{
+		const double Now = FPlatformTime::Seconds();
+		const float DeltaTime = static_cast<float>(Now - LastTime);
+		LastTime = Now;
+
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		DirectoryWatcher->Tick(DeltaTime);
+		FTSTicker::GetCoreTicker().Tick(DeltaTime);
+
+		if (bChangePending)
+		{
+			bChangePending = false;
+
+			// Saves made while this pass runs are collected and trigger the next one
+			Watcher.SetPaused(true);
+			const double PassStart = FPlatformTime::Seconds();
+			ExitCode = RunGeneration(Params);
+			LogMessage(FString::Printf(TEXT("[WATCH] Pass finished in %.2fs (exit code %d) - waiting for changes"), FPlatformTime::Seconds() - PassStart, ExitCode));
+			Watcher.SetPaused(false);
+		}
+
+		FPlatformProcess::Sleep(0.05f);
+	}
+
+	Watcher.Stop();
+	return ExitCode;
+}
+
+int32 UGasAbilityGeneratorCommandlet::RunGeneration(const FString& Params)
+{
+	// v7.8.73: Per-pass state (watch mode runs many passes in one process)
+	LogMessages.Reset();
+	LastFailedCount = 0;
+	LastValidationErrorCount = 0;
+	bHadParseError = false;
+
 	// v4.22: Clear session cache at start of each generation run
 	GSessionBlueprintClassCache.Empty();
+	// v7.8.64: Fresh Blueprint/enum name index and negative cache per run
+	FGeneratorAssetIndex::Reset();
+	// v7.8.65: One function resolution cache shared by PreValidator and generators for this run
+	FGasAbilityGeneratorFunctionResolver::ResetResolutionCache();
 
 	LogMessage(TEXT("========================================"));
 	LogMessage(TEXT("GasAbilityGenerator Commandlet v3.0"));
@@ -358,6 +460,16 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 		LogMessage(TEXT("MODE: Force (will overwrite even on conflicts)"));
 	}
 
+	// v7.8.70: Timings and counters are always collected for the report; -profile also records every scope for export
+	const bool bProfile = Switches.Contains(TEXT("profile"));
+	FGeneratorProfiler::BeginSession(bProfile);
+
+	// v7.8.72: Incremental by default; force mode regenerates everything regardless
+	bIncrementalMode = !Switches.Contains(TEXT("noincremental"));
+
+	// v7.8.83: On-disk parse cache (Saved/GasAbilityGenerator/ParseCache)
+	const bool bUseParseCache = !Switches.Contains(TEXT("noparsecache"));
+
 	// v3.9.9: Parse -level parameter for World Partition level loading
 	FString LevelPath;
 	if (FParse::Value(*Params, TEXT("-level="), LevelPath))
@@ -396,6 +508,9 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 	LogMessage(FString::Printf(TEXT("Generate Assets: %s"), bGenerateAssets ? TEXT("YES") : TEXT("NO")));
 	LogMessage(FString::Printf(TEXT("Dry Run: %s"), bDryRun ? TEXT("YES") : TEXT("NO")));
 	LogMessage(FString::Printf(TEXT("Force: %s"), bForce ? TEXT("YES") : TEXT("NO")));
+	LogMessage(FString::Printf(TEXT("Profile: %s"), bProfile ? TEXT("YES") : TEXT("NO")));
+	LogMessage(FString::Printf(TEXT("Incremental: %s"), bIncrementalMode && !bForce ? TEXT("YES") : TEXT("NO")));
+	LogMessage(FString::Printf(TEXT("Parse Cache: %s"), bUseParseCache ? TEXT("YES") : TEXT("NO")));
 	LogMessage(TEXT(""));
 
 	// Read manifest file
@@ -408,7 +523,8 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 	}
 
 	// v4.7: Compute manifest hash for report tracking
-	int64 ManifestHash = static_cast<int64>(GetTypeHash(ManifestContent));
+	// v7.8.62: Full 64-bit content hash (was 32-bit GetTypeHash widened to int64)
+	int64 ManifestHash = static_cast<int64>(GeneratorHash::Of(ManifestContent));
 
 	// v4.7: Cache values for report generation in GenerateAssets
 	CachedManifestPath = ManifestPath;
@@ -419,10 +535,44 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 	LogMessage(TEXT("Parsing manifest..."));
 	FManifestData ManifestData;
 
+	// v7.8.59: Tags-only runs index section offsets and parse just the tags: sections
+	const bool bTagsOnly = bGenerateTags && !bGenerateAssets;
+
 	// v3.1: Wrap parsing in try/catch for safety
 	try
 	{
-		if (!FGasAbilityGeneratorParser::ParseManifest(ManifestContent, ManifestData))
+		GASGEN_PROFILE_SCOPE("Parse");
+		if (bTagsOnly)
+		{
+			FLazyManifestData LazyManifest;
+			LazyManifest.Initialize(ManifestContent);
+			ManifestData = LazyManifest.EnsureSection(TEXT("tags"));
+			LogMessage(FString::Printf(TEXT("Tags-only run: indexed %d sections, parsed %d tag lines"),
+				LazyManifest.GetSections().Num(), LazyManifest.GetSectionLineCount(TEXT("tags"))));
+		}
+		else if (WatchSectionCache.IsValid())
+		{
+			// v7.8.73: Watch passes reparse only the sections whose text changed since the previous pass
+			WatchSectionCache->Parse(ManifestContent, ManifestData);
+			LogMessage(FString::Printf(TEXT("[WATCH] Reparsed %d section(s), reused %d"),
+				WatchSectionCache->GetLastReparsedCount(), WatchSectionCache->GetLastReusedCount()));
+		}
+		else if (bUseParseCache)
+		{
+			// v7.8.83: Fresh process per run - reuse the parse stored on disk while the manifest is unchanged
+			bool bCacheHit = false;
+			if (!FManifestParseCache::LoadOrParse(ManifestPath, ManifestContent, ManifestData, &bCacheHit))
+			{
+				LogError(TEXT("ERROR: Failed to parse manifest file"));
+				bHadParseError = true;
+				return 1;
+			}
+			if (bCacheHit)
+			{
+				LogMessage(TEXT("Manifest unchanged since last parse - loaded cached parse"));
+			}
+		}
+		else if (!FGasAbilityGeneratorParser::ParseManifest(ManifestContent, ManifestData))
 		{
 			LogError(TEXT("ERROR: Failed to parse manifest file"));
 			bHadParseError = true;
@@ -490,7 +640,8 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 		}
 	}
 
-	if (!DialogueCSVPath.IsEmpty())
+	// v7.8.59: Dialogue CSV only feeds asset generation
+	if (!DialogueCSVPath.IsEmpty() && !bTagsOnly)
 	{
 		// Resolve relative path
 		if (FPaths::IsRelative(DialogueCSVPath))
@@ -509,14 +660,7 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 				LogMessage(FString::Printf(TEXT("Loaded %d dialogues from CSV"), CSVDialogues.Num()));
 
 				// Append to manifest data (CSV dialogues take precedence over YAML)
-				for (const auto& Dialogue : CSVDialogues)
-				{
-					// Remove existing definition with same name (CSV overrides YAML)
-					ManifestData.DialogueBlueprints.RemoveAll([&](const FManifestDialogueBlueprintDefinition& Existing) {
-						return Existing.Name == Dialogue.Name;
-					});
-					ManifestData.DialogueBlueprints.Add(Dialogue);
-				}
+				FDialogueCSVParser::ApplyToManifest(CSVDialogues, ManifestData);
 			}
 			else
 			{
@@ -527,6 +671,20 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 		{
 			LogError(FString::Printf(TEXT("WARNING: Dialogue CSV not found: %s"), *DialogueCSVPath));
 		}
+
+		// v7.8.73: Watched for saves even if it doesn't exist yet
+		CachedDialogueCSVPath = DialogueCSVPath;
+	}
+
+	// v7.8.73: Watch passes layer incremental *.yaml updates (beside the manifest) over the manifest definitions
+	if (bWatchMode && !bTagsOnly)
+	{
+		TArray<FString> IncrementalAssets;
+		if (FManifestWatcher::ApplyIncrementalFiles(ManifestPath, ManifestData, &IncrementalAssets) > 0)
+		{
+			LogMessage(FString::Printf(TEXT("Applied %d incremental file(s): %s"),
+				IncrementalAssets.Num(), *FString::Join(IncrementalAssets, TEXT(", "))));
+		}
 	}
 
 	// v3.9.9: Log POI and Spawner counts
@@ -542,7 +700,12 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 	// v4.24: Phase 4.1 Pre-Validation (per Phase4_Spec_Locked.md)
 	// ============================================================================
 	LogMessage(TEXT("--- Pre-Validation ---"));
-	FPreValidationReport PreValReport = FPreValidator::Validate(ManifestData, ManifestPath);
+	// v7.8.59: Tags-only runs carry no asset sections, so the pass is a no-op report
+	FPreValidationReport PreValReport;
+	{
+		GASGEN_PROFILE_SCOPE("PreValidation");
+		PreValReport = bTagsOnly ? FPreValidationReport() : FPreValidator::Validate(ManifestData, ManifestPath);
+	}
 	PreValReport.LogAll();
 
 	LogMessage(FString::Printf(TEXT("Pre-validation: %d errors, %d warnings, %d checks (cache: %d hits)"),
@@ -614,7 +777,11 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 	}
 
 	// v4.17: Circular dependency detection (before generation ordering)
-	TSet<FString> AssetsInCycles = DetectCircularDependencies(ManifestData);
+	TSet<FString> AssetsInCycles;
+	{
+		GASGEN_PROFILE_SCOPE("CycleDetection");
+		AssetsInCycles = DetectCircularDependencies(ManifestData);
+	}
 	int32 CycleFailCount = AssetsInCycles.Num();
 	if (CycleFailCount > 0)
 	{
@@ -722,6 +889,13 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 		FGenerationReportHelper::CreateAndSaveDryRunReport(CachedManifestPath, CachedManifestHash, DryRunSummary, bCachedForceMode);
 	}
 
+	// v7.8.70: Profile export
+	FGeneratorProfiler::EndSession();
+	if (bProfile)
+	{
+		WriteProfile();
+	}
+
 	// v3.0: Cleanup dry run and force modes
 	FGeneratorBase::SetDryRunMode(false);
 	FGeneratorBase::SetForceMode(false);
@@ -770,6 +944,8 @@ int32 UGasAbilityGeneratorCommandlet::Main(const FString& Params)
 
 void UGasAbilityGeneratorCommandlet::GenerateTags(const FManifestData& ManifestData)
 {
+	GASGEN_PROFILE_SCOPE("GenerateTags");
+
 	LogMessage(TEXT("--- Generating Tags ---"));
 
 	if (ManifestData.Tags.Num() == 0)
@@ -801,43 +977,6 @@ void UGasAbilityGeneratorCommandlet::GenerateTags(const FManifestData& ManifestD
 	LogMessage(TEXT(""));
 }
 
-// v2.6.7: Helper lambda to process generation results
-// v2.8.4: Also tracks ProcessedAssets for verification and detects duplicates
-static auto ProcessResult = [](UGasAbilityGeneratorCommandlet* Self, FGenerationResult& Result,
-	FGenerationSummary& Summary, TSet<FString>& GeneratedAssets, TSet<FString>& ProcessedAssets,
-	TArray<FString>& GenerationDuplicates)
-{
-	Summary.AddResult(Result);
-
-	// v2.8.4: Track ALL processed assets for verification, detect duplicates
-	if (ProcessedAssets.Contains(Result.AssetName))
-	{
-		GenerationDuplicates.AddUnique(Result.AssetName);
-		UE_LOG(LogGasAbilityGenerator, Error, TEXT("DUPLICATE GENERATION: %s"), *Result.AssetName);
-	}
-	else
-	{
-		ProcessedAssets.Add(Result.AssetName);
-	}
-
-	// Track generated/existing assets for dependency resolution
-	if (Result.Status == EGenerationStatus::New || Result.Status == EGenerationStatus::Skipped)
-	{
-		GeneratedAssets.Add(Result.AssetName);
-	}
-
-	const TCHAR* StatusStr = TEXT("FAIL");
-	switch (Result.Status)
-	{
-	case EGenerationStatus::New: StatusStr = TEXT("NEW"); break;
-	case EGenerationStatus::Skipped: StatusStr = TEXT("SKIP"); break;
-	case EGenerationStatus::Deferred: StatusStr = TEXT("DEFER"); break;
-	case EGenerationStatus::Failed: StatusStr = TEXT("FAIL"); break;
-	}
-
-	UE_LOG(LogGasAbilityGenerator, Display, TEXT("[%s] %s"), StatusStr, *Result.AssetName);
-};
-
 void UGasAbilityGeneratorCommandlet::GenerateAssets(const FManifestData& ManifestData)
 {
 	LogMessage(TEXT("--- Generating Assets ---"));
@@ -853,7 +992,6 @@ void UGasAbilityGeneratorCommandlet::GenerateAssets(const FManifestData& Manifes
 
 	// v2.6.7: Clear tracking for this run
 	GeneratedAssets.Empty();
-	DeferredAssets.Empty();
 	// v2.8.4: Clear processed assets and duplicates for verification
 	ProcessedAssets.Empty();
 	GenerationDuplicates.Empty();
@@ -923,865 +1061,147 @@ void UGasAbilityGeneratorCommandlet::GenerateAssets(const FManifestData& Manifes
 	}
 	LogMessage(TEXT(""));
 
-	// PHASE 1: No Dependencies - Enumerations
-	for (const auto& Definition : ManifestData.Enumerations)
+	// v7.8.66: Dependency-ordered generation - one job per manifest asset, run after everything it references
+	FGenerationScheduler Scheduler;
 	{
-		FGenerationResult Result = FEnumerationGenerator::Generate(Definition);
-		ProcessResult(this, Result, Summary, GeneratedAssets, ProcessedAssets, GenerationDuplicates);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-		if (Result.Status == EGenerationStatus::Failed)
-		{
-			LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-		}
+		GASGEN_PROFILE_SCOPE("Schedule");
+		Scheduler.AddManifestJobs(ManifestData);
+		Scheduler.AddManifestDependencies(ManifestData);
 	}
+	LogMessage(FString::Printf(TEXT("[SCHEDULE] %d jobs, %d dependency edges"), Scheduler.NumJobs(), Scheduler.NumEdges()));
 
-	// Float Curves
-	for (const auto& Definition : ManifestData.FloatCurves)
+	// v7.8.67: Thread-safe prepare stage (definition hashes, package stats) in parallel; generators commit on the game thread
 	{
-		FGenerationResult Result = FFloatCurveGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		GASGEN_PROFILE_SCOPE("Prepare");
+		Scheduler.Prepare();
 	}
+	LogMessage(FString::Printf(TEXT("[SCHEDULE] Prepared %d jobs in %.3fs"), Scheduler.NumJobs(), Scheduler.GetPrepareSeconds()));
 
-	// Input Actions
-	for (const auto& Definition : ManifestData.InputActions)
+	// v7.8.72: Generate only what changed since the last run and everything downstream of it
+	if (bIncrementalMode && !FGeneratorBase::IsForceMode())
 	{
-		FGenerationResult Result = FInputActionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		GASGEN_PROFILE_SCOPE("ChangeSet");
+		FDefinitionHashSnapshot PreviousHashes;
+		const bool bHasPreviousHashes = PreviousHashes.Load(CachedManifestPath);
+		Scheduler.ComputeChangeSet(PreviousHashes);
+		LogMessage(FString::Printf(TEXT("[INCREMENTAL] %s: %d changed, %d dependent(s), %d up to date"),
+			bHasPreviousHashes ? TEXT("Previous hashes loaded") : TEXT("No previous hashes"),
+			Scheduler.NumChanged(), Scheduler.NumChangedDependents(), Scheduler.NumUpToDate()));
 	}
 
-	// Input Mapping Contexts
-	for (const auto& Definition : ManifestData.InputMappingContexts)
-	{
-		FGenerationResult Result = FInputMappingContextGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	// v7.8.68: Generators queue their package saves; written in one pass after the loop
+	FGeneratorBase::BeginSaveBatch();
+	// v7.8.69: Compiles skip their per-compile GC; collected every few compiles and once at the end
+	FGeneratorBase::BeginCompileBatch();
 
-	// PHASE 2: Base Assets - Gameplay Effects
-	for (const auto& Definition : ManifestData.GameplayEffects)
+	// v7.8.70: Explicit begin/end - the loop body uses continue, and per-asset scopes nest inside
+	FGeneratorProfiler::BeginScope(TEXT("Generate"));
+	Scheduler.Begin();
+	int32 JobIndex = INDEX_NONE;
+	while (Scheduler.Next(JobIndex))
 	{
-		FGenerationResult Result = FGameplayEffectGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+		const FGenerationJob& Job = Scheduler.GetJob(JobIndex);
 
-	// v7.8.36: Goal Items BEFORE Actor Blueprints (activities reference goals via DynamicCast)
-	// Activities like BPA_FormationFollow need Goal_FormationFollow to exist first
-	// v7.8.52: Pass ManifestData for EventGraph lookup
-	for (const auto& Definition : ManifestData.GoalItems)
-	{
-		FGenerationResult Result = FGoalItemGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v7.8.52: Goal Generators - dynamic goal creation classes
-	for (const auto& Definition : ManifestData.GoalGenerators)
-	{
-		FGenerationResult Result = FGoalGeneratorGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v7.8.52: Gameplay Cues - GC_ Blueprint assets for VFX/SFX feedback
-	for (const auto& Definition : ManifestData.GameplayCues)
-	{
-		FGenerationResult Result = FGameplayCueGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v7.8.52: BT Services - BTS_ Blueprint assets for behavior tree services
-	for (const auto& Definition : ManifestData.BTServices)
-	{
-		FGenerationResult Result = FBTServiceGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v7.8.52: BT Tasks - BTTask_ Blueprint assets for behavior tree tasks
-	for (const auto& Definition : ManifestData.BTTasks)
-	{
-		FGenerationResult Result = FBTTaskGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// PHASE 3: Blueprint Assets - Actor Blueprints (before abilities that reference them)
-	for (int32 i = 0; i < ManifestData.ActorBlueprints.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.ActorBlueprints[i];
-		FGenerationResult Result = FActorBlueprintGenerator::Generate(Definition, ManifestData.ProjectRoot, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		// v2.6.7: Handle deferred assets
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
+		if (Scheduler.WasReleasedFromCycle(JobIndex))
 		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("ActorBlueprint");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
-		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
-		}
-	}
-
-	// Gameplay Abilities (after actor blueprints they may reference)
-	for (int32 i = 0; i < ManifestData.GameplayAbilities.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.GameplayAbilities[i];
-
-		// v4.25: Check for upstream failure before generation
-		FGenerationResult CascadeResult;
-		if (CheckUpstreamFailure(Definition.Name, CascadeResult))
-		{
-			CascadeResult.GeneratorId = TEXT("GameplayAbility");
-			CascadeResult.DetermineCategory();
-			Summary.AddResult(CascadeResult);
-			TrackProcessedAsset(CascadeResult.AssetName);
-			LogResultStatus(CascadeResult);
-			continue;
+			LogMessage(FString::Printf(TEXT("[SCHEDULE] %s is in a reference cycle - generating without waiting on it"), *Job.AssetName));
 		}
 
-		FGenerationResult Result = FGameplayAbilityGenerator::Generate(Definition, ManifestData.ProjectRoot);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		// v4.25: Register failure for cascade tracking
-		if (Result.Status == EGenerationStatus::Failed)
+		// v7.8.72: Outside the change set - definition, registry record and package file all unchanged
+		if (Scheduler.IsUpToDate(JobIndex))
 		{
-			RegisterFailure(Definition.Name, TEXT("E_GENERATION_FAILED"));
+			const FGenerationResult UpToDateResult = Scheduler.CompleteUpToDate(JobIndex,
+				TEXT("No changes (definition unchanged since last run, not downstream of a change)"));
+			Summary.AddResult(UpToDateResult);
+			TrackProcessedAsset(UpToDateResult.AssetName);
+			LogResultStatus(UpToDateResult);
+			GeneratedAssets.Add(UpToDateResult.AssetName);
+			continue;
 		}
 
-		// v2.6.7: Handle deferred assets
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
-		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("GameplayAbility");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
+		// v4.25: Check for upstream failure before generation
+		if (Job.bCheckUpstreamFailure)
 		{
-			LogResultStatus(Result);
-			if (Result.Status == EGenerationStatus::New)
+			FGenerationResult CascadeResult;
+			if (CheckUpstreamFailure(Job.AssetName, CascadeResult))
 			{
-				GeneratedAssets.Add(Definition.Name);
+				CascadeResult.GeneratorId = Job.AssetType;
+				CascadeResult.DetermineCategory();
+				Summary.AddResult(CascadeResult);
+				TrackProcessedAsset(CascadeResult.AssetName);
+				LogResultStatus(CascadeResult);
+				Scheduler.Complete(JobIndex);
+				continue;
 			}
 		}
-	}
 
-	// Widget Blueprints
-	for (int32 i = 0; i < ManifestData.WidgetBlueprints.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.WidgetBlueprints[i];
-		FGenerationResult Result = FWidgetBlueprintGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		// v2.6.7: Handle deferred assets
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
+		// v7.8.83: Requeue force mode, per-asset profiling and run-time deferral live in FGenerationScheduler::RunJob
+		FGenerationResult Result;
+		if (!Scheduler.RunJob(JobIndex, Result))
 		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("WidgetBlueprint");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
-		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
+			LogMessage(FString::Printf(TEXT("[SCHEDULE] %s waits for %s (reference not in dependency graph)"),
+				*Job.AssetName, *Result.MissingDependency));
+			continue;
 		}
-	}
 
-	// v4.19: Component Blueprints
-	for (const auto& Definition : ManifestData.ComponentBlueprints)
-	{
-		FGenerationResult Result = FComponentBlueprintGenerator::Generate(Definition, ManifestData.ProjectRoot);
 		Summary.AddResult(Result);
 		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-		if (Result.Status == EGenerationStatus::Failed)
-		{
-			LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-		}
-		if (Result.Status == EGenerationStatus::New)
-		{
-			GeneratedAssets.Add(Definition.Name);
-		}
-	}
+		LogResultStatus(Result);
 
-	// v7.8.52: Blueprint Conditions
-	for (const auto& Definition : ManifestData.BlueprintConditions)
-	{
-		FGenerationResult Result = FBlueprintConditionGenerator::Generate(Definition, ManifestData.ProjectRoot, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		// v4.25: Register failure for cascade tracking
 		if (Result.Status == EGenerationStatus::Failed)
 		{
-			LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
+			RegisterFailure(Job.AssetName, TEXT("E_GENERATION_FAILED"));
 		}
-		if (Result.Status == EGenerationStatus::New)
+		else if (Result.Status == EGenerationStatus::New || Result.Status == EGenerationStatus::Skipped)
 		{
-			GeneratedAssets.Add(Definition.Name);
+			GeneratedAssets.Add(Job.AssetName);
 		}
-	}
 
-	// Blackboards
-	for (const auto& Definition : ManifestData.Blackboards)
-	{
-		FGenerationResult Result = FBlackboardGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		Scheduler.Complete(JobIndex);
 	}
 
-	// Behavior Trees
-	for (const auto& Definition : ManifestData.BehaviorTrees)
-	{
-		FGenerationResult Result = FBehaviorTreeGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	FGeneratorProfiler::EndScope();
 
-	// Materials
-	for (const auto& Definition : ManifestData.Materials)
-	{
-		FGenerationResult Result = FMaterialGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	FGeneratorBase::ClearPreparedState();
 
-	// v2.6.12: Material Functions
-	for (const auto& Definition : ManifestData.MaterialFunctions)
+	// v7.8.68: Flush queued saves - a package that didn't reach disk turns its result into a failure
+	FSaveBatchResult SaveBatch;
 	{
-		FGenerationResult Result = FMaterialFunctionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v4.9: Material Instances
-	for (const auto& Definition : ManifestData.MaterialInstances)
-	{
-		FGenerationResult Result = FMaterialInstanceGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// Tagged Dialogue Sets
-	LogMessage(TEXT("=== v4.37.2 TAGGED DIALOGUE SETS (debug marker) ==="));
-	for (const auto& Definition : ManifestData.TaggedDialogueSets)
-	{
-		FGenerationResult Result = FTaggedDialogueSetGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v2.6.0: Animation Montages
-	for (const auto& Definition : ManifestData.AnimationMontages)
-	{
-		FGenerationResult Result = FAnimationMontageGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		GASGEN_PROFILE_SCOPE("SaveFlush");
+		SaveBatch = FGeneratorBase::FlushSaveBatch();
 	}
-
-	// v2.6.0: Animation Notifies (v4.0: Pass ManifestData for event graph reference lookup)
-	for (const auto& Definition : ManifestData.AnimationNotifies)
+	LogMessage(FString::Printf(TEXT("[SAVE] %d package(s) saved in %.2fs, %d failed"),
+		SaveBatch.SavedCount, SaveBatch.Seconds, SaveBatch.FailedAssets.Num()));
+	for (const FGenerationResult* SaveFailure : FGenerationScheduler::ApplySaveFailures(Summary, SaveBatch.FailedAssets))
 	{
-		FGenerationResult Result = FAnimationNotifyGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		GeneratedAssets.Remove(SaveFailure->AssetName);
+		RegisterFailure(SaveFailure->AssetName, TEXT("E_SAVE_FAILED"));
+		LogResultStatus(*SaveFailure);
 	}
 
-	// v4.37: NPCDefinitions and DialogueBlueprints moved to AFTER AC_* assets
-	// NPCDefinitions depend on AbilityConfigurations/ActivityConfigurations
-	// DialogueBlueprints depend on NPCDefinitions (speaker references)
-	// See generation section after ActivityConfigurations (~line 1465)
-
-	// v2.6.0: Equippable Items (v2.6.9: with deferred handling)
-	for (int32 i = 0; i < ManifestData.EquippableItems.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.EquippableItems[i];
-		FGenerationResult Result = FEquippableItemGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		// v2.6.9: Handle deferred assets
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
-		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("EquippableItem");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
-		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
-		}
-	}
-
-	// v4.28: Consumable Items (Option C - uses EquippableItem generator with superset struct)
-	for (int32 i = 0; i < ManifestData.ConsumableItems.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.ConsumableItems[i];
-		FGenerationResult Result = FEquippableItemGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
-		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("ConsumableItem");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
-		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
-		}
-	}
-
-	// v4.28: Ammo Items (Option C - uses EquippableItem generator with superset struct)
-	for (int32 i = 0; i < ManifestData.AmmoItems.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.AmmoItems[i];
-		FGenerationResult Result = FEquippableItemGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
-		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("AmmoItem");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
-		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
-		}
-	}
-
-	// v4.28: Weapon Attachments (Option C - uses EquippableItem generator with superset struct)
-	for (int32 i = 0; i < ManifestData.WeaponAttachments.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.WeaponAttachments[i];
-		FGenerationResult Result = FEquippableItemGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
-		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("WeaponAttachment");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
-		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
-		}
-	}
-
-	// v2.6.0: Activities (v2.6.9: with deferred handling)
-	for (int32 i = 0; i < ManifestData.Activities.Num(); ++i)
-	{
-		const auto& Definition = ManifestData.Activities[i];
-		FGenerationResult Result = FActivityGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		// v2.6.9: Handle deferred assets
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
-		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("Activity");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
-		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
-		}
-	}
-
-	// v7.8.52: Blueprint Triggers (BPT_ quest task types)
-	for (const auto& Definition : ManifestData.BlueprintTriggers)
-	{
-		FGenerationResult Result = FBlueprintTriggerGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v2.6.0: Ability Configurations
-	for (const auto& Definition : ManifestData.AbilityConfigurations)
-	{
-		FGenerationResult Result = FAbilityConfigurationGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v2.6.0: Activity Configurations
-	for (const auto& Definition : ManifestData.ActivityConfigurations)
-	{
-		FGenerationResult Result = FActivityConfigurationGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v2.6.0: Item Collections
-	for (const auto& Definition : ManifestData.ItemCollections)
-	{
-		FGenerationResult Result = FItemCollectionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v2.6.0: Narrative Events
-	// v7.8.52: Pass ManifestData for EventGraph lookup
-	for (const auto& Definition : ManifestData.NarrativeEvents)
-	{
-		FGenerationResult Result = FNarrativeEventGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v7.8.52: BT Services
-	for (const auto& Definition : ManifestData.BTServices)
-	{
-		FGenerationResult Result = FBTServiceGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v7.8.52: BT Tasks
-	for (const auto& Definition : ManifestData.BTTasks)
-	{
-		FGenerationResult Result = FBTTaskGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v4.37: NPC Definitions - AFTER AC_* (NPCs reference ability/activity configs)
-	// Must come BEFORE DialogueBlueprints (dialogue speakers reference NPC definitions)
-	LogMessage(TEXT("=== v4.37.1 NPC DEFINITIONS BLOCK START (should be AFTER AC_*) ==="));
-	for (int32 i = 0; i < ManifestData.NPCDefinitions.Num(); ++i)
+	// v7.8.72: Hashes for the next incremental run - only assets that ended this run New or Skipped
+	if (!FGeneratorBase::IsDryRunMode())
 	{
-		const auto& Definition = ManifestData.NPCDefinitions[i];
-		FGenerationResult Result = FNPCDefinitionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-
-		// v2.6.9: Handle deferred assets
-		if (Result.Status == EGenerationStatus::Deferred && Result.CanRetry())
-		{
-			FDeferredAsset Deferred;
-			Deferred.AssetName = Definition.Name;
-			Deferred.AssetType = TEXT("NPCDefinition");
-			Deferred.MissingDependency = Result.MissingDependency;
-			Deferred.MissingDependencyType = Result.MissingDependencyType;
-			Deferred.DefinitionIndex = i;
-			DeferredAssets.Add(Deferred);
-			LogMessage(FString::Printf(TEXT("[DEFER] %s (waiting for %s)"), *Result.AssetName, *Result.MissingDependency));
-		}
-		else
+		if (!Scheduler.SaveSnapshot(Summary, CachedManifestPath))
 		{
-			LogMessage(FString::Printf(TEXT("[%s] %s"),
-				Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-				Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-				*Result.AssetName));
-			if (Result.Status == EGenerationStatus::Failed)
-			{
-				LogError(FString::Printf(TEXT("  Error: %s"), *Result.Message));
-			}
-			if (Result.Status == EGenerationStatus::New)
-			{
-				GeneratedAssets.Add(Definition.Name);
-			}
+			LogError(FString::Printf(TEXT("WARNING: Failed to save definition hashes: %s"), *FDefinitionHashSnapshot::GetSnapshotPath(CachedManifestPath)));
 		}
 	}
 
-	// v4.37: Dialogue Blueprints - AFTER NPCDefinitions (speakers reference NPCs)
-	for (const auto& Definition : ManifestData.DialogueBlueprints)
+	// v7.8.69: After the save flush, so the final collection doesn't run with queued packages pending
+	FCompileBatchResult CompileBatch;
 	{
-		FGenerationResult Result = FDialogueBlueprintGenerator::Generate(Definition, ManifestData.ProjectRoot, &ManifestData);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		GASGEN_PROFILE_SCOPE("CompileFlush");
+		CompileBatch = FGeneratorBase::FlushCompileBatch();
 	}
+	LogMessage(FString::Printf(TEXT("[COMPILE] %d Blueprint compile(s) in %.2fs, %d garbage collection(s)"),
+		CompileBatch.CompileCount, CompileBatch.CompileSeconds, CompileBatch.GarbageCollections));
 
-	// v2.6.0: Character Definitions
-	for (const auto& Definition : ManifestData.CharacterDefinitions)
+	if (Scheduler.NumRequeued() > 0 || Scheduler.NumCycleReleases() > 0)
 	{
-		FGenerationResult Result = FCharacterDefinitionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v4.8.3: Character Appearances
-	for (const auto& Definition : ManifestData.CharacterAppearances)
-	{
-		FGenerationResult Result = FCharacterAppearanceGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v4.9: TriggerSets (event-driven NPC behaviors)
-	for (const auto& Definition : ManifestData.TriggerSets)
-	{
-		FGenerationResult Result = FTriggerSetGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v2.6.5: Niagara Systems
-	for (const auto& Definition : ManifestData.NiagaraSystems)
-	{
-		// v4.9: Resolve FX Preset parameters before generation
-		FManifestNiagaraSystemDefinition ResolvedDefinition = Definition;
-		if (!Definition.Preset.IsEmpty())
-		{
-			// Build merged parameters from preset (with inheritance support)
-			TMap<FString, FString> MergedParams;
-			TSet<FString> ProcessedPresets;  // Prevent infinite loops
-			FString CurrentPreset = Definition.Preset;
-
-			while (!CurrentPreset.IsEmpty() && !ProcessedPresets.Contains(CurrentPreset))
-			{
-				ProcessedPresets.Add(CurrentPreset);
-				const FManifestFXPresetDefinition* PresetDef = nullptr;
-				for (const auto& Preset : ManifestData.FXPresets)
-				{
-					if (Preset.Name == CurrentPreset)
-					{
-						PresetDef = &Preset;
-						break;
-					}
-				}
-
-				if (PresetDef)
-				{
-					// Apply parameters (child presets override parent)
-					for (const auto& Param : PresetDef->Parameters)
-					{
-						if (!MergedParams.Contains(Param.Key))
-						{
-							MergedParams.Add(Param.Key, Param.Value);
-						}
-					}
-					CurrentPreset = PresetDef->BasePreset;
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("FX Preset '%s' not found for Niagara system '%s'"), *CurrentPreset, *Definition.Name);
-					break;
-				}
-			}
-
-			// Convert merged params to UserParameters (prepend so manifest user_parameters override)
-			TArray<FManifestNiagaraUserParameter> PresetParams;
-			for (const auto& Param : MergedParams)
-			{
-				// Check if this param is already in user_parameters - if so, skip (user overrides preset)
-				bool bAlreadyDefined = false;
-				for (const auto& UserParam : Definition.UserParameters)
-				{
-					if (UserParam.Name == Param.Key)
-					{
-						bAlreadyDefined = true;
-						break;
-					}
-				}
-				if (!bAlreadyDefined)
-				{
-					FManifestNiagaraUserParameter NewParam;
-					NewParam.Name = Param.Key;
-					NewParam.DefaultValue = Param.Value;
-					// Infer type from value
-					if (Param.Value.StartsWith(TEXT("[")) || Param.Value.Contains(TEXT(",")))
-					{
-						NewParam.Type = TEXT("LinearColor");  // Assume color/vector
-					}
-					else if (Param.Value.IsNumeric() || Param.Value.Contains(TEXT(".")))
-					{
-						NewParam.Type = TEXT("Float");
-					}
-					else
-					{
-						NewParam.Type = TEXT("Float");  // Default
-					}
-					PresetParams.Add(NewParam);
-				}
-			}
-			// Prepend preset params to user params
-			PresetParams.Append(ResolvedDefinition.UserParameters);
-			ResolvedDefinition.UserParameters = PresetParams;
-		}
-
-		FGenerationResult Result = FNiagaraSystemGenerator::Generate(ResolvedDefinition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v3.9: Activity Schedules (NPC daily routines)
-	for (const auto& Definition : ManifestData.ActivitySchedules)
-	{
-		FGenerationResult Result = FActivityScheduleGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
-
-	// v3.9: Quests (quest state machines)
-	for (const auto& Definition : ManifestData.Quests)
-	{
-		FGenerationResult Result = FQuestGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		TrackProcessedAsset(Result.AssetName);
-		LogMessage(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		LogMessage(FString::Printf(TEXT("[SCHEDULE] %d job(s) waited on references discovered during generation, %d released from cycles"),
+			Scheduler.NumRequeued(), Scheduler.NumCycleReleases()));
 	}
 
 	// v4.12: Mesh-to-Item Pipeline
@@ -1789,6 +1209,7 @@ void UGasAbilityGeneratorCommandlet::GenerateAssets(const FManifestData& Manifes
 	{
 		LogMessage(TEXT(""));
 		LogMessage(TEXT("--- Processing Pipeline Items ---"));
+		GASGEN_PROFILE_SCOPE("Pipeline");
 
 		FPipelineProcessor Pipeline;
 		Pipeline.SetProjectRoot(ManifestData.ProjectRoot);
@@ -1857,12 +1278,6 @@ void UGasAbilityGeneratorCommandlet::GenerateAssets(const FManifestData& Manifes
 		LogMessage(FString::Printf(TEXT("Pipeline items processed: %d"), ManifestData.PipelineItems.Num()));
 	}
 
-	// v2.6.7: Process deferred assets (retry mechanism)
-	if (DeferredAssets.Num() > 0)
-	{
-		ProcessDeferredAssets(ManifestData);
-	}
-
 	FGeneratorBase::ClearActiveManifest();
 	FGeneratorBase::ClearLogCallback();  // v7.5.5: Stop forwarding logs
 
@@ -1914,7 +1329,13 @@ void UGasAbilityGeneratorCommandlet::GenerateAssets(const FManifestData& Manifes
 	LastFailedCount = Summary.FailedCount;
 
 	// v3.1: Save the metadata registry
-	GeneratorMetadataHelpers::SaveRegistryIfNeeded();
+	{
+		GASGEN_PROFILE_SCOPE("RegistrySave");
+		GeneratorMetadataHelpers::SaveRegistryIfNeeded();
+	}
+
+	// v7.8.65: Resolution cache effectiveness for this run
+	LogMessage(FGasAbilityGeneratorFunctionResolver::GetResolutionCacheStats().ToString());
 
 	// v4.7: Create and save real-run report (only if not dry-run)
 	if (!FGeneratorBase::IsDryRunMode())
@@ -1935,259 +1356,52 @@ void UGasAbilityGeneratorCommandlet::LogError(const FString& Message)
 	LogMessages.Add(FString::Printf(TEXT("ERROR: %s"), *Message));
 }
 
-// v2.6.7: Process deferred assets with retry mechanism
-void UGasAbilityGeneratorCommandlet::ProcessDeferredAssets(const FManifestData& ManifestData)
+// v7.8.70: Chrome trace + per-asset CSV, then a phase breakdown in the log
+void UGasAbilityGeneratorCommandlet::WriteProfile()
 {
-	if (DeferredAssets.Num() == 0)
-	{
-		return;
-	}
-
 	LogMessage(TEXT(""));
-	LogMessage(TEXT("--- Processing Deferred Assets ---"));
-	LogMessage(FString::Printf(TEXT("%d asset(s) deferred due to missing dependencies"), DeferredAssets.Num()));
-
-	// v7.8.49: Enable force mode for deferred retries to handle CONFLICT status
-	// When an asset is deferred, a partial Blueprint may have been created on disk.
-	// Force mode ensures the retry overwrites this partial asset.
-	const bool bPreviousForceMode = FGeneratorBase::IsForceMode();
-	FGeneratorBase::SetForceMode(true);
-	LogMessage(TEXT("Force mode enabled for deferred asset retries"));
-
-	int32 Pass = 0;
-	int32 ResolvedThisPass = 0;
-
-	do
-	{
-		Pass++;
-		ResolvedThisPass = 0;
-		LogMessage(FString::Printf(TEXT("Retry pass %d..."), Pass));
-
-		TArray<FDeferredAsset> StillDeferred;
-
-		for (FDeferredAsset& Deferred : DeferredAssets)
-		{
-			// v7.8.49: Debug logging for deferred asset processing
-			LogMessage(FString::Printf(TEXT("  [RETRY] Checking deferred: %s (waiting for: %s)"),
-				*Deferred.AssetName, *Deferred.MissingDependency));
-			LogMessage(FString::Printf(TEXT("    GeneratedAssets count: %d, contains dependency: %s"),
-				GeneratedAssets.Num(),
-				GeneratedAssets.Contains(Deferred.MissingDependency) ? TEXT("YES") : TEXT("NO")));
-
-			// Check if dependency is now resolved
-			if (IsDependencyResolved(Deferred.MissingDependency, Deferred.MissingDependencyType))
-			{
-				LogMessage(FString::Printf(TEXT("    Dependency resolved! Attempting retry for: %s"), *Deferred.AssetName));
-				FGenerationResult Result;
-				if (TryGenerateDeferredAsset(Deferred, ManifestData, Result))
-				{
-					LogMessage(FString::Printf(TEXT("[RETRY-OK] %s (dependency %s now available)"),
-						*Deferred.AssetName, *Deferred.MissingDependency));
-					GeneratedAssets.Add(Deferred.AssetName);
-					ResolvedThisPass++;
-				}
-				else
-				{
-					// v7.8.49: Log the actual result status
-					LogMessage(FString::Printf(TEXT("    Retry attempt returned status=%d, message=%s"),
-						static_cast<int32>(Result.Status), *Result.Message));
-					// Still failed after retry
-					Deferred.RetryCount++;
-					if (Deferred.RetryCount < MaxRetryAttempts)
-					{
-						StillDeferred.Add(Deferred);
-						LogMessage(FString::Printf(TEXT("    Re-deferring %s (retry %d/%d)"),
-							*Deferred.AssetName, Deferred.RetryCount, MaxRetryAttempts));
-					}
-					else
-					{
-						LogError(FString::Printf(TEXT("[RETRY-FAIL] %s - max retries exceeded: %s"),
-							*Deferred.AssetName, *Result.Message));
-					}
-				}
-			}
-			else
-			{
-				// Dependency still not resolved
-				Deferred.RetryCount++;
-				if (Deferred.RetryCount < MaxRetryAttempts)
-				{
-					StillDeferred.Add(Deferred);
-				}
-				else
-				{
-					LogError(FString::Printf(TEXT("[UNRESOLVED] %s - dependency %s not found in manifest"),
-						*Deferred.AssetName, *Deferred.MissingDependency));
-				}
-			}
-		}
-
-		DeferredAssets = StillDeferred;
+	LogMessage(TEXT("--- Profile ---"));
 
-	} while (ResolvedThisPass > 0 && DeferredAssets.Num() > 0 && Pass < MaxRetryAttempts);
-
-	if (DeferredAssets.Num() > 0)
-	{
-		LogMessage(FString::Printf(TEXT("%d asset(s) could not be resolved after %d passes"),
-			DeferredAssets.Num(), Pass));
-	}
-	else
+	TArray<TPair<FString, FGeneratorPhaseStats>> Phases;
+	for (const auto& Pair : FGeneratorProfiler::GetPhases())
 	{
-		LogMessage(TEXT("All deferred assets resolved successfully"));
+		Phases.Emplace(Pair.Key, Pair.Value);
 	}
-
-	// v7.8.49: Restore previous force mode
-	FGeneratorBase::SetForceMode(bPreviousForceMode);
-}
-
-// v2.6.7: Check if a dependency has been generated
-bool UGasAbilityGeneratorCommandlet::IsDependencyResolved(const FString& DependencyName, const FString& DependencyType) const
-{
-	// Check if it was generated in this session
-	if (GeneratedAssets.Contains(DependencyName))
+	Phases.Sort([](const TPair<FString, FGeneratorPhaseStats>& A, const TPair<FString, FGeneratorPhaseStats>& B)
 	{
-		return true;
-	}
-
-	// v7.8.49: Also check the session Blueprint cache
-	extern TMap<FString, UClass*> GSessionBlueprintClassCache;
-	if (GSessionBlueprintClassCache.Contains(DependencyName))
+		return A.Value.Seconds > B.Value.Seconds;
+	});
+	for (const auto& Phase : Phases)
 	{
-		return true;
+		LogMessage(FString::Printf(TEXT("[PROFILE] %-20s %9.3fs  %6d call(s)"), *Phase.Key, Phase.Value.Seconds, Phase.Value.Calls));
 	}
+	LogMessage(FString::Printf(TEXT("[PROFILE] Loads=%d Compiles=%d Saves=%d RegistryQueries=%d"),
+		FGeneratorProfiler::GetCounter(EGeneratorCounter::Load),
+		FGeneratorProfiler::GetCounter(EGeneratorCounter::Compile),
+		FGeneratorProfiler::GetCounter(EGeneratorCounter::Save),
+		FGeneratorProfiler::GetCounter(EGeneratorCounter::RegistryQuery)));
 
-	// Check if it exists on disk (may have been generated in a previous run)
-	// This uses the generator base to check disk existence
-	return false; // For now, only check session-generated assets
-}
+	const FString BasePath = FGeneratorProfiler::GetProfileOutputDir() / FString::Printf(TEXT("Profile_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	const FString TracePath = BasePath + TEXT(".json");
+	const FString CsvPath = BasePath + TEXT(".csv");
 
-// v2.6.7: Try to generate a deferred asset
-bool UGasAbilityGeneratorCommandlet::TryGenerateDeferredAsset(const FDeferredAsset& Deferred,
-	const FManifestData& ManifestData, FGenerationResult& OutResult)
-{
-	// Route to appropriate generator based on asset type
-	if (Deferred.AssetType == TEXT("ActorBlueprint"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.ActorBlueprints.Num())
-		{
-			OutResult = FActorBlueprintGenerator::Generate(
-				ManifestData.ActorBlueprints[Deferred.DefinitionIndex],
-				ManifestData.ProjectRoot, &ManifestData);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	else if (Deferred.AssetType == TEXT("GameplayAbility"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.GameplayAbilities.Num())
-		{
-			OutResult = FGameplayAbilityGenerator::Generate(
-				ManifestData.GameplayAbilities[Deferred.DefinitionIndex],
-				ManifestData.ProjectRoot);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	else if (Deferred.AssetType == TEXT("GameplayEffect"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.GameplayEffects.Num())
-		{
-			OutResult = FGameplayEffectGenerator::Generate(
-				ManifestData.GameplayEffects[Deferred.DefinitionIndex]);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	else if (Deferred.AssetType == TEXT("WidgetBlueprint"))
+	if (FGeneratorProfiler::WriteChromeTrace(TracePath))
 	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.WidgetBlueprints.Num())
-		{
-			OutResult = FWidgetBlueprintGenerator::Generate(
-				ManifestData.WidgetBlueprints[Deferred.DefinitionIndex], &ManifestData);
-			return OutResult.Status == EGenerationStatus::New;
-		}
+		LogMessage(FString::Printf(TEXT("[PROFILE] Trace: %s (chrome://tracing or ui.perfetto.dev)"), *TracePath));
 	}
-	// v4.19: ComponentBlueprint retry handling
-	else if (Deferred.AssetType == TEXT("ComponentBlueprint"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.ComponentBlueprints.Num())
-		{
-			OutResult = FComponentBlueprintGenerator::Generate(
-				ManifestData.ComponentBlueprints[Deferred.DefinitionIndex], ManifestData.ProjectRoot);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	// v7.8.52: BlueprintCondition retry handling
-	else if (Deferred.AssetType == TEXT("BlueprintCondition"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.BlueprintConditions.Num())
-		{
-			OutResult = FBlueprintConditionGenerator::Generate(
-				ManifestData.BlueprintConditions[Deferred.DefinitionIndex], ManifestData.ProjectRoot, &ManifestData);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	// v2.6.9: EquippableItem retry handling
-	else if (Deferred.AssetType == TEXT("EquippableItem"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.EquippableItems.Num())
-		{
-			OutResult = FEquippableItemGenerator::Generate(
-				ManifestData.EquippableItems[Deferred.DefinitionIndex]);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	// v4.28: ConsumableItem retry handling (Option C)
-	else if (Deferred.AssetType == TEXT("ConsumableItem"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.ConsumableItems.Num())
-		{
-			OutResult = FEquippableItemGenerator::Generate(
-				ManifestData.ConsumableItems[Deferred.DefinitionIndex]);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	// v4.28: AmmoItem retry handling (Option C)
-	else if (Deferred.AssetType == TEXT("AmmoItem"))
-	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.AmmoItems.Num())
-		{
-			OutResult = FEquippableItemGenerator::Generate(
-				ManifestData.AmmoItems[Deferred.DefinitionIndex]);
-			return OutResult.Status == EGenerationStatus::New;
-		}
-	}
-	// v4.28: WeaponAttachment retry handling (Option C)
-	else if (Deferred.AssetType == TEXT("WeaponAttachment"))
+	else
 	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.WeaponAttachments.Num())
-		{
-			OutResult = FEquippableItemGenerator::Generate(
-				ManifestData.WeaponAttachments[Deferred.DefinitionIndex]);
-			return OutResult.Status == EGenerationStatus::New;
-		}
+		LogError(FString::Printf(TEXT("[PROFILE] Failed to write trace: %s"), *TracePath));
 	}
-	// v2.6.9: Activity retry handling
-	else if (Deferred.AssetType == TEXT("Activity"))
+
+	if (FGeneratorProfiler::WriteCsv(CsvPath))
 	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.Activities.Num())
-		{
-			OutResult = FActivityGenerator::Generate(
-				ManifestData.Activities[Deferred.DefinitionIndex]);
-			return OutResult.Status == EGenerationStatus::New;
-		}
+		LogMessage(FString::Printf(TEXT("[PROFILE] Per-asset CSV: %s"), *CsvPath));
 	}
-	// v2.6.9: NPCDefinition retry handling
-	else if (Deferred.AssetType == TEXT("NPCDefinition"))
+	else
 	{
-		if (Deferred.DefinitionIndex >= 0 && Deferred.DefinitionIndex < ManifestData.NPCDefinitions.Num())
-		{
-			OutResult = FNPCDefinitionGenerator::Generate(
-				ManifestData.NPCDefinitions[Deferred.DefinitionIndex]);
-			return OutResult.Status == EGenerationStatus::New;
-		}
+		LogError(FString::Printf(TEXT("[PROFILE] Failed to write CSV: %s"), *CsvPath));
 	}
-
-	OutResult = FGenerationResult(Deferred.AssetName, EGenerationStatus::Failed,
-		FString::Printf(TEXT("Unknown asset type: %s"), *Deferred.AssetType));
-	return false;
 }
 
 // v2.8.4: Verify generation completeness using whitelist from start
@@ -2274,6 +1488,8 @@ void UGasAbilityGeneratorCommandlet::GenerateLevelActors(const FManifestData& Ma
 		return;
 	}
 
+	GASGEN_PROFILE_SCOPE("LevelActors");
+
 	LogMessage(TEXT(""));
 	LogMessage(TEXT("--- Generating Level Actors ---"));
 	LogMessage(FString::Printf(TEXT("Target World: %s"), *TargetWorld->GetName()));
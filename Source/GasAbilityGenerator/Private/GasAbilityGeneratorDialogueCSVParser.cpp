@@ -456,3 +456,15 @@ TArray<FManifestDialogueConditionDefinition> FDialogueCSVParser::ParseConditions
 
 	return Result;
 }
+
+void FDialogueCSVParser::ApplyToManifest(const TArray<FManifestDialogueBlueprintDefinition>& CSVDialogues, FManifestData& ManifestData)
+{
+	for (const FManifestDialogueBlueprintDefinition& Dialogue : CSVDialogues)
+	{
+		// Remove existing definition with same name (CSV overrides YAML)
+		ManifestData.DialogueBlueprints.RemoveAll([&](const FManifestDialogueBlueprintDefinition& Existing) {
+			return Existing.Name == Dialogue.Name;
+		});
+		ManifestData.DialogueBlueprints.Add(Dialogue);
+	}
+}
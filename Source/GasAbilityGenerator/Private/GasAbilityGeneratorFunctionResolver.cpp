@@ -1,5 +1,10 @@
-// GasAbilityGenerator v4.31 - Function Resolution Parity System
+// GasAbilityGenerator v7.8.84 - Function Resolution Parity System
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v4.31: Shared resolver - identical function resolution for Generator and PreValidator
+// v7.8.64: FindClassByName via FGeneratorAssetIndex, with a session negative cache
+// v7.8.65: Memoizing resolution cache with compile-time invalidation and stats
+// v7.8.70: Registry lookups counted by the generation profiler
+// v7.8.84: Compile hook handle removed in Shutdown; class names cached as BP_X_C invalidated by BP_X compiles
 
 #include "GasAbilityGeneratorFunctionResolver.h"
 
@@ -7,6 +12,8 @@
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Class.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "GasAbilityGeneratorAssetIndex.h"  // v7.8.64: Shared Blueprint name index
+#include "GasAbilityGeneratorProfiler.h"  // v7.8.70
 
 // Classes for WellKnownFunctions table
 #include "Kismet/KismetSystemLibrary.h"
@@ -33,6 +40,7 @@
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "K2Node_FunctionEntry.h"
+#include "Editor.h"  // v7.8.65: OnBlueprintPreCompile for cache invalidation
 
 // Narrative Pro includes for WellKnownFunctions
 #include "Items/InventoryComponent.h"
@@ -46,6 +54,29 @@
 TMap<FString, UClass*> FGasAbilityGeneratorFunctionResolver::WellKnownFunctions;
 bool FGasAbilityGeneratorFunctionResolver::bWellKnownFunctionsInitialized = false;
 
+// v7.8.65: Resolution cache (steps 1-4). Weak pointers so GC'd/reinstanced classes read as stale.
+struct FResolverCacheEntry
+{
+	TWeakObjectPtr<UFunction> Function;
+	TWeakObjectPtr<UClass> OwnerClass;
+	TWeakObjectPtr<UClass> ParentClass;
+	FString ExplicitClassName;
+	FString ResolutionPath;
+	bool bFound = false;
+	bool bHadFunction = false;
+	bool bHadOwnerClass = false;
+
+	bool IsStale() const
+	{
+		return (bHadFunction && !Function.IsValid()) || (bHadOwnerClass && !OwnerClass.IsValid());
+	}
+};
+
+static FCriticalSection GResolverCacheLock;
+static TMap<FString, FResolverCacheEntry> GResolverCache;
+static FFunctionResolverCacheStats GResolverCacheStats;
+static FDelegateHandle GResolverCompileHookHandle;  // v7.8.84: Kept so Shutdown can unbind
+
 void FGasAbilityGeneratorFunctionResolver::EnsureWellKnownFunctionsInitialized()
 {
 	if (bWellKnownFunctionsInitialized)
@@ -467,68 +498,59 @@ FResolvedFunction FGasAbilityGeneratorFunctionResolver::ResolveViaBlueprintAsset
 		return FResolvedFunction();
 	}
 
-	// Use Asset Registry to find all Blueprint assets matching the name
-	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
-
-	FARFilter Filter;
-	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-	Filter.bRecursiveClasses = true;
-	Filter.bRecursivePaths = true;
-
+	// Find Blueprint assets matching the name
+	// v7.8.65: Via the shared name index (was a full recursive GetAssets per call)
 	TArray<FAssetData> BlueprintAssets;
-	AssetRegistry.GetAssets(Filter, BlueprintAssets);
+	FGeneratorAssetIndex::FindBlueprints(FName(*BlueprintName), BlueprintAssets);
 
 	// Find the Blueprint with matching name
 	for (const FAssetData& AssetData : BlueprintAssets)
 	{
-		if (AssetData.AssetName.ToString().Equals(BlueprintName, ESearchCase::IgnoreCase))
+		// Load the Blueprint
+		UBlueprint* FoundBlueprint = Cast<UBlueprint>(AssetData.GetAsset());
+		if (FoundBlueprint)
 		{
-			// Load the Blueprint
-			UBlueprint* FoundBlueprint = Cast<UBlueprint>(AssetData.GetAsset());
-			if (FoundBlueprint)
-			{
-				UE_LOG(LogTemp, Display, TEXT("[FunctionResolver] Found Blueprint asset '%s', searching FunctionGraphs for '%s'"),
-					*BlueprintName, *FunctionName);
+			UE_LOG(LogTemp, Display, TEXT("[FunctionResolver] Found Blueprint asset '%s', searching FunctionGraphs for '%s'"),
+				*BlueprintName, *FunctionName);
 
-				// v7.8.37: First check GeneratedClass for inherited/native functions
-				UClass* BPClass = FoundBlueprint->GeneratedClass ? FoundBlueprint->GeneratedClass : FoundBlueprint->SkeletonGeneratedClass;
-				if (BPClass)
+			// v7.8.37: First check GeneratedClass for inherited/native functions
+			UClass* BPClass = FoundBlueprint->GeneratedClass ? FoundBlueprint->GeneratedClass : FoundBlueprint->SkeletonGeneratedClass;
+			if (BPClass)
+			{
+				UFunction* Function = BPClass->FindFunctionByName(*FunctionName);
+				if (Function)
 				{
-					UFunction* Function = BPClass->FindFunctionByName(*FunctionName);
-					if (Function)
-					{
-						FResolvedFunction Result;
-						Result.Function = Function;
-						Result.OwnerClass = BPClass;
-						Result.bFound = true;
-						Result.ResolutionPath = FString::Printf(TEXT("BlueprintAsset[%s::%s](GeneratedClass)"), *BlueprintName, *FunctionName);
-						UE_LOG(LogTemp, Display, TEXT("[FunctionResolver] Found function '%s' on Blueprint '%s' GeneratedClass"),
-							*FunctionName, *BlueprintName);
-						return Result;
-					}
+					FResolvedFunction Result;
+					Result.Function = Function;
+					Result.OwnerClass = BPClass;
+					Result.bFound = true;
+					Result.ResolutionPath = FString::Printf(TEXT("BlueprintAsset[%s::%s](GeneratedClass)"), *BlueprintName, *FunctionName);
+					UE_LOG(LogTemp, Display, TEXT("[FunctionResolver] Found function '%s' on Blueprint '%s' GeneratedClass"),
+						*FunctionName, *BlueprintName);
+					return Result;
 				}
+			}
 
-				// Search its FunctionGraphs for custom Blueprint functions
-				for (UEdGraph* Graph : FoundBlueprint->FunctionGraphs)
+			// Search its FunctionGraphs for custom Blueprint functions
+			for (UEdGraph* Graph : FoundBlueprint->FunctionGraphs)
+			{
+				if (Graph && Graph->GetFName() == FName(*FunctionName))
 				{
-					if (Graph && Graph->GetFName() == FName(*FunctionName))
-					{
-						// Found the function graph - return pending result
-						// The function will be resolved at compile time via SetExternalMember
-						FResolvedFunction Result;
-						Result.Function = nullptr;  // Will be resolved at runtime
-						Result.OwnerClass = BPClass;
-						Result.bFound = true;
-						Result.ResolutionPath = FString::Printf(TEXT("BlueprintAsset[%s::%s]"), *BlueprintName, *FunctionName);
-						return Result;
-					}
+					// Found the function graph - return pending result
+					// The function will be resolved at compile time via SetExternalMember
+					FResolvedFunction Result;
+					Result.Function = nullptr;  // Will be resolved at runtime
+					Result.OwnerClass = BPClass;
+					Result.bFound = true;
+					Result.ResolutionPath = FString::Printf(TEXT("BlueprintAsset[%s::%s]"), *BlueprintName, *FunctionName);
+					return Result;
 				}
-
-				UE_LOG(LogTemp, Warning, TEXT("[FunctionResolver] Blueprint '%s' found but function '%s' not in GeneratedClass or FunctionGraphs"),
-					*BlueprintName, *FunctionName);
 			}
-			break;
+
+			UE_LOG(LogTemp, Warning, TEXT("[FunctionResolver] Blueprint '%s' found but function '%s' not in GeneratedClass or FunctionGraphs"),
+				*BlueprintName, *FunctionName);
 		}
+		break;
 	}
 
 	return FResolvedFunction();
@@ -546,6 +568,74 @@ FResolvedFunction FGasAbilityGeneratorFunctionResolver::ResolveFunction(
 		return FResolvedFunction();
 	}
 
+	// v7.8.65: Steps 1-4 are memoized; hook Blueprint compiles once so entries can't go stale
+	if (!GResolverCompileHookHandle.IsValid() && GEditor)
+	{
+		GResolverCompileHookHandle = GEditor->OnBlueprintPreCompile().AddStatic(&FGasAbilityGeneratorFunctionResolver::OnBlueprintPreCompile);
+	}
+
+	const FString CacheKey = FString::Printf(TEXT("%s|%s|%s|%d"),
+		*FunctionName, *ExplicitClassName, ParentClass ? *ParentClass->GetPathName() : TEXT(""), bTargetSelf ? 1 : 0);
+
+	FResolvedFunction Result;
+	bool bCacheHit = false;
+	{
+		FScopeLock Lock(&GResolverCacheLock);
+		if (const FResolverCacheEntry* Entry = GResolverCache.Find(CacheKey))
+		{
+			if (!Entry->IsStale())
+			{
+				Result.Function = Entry->Function.Get();
+				Result.OwnerClass = Entry->OwnerClass.Get();
+				Result.bFound = Entry->bFound;
+				Result.ResolutionPath = Entry->ResolutionPath;
+				bCacheHit = true;
+				GResolverCacheStats.Hits++;
+			}
+		}
+	}
+
+	if (!bCacheHit)
+	{
+		Result = ResolveUncached(FunctionName, ExplicitClassName, ParentClass, bTargetSelf);
+
+		FResolverCacheEntry Entry;
+		Entry.Function = Result.Function;
+		Entry.OwnerClass = Result.OwnerClass;
+		Entry.ParentClass = ParentClass;
+		Entry.ExplicitClassName = ExplicitClassName;
+		Entry.ResolutionPath = Result.ResolutionPath;
+		Entry.bFound = Result.bFound;
+		Entry.bHadFunction = Result.Function != nullptr;
+		Entry.bHadOwnerClass = Result.OwnerClass != nullptr;
+
+		FScopeLock Lock(&GResolverCacheLock);
+		GResolverCache.Add(CacheKey, MoveTemp(Entry));
+		GResolverCacheStats.Misses++;
+	}
+
+	if (Result.bFound)
+	{
+		return Result;
+	}
+
+	// Step 5: Blueprint FunctionGraph (v4.31) - search custom functions in same Blueprint
+	// Only applies during generation when Blueprint is available
+	// v7.8.65: Never cached - the Blueprint's graphs change while it is being generated
+	if (Blueprint)
+	{
+		Result = ResolveViaBlueprintFunctionGraph(FunctionName, Blueprint);
+	}
+
+	return Result;
+}
+
+FResolvedFunction FGasAbilityGeneratorFunctionResolver::ResolveUncached(
+	const FString& FunctionName,
+	const FString& ExplicitClassName,
+	UClass* ParentClass,
+	bool bTargetSelf)
+{
 	FResolvedFunction Result;
 
 	// v7.5: When target_self is true, parent chain takes PRIORITY over WellKnown
@@ -605,20 +695,77 @@ FResolvedFunction FGasAbilityGeneratorFunctionResolver::ResolveFunction(
 	}
 
 	// Step 4: Library fallback (exact name only)
-	Result = ResolveViaLibraryFallback(FunctionName);
-	if (Result.bFound)
+	return ResolveViaLibraryFallback(FunctionName);
+}
+
+void FGasAbilityGeneratorFunctionResolver::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
 	{
-		return Result;
+		return;
 	}
 
-	// Step 5: Blueprint FunctionGraph (v4.31) - search custom functions in same Blueprint
-	// Only applies during generation when Blueprint is available
-	if (Blueprint)
+	const FString BlueprintName = Blueprint->GetName();
+	UClass* GeneratedClass = Blueprint->GeneratedClass;
+	UClass* SkeletonClass = Blueprint->SkeletonGeneratedClass;
+
+	FScopeLock Lock(&GResolverCacheLock);
+	for (auto It = GResolverCache.CreateIterator(); It; ++It)
 	{
-		Result = ResolveViaBlueprintFunctionGraph(FunctionName, Blueprint);
+		const FResolverCacheEntry& Entry = It.Value();
+		UClass* EntryParent = Entry.ParentClass.Get();
+		UClass* EntryOwner = Entry.OwnerClass.Get();
+
+		// v7.8.84: The manifest may name the generated class (BP_X_C) or its path - compare the asset name
+		FString EntryClassName = Entry.ExplicitClassName;
+		int32 Separator;
+		if (EntryClassName.FindLastChar(TEXT('.'), Separator) || EntryClassName.FindLastChar(TEXT('/'), Separator))
+		{
+			EntryClassName.RightChopInline(Separator + 1);
+		}
+		EntryClassName.RemoveFromEnd(TEXT("_C"), ESearchCase::IgnoreCase);
+
+		const bool bDependsOnBlueprint =
+			Entry.IsStale() ||
+			EntryClassName.Equals(BlueprintName, ESearchCase::IgnoreCase) ||
+			(EntryOwner && (EntryOwner == GeneratedClass || EntryOwner == SkeletonClass)) ||
+			(EntryParent && GeneratedClass && EntryParent->IsChildOf(GeneratedClass)) ||
+			(EntryParent && SkeletonClass && EntryParent->IsChildOf(SkeletonClass));
+
+		if (bDependsOnBlueprint)
+		{
+			It.RemoveCurrent();
+			GResolverCacheStats.Invalidations++;
+		}
 	}
+}
 
-	return Result;
+void FGasAbilityGeneratorFunctionResolver::ResetResolutionCache()
+{
+	FScopeLock Lock(&GResolverCacheLock);
+	GResolverCache.Empty();
+	GResolverCacheStats = FFunctionResolverCacheStats();
+}
+
+void FGasAbilityGeneratorFunctionResolver::Shutdown()
+{
+	if (GResolverCompileHookHandle.IsValid())
+	{
+		if (GEditor)
+		{
+			GEditor->OnBlueprintPreCompile().Remove(GResolverCompileHookHandle);
+		}
+		GResolverCompileHookHandle.Reset();
+	}
+	ResetResolutionCache();
+}
+
+FFunctionResolverCacheStats FGasAbilityGeneratorFunctionResolver::GetResolutionCacheStats()
+{
+	FScopeLock Lock(&GResolverCacheLock);
+	FFunctionResolverCacheStats Stats = GResolverCacheStats;
+	Stats.Entries = GResolverCache.Num();
+	return Stats;
 }
 
 bool FGasAbilityGeneratorFunctionResolver::FunctionExists(
@@ -661,6 +808,12 @@ UClass* FGasAbilityGeneratorFunctionResolver::FindClassByName(const FString& Cla
 		}
 	}
 
+	// v7.8.64: Names that already failed the full lookup this session (cleared on asset add)
+	if (FGeneratorAssetIndex::IsKnownMissing(TEXT("ResolverClass"), ClassName))
+	{
+		return nullptr;
+	}
+
 	// Try native class first (strip U/A prefix if present)
 	FString NormalizedName = ClassName;
 	if (NormalizedName.Len() > 1 && (NormalizedName[0] == 'U' || NormalizedName[0] == 'A'))
@@ -723,6 +876,7 @@ UClass* FGasAbilityGeneratorFunctionResolver::FindClassByName(const FString& Cla
 	for (const FString& Path : SearchPaths)
 	{
 		FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Path));
+		FGeneratorProfiler::Increment(EGeneratorCounter::RegistryQuery);
 		if (AssetData.IsValid())
 		{
 			Class = LoadObject<UClass>(nullptr, *Path);
@@ -731,29 +885,22 @@ UClass* FGasAbilityGeneratorFunctionResolver::FindClassByName(const FString& Cla
 	}
 
 	// v7.8.37: Search ALL Blueprints by name (includes plugin content like NarrativePro)
-	// This is similar to what ResolveViaBlueprintAsset does
-	FARFilter Filter;
-	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-	Filter.bRecursiveClasses = true;
-	Filter.bRecursivePaths = true;
-
+	// v7.8.64: Via the shared session name index (was a full recursive GetAssets per call)
 	TArray<FAssetData> BlueprintAssets;
-	AssetRegistry.GetAssets(Filter, BlueprintAssets);
+	FGeneratorAssetIndex::FindBlueprints(FName(*ClassName), BlueprintAssets);
 
 	for (const FAssetData& AssetData : BlueprintAssets)
 	{
-		if (AssetData.AssetName.ToString().Equals(ClassName, ESearchCase::IgnoreCase))
+		// Found Blueprint asset - load its GeneratedClass
+		UBlueprint* FoundBlueprint = Cast<UBlueprint>(AssetData.GetAsset());
+		if (FoundBlueprint && FoundBlueprint->GeneratedClass)
 		{
-			// Found Blueprint asset - load its GeneratedClass
-			UBlueprint* FoundBlueprint = Cast<UBlueprint>(AssetData.GetAsset());
-			if (FoundBlueprint && FoundBlueprint->GeneratedClass)
-			{
-				UE_LOG(LogTemp, Display, TEXT("[FindClassByName] Found Blueprint '%s' via Asset Registry: %s"),
-					*ClassName, *AssetData.GetObjectPathString());
-				return FoundBlueprint->GeneratedClass;
-			}
+			UE_LOG(LogTemp, Display, TEXT("[FindClassByName] Found Blueprint '%s' via Asset Registry: %s"),
+				*ClassName, *AssetData.GetObjectPathString());
+			return FoundBlueprint->GeneratedClass;
 		}
 	}
 
+	FGeneratorAssetIndex::MarkMissing(TEXT("ResolverClass"), ClassName);
 	return nullptr;
 }
@@ -1,5 +1,15 @@
-// GasAbilityGenerator v7.8.56
+// GasAbilityGenerator v7.8.84
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.84: MODIFY'd packages are saved immediately, outside the save batch
+// v7.8.83: Save batch - a replaced queued save drops its asset's pending notification, writes checked against the pre-save stamp
+// v7.8.72: IsUpToDateInRegistry for incremental change sets
+// v7.8.70: Profiler scopes/counters on compile, save, existence check, parent class lookup and event graph
+// v7.8.69: Blueprint compiles via FGeneratorBase::CompileBlueprint (GC batched across a run)
+// v7.8.68: Package saves and AssetCreated notifications go through the save batch (SafeSavePackage / NotifyAssetCreated)
+// v7.8.67: Definition input hashes and package stats reused from the scheduler prepare stage
+// v7.8.64: FindParentClass/FindUserDefinedEnum use FGeneratorAssetIndex (name index + negative cache)
+// v7.8.63: CheckExistsWithMetadata registry fast path - SKIP without StaticLoadObject when record + package file match
+// v7.8.62: 64-bit GeneratorHash output hashes, HashVersion stamping and legacy-record migration in CheckExistsWithMetadata
 // v7.8.56: GA_FatherMark mark system - ArrayLength, ArrayRemove, ArrayRemoveIndex node types
 //        Enables mark limit check (ArrayLength) and oldest mark rotation (ArrayRemove/ArrayRemoveIndex)
 //        Required for Joint Audit v2.0 manifest enhancement
@@ -106,6 +116,8 @@
 #include "Misc/PackageName.h"
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
+#include "GasAbilityGeneratorAssetIndex.h"  // v7.8.64
+#include "GasAbilityGeneratorProfiler.h"  // v7.8.70
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Factories/BlueprintFactory.h"
 #include "Kismet2/KismetEditorUtilities.h"
@@ -394,6 +406,22 @@ bool FGeneratorBase::bForceMode = false;
 FDryRunSummary FGeneratorBase::DryRunSummary;
 FString FGeneratorBase::CurrentManifestPath;
 
+// v7.8.67: Static member initialization for prepare-stage results
+TMap<const void*, uint64> FGeneratorBase::PreparedInputHashes;
+TMap<FString, FFileStatData> FGeneratorBase::PreparedPackageStats;
+
+// v7.8.68: Static member initialization for the save batch
+bool FGeneratorBase::bSaveBatchActive = false;
+TArray<FGeneratorBase::FQueuedPackageSave> FGeneratorBase::QueuedSaves;
+TMap<FString, int32> FGeneratorBase::QueuedSaveIndexByPackage;
+TMap<UObject*, FGeneratorBase::FQueuedAssetCreation> FGeneratorBase::QueuedAssetCreations;
+TSet<FString> FGeneratorBase::ImmediateSavePackages;
+
+// v7.8.69: Static member initialization for the compile batch
+bool FGeneratorBase::bCompileBatchActive = false;
+int32 FGeneratorBase::CompilesSinceGC = 0;
+FCompileBatchResult FGeneratorBase::CompileBatchStats;
+
 // v7.5.5: Static member initialization for log callback
 FGeneratorLogCallback FGeneratorBase::LogCallback;
 
@@ -458,6 +486,7 @@ static void StoreBlueprintMetadata(
 	Metadata.GeneratorVersion = GENERATOR_VERSION;
 	Metadata.Timestamp = FDateTime::Now();
 	Metadata.bIsGenerated = true;
+	Metadata.HashVersion = GeneratorHash::Version;
 
 	FGeneratorBase::StoreAssetMetadata(Blueprint, Metadata);
 }
@@ -483,6 +512,7 @@ static void StoreDataAssetMetadata(
 	Metadata.GeneratorVersion = GENERATOR_VERSION;
 	Metadata.Timestamp = FDateTime::Now();
 	Metadata.bIsGenerated = true;
+	Metadata.HashVersion = GeneratorHash::Version;
 
 	FGeneratorBase::StoreAssetMetadata(Asset, Metadata);
 }
@@ -857,7 +887,23 @@ UGeneratorAssetMetadata* FGeneratorBase::GetAssetMetadata(UObject* Asset)
 	return GeneratorMetadataHelpers::GetMetadata(Asset);
 }
 
-uint64 FGeneratorBase::ComputeBlueprintOutputHash(UBlueprint* Blueprint)
+// v7.8.62: Output hashes are computed by one body per asset kind, parameterized on the field hash.
+// Current records use GeneratorHash::Of (64-bit); LegacyFieldHash reproduces the pre-v7.8.62
+// 32-bit GetTypeHash values exactly so existing records can still be checked for manual edits.
+struct FLegacyFieldHash
+{
+	template <typename T>
+	uint32 operator()(const T& Value) const { return GetTypeHash(Value); }
+};
+
+struct FCurrentFieldHash
+{
+	template <typename T>
+	uint64 operator()(const T& Value) const { return GeneratorHash::Of(Value); }
+};
+
+template <typename FieldHashFn>
+static uint64 ComputeBlueprintOutputHashImpl(UBlueprint* Blueprint, FieldHashFn HashField)
 {
 	if (!Blueprint)
 	{
@@ -867,8 +913,8 @@ uint64 FGeneratorBase::ComputeBlueprintOutputHash(UBlueprint* Blueprint)
 	uint64 Hash = 0;
 
 	// Hash basic Blueprint info
-	Hash ^= GetTypeHash(Blueprint->GetName());
-	Hash ^= GetTypeHash(Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : TEXT("None")) << 8;
+	Hash ^= HashField(Blueprint->GetName());
+	Hash ^= HashField(Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : TEXT("None")) << 8;
 
 	// Hash new variable count
 	Hash ^= static_cast<uint64>(Blueprint->NewVariables.Num()) << 16;
@@ -876,8 +922,8 @@ uint64 FGeneratorBase::ComputeBlueprintOutputHash(UBlueprint* Blueprint)
 	// Hash each variable name and type
 	for (const FBPVariableDescription& Var : Blueprint->NewVariables)
 	{
-		Hash ^= GetTypeHash(Var.VarName.ToString());
-		Hash ^= GetTypeHash(Var.VarType.PinCategory.ToString()) << 4;
+		Hash ^= HashField(Var.VarName.ToString());
+		Hash ^= HashField(Var.VarType.PinCategory.ToString()) << 4;
 		Hash = (Hash << 3) | (Hash >> 61);
 	}
 
@@ -893,7 +939,7 @@ uint64 FGeneratorBase::ComputeBlueprintOutputHash(UBlueprint* Blueprint)
 		for (UEdGraphNode* Node : Graph->Nodes)
 		{
 			if (!Node) continue;
-			Hash ^= GetTypeHash(Node->GetClass()->GetName());
+			Hash ^= HashField(Node->GetClass()->GetName());
 			Hash = (Hash << 5) | (Hash >> 59);
 
 			// Hash pin count
@@ -904,7 +950,8 @@ uint64 FGeneratorBase::ComputeBlueprintOutputHash(UBlueprint* Blueprint)
 	return Hash;
 }
 
-uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
+template <typename FieldHashFn>
+static uint64 ComputeDataAssetOutputHashImpl(UObject* DataAsset, FieldHashFn HashField)
 {
 	if (!DataAsset)
 	{
@@ -914,8 +961,8 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 	uint64 Hash = 0;
 
 	// Hash basic info
-	Hash ^= GetTypeHash(DataAsset->GetName());
-	Hash ^= GetTypeHash(DataAsset->GetClass()->GetName()) << 8;
+	Hash ^= HashField(DataAsset->GetName());
+	Hash ^= HashField(DataAsset->GetClass()->GetName()) << 8;
 
 	// v3.0: Type-specific hashing for manual edit detection
 
@@ -925,10 +972,10 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		Hash ^= static_cast<uint64>(Blackboard->Keys.Num()) << 16;
 		for (const FBlackboardEntry& Entry : Blackboard->Keys)
 		{
-			Hash ^= GetTypeHash(Entry.EntryName);
+			Hash ^= HashField(Entry.EntryName);
 			if (Entry.KeyType)
 			{
-				Hash ^= GetTypeHash(Entry.KeyType->GetClass()->GetName()) << 4;
+				Hash ^= HashField(Entry.KeyType->GetClass()->GetName()) << 4;
 			}
 		}
 		return Hash;
@@ -940,7 +987,7 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		Hash ^= static_cast<uint64>(Effect->Modifiers.Num()) << 16;
 		for (const FGameplayModifierInfo& Mod : Effect->Modifiers)
 		{
-			Hash ^= GetTypeHash(Mod.Attribute.GetName());
+			Hash ^= HashField(Mod.Attribute.GetName());
 			Hash ^= static_cast<uint64>(Mod.ModifierOp) << 4;
 		}
 		Hash ^= static_cast<uint64>(Effect->DurationPolicy) << 24;
@@ -967,9 +1014,9 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		{
 			if (Mapping.Action)
 			{
-				Hash ^= GetTypeHash(Mapping.Action->GetName());
+				Hash ^= HashField(Mapping.Action->GetName());
 			}
-			Hash ^= GetTypeHash(Mapping.Key.GetFName()) << 4;
+			Hash ^= HashField(Mapping.Key.GetFName()) << 4;
 		}
 		return Hash;
 	}
@@ -980,7 +1027,7 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		Hash ^= BT->RootNode ? 1ULL << 16 : 0ULL;
 		if (BT->BlackboardAsset)
 		{
-			Hash ^= GetTypeHash(BT->BlackboardAsset->GetName()) << 24;
+			Hash ^= HashField(BT->BlackboardAsset->GetName()) << 24;
 		}
 		return Hash;
 	}
@@ -991,7 +1038,7 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		Hash ^= static_cast<uint64>(Enum->NumEnums()) << 16;
 		for (int32 i = 0; i < Enum->NumEnums(); i++)
 		{
-			Hash ^= GetTypeHash(Enum->GetNameStringByIndex(i));
+			Hash ^= HashField(Enum->GetNameStringByIndex(i));
 		}
 		return Hash;
 	}
@@ -1003,8 +1050,8 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		Hash ^= static_cast<uint64>(Keys.Num()) << 16;
 		for (const FRichCurveKey& Key : Keys)
 		{
-			Hash ^= GetTypeHash(Key.Time) << 4;
-			Hash ^= GetTypeHash(Key.Value) << 8;
+			Hash ^= HashField(Key.Time) << 4;
+			Hash ^= HashField(Key.Value) << 8;
 		}
 		return Hash;
 	}
@@ -1015,11 +1062,11 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		Hash ^= static_cast<uint64>(Montage->SlotAnimTracks.Num()) << 16;
 		Hash ^= static_cast<uint64>(Montage->CompositeSections.Num()) << 24;
 		// Cast to uint64 before shifting to avoid overflow
-		Hash ^= static_cast<uint64>(GetTypeHash(Montage->BlendIn.GetBlendTime())) << 8;
-		Hash ^= static_cast<uint64>(GetTypeHash(Montage->BlendOut.GetBlendTime())) << 12;
+		Hash ^= static_cast<uint64>(HashField(Montage->BlendIn.GetBlendTime())) << 8;
+		Hash ^= static_cast<uint64>(HashField(Montage->BlendOut.GetBlendTime())) << 12;
 		for (const FSlotAnimationTrack& Track : Montage->SlotAnimTracks)
 		{
-			Hash ^= GetTypeHash(Track.SlotName);
+			Hash ^= HashField(Track.SlotName);
 		}
 		return Hash;
 	}
@@ -1057,7 +1104,7 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		{
 			if (Ability.Get())
 			{
-				Hash ^= GetTypeHash(Ability.Get()->GetName());
+				Hash ^= HashField(Ability.Get()->GetName());
 			}
 		}
 		return Hash;
@@ -1066,14 +1113,14 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 	// NPCActivityConfiguration - hash activities and rescore interval
 	if (UNPCActivityConfiguration* ActivityConfig = Cast<UNPCActivityConfiguration>(DataAsset))
 	{
-		Hash ^= static_cast<uint64>(GetTypeHash(ActivityConfig->RescoreInterval)) << 16;
+		Hash ^= static_cast<uint64>(HashField(ActivityConfig->RescoreInterval)) << 16;
 		Hash ^= static_cast<uint64>(ActivityConfig->DefaultActivities.Num()) << 24;
 		Hash ^= static_cast<uint64>(ActivityConfig->GoalGenerators.Num()) << 32;
 		for (const TSubclassOf<UNPCActivity>& Activity : ActivityConfig->DefaultActivities)
 		{
 			if (Activity.Get())
 			{
-				Hash ^= GetTypeHash(Activity.Get()->GetName());
+				Hash ^= HashField(Activity.Get()->GetName());
 			}
 		}
 		return Hash;
@@ -1088,7 +1135,7 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 			Hash ^= static_cast<uint64>(Item.Quantity) << 4;
 			if (!Item.Item.IsNull())
 			{
-				Hash ^= GetTypeHash(Item.Item.GetAssetName());
+				Hash ^= HashField(Item.Item.GetAssetName());
 			}
 		}
 		return Hash;
@@ -1097,15 +1144,15 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 	// NPCDefinition - hash NPC properties
 	if (UNPCDefinition* NPCDef = Cast<UNPCDefinition>(DataAsset))
 	{
-		Hash ^= GetTypeHash(NPCDef->NPCID) << 16;
-		Hash ^= GetTypeHash(NPCDef->NPCName.ToString()) << 8;
+		Hash ^= HashField(NPCDef->NPCID) << 16;
+		Hash ^= HashField(NPCDef->NPCName.ToString()) << 8;
 		Hash ^= static_cast<uint64>(NPCDef->MinLevel) << 24;
 		Hash ^= static_cast<uint64>(NPCDef->MaxLevel) << 32;
 		Hash ^= NPCDef->bAllowMultipleInstances ? 1ULL << 40 : 0ULL;
 		Hash ^= NPCDef->bIsVendor ? 1ULL << 41 : 0ULL;
 		if (NPCDef->AbilityConfiguration)
 		{
-			Hash ^= GetTypeHash(NPCDef->AbilityConfiguration->GetName());
+			Hash ^= HashField(NPCDef->AbilityConfiguration->GetName());
 		}
 		return Hash;
 	}
@@ -1126,9 +1173,9 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 		Hash ^= static_cast<uint64>(DialogueSet->TaggedDialogues.Num()) << 16;
 		for (const FTaggedDialogue& Dialogue : DialogueSet->TaggedDialogues)
 		{
-			Hash ^= GetTypeHash(Dialogue.Tag.GetTagName());
-			Hash ^= static_cast<uint64>(GetTypeHash(Dialogue.Cooldown)) << 4;
-			Hash ^= static_cast<uint64>(GetTypeHash(Dialogue.MaxDistance)) << 8;
+			Hash ^= HashField(Dialogue.Tag.GetTagName());
+			Hash ^= static_cast<uint64>(HashField(Dialogue.Cooldown)) << 4;
+			Hash ^= static_cast<uint64>(HashField(Dialogue.MaxDistance)) << 8;
 		}
 		return Hash;
 	}
@@ -1137,7 +1184,7 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 	if (UNiagaraSystem* NiagaraSys = Cast<UNiagaraSystem>(DataAsset))
 	{
 		Hash ^= static_cast<uint64>(NiagaraSys->GetNumEmitters()) << 16;
-		Hash ^= static_cast<uint64>(GetTypeHash(NiagaraSys->GetWarmupTime())) << 24;
+		Hash ^= static_cast<uint64>(HashField(NiagaraSys->GetWarmupTime())) << 24;
 		// Hash user parameter count via GetUserParameters
 		TArray<FNiagaraVariable> UserParamArray;
 		NiagaraSys->GetExposedParameters().GetUserParameters(UserParamArray);
@@ -1156,6 +1203,28 @@ uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
 	return Hash;
 }
 
+uint64 FGeneratorBase::ComputeBlueprintOutputHash(UBlueprint* Blueprint)
+{
+	return ComputeBlueprintOutputHashImpl(Blueprint, FCurrentFieldHash());
+}
+
+uint64 FGeneratorBase::ComputeDataAssetOutputHash(UObject* DataAsset)
+{
+	return ComputeDataAssetOutputHashImpl(DataAsset, FCurrentFieldHash());
+}
+
+uint64 FGeneratorBase::ComputeOutputHash(UObject* Asset, int32 HashVersion)
+{
+	UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+	if (HashVersion == GeneratorHash::LegacyVersion)
+	{
+		return Blueprint
+			? ComputeBlueprintOutputHashImpl(Blueprint, FLegacyFieldHash())
+			: ComputeDataAssetOutputHashImpl(Asset, FLegacyFieldHash());
+	}
+	return Blueprint ? ComputeBlueprintOutputHash(Blueprint) : ComputeDataAssetOutputHash(Asset);
+}
+
 void FGeneratorBase::SetDryRunMode(bool bEnabled)
 {
 	bDryRunMode = bEnabled;
@@ -1219,6 +1288,28 @@ const FString& FGeneratorBase::GetManifestPath()
 	return CurrentManifestPath;
 }
 
+void FGeneratorBase::SetPreparedState(TMap<const void*, uint64>&& InputHashes, TMap<FString, FFileStatData>&& PackageStats)
+{
+	PreparedInputHashes = MoveTemp(InputHashes);
+	PreparedPackageStats = MoveTemp(PackageStats);
+}
+
+void FGeneratorBase::ClearPreparedState()
+{
+	PreparedInputHashes.Empty();
+	PreparedPackageStats.Empty();
+}
+
+bool FGeneratorBase::IsUpToDateInRegistry(const FString& PackagePath, uint64 InputHash, const FFileStatData* PreparedStat)
+{
+	if (PackagePath.IsEmpty() || IsForceMode())
+	{
+		return false;
+	}
+	FGeneratorMetadataRecord Record;
+	return GeneratorMetadataHelpers::IsUpToDateInRegistry(PackagePath, InputHash, GENERATOR_VERSION, Record, PreparedStat);
+}
+
 bool FGeneratorBase::CheckExistsWithMetadata(
 	const FString& AssetPath,
 	const FString& AssetName,
@@ -1227,8 +1318,13 @@ bool FGeneratorBase::CheckExistsWithMetadata(
 	FGenerationResult& OutResult,
 	EDryRunStatus* OutDryRunStatus)
 {
+	GASGEN_PROFILE_SCOPE("ExistenceCheck");
+
 	// First check if asset exists at all
-	bool bExistsOnDisk = DoesAssetExistOnDisk(AssetPath);
+	// v7.8.67: The prepare stage may already have stat'd this package file; use it once
+	FFileStatData PreparedStat;
+	const bool bHasPreparedStat = PreparedPackageStats.RemoveAndCopyValue(AssetPath, PreparedStat);
+	bool bExistsOnDisk = bHasPreparedStat ? PreparedStat.bIsValid : DoesAssetExistOnDisk(AssetPath);
 	bool bExistsInMemory = IsAssetInMemory(AssetPath);
 
 	// Asset doesn't exist - will create
@@ -1255,6 +1351,43 @@ bool FGeneratorBase::CheckExistsWithMetadata(
 		return false; // Proceed with generation
 	}
 
+	// v7.8.63: Registry fast path - declare SKIP from the registry record and package file
+	// evidence without loading the package. Inconclusive evidence falls through to the load.
+	if (bExistsOnDisk && !IsForceMode())
+	{
+		FGeneratorMetadataRecord Record;
+		if (GeneratorMetadataHelpers::IsUpToDateInRegistry(AssetPath, InputHash, GENERATOR_VERSION, Record,
+			bHasPreparedStat ? &PreparedStat : nullptr))
+		{
+			const FString Reason = TEXT("No changes (registry record and package file unchanged)");
+			if (OutDryRunStatus)
+			{
+				*OutDryRunStatus = EDryRunStatus::WillSkip;
+			}
+
+			if (IsDryRunMode())
+			{
+				FDryRunResult Result(AssetName, EDryRunStatus::WillSkip, Reason);
+				Result.AssetPath = AssetPath;
+				Result.StoredInputHash = static_cast<uint64>(Record.InputHash);
+				Result.CurrentInputHash = InputHash;
+				Result.StoredOutputHash = static_cast<uint64>(Record.OutputHash);
+				Result.CurrentOutputHash = static_cast<uint64>(Record.OutputHash);
+				AddDryRunResult(Result);
+
+				OutResult = FGenerationResult(AssetName, EGenerationStatus::Skipped,
+					FString::Printf(TEXT("[DRY RUN] %s"), *Reason));
+				OutResult.DetermineCategory();
+				return true;
+			}
+
+			OutResult = FGenerationResult(AssetName, EGenerationStatus::Skipped,
+				FString::Printf(TEXT("[%s] %s - %s"), *AssetType, *AssetName, *Reason));
+			OutResult.DetermineCategory();
+			return true;
+		}
+	}
+
 	// Asset exists - check metadata
 	UObject* ExistingAsset = nullptr;
 
@@ -1322,18 +1455,13 @@ bool FGeneratorBase::CheckExistsWithMetadata(
 	}
 
 	// Has metadata - compare hashes using struct helpers (behavior-identical to UObject version)
-	bool bInputChanged = Metadata.HasInputChanged(InputHash);
+	// v7.8.62: Records written with an older hash algorithm can't be compared on input -
+	// treat input as changed (one-time regeneration) and check output with the record's algorithm
+	const bool bLegacyHash = Metadata.HashVersion != GeneratorHash::Version;
+	bool bInputChanged = bLegacyHash || Metadata.HasInputChanged(InputHash);
 
 	// Compute current output hash for manual edit detection
-	uint64 CurrentOutputHash = 0;
-	if (UBlueprint* Blueprint = Cast<UBlueprint>(ExistingAsset))
-	{
-		CurrentOutputHash = ComputeBlueprintOutputHash(Blueprint);
-	}
-	else
-	{
-		CurrentOutputHash = ComputeDataAssetOutputHash(ExistingAsset);
-	}
+	uint64 CurrentOutputHash = ComputeOutputHash(ExistingAsset, Metadata.HashVersion);
 
 	bool bOutputChanged = Metadata.HasOutputChanged(CurrentOutputHash);
 
@@ -1341,7 +1469,12 @@ bool FGeneratorBase::CheckExistsWithMetadata(
 	EDryRunStatus Status;
 	FString Reason;
 
-	if (!bInputChanged && !bOutputChanged)
+	if (bLegacyHash && !bOutputChanged)
+	{
+		Status = EDryRunStatus::WillModify;
+		Reason = FString::Printf(TEXT("Hash format upgrade (v%d -> v%d), no manual edits"), Metadata.HashVersion, GeneratorHash::Version);
+	}
+	else if (!bInputChanged && !bOutputChanged)
 	{
 		// Nothing changed - skip
 		Status = EDryRunStatus::WillSkip;
@@ -1429,6 +1562,11 @@ bool FGeneratorBase::CheckExistsWithMetadata(
 						if (IFileManager::Get().Delete(*FilePath))
 						{
 							LogGeneration(FString::Printf(TEXT("  Deleted asset file for MODIFY: %s"), *FilePath));
+							// v7.8.84: The replacement is written as soon as it is generated, not at the end-of-run flush
+							if (bSaveBatchActive)
+							{
+								ImmediateSavePackages.Add(PackageName);
+							}
 						}
 						else
 						{
@@ -1738,9 +1876,7 @@ void FGeneratorBase::ConfigureGameplayAbilityTags(
 		// Save package without recompile - tags are set directly on CDO
 		Blueprint->GetPackage()->MarkPackageDirty();
 		FString PackageFileName = FPackageName::LongPackageNameToFilename(Blueprint->GetPackage()->GetName(), FPackageName::GetAssetPackageExtension());
-		FSavePackageArgs SaveArgs;
-		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-		UPackage::SavePackage(Blueprint->GetPackage(), Blueprint, *PackageFileName, SaveArgs);
+			SafeSavePackage(Blueprint->GetPackage(), Blueprint, PackageFileName, Definition.Name);
 
 		LogGeneration(TEXT("  Tags saved (no recompile)"));
 	}
@@ -2289,9 +2425,7 @@ void FGeneratorBase::ConfigureGameplayAbilityPolicies(
 		Blueprint->MarkPackageDirty();
 		Blueprint->GetPackage()->MarkPackageDirty();
 		FString PackageFileName = FPackageName::LongPackageNameToFilename(Blueprint->GetPackage()->GetName(), FPackageName::GetAssetPackageExtension());
-		FSavePackageArgs SaveArgs;
-		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-		UPackage::SavePackage(Blueprint->GetPackage(), Blueprint, *PackageFileName, SaveArgs);
+			SafeSavePackage(Blueprint->GetPackage(), Blueprint, PackageFileName, Definition.Name);
 
 		LogGeneration(TEXT("  Policies saved (no recompile)"));
 	}
@@ -2304,21 +2438,13 @@ FString FGeneratorBase::GetContentPath()
 
 UClass* FGeneratorBase::FindParentClass(const FString& ClassName)
 {
+	GASGEN_PROFILE_SCOPE("FindParentClass");
+
 	// v2.4.1: Enhanced class finding with Blueprint support
 	// v2.6.11: Force scan Narrative Pro plugin content for commandlet mode
 
-	// Static flag to ensure we only scan once per session
-	static bool bNarrativeProScanned = false;
-	if (!bNarrativeProScanned)
-	{
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-		// v6.8: Scan NarrativePro22B57 plugin content paths to ensure Blueprint parent classes are discoverable
-		TArray<FString> NarrativeProPaths;
-		NarrativeProPaths.Add(TEXT("/NarrativePro/"));
-		AssetRegistryModule.Get().ScanPathsSynchronous(NarrativeProPaths, true);
-		bNarrativeProScanned = true;
-		UE_LOG(LogTemp, Display, TEXT("[GasAbilityGenerator] Scanned NarrativePro22B57 content paths for parent class resolution"));
-	}
+	// v7.8.64: NarrativePro scan + Blueprint name index are built once per session by FGeneratorAssetIndex
+	FGeneratorAssetIndex::EnsureBuilt();
 
 	// v7.8.36: Check session cache FIRST for Blueprints created in this generation session
 	// This allows DynamicCast/CallFunction to find Goal_FormationFollow etc. generated earlier
@@ -2327,6 +2453,12 @@ UClass* FGeneratorBase::FindParentClass(const FString& ClassName)
 		return *CachedClass;
 	}
 
+	// v7.8.64: Names that already failed the full cascade this session (cleared on asset add)
+	if (FGeneratorAssetIndex::IsKnownMissing(TEXT("ParentClass"), ClassName))
+	{
+		return nullptr;
+	}
+
 	// First check if it's a Blueprint class name (starts with BP_, WBP_, etc.)
 	// v6.6: Added Goal_ prefix for Narrative Pro goal classes (e.g., Goal_Attack)
 	// v7.8.36: Added BPA_, BTS_, GoalGenerator_ for activity/service/goal generator Blueprints
@@ -2339,16 +2471,13 @@ UClass* FGeneratorBase::FindParentClass(const FString& ClassName)
 	                         ClassName.StartsWith(TEXT("Goal_")) ||
 	                         ClassName.StartsWith(TEXT("GoalGenerator_"));
 
-	// For Blueprint classes, search using Asset Registry
-	if (bIsBlueprintClass)
+	// v7.8.64: Blueprint lookups go through the session name index (was GetAssetsByClass + linear scan per call)
+	auto FindIndexedBlueprintClass = [&ClassName]() -> UClass*
 	{
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-		TArray<FAssetData> AssetDataList;
-		AssetRegistryModule.Get().GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList);
-
-		for (const FAssetData& AssetData : AssetDataList)
+		TArray<FAssetData> Matches;
+		if (FGeneratorAssetIndex::FindBlueprints(FName(*ClassName), Matches))
 		{
-			if (AssetData.AssetName.ToString() == ClassName)
+			for (const FAssetData& AssetData : Matches)
 			{
 				UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
 				if (Blueprint && Blueprint->GeneratedClass)
@@ -2357,6 +2486,16 @@ UClass* FGeneratorBase::FindParentClass(const FString& ClassName)
 				}
 			}
 		}
+		return nullptr;
+	};
+
+	// For Blueprint classes, search using Asset Registry
+	if (bIsBlueprintClass)
+	{
+		if (UClass* IndexedClass = FindIndexedBlueprintClass())
+		{
+			return IndexedClass;
+		}
 
 		// Also try common Blueprint paths - load Blueprint asset and get GeneratedClass
 		TArray<FString> BlueprintSearchPaths;
@@ -2443,23 +2582,13 @@ UClass* FGeneratorBase::FindParentClass(const FString& ClassName)
 	// Final fallback: Search asset registry for any matching Blueprint
 	if (!bIsBlueprintClass)
 	{
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-		TArray<FAssetData> AssetDataList;
-		AssetRegistryModule.Get().GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList);
-
-		for (const FAssetData& AssetData : AssetDataList)
+		if (UClass* IndexedClass = FindIndexedBlueprintClass())
 		{
-			if (AssetData.AssetName.ToString() == ClassName)
-			{
-				UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
-				if (Blueprint && Blueprint->GeneratedClass)
-				{
-					return Blueprint->GeneratedClass;
-				}
-			}
+			return IndexedClass;
 		}
 	}
 
+	FGeneratorAssetIndex::MarkMissing(TEXT("ParentClass"), ClassName);
 	return nullptr;
 }
 
@@ -2554,6 +2683,12 @@ UEnum* FGeneratorBase::FindUserDefinedEnum(const FString& EnumName, const FStrin
 	
 	// v2.5.0: Use GetProjectRoot() for auto-detection if ProjectRoot not provided
 	FString Root = ProjectRoot.IsEmpty() ? GetProjectRoot() : ProjectRoot;
+
+	// v7.8.64: Skip the path probes for names that already failed this session
+	if (FGeneratorAssetIndex::IsKnownMissing(TEXT("Enum"), Root + TEXT("|") + EnumName))
+	{
+		return nullptr;
+	}
 	
 	// Common enum locations
 	SearchPaths.Add(FString::Printf(TEXT("%s/Enums/%s.%s"), *Root, *EnumName, *EnumName));
@@ -2573,23 +2708,21 @@ UEnum* FGeneratorBase::FindUserDefinedEnum(const FString& EnumName, const FStrin
 	}
 	
 	// Try asset registry search
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	// v7.8.64: Via the session name index (was GetAssetsByClass + linear scan per call)
 	TArray<FAssetData> AssetDataList;
-	AssetRegistryModule.Get().GetAssetsByClass(UUserDefinedEnum::StaticClass()->GetClassPathName(), AssetDataList);
+	FGeneratorAssetIndex::FindUserDefinedEnums(FName(*EnumName), AssetDataList);
 	
 	for (const FAssetData& AssetData : AssetDataList)
 	{
-		if (AssetData.AssetName.ToString() == EnumName)
+		UUserDefinedEnum* UserEnum = Cast<UUserDefinedEnum>(AssetData.GetAsset());
+		if (UserEnum)
 		{
-			UUserDefinedEnum* UserEnum = Cast<UUserDefinedEnum>(AssetData.GetAsset());
-			if (UserEnum)
-			{
-				LogGeneration(FString::Printf(TEXT("Found user-defined enum via registry: %s"), *EnumName));
-				return UserEnum;
-			}
+			LogGeneration(FString::Printf(TEXT("Found user-defined enum via registry: %s"), *EnumName));
+			return UserEnum;
 		}
 	}
 	
+	FGeneratorAssetIndex::MarkMissing(TEXT("Enum"), Root + TEXT("|") + EnumName);
 	return nullptr;
 }
 
@@ -2607,6 +2740,8 @@ void FGeneratorBase::LogGeneration(const FString& Message)
 // v4.40: Safe package save with return value check
 // Note: In UE 5.7, SavePackage returns bool (not ESavePackageResult)
 // v4.40.2: Added asset registry notification for immediate visibility
+// v7.8.68: Queued while a save batch is open - failures are then reported by FlushSaveBatch
+// v7.8.84: Except packages the MODIFY path emptied on disk - those are saved here and now
 bool FGeneratorBase::SafeSavePackage(UPackage* Package, UObject* Asset, const FString& PackageFileName, const FString& AssetName)
 {
 	if (!Package || !Asset)
@@ -2615,6 +2750,36 @@ bool FGeneratorBase::SafeSavePackage(UPackage* Package, UObject* Asset, const FS
 		return false;
 	}
 
+	if (bSaveBatchActive && !ImmediateSavePackages.Contains(Package->GetName()))
+	{
+		// One save per package: a later save of the same package (requeued job) replaces the earlier entry
+		FQueuedPackageSave Queued;
+		Queued.Package.Reset(Package);
+		Queued.Asset.Reset(Asset);
+		Queued.PackageFileName = PackageFileName;
+		Queued.AssetName = AssetName;
+		if (const int32* Existing = QueuedSaveIndexByPackage.Find(Package->GetName()))
+		{
+			// v7.8.83: The replaced asset (already marked garbage by the MODIFY path) must not be announced at flush
+			UObject* ReplacedAsset = QueuedSaves[*Existing].Asset.Get();
+			FQueuedAssetCreation Replaced;
+			if (ReplacedAsset && ReplacedAsset != Asset && QueuedAssetCreations.RemoveAndCopyValue(ReplacedAsset, Replaced))
+			{
+				FGeneratorAssetIndex::RemovePendingAsset(Replaced.AssetData);
+			}
+			QueuedSaves[*Existing] = MoveTemp(Queued);
+		}
+		else
+		{
+			QueuedSaveIndexByPackage.Add(Package->GetName(), QueuedSaves.Add(MoveTemp(Queued)));
+		}
+		NotifyAssetCreated(Asset);
+		return true;
+	}
+
+	GASGEN_PROFILE_SCOPE("Save");
+	FGeneratorProfiler::Increment(EGeneratorCounter::Save);
+
 	FSavePackageArgs SaveArgs;
 	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
 
@@ -2633,6 +2798,182 @@ bool FGeneratorBase::SafeSavePackage(UPackage* Package, UObject* Asset, const FS
 	return true;
 }
 
+void FGeneratorBase::NotifyAssetCreated(UObject* Asset)
+{
+	if (!Asset)
+	{
+		return;
+	}
+
+	if (!bSaveBatchActive)
+	{
+		FAssetRegistryModule::AssetCreated(Asset);
+		return;
+	}
+
+	// Registry update waits for the flush; the name index must see the asset now
+	if (!QueuedAssetCreations.Contains(Asset))
+	{
+		FQueuedAssetCreation& Creation = QueuedAssetCreations.Add(Asset);
+		Creation.Asset.Reset(Asset);
+		Creation.AssetData = FAssetData(Asset);
+		FGeneratorAssetIndex::AddPendingAsset(Creation.AssetData);
+	}
+}
+
+void FGeneratorBase::BeginSaveBatch()
+{
+	QueuedSaves.Reset();
+	QueuedSaveIndexByPackage.Reset();
+	QueuedAssetCreations.Reset();
+	ImmediateSavePackages.Reset();
+	bSaveBatchActive = true;
+}
+
+FSaveBatchResult FGeneratorBase::FlushSaveBatch()
+{
+	FSaveBatchResult BatchResult;
+	const double StartTime = FPlatformTime::Seconds();
+	bSaveBatchActive = false;
+
+	// Serialization stays on the game thread (Blueprint/material PreSave is not thread-safe);
+	// SAVE_Async hands each file write to the async writer so disk I/O overlaps the next package
+	TArray<const FQueuedPackageSave*> Written;
+	TSet<UObject*> UnsavedAssets;
+	UGeneratorMetadataRegistry* Registry = UGeneratorMetadataRegistry::GetRegistry();
+	auto MarkFailed = [&](const FQueuedPackageSave& Queued)
+	{
+		BatchResult.FailedAssets.Add(Queued.AssetName);
+		UnsavedAssets.Add(Queued.Asset.Get());
+		// The generator already recorded metadata for this package - drop it so the next run regenerates
+		if (Registry && Queued.Package.IsValid())
+		{
+			Registry->RemoveRecord(Queued.Package->GetName());
+		}
+	};
+	for (FQueuedPackageSave& Queued : QueuedSaves)
+	{
+		UPackage* Package = Queued.Package.Get();
+		UObject* Asset = Queued.Asset.Get();
+		Queued.PreSaveStat = IFileManager::Get().GetStatData(*Queued.PackageFileName);
+
+		// v7.8.70: Serialization time is attributed back to the asset that queued the save
+		FGeneratorAssetProfileScope AssetScope(Queued.AssetName, FString());
+		GASGEN_PROFILE_SCOPE("Save");
+		FGeneratorProfiler::Increment(EGeneratorCounter::Save);
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_Async;
+
+		if (!Package || !Asset || !UPackage::SavePackage(Package, Asset, *Queued.PackageFileName, SaveArgs))
+		{
+			UE_LOG(LogGasAbilityGenerator, Error, TEXT("[E_SAVE_FAILED] %s | SavePackage returned false"), *Queued.AssetName);
+			LogGeneration(FString::Printf(TEXT("[E_SAVE_FAILED] %s | SavePackage failed - asset may not persist"), *Queued.AssetName));
+			MarkFailed(Queued);
+			continue;
+		}
+		Written.Add(&Queued);
+	}
+
+	UPackage::WaitForAsyncFileWrites();
+
+	// Disk truth: an async write that didn't land is a failed save
+	// v7.8.83: Overwrites included - the file must exist and differ in size or timestamp from before the save
+	TArray<FString> SavedFiles;
+	for (const FQueuedPackageSave* Queued : Written)
+	{
+		const FFileStatData Stat = IFileManager::Get().GetStatData(*Queued->PackageFileName);
+		const bool bUnchanged = Stat.bIsValid && Queued->PreSaveStat.bIsValid
+			&& Stat.FileSize == Queued->PreSaveStat.FileSize
+			&& Stat.ModificationTime == Queued->PreSaveStat.ModificationTime;
+		if (!Stat.bIsValid || bUnchanged)
+		{
+			LogGeneration(FString::Printf(TEXT("[E_SAVE_FAILED] %s | Package file not written: %s"), *Queued->AssetName, *Queued->PackageFileName));
+			MarkFailed(*Queued);
+			continue;
+		}
+		SavedFiles.Add(Queued->PackageFileName);
+		QueuedAssetCreations.Remove(Queued->Asset.Get());
+	}
+	BatchResult.SavedCount = SavedFiles.Num();
+
+	// Single registry update for everything that reached disk
+	if (SavedFiles.Num() > 0)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.ScanFilesSynchronous(SavedFiles, true);
+		FGeneratorProfiler::Increment(EGeneratorCounter::RegistryQuery);
+	}
+
+	// Assets announced without a save of their own in the batch still get the in-memory notification
+	for (const auto& Pair : QueuedAssetCreations)
+	{
+		if (Pair.Value.Asset.IsValid() && !UnsavedAssets.Contains(Pair.Key))
+		{
+			FAssetRegistryModule::AssetCreated(Pair.Value.Asset.Get());
+		}
+	}
+
+	QueuedSaves.Reset();
+	QueuedSaveIndexByPackage.Reset();
+	QueuedAssetCreations.Reset();
+	ImmediateSavePackages.Reset();
+
+	BatchResult.Seconds = FPlatformTime::Seconds() - StartTime;
+	return BatchResult;
+}
+
+void FGeneratorBase::CompileBlueprint(UBlueprint* Blueprint, FCompilerResultsLog* Results, bool bSkipGarbageCollection)
+{
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	GASGEN_PROFILE_SCOPE("Compile");
+	FGeneratorProfiler::Increment(EGeneratorCounter::Compile);
+
+	if (!bCompileBatchActive)
+	{
+		FKismetEditorUtilities::CompileBlueprint(Blueprint,
+			bSkipGarbageCollection ? EBlueprintCompileOptions::SkipGarbageCollection : EBlueprintCompileOptions::None, Results);
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection, Results);
+	CompileBatchStats.CompileSeconds += FPlatformTime::Seconds() - StartTime;
+	CompileBatchStats.CompileCount++;
+
+	// Same collection point an unbatched compile would use, just not every time
+	if (!bSkipGarbageCollection && ++CompilesSinceGC >= CompileGCInterval)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		CompileBatchStats.GarbageCollections++;
+		CompilesSinceGC = 0;
+	}
+}
+
+void FGeneratorBase::BeginCompileBatch()
+{
+	CompileBatchStats = FCompileBatchResult();
+	CompilesSinceGC = 0;
+	bCompileBatchActive = true;
+}
+
+FCompileBatchResult FGeneratorBase::FlushCompileBatch()
+{
+	bCompileBatchActive = false;
+	if (CompilesSinceGC > 0)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		CompileBatchStats.GarbageCollections++;
+		CompilesSinceGC = 0;
+	}
+	return CompileBatchStats;
+}
+
 // ============================================================================
 // v2.1.8: Helper function to convert type string to FEdGraphPinType
 // Updated to use FindUserDefinedEnum for enum types
@@ -2823,7 +3164,7 @@ FGenerationResult FEnumerationGenerator::Generate(const FManifestEnumerationDefi
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Enumeration"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Enumeration"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -2874,18 +3215,16 @@ FGenerationResult FEnumerationGenerator::Generate(const FManifestEnumerationDefi
 	
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(NewEnum);
+	NotifyAssetCreated(NewEnum);
 	
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, NewEnum, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, NewEnum, PackageFileName, Definition.Name);
 	
 	LogGeneration(FString::Printf(TEXT("Created Enumeration: %s (with %d values)"), *Definition.Name, Definition.Values.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreDataAssetMetadata(NewEnum, TEXT("E"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(NewEnum, TEXT("E"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -2910,7 +3249,7 @@ FGenerationResult FInputActionGenerator::Generate(const FManifestInputActionDefi
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Input Action"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Input Action"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -2950,18 +3289,16 @@ FGenerationResult FInputActionGenerator::Generate(const FManifestInputActionDefi
 	
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(InputAction);
+	NotifyAssetCreated(InputAction);
 	
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, InputAction, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, InputAction, PackageFileName, Definition.Name);
 	
 	LogGeneration(FString::Printf(TEXT("Created Input Action: %s"), *Definition.Name));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreDataAssetMetadata(InputAction, TEXT("IA"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(InputAction, TEXT("IA"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -2986,7 +3323,7 @@ FGenerationResult FInputMappingContextGenerator::Generate(const FManifestInputMa
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Input Mapping Context"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Input Mapping Context"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -3011,18 +3348,16 @@ FGenerationResult FInputMappingContextGenerator::Generate(const FManifestInputMa
 	
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(IMC);
+	NotifyAssetCreated(IMC);
 	
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, IMC, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, IMC, PackageFileName, Definition.Name);
 	
 	LogGeneration(FString::Printf(TEXT("Created Input Mapping Context: %s"), *Definition.Name));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreDataAssetMetadata(IMC, TEXT("IMC"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(IMC, TEXT("IMC"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -3050,7 +3385,7 @@ FGenerationResult FGameplayEffectGenerator::Generate(const FManifestGameplayEffe
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Gameplay Effect"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Gameplay Effect"), GetInputHash(Definition), Result))
 	{
 		// v7.8.33: Even when skipped, register existing GE Blueprint class in session cache
 		// GA generator uses session cache for CooldownGameplayEffectClass lookup
@@ -3095,7 +3430,7 @@ FGenerationResult FGameplayEffectGenerator::Generate(const FManifestGameplayEffe
 	// Compile FIRST to ensure GeneratedClass and CDO exist before setting properties
 	// CDO properties set before compile will be lost when compile recreates the class
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -3651,19 +3986,17 @@ FGenerationResult FGameplayEffectGenerator::Generate(const FManifestGameplayEffe
 
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Gameplay Effect Blueprint: %s (Duration: %s, Modifiers: %d, Tags: %d)"),
 		*Definition.Name, *Definition.DurationPolicy, Definition.Modifiers.Num(), Definition.GrantedTags.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("GameplayEffect"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("GameplayEffect"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -3736,7 +4069,7 @@ FGenerationResult FGameplayAbilityGenerator::Generate(
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Gameplay Ability"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Gameplay Ability"), GetInputHash(Definition), Result))
 	{
 		// v2.6.2: Even when skipping, update tags on existing GA blueprints
 		UBlueprint* ExistingBlueprint = LoadObject<UBlueprint>(nullptr, *AssetPath);
@@ -3899,7 +4232,7 @@ FGenerationResult FGameplayAbilityGenerator::Generate(
 	}
 
 	// Compile blueprint first (after variables are added)
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	CompileBlueprint(Blueprint);
 
 	// v4.31: Generate custom functions BEFORE event graph
 	// This allows event graph nodes to call functions defined in custom_functions
@@ -4082,7 +4415,7 @@ FGenerationResult FGameplayAbilityGenerator::Generate(
 	// See: ClaudeContext/Handoffs/Track_E_Removal_Audit_v7_7.md
 	FCompilerResultsLog CompileLog;
 	LogGeneration(TEXT("  [COMPILE] Final compile..."));
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	// v4.22: AUDIT LOGGING POINT 3 - After CompileBlueprint, before ReapplyNodePositions
 	FEventGraphGenerator::LogNodePositionsDiagnostic(Blueprint, TEXT("POINT_3_AfterCompileBlueprint"));
@@ -4145,7 +4478,7 @@ FGenerationResult FGameplayAbilityGenerator::Generate(
 
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	// v4.22: AUDIT LOGGING POINT 5 - Before SavePackage
 	FEventGraphGenerator::LogNodePositionsDiagnostic(Blueprint, TEXT("POINT_5_BeforeSavePackage"));
@@ -4185,7 +4518,7 @@ FGenerationResult FGameplayAbilityGenerator::Generate(
 	LogGeneration(FString::Printf(TEXT("Created Gameplay Ability: %s (with %d variables)"), *Definition.Name, Definition.Variables.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("GameplayAbility"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("GameplayAbility"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -4292,7 +4625,7 @@ FGenerationResult FActorBlueprintGenerator::Generate(
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Actor Blueprint"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Actor Blueprint"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -4558,7 +4891,7 @@ FGenerationResult FActorBlueprintGenerator::Generate(
 		LogGeneration(FString::Printf(TEXT("  Generated %d/%d custom functions"), FunctionsGenerated, Definition.CustomFunctions.Num()));
 
 		// Recompile blueprint after adding custom functions so they're available to event graph
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		CompileBlueprint(Blueprint);
 	}
 
 	// v2.7.6: Generate inline event graph if defined (takes priority over referenced)
@@ -4683,7 +5016,7 @@ FGenerationResult FActorBlueprintGenerator::Generate(
 		// This prevents connections from being lost during node reconstruction
 		FCompilerResultsLog FuncOverrideCompileLog;
 		LogGeneration(TEXT("  [COMPILE] Post-function-override compile to stabilize nodes..."));
-		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &FuncOverrideCompileLog);
+		CompileBlueprint(Blueprint, &FuncOverrideCompileLog);
 
 		if (FuncOverrideCompileLog.NumErrors > 0)
 		{
@@ -5045,7 +5378,7 @@ FGenerationResult FActorBlueprintGenerator::Generate(
 
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	// v4.20.11: Re-apply node positions after compilation (compilation may reset positions)
 	FEventGraphGenerator::ReapplyNodePositions(Blueprint);
@@ -5182,7 +5515,7 @@ FGenerationResult FActorBlueprintGenerator::Generate(
 					// Recompile to incorporate the perception changes
 					if (SensesConfigured > 0)
 					{
-						FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, nullptr);
+						CompileBlueprint(Blueprint);
 					}
 				}
 				else
@@ -5203,7 +5536,7 @@ FGenerationResult FActorBlueprintGenerator::Generate(
 
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	// Save package (only reached if compile succeeded)
 	// v4.40: Use SafeSavePackage for return value check
@@ -5216,7 +5549,7 @@ FGenerationResult FActorBlueprintGenerator::Generate(
 	LogGeneration(FString::Printf(TEXT("Created Actor Blueprint: %s (with %d variables)"), *Definition.Name, Definition.Variables.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("ActorBlueprint"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("ActorBlueprint"), Definition.Name, GetInputHash(Definition));
 
 	// v4.31: Cache the Blueprint class for same-session TSubclassOf resolution
 	// This enables ActivityConfigurations to resolve GoalGenerators created in the same session
@@ -5254,7 +5587,7 @@ FGenerationResult FWidgetBlueprintGenerator::Generate(
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Widget Blueprint"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Widget Blueprint"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -6180,7 +6513,7 @@ FGenerationResult FWidgetBlueprintGenerator::Generate(
 
 	// v4.16: Compile blueprint with validation (D-006, Contract 10)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(WidgetBP, &CompileLog);
 
 	// v4.20.11: Re-apply node positions after compilation (compilation may reset positions)
 	FEventGraphGenerator::ReapplyNodePositions(WidgetBP);
@@ -6216,7 +6549,7 @@ FGenerationResult FWidgetBlueprintGenerator::Generate(
 
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(WidgetBP);
+	NotifyAssetCreated(WidgetBP);
 
 	// Save package (only reached if compile succeeded)
 	// v4.40: Use SafeSavePackage for return value check
@@ -6229,7 +6562,7 @@ FGenerationResult FWidgetBlueprintGenerator::Generate(
 	LogGeneration(FString::Printf(TEXT("Created Widget Blueprint: %s (with %d variables)"), *Definition.Name, Definition.Variables.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(WidgetBP, TEXT("WidgetBlueprint"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(WidgetBP, TEXT("WidgetBlueprint"), Definition.Name, GetInputHash(Definition));
 
 	// v4.31: Cache the Blueprint class for same-session TSubclassOf resolution
 	if (WidgetBP->GeneratedClass)
@@ -6268,7 +6601,7 @@ FGenerationResult FComponentBlueprintGenerator::Generate(
 	}
 
 	// Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Component Blueprint"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Component Blueprint"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -6556,7 +6889,7 @@ FGenerationResult FComponentBlueprintGenerator::Generate(
 
 	// ========== PHASE 5: Compile (MUST happen before CDO access) ==========
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -6637,19 +6970,17 @@ FGenerationResult FComponentBlueprintGenerator::Generate(
 
 	// ========== PHASE 7: Save Asset ==========
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	UE_LOG(LogTemp, Log, TEXT("COMP_BP[%s] PH7 Save OK"), *Definition.Name);
 	LogGeneration(FString::Printf(TEXT("Created Component Blueprint: %s (vars=%d, dispatchers=%d, funcs=%d)"),
 		*Definition.Name, Definition.Variables.Num(), Definition.EventDispatchers.Num(), Definition.Functions.Num()));
 
 	// Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("ComponentBlueprint"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("ComponentBlueprint"), Definition.Name, GetInputHash(Definition));
 
 	// v4.31: Cache the Blueprint class for same-session TSubclassOf resolution
 	if (Blueprint->GeneratedClass)
@@ -6692,7 +7023,7 @@ FGenerationResult FBlueprintConditionGenerator::Generate(
 	}
 
 	// Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Blueprint Condition"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Blueprint Condition"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -6782,7 +7113,7 @@ FGenerationResult FBlueprintConditionGenerator::Generate(
 
 	// ========== PHASE 4: Compile (MUST happen before CDO access) ==========
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -6923,18 +7254,16 @@ FGenerationResult FBlueprintConditionGenerator::Generate(
 
 	// ========== PHASE 6: Save Asset ==========
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	UE_LOG(LogTemp, Log, TEXT("BPC[%s] PH6 Save OK"), *Definition.Name);
 	LogGeneration(FString::Printf(TEXT("Created Blueprint Condition: %s"), *Definition.Name));
 
 	// Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("BlueprintCondition"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("BlueprintCondition"), Definition.Name, GetInputHash(Definition));
 
 	// Cache the Blueprint class for same-session resolution
 	if (Blueprint->GeneratedClass)
@@ -6966,7 +7295,7 @@ FGenerationResult FBlackboardGenerator::Generate(const FManifestBlackboardDefini
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Blackboard"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Blackboard"), GetInputHash(Definition), Result))
 	{
 		// v7.8.33: Even when skipped, register existing blackboard in session cache for BT lookup
 		// BT generator uses session cache first, so we need to populate it with existing BBs
@@ -7141,20 +7470,18 @@ FGenerationResult FBlackboardGenerator::Generate(const FManifestBlackboardDefini
 
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blackboard);
+	NotifyAssetCreated(Blackboard);
 
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blackboard, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blackboard, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Blackboard: %s with %d keys%s"),
 		*Definition.Name, KeysCreated,
 		Definition.Parent.IsEmpty() ? TEXT("") : *FString::Printf(TEXT(" (Parent: %s)"), *Definition.Parent)));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreDataAssetMetadata(Blackboard, TEXT("BB"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(Blackboard, TEXT("BB"), Definition.Name, GetInputHash(Definition));
 
 	// v4.14: Register in session cache for BT generator lookup
 	RegisterGeneratedBlackboard(Definition.Name, Blackboard);
@@ -7215,7 +7542,7 @@ FGenerationResult FBehaviorTreeGenerator::Generate(const FManifestBehaviorTreeDe
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Behavior Tree"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Behavior Tree"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -8028,7 +8355,7 @@ FGenerationResult FBehaviorTreeGenerator::Generate(const FManifestBehaviorTreeDe
 
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(BT);
+	NotifyAssetCreated(BT);
 
 	// v4.15: Log blackboard state before save
 	if (BT->BlackboardAsset)
@@ -8042,9 +8369,7 @@ FGenerationResult FBehaviorTreeGenerator::Generate(const FManifestBehaviorTreeDe
 
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, BT, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, BT, PackageFileName, Definition.Name);
 
 	// v4.15: Log blackboard state after save
 	if (BT->BlackboardAsset)
@@ -8059,7 +8384,7 @@ FGenerationResult FBehaviorTreeGenerator::Generate(const FManifestBehaviorTreeDe
 	LogGeneration(FString::Printf(TEXT("Created Behavior Tree: %s"), *Definition.Name));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreDataAssetMetadata(BT, TEXT("BT"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(BT, TEXT("BT"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -9794,7 +10119,7 @@ FGenerationResult FMaterialGenerator::Generate(const FManifestMaterialDefinition
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Material"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Material"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -10028,19 +10353,17 @@ FGenerationResult FMaterialGenerator::Generate(const FManifestMaterialDefinition
 	Material->PreEditChange(nullptr);
 	Material->PostEditChange();
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Material);
+	NotifyAssetCreated(Material);
 
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Material, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Material, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Material: %s (%d expressions, %d connections)"),
 		*Definition.Name, Definition.Expressions.Num(), Definition.Connections.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreDataAssetMetadata(Material, TEXT("M"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(Material, TEXT("M"), Definition.Name, GetInputHash(Definition));
 
 	// v4.9.1: Register in session cache for MIC parent lookup
 	RegisterGeneratedMaterial(Definition.Name, Material);
@@ -10462,7 +10785,7 @@ FGenerationResult FMaterialFunctionGenerator::Generate(const FManifestMaterialFu
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Material Function"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Material Function"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -10789,19 +11112,17 @@ FGenerationResult FMaterialFunctionGenerator::Generate(const FManifestMaterialFu
 	MaterialFunction->PreEditChange(nullptr);
 	MaterialFunction->PostEditChange();
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(MaterialFunction);
+	NotifyAssetCreated(MaterialFunction);
 
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, MaterialFunction, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, MaterialFunction, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Material Function: %s (%d inputs, %d outputs)"),
 		*Definition.Name, Definition.Inputs.Num(), Definition.Outputs.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreDataAssetMetadata(MaterialFunction, TEXT("MF"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(MaterialFunction, TEXT("MF"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -10828,7 +11149,7 @@ FGenerationResult FMaterialInstanceGenerator::Generate(const FManifestMaterialIn
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Material Instance"), InputHash, Result))
 	{
 		return Result;
@@ -10960,20 +11281,18 @@ FGenerationResult FMaterialInstanceGenerator::Generate(const FManifestMaterialIn
 	MIC->PreEditChange(nullptr);
 	MIC->PostEditChange();
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(MIC);
+	NotifyAssetCreated(MIC);
 
 	// Save package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, MIC, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, MIC, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Material Instance: %s (parent: %s, %d scalar, %d vector, %d texture params)"),
 		*Definition.Name, *Definition.ParentMaterial,
 		Definition.ScalarParams.Num(), Definition.VectorParams.Num(), Definition.TextureParams.Num()));
 
 	// Store metadata for regeneration tracking
-	StoreDataAssetMetadata(MIC, TEXT("MIC"), Definition.Name, Definition.ComputeHash());
+	StoreDataAssetMetadata(MIC, TEXT("MIC"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New, TEXT("Created successfully"));
 	Result.AssetPath = AssetPath;
@@ -11512,6 +11831,8 @@ bool FEventGraphGenerator::GenerateEventGraph(
 	const FManifestEventGraphDefinition& GraphDefinition,
 	const FString& ProjectRoot)
 {
+	GASGEN_PROFILE_SCOPE("EventGraph");
+
 	// v2.6.7: Clear missing dependencies at start of each generation
 	ClearMissingDependencies();
 
@@ -19657,7 +19978,7 @@ int32 FEventGraphGenerator::GenerateDelegateBindingNodes(
 	// ============================================================================
 	LogGeneration(FString::Printf(TEXT("  [DELEGATE-COMPILE] Skeleton sync for %d handlers (single compile)..."),
 		ValidatedBindings.Num()));
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+	CompileBlueprint(Blueprint, nullptr, true);
 	LogGeneration(TEXT("  [DELEGATE-COMPILE] Skeleton sync complete - all handlers registered"));
 
 	// Reset position for Pass 2
@@ -20620,7 +20941,7 @@ int32 FEventGraphGenerator::GenerateActorDelegateBindingNodes(
 			// CustomEvent handler must exist in Skeleton Generated Class before CreateDelegate
 			// can resolve the handler function name. Audit: Claude-GPT dual audit 2026-01-27
 			// v7.5.4: MarkBlueprintAsStructurallyModified doesn't compile in headless mode.
-			FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+			CompileBlueprint(Blueprint, nullptr, true);
 			LogGeneration(TEXT("    Skeleton sync performed (C2: forced compile for handler registration)"));
 
 			LogGeneration(FString::Printf(TEXT("    Created handler event: %s with signature from %s"),
@@ -21315,7 +21636,7 @@ FGenerationResult FFloatCurveGenerator::Generate(const FManifestFloatCurveDefini
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Float Curve"), InputHash, Result))
 	{
 		return Result;
@@ -21399,12 +21720,10 @@ FGenerationResult FFloatCurveGenerator::Generate(const FManifestFloatCurveDefini
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Curve);
+	NotifyAssetCreated(Curve);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Curve, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Curve, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(Curve, TEXT("FC"), Definition.Name, InputHash);
@@ -21432,7 +21751,7 @@ FGenerationResult FAnimationMontageGenerator::Generate(const FManifestAnimationM
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Animation Montage"), InputHash, Result))
 	{
 		return Result;
@@ -21539,12 +21858,10 @@ FGenerationResult FAnimationMontageGenerator::Generate(const FManifestAnimationM
 	Montage->BlendOut.SetBlendTime(0.25f);
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Montage);
+	NotifyAssetCreated(Montage);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Montage, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Montage, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(Montage, TEXT("AM"), Definition.Name, InputHash);
@@ -21572,7 +21889,7 @@ FGenerationResult FAnimationNotifyGenerator::Generate(const FManifestAnimationNo
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Animation Notify"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Animation Notify"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -21639,7 +21956,7 @@ FGenerationResult FAnimationNotifyGenerator::Generate(const FManifestAnimationNo
 	}
 
 	// Compile after adding variables
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	CompileBlueprint(Blueprint);
 
 	// v4.0: Determine if we have an event graph to generate
 	FManifestEventGraphDefinition EventGraphDef;
@@ -21728,7 +22045,7 @@ FGenerationResult FAnimationNotifyGenerator::Generate(const FManifestAnimationNo
 
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	// v4.20.11: Re-apply node positions after compilation (compilation may reset positions)
 	FEventGraphGenerator::ReapplyNodePositions(Blueprint);
@@ -21762,18 +22079,16 @@ FGenerationResult FAnimationNotifyGenerator::Generate(const FManifestAnimationNo
 		return Result;
 	}
 
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 	Package->MarkPackageDirty();
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Animation Notify: %s (Parent: %s, Variables: %d)"),
 		*Definition.Name, *ParentClass->GetName(), Definition.Variables.Num()));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("AnimationNotify"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("AnimationNotify"), Definition.Name, GetInputHash(Definition));
 
 	// v4.31: Cache the Blueprint class for same-session TSubclassOf resolution
 	if (Blueprint->GeneratedClass)
@@ -22246,7 +22561,7 @@ FGenerationResult FDialogueBlueprintGenerator::Generate(
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Dialogue Blueprint"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Dialogue Blueprint"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -22281,7 +22596,7 @@ FGenerationResult FDialogueBlueprintGenerator::Generate(
 	DialogueBP->bIsNewlyCreated = true;
 
 	// Create the skeleton generated class
-	FKismetEditorUtilities::CompileBlueprint(DialogueBP);
+	CompileBlueprint(DialogueBP);
 
 	// Use DialogueBP as the Blueprint pointer for the rest of the function
 	UBlueprint* Blueprint = DialogueBP;
@@ -22314,7 +22629,7 @@ FGenerationResult FDialogueBlueprintGenerator::Generate(
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	CompileBlueprint(Blueprint);
 
 	// v3.2: Set dialogue configuration properties on CDO
 	UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
@@ -22911,7 +23226,7 @@ FGenerationResult FDialogueBlueprintGenerator::Generate(
 
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	// v4.20.11: Re-apply node positions after compilation (compilation may reset positions)
 	FEventGraphGenerator::ReapplyNodePositions(Blueprint);
@@ -22946,17 +23261,15 @@ FGenerationResult FDialogueBlueprintGenerator::Generate(
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Dialogue Blueprint: %s"), *Definition.Name));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("DialogueBlueprint"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("DialogueBlueprint"), Definition.Name, GetInputHash(Definition));
 
 	// v4.31: Cache the Blueprint class for same-session TSubclassOf resolution
 	if (Blueprint->GeneratedClass)
@@ -22986,7 +23299,7 @@ FGenerationResult FEquippableItemGenerator::Generate(const FManifestEquippableIt
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Equippable Item"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Equippable Item"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -23129,7 +23442,7 @@ FGenerationResult FEquippableItemGenerator::Generate(const FManifestEquippableIt
 	}
 
 	// Compile blueprint first to generate the class
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	CompileBlueprint(Blueprint);
 
 	// v2.6.0: Set properties on the CDO using reflection (properties are protected)
 	if (Blueprint->GeneratedClass)
@@ -25295,7 +25608,7 @@ FGenerationResult FEquippableItemGenerator::Generate(const FManifestEquippableIt
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	// Note: CDO properties were set after initial compile, so final compile ensures GeneratedClass is current
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	// v4.16: Check compile result - abort save if errors (P3, P4)
 	if (CompileLog.NumErrors > 0)
@@ -25327,17 +25640,15 @@ FGenerationResult FEquippableItemGenerator::Generate(const FManifestEquippableIt
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Equippable Item: %s"), *Definition.Name));
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("EquippableItem"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("EquippableItem"), Definition.Name, GetInputHash(Definition));
 
 	// v4.31: Cache the Blueprint class for same-session TSubclassOf resolution
 	if (Blueprint->GeneratedClass)
@@ -25367,7 +25678,7 @@ FGenerationResult FActivityGenerator::Generate(const FManifestActivityDefinition
 	}
 
 	// v3.0: Check existence with metadata-aware logic for MODIFY/CONFLICT detection
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Activity"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Activity"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -25481,7 +25792,7 @@ FGenerationResult FActivityGenerator::Generate(const FManifestActivityDefinition
 
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -25744,19 +26055,17 @@ FGenerationResult FActivityGenerator::Generate(const FManifestActivityDefinition
 		}
 
 		// Recompile after adding variables
-		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		CompileBlueprint(Blueprint);
 	}
 
 	// v4.14: Removed redundant recompile - would wipe CDO property changes
 	// Initial compile at line 14218 is sufficient; CDO changes persist without recompile
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Activity: %s"), *Definition.Name));
 
@@ -25768,7 +26077,7 @@ FGenerationResult FActivityGenerator::Generate(const FManifestActivityDefinition
 	}
 
 	// v3.0: Store metadata for regeneration tracking
-	StoreBlueprintMetadata(Blueprint, TEXT("Activity"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("Activity"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New);
 	Result.AssetPath = AssetPath;
@@ -25790,7 +26099,7 @@ FGenerationResult FBlueprintTriggerGenerator::Generate(const FManifestBlueprintT
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Blueprint Trigger"), Definition.ComputeHash(), Result))
+	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Blueprint Trigger"), GetInputHash(Definition), Result))
 	{
 		return Result;
 	}
@@ -25892,7 +26201,7 @@ FGenerationResult FBlueprintTriggerGenerator::Generate(const FManifestBlueprintT
 
 	// Compile
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -26238,12 +26547,10 @@ FGenerationResult FBlueprintTriggerGenerator::Generate(const FManifestBlueprintT
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	LogGeneration(FString::Printf(TEXT("Created Blueprint Trigger: %s"), *Definition.Name));
 
@@ -26254,7 +26561,7 @@ FGenerationResult FBlueprintTriggerGenerator::Generate(const FManifestBlueprintT
 	}
 
 	// Store metadata
-	StoreBlueprintMetadata(Blueprint, TEXT("BlueprintTrigger"), Definition.Name, Definition.ComputeHash());
+	StoreBlueprintMetadata(Blueprint, TEXT("BlueprintTrigger"), Definition.Name, GetInputHash(Definition));
 
 	Result = FGenerationResult(Definition.Name, EGenerationStatus::New);
 	Result.AssetPath = AssetPath;
@@ -26301,7 +26608,7 @@ FGenerationResult FAbilityConfigurationGenerator::Generate(const FManifestAbilit
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Ability Configuration"), InputHash, Result))
 	{
 		return Result;
@@ -26484,12 +26791,10 @@ FGenerationResult FAbilityConfigurationGenerator::Generate(const FManifestAbilit
 		ResolvedEffects, Definition.StartupEffects.Num()));
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(AbilityConfig);
+	NotifyAssetCreated(AbilityConfig);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, AbilityConfig, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, AbilityConfig, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(AbilityConfig, TEXT("AC"), Definition.Name, InputHash);
@@ -26622,7 +26927,7 @@ FGenerationResult FActivityConfigurationGenerator::Generate(const FManifestActiv
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Activity Configuration"), InputHash, Result))
 	{
 		return Result;
@@ -26796,12 +27101,10 @@ FGenerationResult FActivityConfigurationGenerator::Generate(const FManifestActiv
 		ResolvedGenerators, Definition.GoalGenerators.Num()));
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(ActivityConfig);
+	NotifyAssetCreated(ActivityConfig);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, ActivityConfig, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, ActivityConfig, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(ActivityConfig, TEXT("ActConfig"), Definition.Name, InputHash);
@@ -26827,7 +27130,7 @@ FGenerationResult FItemCollectionGenerator::Generate(const FManifestItemCollecti
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Item Collection"), InputHash, Result))
 	{
 		return Result;
@@ -26886,12 +27189,10 @@ FGenerationResult FItemCollectionGenerator::Generate(const FManifestItemCollecti
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(ItemColl);
+	NotifyAssetCreated(ItemColl);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, ItemColl, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, ItemColl, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(ItemColl, TEXT("IC"), Definition.Name, InputHash);
@@ -26918,7 +27219,7 @@ FGenerationResult FNarrativeEventGenerator::Generate(const FManifestNarrativeEve
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Narrative Event"), InputHash, Result))
 	{
 		return Result;
@@ -27001,7 +27302,7 @@ FGenerationResult FNarrativeEventGenerator::Generate(const FManifestNarrativeEve
 
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -27482,7 +27783,7 @@ FGenerationResult FNarrativeEventGenerator::Generate(const FManifestNarrativeEve
 	if (CDO && (Definition.NPCTargets.Num() > 0 || Definition.CharacterTargets.Num() > 0 || Definition.Properties.Num() > 0 || Definition.Conditions.Num() > 0 || Definition.Variables.Num() > 0 || !Definition.EventGraph.IsEmpty()))
 	{
 		FCompilerResultsLog FinalCompileLog;
-		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &FinalCompileLog);
+		CompileBlueprint(Blueprint, &FinalCompileLog);
 
 		if (FinalCompileLog.NumErrors > 0)
 		{
@@ -27508,12 +27809,10 @@ FGenerationResult FNarrativeEventGenerator::Generate(const FManifestNarrativeEve
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreBlueprintMetadata(Blueprint, TEXT("NE"), Definition.Name, InputHash);
@@ -27740,7 +28039,7 @@ FGenerationResult FNPCDefinitionGenerator::Generate(const FManifestNPCDefinition
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("NPC Definition"), InputHash, Result))
 	{
 		return Result;
@@ -28251,12 +28550,10 @@ FGenerationResult FNPCDefinitionGenerator::Generate(const FManifestNPCDefinition
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(NPCDef);
+	NotifyAssetCreated(NPCDef);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, NPCDef, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, NPCDef, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(NPCDef, TEXT("NPCDef"), Definition.Name, InputHash);
@@ -28282,7 +28579,7 @@ FGenerationResult FCharacterDefinitionGenerator::Generate(const FManifestCharact
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Character Definition"), InputHash, Result))
 	{
 		return Result;
@@ -28411,12 +28708,10 @@ FGenerationResult FCharacterDefinitionGenerator::Generate(const FManifestCharact
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(CharDef);
+	NotifyAssetCreated(CharDef);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, CharDef, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, CharDef, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(CharDef, TEXT("CD"), Definition.Name, InputHash);
@@ -28444,7 +28739,7 @@ FGenerationResult FCharacterAppearanceGenerator::Generate(const FManifestCharact
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Character Appearance"), InputHash, Result))
 	{
 		return Result;
@@ -28520,12 +28815,10 @@ FGenerationResult FCharacterAppearanceGenerator::Generate(const FManifestCharact
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(CharAppearance);
+	NotifyAssetCreated(CharAppearance);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, CharAppearance, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, CharAppearance, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(CharAppearance, TEXT("Appearance"), Definition.Name, InputHash);
@@ -28554,7 +28847,7 @@ FGenerationResult FTriggerSetGenerator::Generate(const FManifestTriggerSetDefini
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Trigger Set"), InputHash, Result))
 	{
 		return Result;
@@ -28778,9 +29071,7 @@ FGenerationResult FTriggerSetGenerator::Generate(const FManifestTriggerSetDefini
 	// Mark package dirty and save
 	Package->MarkPackageDirty();
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, TriggerSet, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, TriggerSet, PackageFileName, Definition.Name);
 
 	// Store metadata
 	StoreDataAssetMetadata(TriggerSet, TEXT("TriggerSet"), Definition.Name, InputHash);
@@ -28808,7 +29099,7 @@ FGenerationResult FTaggedDialogueSetGenerator::Generate(const FManifestTaggedDia
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Tagged Dialogue Set"), InputHash, Result))
 	{
 		return Result;
@@ -28884,12 +29175,10 @@ FGenerationResult FTaggedDialogueSetGenerator::Generate(const FManifestTaggedDia
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(DialogueSet);
+	NotifyAssetCreated(DialogueSet);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, DialogueSet, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, DialogueSet, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(DialogueSet, TEXT("TaggedDialogue"), Definition.Name, InputHash);
@@ -28927,7 +29216,7 @@ FGenerationResult FNiagaraSystemGenerator::Generate(const FManifestNiagaraSystem
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Niagara System"), InputHash, Result))
 	{
 		return Result;
@@ -29745,13 +30034,11 @@ FGenerationResult FNiagaraSystemGenerator::Generate(const FManifestNiagaraSystem
 
 	// Mark dirty and register
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(NewSystem);
+	NotifyAssetCreated(NewSystem);
 
 	// Save the package
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, NewSystem, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, NewSystem, PackageFileName, Definition.Name);
 
 	// v2.9.1: Store generator metadata for regeneration safety (FX-specific)
 	StoreGeneratorMetadata(NewSystem, Definition);
@@ -30136,7 +30423,7 @@ FGenerationResult FActivityScheduleGenerator::Generate(const FManifestActivitySc
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Activity Schedule"), InputHash, Result))
 	{
 		return Result;
@@ -30260,12 +30547,10 @@ FGenerationResult FActivityScheduleGenerator::Generate(const FManifestActivitySc
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Schedule);
+	NotifyAssetCreated(Schedule);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Schedule, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Schedule, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata after successful generation
 	StoreDataAssetMetadata(Schedule, TEXT("Schedule"), Definition.Name, InputHash);
@@ -30292,7 +30577,7 @@ FGenerationResult FGoalItemGenerator::Generate(const FManifestGoalItemDefinition
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Goal Item"), InputHash, Result))
 	{
 		return Result;
@@ -30425,7 +30710,7 @@ FGenerationResult FGoalItemGenerator::Generate(const FManifestGoalItemDefinition
 	}
 
 	// Compile blueprint after variables are added
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	CompileBlueprint(Blueprint);
 
 	// Set default property values via CDO
 	UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
@@ -30533,7 +30818,7 @@ FGenerationResult FGoalItemGenerator::Generate(const FManifestGoalItemDefinition
 
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -30558,12 +30843,10 @@ FGenerationResult FGoalItemGenerator::Generate(const FManifestGoalItemDefinition
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	// v3.0: Store metadata
 	StoreBlueprintMetadata(Blueprint, TEXT("Goal"), Definition.Name, InputHash);
@@ -30597,7 +30880,7 @@ FGenerationResult FGoalGeneratorGenerator::Generate(const FManifestGoalGenerator
 	}
 
 	// Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Goal Generator"), InputHash, Result))
 	{
 		return Result;
@@ -30729,7 +31012,7 @@ FGenerationResult FGoalGeneratorGenerator::Generate(const FManifestGoalGenerator
 	}
 
 	// Compile blueprint after variables are added
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	CompileBlueprint(Blueprint);
 
 	// Set default property values via CDO
 	UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
@@ -30793,7 +31076,7 @@ FGenerationResult FGoalGeneratorGenerator::Generate(const FManifestGoalGenerator
 
 	// Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -30818,12 +31101,10 @@ FGenerationResult FGoalGeneratorGenerator::Generate(const FManifestGoalGenerator
 	}
 
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	// Store metadata
 	StoreBlueprintMetadata(Blueprint, TEXT("GoalGenerator"), Definition.Name, InputHash);
@@ -30857,7 +31138,7 @@ FGenerationResult FGameplayCueGenerator::Generate(const FManifestGameplayCueDefi
 	}
 
 	// Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Gameplay Cue"), InputHash, Result))
 	{
 		return Result;
@@ -30964,7 +31245,7 @@ FGenerationResult FGameplayCueGenerator::Generate(const FManifestGameplayCueDefi
 	}
 
 	// Compile after variables added
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	CompileBlueprint(Blueprint);
 
 	// Configure CDO
 	UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
@@ -31065,7 +31346,7 @@ FGenerationResult FGameplayCueGenerator::Generate(const FManifestGameplayCueDefi
 
 	// Final compile
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(Blueprint, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -31091,12 +31372,10 @@ FGenerationResult FGameplayCueGenerator::Generate(const FManifestGameplayCueDefi
 
 	// Save
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	// Store metadata
 	StoreBlueprintMetadata(Blueprint, TEXT("GameplayCue"), Definition.Name, InputHash);
@@ -31200,7 +31479,7 @@ FGenerationResult FBTServiceGenerator::Generate(const FManifestBTServiceBPDefini
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("BT Service"), InputHash, Result))
 	{
 		return Result;
@@ -31290,7 +31569,7 @@ FGenerationResult FBTServiceGenerator::Generate(const FManifestBTServiceBPDefini
 	}
 
 	// Initial compile
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, nullptr);
+	CompileBlueprint(Blueprint);
 
 	// Get CDO and set properties
 	UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
@@ -31369,12 +31648,10 @@ FGenerationResult FBTServiceGenerator::Generate(const FManifestBTServiceBPDefini
 	}
 
 	// Save asset
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 	Package->MarkPackageDirty();
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	// Store metadata
 	StoreBlueprintMetadata(Blueprint, TEXT("BTS"), Definition.Name, InputHash);
@@ -31416,7 +31693,7 @@ FGenerationResult FBTTaskGenerator::Generate(const FManifestBTTaskBPDefinition&
 	}
 
 	// v3.0: Check existence with metadata-aware logic
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("BT Task"), InputHash, Result))
 	{
 		return Result;
@@ -31506,7 +31783,7 @@ FGenerationResult FBTTaskGenerator::Generate(const FManifestBTTaskBPDefinition&
 	}
 
 	// Initial compile
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, nullptr);
+	CompileBlueprint(Blueprint);
 
 	// Get CDO and set properties
 	UObject* CDO = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
@@ -31574,12 +31851,10 @@ FGenerationResult FBTTaskGenerator::Generate(const FManifestBTTaskBPDefinition&
 	}
 
 	// Save asset
-	FAssetRegistryModule::AssetCreated(Blueprint);
+	NotifyAssetCreated(Blueprint);
 	Package->MarkPackageDirty();
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, Blueprint, PackageFileName, Definition.Name);
 
 	// Store metadata
 	StoreBlueprintMetadata(Blueprint, TEXT("BTTask"), Definition.Name, InputHash);
@@ -31613,7 +31888,7 @@ FGenerationResult FQuestGenerator::Generate(const FManifestQuestDefinition& Defi
 	}
 
 	// v3.0: Use metadata-aware existence check
-	uint64 InputHash = Definition.ComputeHash();
+	uint64 InputHash = GetInputHash(Definition);
 	if (CheckExistsWithMetadata(AssetPath, Definition.Name, TEXT("Quest Blueprint"), InputHash, Result))
 	{
 		return Result;
@@ -32242,7 +32517,7 @@ FGenerationResult FQuestGenerator::Generate(const FManifestQuestDefinition& Defi
 
 	// v4.16: Compile with validation (Contract 10 - Blueprint Compile Gate)
 	FCompilerResultsLog CompileLog;
-	FKismetEditorUtilities::CompileBlueprint(QuestBP, EBlueprintCompileOptions::None, &CompileLog);
+	CompileBlueprint(QuestBP, &CompileLog);
 
 	if (CompileLog.NumErrors > 0)
 	{
@@ -32268,12 +32543,10 @@ FGenerationResult FQuestGenerator::Generate(const FManifestQuestDefinition& Defi
 
 	// Save
 	Package->MarkPackageDirty();
-	FAssetRegistryModule::AssetCreated(QuestBP);
+	NotifyAssetCreated(QuestBP);
 
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, QuestBP, *PackageFileName, SaveArgs);
+	SafeSavePackage(Package, QuestBP, PackageFileName, Definition.Name);
 
 	// ========================================================================
 	// v4.13.3: Quest SM Semantic Verification
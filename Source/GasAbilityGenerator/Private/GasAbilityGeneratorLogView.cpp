@@ -0,0 +1,419 @@
+// GasAbilityGenerator v7.8.84 - Generator window log view
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.74: Ring-buffered, virtualized log view streamed to a rotating log file
+// v7.8.84: Log file flushed only after a frame's lines were written; file names carry milliseconds
+
+#include "GasAbilityGeneratorLogView.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Styling/AppStyle.h"
+#include "Styling/CoreStyle.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#define LOCTEXT_NAMESPACE "GasAbilityGenerator"
+
+namespace GeneratorLogView
+{
+	/** Log files kept in Saved/GasAbilityGenerator/Logs (oldest deleted when a window opens) */
+	static constexpr int32 MaxLogFiles = 10;
+
+	static FSlateColor GetSeverityColor(EGeneratorLogSeverity Severity)
+	{
+		switch (Severity)
+		{
+		case EGeneratorLogSeverity::Success: return FSlateColor(FLinearColor(0.35f, 0.85f, 0.35f));
+		case EGeneratorLogSeverity::Skip:    return FSlateColor(FLinearColor(0.55f, 0.55f, 0.55f));
+		case EGeneratorLogSeverity::Warning: return FSlateColor(FLinearColor(0.95f, 0.8f, 0.25f));
+		case EGeneratorLogSeverity::Error:   return FSlateColor(FLinearColor(0.95f, 0.3f, 0.3f));
+		default:                             return FSlateColor::UseForeground();
+		}
+	}
+
+	static uint8 SeverityBit(EGeneratorLogSeverity Severity)
+	{
+		return static_cast<uint8>(1 << static_cast<uint8>(Severity));
+	}
+}
+
+void SGeneratorLogView::Construct(const FArguments& InArgs)
+{
+	MaxLines = FMath::Max(InArgs._MaxLines, 100);
+	Ring.Reserve(MaxLines);
+
+	OpenLogFile();
+
+	TSharedRef<SHorizontalBox> SeverityToggles = SNew(SHorizontalBox);
+	auto AddSeverityToggle = [this, &SeverityToggles](EGeneratorLogSeverity Severity, const FText& Label)
+	{
+		SeverityToggles->AddSlot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(8, 0, 0, 0)
+		[
+			SNew(SCheckBox)
+			.IsChecked(this, &SGeneratorLogView::IsSeverityShown, Severity)
+			.OnCheckStateChanged(this, &SGeneratorLogView::OnSeverityFilterChanged, Severity)
+			[
+				SNew(STextBlock)
+				.Text(Label)
+				.ColorAndOpacity(GeneratorLogView::GetSeverityColor(Severity))
+			]
+		];
+	};
+	AddSeverityToggle(EGeneratorLogSeverity::Info, LOCTEXT("LogFilterInfo", "Info"));
+	AddSeverityToggle(EGeneratorLogSeverity::Success, LOCTEXT("LogFilterNew", "New"));
+	AddSeverityToggle(EGeneratorLogSeverity::Skip, LOCTEXT("LogFilterSkip", "Skipped"));
+	AddSeverityToggle(EGeneratorLogSeverity::Warning, LOCTEXT("LogFilterWarning", "Warnings"));
+	AddSeverityToggle(EGeneratorLogSeverity::Error, LOCTEXT("LogFilterError", "Errors"));
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Filter bar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0, 0, 0, 4)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SSearchBox)
+				.HintText(LOCTEXT("LogFilterHint", "Filter by asset or text"))
+				.OnTextChanged(this, &SGeneratorLogView::OnFilterTextChanged)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SeverityToggles
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(12, 0, 0, 0)
+			[
+				SNew(STextBlock)
+				.Text(this, &SGeneratorLogView::GetLineCountText)
+				.ToolTipText(FText::Format(LOCTEXT("LogFileTooltip", "Full log: {0}"), FText::FromString(LogFilePath)))
+			]
+		]
+
+		// Lines
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SNew(SBorder)
+			.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+			.BorderBackgroundColor(FLinearColor(0.02f, 0.02f, 0.02f))
+			[
+				SAssignNew(ListView, SListView<FLogLinePtr>)
+				.ListItemsSource(&FilteredLines)
+				.OnGenerateRow(this, &SGeneratorLogView::OnGenerateRow)
+				.SelectionMode(ESelectionMode::Multi)
+			]
+		]
+	];
+}
+
+SGeneratorLogView::~SGeneratorLogView()
+{
+	CloseLogFile();
+}
+
+void SGeneratorLogView::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	if (PendingLines.Num() > 0)
+	{
+		FlushPending();
+	}
+}
+
+void SGeneratorLogView::AddMessage(const FString& Message)
+{
+	TArray<FString> Lines;
+	if (Message.IsEmpty())
+	{
+		Lines.Add(FString());
+	}
+	else
+	{
+		Message.ParseIntoArrayLines(Lines, false);
+	}
+
+	for (FString& Text : Lines)
+	{
+		if (LogFile.IsValid())
+		{
+			const FTCHARToUTF8 Utf8(*Text);
+			LogFile->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+			LogFile->Serialize(const_cast<ANSICHAR*>(LINE_TERMINATOR_ANSI), FCStringAnsi::Strlen(LINE_TERMINATOR_ANSI));
+		}
+
+		FLogLinePtr Line = MakeShared<FGeneratorLogLine>();
+		Line->Severity = ClassifyLine(Text, Line->AssetName);
+		Line->Text = MoveTemp(Text);
+		Line->Sequence = NextSequence++;
+		PendingLines.Add(MoveTemp(Line));
+		TotalLineCount++;
+	}
+
+	// Not ticked while hidden - everything past one ring buffer's worth would be evicted anyway
+	if (PendingLines.Num() > 2 * MaxLines)
+	{
+		PendingLines.RemoveAt(0, PendingLines.Num() - MaxLines, EAllowShrinking::No);
+	}
+}
+
+void SGeneratorLogView::FlushPending()
+{
+	const bool bWasAtEnd = FilteredLines.Num() == 0 || ListView->GetScrollDistanceRemaining().Y <= KINDA_SMALL_NUMBER;
+
+	for (FLogLinePtr& Line : PendingLines)
+	{
+		if (PassesFilter(*Line))
+		{
+			FilteredLines.Add(Line);
+		}
+
+		if (Ring.Num() < MaxLines)
+		{
+			Ring.Add(MoveTemp(Line));
+		}
+		else
+		{
+			Ring[RingHead] = MoveTemp(Line);
+			RingHead = (RingHead + 1) % MaxLines;
+		}
+	}
+	PendingLines.Reset();
+
+	// Every pending line was streamed to the file in AddMessage - push this frame's batch out once
+	if (LogFile.IsValid())
+	{
+		LogFile->Flush();
+	}
+
+	// Drop evicted lines from the front of the view in one move
+	if (Ring.Num() == MaxLines)
+	{
+		const int64 OldestSequence = GetRingLine(0)->Sequence;
+		int32 EvictedCount = 0;
+		while (EvictedCount < FilteredLines.Num() && FilteredLines[EvictedCount]->Sequence < OldestSequence)
+		{
+			EvictedCount++;
+		}
+		if (EvictedCount > 0)
+		{
+			FilteredLines.RemoveAt(0, EvictedCount, EAllowShrinking::No);
+		}
+	}
+
+	ListView->RequestListRefresh();
+	if (bWasAtEnd)
+	{
+		ListView->ScrollToBottom();
+	}
+}
+
+void SGeneratorLogView::Clear()
+{
+	PendingLines.Reset();
+	Ring.Reset();
+	RingHead = 0;
+	TotalLineCount = 0;
+	FilteredLines.Reset();
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+FString SGeneratorLogView::GetCopyText() const
+{
+	TArray<FLogLinePtr> Lines = ListView.IsValid() ? ListView->GetSelectedItems() : TArray<FLogLinePtr>();
+	if (Lines.Num() > 0)
+	{
+		// Selection order is click order
+		Lines.Sort([](const FLogLinePtr& A, const FLogLinePtr& B) { return A->Sequence < B->Sequence; });
+	}
+	else
+	{
+		Lines = FilteredLines;
+	}
+
+	FString Result;
+	for (const FLogLinePtr& Line : Lines)
+	{
+		Result += Line->Text;
+		Result += TEXT("\n");
+	}
+	return Result;
+}
+
+EGeneratorLogSeverity SGeneratorLogView::ClassifyLine(const FString& Line, FString& OutAssetName)
+{
+	OutAssetName.Reset();
+
+	// "[TAG] AssetName ..." - per-asset result lines from the window and the commandlet
+	const FString Trimmed = Line.TrimStart();
+	int32 TagEnd = INDEX_NONE;
+	if (Trimmed.StartsWith(TEXT("[")) && Trimmed.FindChar(TEXT(']'), TagEnd))
+	{
+		const FString Tag = Trimmed.Mid(1, TagEnd - 1);
+		EGeneratorLogSeverity TagSeverity = EGeneratorLogSeverity::Info;
+		bool bAssetTag = true;
+		if (Tag == TEXT("NEW"))
+		{
+			TagSeverity = EGeneratorLogSeverity::Success;
+		}
+		else if (Tag == TEXT("SKIP") || Tag == TEXT("SKIPPED"))
+		{
+			TagSeverity = EGeneratorLogSeverity::Skip;
+		}
+		else if (Tag == TEXT("FAIL") || Tag == TEXT("FAILED"))
+		{
+			TagSeverity = EGeneratorLogSeverity::Error;
+		}
+		else if (Tag == TEXT("WARN") || Tag == TEXT("WARNING"))
+		{
+			TagSeverity = EGeneratorLogSeverity::Warning;
+		}
+		else
+		{
+			bAssetTag = false;
+		}
+
+		if (bAssetTag)
+		{
+			FString Rest = Trimmed.Mid(TagEnd + 1).TrimStart();
+			int32 NameEnd = 0;
+			while (NameEnd < Rest.Len() && !FChar::IsWhitespace(Rest[NameEnd]))
+			{
+				NameEnd++;
+			}
+			OutAssetName = Rest.Left(NameEnd);
+			return TagSeverity;
+		}
+	}
+
+	if (Line.Contains(TEXT("ERROR"), ESearchCase::CaseSensitive))
+	{
+		return EGeneratorLogSeverity::Error;
+	}
+	if (Line.Contains(TEXT("WARNING"), ESearchCase::CaseSensitive))
+	{
+		return EGeneratorLogSeverity::Warning;
+	}
+	return EGeneratorLogSeverity::Info;
+}
+
+bool SGeneratorLogView::PassesFilter(const FGeneratorLogLine& Line) const
+{
+	if (HiddenSeverities & GeneratorLogView::SeverityBit(Line.Severity))
+	{
+		return false;
+	}
+	if (FilterText.IsEmpty())
+	{
+		return true;
+	}
+	return Line.AssetName.Contains(FilterText) || Line.Text.Contains(FilterText);
+}
+
+void SGeneratorLogView::RebuildFilteredLines()
+{
+	FilteredLines.Reset();
+	for (int32 Index = 0; Index < GetRingLineCount(); ++Index)
+	{
+		const FLogLinePtr& Line = GetRingLine(Index);
+		if (PassesFilter(*Line))
+		{
+			FilteredLines.Add(Line);
+		}
+	}
+	ListView->RequestListRefresh();
+	ListView->ScrollToBottom();
+}
+
+TSharedRef<ITableRow> SGeneratorLogView::OnGenerateRow(FLogLinePtr Line, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<FLogLinePtr>, OwnerTable)
+		.Padding(FMargin(4, 0))
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(Line->Text))
+			.Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
+			.ColorAndOpacity(GeneratorLogView::GetSeverityColor(Line->Severity))
+			.HighlightText_Lambda([this]() { return FText::FromString(FilterText); })
+		];
+}
+
+void SGeneratorLogView::OnFilterTextChanged(const FText& NewText)
+{
+	FilterText = NewText.ToString();
+	RebuildFilteredLines();
+}
+
+void SGeneratorLogView::OnSeverityFilterChanged(ECheckBoxState NewState, EGeneratorLogSeverity Severity)
+{
+	const uint8 Bit = GeneratorLogView::SeverityBit(Severity);
+	HiddenSeverities = NewState == ECheckBoxState::Checked ? (HiddenSeverities & ~Bit) : (HiddenSeverities | Bit);
+	RebuildFilteredLines();
+}
+
+ECheckBoxState SGeneratorLogView::IsSeverityShown(EGeneratorLogSeverity Severity) const
+{
+	return (HiddenSeverities & GeneratorLogView::SeverityBit(Severity)) ? ECheckBoxState::Unchecked : ECheckBoxState::Checked;
+}
+
+FText SGeneratorLogView::GetLineCountText() const
+{
+	return FText::Format(LOCTEXT("LogLineCount", "{0} shown / {1} kept / {2} total"),
+		FText::AsNumber(FilteredLines.Num()), FText::AsNumber(Ring.Num()), FText::AsNumber(TotalLineCount));
+}
+
+void SGeneratorLogView::OpenLogFile()
+{
+	const FString LogDir = FPaths::ProjectSavedDir() / TEXT("GasAbilityGenerator/Logs");
+	IFileManager& FileManager = IFileManager::Get();
+
+	// Timestamped names sort chronologically - keep the newest few. Milliseconds keep two windows
+	// opened in the same second from sharing a file.
+	TArray<FString> ExistingLogs;
+	FileManager.FindFiles(ExistingLogs, *(LogDir / TEXT("GeneratorWindow_*.log")), true, false);
+	ExistingLogs.Sort();
+	for (int32 Index = 0; Index <= ExistingLogs.Num() - GeneratorLogView::MaxLogFiles; ++Index)
+	{
+		FileManager.Delete(*(LogDir / ExistingLogs[Index]), false, false, true);
+	}
+
+	LogFilePath = LogDir / FString::Printf(TEXT("GeneratorWindow_%s.log"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S_%s")));
+	LogFile.Reset(FileManager.CreateFileWriter(*LogFilePath, FILEWRITE_AllowRead));
+	if (!LogFile.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GasAbilityGenerator: could not open window log file %s"), *LogFilePath);
+	}
+}
+
+void SGeneratorLogView::CloseLogFile()
+{
+	if (LogFile.IsValid())
+	{
+		LogFile->Close();
+		LogFile.Reset();
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,1941 @@
+// GasAbilityGenerator - Manifest Archive
+// v7.8.83: Binary FManifestData serializer behind the FManifestParseCache cache file
+// v7.8.84: No build stamp in the cache key - layout changes bump FManifestParseCache::CacheFileVersion
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+//
+// Every data member of every definition struct reachable from FManifestData is written in declaration
+// order. The manifest types have no reflection, so a field added to GasAbilityGeneratorTypes.h must be
+// added here as well.
+//
+// RULE: any change to what this file writes (a field added, removed, reordered or retyped) must bump
+// FManifestParseCache::CacheFileVersion in GasAbilityGeneratorParser.h in the same change. Cache files
+// are keyed on that version and the manifest text only, so an unbumped layout change reads old files
+// with the new layout.
+
+#include "GasAbilityGeneratorParser.h"
+
+// ============================================================================
+// Leaf values
+// ============================================================================
+
+static void SerializeField(FArchive& Ar, FString& Value) { Ar << Value; }
+static void SerializeField(FArchive& Ar, int32& Value) { Ar << Value; }
+static void SerializeField(FArchive& Ar, float& Value) { Ar << Value; }
+static void SerializeField(FArchive& Ar, bool& Value) { Ar << Value; }
+static void SerializeField(FArchive& Ar, FVector& Value) { Ar << Value; }
+static void SerializeField(FArchive& Ar, FRotator& Value) { Ar << Value; }
+static void SerializeField(FArchive& Ar, FLinearColor& Value) { Ar << Value; }
+
+// Forward declarations - element serializers are looked up from the container templates
+static void SerializeField(FArchive& Ar, FManifestEnumerationDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestInputActionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestInputMappingBinding& Value);
+static void SerializeField(FArchive& Ar, FManifestInputMappingContextDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestTagRequirement& Value);
+static void SerializeField(FArchive& Ar, FManifestAttributeBasedMagnitude& Value);
+static void SerializeField(FArchive& Ar, FManifestGEExecutionModifier& Value);
+static void SerializeField(FArchive& Ar, FManifestConditionalGameplayEffect& Value);
+static void SerializeField(FArchive& Ar, FManifestGEExecution& Value);
+static void SerializeField(FArchive& Ar, FManifestModifierDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGEComponentDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGameplayEffectDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestFormStateEffectDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestCueTriggerDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestVFXSpawnDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDelegateBindingDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestAttributeBindingDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestAbilityTagsDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestActorVariableDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGraphPinReference& Value);
+static void SerializeField(FArchive& Ar, FManifestGraphNodeDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGraphConnectionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestEventGraphDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestFunctionParameterDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestCustomFunctionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestAbilityTriggerDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGameplayAbilityDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestActorComponentDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestAISenseConfig& Value);
+static void SerializeField(FArchive& Ar, FManifestAIPerceptionConfig& Value);
+static void SerializeField(FArchive& Ar, FManifestFunctionOverrideDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestActorBlueprintDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestWidgetVariableDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestWidgetSlotDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestWidgetNodeDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestWidgetTreeDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestWidgetBlueprintDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDispatcherParam& Value);
+static void SerializeField(FArchive& Ar, FManifestEventDispatcherDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestFunctionParam& Value);
+static void SerializeField(FArchive& Ar, FManifestFunctionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestComponentBlueprintDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBlueprintConditionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBlackboardKeyDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBlackboardDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBTDecoratorDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBTServiceDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBTNodeDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBehaviorTreeDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialExpression& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialConnection& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceScalarParam& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceVectorParam& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceTextureParam& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialFunctionInput& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialFunctionOutput& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialFunctionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestFloatCurveKeyDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestFloatCurveDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestAnimationMontageDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestAnimationNotifyDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueLineDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueEventDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueConditionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueNodeDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueTreeDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueSpeakerDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestPlayerSpeakerDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestTransformDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueSequenceDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialogueBlueprintDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestMaterialParamBinding& Value);
+static void SerializeField(FArchive& Ar, FManifestClothingMaterial& Value);
+static void SerializeField(FArchive& Ar, FManifestClothingMorph& Value);
+static void SerializeField(FArchive& Ar, FManifestClothingMeshConfig& Value);
+static void SerializeField(FArchive& Ar, FManifestWeaponAttachmentSlot& Value);
+static void SerializeField(FArchive& Ar, FManifestWeaponAttachmentConfigEntry& Value);
+static void SerializeField(FArchive& Ar, FManifestPickupMeshDataDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestCombatTraceDataDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestItemStatDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestFragmentPropertyDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestFragmentDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestEquippableItemDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestActivityDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBlueprintTriggerDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestAbilityConfigurationDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestActivityConfigurationDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestItemWithQuantity& Value);
+static void SerializeField(FArchive& Ar, FManifestItemCollectionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestNarrativeEventDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestItemWithQuantityDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestLootTableRollDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestNPCDefinitionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestCharacterDefinitionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestCharacterAppearanceDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestTaggedDialogueEntry& Value);
+static void SerializeField(FArchive& Ar, FManifestTaggedDialogueSetDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestNiagaraUserParameter& Value);
+static void SerializeField(FArchive& Ar, FManifestNiagaraEmitterOverride& Value);
+static void SerializeField(FArchive& Ar, FManifestFXDescriptor& Value);
+static void SerializeField(FArchive& Ar, FManifestFXPresetDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestNiagaraSystemDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestScheduledBehaviorDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestActivityScheduleDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGoalItemDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGoalGeneratorDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestSpawnConditionOverride& Value);
+static void SerializeField(FArchive& Ar, FManifestPlacementInfoOverride& Value);
+static void SerializeField(FArchive& Ar, FManifestBurstParticleEffect& Value);
+static void SerializeField(FArchive& Ar, FManifestBurstSoundEffect& Value);
+static void SerializeField(FArchive& Ar, FManifestBurstCameraShake& Value);
+static void SerializeField(FArchive& Ar, FManifestBurstCameraLensEffect& Value);
+static void SerializeField(FArchive& Ar, FManifestBurstForceFeedback& Value);
+static void SerializeField(FArchive& Ar, FManifestBurstDecal& Value);
+static void SerializeField(FArchive& Ar, FManifestGCNEffects& Value);
+static void SerializeField(FArchive& Ar, FManifestGCNDefaults& Value);
+static void SerializeField(FArchive& Ar, FManifestCueFunctionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestGameplayCueDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestQuestRequirementDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestQuestTaskDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestQuestBranchDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestQuestStateDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestDialoguePlayParamsDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestQuestRewardDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestQuestDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestPipelineConfig& Value);
+static void SerializeField(FArchive& Ar, FManifestPipelineItemDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestPipelineCollectionDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestPipelineLoadoutDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestPOIPlacement& Value);
+static void SerializeField(FArchive& Ar, FManifestNPCSpawnParams& Value);
+static void SerializeField(FArchive& Ar, FManifestNPCSpawnEntry& Value);
+static void SerializeField(FArchive& Ar, FManifestNPCSpawnerPlacement& Value);
+static void SerializeField(FArchive& Ar, FManifestTriggerEventDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestTriggerDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestTriggerSetDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBTServiceBPDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestBTTaskBPDefinition& Value);
+static void SerializeField(FArchive& Ar, FManifestData& Value);
+
+// ============================================================================
+// Containers
+// ============================================================================
+
+/** Reads a container size; a negative count or one larger than the bytes left marks the archive as corrupt */
+static bool SerializeCount(FArchive& Ar, int32& Num)
+{
+	Ar << Num;
+	if (Ar.IsLoading() && (Ar.IsError() || Num < 0 || Num > Ar.TotalSize() - Ar.Tell()))
+	{
+		Ar.SetError();
+		return false;
+	}
+	return true;
+}
+
+template <typename ElementType>
+static void SerializeField(FArchive& Ar, TArray<ElementType>& Array)
+{
+	int32 Num = Array.Num();
+	if (!SerializeCount(Ar, Num))
+	{
+		return;
+	}
+	if (Ar.IsLoading())
+	{
+		Array.SetNum(Num);
+	}
+	for (ElementType& Element : Array)
+	{
+		SerializeField(Ar, Element);
+		if (Ar.IsError())
+		{
+			return;
+		}
+	}
+}
+
+/** Maps keep their iteration order, which the definition hashes depend on */
+template <typename ValueType>
+static void SerializeField(FArchive& Ar, TMap<FString, ValueType>& Map)
+{
+	int32 Num = Map.Num();
+	if (!SerializeCount(Ar, Num))
+	{
+		return;
+	}
+	if (Ar.IsSaving())
+	{
+		for (auto& Pair : Map)
+		{
+			FString Key = Pair.Key;
+			SerializeField(Ar, Key);
+			SerializeField(Ar, Pair.Value);
+		}
+		return;
+	}
+
+	Map.Reset();
+	Map.Reserve(Num);
+	for (int32 Index = 0; Index < Num && !Ar.IsError(); Index++)
+	{
+		FString Key;
+		ValueType Value;
+		SerializeField(Ar, Key);
+		SerializeField(Ar, Value);
+		Map.Add(MoveTemp(Key), MoveTemp(Value));
+	}
+}
+
+// ============================================================================
+// Definitions (declaration order of GasAbilityGeneratorTypes.h)
+// ============================================================================
+
+static void SerializeField(FArchive& Ar, FManifestEnumerationDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Values);
+}
+
+static void SerializeField(FArchive& Ar, FManifestInputActionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.ValueType);
+	SerializeField(Ar, Value.TriggerType);
+}
+
+static void SerializeField(FArchive& Ar, FManifestInputMappingBinding& Value)
+{
+	SerializeField(Ar, Value.ActionName);
+	SerializeField(Ar, Value.Key);
+	SerializeField(Ar, Value.Modifiers);
+	SerializeField(Ar, Value.Triggers);
+}
+
+static void SerializeField(FArchive& Ar, FManifestInputMappingContextDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Bindings);
+}
+
+static void SerializeField(FArchive& Ar, FManifestTagRequirement& Value)
+{
+	SerializeField(Ar, Value.MustHaveTags);
+	SerializeField(Ar, Value.MustNotHaveTags);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAttributeBasedMagnitude& Value)
+{
+	SerializeField(Ar, Value.Coefficient);
+	SerializeField(Ar, Value.PreMultiplyAdditiveValue);
+	SerializeField(Ar, Value.PostMultiplyAdditiveValue);
+	SerializeField(Ar, Value.AttributeToCapture);
+	SerializeField(Ar, Value.AttributeSource);
+	SerializeField(Ar, Value.bSnapshot);
+	SerializeField(Ar, Value.CurveTable);
+	SerializeField(Ar, Value.CurveRowName);
+	SerializeField(Ar, Value.AttributeCalculationType);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGEExecutionModifier& Value)
+{
+	SerializeField(Ar, Value.CapturedAttribute);
+	SerializeField(Ar, Value.CapturedSource);
+	SerializeField(Ar, Value.CapturedStatus);
+	SerializeField(Ar, Value.ModifierOp);
+	SerializeField(Ar, Value.MagnitudeType);
+	SerializeField(Ar, Value.ScalableFloatValue);
+	SerializeField(Ar, Value.SetByCallerTag);
+	SerializeField(Ar, Value.AttributeBased);
+}
+
+static void SerializeField(FArchive& Ar, FManifestConditionalGameplayEffect& Value)
+{
+	SerializeField(Ar, Value.EffectClass);
+	SerializeField(Ar, Value.RequiredSourceTags);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGEExecution& Value)
+{
+	SerializeField(Ar, Value.CalculationClass);
+	SerializeField(Ar, Value.Modifiers);
+	SerializeField(Ar, Value.ConditionalEffects);
+}
+
+static void SerializeField(FArchive& Ar, FManifestModifierDefinition& Value)
+{
+	SerializeField(Ar, Value.Attribute);
+	SerializeField(Ar, Value.Operation);
+	SerializeField(Ar, Value.MagnitudeType);
+	SerializeField(Ar, Value.ScalableFloatValue);
+	SerializeField(Ar, Value.SetByCallerTag);
+	SerializeField(Ar, Value.AttributeBased);
+	SerializeField(Ar, Value.CustomCalculationClass);
+	SerializeField(Ar, Value.SourceTags);
+	SerializeField(Ar, Value.TargetTags);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGEComponentDefinition& Value)
+{
+	SerializeField(Ar, Value.ComponentClass);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGameplayEffectDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.DurationPolicy);
+	SerializeField(Ar, Value.DurationMagnitude);
+	SerializeField(Ar, Value.Period);
+	SerializeField(Ar, Value.bExecutePeriodicOnApplication);
+	SerializeField(Ar, Value.PeriodicInhibitionPolicy);
+	SerializeField(Ar, Value.GrantedTags);
+	SerializeField(Ar, Value.RemoveGameplayEffectsWithTags);
+	SerializeField(Ar, Value.Modifiers);
+	SerializeField(Ar, Value.Components);
+	SerializeField(Ar, Value.StackLimitCount);
+	SerializeField(Ar, Value.StackingType);
+	SerializeField(Ar, Value.Executions);
+	SerializeField(Ar, Value.ExecutionClasses);
+	SerializeField(Ar, Value.SetByCallerTags);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFormStateEffectDefinition& Value)
+{
+	SerializeField(Ar, Value.Form);
+	SerializeField(Ar, Value.bInvulnerable);
+	SerializeField(Ar, Value.Folder);
+}
+
+static void SerializeField(FArchive& Ar, FManifestCueTriggerDefinition& Value)
+{
+	SerializeField(Ar, Value.Trigger);
+	SerializeField(Ar, Value.CueTag);
+}
+
+static void SerializeField(FArchive& Ar, FManifestVFXSpawnDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.NiagaraSystem);
+	SerializeField(Ar, Value.AttachTo);
+	SerializeField(Ar, Value.Socket);
+	SerializeField(Ar, Value.bDestroyOnEndAbility);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDelegateBindingDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.Delegate);
+	SerializeField(Ar, Value.Source);
+	SerializeField(Ar, Value.Attribute);
+	SerializeField(Ar, Value.Handler);
+	SerializeField(Ar, Value.bUnbindOnEnd);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAttributeBindingDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.AttributeSet);
+	SerializeField(Ar, Value.Attribute);
+	SerializeField(Ar, Value.Source);
+	SerializeField(Ar, Value.Handler);
+	SerializeField(Ar, Value.bTriggerOnce);
+	SerializeField(Ar, Value.WithTag);
+	SerializeField(Ar, Value.WithoutTag);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAbilityTagsDefinition& Value)
+{
+	SerializeField(Ar, Value.AbilityTags);
+	SerializeField(Ar, Value.CancelAbilitiesWithTag);
+	SerializeField(Ar, Value.ActivationOwnedTags);
+	SerializeField(Ar, Value.ActivationRequiredTags);
+	SerializeField(Ar, Value.ActivationBlockedTags);
+	SerializeField(Ar, Value.BlockAbilitiesWithTag);
+	SerializeField(Ar, Value.SourceRequiredTags);
+	SerializeField(Ar, Value.SourceBlockedTags);
+	SerializeField(Ar, Value.TargetRequiredTags);
+	SerializeField(Ar, Value.TargetBlockedTags);
+}
+
+static void SerializeField(FArchive& Ar, FManifestActorVariableDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Class);
+	SerializeField(Ar, Value.Container);
+	SerializeField(Ar, Value.KeyType);
+	SerializeField(Ar, Value.ValueType);
+	SerializeField(Ar, Value.DefaultValue);
+	SerializeField(Ar, Value.bReplicated);
+	SerializeField(Ar, Value.bInstanceEditable);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGraphPinReference& Value)
+{
+	SerializeField(Ar, Value.NodeId);
+	SerializeField(Ar, Value.PinName);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGraphNodeDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.PositionX);
+	SerializeField(Ar, Value.PositionY);
+	SerializeField(Ar, Value.bHasPosition);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGraphConnectionDefinition& Value)
+{
+	SerializeField(Ar, Value.From);
+	SerializeField(Ar, Value.To);
+}
+
+static void SerializeField(FArchive& Ar, FManifestEventGraphDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Description);
+	SerializeField(Ar, Value.Nodes);
+	SerializeField(Ar, Value.Connections);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFunctionParameterDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Default);
+}
+
+static void SerializeField(FArchive& Ar, FManifestCustomFunctionDefinition& Value)
+{
+	SerializeField(Ar, Value.FunctionName);
+	SerializeField(Ar, Value.Inputs);
+	SerializeField(Ar, Value.Outputs);
+	SerializeField(Ar, Value.Nodes);
+	SerializeField(Ar, Value.Connections);
+	SerializeField(Ar, Value.bPure);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAbilityTriggerDefinition& Value)
+{
+	SerializeField(Ar, Value.TriggerTag);
+	SerializeField(Ar, Value.TriggerSource);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGameplayAbilityDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.InstancingPolicy);
+	SerializeField(Ar, Value.NetExecutionPolicy);
+	SerializeField(Ar, Value.CooldownGameplayEffectClass);
+	SerializeField(Ar, Value.CostGameplayEffectClass);
+	SerializeField(Ar, Value.NetSecurityPolicy);
+	SerializeField(Ar, Value.Tags);
+	SerializeField(Ar, Value.InputTag);
+	SerializeField(Ar, Value.bActivateAbilityOnGranted);
+	SerializeField(Ar, Value.bRequiresAmmo);
+	SerializeField(Ar, Value.bDrawDebugTraces);
+	SerializeField(Ar, Value.FireCueTag);
+	SerializeField(Ar, Value.FireCueTagNoImpact);
+	SerializeField(Ar, Value.DamageEffectClass);
+	SerializeField(Ar, Value.DefaultAttackDamage);
+	SerializeField(Ar, Value.AbilityTriggers);
+	SerializeField(Ar, Value.bIsAutomatic);
+	SerializeField(Ar, Value.RateOfFire);
+	SerializeField(Ar, Value.BurstAmount);
+	SerializeField(Ar, Value.TraceDistance);
+	SerializeField(Ar, Value.TraceRadius);
+	SerializeField(Ar, Value.bTraceMulti);
+	SerializeField(Ar, Value.bShouldWarp);
+	SerializeField(Ar, Value.WarpMaintainDist);
+	SerializeField(Ar, Value.MinWarpDist);
+	SerializeField(Ar, Value.MaxWarpDist);
+	SerializeField(Ar, Value.ExecutionGameplayTag);
+	SerializeField(Ar, Value.bExecutionInvulnerability);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraphName);
+	SerializeField(Ar, Value.bHasInlineEventGraph);
+	SerializeField(Ar, Value.EventGraphNodes);
+	SerializeField(Ar, Value.EventGraphConnections);
+	SerializeField(Ar, Value.CueTriggers);
+	SerializeField(Ar, Value.VFXSpawns);
+	SerializeField(Ar, Value.DelegateBindings);
+	SerializeField(Ar, Value.AttributeBindings);
+	SerializeField(Ar, Value.CustomFunctions);
+}
+
+static void SerializeField(FArchive& Ar, FManifestActorComponentDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAISenseConfig& Value)
+{
+	SerializeField(Ar, Value.SenseType);
+	SerializeField(Ar, Value.SightRadius);
+	SerializeField(Ar, Value.LoseSightRadius);
+	SerializeField(Ar, Value.PeripheralVisionAngleDegrees);
+	SerializeField(Ar, Value.AutoSuccessRangeFromLastSeenLocation);
+	SerializeField(Ar, Value.bDetectEnemies);
+	SerializeField(Ar, Value.bDetectNeutrals);
+	SerializeField(Ar, Value.bDetectFriendlies);
+	SerializeField(Ar, Value.MaxAge);
+	SerializeField(Ar, Value.bStartsEnabled);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAIPerceptionConfig& Value)
+{
+	SerializeField(Ar, Value.Senses);
+	SerializeField(Ar, Value.DominantSense);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFunctionOverrideDefinition& Value)
+{
+	SerializeField(Ar, Value.FunctionName);
+	SerializeField(Ar, Value.Nodes);
+	SerializeField(Ar, Value.Connections);
+	SerializeField(Ar, Value.bCallParent);
+}
+
+static void SerializeField(FArchive& Ar, FManifestActorBlueprintDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Components);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraphName);
+	SerializeField(Ar, Value.bHasInlineEventGraph);
+	SerializeField(Ar, Value.EventGraphNodes);
+	SerializeField(Ar, Value.EventGraphConnections);
+	SerializeField(Ar, Value.FunctionOverrides);
+	SerializeField(Ar, Value.DelegateBindings);
+	SerializeField(Ar, Value.CustomFunctions);
+	SerializeField(Ar, Value.AIPerceptionConfig);
+	SerializeField(Ar, Value.bHasAIPerceptionConfig);
+	SerializeField(Ar, Value.ActivityName);
+	SerializeField(Ar, Value.OwnedTags);
+	SerializeField(Ar, Value.BlockTags);
+	SerializeField(Ar, Value.RequireTags);
+	SerializeField(Ar, Value.BehaviorTree);
+	SerializeField(Ar, Value.SupportedGoalType);
+	SerializeField(Ar, Value.bIsInterruptable);
+	SerializeField(Ar, Value.bSaveActivity);
+	SerializeField(Ar, Value.DefaultScore);
+	SerializeField(Ar, Value.GoalLifetime);
+	SerializeField(Ar, Value.bRemoveOnSucceeded);
+	SerializeField(Ar, Value.bSaveGoal);
+}
+
+static void SerializeField(FArchive& Ar, FManifestWidgetVariableDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.DefaultValue);
+	SerializeField(Ar, Value.bInstanceEditable);
+	SerializeField(Ar, Value.bExposeOnSpawn);
+}
+
+static void SerializeField(FArchive& Ar, FManifestWidgetSlotDefinition& Value)
+{
+	SerializeField(Ar, Value.Anchors);
+	SerializeField(Ar, Value.Position);
+	SerializeField(Ar, Value.Size);
+	SerializeField(Ar, Value.Alignment);
+	SerializeField(Ar, Value.bAutoSize);
+	SerializeField(Ar, Value.HorizontalAlignment);
+	SerializeField(Ar, Value.VerticalAlignment);
+	SerializeField(Ar, Value.SizeRule);
+	SerializeField(Ar, Value.FillWeight);
+	SerializeField(Ar, Value.Padding);
+}
+
+static void SerializeField(FArchive& Ar, FManifestWidgetNodeDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.bIsVariable);
+	SerializeField(Ar, Value.Slot);
+	SerializeField(Ar, Value.Properties);
+	SerializeField(Ar, Value.Children);
+	SerializeField(Ar, Value.Text);
+	SerializeField(Ar, Value.ImagePath);
+	SerializeField(Ar, Value.StyleClass);
+}
+
+static void SerializeField(FArchive& Ar, FManifestWidgetTreeDefinition& Value)
+{
+	SerializeField(Ar, Value.RootWidget);
+	SerializeField(Ar, Value.Widgets);
+}
+
+static void SerializeField(FArchive& Ar, FManifestWidgetBlueprintDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraphName);
+	SerializeField(Ar, Value.bHasInlineEventGraph);
+	SerializeField(Ar, Value.EventGraphNodes);
+	SerializeField(Ar, Value.EventGraphConnections);
+	SerializeField(Ar, Value.WidgetTree);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDispatcherParam& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+}
+
+static void SerializeField(FArchive& Ar, FManifestEventDispatcherDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Parameters);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFunctionParam& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFunctionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.InputParams);
+	SerializeField(Ar, Value.OutputParams);
+	SerializeField(Ar, Value.bPure);
+}
+
+static void SerializeField(FArchive& Ar, FManifestComponentBlueprintDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventDispatchers);
+	SerializeField(Ar, Value.Functions);
+	SerializeField(Ar, Value.bCanEverTick);
+	SerializeField(Ar, Value.bStartWithTickEnabled);
+	SerializeField(Ar, Value.TickInterval);
+	SerializeField(Ar, Value.bAutoActivate);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBlueprintConditionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.bNot);
+	SerializeField(Ar, Value.ConditionFilter);
+	SerializeField(Ar, Value.PartyConditionPolicy);
+	SerializeField(Ar, Value.CharacterTargets);
+	SerializeField(Ar, Value.NPCTargets);
+	SerializeField(Ar, Value.PlayerTargets);
+	SerializeField(Ar, Value.Properties);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraphName);
+	SerializeField(Ar, Value.bHasInlineEventGraph);
+	SerializeField(Ar, Value.EventGraphNodes);
+	SerializeField(Ar, Value.EventGraphConnections);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBlackboardKeyDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.bInstanceSynced);
+	SerializeField(Ar, Value.BaseClass);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBlackboardDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Keys);
+	SerializeField(Ar, Value.Parent);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBTDecoratorDefinition& Value)
+{
+	SerializeField(Ar, Value.Class);
+	SerializeField(Ar, Value.BlackboardKey);
+	SerializeField(Ar, Value.Operation);
+	SerializeField(Ar, Value.Properties);
+	SerializeField(Ar, Value.bInverseCondition);
+	SerializeField(Ar, Value.FlowAbortMode);
+	SerializeField(Ar, Value.NotifyObserver);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBTServiceDefinition& Value)
+{
+	SerializeField(Ar, Value.Class);
+	SerializeField(Ar, Value.Interval);
+	SerializeField(Ar, Value.Properties);
+	SerializeField(Ar, Value.RandomDeviation);
+	SerializeField(Ar, Value.bCallTickOnSearchStart);
+	SerializeField(Ar, Value.bRestartTimerOnActivation);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBTNodeDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.TaskClass);
+	SerializeField(Ar, Value.BlackboardKey);
+	SerializeField(Ar, Value.Children);
+	SerializeField(Ar, Value.Decorators);
+	SerializeField(Ar, Value.Services);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBehaviorTreeDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.BlackboardAsset);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.RootType);
+	SerializeField(Ar, Value.Nodes);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialExpression& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.DefaultValue);
+	SerializeField(Ar, Value.PosX);
+	SerializeField(Ar, Value.PosY);
+	SerializeField(Ar, Value.Properties);
+	SerializeField(Ar, Value.TexturePath);
+	SerializeField(Ar, Value.SamplerType);
+	SerializeField(Ar, Value.Inputs);
+	SerializeField(Ar, Value.Function);
+	SerializeField(Ar, Value.FunctionInputs);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialConnection& Value)
+{
+	SerializeField(Ar, Value.FromId);
+	SerializeField(Ar, Value.FromOutput);
+	SerializeField(Ar, Value.ToId);
+	SerializeField(Ar, Value.ToInput);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.BlendMode);
+	SerializeField(Ar, Value.ShadingModel);
+	SerializeField(Ar, Value.bTwoSided);
+	SerializeField(Ar, Value.Parameters);
+	SerializeField(Ar, Value.Expressions);
+	SerializeField(Ar, Value.Connections);
+	SerializeField(Ar, Value.MaterialDomain);
+	SerializeField(Ar, Value.CullMode);
+	SerializeField(Ar, Value.OpacityMaskClipValue);
+	SerializeField(Ar, Value.TranslucencyPass);
+	SerializeField(Ar, Value.bEnableSeparateTranslucency);
+	SerializeField(Ar, Value.bEnableResponsiveAA);
+	SerializeField(Ar, Value.DecalResponse);
+	SerializeField(Ar, Value.bCastDynamicShadow);
+	SerializeField(Ar, Value.bAffectDynamicIndirectLighting);
+	SerializeField(Ar, Value.bBlockGI);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceScalarParam& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Value);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceVectorParam& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Value);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceTextureParam& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.TexturePath);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialInstanceDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentMaterial);
+	SerializeField(Ar, Value.ScalarParams);
+	SerializeField(Ar, Value.VectorParams);
+	SerializeField(Ar, Value.TextureParams);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialFunctionInput& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.DefaultValue);
+	SerializeField(Ar, Value.SortPriority);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialFunctionOutput& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.SortPriority);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialFunctionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Description);
+	SerializeField(Ar, Value.bExposeToLibrary);
+	SerializeField(Ar, Value.Inputs);
+	SerializeField(Ar, Value.Outputs);
+	SerializeField(Ar, Value.Expressions);
+	SerializeField(Ar, Value.Connections);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFloatCurveKeyDefinition& Value)
+{
+	SerializeField(Ar, Value.Time);
+	SerializeField(Ar, Value.Value);
+	SerializeField(Ar, Value.InterpMode);
+	SerializeField(Ar, Value.TangentMode);
+	SerializeField(Ar, Value.ArriveTangent);
+	SerializeField(Ar, Value.LeaveTangent);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFloatCurveDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Keys);
+	SerializeField(Ar, Value.ExtrapolationBefore);
+	SerializeField(Ar, Value.ExtrapolationAfter);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAnimationMontageDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Skeleton);
+	SerializeField(Ar, Value.Sections);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAnimationNotifyDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.NotifyClass);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+	SerializeField(Ar, Value.InlineEventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueLineDefinition& Value)
+{
+	SerializeField(Ar, Value.Text);
+	SerializeField(Ar, Value.Audio);
+	SerializeField(Ar, Value.Montage);
+	SerializeField(Ar, Value.FacialAnimation);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueEventDefinition& Value)
+{
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Runtime);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueConditionDefinition& Value)
+{
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.bNot);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueNodeDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Speaker);
+	SerializeField(Ar, Value.Text);
+	SerializeField(Ar, Value.OptionText);
+	SerializeField(Ar, Value.HintText);
+	SerializeField(Ar, Value.Audio);
+	SerializeField(Ar, Value.Montage);
+	SerializeField(Ar, Value.FacialAnimation);
+	SerializeField(Ar, Value.Duration);
+	SerializeField(Ar, Value.DurationSeconds);
+	SerializeField(Ar, Value.bAutoSelect);
+	SerializeField(Ar, Value.bAutoSelectIfOnly);
+	SerializeField(Ar, Value.bIsSkippable);
+	SerializeField(Ar, Value.DirectedAt);
+	SerializeField(Ar, Value.NPCReplies);
+	SerializeField(Ar, Value.PlayerReplies);
+	SerializeField(Ar, Value.AlternativeLines);
+	SerializeField(Ar, Value.Events);
+	SerializeField(Ar, Value.Conditions);
+	SerializeField(Ar, Value.StartQuest);
+	SerializeField(Ar, Value.CompleteQuestBranch);
+	SerializeField(Ar, Value.FailQuest);
+	SerializeField(Ar, Value.OnPlayNodeFuncName);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueTreeDefinition& Value)
+{
+	SerializeField(Ar, Value.RootNodeId);
+	SerializeField(Ar, Value.Nodes);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueSpeakerDefinition& Value)
+{
+	SerializeField(Ar, Value.NPCDefinition);
+	SerializeField(Ar, Value.SpeakerID);
+	SerializeField(Ar, Value.NodeColor);
+	SerializeField(Ar, Value.OwnedTags);
+	SerializeField(Ar, Value.bIsPlayer);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPlayerSpeakerDefinition& Value)
+{
+	SerializeField(Ar, Value.SpeakerID);
+	SerializeField(Ar, Value.NodeColor);
+	SerializeField(Ar, Value.SelectingReplyShot);
+}
+
+static void SerializeField(FArchive& Ar, FManifestTransformDefinition& Value)
+{
+	SerializeField(Ar, Value.LocationX);
+	SerializeField(Ar, Value.LocationY);
+	SerializeField(Ar, Value.LocationZ);
+	SerializeField(Ar, Value.RotationPitch);
+	SerializeField(Ar, Value.RotationYaw);
+	SerializeField(Ar, Value.RotationRoll);
+	SerializeField(Ar, Value.ScaleX);
+	SerializeField(Ar, Value.ScaleY);
+	SerializeField(Ar, Value.ScaleZ);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueSequenceDefinition& Value)
+{
+	SerializeField(Ar, Value.SequenceClass);
+	SerializeField(Ar, Value.SequenceAssets);
+	SerializeField(Ar, Value.AnchorOriginRule);
+	SerializeField(Ar, Value.AnchorOriginNudgeX);
+	SerializeField(Ar, Value.AnchorOriginNudgeY);
+	SerializeField(Ar, Value.AnchorOriginNudgeZ);
+	SerializeField(Ar, Value.AnchorRotationRule);
+	SerializeField(Ar, Value.bUse180DegreeRule);
+	SerializeField(Ar, Value.UnitsY180DegreeRule);
+	SerializeField(Ar, Value.DegreesYaw180DegreeRule);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialogueBlueprintDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraphName);
+	SerializeField(Ar, Value.bFreeMovement);
+	SerializeField(Ar, Value.bUnskippable);
+	SerializeField(Ar, Value.bCanBeExited);
+	SerializeField(Ar, Value.bShowCinematicBars);
+	SerializeField(Ar, Value.bAutoRotateSpeakers);
+	SerializeField(Ar, Value.bAutoStopMovement);
+	SerializeField(Ar, Value.Priority);
+	SerializeField(Ar, Value.EndDialogueDist);
+	SerializeField(Ar, Value.DefaultHeadBoneName);
+	SerializeField(Ar, Value.DialogueBlendOutTime);
+	SerializeField(Ar, Value.bAdjustPlayerTransform);
+	SerializeField(Ar, Value.CameraShake);
+	SerializeField(Ar, Value.DialogueSoundAttenuation);
+	SerializeField(Ar, Value.PlayerAutoAdjustTransform);
+	SerializeField(Ar, Value.DefaultDialogueShot);
+	SerializeField(Ar, Value.Speakers);
+	SerializeField(Ar, Value.PlayerSpeaker);
+	SerializeField(Ar, Value.PartySpeakerInfo);
+	SerializeField(Ar, Value.DialogueTree);
+}
+
+static void SerializeField(FArchive& Ar, FManifestMaterialParamBinding& Value)
+{
+	SerializeField(Ar, Value.ParameterName);
+	SerializeField(Ar, Value.TagId);
+}
+
+static void SerializeField(FArchive& Ar, FManifestClothingMaterial& Value)
+{
+	SerializeField(Ar, Value.Material);
+	SerializeField(Ar, Value.VectorParams);
+	SerializeField(Ar, Value.ScalarParams);
+}
+
+static void SerializeField(FArchive& Ar, FManifestClothingMorph& Value)
+{
+	SerializeField(Ar, Value.ScalarTag);
+	SerializeField(Ar, Value.MorphNames);
+}
+
+static void SerializeField(FArchive& Ar, FManifestClothingMeshConfig& Value)
+{
+	SerializeField(Ar, Value.Mesh);
+	SerializeField(Ar, Value.bUseLeaderPose);
+	SerializeField(Ar, Value.bIsStaticMesh);
+	SerializeField(Ar, Value.StaticMesh);
+	SerializeField(Ar, Value.AttachSocket);
+	SerializeField(Ar, Value.AttachLocation);
+	SerializeField(Ar, Value.AttachRotation);
+	SerializeField(Ar, Value.AttachScale);
+	SerializeField(Ar, Value.MeshAnimBP);
+	SerializeField(Ar, Value.Materials);
+	SerializeField(Ar, Value.Morphs);
+}
+
+static void SerializeField(FArchive& Ar, FManifestWeaponAttachmentSlot& Value)
+{
+	SerializeField(Ar, Value.Slot);
+	SerializeField(Ar, Value.Socket);
+	SerializeField(Ar, Value.Offset);
+	SerializeField(Ar, Value.Rotation);
+}
+
+static void SerializeField(FArchive& Ar, FManifestWeaponAttachmentConfigEntry& Value)
+{
+	SerializeField(Ar, Value.Slot);
+	SerializeField(Ar, Value.SocketName);
+	SerializeField(Ar, Value.Location);
+	SerializeField(Ar, Value.Rotation);
+	SerializeField(Ar, Value.Scale);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPickupMeshDataDefinition& Value)
+{
+	SerializeField(Ar, Value.PickupMesh);
+	SerializeField(Ar, Value.PickupMeshMaterials);
+}
+
+static void SerializeField(FArchive& Ar, FManifestCombatTraceDataDefinition& Value)
+{
+	SerializeField(Ar, Value.TraceDistance);
+	SerializeField(Ar, Value.TraceRadius);
+	SerializeField(Ar, Value.bTraceMulti);
+}
+
+static void SerializeField(FArchive& Ar, FManifestItemStatDefinition& Value)
+{
+	SerializeField(Ar, Value.StatDisplayName);
+	SerializeField(Ar, Value.StringVariable);
+	SerializeField(Ar, Value.StatTooltip);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFragmentPropertyDefinition& Value)
+{
+	SerializeField(Ar, Value.Key);
+	SerializeField(Ar, Value.Value);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFragmentDefinition& Value)
+{
+	SerializeField(Ar, Value.Class);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestEquippableItemDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.DisplayName);
+	SerializeField(Ar, Value.Description);
+	SerializeField(Ar, Value.EquipmentSlot);
+	SerializeField(Ar, Value.EquipmentModifierGE);
+	SerializeField(Ar, Value.AbilitiesToGrant);
+	SerializeField(Ar, Value.AttackRating);
+	SerializeField(Ar, Value.ArmorRating);
+	SerializeField(Ar, Value.StealthRating);
+	SerializeField(Ar, Value.Thumbnail);
+	SerializeField(Ar, Value.Weight);
+	SerializeField(Ar, Value.BaseValue);
+	SerializeField(Ar, Value.BaseScore);
+	SerializeField(Ar, Value.ItemTags);
+	SerializeField(Ar, Value.bStackable);
+	SerializeField(Ar, Value.MaxStackSize);
+	SerializeField(Ar, Value.UseRechargeDuration);
+	SerializeField(Ar, Value.WeaponVisualClass);
+	SerializeField(Ar, Value.WeaponHand);
+	SerializeField(Ar, Value.WeaponAbilities);
+	SerializeField(Ar, Value.MainhandAbilities);
+	SerializeField(Ar, Value.OffhandAbilities);
+	SerializeField(Ar, Value.bPawnFollowsControlRotation);
+	SerializeField(Ar, Value.bPawnOrientsRotationToMovement);
+	SerializeField(Ar, Value.AttackDamage);
+	SerializeField(Ar, Value.HeavyAttackDamageMultiplier);
+	SerializeField(Ar, Value.bAllowManualReload);
+	SerializeField(Ar, Value.RequiredAmmo);
+	SerializeField(Ar, Value.bBotsConsumeAmmo);
+	SerializeField(Ar, Value.BotAttackRange);
+	SerializeField(Ar, Value.ClipSize);
+	SerializeField(Ar, Value.AimFOVPct);
+	SerializeField(Ar, Value.BaseSpreadDegrees);
+	SerializeField(Ar, Value.MaxSpreadDegrees);
+	SerializeField(Ar, Value.SpreadFireBump);
+	SerializeField(Ar, Value.SpreadDecreaseSpeed);
+	SerializeField(Ar, Value.CrosshairWidget);
+	SerializeField(Ar, Value.AimWeaponRenderFOV);
+	SerializeField(Ar, Value.AimWeaponFStop);
+	SerializeField(Ar, Value.MoveSpeedAddDegrees);
+	SerializeField(Ar, Value.CrouchSpreadMultiplier);
+	SerializeField(Ar, Value.AimSpreadMultiplier);
+	SerializeField(Ar, Value.RecoilImpulseTranslationMin);
+	SerializeField(Ar, Value.RecoilImpulseTranslationMax);
+	SerializeField(Ar, Value.HipRecoilImpulseTranslationMin);
+	SerializeField(Ar, Value.HipRecoilImpulseTranslationMax);
+	SerializeField(Ar, Value.WeaponAttachmentSlots);
+	SerializeField(Ar, Value.bAddDefaultUseOption);
+	SerializeField(Ar, Value.bConsumeOnUse);
+	SerializeField(Ar, Value.bUsedWithOtherItem);
+	SerializeField(Ar, Value.UseActionText);
+	SerializeField(Ar, Value.bCanActivate);
+	SerializeField(Ar, Value.bToggleActiveOnUse);
+	SerializeField(Ar, Value.UseSound);
+	SerializeField(Ar, Value.HolsterAttachmentSlots);
+	SerializeField(Ar, Value.HolsterAttachmentSockets);
+	SerializeField(Ar, Value.HolsterAttachmentOffsets);
+	SerializeField(Ar, Value.HolsterAttachmentRotations);
+	SerializeField(Ar, Value.WieldAttachmentSlots);
+	SerializeField(Ar, Value.WieldAttachmentSockets);
+	SerializeField(Ar, Value.WieldAttachmentOffsets);
+	SerializeField(Ar, Value.WieldAttachmentRotations);
+	SerializeField(Ar, Value.HolsterAttachmentConfigs);
+	SerializeField(Ar, Value.WieldAttachmentConfigs);
+	SerializeField(Ar, Value.ClothingMesh);
+	SerializeField(Ar, Value.EquipmentEffectValues);
+	SerializeField(Ar, Value.EquipmentAbilities);
+	SerializeField(Ar, Value.Stats);
+	SerializeField(Ar, Value.ActivitiesToGrant);
+	SerializeField(Ar, Value.ItemWidgetOverride);
+	SerializeField(Ar, Value.bWantsTickByDefault);
+	SerializeField(Ar, Value.PickupMeshData);
+	SerializeField(Ar, Value.TraceData);
+	SerializeField(Ar, Value.FunctionOverrides);
+	SerializeField(Ar, Value.Fragments);
+	SerializeField(Ar, Value.GameplayEffectClass);
+	SerializeField(Ar, Value.SetByCallerValues);
+	SerializeField(Ar, Value.WeaponAttachmentSlot);
+	SerializeField(Ar, Value.AttachmentMesh);
+	SerializeField(Ar, Value.FOVOverride);
+	SerializeField(Ar, Value.WeaponRenderFOVOverride);
+	SerializeField(Ar, Value.WeaponAimFStopOverride);
+}
+
+static void SerializeField(FArchive& Ar, FManifestActivityDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.BehaviorTree);
+	SerializeField(Ar, Value.Description);
+	SerializeField(Ar, Value.ActivityName);
+	SerializeField(Ar, Value.OwnedTags);
+	SerializeField(Ar, Value.BlockTags);
+	SerializeField(Ar, Value.RequireTags);
+	SerializeField(Ar, Value.SupportedGoalType);
+	SerializeField(Ar, Value.bIsInterruptable);
+	SerializeField(Ar, Value.bSaveActivity);
+	SerializeField(Ar, Value.AttackTaggedDialogue);
+	SerializeField(Ar, Value.WeaponTypes);
+	SerializeField(Ar, Value.FollowGoal);
+	SerializeField(Ar, Value.InteractSubGoal);
+	SerializeField(Ar, Value.BBKeyFollowDistance);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBlueprintTriggerDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.bIsActive);
+	SerializeField(Ar, Value.RequiredQuantity);
+	SerializeField(Ar, Value.DescriptionOverride);
+	SerializeField(Ar, Value.bOptional);
+	SerializeField(Ar, Value.bHidden);
+	SerializeField(Ar, Value.TickInterval);
+	SerializeField(Ar, Value.bAddNavigationMarker);
+	SerializeField(Ar, Value.bDrawBreadcrumbs);
+	SerializeField(Ar, Value.MarkerClass);
+	SerializeField(Ar, Value.NavigationMarkerIcon);
+	SerializeField(Ar, Value.MarkerColor);
+	SerializeField(Ar, Value.MarkerDisplayText);
+	SerializeField(Ar, Value.MarkerSubtitleText);
+	SerializeField(Ar, Value.MarkerLocation);
+	SerializeField(Ar, Value.GoalLoc);
+	SerializeField(Ar, Value.GoalLocationProvider);
+	SerializeField(Ar, Value.DistanceTolerance);
+	SerializeField(Ar, Value.FriendlyLocationName);
+	SerializeField(Ar, Value.bInvert);
+	SerializeField(Ar, Value.TimeStart);
+	SerializeField(Ar, Value.TimeEnd);
+	SerializeField(Ar, Value.NPCsToFollow);
+	SerializeField(Ar, Value.GoalRotation);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestAbilityConfigurationDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Abilities);
+	SerializeField(Ar, Value.StartupEffects);
+	SerializeField(Ar, Value.DefaultAttributes);
+}
+
+static void SerializeField(FArchive& Ar, FManifestActivityConfigurationDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.RescoreInterval);
+	SerializeField(Ar, Value.DefaultActivity);
+	SerializeField(Ar, Value.Activities);
+	SerializeField(Ar, Value.GoalGenerators);
+}
+
+static void SerializeField(FArchive& Ar, FManifestItemWithQuantity& Value)
+{
+	SerializeField(Ar, Value.ItemClass);
+	SerializeField(Ar, Value.Quantity);
+}
+
+static void SerializeField(FArchive& Ar, FManifestItemCollectionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Items);
+	SerializeField(Ar, Value.ItemsWithQuantity);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNarrativeEventDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.EventTag);
+	SerializeField(Ar, Value.EventType);
+	SerializeField(Ar, Value.Description);
+	SerializeField(Ar, Value.EventRuntime);
+	SerializeField(Ar, Value.EventFilter);
+	SerializeField(Ar, Value.PartyEventPolicy);
+	SerializeField(Ar, Value.bRefireOnLoad);
+	SerializeField(Ar, Value.NPCTargets);
+	SerializeField(Ar, Value.CharacterTargets);
+	SerializeField(Ar, Value.PlayerTargets);
+	SerializeField(Ar, Value.Properties);
+	SerializeField(Ar, Value.Conditions);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestItemWithQuantityDefinition& Value)
+{
+	SerializeField(Ar, Value.Item);
+	SerializeField(Ar, Value.Quantity);
+}
+
+static void SerializeField(FArchive& Ar, FManifestLootTableRollDefinition& Value)
+{
+	SerializeField(Ar, Value.ItemsToGrant);
+	SerializeField(Ar, Value.ItemCollectionsToGrant);
+	SerializeField(Ar, Value.TableToRoll);
+	SerializeField(Ar, Value.NumRolls);
+	SerializeField(Ar, Value.Chance);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNPCDefinitionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.NPCID);
+	SerializeField(Ar, Value.NPCName);
+	SerializeField(Ar, Value.NPCClassPath);
+	SerializeField(Ar, Value.AbilityConfiguration);
+	SerializeField(Ar, Value.ActivityConfiguration);
+	SerializeField(Ar, Value.MinLevel);
+	SerializeField(Ar, Value.MaxLevel);
+	SerializeField(Ar, Value.bAllowMultipleInstances);
+	SerializeField(Ar, Value.bIsVendor);
+	SerializeField(Ar, Value.UniqueNPCGUID);
+	SerializeField(Ar, Value.TriggerSets);
+	SerializeField(Ar, Value.Dialogue);
+	SerializeField(Ar, Value.TaggedDialogueSet);
+	SerializeField(Ar, Value.TradingCurrency);
+	SerializeField(Ar, Value.BuyItemPercentage);
+	SerializeField(Ar, Value.SellItemPercentage);
+	SerializeField(Ar, Value.ShopFriendlyName);
+	SerializeField(Ar, Value.DefaultAppearance);
+	SerializeField(Ar, Value.DefaultCurrency);
+	SerializeField(Ar, Value.DefaultOwnedTags);
+	SerializeField(Ar, Value.DefaultFactions);
+	SerializeField(Ar, Value.AttackPriority);
+	SerializeField(Ar, Value.ActivitySchedules);
+	SerializeField(Ar, Value.bAutoCreateDialogue);
+	SerializeField(Ar, Value.bAutoCreateTaggedDialogue);
+	SerializeField(Ar, Value.bAutoCreateItemLoadout);
+	SerializeField(Ar, Value.DefaultItemLoadoutCollections);
+	SerializeField(Ar, Value.DefaultItemLoadout);
+	SerializeField(Ar, Value.TradingItemLoadout);
+}
+
+static void SerializeField(FArchive& Ar, FManifestCharacterDefinitionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.DefaultOwnedTags);
+	SerializeField(Ar, Value.DefaultFactions);
+	SerializeField(Ar, Value.DefaultCurrency);
+	SerializeField(Ar, Value.AttackPriority);
+	SerializeField(Ar, Value.DefaultAppearance);
+	SerializeField(Ar, Value.TriggerSets);
+	SerializeField(Ar, Value.AbilityConfiguration);
+	SerializeField(Ar, Value.DefaultItemLoadout);
+}
+
+static void SerializeField(FArchive& Ar, FManifestCharacterAppearanceDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Meshes);
+	SerializeField(Ar, Value.ScalarValues);
+	SerializeField(Ar, Value.VectorValues);
+}
+
+static void SerializeField(FArchive& Ar, FManifestTaggedDialogueEntry& Value)
+{
+	SerializeField(Ar, Value.Tag);
+	SerializeField(Ar, Value.DialogueClass);
+	SerializeField(Ar, Value.Cooldown);
+	SerializeField(Ar, Value.MaxDistance);
+	SerializeField(Ar, Value.RequiredTags);
+	SerializeField(Ar, Value.BlockedTags);
+}
+
+static void SerializeField(FArchive& Ar, FManifestTaggedDialogueSetDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Dialogues);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNiagaraUserParameter& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.DefaultValue);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNiagaraEmitterOverride& Value)
+{
+	SerializeField(Ar, Value.EmitterName);
+	SerializeField(Ar, Value.bEnabled);
+	SerializeField(Ar, Value.bHasEnabled);
+	SerializeField(Ar, Value.bStructuralEnabled);
+	SerializeField(Ar, Value.bHasStructuralEnabled);
+	SerializeField(Ar, Value.Parameters);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFXDescriptor& Value)
+{
+	SerializeField(Ar, Value.bParticlesEnabled);
+	SerializeField(Ar, Value.bBurstEnabled);
+	SerializeField(Ar, Value.bBeamEnabled);
+	SerializeField(Ar, Value.bRibbonEnabled);
+	SerializeField(Ar, Value.bLightEnabled);
+	SerializeField(Ar, Value.bSmokeEnabled);
+	SerializeField(Ar, Value.bSparkEnabled);
+	SerializeField(Ar, Value.SpawnRate);
+	SerializeField(Ar, Value.LifetimeMin);
+	SerializeField(Ar, Value.LifetimeMax);
+	SerializeField(Ar, Value.MaxParticles);
+	SerializeField(Ar, Value.Color);
+	SerializeField(Ar, Value.SizeMin);
+	SerializeField(Ar, Value.SizeMax);
+	SerializeField(Ar, Value.Opacity);
+	SerializeField(Ar, Value.Emissive);
+	SerializeField(Ar, Value.InitialVelocity);
+	SerializeField(Ar, Value.NoiseStrength);
+	SerializeField(Ar, Value.GravityScale);
+	SerializeField(Ar, Value.BeamLength);
+	SerializeField(Ar, Value.BeamWidth);
+	SerializeField(Ar, Value.RibbonWidth);
+	SerializeField(Ar, Value.LightIntensity);
+	SerializeField(Ar, Value.LightRadius);
+	SerializeField(Ar, Value.CullDistance);
+	SerializeField(Ar, Value.LODLevel);
+}
+
+static void SerializeField(FArchive& Ar, FManifestFXPresetDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Parameters);
+	SerializeField(Ar, Value.BasePreset);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNiagaraSystemDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.TemplateSystem);
+	SerializeField(Ar, Value.Emitters);
+	SerializeField(Ar, Value.WarmupTime);
+	SerializeField(Ar, Value.WarmupTickCount);
+	SerializeField(Ar, Value.WarmupTickDelta);
+	SerializeField(Ar, Value.bFixedBounds);
+	SerializeField(Ar, Value.BoundsMin);
+	SerializeField(Ar, Value.BoundsMax);
+	SerializeField(Ar, Value.bDeterminism);
+	SerializeField(Ar, Value.RandomSeed);
+	SerializeField(Ar, Value.EffectType);
+	SerializeField(Ar, Value.PoolingMethod);
+	SerializeField(Ar, Value.MaxPoolSize);
+	SerializeField(Ar, Value.UserParameters);
+	SerializeField(Ar, Value.FXDescriptor);
+	SerializeField(Ar, Value.Preset);
+	SerializeField(Ar, Value.EmitterOverrides);
+	SerializeField(Ar, Value.CullDistanceLow);
+	SerializeField(Ar, Value.CullDistanceMedium);
+	SerializeField(Ar, Value.CullDistanceHigh);
+	SerializeField(Ar, Value.CullDistanceEpic);
+	SerializeField(Ar, Value.CullDistanceCinematic);
+	SerializeField(Ar, Value.CullMaxDistance);
+	SerializeField(Ar, Value.SignificanceDistance);
+	SerializeField(Ar, Value.MaxParticleBudget);
+	SerializeField(Ar, Value.ScalabilityMode);
+	SerializeField(Ar, Value.bAllowCullingForLocalPlayers);
+}
+
+static void SerializeField(FArchive& Ar, FManifestScheduledBehaviorDefinition& Value)
+{
+	SerializeField(Ar, Value.StartTime);
+	SerializeField(Ar, Value.EndTime);
+	SerializeField(Ar, Value.GoalClass);
+	SerializeField(Ar, Value.ScoreOverride);
+	SerializeField(Ar, Value.bReselect);
+	SerializeField(Ar, Value.Location);
+}
+
+static void SerializeField(FArchive& Ar, FManifestActivityScheduleDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Behaviors);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGoalItemDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.DefaultScore);
+	SerializeField(Ar, Value.GoalLifetime);
+	SerializeField(Ar, Value.bRemoveOnSucceeded);
+	SerializeField(Ar, Value.bSaveGoal);
+	SerializeField(Ar, Value.OwnedTags);
+	SerializeField(Ar, Value.BlockTags);
+	SerializeField(Ar, Value.RequireTags);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGoalGeneratorDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.bSaveGoalGenerator);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestSpawnConditionOverride& Value)
+{
+	SerializeField(Ar, Value.LocallyControlledSource);
+	SerializeField(Ar, Value.LocallyControlledPolicy);
+	SerializeField(Ar, Value.ChanceToPlay);
+	SerializeField(Ar, Value.AllowedSurfaceTypes);
+	SerializeField(Ar, Value.RejectedSurfaceTypes);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPlacementInfoOverride& Value)
+{
+	SerializeField(Ar, Value.SocketName);
+	SerializeField(Ar, Value.AttachPolicy);
+	SerializeField(Ar, Value.AttachmentRule);
+	SerializeField(Ar, Value.RotationOverride);
+	SerializeField(Ar, Value.ScaleOverride);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBurstParticleEffect& Value)
+{
+	SerializeField(Ar, Value.NiagaraSystem);
+	SerializeField(Ar, Value.bCastShadow);
+	SerializeField(Ar, Value.SpawnCondition);
+	SerializeField(Ar, Value.Placement);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBurstSoundEffect& Value)
+{
+	SerializeField(Ar, Value.Sound);
+	SerializeField(Ar, Value.VolumeMultiplier);
+	SerializeField(Ar, Value.PitchMultiplier);
+	SerializeField(Ar, Value.SpawnCondition);
+	SerializeField(Ar, Value.Placement);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBurstCameraShake& Value)
+{
+	SerializeField(Ar, Value.CameraShakeClass);
+	SerializeField(Ar, Value.ShakeScale);
+	SerializeField(Ar, Value.PlaySpace);
+	SerializeField(Ar, Value.bPlayInWorld);
+	SerializeField(Ar, Value.WorldInnerRadius);
+	SerializeField(Ar, Value.WorldOuterRadius);
+	SerializeField(Ar, Value.WorldFalloffExponent);
+	SerializeField(Ar, Value.SpawnCondition);
+	SerializeField(Ar, Value.Placement);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBurstCameraLensEffect& Value)
+{
+	SerializeField(Ar, Value.CameraLensEffectClass);
+	SerializeField(Ar, Value.bPlayInWorld);
+	SerializeField(Ar, Value.WorldInnerRadius);
+	SerializeField(Ar, Value.WorldOuterRadius);
+	SerializeField(Ar, Value.SpawnCondition);
+	SerializeField(Ar, Value.Placement);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBurstForceFeedback& Value)
+{
+	SerializeField(Ar, Value.ForceFeedbackEffect);
+	SerializeField(Ar, Value.ForceFeedbackTag);
+	SerializeField(Ar, Value.bIsLooping);
+	SerializeField(Ar, Value.bPlayInWorld);
+	SerializeField(Ar, Value.WorldIntensity);
+	SerializeField(Ar, Value.WorldAttenuation);
+	SerializeField(Ar, Value.SpawnCondition);
+	SerializeField(Ar, Value.Placement);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBurstDecal& Value)
+{
+	SerializeField(Ar, Value.DecalMaterial);
+	SerializeField(Ar, Value.DecalSize);
+	SerializeField(Ar, Value.bOverrideFadeOut);
+	SerializeField(Ar, Value.FadeOutStartDelay);
+	SerializeField(Ar, Value.FadeOutDuration);
+	SerializeField(Ar, Value.SpawnCondition);
+	SerializeField(Ar, Value.Placement);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGCNEffects& Value)
+{
+	SerializeField(Ar, Value.BurstParticles);
+	SerializeField(Ar, Value.BurstSounds);
+	SerializeField(Ar, Value.BurstCameraShake);
+	SerializeField(Ar, Value.BurstCameraLensEffect);
+	SerializeField(Ar, Value.BurstForceFeedback);
+	SerializeField(Ar, Value.BurstDecal);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGCNDefaults& Value)
+{
+	SerializeField(Ar, Value.DefaultSpawnCondition);
+	SerializeField(Ar, Value.DefaultPlacementInfo);
+}
+
+static void SerializeField(FArchive& Ar, FManifestCueFunctionDefinition& Value)
+{
+	SerializeField(Ar, Value.FunctionName);
+	SerializeField(Ar, Value.Replicates);
+	SerializeField(Ar, Value.bReliable);
+	SerializeField(Ar, Value.Inputs);
+	SerializeField(Ar, Value.Outputs);
+}
+
+static void SerializeField(FArchive& Ar, FManifestGameplayCueDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.GameplayCueTag);
+	SerializeField(Ar, Value.bAutoAttachToOwner);
+	SerializeField(Ar, Value.bIsOverride);
+	SerializeField(Ar, Value.bUniqueInstancePerInstigator);
+	SerializeField(Ar, Value.bUniqueInstancePerSourceObject);
+	SerializeField(Ar, Value.bAllowMultipleOnBurstEvents);
+	SerializeField(Ar, Value.bAllowMultipleOnBecomeRelevantEvents);
+	SerializeField(Ar, Value.NumPreallocatedInstances);
+	SerializeField(Ar, Value.bAutoDestroyOnRemove);
+	SerializeField(Ar, Value.AutoDestroyDelay);
+	SerializeField(Ar, Value.bActorHiddenInGame);
+	SerializeField(Ar, Value.InitialLifeSpan);
+	SerializeField(Ar, Value.GCNDefaults);
+	SerializeField(Ar, Value.GCNEffects);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.Functions);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestQuestRequirementDefinition& Value)
+{
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestQuestTaskDefinition& Value)
+{
+	SerializeField(Ar, Value.TaskClass);
+	SerializeField(Ar, Value.Argument);
+	SerializeField(Ar, Value.Quantity);
+	SerializeField(Ar, Value.bOptional);
+	SerializeField(Ar, Value.bHidden);
+}
+
+static void SerializeField(FArchive& Ar, FManifestQuestBranchDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.DestinationState);
+	SerializeField(Ar, Value.Tasks);
+	SerializeField(Ar, Value.Events);
+	SerializeField(Ar, Value.bHidden);
+	SerializeField(Ar, Value.OnEnteredFuncName);
+}
+
+static void SerializeField(FArchive& Ar, FManifestQuestStateDefinition& Value)
+{
+	SerializeField(Ar, Value.Id);
+	SerializeField(Ar, Value.Description);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Branches);
+	SerializeField(Ar, Value.Events);
+	SerializeField(Ar, Value.OnEnteredFuncName);
+}
+
+static void SerializeField(FArchive& Ar, FManifestDialoguePlayParamsDefinition& Value)
+{
+	SerializeField(Ar, Value.StartFromID);
+	SerializeField(Ar, Value.Priority);
+	SerializeField(Ar, Value.bOverride_bFreeMovement);
+	SerializeField(Ar, Value.bFreeMovement);
+	SerializeField(Ar, Value.bOverride_bStopMovement);
+	SerializeField(Ar, Value.bStopMovement);
+	SerializeField(Ar, Value.bOverride_bUnskippable);
+	SerializeField(Ar, Value.bUnskippable);
+	SerializeField(Ar, Value.bOverride_bCanBeExited);
+	SerializeField(Ar, Value.bCanBeExited);
+}
+
+static void SerializeField(FArchive& Ar, FManifestQuestRewardDefinition& Value)
+{
+	SerializeField(Ar, Value.Currency);
+	SerializeField(Ar, Value.XP);
+	SerializeField(Ar, Value.Items);
+	SerializeField(Ar, Value.ItemQuantities);
+}
+
+static void SerializeField(FArchive& Ar, FManifestQuestDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.QuestName);
+	SerializeField(Ar, Value.QuestDescription);
+	SerializeField(Ar, Value.bTracked);
+	SerializeField(Ar, Value.Dialogue);
+	SerializeField(Ar, Value.StartState);
+	SerializeField(Ar, Value.bHidden);
+	SerializeField(Ar, Value.bResumeDialogueAfterLoad);
+	SerializeField(Ar, Value.DialoguePlayParams);
+	SerializeField(Ar, Value.Questgiver);
+	SerializeField(Ar, Value.Rewards);
+	SerializeField(Ar, Value.Requirements);
+	SerializeField(Ar, Value.States);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPipelineConfig& Value)
+{
+	SerializeField(Ar, Value.DefaultFolder);
+	SerializeField(Ar, Value.bAutoCreateCollections);
+	SerializeField(Ar, Value.bAutoCreateLoadouts);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPipelineItemDefinition& Value)
+{
+	SerializeField(Ar, Value.Mesh);
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Type);
+	SerializeField(Ar, Value.Slot);
+	SerializeField(Ar, Value.DisplayName);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ClothingMesh);
+	SerializeField(Ar, Value.Stats);
+	SerializeField(Ar, Value.TargetCollection);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPipelineCollectionDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Items);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPipelineLoadoutDefinition& Value)
+{
+	SerializeField(Ar, Value.NPCDefinition);
+	SerializeField(Ar, Value.Collections);
+}
+
+static void SerializeField(FArchive& Ar, FManifestPOIPlacement& Value)
+{
+	SerializeField(Ar, Value.POITag);
+	SerializeField(Ar, Value.Location);
+	SerializeField(Ar, Value.Rotation);
+	SerializeField(Ar, Value.DisplayName);
+	SerializeField(Ar, Value.bCreateMapMarker);
+	SerializeField(Ar, Value.bSupportsFastTravel);
+	SerializeField(Ar, Value.MapIcon);
+	SerializeField(Ar, Value.LinkedPOIs);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNPCSpawnParams& Value)
+{
+	SerializeField(Ar, Value.bOverrideLevelRange);
+	SerializeField(Ar, Value.MinLevel);
+	SerializeField(Ar, Value.MaxLevel);
+	SerializeField(Ar, Value.bOverrideOwnedTags);
+	SerializeField(Ar, Value.DefaultOwnedTags);
+	SerializeField(Ar, Value.bOverrideFactions);
+	SerializeField(Ar, Value.DefaultFactions);
+	SerializeField(Ar, Value.bOverrideActivityConfiguration);
+	SerializeField(Ar, Value.ActivityConfiguration);
+	SerializeField(Ar, Value.bOverrideAppearance);
+	SerializeField(Ar, Value.DefaultAppearance);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNPCSpawnEntry& Value)
+{
+	SerializeField(Ar, Value.NPCDefinition);
+	SerializeField(Ar, Value.RelativeLocation);
+	SerializeField(Ar, Value.RelativeRotation);
+	SerializeField(Ar, Value.SpawnParams);
+	SerializeField(Ar, Value.bDontSpawnIfKilled);
+	SerializeField(Ar, Value.OptionalGoal);
+	SerializeField(Ar, Value.UntetherDistance);
+}
+
+static void SerializeField(FArchive& Ar, FManifestNPCSpawnerPlacement& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Location);
+	SerializeField(Ar, Value.Rotation);
+	SerializeField(Ar, Value.NearPOI);
+	SerializeField(Ar, Value.POIOffset);
+	SerializeField(Ar, Value.bActivateOnBeginPlay);
+	SerializeField(Ar, Value.ActivationEvent);
+	SerializeField(Ar, Value.DeactivationEvent);
+	SerializeField(Ar, Value.NPCs);
+}
+
+static void SerializeField(FArchive& Ar, FManifestTriggerEventDefinition& Value)
+{
+	SerializeField(Ar, Value.EventClass);
+	SerializeField(Ar, Value.Runtime);
+	SerializeField(Ar, Value.Properties);
+}
+
+static void SerializeField(FArchive& Ar, FManifestTriggerDefinition& Value)
+{
+	SerializeField(Ar, Value.TriggerClass);
+	SerializeField(Ar, Value.StartTime);
+	SerializeField(Ar, Value.EndTime);
+	SerializeField(Ar, Value.Events);
+}
+
+static void SerializeField(FArchive& Ar, FManifestTriggerSetDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.Triggers);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBTServiceBPDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.Interval);
+	SerializeField(Ar, Value.RandomDeviation);
+	SerializeField(Ar, Value.bCallTickOnSearchStart);
+	SerializeField(Ar, Value.bRestartTimerOnEachActivation);
+	SerializeField(Ar, Value.CustomDescription);
+	SerializeField(Ar, Value.NodeName);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestBTTaskBPDefinition& Value)
+{
+	SerializeField(Ar, Value.Name);
+	SerializeField(Ar, Value.Folder);
+	SerializeField(Ar, Value.ParentClass);
+	SerializeField(Ar, Value.TickInterval);
+	SerializeField(Ar, Value.bIgnoreRestartSelf);
+	SerializeField(Ar, Value.CustomDescription);
+	SerializeField(Ar, Value.NodeName);
+	SerializeField(Ar, Value.Variables);
+	SerializeField(Ar, Value.EventGraph);
+}
+
+static void SerializeField(FArchive& Ar, FManifestData& Value)
+{
+	SerializeField(Ar, Value.ProjectRoot);
+	SerializeField(Ar, Value.TagsIniPath);
+	SerializeField(Ar, Value.Tags);
+	SerializeField(Ar, Value.Enumerations);
+	SerializeField(Ar, Value.InputActions);
+	SerializeField(Ar, Value.InputMappingContexts);
+	SerializeField(Ar, Value.GameplayEffects);
+	SerializeField(Ar, Value.GameplayAbilities);
+	SerializeField(Ar, Value.ActorBlueprints);
+	SerializeField(Ar, Value.WidgetBlueprints);
+	SerializeField(Ar, Value.Blackboards);
+	SerializeField(Ar, Value.BehaviorTrees);
+	SerializeField(Ar, Value.Materials);
+	SerializeField(Ar, Value.MaterialInstances);
+	SerializeField(Ar, Value.EventGraphs);
+	SerializeField(Ar, Value.FloatCurves);
+	SerializeField(Ar, Value.AnimationMontages);
+	SerializeField(Ar, Value.AnimationNotifies);
+	SerializeField(Ar, Value.DialogueBlueprints);
+	SerializeField(Ar, Value.EquippableItems);
+	SerializeField(Ar, Value.ConsumableItems);
+	SerializeField(Ar, Value.AmmoItems);
+	SerializeField(Ar, Value.WeaponAttachments);
+	SerializeField(Ar, Value.Activities);
+	SerializeField(Ar, Value.BlueprintTriggers);
+	SerializeField(Ar, Value.AbilityConfigurations);
+	SerializeField(Ar, Value.ActivityConfigurations);
+	SerializeField(Ar, Value.ItemCollections);
+	SerializeField(Ar, Value.NarrativeEvents);
+	SerializeField(Ar, Value.NPCDefinitions);
+	SerializeField(Ar, Value.CharacterDefinitions);
+	SerializeField(Ar, Value.TaggedDialogueSets);
+	SerializeField(Ar, Value.NiagaraSystems);
+	SerializeField(Ar, Value.FXPresets);
+	SerializeField(Ar, Value.MaterialFunctions);
+	SerializeField(Ar, Value.ActivitySchedules);
+	SerializeField(Ar, Value.GoalItems);
+	SerializeField(Ar, Value.GoalGenerators);
+	SerializeField(Ar, Value.Quests);
+	SerializeField(Ar, Value.GameplayCues);
+	SerializeField(Ar, Value.BTServices);
+	SerializeField(Ar, Value.BTTasks);
+	SerializeField(Ar, Value.CharacterAppearances);
+	SerializeField(Ar, Value.TriggerSets);
+	SerializeField(Ar, Value.ComponentBlueprints);
+	SerializeField(Ar, Value.BlueprintConditions);
+	SerializeField(Ar, Value.FormStateEffects);
+	SerializeField(Ar, Value.PipelineConfig);
+	SerializeField(Ar, Value.PipelineItems);
+	SerializeField(Ar, Value.PipelineCollections);
+	SerializeField(Ar, Value.PipelineLoadouts);
+	SerializeField(Ar, Value.POIPlacements);
+	SerializeField(Ar, Value.NPCSpawnerPlacements);
+	SerializeField(Ar, Value.SourceLineNumbers);
+}
+
+// ============================================================================
+// FManifestParseCache entry points
+// ============================================================================
+
+// Any change to the bytes written below (fields added, removed, reordered or retyped anywhere in this
+// file) must bump FManifestParseCache::CacheFileVersion - nothing else invalidates old cache files
+void FManifestParseCache::SerializeManifestData(FArchive& Ar, FManifestData& Data)
+{
+	SerializeField(Ar, Data);
+
+	// Transient lookup cache - rebuilt on first use
+	if (Ar.IsLoading())
+	{
+		Data.AssetWhitelist.Reset();
+		Data.bWhitelistBuilt = false;
+	}
+}
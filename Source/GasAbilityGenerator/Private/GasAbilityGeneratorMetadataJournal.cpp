@@ -0,0 +1,192 @@
+// GasAbilityGenerator v7.8.84 - Metadata registry write-ahead journal
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.76: Append-only journal of registry record changes, replayed after an interrupted run
+// v7.8.84: Replay counts the journal's entries once until the registry is compacted
+
+#include "GasAbilityGeneratorMetadataJournal.h"
+#include "Locked/GasAbilityGeneratorMetadata.h"
+#include "JsonObjectConverter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGeneratorMetadataJournal, Log, All);
+
+namespace MetadataJournal
+{
+	static const TCHAR* Header = TEXT("GASGEN_METADATA_JOURNAL");
+	static constexpr int32 FormatVersion = 1;
+}
+
+FGeneratorMetadataJournal& FGeneratorMetadataJournal::Get()
+{
+	static FGeneratorMetadataJournal Instance;
+	return Instance;
+}
+
+FString FGeneratorMetadataJournal::GetJournalPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("GasAbilityGenerator/Journal/MetadataRegistry.journal");
+}
+
+void FGeneratorMetadataJournal::RecordSet(const FString& RegistryPackage, const FString& AssetPath, const FGeneratorMetadataRecord& Record)
+{
+	FString RecordJson;
+	FJsonObjectConverter::UStructToJsonObjectString(Record, RecordJson, 0, 0, 0, nullptr, false);
+	AppendLine(RegistryPackage, FString::Printf(TEXT("S\t%lld\t%s\t%s"), FDateTime::UtcNow().GetTicks(), *AssetPath, *RecordJson));
+}
+
+void FGeneratorMetadataJournal::RecordRemove(const FString& RegistryPackage, const FString& AssetPath)
+{
+	AppendLine(RegistryPackage, FString::Printf(TEXT("R\t%lld\t%s"), FDateTime::UtcNow().GetTicks(), *AssetPath));
+}
+
+void FGeneratorMetadataJournal::RecordClear(const FString& RegistryPackage)
+{
+	AppendLine(RegistryPackage, FString::Printf(TEXT("C\t%lld"), FDateTime::UtcNow().GetTicks()));
+}
+
+void FGeneratorMetadataJournal::AppendLine(const FString& RegistryPackage, const FString& Line)
+{
+	FScopeLock ScopeLock(&Lock);
+	UncompactedCount++;
+
+	if (!Writer.IsValid())
+	{
+		const FString JournalPath = GetJournalPath();
+		const bool bNewFile = IFileManager::Get().FileSize(*JournalPath) <= 0;
+		Writer.Reset(IFileManager::Get().CreateFileWriter(*JournalPath, FILEWRITE_Append | FILEWRITE_AllowRead));
+		if (!Writer.IsValid())
+		{
+			// The registry save at the end of the run still persists the change - only crash recovery is lost
+			UE_LOG(LogGeneratorMetadataJournal, Warning, TEXT("Could not open metadata journal %s"), *JournalPath);
+			return;
+		}
+		if (bNewFile)
+		{
+			const FTCHARToUTF8 HeaderUtf8(*FString::Printf(TEXT("%s\t%d\t%s\n"), MetadataJournal::Header, MetadataJournal::FormatVersion, *RegistryPackage));
+			Writer->Serialize(const_cast<ANSICHAR*>(HeaderUtf8.Get()), HeaderUtf8.Length());
+		}
+	}
+
+	const FTCHARToUTF8 LineUtf8(*(Line + TEXT("\n")));
+	Writer->Serialize(const_cast<ANSICHAR*>(LineUtf8.Get()), LineUtf8.Length());
+
+	// Hand the line to the OS now - a killed process keeps everything appended so far
+	Writer->Flush();
+}
+
+int32 FGeneratorMetadataJournal::Replay(UGeneratorMetadataRegistry& Registry)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const FString JournalPath = GetJournalPath();
+	if (Writer.IsValid() || !IFileManager::Get().FileExists(*JournalPath))
+	{
+		// Either nothing to recover, or this session's own journal (already in memory)
+		return 0;
+	}
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *JournalPath) || Lines.Num() == 0)
+	{
+		return 0;
+	}
+
+	TArray<FString> HeaderFields;
+	Lines[0].ParseIntoArray(HeaderFields, TEXT("\t"), false);
+	const FString RegistryPackage = Registry.GetOutermost()->GetName();
+	if (HeaderFields.Num() < 3 || HeaderFields[0] != MetadataJournal::Header ||
+		FCString::Atoi(*HeaderFields[1]) != MetadataJournal::FormatVersion || HeaderFields[2] != RegistryPackage)
+	{
+		UE_LOG(LogGeneratorMetadataJournal, Warning, TEXT("Ignoring metadata journal %s (other format or registry)"), *JournalPath);
+		return 0;
+	}
+
+	int32 Applied = 0;
+	int32 Rejected = 0;
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		TArray<FString> Fields;
+		Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false);
+		if (Fields.Num() < 2)
+		{
+			continue;   // Torn final line of a killed run
+		}
+		const FDateTime EntryTime(FCString::Atoi64(*Fields[1]));
+
+		if (Fields[0] == TEXT("C"))
+		{
+			Registry.Records.Empty();
+			Applied++;
+		}
+		else if (Fields[0] == TEXT("R") && Fields.Num() >= 3)
+		{
+			Registry.Records.Remove(Fields[2]);
+			Applied++;
+		}
+		else if (Fields[0] == TEXT("S") && Fields.Num() >= 4)
+		{
+			FGeneratorMetadataRecord Record;
+			if (!FJsonObjectConverter::JsonObjectStringToUStruct(Fields[3], &Record, 0, 0))
+			{
+				continue;
+			}
+
+			// Disk truth: the package must have been written after the record was set
+			FString FilePath;
+			FFileStatData Stat;
+			if (FPackageName::TryConvertLongPackageNameToFilename(Fields[2], FilePath, FPackageName::GetAssetPackageExtension()))
+			{
+				Stat = IFileManager::Get().GetStatData(*FilePath);
+			}
+			if (!Stat.bIsValid || Stat.bIsDirectory || Stat.ModificationTime < EntryTime)
+			{
+				Rejected++;
+				continue;
+			}
+
+			Record.PackageFileSize = 0;
+			Record.PackageFileTime = FDateTime();
+			Registry.Records.Add(Fields[2], Record);
+			Applied++;
+		}
+	}
+
+	// A registry reloaded after GC replays the same file into its fresh object - count the entries once
+	if (bReplayed)
+	{
+		UE_LOG(LogGeneratorMetadataJournal, Log, TEXT("Re-applied %d recovered metadata change(s) to the reloaded registry"), Applied);
+		return Applied;
+	}
+	bReplayed = true;
+	UncompactedCount += Applied;
+	UE_LOG(LogGeneratorMetadataJournal, Display,
+		TEXT("Recovered %d metadata change(s) from an interrupted run (%d dropped - package not saved)"), Applied, Rejected);
+	return Applied;
+}
+
+bool FGeneratorMetadataJournal::HasUncompactedChanges() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return UncompactedCount > 0;
+}
+
+void FGeneratorMetadataJournal::Compacted()
+{
+	FScopeLock ScopeLock(&Lock);
+	CloseWriter();
+	IFileManager::Get().Delete(*GetJournalPath(), false, false, true);
+	UncompactedCount = 0;
+	bReplayed = false;
+}
+
+void FGeneratorMetadataJournal::CloseWriter()
+{
+	if (Writer.IsValid())
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+}
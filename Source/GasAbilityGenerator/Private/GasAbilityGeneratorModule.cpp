@@ -1,5 +1,6 @@
-// GasAbilityGenerator v4.8
+// GasAbilityGenerator v7.8.84
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.84: ShutdownModule unbinds the asset index's Asset Registry events and the function resolver's compile hook
 // v4.8: Added Quest Table Editor and Item Table Editor (following NPC/Dialogue patterns)
 // v4.1: Added Dialogue Table Editor - batch dialogue creation from CSV
 // v3.10.0: Added NPC Table Editor - Excel-like spreadsheet for managing NPCs
@@ -10,6 +11,8 @@
 #include "QuestTableEditor/SQuestTableEditor.h"
 #include "ItemTableEditor/SItemTableEditor.h"
 #include "SDialogueTableEditor.h"
+#include "GasAbilityGeneratorAssetIndex.h"  // v7.8.84
+#include "GasAbilityGeneratorFunctionResolver.h"  // v7.8.84
 #include "Modules/ModuleManager.h"
 #include "ToolMenus.h"
 #include "Framework/Docking/TabManager.h"
@@ -78,6 +81,10 @@ void FGasAbilityGeneratorModule::ShutdownModule()
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(ItemTableEditorTabName);
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(DialogueTableEditorTabName);
 
+	// v7.8.84: Static delegate bindings must not outlive the module (unload / Live Coding reload)
+	FGeneratorAssetIndex::Shutdown();
+	FGasAbilityGeneratorFunctionResolver::Shutdown();
+
 	UE_LOG(LogTemp, Log, TEXT("[GasAbilityGenerator] Module shutdown"));
 }
 
@@ -1,5 +1,13 @@
-// GasAbilityGenerator v4.18
+// GasAbilityGenerator v7.8.84
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.84: Parse cache file key drops the __DATE__/__TIME__ build stamps - ParserVersion + CacheFileVersion only
+// v7.8.83: FManifestParseCache::LoadOrParse - on-disk parse cache (header + CRC-checked FManifestData payload)
+// v7.8.83: FManifestLineStream stores per-line offsets into one source buffer (no copied raw/trimmed strings)
+// v7.8.73: FManifestSectionCache (reparse changed sections only); incremental files parsed by their section parser
+// v7.8.61: FManifestParseCache - previous parse reused while SHA-1(content) + parser version match
+// v7.8.60: Parallel section parsing - one task per top-level span, merged in document order
+// v7.8.59: Table-driven section dispatch, top-level section pre-scan and FLazyManifestData (parse on first touch)
+// v7.8.58: FManifestLineStream single-pass tokenizer shared by all section parsers
 // v4.18: Added P1.2 form transition validation (GPT audit approved)
 // v4.16.1: Added case-duplicate validation warning (Concern B from audit)
 // v2.8.2: Added nested parameters support for CallFunction nodes (parameters: section under properties:)
@@ -12,6 +20,11 @@
 // v2.1.7: Fixed variable subsection exit - now properly detects new blueprint items by indent level
 
 #include "GasAbilityGeneratorParser.h"
+#include "Async/ParallelFor.h"  // v7.8.60: Parallel section parsing
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 // v4.16.1: Log category for parser warnings
 DEFINE_LOG_CATEGORY_STATIC(LogGasAbilityParser, Log, All);
@@ -221,14 +234,59 @@ bool FGasAbilityGeneratorParser::ParseManifest(const FString& ManifestContent, F
 	OutData.CharacterDefinitions.Empty();
 	OutData.ProjectRoot.Empty();
 	OutData.TagsIniPath.Empty();
+	OutData.SourceLineNumbers.Empty();
 	
-	TArray<FString> Lines;
-	ManifestContent.ParseIntoArrayLines(Lines);
+	// v7.8.58: Tokenize once - trim/indent/colon scan no longer repeated per section parser visit
+	const FManifestLineStream Lines(ManifestContent);
+
+	// v7.8.58: Record "- name:" line numbers from the token stream for PreValidator diagnostics
+	CollectSourceLineNumbers(Lines, OutData);
 	
-	for (int32 i = 0; i < Lines.Num(); i++)
+	// v7.8.60: Sections are independent - parse each top-level span into its own fragment on
+	// the task graph, then merge fragments in document order so arrays match a serial parse
+	TArray<FManifestSectionSpan> Sections;
+	BuildSectionIndex(Lines, Sections);
+
+	if (Sections.Num() >= ParallelSectionThreshold)
 	{
-		const FString& Line = Lines[i];
-		FString TrimmedLine = Line.TrimStart();
+		TArray<FManifestData> Fragments;
+		Fragments.SetNum(Sections.Num());
+
+		ParallelFor(Sections.Num(), [&Lines, &Sections, &Fragments](int32 SectionIndex)
+		{
+			const FManifestSectionSpan& Span = Sections[SectionIndex];
+			ParseLineRange(Lines, Span.StartIndex, Span.EndIndex, Fragments[SectionIndex]);
+		}, EParallelForFlags::Unbalanced);
+
+		// Preamble (project_root, tags_ini_path) precedes the first section
+		ParseLineRange(Lines, 0, Sections[0].StartIndex, OutData);
+
+		for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
+		{
+			MergeManifestFragment(OutData, MoveTemp(Fragments[SectionIndex]), Sections[SectionIndex].Key);
+		}
+	}
+	else
+	{
+		ParseLineRange(Lines, 0, Lines.Num(), OutData);
+	}
+
+	// v4.16.1: Validate for case-only duplicate asset names (Concern B from audit)
+	ValidateCaseDuplicates(OutData);
+
+	// v4.18 P1.2: Validate form transition state machine (Father-specific)
+	ValidateFormTransitions(OutData);
+
+	return true;
+}
+
+// v7.8.60: Top-level dispatch loop over [Begin, End) - the whole document for a serial parse,
+// one section span per task for a parallel parse
+void FGasAbilityGeneratorParser::ParseLineRange(const FManifestLineStream& Lines, int32 Begin, int32 End, FManifestData& OutData)
+{
+	for (int32 i = Begin; i < End; i++)
+	{
+		const FString TrimmedLine(Lines.GetTrimmed(i));
 		
 		// Skip empty lines and comments
 		if (TrimmedLine.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
@@ -246,347 +304,729 @@ bool FGasAbilityGeneratorParser::ParseManifest(const FString& ManifestContent, F
 		{
 			OutData.TagsIniPath = GetLineValue(TrimmedLine);
 		}
-		// Parse tags section
-		else if (IsSectionHeader(TrimmedLine, TEXT("tags:")))
-		{
-			ParseTags(Lines, i, OutData);
-		}
-		// v2.1.8: Parse enumerations section
-		else if (IsSectionHeader(TrimmedLine, TEXT("enumerations:")))
-		{
-			ParseEnumerations(Lines, i, OutData);
-		}
-		// Parse input_actions section
-		else if (IsSectionHeader(TrimmedLine, TEXT("input_actions:")))
-		{
-			ParseInputActions(Lines, i, OutData);
-		}
-		// Parse input_mapping_contexts section
-		else if (IsSectionHeader(TrimmedLine, TEXT("input_mapping_contexts:")))
-		{
-			ParseInputMappingContexts(Lines, i, OutData);
-		}
-		// Parse gameplay_effects section
-		else if (IsSectionHeader(TrimmedLine, TEXT("gameplay_effects:")))
-		{
-			ParseGameplayEffects(Lines, i, OutData);
-		}
-		// Parse gameplay_abilities section
-		else if (IsSectionHeader(TrimmedLine, TEXT("gameplay_abilities:")))
-		{
-			ParseGameplayAbilities(Lines, i, OutData);
-		}
-		// Parse actor_blueprints or blueprints section
-		else if (IsSectionHeader(TrimmedLine, TEXT("actor_blueprints:")) || 
-		         IsSectionHeader(TrimmedLine, TEXT("blueprints:")))
-		{
-			ParseActorBlueprints(Lines, i, OutData);
-		}
-		// Parse widget_blueprints or widgets section
-		else if (IsSectionHeader(TrimmedLine, TEXT("widget_blueprints:")) ||
-		         IsSectionHeader(TrimmedLine, TEXT("widgets:")))
-		{
-			ParseWidgetBlueprints(Lines, i, OutData);
-		}
-		// v4.19: Parse component_blueprints section
-		else if (IsSectionHeader(TrimmedLine, TEXT("component_blueprints:")) ||
-		         IsSectionHeader(TrimmedLine, TEXT("components:")))
-		{
-			ParseComponentBlueprints(Lines, i, OutData);
-		}
-		// v7.8.52: Parse blueprint_conditions section
-		else if (IsSectionHeader(TrimmedLine, TEXT("blueprint_conditions:")) ||
-		         IsSectionHeader(TrimmedLine, TEXT("conditions:")))
-		{
-			ParseBlueprintConditions(Lines, i, OutData);
-		}
-		// Parse blackboards section
-		else if (IsSectionHeader(TrimmedLine, TEXT("blackboards:")))
-		{
-			ParseBlackboards(Lines, i, OutData);
-		}
-		// Parse behavior_trees section
-		else if (IsSectionHeader(TrimmedLine, TEXT("behavior_trees:")))
-		{
-			ParseBehaviorTrees(Lines, i, OutData);
-		}
-		// Parse materials section
-		else if (IsSectionHeader(TrimmedLine, TEXT("materials:")))
-		{
-			ParseMaterials(Lines, i, OutData);
-		}
-		// v2.6.12: Parse material_functions section
-		else if (IsSectionHeader(TrimmedLine, TEXT("material_functions:")))
+		// v7.8.59: Table-driven section dispatch (shared with the lazy section index)
+		else if (const FSectionHandler* Handler = FindSectionHandler(TrimmedLine))
 		{
-			ParseMaterialFunctions(Lines, i, OutData);
-		}
-		// v4.9: Parse material_instances section
-		else if (IsSectionHeader(TrimmedLine, TEXT("material_instances:")))
-		{
-			ParseMaterialInstances(Lines, i, OutData);
-		}
-		// v2.2.0: Parse event_graphs section
-		else if (IsSectionHeader(TrimmedLine, TEXT("event_graphs:")))
-		{
-			ParseEventGraphs(Lines, i, OutData);
-		}
-		// v2.3.0: Parse new asset type sections
-		else if (IsSectionHeader(TrimmedLine, TEXT("float_curves:")))
-		{
-			ParseFloatCurves(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("animation_montages:")))
-		{
-			ParseAnimationMontages(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("animation_notifies:")))
-		{
-			ParseAnimationNotifies(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("dialogue_blueprints:")))
-		{
-			ParseDialogueBlueprints(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("equippable_items:")))
-		{
-			ParseEquippableItems(Lines, i, OutData);
+			Handler->Parse(Lines, i, OutData);
 		}
+	}
+}
+
+// v7.8.60: Append a section fragment; called in document order so array order matches a serial parse
+void FGasAbilityGeneratorParser::MergeManifestFragment(FManifestData& Into, FManifestData&& Fragment, const FString& SectionKey)
+{
+	// Scalars - last assignment wins, as in a serial parse
+	if (!Fragment.ProjectRoot.IsEmpty()) Into.ProjectRoot = MoveTemp(Fragment.ProjectRoot);
+	if (!Fragment.TagsIniPath.IsEmpty()) Into.TagsIniPath = MoveTemp(Fragment.TagsIniPath);
+	if (SectionKey == TEXT("pipeline_config")) Into.PipelineConfig = MoveTemp(Fragment.PipelineConfig);
+
+	Into.Tags.Append(MoveTemp(Fragment.Tags));
+	Into.Enumerations.Append(MoveTemp(Fragment.Enumerations));
+	Into.InputActions.Append(MoveTemp(Fragment.InputActions));
+	Into.InputMappingContexts.Append(MoveTemp(Fragment.InputMappingContexts));
+	Into.GameplayEffects.Append(MoveTemp(Fragment.GameplayEffects));
+	Into.GameplayAbilities.Append(MoveTemp(Fragment.GameplayAbilities));
+	Into.ActorBlueprints.Append(MoveTemp(Fragment.ActorBlueprints));
+	Into.WidgetBlueprints.Append(MoveTemp(Fragment.WidgetBlueprints));
+	Into.Blackboards.Append(MoveTemp(Fragment.Blackboards));
+	Into.BehaviorTrees.Append(MoveTemp(Fragment.BehaviorTrees));
+	Into.Materials.Append(MoveTemp(Fragment.Materials));
+	Into.MaterialInstances.Append(MoveTemp(Fragment.MaterialInstances));
+	Into.EventGraphs.Append(MoveTemp(Fragment.EventGraphs));
+	Into.FloatCurves.Append(MoveTemp(Fragment.FloatCurves));
+	Into.AnimationMontages.Append(MoveTemp(Fragment.AnimationMontages));
+	Into.AnimationNotifies.Append(MoveTemp(Fragment.AnimationNotifies));
+	Into.DialogueBlueprints.Append(MoveTemp(Fragment.DialogueBlueprints));
+	Into.EquippableItems.Append(MoveTemp(Fragment.EquippableItems));
+	Into.ConsumableItems.Append(MoveTemp(Fragment.ConsumableItems));
+	Into.AmmoItems.Append(MoveTemp(Fragment.AmmoItems));
+	Into.WeaponAttachments.Append(MoveTemp(Fragment.WeaponAttachments));
+	Into.Activities.Append(MoveTemp(Fragment.Activities));
+	Into.BlueprintTriggers.Append(MoveTemp(Fragment.BlueprintTriggers));
+	Into.AbilityConfigurations.Append(MoveTemp(Fragment.AbilityConfigurations));
+	Into.ActivityConfigurations.Append(MoveTemp(Fragment.ActivityConfigurations));
+	Into.ItemCollections.Append(MoveTemp(Fragment.ItemCollections));
+	Into.NarrativeEvents.Append(MoveTemp(Fragment.NarrativeEvents));
+	Into.NPCDefinitions.Append(MoveTemp(Fragment.NPCDefinitions));
+	Into.CharacterDefinitions.Append(MoveTemp(Fragment.CharacterDefinitions));
+	Into.TaggedDialogueSets.Append(MoveTemp(Fragment.TaggedDialogueSets));
+	Into.NiagaraSystems.Append(MoveTemp(Fragment.NiagaraSystems));
+	Into.FXPresets.Append(MoveTemp(Fragment.FXPresets));
+	Into.MaterialFunctions.Append(MoveTemp(Fragment.MaterialFunctions));
+	Into.ActivitySchedules.Append(MoveTemp(Fragment.ActivitySchedules));
+	Into.GoalItems.Append(MoveTemp(Fragment.GoalItems));
+	Into.GoalGenerators.Append(MoveTemp(Fragment.GoalGenerators));
+	Into.Quests.Append(MoveTemp(Fragment.Quests));
+	Into.GameplayCues.Append(MoveTemp(Fragment.GameplayCues));
+	Into.BTServices.Append(MoveTemp(Fragment.BTServices));
+	Into.BTTasks.Append(MoveTemp(Fragment.BTTasks));
+	Into.CharacterAppearances.Append(MoveTemp(Fragment.CharacterAppearances));
+	Into.TriggerSets.Append(MoveTemp(Fragment.TriggerSets));
+	Into.ComponentBlueprints.Append(MoveTemp(Fragment.ComponentBlueprints));
+	Into.BlueprintConditions.Append(MoveTemp(Fragment.BlueprintConditions));
+	Into.FormStateEffects.Append(MoveTemp(Fragment.FormStateEffects));
+	Into.PipelineItems.Append(MoveTemp(Fragment.PipelineItems));
+	Into.PipelineCollections.Append(MoveTemp(Fragment.PipelineCollections));
+	Into.PipelineLoadouts.Append(MoveTemp(Fragment.PipelineLoadouts));
+	Into.POIPlacements.Append(MoveTemp(Fragment.POIPlacements));
+	Into.NPCSpawnerPlacements.Append(MoveTemp(Fragment.NPCSpawnerPlacements));
+}
+
+// v7.8.59: Section dispatch table - order matters, first match wins (same as the former if/else chain).
+// Canonical is the section key the lazy index uses; aliases and suffix forms share their target's key.
+const FGasAbilityGeneratorParser::FSectionHandler* FGasAbilityGeneratorParser::FindSectionHandler(const FString& TrimmedLine)
+{
+	static const FSectionHandler PrefixHandlers[] =
+	{
+		{ TEXT("tags:"),                    TEXT("tags"),                    &FGasAbilityGeneratorParser::ParseTags },
+		{ TEXT("enumerations:"),            TEXT("enumerations"),            &FGasAbilityGeneratorParser::ParseEnumerations },  // v2.1.8
+		{ TEXT("input_actions:"),           TEXT("input_actions"),           &FGasAbilityGeneratorParser::ParseInputActions },
+		{ TEXT("input_mapping_contexts:"),  TEXT("input_mapping_contexts"),  &FGasAbilityGeneratorParser::ParseInputMappingContexts },
+		{ TEXT("gameplay_effects:"),        TEXT("gameplay_effects"),        &FGasAbilityGeneratorParser::ParseGameplayEffects },
+		{ TEXT("gameplay_abilities:"),      TEXT("gameplay_abilities"),      &FGasAbilityGeneratorParser::ParseGameplayAbilities },
+		{ TEXT("actor_blueprints:"),        TEXT("actor_blueprints"),        &FGasAbilityGeneratorParser::ParseActorBlueprints },
+		{ TEXT("blueprints:"),              TEXT("actor_blueprints"),        &FGasAbilityGeneratorParser::ParseActorBlueprints },
+		{ TEXT("widget_blueprints:"),       TEXT("widget_blueprints"),       &FGasAbilityGeneratorParser::ParseWidgetBlueprints },
+		{ TEXT("widgets:"),                 TEXT("widget_blueprints"),       &FGasAbilityGeneratorParser::ParseWidgetBlueprints },
+		{ TEXT("component_blueprints:"),    TEXT("component_blueprints"),    &FGasAbilityGeneratorParser::ParseComponentBlueprints },  // v4.19
+		{ TEXT("components:"),              TEXT("component_blueprints"),    &FGasAbilityGeneratorParser::ParseComponentBlueprints },
+		{ TEXT("blueprint_conditions:"),    TEXT("blueprint_conditions"),    &FGasAbilityGeneratorParser::ParseBlueprintConditions },  // v7.8.52
+		{ TEXT("conditions:"),              TEXT("blueprint_conditions"),    &FGasAbilityGeneratorParser::ParseBlueprintConditions },
+		{ TEXT("blackboards:"),             TEXT("blackboards"),             &FGasAbilityGeneratorParser::ParseBlackboards },
+		{ TEXT("behavior_trees:"),          TEXT("behavior_trees"),          &FGasAbilityGeneratorParser::ParseBehaviorTrees },
+		{ TEXT("materials:"),               TEXT("materials"),               &FGasAbilityGeneratorParser::ParseMaterials },
+		{ TEXT("material_functions:"),      TEXT("material_functions"),      &FGasAbilityGeneratorParser::ParseMaterialFunctions },  // v2.6.12
+		{ TEXT("material_instances:"),      TEXT("material_instances"),      &FGasAbilityGeneratorParser::ParseMaterialInstances },  // v4.9
+		{ TEXT("event_graphs:"),            TEXT("event_graphs"),            &FGasAbilityGeneratorParser::ParseEventGraphs },  // v2.2.0
+		// v2.3.0: New asset type sections
+		{ TEXT("float_curves:"),            TEXT("float_curves"),            &FGasAbilityGeneratorParser::ParseFloatCurves },
+		{ TEXT("animation_montages:"),      TEXT("animation_montages"),      &FGasAbilityGeneratorParser::ParseAnimationMontages },
+		{ TEXT("animation_notifies:"),      TEXT("animation_notifies"),      &FGasAbilityGeneratorParser::ParseAnimationNotifies },
+		{ TEXT("dialogue_blueprints:"),     TEXT("dialogue_blueprints"),     &FGasAbilityGeneratorParser::ParseDialogueBlueprints },
+		{ TEXT("equippable_items:"),        TEXT("equippable_items"),        &FGasAbilityGeneratorParser::ParseEquippableItems },
 		// v4.28: Option C manifest sections - per Item_Generation_Capability_Audit.md Section 1.1
-		else if (IsSectionHeader(TrimmedLine, TEXT("consumable_items:")))
-		{
-			ParseConsumableItems(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("ammo_items:")))
-		{
-			ParseAmmoItems(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("weapon_attachments:")))
-		{
-			ParseWeaponAttachments(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("activities:")))
-		{
-			ParseActivities(Lines, i, OutData);
-		}
-		// v7.8.52: Blueprint Triggers (BPT_ quest task types)
-		else if (IsSectionHeader(TrimmedLine, TEXT("blueprint_triggers:")))
-		{
-			ParseBlueprintTriggers(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("ability_configurations:")))
-		{
-			ParseAbilityConfigurations(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("activity_configurations:")))
-		{
-			ParseActivityConfigurations(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("item_collections:")))
-		{
-			ParseItemCollections(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("narrative_events:")))
-		{
-			ParseNarrativeEvents(Lines, i, OutData);
-		}
-		// v4.0: Gameplay Cues
-		else if (IsSectionHeader(TrimmedLine, TEXT("gameplay_cues:")))
-		{
-			ParseGameplayCues(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("npc_definitions:")))
-		{
-			ParseNPCDefinitions(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("character_definitions:")))
-		{
-			ParseCharacterDefinitions(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("tagged_dialogue_sets:")))
-		{
-			ParseTaggedDialogueSets(Lines, i, OutData);
-		}
-		// v2.6.5: Niagara System generation
-		else if (IsSectionHeader(TrimmedLine, TEXT("niagara_systems:")))
-		{
-			ParseNiagaraSystems(Lines, i, OutData);
-		}
-		// v4.9: FX Presets (reusable Niagara parameter configurations)
-		else if (IsSectionHeader(TrimmedLine, TEXT("fx_presets:")))
-		{
-			ParseFXPresets(Lines, i, OutData);
-		}
+		{ TEXT("consumable_items:"),        TEXT("consumable_items"),        &FGasAbilityGeneratorParser::ParseConsumableItems },
+		{ TEXT("ammo_items:"),              TEXT("ammo_items"),              &FGasAbilityGeneratorParser::ParseAmmoItems },
+		{ TEXT("weapon_attachments:"),      TEXT("weapon_attachments"),      &FGasAbilityGeneratorParser::ParseWeaponAttachments },
+		{ TEXT("activities:"),              TEXT("activities"),              &FGasAbilityGeneratorParser::ParseActivities },
+		{ TEXT("blueprint_triggers:"),      TEXT("blueprint_triggers"),      &FGasAbilityGeneratorParser::ParseBlueprintTriggers },  // v7.8.52
+		{ TEXT("ability_configurations:"),  TEXT("ability_configurations"),  &FGasAbilityGeneratorParser::ParseAbilityConfigurations },
+		{ TEXT("activity_configurations:"), TEXT("activity_configurations"), &FGasAbilityGeneratorParser::ParseActivityConfigurations },
+		{ TEXT("item_collections:"),        TEXT("item_collections"),        &FGasAbilityGeneratorParser::ParseItemCollections },
+		{ TEXT("narrative_events:"),        TEXT("narrative_events"),        &FGasAbilityGeneratorParser::ParseNarrativeEvents },
+		{ TEXT("gameplay_cues:"),           TEXT("gameplay_cues"),           &FGasAbilityGeneratorParser::ParseGameplayCues },  // v4.0
+		{ TEXT("npc_definitions:"),         TEXT("npc_definitions"),         &FGasAbilityGeneratorParser::ParseNPCDefinitions },
+		{ TEXT("character_definitions:"),   TEXT("character_definitions"),   &FGasAbilityGeneratorParser::ParseCharacterDefinitions },
+		{ TEXT("tagged_dialogue_sets:"),    TEXT("tagged_dialogue_sets"),    &FGasAbilityGeneratorParser::ParseTaggedDialogueSets },
+		{ TEXT("niagara_systems:"),         TEXT("niagara_systems"),         &FGasAbilityGeneratorParser::ParseNiagaraSystems },  // v2.6.5
+		{ TEXT("fx_presets:"),              TEXT("fx_presets"),              &FGasAbilityGeneratorParser::ParseFXPresets },  // v4.9
 		// v3.9: NPC Pipeline - Schedules, Goals, Quests
-		else if (IsSectionHeader(TrimmedLine, TEXT("activity_schedules:")))
-		{
-			ParseActivitySchedules(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("goal_items:")) || IsSectionHeader(TrimmedLine, TEXT("goals:")))
-		{
-			ParseGoalItems(Lines, i, OutData);
-		}
-		// v7.8.52: GoalGenerators - Blueprint classes that generate goals
-		else if (IsSectionHeader(TrimmedLine, TEXT("goal_generators:")))
-		{
-			ParseGoalGenerators(Lines, i, OutData);
-		}
-		// v7.8.52: GameplayCues - GC_ Blueprint assets
-		else if (IsSectionHeader(TrimmedLine, TEXT("gameplay_cues:")) || IsSectionHeader(TrimmedLine, TEXT("cues:")))
-		{
-			ParseGameplayCues(Lines, i, OutData);
-		}
-		// v7.8.52: BT Services - BTS_ Blueprint assets
-		else if (IsSectionHeader(TrimmedLine, TEXT("bt_services:")) || IsSectionHeader(TrimmedLine, TEXT("services:")))
-		{
-			ParseBTServices(Lines, i, OutData);
-		}
-		// v7.8.52: BT Tasks - BTTask_ Blueprint assets
-		else if (IsSectionHeader(TrimmedLine, TEXT("bt_tasks:")) || IsSectionHeader(TrimmedLine, TEXT("tasks:")))
-		{
-			ParseBTTasks(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("quests:")))
-		{
-			ParseQuests(Lines, i, OutData);
-		}
-		// v4.8.3: Character Appearances
-		else if (IsSectionHeader(TrimmedLine, TEXT("character_appearances:")))
-		{
-			ParseCharacterAppearances(Lines, i, OutData);
-		}
-		// v4.9: TriggerSets (event-driven NPC behaviors)
-		else if (IsSectionHeader(TrimmedLine, TEXT("trigger_sets:")))
-		{
-			ParseTriggerSets(Lines, i, OutData);
-		}
-		// v4.13: Category C - FormStateEffects (P1.1)
-		else if (IsSectionHeader(TrimmedLine, TEXT("form_state_effects:")))
-		{
-			ParseFormStateEffects(Lines, i, OutData);
-		}
-		// v3.9.8: Mesh-to-Item Pipeline parsers
-		else if (IsSectionHeader(TrimmedLine, TEXT("pipeline_config:")))
-		{
-			ParsePipelineConfig(Lines, i, OutData);
-		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("pipeline_items:")))
+		{ TEXT("activity_schedules:"),      TEXT("activity_schedules"),      &FGasAbilityGeneratorParser::ParseActivitySchedules },
+		{ TEXT("goal_items:"),              TEXT("goal_items"),              &FGasAbilityGeneratorParser::ParseGoalItems },
+		{ TEXT("goals:"),                   TEXT("goal_items"),              &FGasAbilityGeneratorParser::ParseGoalItems },
+		{ TEXT("goal_generators:"),         TEXT("goal_generators"),         &FGasAbilityGeneratorParser::ParseGoalGenerators },  // v7.8.52
+		{ TEXT("cues:"),                    TEXT("gameplay_cues"),           &FGasAbilityGeneratorParser::ParseGameplayCues },  // v7.8.52
+		{ TEXT("bt_services:"),             TEXT("bt_services"),             &FGasAbilityGeneratorParser::ParseBTServices },  // v7.8.52
+		{ TEXT("services:"),                TEXT("bt_services"),             &FGasAbilityGeneratorParser::ParseBTServices },
+		{ TEXT("bt_tasks:"),                TEXT("bt_tasks"),                &FGasAbilityGeneratorParser::ParseBTTasks },  // v7.8.52
+		{ TEXT("tasks:"),                   TEXT("bt_tasks"),                &FGasAbilityGeneratorParser::ParseBTTasks },
+		{ TEXT("quests:"),                  TEXT("quests"),                  &FGasAbilityGeneratorParser::ParseQuests },
+		{ TEXT("character_appearances:"),   TEXT("character_appearances"),   &FGasAbilityGeneratorParser::ParseCharacterAppearances },  // v4.8.3
+		{ TEXT("trigger_sets:"),            TEXT("trigger_sets"),            &FGasAbilityGeneratorParser::ParseTriggerSets },  // v4.9
+		{ TEXT("form_state_effects:"),      TEXT("form_state_effects"),      &FGasAbilityGeneratorParser::ParseFormStateEffects },  // v4.13
+		// v3.9.8: Mesh-to-Item Pipeline
+		{ TEXT("pipeline_config:"),         TEXT("pipeline_config"),         &FGasAbilityGeneratorParser::ParsePipelineConfig },
+		{ TEXT("pipeline_items:"),          TEXT("pipeline_items"),          &FGasAbilityGeneratorParser::ParsePipelineItems },
+		{ TEXT("pipeline_collections:"),    TEXT("pipeline_collections"),    &FGasAbilityGeneratorParser::ParsePipelineCollections },
+		{ TEXT("pipeline_loadouts:"),       TEXT("pipeline_loadouts"),       &FGasAbilityGeneratorParser::ParsePipelineLoadouts },
+		// v3.9.9: POI & NPC Spawner Placements
+		{ TEXT("poi_placements:"),          TEXT("poi_placements"),          &FGasAbilityGeneratorParser::ParsePOIPlacements },
+		{ TEXT("npc_spawner_placements:"),  TEXT("npc_spawner_placements"),  &FGasAbilityGeneratorParser::ParseNPCSpawnerPlacements },
+		{ TEXT("spawner_placements:"),      TEXT("npc_spawner_placements"),  &FGasAbilityGeneratorParser::ParseNPCSpawnerPlacements },
+	};
+
+	// v2.5.6: NPC System Extensions - suffix-based section names (e.g. father_tags:)
+	static const FSectionHandler SuffixHandlers[] =
+	{
+		{ TEXT("_tags:"),                    TEXT("tags"),                    &FGasAbilityGeneratorParser::ParseTags },
+		{ TEXT("_gameplay_effects:"),        TEXT("gameplay_effects"),        &FGasAbilityGeneratorParser::ParseGameplayEffects },
+		{ TEXT("_gameplay_abilities:"),      TEXT("gameplay_abilities"),      &FGasAbilityGeneratorParser::ParseGameplayAbilities },
+		{ TEXT("_actor_blueprints:"),        TEXT("actor_blueprints"),        &FGasAbilityGeneratorParser::ParseActorBlueprints },
+		{ TEXT("_blackboards:"),             TEXT("blackboards"),             &FGasAbilityGeneratorParser::ParseBlackboards },
+		{ TEXT("_behavior_trees:"),          TEXT("behavior_trees"),          &FGasAbilityGeneratorParser::ParseBehaviorTrees },
+		{ TEXT("_activities:"),              TEXT("activities"),              &FGasAbilityGeneratorParser::ParseActivities },
+		{ TEXT("_ability_configurations:"),  TEXT("ability_configurations"),  &FGasAbilityGeneratorParser::ParseAbilityConfigurations },
+		{ TEXT("_activity_configurations:"), TEXT("activity_configurations"), &FGasAbilityGeneratorParser::ParseActivityConfigurations },
+		{ TEXT("_npc_definitions:"),         TEXT("npc_definitions"),         &FGasAbilityGeneratorParser::ParseNPCDefinitions },
+		{ TEXT("_materials:"),               TEXT("materials"),               &FGasAbilityGeneratorParser::ParseMaterials },
+		// Goals, goal generators and BT services are blueprint classes
+		{ TEXT("_goals:"),                   TEXT("actor_blueprints"),        &FGasAbilityGeneratorParser::ParseActorBlueprints },
+		{ TEXT("_goal_generators:"),         TEXT("actor_blueprints"),        &FGasAbilityGeneratorParser::ParseActorBlueprints },
+		{ TEXT("_bt_services:"),             TEXT("actor_blueprints"),        &FGasAbilityGeneratorParser::ParseActorBlueprints },
+		{ TEXT("_tagged_dialogue_sets:"),    TEXT("tagged_dialogue_sets"),    &FGasAbilityGeneratorParser::ParseTaggedDialogueSets },
+	};
+
+	for (const FSectionHandler& Handler : PrefixHandlers)
+	{
+		if (TrimmedLine.StartsWith(Handler.Header))
 		{
-			ParsePipelineItems(Lines, i, OutData);
+			return &Handler;
 		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("pipeline_collections:")))
+	}
+
+	if (!TrimmedLine.StartsWith(TEXT("-")))
+	{
+		for (const FSectionHandler& Handler : SuffixHandlers)
 		{
-			ParsePipelineCollections(Lines, i, OutData);
+			if (TrimmedLine.EndsWith(Handler.Header))
+			{
+				return &Handler;
+			}
 		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("pipeline_loadouts:")))
+	}
+
+	return nullptr;
+}
+
+// v7.8.58: First occurrence wins so nested entries (variables, nodes) never shadow the owning asset
+void FGasAbilityGeneratorParser::CollectSourceLineNumbers(const FManifestLineStream& Lines, FManifestData& OutData)
+{
+	for (int32 i = 0; i < Lines.Num(); i++)
+	{
+		if (Lines.IsArrayItem(i) && Lines.GetKey(i).Equals(TEXT("name"), ESearchCase::CaseSensitive))
 		{
-			ParsePipelineLoadouts(Lines, i, OutData);
+			const FString Name = StripYamlComment(FString(Lines.GetRawValue(i))).TrimQuotes();
+			if (!Name.IsEmpty() && !OutData.SourceLineNumbers.Contains(Name))
+			{
+				OutData.SourceLineNumbers.Add(Name, Lines.GetLineNumber(i));
+			}
 		}
-		// v3.9.9: POI & NPC Spawner Placements
-		else if (IsSectionHeader(TrimmedLine, TEXT("poi_placements:")))
+	}
+}
+
+// v7.8.59: Pre-scan - records top-level (indent 0) section headers without running any section parser
+void FGasAbilityGeneratorParser::BuildSectionIndex(const FManifestLineStream& Lines, TArray<FManifestSectionSpan>& OutSections, FManifestData* OutScalars)
+{
+	OutSections.Reset();
+
+	for (int32 i = 0; i < Lines.Num(); i++)
+	{
+		if (Lines.GetIndent(i) != 0 || Lines.IsComment(i) || !Lines.GetToken(i).HasColon())
 		{
-			ParsePOIPlacements(Lines, i, OutData);
+			continue;
 		}
-		else if (IsSectionHeader(TrimmedLine, TEXT("npc_spawner_placements:")) || IsSectionHeader(TrimmedLine, TEXT("spawner_placements:")))
+
+		const FString TrimmedLine(Lines.GetTrimmed(i));
+		if (OutScalars && TrimmedLine.StartsWith(TEXT("project_root:")))
 		{
-			ParseNPCSpawnerPlacements(Lines, i, OutData);
+			OutScalars->ProjectRoot = GetLineValue(TrimmedLine);
 		}
-		// v2.5.6: NPC System Extensions - Support for suffix-based section names
-		// Any section ending with _tags: gets parsed as tags
-		else if (TrimmedLine.EndsWith(TEXT("_tags:")) && !TrimmedLine.StartsWith(TEXT("-")))
+		else if (OutScalars && TrimmedLine.StartsWith(TEXT("tags_ini_path:")))
 		{
-			ParseTags(Lines, i, OutData);
+			OutScalars->TagsIniPath = GetLineValue(TrimmedLine);
 		}
-		// Any section ending with _gameplay_effects: gets parsed as gameplay effects
-		else if (TrimmedLine.EndsWith(TEXT("_gameplay_effects:")) && !TrimmedLine.StartsWith(TEXT("-")))
+		else if (const FSectionHandler* Handler = FindSectionHandler(TrimmedLine))
 		{
-			ParseGameplayEffects(Lines, i, OutData);
+			// Close the previous span at this header
+			if (OutSections.Num() > 0)
+			{
+				OutSections.Last().EndIndex = i;
+			}
+
+			FManifestSectionSpan& Span = OutSections.AddDefaulted_GetRef();
+			Span.Key = Handler->Canonical;
+			Span.StartIndex = i;
+			Span.EndIndex = Lines.Num();
+			Span.LineNumber = Lines.GetLineNumber(i);
 		}
-		// Any section ending with _gameplay_abilities: gets parsed as gameplay abilities
-		else if (TrimmedLine.EndsWith(TEXT("_gameplay_abilities:")) && !TrimmedLine.StartsWith(TEXT("-")))
+	}
+}
+
+void FGasAbilityGeneratorParser::ParseSectionAt(const FManifestLineStream& Lines, int32 HeaderIndex, FManifestData& OutData)
+{
+	if (const FSectionHandler* Handler = FindSectionHandler(FString(Lines.GetTrimmed(HeaderIndex))))
+	{
+		int32 LineIndex = HeaderIndex;
+		Handler->Parse(Lines, LineIndex, OutData);
+	}
+}
+
+// ============================================================================
+// v7.8.59: FLazyManifestData - section offset index with parse-on-first-touch
+// ============================================================================
+
+void FLazyManifestData::Initialize(const FString& ManifestContent)
+{
+	Data = FManifestData();
+	ParsedSections.Reset();
+	bAllParsed = false;
+
+	Lines.Tokenize(ManifestContent);
+	FGasAbilityGeneratorParser::BuildSectionIndex(Lines, Sections, &Data);
+}
+
+const FManifestData& FLazyManifestData::EnsureSection(const FString& SectionKey)
+{
+	if (ParsedSections.Contains(SectionKey))
+	{
+		return Data;
+	}
+
+	// Every span of this key, in document order (tags: appears once per NPC system block)
+	for (const FManifestSectionSpan& Span : Sections)
+	{
+		if (Span.Key == SectionKey)
 		{
-			ParseGameplayAbilities(Lines, i, OutData);
+			FGasAbilityGeneratorParser::ParseSectionAt(Lines, Span.StartIndex, Data);
 		}
-		// Any section ending with _actor_blueprints: gets parsed as actor blueprints
-		else if (TrimmedLine.EndsWith(TEXT("_actor_blueprints:")) && !TrimmedLine.StartsWith(TEXT("-")))
+	}
+
+	ParsedSections.Add(SectionKey);
+	Data.bWhitelistBuilt = false;
+	return Data;
+}
+
+const FManifestData& FLazyManifestData::EnsureAll()
+{
+	if (bAllParsed)
+	{
+		return Data;
+	}
+
+	TSet<FString> PendingKeys;
+	for (const FManifestSectionSpan& Span : Sections)
+	{
+		if (!ParsedSections.Contains(Span.Key))
 		{
-			ParseActorBlueprints(Lines, i, OutData);
+			PendingKeys.Add(Span.Key);
 		}
-		// Any section ending with _blackboards: gets parsed as blackboards
-		else if (TrimmedLine.EndsWith(TEXT("_blackboards:")) && !TrimmedLine.StartsWith(TEXT("-")))
+	}
+
+	for (const FManifestSectionSpan& Span : Sections)
+	{
+		if (PendingKeys.Contains(Span.Key))
 		{
-			ParseBlackboards(Lines, i, OutData);
+			FGasAbilityGeneratorParser::ParseSectionAt(Lines, Span.StartIndex, Data);
 		}
-		// Any section ending with _behavior_trees: gets parsed as behavior trees
-		else if (TrimmedLine.EndsWith(TEXT("_behavior_trees:")) && !TrimmedLine.StartsWith(TEXT("-")))
+	}
+	ParsedSections.Append(PendingKeys);
+
+	FGasAbilityGeneratorParser::CollectSourceLineNumbers(Lines, Data);
+	ValidateCaseDuplicates(Data);
+	ValidateFormTransitions(Data);
+
+	bAllParsed = true;
+	Data.bWhitelistBuilt = false;
+	return Data;
+}
+
+int32 FLazyManifestData::GetSectionLineCount(const FString& SectionKey) const
+{
+	int32 Count = 0;
+	for (const FManifestSectionSpan& Span : Sections)
+	{
+		if (Span.Key == SectionKey)
 		{
-			ParseBehaviorTrees(Lines, i, OutData);
+			Count += Span.EndIndex - Span.StartIndex;
 		}
-		// Any section ending with _activities: gets parsed as activities
-		else if (TrimmedLine.EndsWith(TEXT("_activities:")) && !TrimmedLine.StartsWith(TEXT("-")))
+	}
+	return Count;
+}
+
+// ============================================================================
+// v7.8.61: FManifestParseCache
+// ============================================================================
+
+FCriticalSection FManifestParseCache::CacheLock;
+FSHAHash FManifestParseCache::CachedKey;
+TSharedPtr<const FManifestData> FManifestParseCache::CachedData;
+
+FSHAHash FManifestParseCache::ComputeContentKey(const FString& ManifestContent)
+{
+	FSHA1 Sha;
+	const int32 Version = ParserVersion;
+	Sha.Update(reinterpret_cast<const uint8*>(&Version), sizeof(Version));
+	Sha.Update(reinterpret_cast<const uint8*>(*ManifestContent), ManifestContent.Len() * sizeof(TCHAR));
+	Sha.Final();
+
+	FSHAHash Key;
+	Sha.GetHash(Key.Hash);
+	return Key;
+}
+
+TSharedRef<const FManifestData> FManifestParseCache::GetOrParse(const FString& ManifestContent, bool* bOutCacheHit)
+{
+	const FSHAHash Key = ComputeContentKey(ManifestContent);
+
+	{
+		FScopeLock Lock(&CacheLock);
+		if (CachedData.IsValid() && CachedKey == Key)
 		{
-			ParseActivities(Lines, i, OutData);
+			if (bOutCacheHit) *bOutCacheHit = true;
+			return CachedData.ToSharedRef();
 		}
-		// Any section ending with _ability_configurations: gets parsed as ability configurations
-		else if (TrimmedLine.EndsWith(TEXT("_ability_configurations:")) && !TrimmedLine.StartsWith(TEXT("-")))
+	}
+
+	TSharedRef<FManifestData> Parsed = MakeShared<FManifestData>();
+	if (bOutCacheHit) *bOutCacheHit = false;
+	if (!FGasAbilityGeneratorParser::ParseManifest(ManifestContent, Parsed.Get()))
+	{
+		// Never cache a failed parse
+		return Parsed;
+	}
+
+	FScopeLock Lock(&CacheLock);
+	CachedKey = Key;
+	CachedData = Parsed;
+	return Parsed;
+}
+
+void FManifestParseCache::Clear()
+{
+	FScopeLock Lock(&CacheLock);
+	CachedData.Reset();
+	CachedKey = FSHAHash();
+}
+
+// v7.8.83: Cache file = header (magic, CacheFileVersion, key, payload size + CRC) followed by the serialized FManifestData
+static constexpr uint32 ParseCacheMagic = 0x50474147;  // "GAGP"
+
+FString FManifestParseCache::GetCacheFilePath(const FString& ManifestPath)
+{
+	FString FullPath = FPaths::ConvertRelativePathToFull(ManifestPath);
+	FPaths::NormalizeFilename(FullPath);
+	return FPaths::ProjectSavedDir() / TEXT("GasAbilityGenerator/ParseCache")
+		/ FString::Printf(TEXT("%s_%08x.bin"), *FPaths::GetBaseFilename(FullPath), FCrc::StrCrc32(*FullPath.ToLower()));
+}
+
+FSHAHash FManifestParseCache::ComputeFileKey(const FString& ManifestContent)
+{
+	// Parser output changes bump ParserVersion, serialized layout changes bump CacheFileVersion
+	const int32 Versions[] = { ParserVersion, CacheFileVersion };
+
+	FSHA1 Sha;
+	Sha.Update(reinterpret_cast<const uint8*>(Versions), sizeof(Versions));
+	Sha.Update(reinterpret_cast<const uint8*>(*ManifestContent), ManifestContent.Len() * sizeof(TCHAR));
+	Sha.Final();
+
+	FSHAHash Key;
+	Sha.GetHash(Key.Hash);
+	return Key;
+}
+
+bool FManifestParseCache::ReadCacheFile(const TArray<uint8>& FileBytes, const FSHAHash& Key, FManifestData& OutData)
+{
+	FMemoryReader Reader(FileBytes);
+
+	uint32 Magic = 0;
+	int32 FileVersion = 0;
+	FSHAHash FileKey;
+	int64 PayloadSize = 0;
+	uint32 PayloadCrc = 0;
+	Reader << Magic << FileVersion;
+	Reader.Serialize(FileKey.Hash, sizeof(FileKey.Hash));
+	Reader << PayloadSize << PayloadCrc;
+
+	if (Reader.IsError() || Magic != ParseCacheMagic || FileVersion != CacheFileVersion || FileKey != Key)
+	{
+		return false;
+	}
+
+	// Truncated or damaged payloads fail here, before anything is deserialized
+	const int64 PayloadOffset = Reader.Tell();
+	if (PayloadSize != FileBytes.Num() - PayloadOffset
+		|| FCrc::MemCrc32(FileBytes.GetData() + PayloadOffset, PayloadSize) != PayloadCrc)
+	{
+		return false;
+	}
+
+	FManifestData Loaded;
+	SerializeManifestData(Reader, Loaded);
+	if (Reader.IsError() || Reader.Tell() != FileBytes.Num())
+	{
+		return false;
+	}
+
+	OutData = MoveTemp(Loaded);
+	return true;
+}
+
+bool FManifestParseCache::WriteCacheFile(const FString& CachePath, const FSHAHash& Key, FManifestData& Data)
+{
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+	SerializeManifestData(PayloadWriter, Data);
+
+	TArray<uint8> FileBytes;
+	FMemoryWriter Writer(FileBytes);
+	uint32 Magic = ParseCacheMagic;
+	int32 FileVersion = CacheFileVersion;
+	FSHAHash FileKey = Key;
+	int64 PayloadSize = Payload.Num();
+	uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+	Writer << Magic << FileVersion;
+	Writer.Serialize(FileKey.Hash, sizeof(FileKey.Hash));
+	Writer << PayloadSize << PayloadCrc;
+	FileBytes.Append(Payload);
+
+	return FFileHelper::SaveArrayToFile(FileBytes, *CachePath);
+}
+
+bool FManifestParseCache::LoadOrParse(const FString& ManifestPath, const FString& ManifestContent, FManifestData& OutData, bool* bOutCacheHit)
+{
+	if (bOutCacheHit) *bOutCacheHit = false;
+
+	const FString CachePath = GetCacheFilePath(ManifestPath);
+	const FSHAHash Key = ComputeFileKey(ManifestContent);
+
+	TArray<uint8> FileBytes;
+	if (FFileHelper::LoadFileToArray(FileBytes, *CachePath, FILEREAD_Silent))
+	{
+		if (ReadCacheFile(FileBytes, Key, OutData))
 		{
-			ParseAbilityConfigurations(Lines, i, OutData);
+			// Same parse-time lints as ParseManifest, so a cache hit reports the same warnings
+			ValidateCaseDuplicates(OutData);
+			ValidateFormTransitions(OutData);
+
+			if (bOutCacheHit) *bOutCacheHit = true;
+			return true;
 		}
-		// Any section ending with _activity_configurations: gets parsed as activity configurations
-		else if (TrimmedLine.EndsWith(TEXT("_activity_configurations:")) && !TrimmedLine.StartsWith(TEXT("-")))
+		UE_LOG(LogGasAbilityParser, Log, TEXT("Parse cache %s is stale or unreadable - parsing manifest"), *CachePath);
+	}
+
+	OutData = FManifestData();
+	if (!FGasAbilityGeneratorParser::ParseManifest(ManifestContent, OutData))
+	{
+		return false;
+	}
+
+	if (!WriteCacheFile(CachePath, Key, OutData))
+	{
+		UE_LOG(LogGasAbilityParser, Warning, TEXT("Could not write parse cache %s"), *CachePath);
+	}
+	return true;
+}
+
+// ============================================================================
+// v7.8.73: FManifestSectionCache
+// ============================================================================
+
+bool FManifestSectionCache::Parse(const FString& ManifestContent, FManifestData& OutData)
+{
+	OutData = FManifestData();
+	LastReparsedKeys.Reset();
+	LastReparsedCount = 0;
+	LastReusedCount = 0;
+
+	const FManifestLineStream Lines(ManifestContent);
+	FGasAbilityGeneratorParser::CollectSourceLineNumbers(Lines, OutData);
+
+	TArray<FManifestSectionSpan> Sections;
+	FGasAbilityGeneratorParser::BuildSectionIndex(Lines, Sections);
+	if (Sections.Num() == 0)
+	{
+		FGasAbilityGeneratorParser::ParseLineRange(Lines, 0, Lines.Num(), OutData);
+		Fragments.Reset();
+	}
+	else
+	{
+		// Same fragment layout as the parallel ParseManifest path, so the merged result is identical
+		TArray<uint64> SectionHashes;
+		SectionHashes.SetNumUninitialized(Sections.Num());
+		TArray<int32> Pending;
+		for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
 		{
-			ParseActivityConfigurations(Lines, i, OutData);
+			const FManifestSectionSpan& Span = Sections[SectionIndex];
+			FGeneratorHashBuilder Hash;
+			Hash.Update(Span.Key);
+			for (int32 i = Span.StartIndex; i < Span.EndIndex; i++)
+			{
+				Hash.Update(Lines[i]);
+			}
+			SectionHashes[SectionIndex] = Hash.Finalize();
+
+			if (!Fragments.Contains(SectionHashes[SectionIndex]))
+			{
+				Pending.Add(SectionIndex);
+			}
 		}
-		// Any section ending with _npc_definitions: gets parsed as NPC definitions
-		else if (TrimmedLine.EndsWith(TEXT("_npc_definitions:")) && !TrimmedLine.StartsWith(TEXT("-")))
+
+		TArray<FManifestData> Parsed;
+		Parsed.SetNum(Pending.Num());
+		ParallelFor(Pending.Num(), [&Lines, &Sections, &Pending, &Parsed](int32 PendingIndex)
 		{
-			ParseNPCDefinitions(Lines, i, OutData);
-		}
-		// Any section ending with _materials: gets parsed as materials
-		else if (TrimmedLine.EndsWith(TEXT("_materials:")) && !TrimmedLine.StartsWith(TEXT("-")))
+			const FManifestSectionSpan& Span = Sections[Pending[PendingIndex]];
+			FGasAbilityGeneratorParser::ParseLineRange(Lines, Span.StartIndex, Span.EndIndex, Parsed[PendingIndex]);
+		}, Pending.Num() < FGasAbilityGeneratorParser::ParallelSectionThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+		TMap<uint64, FManifestData> Retained;
+		Retained.Reserve(Sections.Num());
+		for (int32 PendingIndex = 0; PendingIndex < Pending.Num(); PendingIndex++)
 		{
-			ParseMaterials(Lines, i, OutData);
+			const int32 SectionIndex = Pending[PendingIndex];
+			Retained.Add(SectionHashes[SectionIndex], MoveTemp(Parsed[PendingIndex]));
+			LastReparsedKeys.Add(Sections[SectionIndex].Key);
 		}
-		// Any section ending with _goals: gets parsed as actor blueprints (goals are blueprint classes)
-		else if (TrimmedLine.EndsWith(TEXT("_goals:")) && !TrimmedLine.StartsWith(TEXT("-")))
+		for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
 		{
-			ParseActorBlueprints(Lines, i, OutData);
+			if (!Retained.Contains(SectionHashes[SectionIndex]))
+			{
+				Retained.Add(SectionHashes[SectionIndex], MoveTemp(Fragments.FindChecked(SectionHashes[SectionIndex])));
+			}
 		}
-		// Any section ending with _goal_generators: gets parsed as actor blueprints
-		else if (TrimmedLine.EndsWith(TEXT("_goal_generators:")) && !TrimmedLine.StartsWith(TEXT("-")))
+		Fragments = MoveTemp(Retained);
+		LastReparsedCount = Pending.Num();
+		LastReusedCount = Sections.Num() - Pending.Num();
+
+		FGasAbilityGeneratorParser::ParseLineRange(Lines, 0, Sections[0].StartIndex, OutData);
+		for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
 		{
-			ParseActorBlueprints(Lines, i, OutData);
+			// Copy - the cached fragment stays for the next reparse
+			FManifestData Fragment = Fragments.FindChecked(SectionHashes[SectionIndex]);
+			FGasAbilityGeneratorParser::MergeManifestFragment(OutData, MoveTemp(Fragment), Sections[SectionIndex].Key);
 		}
-		// Any section ending with _bt_services: gets parsed as actor blueprints (BT services are blueprints)
-		else if (TrimmedLine.EndsWith(TEXT("_bt_services:")) && !TrimmedLine.StartsWith(TEXT("-")))
+	}
+
+	ValidateCaseDuplicates(OutData);
+	ValidateFormTransitions(OutData);
+	return true;
+}
+
+void FManifestSectionCache::Reset()
+{
+	Fragments.Reset();
+	LastReparsedKeys.Reset();
+	LastReparsedCount = 0;
+	LastReusedCount = 0;
+}
+
+// v7.8.73: Definition lookup / replacement by name for incremental files
+template <typename TDefinition>
+static bool ContainsDefinition(const TArray<TDefinition>& Definitions, const FString& Name)
+{
+	return Definitions.ContainsByPredicate([&Name](const TDefinition& Def) { return Def.Name == Name; });
+}
+
+template <typename TDefinition>
+static int32 ReplaceByName(TArray<TDefinition>& Into, TArray<TDefinition>&& From)
+{
+	for (TDefinition& Def : From)
+	{
+		const int32 Existing = Into.IndexOfByPredicate([&Def](const TDefinition& Other) { return Other.Name == Def.Name; });
+		if (Existing != INDEX_NONE)
 		{
-			ParseActorBlueprints(Lines, i, OutData);
+			Into[Existing] = MoveTemp(Def);
 		}
-		// Any section ending with _tagged_dialogue_sets: gets parsed as tagged dialogue sets
-		else if (TrimmedLine.EndsWith(TEXT("_tagged_dialogue_sets:")) && !TrimmedLine.StartsWith(TEXT("-")))
+		else
 		{
-			ParseTaggedDialogueSets(Lines, i, OutData);
+			Into.Add(MoveTemp(Def));
 		}
 	}
+	return From.Num();
+}
 
-	// v4.16.1: Validate for case-only duplicate asset names (Concern B from audit)
-	ValidateCaseDuplicates(OutData);
-
-	// v4.18 P1.2: Validate form transition state machine (Father-specific)
-	ValidateFormTransitions(OutData);
+// Whitelisted sections only (see FManifestData::BuildAssetWhitelist) - incremental files can't introduce assets
+const TCHAR* FGasAbilityGeneratorParser::FindDefiningSectionHeader(const FManifestData& Data, const FString& AssetName)
+{
+	if (ContainsDefinition(Data.Enumerations, AssetName)) return TEXT("enumerations:");
+	if (ContainsDefinition(Data.InputActions, AssetName)) return TEXT("input_actions:");
+	if (ContainsDefinition(Data.InputMappingContexts, AssetName)) return TEXT("input_mapping_contexts:");
+	if (ContainsDefinition(Data.GameplayEffects, AssetName)) return TEXT("gameplay_effects:");
+	if (ContainsDefinition(Data.GameplayAbilities, AssetName)) return TEXT("gameplay_abilities:");
+	if (ContainsDefinition(Data.ActorBlueprints, AssetName)) return TEXT("actor_blueprints:");
+	if (ContainsDefinition(Data.WidgetBlueprints, AssetName)) return TEXT("widget_blueprints:");
+	if (ContainsDefinition(Data.Blackboards, AssetName)) return TEXT("blackboards:");
+	if (ContainsDefinition(Data.BehaviorTrees, AssetName)) return TEXT("behavior_trees:");
+	if (ContainsDefinition(Data.Materials, AssetName)) return TEXT("materials:");
+	if (ContainsDefinition(Data.MaterialInstances, AssetName)) return TEXT("material_instances:");
+	if (ContainsDefinition(Data.MaterialFunctions, AssetName)) return TEXT("material_functions:");
+	if (ContainsDefinition(Data.EventGraphs, AssetName)) return TEXT("event_graphs:");
+	if (ContainsDefinition(Data.FloatCurves, AssetName)) return TEXT("float_curves:");
+	if (ContainsDefinition(Data.AnimationMontages, AssetName)) return TEXT("animation_montages:");
+	if (ContainsDefinition(Data.AnimationNotifies, AssetName)) return TEXT("animation_notifies:");
+	if (ContainsDefinition(Data.DialogueBlueprints, AssetName)) return TEXT("dialogue_blueprints:");
+	if (ContainsDefinition(Data.EquippableItems, AssetName)) return TEXT("equippable_items:");
+	if (ContainsDefinition(Data.ConsumableItems, AssetName)) return TEXT("consumable_items:");
+	if (ContainsDefinition(Data.AmmoItems, AssetName)) return TEXT("ammo_items:");
+	if (ContainsDefinition(Data.WeaponAttachments, AssetName)) return TEXT("weapon_attachments:");
+	if (ContainsDefinition(Data.Activities, AssetName)) return TEXT("activities:");
+	if (ContainsDefinition(Data.AbilityConfigurations, AssetName)) return TEXT("ability_configurations:");
+	if (ContainsDefinition(Data.ActivityConfigurations, AssetName)) return TEXT("activity_configurations:");
+	if (ContainsDefinition(Data.ItemCollections, AssetName)) return TEXT("item_collections:");
+	if (ContainsDefinition(Data.NarrativeEvents, AssetName)) return TEXT("narrative_events:");
+	if (ContainsDefinition(Data.GameplayCues, AssetName)) return TEXT("gameplay_cues:");
+	if (ContainsDefinition(Data.NPCDefinitions, AssetName)) return TEXT("npc_definitions:");
+	if (ContainsDefinition(Data.CharacterDefinitions, AssetName)) return TEXT("character_definitions:");
+	if (ContainsDefinition(Data.TaggedDialogueSets, AssetName)) return TEXT("tagged_dialogue_sets:");
+	if (ContainsDefinition(Data.NiagaraSystems, AssetName)) return TEXT("niagara_systems:");
+	if (ContainsDefinition(Data.ActivitySchedules, AssetName)) return TEXT("activity_schedules:");
+	if (ContainsDefinition(Data.GoalItems, AssetName)) return TEXT("goal_items:");
+	if (ContainsDefinition(Data.GoalGenerators, AssetName)) return TEXT("goal_generators:");
+	if (ContainsDefinition(Data.BTServices, AssetName)) return TEXT("bt_services:");
+	if (ContainsDefinition(Data.BTTasks, AssetName)) return TEXT("bt_tasks:");
+	if (ContainsDefinition(Data.Quests, AssetName)) return TEXT("quests:");
+	if (ContainsDefinition(Data.CharacterAppearances, AssetName)) return TEXT("character_appearances:");
+	if (ContainsDefinition(Data.TriggerSets, AssetName)) return TEXT("trigger_sets:");
+	if (ContainsDefinition(Data.ComponentBlueprints, AssetName)) return TEXT("component_blueprints:");
+	if (ContainsDefinition(Data.BlueprintConditions, AssetName)) return TEXT("blueprint_conditions:");
+	return nullptr;
+}
 
-	return true;
+int32 FGasAbilityGeneratorParser::ReplaceDefinitions(FManifestData& Into, FManifestData&& Fragment)
+{
+	int32 Count = 0;
+	Count += ReplaceByName(Into.Enumerations, MoveTemp(Fragment.Enumerations));
+	Count += ReplaceByName(Into.InputActions, MoveTemp(Fragment.InputActions));
+	Count += ReplaceByName(Into.InputMappingContexts, MoveTemp(Fragment.InputMappingContexts));
+	Count += ReplaceByName(Into.GameplayEffects, MoveTemp(Fragment.GameplayEffects));
+	Count += ReplaceByName(Into.GameplayAbilities, MoveTemp(Fragment.GameplayAbilities));
+	Count += ReplaceByName(Into.ActorBlueprints, MoveTemp(Fragment.ActorBlueprints));
+	Count += ReplaceByName(Into.WidgetBlueprints, MoveTemp(Fragment.WidgetBlueprints));
+	Count += ReplaceByName(Into.Blackboards, MoveTemp(Fragment.Blackboards));
+	Count += ReplaceByName(Into.BehaviorTrees, MoveTemp(Fragment.BehaviorTrees));
+	Count += ReplaceByName(Into.Materials, MoveTemp(Fragment.Materials));
+	Count += ReplaceByName(Into.MaterialInstances, MoveTemp(Fragment.MaterialInstances));
+	Count += ReplaceByName(Into.MaterialFunctions, MoveTemp(Fragment.MaterialFunctions));
+	Count += ReplaceByName(Into.EventGraphs, MoveTemp(Fragment.EventGraphs));
+	Count += ReplaceByName(Into.FloatCurves, MoveTemp(Fragment.FloatCurves));
+	Count += ReplaceByName(Into.AnimationMontages, MoveTemp(Fragment.AnimationMontages));
+	Count += ReplaceByName(Into.AnimationNotifies, MoveTemp(Fragment.AnimationNotifies));
+	Count += ReplaceByName(Into.DialogueBlueprints, MoveTemp(Fragment.DialogueBlueprints));
+	Count += ReplaceByName(Into.EquippableItems, MoveTemp(Fragment.EquippableItems));
+	Count += ReplaceByName(Into.ConsumableItems, MoveTemp(Fragment.ConsumableItems));
+	Count += ReplaceByName(Into.AmmoItems, MoveTemp(Fragment.AmmoItems));
+	Count += ReplaceByName(Into.WeaponAttachments, MoveTemp(Fragment.WeaponAttachments));
+	Count += ReplaceByName(Into.Activities, MoveTemp(Fragment.Activities));
+	Count += ReplaceByName(Into.AbilityConfigurations, MoveTemp(Fragment.AbilityConfigurations));
+	Count += ReplaceByName(Into.ActivityConfigurations, MoveTemp(Fragment.ActivityConfigurations));
+	Count += ReplaceByName(Into.ItemCollections, MoveTemp(Fragment.ItemCollections));
+	Count += ReplaceByName(Into.NarrativeEvents, MoveTemp(Fragment.NarrativeEvents));
+	Count += ReplaceByName(Into.GameplayCues, MoveTemp(Fragment.GameplayCues));
+	Count += ReplaceByName(Into.NPCDefinitions, MoveTemp(Fragment.NPCDefinitions));
+	Count += ReplaceByName(Into.CharacterDefinitions, MoveTemp(Fragment.CharacterDefinitions));
+	Count += ReplaceByName(Into.TaggedDialogueSets, MoveTemp(Fragment.TaggedDialogueSets));
+	Count += ReplaceByName(Into.NiagaraSystems, MoveTemp(Fragment.NiagaraSystems));
+	Count += ReplaceByName(Into.ActivitySchedules, MoveTemp(Fragment.ActivitySchedules));
+	Count += ReplaceByName(Into.GoalItems, MoveTemp(Fragment.GoalItems));
+	Count += ReplaceByName(Into.GoalGenerators, MoveTemp(Fragment.GoalGenerators));
+	Count += ReplaceByName(Into.BTServices, MoveTemp(Fragment.BTServices));
+	Count += ReplaceByName(Into.BTTasks, MoveTemp(Fragment.BTTasks));
+	Count += ReplaceByName(Into.Quests, MoveTemp(Fragment.Quests));
+	Count += ReplaceByName(Into.CharacterAppearances, MoveTemp(Fragment.CharacterAppearances));
+	Count += ReplaceByName(Into.TriggerSets, MoveTemp(Fragment.TriggerSets));
+	Count += ReplaceByName(Into.ComponentBlueprints, MoveTemp(Fragment.ComponentBlueprints));
+	Count += ReplaceByName(Into.BlueprintConditions, MoveTemp(Fragment.BlueprintConditions));
+	return Count;
 }
 
 bool FGasAbilityGeneratorParser::ParseIncrementalFile(const FString& YamlContent, FString& OutAssetName, FManifestData& OutData)
 {
 	// Parse the incremental file to find asset_name and merge with manifest
-	TArray<FString> Lines;
-	YamlContent.ParseIntoArrayLines(Lines);
+	const FManifestLineStream Lines(YamlContent);
 
 	for (int32 i = 0; i < Lines.Num(); i++)
 	{
-		const FString& Line = Lines[i];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(i));
 
 		if (TrimmedLine.StartsWith(TEXT("asset_name:")))
 		{
@@ -608,69 +1048,61 @@ bool FGasAbilityGeneratorParser::ParseIncrementalFile(const FString& YamlContent
 		return false;
 	}
 
-	// Determine asset type from prefix and parse accordingly
-	if (OutAssetName.StartsWith(TEXT("GA_")))
+	// v7.8.73: Rewrite the file as a one-entry manifest section and run that section's parser, so every
+	// field the manifest supports is honored (was: a few hand-picked GA_/GE_ fields appended as a second entry)
+	const TCHAR* SectionHeader = FindDefiningSectionHeader(OutData, OutAssetName);
+	if (!SectionHeader)
 	{
-		FManifestGameplayAbilityDefinition Def;
-		Def.Name = OutAssetName;
-		// Parse additional fields from the YAML
-		for (const FString& Line : Lines)
-		{
-			FString TrimmedLine = Line.TrimStart();
-			if (TrimmedLine.StartsWith(TEXT("parent_class:")))
-			{
-				Def.ParentClass = GetLineValue(TrimmedLine);
-			}
-			else if (TrimmedLine.StartsWith(TEXT("folder:")))
-			{
-				Def.Folder = GetLineValue(TrimmedLine);
-			}
-			else if (TrimmedLine.StartsWith(TEXT("instancing_policy:")))
-			{
-				Def.InstancingPolicy = GetLineValue(TrimmedLine);
-			}
-			else if (TrimmedLine.StartsWith(TEXT("net_execution_policy:")))
-			{
-				Def.NetExecutionPolicy = GetLineValue(TrimmedLine);
-			}
-		}
-		OutData.GameplayAbilities.Add(Def);
+		UE_LOG(LogGasAbilityParser, Warning, TEXT("Incremental asset '%s' has no manifest definition to update"), *OutAssetName);
+		return false;
 	}
-	else if (OutAssetName.StartsWith(TEXT("GE_")))
+
+	FString SectionText = FString::Printf(TEXT("%s\n  - name: %s\n"), SectionHeader, *OutAssetName);
+	for (int32 i = 0; i < Lines.Num(); i++)
 	{
-		FManifestGameplayEffectDefinition Def;
-		Def.Name = OutAssetName;
-		for (const FString& Line : Lines)
+		if (Lines.IsComment(i))
 		{
-			FString TrimmedLine = Line.TrimStart();
-			if (TrimmedLine.StartsWith(TEXT("duration_policy:")))
-			{
-				Def.DurationPolicy = GetLineValue(TrimmedLine);
-			}
-			else if (TrimmedLine.StartsWith(TEXT("duration_magnitude:")))
+			continue;
+		}
+		if (Lines.GetIndent(i) == 0)
+		{
+			const FStringView Key = Lines.GetKey(i);
+			if (Key.Equals(TEXT("asset_name"), ESearchCase::CaseSensitive) ||
+				Key.Equals(TEXT("asset_type"), ESearchCase::CaseSensitive) ||
+				Key.Equals(TEXT("version"), ESearchCase::CaseSensitive))
 			{
-				Def.DurationMagnitude = FCString::Atof(*GetLineValue(TrimmedLine));
+				continue;
 			}
 		}
-		OutData.GameplayEffects.Add(Def);
+		SectionText += TEXT("    ");
+		SectionText.Append(Lines[i].GetData(), Lines[i].Len());
+		SectionText += TEXT("\n");
 	}
-	// Add more asset type handling as needed
-	
+
+	FManifestData Fragment;
+	const FManifestLineStream SectionLines(SectionText);
+	ParseLineRange(SectionLines, 0, SectionLines.Num(), Fragment);
+	if (ReplaceDefinitions(OutData, MoveTemp(Fragment)) == 0)
+	{
+		UE_LOG(LogGasAbilityParser, Warning, TEXT("Incremental asset '%s' produced no definition"), *OutAssetName);
+		return false;
+	}
+
 	return true;
 }
 
-void FGasAbilityGeneratorParser::ParseTags(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseTags(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++; // Move past section header
 	
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 		
 		// v2.0.9 FIX: Section exit logic
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			LineIndex--; // Back up so main loop can process this line
 			return;
@@ -684,7 +1116,7 @@ void FGasAbilityGeneratorParser::ParseTags(const TArray<FString>& Lines, int32&
 		}
 		
 		// Parse array items
-		if (IsArrayItem(Line))
+		if (Lines.IsArrayItem(LineIndex))
 		{
 			FString RawValue = GetArrayItemValue(Line);
 			
@@ -720,9 +1152,9 @@ void FGasAbilityGeneratorParser::ParseTags(const TArray<FString>& Lines, int32&
 }
 
 // v2.1.8: Parse enumerations section
-void FGasAbilityGeneratorParser::ParseEnumerations(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseEnumerations(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 	
 	FManifestEnumerationDefinition CurrentDef;
@@ -732,11 +1164,10 @@ void FGasAbilityGeneratorParser::ParseEnumerations(const TArray<FString>& Lines,
 	
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 		
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v2.6.14: Prefix validation - only add if E_ prefix
 			if (bInItem && !CurrentDef.Name.IsEmpty() && CurrentDef.Name.StartsWith(TEXT("E_")))
@@ -819,9 +1250,9 @@ void FGasAbilityGeneratorParser::ParseEnumerations(const TArray<FString>& Lines,
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseInputActions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseInputActions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 	
 	FManifestInputActionDefinition CurrentDef;
@@ -829,10 +1260,9 @@ void FGasAbilityGeneratorParser::ParseInputActions(const TArray<FString>& Lines,
 	
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 		
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v2.6.14: Prefix validation - only add if IA_ prefix
 			if (bInItem && !CurrentDef.Name.IsEmpty() && CurrentDef.Name.StartsWith(TEXT("IA_")))
@@ -881,9 +1311,9 @@ void FGasAbilityGeneratorParser::ParseInputActions(const TArray<FString>& Lines,
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseInputMappingContexts(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseInputMappingContexts(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 	
 	FManifestInputMappingContextDefinition CurrentDef;
@@ -891,10 +1321,9 @@ void FGasAbilityGeneratorParser::ParseInputMappingContexts(const TArray<FString>
 	
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 		
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v2.6.14: Prefix validation - only add if IMC_ prefix
 			if (bInItem && !CurrentDef.Name.IsEmpty() && CurrentDef.Name.StartsWith(TEXT("IMC_")))
@@ -934,9 +1363,9 @@ void FGasAbilityGeneratorParser::ParseInputMappingContexts(const TArray<FString>
 
 // v2.3.0: Comprehensive GE parser with all fields
 // v7.8.52: Enhanced with Executions, AttributeBased magnitude, per-modifier tags, conditional effects
-void FGasAbilityGeneratorParser::ParseGameplayEffects(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseGameplayEffects(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestGameplayEffectDefinition CurrentDef;
@@ -962,11 +1391,10 @@ void FGasAbilityGeneratorParser::ParseGameplayEffects(const TArray<FString>& Lin
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save pending execution modifier
 			if (bInExecModifiers && !CurrentExecModifier.CapturedAttribute.IsEmpty())
@@ -1578,9 +2006,9 @@ void FGasAbilityGeneratorParser::ParseGameplayEffects(const TArray<FString>& Lin
 
 // v2.3.0: Updated to parse tags subsection with all tag arrays
 // v2.4.0: Updated to support inline event_graph and variables subsections
-void FGasAbilityGeneratorParser::ParseGameplayAbilities(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseGameplayAbilities(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestGameplayAbilityDefinition CurrentDef;
@@ -1608,11 +2036,10 @@ void FGasAbilityGeneratorParser::ParseGameplayAbilities(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save pending variable
 			if (bInVariables && !CurrentVar.Name.IsEmpty())
@@ -2625,9 +3052,9 @@ void FGasAbilityGeneratorParser::ParseGameplayAbilities(const TArray<FString>& L
 }
 
 // v2.1.7 FIX: Proper indent-based subsection exit logic
-void FGasAbilityGeneratorParser::ParseActorBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseActorBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 	
 	FManifestActorBlueprintDefinition CurrentDef;
@@ -2648,11 +3075,10 @@ void FGasAbilityGeneratorParser::ParseActorBlueprints(const TArray<FString>& Lin
 	
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 		
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInVariables && !CurrentVar.Name.IsEmpty())
 			{
@@ -2811,9 +3237,8 @@ void FGasAbilityGeneratorParser::ParseActorBlueprints(const TArray<FString>& Lin
 				LineIndex++;
 				while (LineIndex < Lines.Num())
 				{
-					const FString& TagLine = Lines[LineIndex];
-					FString TrimmedTagLine = TagLine.TrimStart();
-					int32 TagLineIndent = GetIndentLevel(TagLine);
+					const FString TrimmedTagLine(Lines.GetTrimmed(LineIndex));
+					int32 TagLineIndent = Lines.GetIndent(LineIndex);
 
 					if (TagLineIndent <= TagIndent && !TrimmedTagLine.StartsWith(TEXT("-")))
 					{
@@ -2843,9 +3268,8 @@ void FGasAbilityGeneratorParser::ParseActorBlueprints(const TArray<FString>& Lin
 				LineIndex++;
 				while (LineIndex < Lines.Num())
 				{
-					const FString& TagLine = Lines[LineIndex];
-					FString TrimmedTagLine = TagLine.TrimStart();
-					int32 TagLineIndent = GetIndentLevel(TagLine);
+					const FString TrimmedTagLine(Lines.GetTrimmed(LineIndex));
+					int32 TagLineIndent = Lines.GetIndent(LineIndex);
 
 					if (TagLineIndent <= TagIndent && !TrimmedTagLine.StartsWith(TEXT("-")))
 					{
@@ -2875,9 +3299,8 @@ void FGasAbilityGeneratorParser::ParseActorBlueprints(const TArray<FString>& Lin
 				LineIndex++;
 				while (LineIndex < Lines.Num())
 				{
-					const FString& TagLine = Lines[LineIndex];
-					FString TrimmedTagLine = TagLine.TrimStart();
-					int32 TagLineIndent = GetIndentLevel(TagLine);
+					const FString TrimmedTagLine(Lines.GetTrimmed(LineIndex));
+					int32 TagLineIndent = Lines.GetIndent(LineIndex);
 
 					if (TagLineIndent <= TagIndent && !TrimmedTagLine.StartsWith(TEXT("-")))
 					{
@@ -3297,9 +3720,9 @@ void FGasAbilityGeneratorParser::ParseActorBlueprints(const TArray<FString>& Lin
 
 // v2.1.7 FIX: Proper indent-based subsection exit logic
 // v4.3: Added widget_tree parsing for full visual layout automation
-void FGasAbilityGeneratorParser::ParseWidgetBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseWidgetBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestWidgetBlueprintDefinition CurrentDef;
@@ -3321,11 +3744,10 @@ void FGasAbilityGeneratorParser::ParseWidgetBlueprints(const TArray<FString>& Li
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v4.3: Save pending widget
 			if (bInWidgetDef && !CurrentWidget.Id.IsEmpty())
@@ -3655,9 +4077,9 @@ void FGasAbilityGeneratorParser::ParseWidgetBlueprints(const TArray<FString>& Li
 }
 
 // v4.19: Parse component_blueprints section
-void FGasAbilityGeneratorParser::ParseComponentBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseComponentBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestComponentBlueprintDefinition CurrentDef;
@@ -3681,11 +4103,10 @@ void FGasAbilityGeneratorParser::ParseComponentBlueprints(const TArray<FString>&
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save any pending items
 			if (bInVariables && !CurrentVar.Name.IsEmpty())
@@ -4105,9 +4526,9 @@ void FGasAbilityGeneratorParser::ParseComponentBlueprints(const TArray<FString>&
 }
 
 // v7.8.52: Parse blueprint_conditions section for UNarrativeCondition blueprints
-void FGasAbilityGeneratorParser::ParseBlueprintConditions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseBlueprintConditions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestBlueprintConditionDefinition CurrentDef;
@@ -4121,9 +4542,8 @@ void FGasAbilityGeneratorParser::ParseBlueprintConditions(const TArray<FString>&
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		// Skip empty lines and comments
 		if (TrimmedLine.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
@@ -4297,9 +4717,9 @@ void FGasAbilityGeneratorParser::ParseBlueprintConditions(const TArray<FString>&
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseBlackboards(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseBlackboards(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestBlackboardDefinition CurrentDef;
@@ -4311,10 +4731,9 @@ void FGasAbilityGeneratorParser::ParseBlackboards(const TArray<FString>& Lines,
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v4.0: Save any pending key
 			if (bInKeyDef && !CurrentKey.Name.IsEmpty())
@@ -4432,9 +4851,9 @@ void FGasAbilityGeneratorParser::ParseBlackboards(const TArray<FString>& Lines,
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseBehaviorTrees(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseBehaviorTrees(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestBehaviorTreeDefinition CurrentDef;
@@ -4450,11 +4869,10 @@ void FGasAbilityGeneratorParser::ParseBehaviorTrees(const TArray<FString>& Lines
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save current node if valid
 			if (bInNodes && !CurrentNode.Id.IsEmpty())
@@ -4751,9 +5169,9 @@ void FGasAbilityGeneratorParser::ParseBehaviorTrees(const TArray<FString>& Lines
 }
 
 // v2.6.12: Enhanced material parser with expression graph support
-void FGasAbilityGeneratorParser::ParseMaterials(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseMaterials(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestMaterialDefinition CurrentDef;
@@ -4770,11 +5188,10 @@ void FGasAbilityGeneratorParser::ParseMaterials(const TArray<FString>& Lines, in
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save pending expression/connection
 			if (bInExpression && !CurrentExpr.Id.IsEmpty())
@@ -5098,9 +5515,9 @@ void FGasAbilityGeneratorParser::ParseMaterials(const TArray<FString>& Lines, in
 
 // v2.6.12: Parse material_functions section
 // v3.9.7: Fixed multi-item parsing with indent-based subsection detection
-void FGasAbilityGeneratorParser::ParseMaterialFunctions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseMaterialFunctions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestMaterialFunctionDefinition CurrentDef;
@@ -5122,11 +5539,10 @@ void FGasAbilityGeneratorParser::ParseMaterialFunctions(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);  // v3.9.7: Track indent level
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);  // v3.9.7: Track indent level
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save all pending items
 			if (bInInput && !CurrentInput.Name.IsEmpty()) CurrentDef.Inputs.Add(CurrentInput);
@@ -5351,9 +5767,9 @@ void FGasAbilityGeneratorParser::ParseMaterialFunctions(const TArray<FString>& L
 }
 
 // v4.9: Parse material_instances section
-void FGasAbilityGeneratorParser::ParseMaterialInstances(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseMaterialInstances(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestMaterialInstanceDefinition CurrentDef;
@@ -5371,11 +5787,10 @@ void FGasAbilityGeneratorParser::ParseMaterialInstances(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save pending items
 			if (bInScalar && !CurrentScalar.Name.IsEmpty()) CurrentDef.ScalarParams.Add(CurrentScalar);
@@ -5595,9 +6010,9 @@ void FGasAbilityGeneratorParser::ParseMaterialInstances(const TArray<FString>& L
 }
 
 // v2.2.0: Parse event_graphs section
-void FGasAbilityGeneratorParser::ParseEventGraphs(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseEventGraphs(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestEventGraphDefinition CurrentGraph;
@@ -5606,11 +6021,10 @@ void FGasAbilityGeneratorParser::ParseEventGraphs(const TArray<FString>& Lines,
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentGraph.Name.IsEmpty())
 			{
@@ -5687,7 +6101,7 @@ void FGasAbilityGeneratorParser::ParseEventGraphs(const TArray<FString>& Lines,
 
 // v2.2.0: Parse graph nodes subsection
 // v2.8.2: Added nested parameters support for CallFunction nodes
-void FGasAbilityGeneratorParser::ParseGraphNodes(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph)
+void FGasAbilityGeneratorParser::ParseGraphNodes(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph)
 {
 	FManifestGraphNodeDefinition CurrentNode;
 	bool bInNode = false;
@@ -5699,9 +6113,8 @@ void FGasAbilityGeneratorParser::ParseGraphNodes(const TArray<FString>& Lines, i
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		// Exit if we're back at or before subsection level with a new section
 		if (!TrimmedLine.IsEmpty() && !TrimmedLine.StartsWith(TEXT("#")))
@@ -5877,7 +6290,7 @@ void FGasAbilityGeneratorParser::ParseGraphNodes(const TArray<FString>& Lines, i
 }
 
 // v2.2.0: Parse graph connections subsection
-void FGasAbilityGeneratorParser::ParseGraphConnections(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph)
+void FGasAbilityGeneratorParser::ParseGraphConnections(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph)
 {
 	FManifestGraphConnectionDefinition CurrentConn;
 	bool bInConnection = false;
@@ -5885,9 +6298,8 @@ void FGasAbilityGeneratorParser::ParseGraphConnections(const TArray<FString>& Li
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		// Exit if we're back at or before subsection level with a new section
 		if (!TrimmedLine.IsEmpty() && !TrimmedLine.StartsWith(TEXT("#")))
@@ -5996,7 +6408,7 @@ FManifestGraphPinReference FGasAbilityGeneratorParser::ParsePinReference(const F
 // v2.8.3: Function Override Parser
 // ============================================================================
 
-void FGasAbilityGeneratorParser::ParseFunctionOverrides(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestFunctionOverrideDefinition>& OutOverrides)
+void FGasAbilityGeneratorParser::ParseFunctionOverrides(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestFunctionOverrideDefinition>& OutOverrides)
 {
 	FManifestFunctionOverrideDefinition CurrentOverride;
 	bool bInOverride = false;
@@ -6006,9 +6418,8 @@ void FGasAbilityGeneratorParser::ParseFunctionOverrides(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		// Exit if we're back at or before subsection level with a new section
 		if (!TrimmedLine.IsEmpty() && !TrimmedLine.StartsWith(TEXT("#")))
@@ -6090,7 +6501,7 @@ void FGasAbilityGeneratorParser::ParseFunctionOverrides(const TArray<FString>& L
 // v4.14: Custom Blueprint Function Parser (new functions, not overrides)
 // ============================================================================
 
-void FGasAbilityGeneratorParser::ParseCustomFunctions(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestCustomFunctionDefinition>& OutFunctions)
+void FGasAbilityGeneratorParser::ParseCustomFunctions(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestCustomFunctionDefinition>& OutFunctions)
 {
 	FManifestCustomFunctionDefinition CurrentFunction;
 	FManifestFunctionParameterDefinition CurrentParam;
@@ -6103,9 +6514,8 @@ void FGasAbilityGeneratorParser::ParseCustomFunctions(const TArray<FString>& Lin
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		// Exit if we're back at or before subsection level with a new section
 		if (!TrimmedLine.IsEmpty() && !TrimmedLine.StartsWith(TEXT("#")))
@@ -6292,9 +6702,9 @@ void FGasAbilityGeneratorParser::ParseCustomFunctions(const TArray<FString>& Lin
 // v2.3.0: New Asset Type Parsers
 // ============================================================================
 
-void FGasAbilityGeneratorParser::ParseFloatCurves(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseFloatCurves(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestFloatCurveDefinition CurrentDef;
@@ -6306,10 +6716,9 @@ void FGasAbilityGeneratorParser::ParseFloatCurves(const TArray<FString>& Lines,
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v4.0: Save any pending key
 			if (bInKeyDef && (CurrentKey.Time != 0.0f || CurrentKey.Value != 0.0f))
@@ -6452,9 +6861,9 @@ void FGasAbilityGeneratorParser::ParseFloatCurves(const TArray<FString>& Lines,
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseAnimationMontages(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseAnimationMontages(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestAnimationMontageDefinition CurrentDef;
@@ -6463,10 +6872,9 @@ void FGasAbilityGeneratorParser::ParseAnimationMontages(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v2.6.14: Prefix validation - only add if AM_ prefix
 			if (bInItem && !CurrentDef.Name.IsEmpty() && CurrentDef.Name.StartsWith(TEXT("AM_")))
@@ -6535,9 +6943,9 @@ void FGasAbilityGeneratorParser::ParseAnimationMontages(const TArray<FString>& L
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseAnimationNotifies(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseAnimationNotifies(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestAnimationNotifyDefinition CurrentDef;
@@ -6554,10 +6962,10 @@ void FGasAbilityGeneratorParser::ParseAnimationNotifies(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save pending node before exit
 			if (bInEventNodes && !CurrentNode.Id.IsEmpty())
@@ -6804,9 +7212,9 @@ void FGasAbilityGeneratorParser::ParseAnimationNotifies(const TArray<FString>& L
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseDialogueBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseDialogueBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestDialogueBlueprintDefinition CurrentDef;
@@ -6844,11 +7252,10 @@ void FGasAbilityGeneratorParser::ParseDialogueBlueprints(const TArray<FString>&
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInVariables && !CurrentVar.Name.IsEmpty())
 			{
@@ -7655,9 +8062,9 @@ void FGasAbilityGeneratorParser::ParseDialogueBlueprints(const TArray<FString>&
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseEquippableItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseEquippableItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestEquippableItemDefinition CurrentDef;
@@ -7706,10 +8113,10 @@ void FGasAbilityGeneratorParser::ParseEquippableItems(const TArray<FString>& Lin
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v4.28: Save pending fragment before adding item
 			if (bInFragments && !CurrentFragment.Class.IsEmpty())
@@ -9037,11 +9444,11 @@ void FGasAbilityGeneratorParser::ParseEquippableItems(const TArray<FString>& Lin
 
 // v4.28: Option C manifest section - consumable_items (UGameplayEffectItem)
 // Per Item_Generation_Capability_Audit.md Section 1.1
-void FGasAbilityGeneratorParser::ParseConsumableItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseConsumableItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
 	// Uses same parsing logic as equippable_items but stores to ConsumableItems array
 	// Consumable items don't require EI_ prefix - they use CI_ or any name
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestEquippableItemDefinition CurrentDef;
@@ -9049,10 +9456,9 @@ void FGasAbilityGeneratorParser::ParseConsumableItems(const TArray<FString>& Lin
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Name.IsEmpty())
 			{
@@ -9106,9 +9512,9 @@ void FGasAbilityGeneratorParser::ParseConsumableItems(const TArray<FString>& Lin
 
 // v4.28: Option C manifest section - ammo_items (UAmmoItem)
 // Per Item_Generation_Capability_Audit.md Section 1.1
-void FGasAbilityGeneratorParser::ParseAmmoItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseAmmoItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestEquippableItemDefinition CurrentDef;
@@ -9119,10 +9525,9 @@ void FGasAbilityGeneratorParser::ParseAmmoItems(const TArray<FString>& Lines, in
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInFragments && !CurrentFragment.Class.IsEmpty())
 			{
@@ -9232,9 +9637,9 @@ void FGasAbilityGeneratorParser::ParseAmmoItems(const TArray<FString>& Lines, in
 
 // v4.28: Option C manifest section - weapon_attachments (UWeaponAttachmentItem)
 // Per Item_Generation_Capability_Audit.md Section 1.1
-void FGasAbilityGeneratorParser::ParseWeaponAttachments(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseWeaponAttachments(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestEquippableItemDefinition CurrentDef;
@@ -9242,10 +9647,9 @@ void FGasAbilityGeneratorParser::ParseWeaponAttachments(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Name.IsEmpty())
 			{
@@ -9298,9 +9702,9 @@ void FGasAbilityGeneratorParser::ParseWeaponAttachments(const TArray<FString>& L
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseActivities(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseActivities(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestActivityDefinition CurrentDef;
@@ -9316,10 +9720,9 @@ void FGasAbilityGeneratorParser::ParseActivities(const TArray<FString>& Lines, i
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v7.8.52: Save final variable if exists
 			if (bInVariables && !CurrentVar.Name.IsEmpty())
@@ -9537,9 +9940,9 @@ void FGasAbilityGeneratorParser::ParseActivities(const TArray<FString>& Lines, i
 }
 
 // v7.8.52: Blueprint Trigger parsing (BPT_ assets for quest tasks and schedule triggers)
-void FGasAbilityGeneratorParser::ParseBlueprintTriggers(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseBlueprintTriggers(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestBlueprintTriggerDefinition CurrentDef;
@@ -9550,10 +9953,9 @@ void FGasAbilityGeneratorParser::ParseBlueprintTriggers(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save final variable if exists
 			if (bInVariables && !CurrentVar.Name.IsEmpty())
@@ -9760,9 +10162,9 @@ void FGasAbilityGeneratorParser::ParseBlueprintTriggers(const TArray<FString>& L
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseAbilityConfigurations(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseAbilityConfigurations(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestAbilityConfigurationDefinition CurrentDef;
@@ -9772,10 +10174,9 @@ void FGasAbilityGeneratorParser::ParseAbilityConfigurations(const TArray<FString
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Name.IsEmpty())
 			{
@@ -9861,9 +10262,9 @@ void FGasAbilityGeneratorParser::ParseAbilityConfigurations(const TArray<FString
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseActivityConfigurations(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseActivityConfigurations(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestActivityConfigurationDefinition CurrentDef;
@@ -9873,10 +10274,9 @@ void FGasAbilityGeneratorParser::ParseActivityConfigurations(const TArray<FStrin
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Name.IsEmpty())
 			{
@@ -9973,9 +10373,9 @@ void FGasAbilityGeneratorParser::ParseActivityConfigurations(const TArray<FStrin
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseItemCollections(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseItemCollections(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestItemCollectionDefinition CurrentDef;
@@ -9984,10 +10384,9 @@ void FGasAbilityGeneratorParser::ParseItemCollections(const TArray<FString>& Lin
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Name.IsEmpty())
 			{
@@ -10049,9 +10448,9 @@ void FGasAbilityGeneratorParser::ParseItemCollections(const TArray<FString>& Lin
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseNarrativeEvents(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseNarrativeEvents(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestNarrativeEventDefinition CurrentDef;
@@ -10090,10 +10489,9 @@ void FGasAbilityGeneratorParser::ParseNarrativeEvents(const TArray<FString>& Lin
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			SaveCurrentCondition();  // v4.3: Save pending condition
 			SaveCurrentVariable();   // v7.8.52: Save pending variable
@@ -10377,9 +10775,9 @@ void FGasAbilityGeneratorParser::ParseNarrativeEvents(const TArray<FString>& Lin
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseNPCDefinitions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseNPCDefinitions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestNPCDefinitionDefinition CurrentDef;
@@ -10431,10 +10829,9 @@ void FGasAbilityGeneratorParser::ParseNPCDefinitions(const TArray<FString>& Line
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// v3.9.5: Save any pending loot table roll
 			if (bInItemDef) SaveCurrentItemDef();
@@ -10893,9 +11290,9 @@ void FGasAbilityGeneratorParser::ParseNPCDefinitions(const TArray<FString>& Line
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseCharacterDefinitions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseCharacterDefinitions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestCharacterDefinitionDefinition CurrentDef;
@@ -10907,10 +11304,9 @@ void FGasAbilityGeneratorParser::ParseCharacterDefinitions(const TArray<FString>
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Name.IsEmpty())
 			{
@@ -11061,9 +11457,9 @@ void FGasAbilityGeneratorParser::ParseCharacterDefinitions(const TArray<FString>
 }
 
 // v4.8.3: CharacterAppearance parser - creates UCharacterAppearance data assets
-void FGasAbilityGeneratorParser::ParseCharacterAppearances(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseCharacterAppearances(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestCharacterAppearanceDefinition CurrentDef;
@@ -11076,10 +11472,9 @@ void FGasAbilityGeneratorParser::ParseCharacterAppearances(const TArray<FString>
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Name.IsEmpty())
 			{
@@ -11222,9 +11617,9 @@ void FGasAbilityGeneratorParser::ParseCharacterAppearances(const TArray<FString>
 }
 
 // v4.9: TriggerSet parser - creates UTriggerSet DataAssets with instanced triggers
-void FGasAbilityGeneratorParser::ParseTriggerSets(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseTriggerSets(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestTriggerSetDefinition CurrentSet;
@@ -11242,11 +11637,10 @@ void FGasAbilityGeneratorParser::ParseTriggerSets(const TArray<FString>& Lines,
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save any pending event
 			if (bInEvent && !CurrentEvent.EventClass.IsEmpty())
@@ -11430,9 +11824,9 @@ void FGasAbilityGeneratorParser::ParseTriggerSets(const TArray<FString>& Lines,
 }
 
 // v2.5.7: TaggedDialogueSet parser - creates UTaggedDialogueSet data assets
-void FGasAbilityGeneratorParser::ParseTaggedDialogueSets(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseTaggedDialogueSets(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestTaggedDialogueSetDefinition CurrentSet;
@@ -11444,11 +11838,10 @@ void FGasAbilityGeneratorParser::ParseTaggedDialogueSets(const TArray<FString>&
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save any pending dialogue
 			if (bInDialogueItem && !CurrentDialogue.Tag.IsEmpty())
@@ -11573,6 +11966,116 @@ void FGasAbilityGeneratorParser::ParseTaggedDialogueSets(const TArray<FString>&
 	}
 }
 
+// v7.8.58: Single-pass tokenizer - one scan over the buffer produces every line's
+// raw text, trimmed text, indent, array-item flag and key/value split.
+// Line terminators and empty-line culling match FString::ParseIntoArrayLines().
+// v7.8.83: Lines are stored as offsets into Source, not as copied strings
+void FManifestLineStream::Tokenize(const FString& Content)
+{
+	Source = Content;
+	Tokens.Reset();
+
+	const TCHAR* Data = *Source;
+	const int32 Len = Source.Len();
+
+	// Manifest lines average well over 16 chars - avoids regrowth on large documents
+	Tokens.Reserve(Len / 16 + 1);
+
+	int32 Pos = 0;
+	int32 LineNumber = 1;
+	while (Pos < Len)
+	{
+		const int32 LineStart = Pos;
+		while (Pos < Len && Data[Pos] != TEXT('\n') && Data[Pos] != TEXT('\r'))
+		{
+			++Pos;
+		}
+
+		const int32 LineLen = Pos - LineStart;
+		if (LineLen > 0)
+		{
+			const TCHAR* Text = Data + LineStart;
+
+			FManifestLineToken& Token = Tokens.AddDefaulted_GetRef();
+			Token.Offset = LineStart;
+			Token.Length = LineLen;
+			Token.LineNumber = LineNumber;
+
+			// Indent uses the GetIndentLevel rule (tab = 2 spaces)
+			for (int32 i = 0; i < LineLen; i++)
+			{
+				if (Text[i] == TEXT(' '))
+				{
+					Token.Indent++;
+				}
+				else if (Text[i] == TEXT('\t'))
+				{
+					Token.Indent += 2;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			// Trim uses the TrimStart rule (any whitespace)
+			int32 TrimOffset = 0;
+			while (TrimOffset < LineLen && FChar::IsWhitespace(Text[TrimOffset]))
+			{
+				++TrimOffset;
+			}
+			const TCHAR* Trimmed = Text + TrimOffset;
+			const int32 TrimmedLen = LineLen - TrimOffset;
+			Token.TrimOffset = TrimOffset;
+
+			Token.bComment = TrimmedLen > 0 && Trimmed[0] == TEXT('#');
+			Token.bArrayItem = TrimmedLen > 1 && Trimmed[0] == TEXT('-') && Trimmed[1] == TEXT(' ');
+			for (int32 i = 0; i < TrimmedLen; i++)
+			{
+				if (Trimmed[i] == TEXT(':'))
+				{
+					Token.KeyLen = i;
+					break;
+				}
+			}
+		}
+
+		// "\r\n" is a single terminator
+		if (Pos < Len)
+		{
+			Pos += (Data[Pos] == TEXT('\r') && Pos + 1 < Len && Data[Pos + 1] == TEXT('\n')) ? 2 : 1;
+		}
+		++LineNumber;
+	}
+}
+
+FStringView FManifestLineStream::GetKey(int32 Index) const
+{
+	const FManifestLineToken& Token = Tokens[Index];
+	if (!Token.HasColon())
+	{
+		return FStringView();
+	}
+
+	FStringView Key = GetTrimmed(Index).Left(Token.KeyLen);
+	if (Token.bArrayItem)
+	{
+		Key.RightChopInline(2);
+	}
+	return Key.TrimStartAndEnd();
+}
+
+FStringView FManifestLineStream::GetRawValue(int32 Index) const
+{
+	const FManifestLineToken& Token = Tokens[Index];
+	if (!Token.HasColon())
+	{
+		return FStringView();
+	}
+
+	return GetTrimmed(Index).RightChop(Token.KeyLen + 1).TrimStartAndEnd();
+}
+
 // v3.9.10: Strip YAML inline comments from values
 // Handles: "value  # comment" -> "value"
 // Preserves: "value with # in quotes" (when quoted)
@@ -11707,6 +12210,18 @@ bool FGasAbilityGeneratorParser::IsSectionHeader(const FString& Line, const FStr
 	return TrimmedLine.Equals(SectionName) || TrimmedLine.StartsWith(SectionName);
 }
 
+// v7.8.58: Token-based variant - same rule as the FString overload without re-trimming
+bool FGasAbilityGeneratorParser::ShouldExitSection(const FManifestLineStream& Lines, int32 LineIndex, int32 SectionIndent)
+{
+	const FManifestLineToken& Token = Lines.GetToken(LineIndex);
+	if (Lines.GetTrimmed(LineIndex).IsEmpty() || Token.bComment)
+	{
+		return false;
+	}
+
+	return Token.Indent <= SectionIndent && Token.HasColon();
+}
+
 bool FGasAbilityGeneratorParser::ShouldExitSection(const FString& Line, int32 SectionIndent)
 {
 	// Skip empty lines - don't exit section for them
@@ -11736,9 +12251,9 @@ bool FGasAbilityGeneratorParser::ShouldExitSection(const FString& Line, int32 Se
 
 // v2.6.10: Niagara System parser - creates UNiagaraSystem assets with enhanced properties
 // v2.6.11: Added user_parameters parsing support
-void FGasAbilityGeneratorParser::ParseNiagaraSystems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseNiagaraSystems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestNiagaraSystemDefinition CurrentDef;
@@ -11758,11 +12273,10 @@ void FGasAbilityGeneratorParser::ParseNiagaraSystems(const TArray<FString>& Line
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save any pending user parameter
 			if (bInUserParameters && !CurrentUserParam.Name.IsEmpty())
@@ -12312,9 +12826,9 @@ void FGasAbilityGeneratorParser::ParseNiagaraSystems(const TArray<FString>& Line
 // v4.9: FX Preset Parsing
 // ============================================================================
 
-void FGasAbilityGeneratorParser::ParseFXPresets(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseFXPresets(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestFXPresetDefinition CurrentDef;
@@ -12323,11 +12837,10 @@ void FGasAbilityGeneratorParser::ParseFXPresets(const TArray<FString>& Lines, in
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			// Save pending item - accept FX_ or Preset_ prefix, or any name
 			if (bInItem && !CurrentDef.Name.IsEmpty())
@@ -12408,9 +12921,9 @@ void FGasAbilityGeneratorParser::ParseFXPresets(const TArray<FString>& Lines, in
 // v3.9: NPC Pipeline Parsing
 // ============================================================================
 
-void FGasAbilityGeneratorParser::ParseActivitySchedules(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseActivitySchedules(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestActivityScheduleDefinition CurrentDef;
@@ -12421,9 +12934,9 @@ void FGasAbilityGeneratorParser::ParseActivitySchedules(const TArray<FString>& L
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
@@ -12527,9 +13040,9 @@ void FGasAbilityGeneratorParser::ParseActivitySchedules(const TArray<FString>& L
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseGoalItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseGoalItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestGoalItemDefinition CurrentDef;
@@ -12543,9 +13056,9 @@ void FGasAbilityGeneratorParser::ParseGoalItems(const TArray<FString>& Lines, in
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
@@ -12769,9 +13282,9 @@ void FGasAbilityGeneratorParser::ParseGoalItems(const TArray<FString>& Lines, in
 }
 
 // v7.8.52: GoalGenerators - Blueprint classes that generate goals dynamically
-void FGasAbilityGeneratorParser::ParseGoalGenerators(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseGoalGenerators(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestGoalGeneratorDefinition CurrentDef;
@@ -12781,9 +13294,9 @@ void FGasAbilityGeneratorParser::ParseGoalGenerators(const TArray<FString>& Line
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
@@ -12911,9 +13424,9 @@ void FGasAbilityGeneratorParser::ParseGoalGenerators(const TArray<FString>& Line
 }
 
 // v7.8.52: GameplayCue parser - creates GC_ Blueprint assets
-void FGasAbilityGeneratorParser::ParseGameplayCues(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseGameplayCues(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestGameplayCueDefinition CurrentDef;
@@ -12946,9 +13459,9 @@ void FGasAbilityGeneratorParser::ParseGameplayCues(const TArray<FString>& Lines,
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
@@ -13182,7 +13695,7 @@ void FGasAbilityGeneratorParser::ParseGameplayCues(const TArray<FString>& Lines,
 						// Look ahead for type
 						if (LineIndex + 1 < Lines.Num())
 						{
-							FString NextLine = Lines[LineIndex + 1].TrimStart();
+							FString NextLine(Lines.GetTrimmed(LineIndex + 1));
 							if (NextLine.StartsWith(TEXT("type:")))
 							{
 								Param.Type = GetLineValue(NextLine);
@@ -13492,9 +14005,9 @@ void FGasAbilityGeneratorParser::ParseGameplayCues(const TArray<FString>& Lines,
 // ============================================================================
 // v7.8.52: ParseBTServices - BTS_ Blueprint assets
 // ============================================================================
-void FGasAbilityGeneratorParser::ParseBTServices(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseBTServices(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestBTServiceBPDefinition CurrentDef;
@@ -13505,10 +14018,9 @@ void FGasAbilityGeneratorParser::ParseBTServices(const TArray<FString>& Lines, i
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInService && !CurrentDef.Name.IsEmpty())
 			{
@@ -13638,9 +14150,9 @@ void FGasAbilityGeneratorParser::ParseBTServices(const TArray<FString>& Lines, i
 // ============================================================================
 // v7.8.52: ParseBTTasks - BTTask_ Blueprint assets
 // ============================================================================
-void FGasAbilityGeneratorParser::ParseBTTasks(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseBTTasks(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestBTTaskBPDefinition CurrentDef;
@@ -13651,10 +14163,9 @@ void FGasAbilityGeneratorParser::ParseBTTasks(const TArray<FString>& Lines, int3
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInTask && !CurrentDef.Name.IsEmpty())
 			{
@@ -13773,10 +14284,10 @@ void FGasAbilityGeneratorParser::ParseBTTasks(const TArray<FString>& Lines, int3
 	}
 }
 
-void FGasAbilityGeneratorParser::ParseQuests(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseQuests(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
 	// v3.9.4: Updated parser for nested branches-in-states structure
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestQuestDefinition CurrentQuest;
@@ -13873,9 +14384,9 @@ void FGasAbilityGeneratorParser::ParseQuests(const TArray<FString>& Lines, int32
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
@@ -14292,17 +14803,16 @@ void FGasAbilityGeneratorParser::ParseQuests(const TArray<FString>& Lines, int32
 }
 
 // v3.9.8: Pipeline Config parser
-void FGasAbilityGeneratorParser::ParsePipelineConfig(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParsePipelineConfig(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			LineIndex--;
 			return;
@@ -14334,9 +14844,9 @@ void FGasAbilityGeneratorParser::ParsePipelineConfig(const TArray<FString>& Line
 }
 
 // v3.9.8: Pipeline Items parser
-void FGasAbilityGeneratorParser::ParsePipelineItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParsePipelineItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestPipelineItemDefinition CurrentDef;
@@ -14346,10 +14856,9 @@ void FGasAbilityGeneratorParser::ParsePipelineItems(const TArray<FString>& Lines
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInItem && !CurrentDef.Mesh.IsEmpty())
 			{
@@ -14452,9 +14961,9 @@ void FGasAbilityGeneratorParser::ParsePipelineItems(const TArray<FString>& Lines
 }
 
 // v3.9.8: Pipeline Collections parser
-void FGasAbilityGeneratorParser::ParsePipelineCollections(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParsePipelineCollections(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestPipelineCollectionDefinition CurrentDef;
@@ -14462,10 +14971,9 @@ void FGasAbilityGeneratorParser::ParsePipelineCollections(const TArray<FString>&
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInCollection && !CurrentDef.Name.IsEmpty())
 			{
@@ -14512,9 +15020,9 @@ void FGasAbilityGeneratorParser::ParsePipelineCollections(const TArray<FString>&
 }
 
 // v3.9.8: Pipeline Loadouts parser
-void FGasAbilityGeneratorParser::ParsePipelineLoadouts(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParsePipelineLoadouts(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;
 
 	FManifestPipelineLoadoutDefinition CurrentDef;
@@ -14523,10 +15031,9 @@ void FGasAbilityGeneratorParser::ParsePipelineLoadouts(const TArray<FString>& Li
 
 	while (LineIndex < Lines.Num())
 	{
-		const FString& Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
 
-		if (ShouldExitSection(Line, SectionIndent))
+		if (ShouldExitSection(Lines, LineIndex, SectionIndent))
 		{
 			if (bInLoadout && !CurrentDef.NPCDefinition.IsEmpty())
 			{
@@ -14674,9 +15181,9 @@ FRotator FGasAbilityGeneratorParser::ParseRotatorFromString(const FString& Rotat
 }
 
 // v3.9.9: Parse POI Placements
-void FGasAbilityGeneratorParser::ParsePOIPlacements(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParsePOIPlacements(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestPOIPlacement CurrentDef;
@@ -14685,9 +15192,9 @@ void FGasAbilityGeneratorParser::ParsePOIPlacements(const TArray<FString>& Lines
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
@@ -14791,9 +15298,9 @@ void FGasAbilityGeneratorParser::ParsePOIPlacements(const TArray<FString>& Lines
 }
 
 // v3.9.9: Parse NPC Spawner Placements
-void FGasAbilityGeneratorParser::ParseNPCSpawnerPlacements(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseNPCSpawnerPlacements(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestNPCSpawnerPlacement CurrentDef;
@@ -14807,9 +15314,9 @@ void FGasAbilityGeneratorParser::ParseNPCSpawnerPlacements(const TArray<FString>
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
@@ -15096,9 +15603,9 @@ void FGasAbilityGeneratorParser::ParseNPCSpawnerPlacements(const TArray<FString>
 //       invulnerable: true
 //     - form: Crawler
 //       invulnerable: false
-void FGasAbilityGeneratorParser::ParseFormStateEffects(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData)
+void FGasAbilityGeneratorParser::ParseFormStateEffects(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData)
 {
-	int32 SectionIndent = GetIndentLevel(Lines[LineIndex]);
+	int32 SectionIndent = Lines.GetIndent(LineIndex);
 	LineIndex++;  // Skip header
 
 	FManifestFormStateEffectDefinition CurrentDef;
@@ -15106,9 +15613,9 @@ void FGasAbilityGeneratorParser::ParseFormStateEffects(const TArray<FString>& Li
 
 	while (LineIndex < Lines.Num())
 	{
-		FString Line = Lines[LineIndex];
-		FString TrimmedLine = Line.TrimStart();
-		int32 CurrentIndent = GetIndentLevel(Line);
+		const FString Line(Lines[LineIndex]);
+		const FString TrimmedLine(Lines.GetTrimmed(LineIndex));
+		int32 CurrentIndent = Lines.GetIndent(LineIndex);
 
 		if (Line.IsEmpty() || TrimmedLine.StartsWith(TEXT("#")))
 		{
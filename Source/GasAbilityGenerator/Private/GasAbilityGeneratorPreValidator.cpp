@@ -1,5 +1,7 @@
-// GasAbilityGenerator v4.29 - Phase 4.1 Pre-Validation System with Function Resolution Parity
+// GasAbilityGenerator v7.8.58 - Phase 4.1 Pre-Validation System with Function Resolution Parity
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v4.29: Phase 4.1 pre-validation with function resolution parity
+// v7.8.58: Issues carry manifest line numbers recorded by the parser's token stream
 
 #include "GasAbilityGeneratorPreValidator.h"
 #include "Locked/GasAbilityGeneratorTypes.h"
@@ -183,6 +185,24 @@ FPreValidationReport FPreValidator::Validate(const FManifestData& Data, const FS
 	ValidateNPCReferences(Data, Report, Cache, ManifestPath);
 	ValidateRedundantCasts(Data, Report, Cache, ManifestPath);  // v7.8.3: Type-aware redundant cast detection
 
+	// v7.8.58: Attach manifest line numbers recorded by the parser's token stream
+	if (Data.SourceLineNumbers.Num() > 0)
+	{
+		auto StampLines = [&Data](TArray<FPreValidationIssue>& Issues)
+		{
+			for (FPreValidationIssue& Issue : Issues)
+			{
+				if (const int32* Line = Data.SourceLineNumbers.Find(Issue.ItemId))
+				{
+					Issue.ManifestLine = *Line;
+				}
+			}
+		};
+		StampLines(Report.Errors);
+		StampLines(Report.Warnings);
+		StampLines(Report.Infos);
+	}
+
 	// Update caching stats
 	Report.TotalChecks = Cache.GetHitCount() + Cache.GetMissCount();
 	Report.CacheHits = Cache.GetHitCount();
@@ -0,0 +1,252 @@
+// GasAbilityGenerator v7.8.70 - Generation profiler
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+
+#include "GasAbilityGeneratorProfiler.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+UE_TRACE_CHANNEL_DEFINE(GasAbilityGeneratorChannel);
+
+bool FGeneratorProfiler::bCaptureEvents = false;
+double FGeneratorProfiler::SessionStartTime = 0.0;
+TArray<FGeneratorProfiler::FOpenScope> FGeneratorProfiler::ScopeStack;
+TMap<FString, FGeneratorPhaseStats> FGeneratorProfiler::Phases;
+TMap<FString, FGeneratorAssetStats> FGeneratorProfiler::Assets;
+FGeneratorAssetStats* FGeneratorProfiler::CurrentAsset = nullptr;
+double FGeneratorProfiler::CurrentAssetStartTime = 0.0;
+int32 FGeneratorProfiler::Counters[static_cast<int32>(EGeneratorCounter::Num)] = {};
+TArray<FGeneratorProfiler::FTraceEvent> FGeneratorProfiler::Events;
+FDelegateHandle FGeneratorProfiler::AssetLoadedHandle;
+
+static bool EnsureDirectoryFor(const FString& FilePath)
+{
+	const FString Directory = FPaths::GetPath(FilePath);
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	return PlatformFile.DirectoryExists(*Directory) || PlatformFile.CreateDirectoryTree(*Directory);
+}
+
+void FGeneratorProfiler::BeginSession(bool bInCaptureEvents)
+{
+	check(IsInGameThread());
+
+	bCaptureEvents = bInCaptureEvents;
+	SessionStartTime = FPlatformTime::Seconds();
+	ScopeStack.Reset();
+	Phases.Reset();
+	Assets.Reset();
+	CurrentAsset = nullptr;
+	FMemory::Memzero(Counters, sizeof(Counters));
+	Events.Reset();
+
+	if (!AssetLoadedHandle.IsValid())
+	{
+		AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddStatic(&FGeneratorProfiler::OnAssetLoaded);
+	}
+}
+
+void FGeneratorProfiler::EndSession()
+{
+	if (AssetLoadedHandle.IsValid())
+	{
+		FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+		AssetLoadedHandle.Reset();
+	}
+	// Stats stay readable for the report until the next BeginSession
+}
+
+void FGeneratorProfiler::BeginScope(const TCHAR* Name)
+{
+	if (!IsInGameThread())
+	{
+		return;
+	}
+
+	FOpenScope& Scope = ScopeStack.AddDefaulted_GetRef();
+	Scope.Name = Name;
+	Scope.StartTime = FPlatformTime::Seconds();
+}
+
+void FGeneratorProfiler::EndScope()
+{
+	if (!IsInGameThread() || ScopeStack.Num() == 0)
+	{
+		return;
+	}
+
+	const FOpenScope Scope = ScopeStack.Pop(EAllowShrinking::No);
+	const double Duration = FPlatformTime::Seconds() - Scope.StartTime;
+
+	FGeneratorPhaseStats& Stats = Phases.FindOrAdd(Scope.Name);
+	Stats.Seconds += Duration;
+	Stats.Calls++;
+
+	if (CurrentAsset)
+	{
+		CurrentAsset->PhaseSeconds.FindOrAdd(Scope.Name) += Duration;
+	}
+
+	if (bCaptureEvents)
+	{
+		FTraceEvent& Event = Events.AddDefaulted_GetRef();
+		Event.Name = Scope.Name;
+		Event.Category = TEXT("phase");
+		Event.AssetName = CurrentAsset ? CurrentAsset->AssetName : FString();
+		Event.StartTime = Scope.StartTime;
+		Event.Duration = Duration;
+	}
+}
+
+void FGeneratorProfiler::BeginAsset(const FString& AssetName, const FString& AssetType)
+{
+	if (!IsInGameThread())
+	{
+		return;
+	}
+
+	// A requeued job accumulates into the same entry
+	CurrentAsset = &Assets.FindOrAdd(AssetName);
+	CurrentAsset->AssetName = AssetName;
+	if (!AssetType.IsEmpty())
+	{
+		CurrentAsset->AssetType = AssetType;
+	}
+	CurrentAssetStartTime = FPlatformTime::Seconds();
+}
+
+void FGeneratorProfiler::EndAsset()
+{
+	if (!IsInGameThread() || !CurrentAsset)
+	{
+		return;
+	}
+
+	const double Duration = FPlatformTime::Seconds() - CurrentAssetStartTime;
+	CurrentAsset->Seconds += Duration;
+
+	if (bCaptureEvents)
+	{
+		FTraceEvent& Event = Events.AddDefaulted_GetRef();
+		Event.Name = CurrentAsset->AssetName;
+		Event.Category = CurrentAsset->AssetType;
+		Event.AssetName = CurrentAsset->AssetName;
+		Event.StartTime = CurrentAssetStartTime;
+		Event.Duration = Duration;
+	}
+
+	CurrentAsset = nullptr;
+}
+
+void FGeneratorProfiler::Increment(EGeneratorCounter Counter, int32 Delta)
+{
+	if (!IsInGameThread())
+	{
+		return;
+	}
+
+	const int32 Index = static_cast<int32>(Counter);
+	Counters[Index] += Delta;
+	if (CurrentAsset)
+	{
+		CurrentAsset->Counters[Index] += Delta;
+	}
+}
+
+void FGeneratorProfiler::OnAssetLoaded(UObject* Asset)
+{
+	Increment(EGeneratorCounter::Load);
+}
+
+const TCHAR* FGeneratorProfiler::GetCounterName(EGeneratorCounter Counter)
+{
+	switch (Counter)
+	{
+	case EGeneratorCounter::Load: return TEXT("loads");
+	case EGeneratorCounter::Compile: return TEXT("compiles");
+	case EGeneratorCounter::Save: return TEXT("saves");
+	case EGeneratorCounter::RegistryQuery: return TEXT("registryQueries");
+	default: return TEXT("unknown");
+	}
+}
+
+bool FGeneratorProfiler::WriteChromeTrace(const FString& OutputPath)
+{
+	if (!bCaptureEvents)
+	{
+		return false;
+	}
+
+	// Complete ("X") events, microseconds from session start; assets on tid 1, phases on tid 2
+	TArray<TSharedPtr<FJsonValue>> TraceEvents;
+	TraceEvents.Reserve(Events.Num());
+	for (const FTraceEvent& Event : Events)
+	{
+		const bool bIsAsset = Event.Category != TEXT("phase");
+
+		TSharedRef<FJsonObject> EventObject = MakeShared<FJsonObject>();
+		EventObject->SetStringField(TEXT("name"), Event.Name);
+		EventObject->SetStringField(TEXT("cat"), Event.Category);
+		EventObject->SetStringField(TEXT("ph"), TEXT("X"));
+		EventObject->SetNumberField(TEXT("ts"), (Event.StartTime - SessionStartTime) * 1000000.0);
+		EventObject->SetNumberField(TEXT("dur"), Event.Duration * 1000000.0);
+		EventObject->SetNumberField(TEXT("pid"), 1);
+		EventObject->SetNumberField(TEXT("tid"), bIsAsset ? 1 : 2);
+		if (!bIsAsset && !Event.AssetName.IsEmpty())
+		{
+			TSharedRef<FJsonObject> Args = MakeShared<FJsonObject>();
+			Args->SetStringField(TEXT("asset"), Event.AssetName);
+			EventObject->SetObjectField(TEXT("args"), Args);
+		}
+		TraceEvents.Add(MakeShared<FJsonValueObject>(EventObject));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetArrayField(TEXT("traceEvents"), TraceEvents);
+	Root->SetStringField(TEXT("displayTimeUnit"), TEXT("ms"));
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	if (!FJsonSerializer::Serialize(Root, Writer) || !EnsureDirectoryFor(OutputPath))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(JsonString, *OutputPath);
+}
+
+bool FGeneratorProfiler::WriteCsv(const FString& OutputPath)
+{
+	TArray<const FGeneratorAssetStats*> Rows;
+	for (const auto& Pair : Assets)
+	{
+		Rows.Add(&Pair.Value);
+	}
+	Rows.Sort([](const FGeneratorAssetStats& A, const FGeneratorAssetStats& B) { return A.Seconds > B.Seconds; });
+
+	FString Csv = TEXT("AssetName,AssetType,DurationMs");
+	for (int32 i = 0; i < static_cast<int32>(EGeneratorCounter::Num); ++i)
+	{
+		Csv += TEXT(",");
+		Csv += GetCounterName(static_cast<EGeneratorCounter>(i));
+	}
+	Csv += TEXT("\n");
+
+	for (const FGeneratorAssetStats* Row : Rows)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%.3f"), *Row->AssetName, *Row->AssetType, Row->Seconds * 1000.0);
+		for (int32 i = 0; i < static_cast<int32>(EGeneratorCounter::Num); ++i)
+		{
+			Csv += FString::Printf(TEXT(",%d"), Row->Counters[i]);
+		}
+		Csv += TEXT("\n");
+	}
+
+	return EnsureDirectoryFor(OutputPath) && FFileHelper::SaveStringToFile(Csv, *OutputPath);
+}
+
+FString FGeneratorProfiler::GetProfileOutputDir()
+{
+	return FPaths::ProjectSavedDir() / TEXT("GasAbilityGenerator/Profiles");
+}
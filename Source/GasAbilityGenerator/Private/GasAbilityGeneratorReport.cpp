@@ -1,12 +1,18 @@
 // GasAbilityGeneratorReport.cpp
 // v4.10: Machine-readable generation report implementation
+// v7.8.70: Per-asset / per-phase timings and counters from FGeneratorProfiler (additive fields only)
 // v4.10: FromGenerationResult() splits E_*/W_* warnings into Errors/Warnings arrays (CullEmpty=false critical)
+// v7.8.76: JSON mirror streamed through TJsonWriter (no FJsonObject DOM), written to a temp file and moved into place
+// v7.8.84: A UTF-16 surrogate pair split at a chunk boundary is carried over instead of converted as '?'
 
 #include "GasAbilityGeneratorReport.h"
+#include "GasAbilityGeneratorProfiler.h"  // v7.8.70: Run timings
 #include "JsonObjectConverter.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Serialization/JsonWriter.h"  // v7.8.76
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/SavePackage.h"
 
@@ -16,6 +22,26 @@
 // FGenerationReportItem Implementation
 // ============================================================================
 
+// v7.8.70: Timings and counters for an item's asset, if it was profiled this run
+static void ApplyAssetProfile(FGenerationReportItem& Item)
+{
+	const FGeneratorAssetStats* Stats = FGeneratorProfiler::FindAsset(Item.AssetName);
+	if (!Stats)
+	{
+		return;
+	}
+
+	Item.DurationMs = static_cast<float>(Stats->Seconds * 1000.0);
+	for (const auto& Pair : Stats->PhaseSeconds)
+	{
+		Item.PhaseDurationsMs.Add(Pair.Key, static_cast<float>(Pair.Value * 1000.0));
+	}
+	Item.LoadCount = Stats->GetCounter(EGeneratorCounter::Load);
+	Item.CompileCount = Stats->GetCounter(EGeneratorCounter::Compile);
+	Item.SaveCount = Stats->GetCounter(EGeneratorCounter::Save);
+	Item.RegistryQueryCount = Stats->GetCounter(EGeneratorCounter::RegistryQuery);
+}
+
 FGenerationReportItem FGenerationReportItem::FromGenerationResult(const FGenerationResult& Result)
 {
 	FGenerationReportItem Item;
@@ -61,6 +87,8 @@ FGenerationReportItem FGenerationReportItem::FromGenerationResult(const FGenerat
 	});
 	Item.Warnings.Sort();
 
+	ApplyAssetProfile(Item);
+
 	return Item;
 }
 
@@ -84,6 +112,8 @@ FGenerationReportItem FGenerationReportItem::FromDryRunResult(const FDryRunResul
 		Item.Warnings.Add(FString::Printf(TEXT("Asset change: %s"), *Change));
 	}
 
+	ApplyAssetProfile(Item);
+
 	return Item;
 }
 
@@ -172,77 +202,80 @@ void UGenerationReport::Finalize()
 	}
 }
 
-bool UGenerationReport::SaveAsJson(const FString& OutputPath) const
+void UGenerationReport::AddProfile()
 {
-	// Convert to JSON using FJsonObjectConverter
-	FString JsonString;
-	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
-
-	// Add header fields
-	JsonObject->SetStringField(TEXT("runId"), RunId.ToString());
-	JsonObject->SetStringField(TEXT("timestamp"), Timestamp.ToIso8601());
-	JsonObject->SetStringField(TEXT("generatorVersion"), GeneratorVersion);
-	JsonObject->SetStringField(TEXT("manifestFilePath"), ManifestFilePath);
-	JsonObject->SetNumberField(TEXT("manifestHash"), static_cast<double>(ManifestHash));
-	JsonObject->SetBoolField(TEXT("isDryRun"), bIsDryRun);
-	JsonObject->SetBoolField(TEXT("isForceRun"), bIsForceRun);
-
-	// Add counts
-	JsonObject->SetNumberField(TEXT("countNew"), CountNew);
-	JsonObject->SetNumberField(TEXT("countSkipped"), CountSkipped);
-	JsonObject->SetNumberField(TEXT("countFailed"), CountFailed);
-	JsonObject->SetNumberField(TEXT("countDeferred"), CountDeferred);
-	JsonObject->SetNumberField(TEXT("countWillCreate"), CountWillCreate);
-	JsonObject->SetNumberField(TEXT("countWillModify"), CountWillModify);
-	JsonObject->SetNumberField(TEXT("countWillSkip"), CountWillSkip);
-	JsonObject->SetNumberField(TEXT("countConflicted"), CountConflicted);
-
-	// Add items array
-	TArray<TSharedPtr<FJsonValue>> ItemsArray;
-	for (const FGenerationReportItem& Item : Items)
+	PhaseTimings.Reset();
+	for (const auto& Pair : FGeneratorProfiler::GetPhases())
 	{
-		TSharedRef<FJsonObject> ItemObject = MakeShared<FJsonObject>();
-		ItemObject->SetStringField(TEXT("assetPath"), Item.AssetPath);
-		ItemObject->SetStringField(TEXT("assetName"), Item.AssetName);
-		ItemObject->SetStringField(TEXT("generatorId"), Item.GeneratorId);
-		ItemObject->SetStringField(TEXT("executedStatus"), Item.ExecutedStatus);
-		ItemObject->SetStringField(TEXT("plannedStatus"), Item.PlannedStatus);
-		ItemObject->SetBoolField(TEXT("hasPlannedStatus"), Item.bHasPlannedStatus);
-		ItemObject->SetBoolField(TEXT("assetExistedBeforeRun"), Item.bAssetExistedBeforeRun);
-		ItemObject->SetStringField(TEXT("reason"), Item.Reason);
-
-		// Add errors
-		TArray<TSharedPtr<FJsonValue>> ErrorsArray;
-		for (const FGenerationError& Error : Item.Errors)
-		{
-			TSharedRef<FJsonObject> ErrorObject = MakeShared<FJsonObject>();
-			ErrorObject->SetStringField(TEXT("errorCode"), Error.ErrorCode);
-			ErrorObject->SetStringField(TEXT("contextPath"), Error.ContextPath);
-			ErrorObject->SetStringField(TEXT("message"), Error.Message);
-			ErrorObject->SetStringField(TEXT("suggestedFix"), Error.SuggestedFix);
-			ErrorsArray.Add(MakeShared<FJsonValueObject>(ErrorObject));
-		}
-		ItemObject->SetArrayField(TEXT("errors"), ErrorsArray);
+		FGenerationPhaseTiming& Timing = PhaseTimings.AddDefaulted_GetRef();
+		Timing.Name = Pair.Key;
+		Timing.DurationMs = static_cast<float>(Pair.Value.Seconds * 1000.0);
+		Timing.Calls = Pair.Value.Calls;
+	}
+	PhaseTimings.Sort([](const FGenerationPhaseTiming& A, const FGenerationPhaseTiming& B) { return A.DurationMs > B.DurationMs; });
+
+	TotalLoads = FGeneratorProfiler::GetCounter(EGeneratorCounter::Load);
+	TotalCompiles = FGeneratorProfiler::GetCounter(EGeneratorCounter::Compile);
+	TotalSaves = FGeneratorProfiler::GetCounter(EGeneratorCounter::Save);
+	TotalRegistryQueries = FGeneratorProfiler::GetCounter(EGeneratorCounter::RegistryQuery);
+}
+
+/**
+ * v7.8.76: Archive adapter for the streamed JSON report - TJsonWriter serializes TCHARs, the file
+ * gets UTF-8 in chunks, so the report is never held in memory as a whole
+ */
+class FJsonReportFileArchive : public FArchive
+{
+public:
+	explicit FJsonReportFileArchive(FArchive* InFile)
+		: File(InFile)
+	{
+		SetIsSaving(true);
+		Pending.Reserve(ChunkChars + 1024);
+	}
 
-		// Add warnings
-		TArray<TSharedPtr<FJsonValue>> WarningsArray;
-		for (const FString& Warning : Item.Warnings)
+	virtual ~FJsonReportFileArchive() override
+	{
+		FlushChunk(true);
+	}
+
+	virtual void Serialize(void* Data, int64 Length) override
+	{
+		Pending.Append(static_cast<const TCHAR*>(Data), static_cast<int32>(Length / sizeof(TCHAR)));
+		if (Pending.Num() >= ChunkChars)
 		{
-			WarningsArray.Add(MakeShared<FJsonValueString>(Warning));
+			FlushChunk(false);
 		}
-		ItemObject->SetArrayField(TEXT("warnings"), WarningsArray);
-
-		ItemsArray.Add(MakeShared<FJsonValueObject>(ItemObject));
 	}
-	JsonObject->SetArrayField(TEXT("items"), ItemsArray);
 
-	// Serialize to string
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-	if (!FJsonSerializer::Serialize(JsonObject, Writer))
+	virtual FString GetArchiveName() const override { return TEXT("FJsonReportFileArchive"); }
+
+	void FlushChunk(bool bFinal)
 	{
-		return false;
+		// The print policy writes string values one character at a time, so a chunk can end between the
+		// halves of a surrogate pair - the high half waits for the next chunk (converted alone it becomes '?')
+		int32 Count = Pending.Num();
+		if (!bFinal && Count > 0 && StringConv::IsHighSurrogate(static_cast<uint32>(Pending.Last())))
+		{
+			Count--;
+		}
+		if (Count > 0)
+		{
+			const FTCHARToUTF8 Utf8(Pending.GetData(), Count);
+			File->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+			Pending.RemoveAt(0, Count, EAllowShrinking::No);
+		}
 	}
 
+private:
+	static constexpr int32 ChunkChars = 64 * 1024;
+
+	FArchive* File;
+	TArray<TCHAR> Pending;
+};
+
+bool UGenerationReport::SaveAsJson(const FString& OutputPath) const
+{
 	// Ensure directory exists
 	FString Directory = FPaths::GetPath(OutputPath);
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
@@ -251,8 +284,121 @@ bool UGenerationReport::SaveAsJson(const FString& OutputPath) const
 		PlatformFile.CreateDirectoryTree(*Directory);
 	}
 
-	// Write to file
-	return FFileHelper::SaveStringToFile(JsonString, *OutputPath);
+	// v7.8.76: Streamed to a temp file and moved into place - a killed run never leaves a truncated report.
+	// Field order and number formatting match the former FJsonObject serialization (Contract 9).
+	const FString TempPath = OutputPath + TEXT(".tmp");
+	TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*TempPath));
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	bool bSerialized = false;
+	{
+		FJsonReportFileArchive Stream(File.Get());
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Stream);
+
+		Writer->WriteObjectStart();
+
+		// Add header fields
+		Writer->WriteValue(TEXT("runId"), RunId.ToString());
+		Writer->WriteValue(TEXT("timestamp"), Timestamp.ToIso8601());
+		Writer->WriteValue(TEXT("generatorVersion"), GeneratorVersion);
+		Writer->WriteValue(TEXT("manifestFilePath"), ManifestFilePath);
+		Writer->WriteValue(TEXT("manifestHash"), static_cast<double>(ManifestHash));
+		Writer->WriteValue(TEXT("isDryRun"), bIsDryRun);
+		Writer->WriteValue(TEXT("isForceRun"), bIsForceRun);
+
+		// Add counts
+		Writer->WriteValue(TEXT("countNew"), static_cast<double>(CountNew));
+		Writer->WriteValue(TEXT("countSkipped"), static_cast<double>(CountSkipped));
+		Writer->WriteValue(TEXT("countFailed"), static_cast<double>(CountFailed));
+		Writer->WriteValue(TEXT("countDeferred"), static_cast<double>(CountDeferred));
+		Writer->WriteValue(TEXT("countWillCreate"), static_cast<double>(CountWillCreate));
+		Writer->WriteValue(TEXT("countWillModify"), static_cast<double>(CountWillModify));
+		Writer->WriteValue(TEXT("countWillSkip"), static_cast<double>(CountWillSkip));
+		Writer->WriteValue(TEXT("countConflicted"), static_cast<double>(CountConflicted));
+
+		// v7.8.70: Run profile
+		Writer->WriteValue(TEXT("totalLoads"), static_cast<double>(TotalLoads));
+		Writer->WriteValue(TEXT("totalCompiles"), static_cast<double>(TotalCompiles));
+		Writer->WriteValue(TEXT("totalSaves"), static_cast<double>(TotalSaves));
+		Writer->WriteValue(TEXT("totalRegistryQueries"), static_cast<double>(TotalRegistryQueries));
+		Writer->WriteArrayStart(TEXT("phaseTimings"));
+		for (const FGenerationPhaseTiming& Timing : PhaseTimings)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("name"), Timing.Name);
+			Writer->WriteValue(TEXT("durationMs"), static_cast<double>(Timing.DurationMs));
+			Writer->WriteValue(TEXT("calls"), static_cast<double>(Timing.Calls));
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		// Add items array
+		Writer->WriteArrayStart(TEXT("items"));
+		for (const FGenerationReportItem& Item : Items)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("assetPath"), Item.AssetPath);
+			Writer->WriteValue(TEXT("assetName"), Item.AssetName);
+			Writer->WriteValue(TEXT("generatorId"), Item.GeneratorId);
+			Writer->WriteValue(TEXT("executedStatus"), Item.ExecutedStatus);
+			Writer->WriteValue(TEXT("plannedStatus"), Item.PlannedStatus);
+			Writer->WriteValue(TEXT("hasPlannedStatus"), Item.bHasPlannedStatus);
+			Writer->WriteValue(TEXT("assetExistedBeforeRun"), Item.bAssetExistedBeforeRun);
+			Writer->WriteValue(TEXT("reason"), Item.Reason);
+
+			// Add errors
+			Writer->WriteArrayStart(TEXT("errors"));
+			for (const FGenerationError& Error : Item.Errors)
+			{
+				Writer->WriteObjectStart();
+				Writer->WriteValue(TEXT("errorCode"), Error.ErrorCode);
+				Writer->WriteValue(TEXT("contextPath"), Error.ContextPath);
+				Writer->WriteValue(TEXT("message"), Error.Message);
+				Writer->WriteValue(TEXT("suggestedFix"), Error.SuggestedFix);
+				Writer->WriteObjectEnd();
+			}
+			Writer->WriteArrayEnd();
+
+			// Add warnings
+			Writer->WriteArrayStart(TEXT("warnings"));
+			for (const FString& Warning : Item.Warnings)
+			{
+				Writer->WriteValue(Warning);
+			}
+			Writer->WriteArrayEnd();
+
+			// v7.8.70: Asset timings and counters
+			Writer->WriteValue(TEXT("durationMs"), static_cast<double>(Item.DurationMs));
+			Writer->WriteObjectStart(TEXT("phaseDurationsMs"));
+			for (const auto& Pair : Item.PhaseDurationsMs)
+			{
+				Writer->WriteValue(Pair.Key, static_cast<double>(Pair.Value));
+			}
+			Writer->WriteObjectEnd();
+			Writer->WriteValue(TEXT("loadCount"), static_cast<double>(Item.LoadCount));
+			Writer->WriteValue(TEXT("compileCount"), static_cast<double>(Item.CompileCount));
+			Writer->WriteValue(TEXT("saveCount"), static_cast<double>(Item.SaveCount));
+			Writer->WriteValue(TEXT("registryQueryCount"), static_cast<double>(Item.RegistryQueryCount));
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteObjectEnd();
+		bSerialized = Writer->Close();
+	}
+
+	const bool bWritten = bSerialized && File->Close() && !File->IsError();
+	File.Reset();
+	if (!bWritten)
+	{
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		return false;
+	}
+
+	return IFileManager::Get().Move(*OutputPath, *TempPath, true, true);
 }
 
 FString UGenerationReport::GetStatusString(EGenerationStatus Status)
@@ -323,6 +469,7 @@ UGenerationReport* FGenerationReportHelper::CreateAndSaveReport(
 
 	// Finalize counts
 	Report->Finalize();
+	Report->AddProfile();  // v7.8.70
 
 	// Register with asset registry
 	FAssetRegistryModule::AssetCreated(Report);
@@ -384,6 +531,7 @@ UGenerationReport* FGenerationReportHelper::CreateAndSaveDryRunReport(
 
 	// Finalize counts
 	Report->Finalize();
+	Report->AddProfile();  // v7.8.70
 
 	// Register with asset registry
 	FAssetRegistryModule::AssetCreated(Report);
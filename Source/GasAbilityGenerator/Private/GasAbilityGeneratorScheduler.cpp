@@ -0,0 +1,1189 @@
+// GasAbilityGenerator v7.8.84 - Dependency-ordered generation scheduler
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.66: Manifest jobs + reference edges, Kahn ordering with registration-order ties
+// v7.8.67: Parallel prepare stage (input hashes, package stats)
+// v7.8.70: Each job's generation attributed to its asset in the profiler
+// v7.8.72: Incremental change sets and definition hash snapshots
+// v7.8.83: DeferUntil resolves dependency names the same way as AddReference
+// v7.8.83: CompleteUpToDate / RunJob / ApplySaveFailures / SaveSnapshot shared by the commandlet and window
+// v7.8.84: NiagaraSystem jobs hash their preset-resolved definition for the change set
+// v7.8.84: Manifest edges only from class/asset reference keys; Dialogue -> NPC is the only NPC/Dialogue direction
+// v7.8.84: Cycle release picks a job inside a blocking strongly connected component, not the first waiting job
+
+#include "GasAbilityGeneratorScheduler.h"
+#include "GasAbilityGeneratorGenerators.h"
+#include "Locked/GasAbilityGeneratorMetadata.h"
+#include "Locked/GasAbilityGeneratorHash.h"
+#include "GasAbilityGeneratorProfiler.h"
+#include "Async/ParallelFor.h"
+#include "Misc/PackageName.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Misc/Parse.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+// ============================================================================
+// Graph
+// ============================================================================
+
+bool FGenerationScheduler::AddJob(const FString& AssetName, const FString& AssetType, TFunction<FGenerationResult()> Generate, bool bCheckUpstreamFailure)
+{
+	if (AssetName.IsEmpty() || JobIndexByName.Contains(AssetName))
+	{
+		return false;
+	}
+
+	const int32 Index = Jobs.Num();
+	FGenerationJob& Job = Jobs.AddDefaulted_GetRef();
+	Job.AssetName = AssetName;
+	Job.AssetType = AssetType;
+	Job.Order = Index;
+	Job.bCheckUpstreamFailure = bCheckUpstreamFailure;
+	Job.Generate = MoveTemp(Generate);
+
+	JobIndexByName.Add(AssetName, Index);
+	Dependents.AddDefaulted();
+	StaticInDegree.Add(0);
+	return true;
+}
+
+void FGenerationScheduler::AddDependency(const FString& Dependent, const FString& Dependency)
+{
+	const int32* DependentIndex = JobIndexByName.Find(Dependent);
+	if (DependentIndex)
+	{
+		AddReference(*DependentIndex, Dependency);
+	}
+}
+
+const int32* FGenerationScheduler::FindJobByReference(const FString& Reference) const
+{
+	if (Reference.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// References may be bare names, class names (BP_X_C) or object paths (/Game/.../BP_X.BP_X_C)
+	FString Name = Reference;
+	int32 Separator;
+	if (Name.FindLastChar(TEXT('.'), Separator) || Name.FindLastChar(TEXT('/'), Separator))
+	{
+		Name.RightChopInline(Separator + 1);
+	}
+
+	const int32* JobIndex = JobIndexByName.Find(Name);
+	if (!JobIndex && Name.EndsWith(TEXT("_C")))
+	{
+		JobIndex = JobIndexByName.Find(Name.LeftChop(2));
+	}
+	return JobIndex;
+}
+
+void FGenerationScheduler::AddReference(int32 DependentIndex, const FString& Reference)
+{
+	const int32* DependencyIndex = FindJobByReference(Reference);
+	if (!DependencyIndex || *DependencyIndex == DependentIndex)
+	{
+		return;
+	}
+
+	TArray<int32>& Waiting = Dependents[*DependencyIndex];
+	if (!Waiting.Contains(DependentIndex))
+	{
+		Waiting.Add(DependentIndex);
+		StaticInDegree[DependentIndex]++;
+		EdgeCount++;
+	}
+}
+
+// ============================================================================
+// Prepare stage
+// ============================================================================
+
+void FGenerationScheduler::Prepare()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Registry snapshot on the game thread: manifest asset name -> package path of its generated record
+	Plans.Reset();
+	Plans.SetNum(Jobs.Num());
+	if (UGeneratorMetadataRegistry* Registry = UGeneratorMetadataRegistry::GetRegistry())
+	{
+		TMap<FString, FString> PackagePathByName;
+		for (const auto& Pair : Registry->Records)
+		{
+			if (Pair.Value.bIsGenerated && !Pair.Value.ManifestAssetKey.IsEmpty())
+			{
+				PackagePathByName.Add(Pair.Value.ManifestAssetKey, Pair.Key);
+			}
+		}
+		for (int32 i = 0; i < Jobs.Num(); ++i)
+		{
+			Plans[i].PackagePath = PackagePathByName.FindRef(Jobs[i].AssetName);
+		}
+	}
+
+	// Worker threads: definition hashing and package file stats, no UObject access
+	ParallelFor(Jobs.Num(), [this](int32 Index)
+	{
+		const FGenerationJob& Job = Jobs[Index];
+		FGenerationPlan& Plan = Plans[Index];
+
+		if (Job.ComputeInputHash)
+		{
+			Plan.InputHash = Job.ComputeInputHash();
+			Plan.bHasInputHash = true;
+		}
+
+		FString FilePath;
+		if (!Plan.PackagePath.IsEmpty()
+			&& FPackageName::TryConvertLongPackageNameToFilename(Plan.PackagePath, FilePath, FPackageName::GetAssetPackageExtension()))
+		{
+			Plan.PackageStat = IFileManager::Get().GetStatData(*FilePath);
+			Plan.bHasPackageStat = true;
+		}
+	});
+
+	// Publish for the commit stage
+	TMap<const void*, uint64> InputHashes;
+	TMap<FString, FFileStatData> PackageStats;
+	InputHashes.Reserve(Jobs.Num());
+	for (int32 i = 0; i < Jobs.Num(); ++i)
+	{
+		if (Plans[i].bHasInputHash && Jobs[i].Definition)
+		{
+			InputHashes.Add(Jobs[i].Definition, Plans[i].InputHash);
+		}
+		if (Plans[i].bHasPackageStat)
+		{
+			PackageStats.Add(Plans[i].PackagePath, Plans[i].PackageStat);
+		}
+	}
+	FGeneratorBase::SetPreparedState(MoveTemp(InputHashes), MoveTemp(PackageStats));
+
+	PrepareSeconds = FPlatformTime::Seconds() - StartTime;
+}
+
+const FGenerationPlan& FGenerationScheduler::GetPlan(int32 JobIndex) const
+{
+	static const FGenerationPlan EmptyPlan;
+	return Plans.IsValidIndex(JobIndex) ? Plans[JobIndex] : EmptyPlan;
+}
+
+// ============================================================================
+// Incremental change set
+// ============================================================================
+
+void FGenerationScheduler::ComputeChangeSet(const FDefinitionHashSnapshot& Previous)
+{
+	ChangedCount = 0;
+	ChangedDependentCount = 0;
+
+	TBitArray<> InRunSet(false, Jobs.Num());
+	TArray<int32> Frontier;
+	for (int32 i = 0; i < Jobs.Num(); ++i)
+	{
+		const FGenerationPlan& Plan = GetPlan(i);
+		const FDefinitionHashSnapshot::FEntry* Entry = Previous.Find(Jobs[i].AssetName);
+		const bool bUnchanged = Entry && Plan.bHasInputHash
+			&& Entry->InputHash == Plan.InputHash
+			&& Entry->AssetType == Jobs[i].AssetType
+			&& FGeneratorBase::IsUpToDateInRegistry(Plan.PackagePath, Plan.InputHash, Plan.bHasPackageStat ? &Plan.PackageStat : nullptr);
+		if (!bUnchanged)
+		{
+			InRunSet[i] = true;
+			Frontier.Add(i);
+			ChangedCount++;
+		}
+	}
+
+	// Everything downstream of a change runs too (its generator re-resolves the changed reference)
+	while (Frontier.Num() > 0)
+	{
+		const int32 Index = Frontier.Pop(EAllowShrinking::No);
+		for (int32 DependentIndex : Dependents[Index])
+		{
+			if (!InRunSet[DependentIndex])
+			{
+				InRunSet[DependentIndex] = true;
+				Frontier.Add(DependentIndex);
+				ChangedDependentCount++;
+			}
+		}
+	}
+
+	UpToDate.Init(false, Jobs.Num());
+	UpToDateCount = 0;
+	for (int32 i = 0; i < Jobs.Num(); ++i)
+	{
+		if (!InRunSet[i])
+		{
+			UpToDate[i] = true;
+			UpToDateCount++;
+		}
+	}
+}
+
+FDefinitionHashSnapshot FGenerationScheduler::MakeSnapshot(TFunctionRef<bool(const FGenerationJob&)> ShouldRecord) const
+{
+	FDefinitionHashSnapshot Snapshot;
+	for (int32 i = 0; i < Jobs.Num(); ++i)
+	{
+		const FGenerationPlan& Plan = GetPlan(i);
+		if (Plan.bHasInputHash && ShouldRecord(Jobs[i]))
+		{
+			Snapshot.Set(Jobs[i].AssetName, Jobs[i].AssetType, Plan.InputHash);
+		}
+	}
+	return Snapshot;
+}
+
+bool FGenerationScheduler::SaveSnapshot(const FGenerationSummary& Summary, const FString& ManifestPath) const
+{
+	TMap<FString, EGenerationStatus> FinalStatus;
+	FinalStatus.Reserve(Summary.Results.Num());
+	for (const FGenerationResult& FinalResult : Summary.Results)
+	{
+		FinalStatus.Add(FinalResult.AssetName, FinalResult.Status);
+	}
+	const FDefinitionHashSnapshot RunHashes = MakeSnapshot([&FinalStatus](const FGenerationJob& Job)
+	{
+		const EGenerationStatus* Status = FinalStatus.Find(Job.AssetName);
+		return Status && (*Status == EGenerationStatus::New || *Status == EGenerationStatus::Skipped);
+	});
+	return RunHashes.Save(ManifestPath);
+}
+
+// ============================================================================
+// FDefinitionHashSnapshot
+// ============================================================================
+
+FString FDefinitionHashSnapshot::GetSnapshotPath(const FString& ManifestPath)
+{
+	FString FullPath = FPaths::ConvertRelativePathToFull(ManifestPath);
+	FPaths::NormalizeFilename(FullPath);
+	return FPaths::ProjectSavedDir() / TEXT("GasAbilityGenerator/Incremental")
+		/ FString::Printf(TEXT("%s_%08x.json"), *FPaths::GetBaseFilename(FullPath), FCrc::StrCrc32(*FullPath.ToLower()));
+}
+
+void FDefinitionHashSnapshot::Set(const FString& AssetName, const FString& AssetType, uint64 InputHash)
+{
+	FEntry& Entry = Entries.FindOrAdd(AssetName);
+	Entry.AssetType = AssetType;
+	Entry.InputHash = InputHash;
+}
+
+bool FDefinitionHashSnapshot::Load(const FString& ManifestPath)
+{
+	Entries.Reset();
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetSnapshotPath(ManifestPath)))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		return false;
+	}
+
+	// Hashes from another algorithm version can't be compared
+	int32 FileFormat = 0;
+	int32 FileHashVersion = 0;
+	if (!Root->TryGetNumberField(TEXT("formatVersion"), FileFormat) || FileFormat != FormatVersion
+		|| !Root->TryGetNumberField(TEXT("hashVersion"), FileHashVersion) || FileHashVersion != GeneratorHash::Version)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Assets = nullptr;
+	if (!Root->TryGetObjectField(TEXT("assets"), Assets))
+	{
+		return false;
+	}
+
+	Entries.Reserve((*Assets)->Values.Num());
+	for (const auto& Pair : (*Assets)->Values)
+	{
+		const TSharedPtr<FJsonObject>* AssetObject = nullptr;
+		FString HashString;
+		if (!Pair.Value->TryGetObject(AssetObject) || !(*AssetObject)->TryGetStringField(TEXT("inputHash"), HashString))
+		{
+			continue;
+		}
+		FEntry& Entry = Entries.Add(Pair.Key);
+		Entry.AssetType = (*AssetObject)->GetStringField(TEXT("type"));
+		Entry.InputHash = FParse::HexNumber64(*HashString);
+	}
+	return true;
+}
+
+bool FDefinitionHashSnapshot::Save(const FString& ManifestPath) const
+{
+	TSharedRef<FJsonObject> Assets = MakeShared<FJsonObject>();
+	for (const auto& Pair : Entries)
+	{
+		TSharedRef<FJsonObject> AssetObject = MakeShared<FJsonObject>();
+		AssetObject->SetStringField(TEXT("type"), Pair.Value.AssetType);
+		// Hex string - JSON numbers lose 64-bit precision
+		AssetObject->SetStringField(TEXT("inputHash"), FString::Printf(TEXT("%016llx"), Pair.Value.InputHash));
+		Assets->SetObjectField(Pair.Key, AssetObject);
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("formatVersion"), FormatVersion);
+	Root->SetNumberField(TEXT("hashVersion"), GeneratorHash::Version);
+	Root->SetStringField(TEXT("manifestPath"), ManifestPath);
+	Root->SetObjectField(TEXT("assets"), Assets);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(JsonString, *GetSnapshotPath(ManifestPath));
+}
+
+// ============================================================================
+// Execution
+// ============================================================================
+
+void FGenerationScheduler::Begin()
+{
+	InDegree = StaticInDegree;
+	State.Init(EJobState::Waiting, Jobs.Num());
+	ReadyHeap.Reset();
+	ReleasedFromCycle.Reset();
+	RequeuedJobs.Reset();
+	Remaining = Jobs.Num();
+
+	for (int32 i = 0; i < Jobs.Num(); ++i)
+	{
+		if (InDegree[i] == 0)
+		{
+			PushReady(i);
+		}
+	}
+}
+
+void FGenerationScheduler::PushReady(int32 JobIndex)
+{
+	State[JobIndex] = EJobState::Ready;
+	ReadyHeap.HeapPush(JobIndex);
+}
+
+bool FGenerationScheduler::Next(int32& OutJobIndex)
+{
+	if (Remaining == 0)
+	{
+		return false;
+	}
+
+	if (ReadyHeap.Num() == 0)
+	{
+		// Cycle: release one job of it so every asset is still visited once
+		const int32 Released = FindCycleRelease();
+		if (Released == INDEX_NONE)
+		{
+			return false;
+		}
+		ReleasedFromCycle.Add(Released);
+		PushReady(Released);
+	}
+
+	ReadyHeap.HeapPop(OutJobIndex, EAllowShrinking::No);
+	State[OutJobIndex] = EJobState::Running;
+	return true;
+}
+
+int32 FGenerationScheduler::FindCycleRelease() const
+{
+	// Waiting -> waiting dependency edges (Dependents is dependency -> dependents)
+	const int32 NumJobs = Jobs.Num();
+	TArray<TArray<int32>> WaitingDependencies;
+	WaitingDependencies.SetNum(NumJobs);
+	for (int32 Dependency = 0; Dependency < NumJobs; ++Dependency)
+	{
+		if (State[Dependency] != EJobState::Waiting)
+		{
+			continue;
+		}
+		for (int32 Dependent : Dependents[Dependency])
+		{
+			if (State[Dependent] == EJobState::Waiting)
+			{
+				WaitingDependencies[Dependent].Add(Dependency);
+			}
+		}
+	}
+
+	// Tarjan's strongly connected components, iterative (dependency chains can be deep)
+	struct FFrame
+	{
+		int32 Job;
+		int32 NextEdge;
+	};
+	TArray<int32> VisitIndex;
+	VisitIndex.Init(INDEX_NONE, NumJobs);
+	TArray<int32> LowLink;
+	LowLink.Init(0, NumJobs);
+	TArray<int32> Component;
+	Component.Init(INDEX_NONE, NumJobs);
+	TBitArray<> OnStack(false, NumJobs);
+	TArray<int32> Stack;
+	TArray<FFrame> CallStack;
+	int32 NextVisitIndex = 0;
+	int32 NumComponents = 0;
+
+	auto Visit = [&](int32 Job)
+	{
+		VisitIndex[Job] = LowLink[Job] = NextVisitIndex++;
+		Stack.Push(Job);
+		OnStack[Job] = true;
+		CallStack.Add({ Job, 0 });
+	};
+
+	for (int32 Root = 0; Root < NumJobs; ++Root)
+	{
+		if (State[Root] != EJobState::Waiting || VisitIndex[Root] != INDEX_NONE)
+		{
+			continue;
+		}
+		Visit(Root);
+		while (CallStack.Num() > 0)
+		{
+			const int32 Job = CallStack.Last().Job;
+			const TArray<int32>& Edges = WaitingDependencies[Job];
+			if (CallStack.Last().NextEdge < Edges.Num())
+			{
+				const int32 Dependency = Edges[CallStack.Last().NextEdge++];
+				if (VisitIndex[Dependency] == INDEX_NONE)
+				{
+					Visit(Dependency);
+				}
+				else if (OnStack[Dependency])
+				{
+					LowLink[Job] = FMath::Min(LowLink[Job], VisitIndex[Dependency]);
+				}
+				continue;
+			}
+
+			CallStack.Pop(EAllowShrinking::No);
+			if (LowLink[Job] == VisitIndex[Job])
+			{
+				int32 Member;
+				do
+				{
+					Member = Stack.Pop(EAllowShrinking::No);
+					OnStack[Member] = false;
+					Component[Member] = NumComponents;
+				} while (Member != Job);
+				NumComponents++;
+			}
+			if (CallStack.Num() > 0)
+			{
+				const int32 Parent = CallStack.Last().Job;
+				LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[Job]);
+			}
+		}
+	}
+
+	// A component waiting on another component is unblocked once that one completes
+	TBitArray<> BlockedFromOutside(false, NumComponents);
+	for (int32 Job = 0; Job < NumJobs; ++Job)
+	{
+		for (int32 Dependency : WaitingDependencies[Job])
+		{
+			if (Component[Dependency] != Component[Job])
+			{
+				BlockedFromOutside[Component[Job]] = true;
+			}
+		}
+	}
+
+	// Job index == Order, so the first hit is the lowest-Order member of any blocking component
+	for (int32 Job = 0; Job < NumJobs; ++Job)
+	{
+		if (Component[Job] != INDEX_NONE && !BlockedFromOutside[Component[Job]])
+		{
+			return Job;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FGenerationScheduler::Complete(int32 JobIndex)
+{
+	if (State[JobIndex] == EJobState::Done)
+	{
+		return;
+	}
+
+	State[JobIndex] = EJobState::Done;
+	Remaining--;
+
+	for (int32 DependentIndex : Dependents[JobIndex])
+	{
+		if (State[DependentIndex] == EJobState::Waiting && --InDegree[DependentIndex] <= 0)
+		{
+			PushReady(DependentIndex);
+		}
+	}
+}
+
+bool FGenerationScheduler::DeferUntil(int32 JobIndex, const FString& Dependency)
+{
+	if (ReleasedFromCycle.Contains(JobIndex))
+	{
+		return false;
+	}
+
+	const int32* DependencyIndex = FindJobByReference(Dependency);
+	if (!DependencyIndex || *DependencyIndex == JobIndex || State[*DependencyIndex] == EJobState::Done)
+	{
+		return false;
+	}
+
+	// Run-time edge: only this dependency gates the job now, its static edges are already satisfied
+	Dependents[*DependencyIndex].AddUnique(JobIndex);
+	InDegree[JobIndex] = 1;
+	State[JobIndex] = EJobState::Waiting;
+	RequeuedJobs.Add(JobIndex);
+	return true;
+}
+
+FGenerationResult FGenerationScheduler::CompleteUpToDate(int32 JobIndex, const FString& Reason)
+{
+	const FGenerationJob& Job = Jobs[JobIndex];
+	const FGenerationPlan& Plan = GetPlan(JobIndex);
+	if (FGeneratorBase::IsDryRunMode())
+	{
+		FDryRunResult DryRunResult(Job.AssetName, EDryRunStatus::WillSkip, Reason);
+		DryRunResult.AssetPath = Plan.PackagePath;
+		DryRunResult.StoredInputHash = Plan.InputHash;
+		DryRunResult.CurrentInputHash = Plan.InputHash;
+		FGeneratorBase::AddDryRunResult(DryRunResult);
+	}
+
+	FGenerationResult UpToDateResult(Job.AssetName, EGenerationStatus::Skipped,
+		FString::Printf(TEXT("[%s] %s - %s"), *Job.AssetType, *Job.AssetName, *Reason));
+	UpToDateResult.AssetPath = Plan.PackagePath;
+	UpToDateResult.GeneratorId = Job.AssetType;
+	UpToDateResult.DetermineCategory();
+	Complete(JobIndex);
+	return UpToDateResult;
+}
+
+bool FGenerationScheduler::RunJob(int32 JobIndex, FGenerationResult& OutResult)
+{
+	const FGenerationJob& Job = Jobs[JobIndex];
+
+	// v7.8.49: A requeued job may have left a partial Blueprint in memory - overwrite it
+	const bool bRequeued = WasRequeued(JobIndex);
+	const bool bPreviousForceMode = FGeneratorBase::IsForceMode();
+	if (bRequeued)
+	{
+		FGeneratorBase::SetForceMode(true);
+	}
+	{
+		// v7.8.70: Everything the generator does (compiles, saves, loads, sub-phases) is attributed to this asset
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*Job.AssetName, GasAbilityGeneratorChannel);
+		FGeneratorAssetProfileScope AssetScope(Job.AssetName, Job.AssetType);
+		OutResult = Job.Generate();
+	}
+	if (bRequeued)
+	{
+		FGeneratorBase::SetForceMode(bPreviousForceMode);
+	}
+
+	// A deferral on a manifest asset that hasn't run yet is a reference the static edge set missed:
+	// wait for that asset instead of re-running blind retry passes
+	return !(OutResult.CanRetry() && DeferUntil(JobIndex, OutResult.MissingDependency));
+}
+
+TArray<FGenerationResult*> FGenerationScheduler::ApplySaveFailures(FGenerationSummary& Summary, const TArray<FString>& FailedAssets)
+{
+	TArray<FGenerationResult*> Relabeled;
+	for (const FString& FailedAsset : FailedAssets)
+	{
+		for (int32 i = Summary.Results.Num() - 1; i >= 0; --i)
+		{
+			FGenerationResult& SavedResult = Summary.Results[i];
+			if (SavedResult.AssetName != FailedAsset)
+			{
+				continue;
+			}
+			if (SavedResult.Status == EGenerationStatus::New)
+			{
+				Summary.NewCount--;
+			}
+			else if (SavedResult.Status == EGenerationStatus::Skipped)
+			{
+				Summary.SkippedCount--;
+			}
+			else
+			{
+				break;
+			}
+			SavedResult.Status = EGenerationStatus::Failed;
+			SavedResult.Message = TEXT("SavePackage failed - asset may not persist");
+			SavedResult.DetermineCategory();
+			Summary.FailedCount++;
+			Relabeled.Add(&SavedResult);
+			break;
+		}
+	}
+	return Relabeled;
+}
+
+// ============================================================================
+// Manifest jobs
+// ============================================================================
+
+// v4.9: Resolve FX preset chain into user parameters (manifest user_parameters win)
+static FManifestNiagaraSystemDefinition ResolveNiagaraPresets(const FManifestNiagaraSystemDefinition& Definition, const FManifestData& ManifestData)
+{
+	FManifestNiagaraSystemDefinition ResolvedDefinition = Definition;
+	if (Definition.Preset.IsEmpty())
+	{
+		return ResolvedDefinition;
+	}
+
+	// Build merged parameters from preset (with inheritance support)
+	TMap<FString, FString> MergedParams;
+	TSet<FString> ProcessedPresets;  // Prevent infinite loops
+	FString CurrentPreset = Definition.Preset;
+
+	while (!CurrentPreset.IsEmpty() && !ProcessedPresets.Contains(CurrentPreset))
+	{
+		ProcessedPresets.Add(CurrentPreset);
+		const FManifestFXPresetDefinition* PresetDef = ManifestData.FXPresets.FindByPredicate(
+			[&CurrentPreset](const FManifestFXPresetDefinition& Preset) { return Preset.Name == CurrentPreset; });
+
+		if (!PresetDef)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FX Preset '%s' not found for Niagara system '%s'"), *CurrentPreset, *Definition.Name);
+			break;
+		}
+
+		// Apply parameters (child presets override parent)
+		for (const auto& Param : PresetDef->Parameters)
+		{
+			if (!MergedParams.Contains(Param.Key))
+			{
+				MergedParams.Add(Param.Key, Param.Value);
+			}
+		}
+		CurrentPreset = PresetDef->BasePreset;
+	}
+
+	// Convert merged params to UserParameters (prepend so manifest user_parameters override)
+	TArray<FManifestNiagaraUserParameter> PresetParams;
+	for (const auto& Param : MergedParams)
+	{
+		const bool bAlreadyDefined = Definition.UserParameters.ContainsByPredicate(
+			[&Param](const FManifestNiagaraUserParameter& UserParam) { return UserParam.Name == Param.Key; });
+		if (bAlreadyDefined)
+		{
+			continue;
+		}
+
+		FManifestNiagaraUserParameter NewParam;
+		NewParam.Name = Param.Key;
+		NewParam.DefaultValue = Param.Value;
+		// Infer type from value
+		if (Param.Value.StartsWith(TEXT("[")) || Param.Value.Contains(TEXT(",")))
+		{
+			NewParam.Type = TEXT("LinearColor");  // Assume color/vector
+		}
+		else
+		{
+			NewParam.Type = TEXT("Float");
+		}
+		PresetParams.Add(NewParam);
+	}
+	PresetParams.Append(ResolvedDefinition.UserParameters);
+	ResolvedDefinition.UserParameters = PresetParams;
+	return ResolvedDefinition;
+}
+
+void FGenerationScheduler::AddManifestJobs(const FManifestData& ManifestData)
+{
+	const FManifestData* Manifest = &ManifestData;
+	const FString& ProjectRoot = ManifestData.ProjectRoot;
+
+	// Registration order is the pre-v7.8.66 phase order; it only decides between independent jobs
+	for (const auto& Def : ManifestData.Enumerations)
+	{
+		AddDefinitionJob(Def, TEXT("Enumeration"), [D = &Def]() { return FEnumerationGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.FloatCurves)
+	{
+		AddDefinitionJob(Def, TEXT("FloatCurve"), [D = &Def]() { return FFloatCurveGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.InputActions)
+	{
+		AddDefinitionJob(Def, TEXT("InputAction"), [D = &Def]() { return FInputActionGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.InputMappingContexts)
+	{
+		AddDefinitionJob(Def, TEXT("InputMappingContext"), [D = &Def]() { return FInputMappingContextGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.GameplayEffects)
+	{
+		AddDefinitionJob(Def, TEXT("GameplayEffect"), [D = &Def]() { return FGameplayEffectGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.GoalItems)
+	{
+		AddDefinitionJob(Def, TEXT("GoalItem"), [D = &Def, Manifest]() { return FGoalItemGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.GoalGenerators)
+	{
+		AddDefinitionJob(Def, TEXT("GoalGenerator"), [D = &Def, Manifest]() { return FGoalGeneratorGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.GameplayCues)
+	{
+		AddDefinitionJob(Def, TEXT("GameplayCue"), [D = &Def, Manifest]() { return FGameplayCueGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.BTServices)
+	{
+		AddDefinitionJob(Def, TEXT("BTService"), [D = &Def, Manifest]() { return FBTServiceGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.BTTasks)
+	{
+		AddDefinitionJob(Def, TEXT("BTTask"), [D = &Def, Manifest]() { return FBTTaskGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.ActorBlueprints)
+	{
+		AddDefinitionJob(Def, TEXT("ActorBlueprint"), [D = &Def, Manifest, ProjectRoot]() { return FActorBlueprintGenerator::Generate(*D, ProjectRoot, Manifest); });
+	}
+	for (const auto& Def : ManifestData.GameplayAbilities)
+	{
+		AddDefinitionJob(Def, TEXT("GameplayAbility"), [D = &Def, ProjectRoot]() { return FGameplayAbilityGenerator::Generate(*D, ProjectRoot); }, true);
+	}
+	for (const auto& Def : ManifestData.WidgetBlueprints)
+	{
+		AddDefinitionJob(Def, TEXT("WidgetBlueprint"), [D = &Def, Manifest]() { return FWidgetBlueprintGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.ComponentBlueprints)
+	{
+		AddDefinitionJob(Def, TEXT("ComponentBlueprint"), [D = &Def, ProjectRoot]() { return FComponentBlueprintGenerator::Generate(*D, ProjectRoot); });
+	}
+	for (const auto& Def : ManifestData.BlueprintConditions)
+	{
+		AddDefinitionJob(Def, TEXT("BlueprintCondition"), [D = &Def, Manifest, ProjectRoot]() { return FBlueprintConditionGenerator::Generate(*D, ProjectRoot, Manifest); });
+	}
+	for (const auto& Def : ManifestData.Blackboards)
+	{
+		AddDefinitionJob(Def, TEXT("Blackboard"), [D = &Def]() { return FBlackboardGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.BehaviorTrees)
+	{
+		AddDefinitionJob(Def, TEXT("BehaviorTree"), [D = &Def]() { return FBehaviorTreeGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.Materials)
+	{
+		AddDefinitionJob(Def, TEXT("Material"), [D = &Def]() { return FMaterialGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.MaterialFunctions)
+	{
+		AddDefinitionJob(Def, TEXT("MaterialFunction"), [D = &Def]() { return FMaterialFunctionGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.MaterialInstances)
+	{
+		AddDefinitionJob(Def, TEXT("MaterialInstance"), [D = &Def]() { return FMaterialInstanceGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.TaggedDialogueSets)
+	{
+		AddDefinitionJob(Def, TEXT("TaggedDialogueSet"), [D = &Def]() { return FTaggedDialogueSetGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.AnimationMontages)
+	{
+		AddDefinitionJob(Def, TEXT("AnimationMontage"), [D = &Def]() { return FAnimationMontageGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.AnimationNotifies)
+	{
+		AddDefinitionJob(Def, TEXT("AnimationNotify"), [D = &Def, Manifest]() { return FAnimationNotifyGenerator::Generate(*D, Manifest); });
+	}
+	// v4.28: Option C item types all use the EquippableItem generator with the superset struct
+	for (const auto& Def : ManifestData.EquippableItems)
+	{
+		AddDefinitionJob(Def, TEXT("EquippableItem"), [D = &Def]() { return FEquippableItemGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.ConsumableItems)
+	{
+		AddDefinitionJob(Def, TEXT("ConsumableItem"), [D = &Def]() { return FEquippableItemGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.AmmoItems)
+	{
+		AddDefinitionJob(Def, TEXT("AmmoItem"), [D = &Def]() { return FEquippableItemGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.WeaponAttachments)
+	{
+		AddDefinitionJob(Def, TEXT("WeaponAttachment"), [D = &Def]() { return FEquippableItemGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.Activities)
+	{
+		AddDefinitionJob(Def, TEXT("Activity"), [D = &Def]() { return FActivityGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.BlueprintTriggers)
+	{
+		AddDefinitionJob(Def, TEXT("BlueprintTrigger"), [D = &Def, Manifest]() { return FBlueprintTriggerGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.AbilityConfigurations)
+	{
+		AddDefinitionJob(Def, TEXT("AbilityConfiguration"), [D = &Def]() { return FAbilityConfigurationGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.ActivityConfigurations)
+	{
+		AddDefinitionJob(Def, TEXT("ActivityConfiguration"), [D = &Def]() { return FActivityConfigurationGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.ItemCollections)
+	{
+		AddDefinitionJob(Def, TEXT("ItemCollection"), [D = &Def]() { return FItemCollectionGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.NarrativeEvents)
+	{
+		AddDefinitionJob(Def, TEXT("NarrativeEvent"), [D = &Def, Manifest]() { return FNarrativeEventGenerator::Generate(*D, Manifest); });
+	}
+	for (const auto& Def : ManifestData.NPCDefinitions)
+	{
+		AddDefinitionJob(Def, TEXT("NPCDefinition"), [D = &Def]() { return FNPCDefinitionGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.DialogueBlueprints)
+	{
+		AddDefinitionJob(Def, TEXT("DialogueBlueprint"), [D = &Def, Manifest, ProjectRoot]() { return FDialogueBlueprintGenerator::Generate(*D, ProjectRoot, Manifest); });
+	}
+	for (const auto& Def : ManifestData.CharacterDefinitions)
+	{
+		AddDefinitionJob(Def, TEXT("CharacterDefinition"), [D = &Def]() { return FCharacterDefinitionGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.CharacterAppearances)
+	{
+		AddDefinitionJob(Def, TEXT("CharacterAppearance"), [D = &Def]() { return FCharacterAppearanceGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.TriggerSets)
+	{
+		AddDefinitionJob(Def, TEXT("TriggerSet"), [D = &Def]() { return FTriggerSetGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.NiagaraSystems)
+	{
+		if (AddJob(Def.Name, TEXT("NiagaraSystem"), [D = &Def, Manifest]() { return FNiagaraSystemGenerator::Generate(ResolveNiagaraPresets(*D, *Manifest)); }))
+		{
+			// v7.8.84: The generator sees the preset-resolved copy, so a preset edit must change the input hash.
+			// Definition stays null - the prepared hash can't be published under the copy's address.
+			Jobs.Last().ComputeInputHash = [D = &Def, Manifest]() { return ResolveNiagaraPresets(*D, *Manifest).ComputeHash(); };
+		}
+	}
+	for (const auto& Def : ManifestData.ActivitySchedules)
+	{
+		AddDefinitionJob(Def, TEXT("ActivitySchedule"), [D = &Def]() { return FActivityScheduleGenerator::Generate(*D); });
+	}
+	for (const auto& Def : ManifestData.Quests)
+	{
+		AddDefinitionJob(Def, TEXT("Quest"), [D = &Def]() { return FQuestGenerator::Generate(*D); });
+	}
+}
+
+// ============================================================================
+// Manifest edges
+// ============================================================================
+
+// v7.8.84: Node property keys whose value names a class or asset - any other value (function names,
+// variable names, literals) is not a reference, even when it happens to match a manifest asset name
+static bool IsNodeReferenceKey(const FString& Key)
+{
+	return Key == TEXT("class")
+		|| Key.EndsWith(TEXT("_class"))        // target_class, source_class, spawn/cast classes
+		|| Key.StartsWith(TEXT("param."))      // TSubclassOf pin defaults (TryActivateAbilityByClass, ...)
+		|| Key == TEXT("struct_type")
+		|| Key.EndsWith(TEXT("element_type"));
+}
+
+void FGenerationScheduler::AddManifestDependencies(const FManifestData& ManifestData)
+{
+	TMap<FString, const FManifestEventGraphDefinition*> NamedGraphs;
+	for (const auto& Graph : ManifestData.EventGraphs)
+	{
+		NamedGraphs.Add(Graph.Name, &Graph);
+	}
+
+	auto Ref = [this](const FString& Dependent, const FString& Reference)
+	{
+		AddDependency(Dependent, Reference);
+	};
+	auto Refs = [this](const FString& Dependent, const TArray<FString>& References)
+	{
+		for (const FString& Reference : References)
+		{
+			AddDependency(Dependent, Reference);
+		}
+	};
+	// Node properties that name a class (TSubclassOf pins, cast targets, spawn classes, TryActivateAbilityByClass)
+	auto NodeRefs = [this](const FString& Dependent, const TArray<FManifestGraphNodeDefinition>& Nodes)
+	{
+		for (const auto& Node : Nodes)
+		{
+			for (const auto& Prop : Node.Properties)
+			{
+				if (IsNodeReferenceKey(Prop.Key))
+				{
+					AddDependency(Dependent, Prop.Value);
+				}
+			}
+		}
+	};
+	auto NamedGraphRefs = [&NamedGraphs, &NodeRefs](const FString& Dependent, const FString& GraphName)
+	{
+		if (const FManifestEventGraphDefinition* const* Graph = NamedGraphs.Find(GraphName))
+		{
+			NodeRefs(Dependent, (*Graph)->Nodes);
+		}
+	};
+	auto CustomFunctionRefs = [&NodeRefs](const FString& Dependent, const TArray<FManifestCustomFunctionDefinition>& Functions)
+	{
+		for (const auto& Function : Functions)
+		{
+			NodeRefs(Dependent, Function.Nodes);
+		}
+	};
+
+	for (const auto& GA : ManifestData.GameplayAbilities)
+	{
+		Ref(GA.Name, GA.ParentClass);
+		Ref(GA.Name, GA.CooldownGameplayEffectClass);
+		Ref(GA.Name, GA.CostGameplayEffectClass);
+		Ref(GA.Name, GA.DamageEffectClass);
+		NodeRefs(GA.Name, GA.EventGraphNodes);
+		NamedGraphRefs(GA.Name, GA.EventGraphName);
+		CustomFunctionRefs(GA.Name, GA.CustomFunctions);
+	}
+
+	for (const auto& BP : ManifestData.ActorBlueprints)
+	{
+		Ref(BP.Name, BP.ParentClass);
+		Ref(BP.Name, BP.BehaviorTree);
+		Ref(BP.Name, BP.SupportedGoalType);
+		NodeRefs(BP.Name, BP.EventGraphNodes);
+		NamedGraphRefs(BP.Name, BP.EventGraphName);
+		CustomFunctionRefs(BP.Name, BP.CustomFunctions);
+	}
+
+	for (const auto& WBP : ManifestData.WidgetBlueprints)
+	{
+		Ref(WBP.Name, WBP.ParentClass);
+		NodeRefs(WBP.Name, WBP.EventGraphNodes);
+		NamedGraphRefs(WBP.Name, WBP.EventGraphName);
+	}
+
+	for (const auto& CBP : ManifestData.ComponentBlueprints)
+	{
+		Ref(CBP.Name, CBP.ParentClass);
+	}
+
+	for (const auto& Cond : ManifestData.BlueprintConditions)
+	{
+		Ref(Cond.Name, Cond.ParentClass);
+		Refs(Cond.Name, Cond.NPCTargets);
+		Refs(Cond.Name, Cond.CharacterTargets);
+		NodeRefs(Cond.Name, Cond.EventGraphNodes);
+		NamedGraphRefs(Cond.Name, Cond.EventGraphName);
+	}
+
+	for (const auto& Goal : ManifestData.GoalItems)
+	{
+		Ref(Goal.Name, Goal.ParentClass);
+		NamedGraphRefs(Goal.Name, Goal.EventGraph);
+	}
+
+	for (const auto& Gen : ManifestData.GoalGenerators)
+	{
+		Ref(Gen.Name, Gen.ParentClass);
+		NamedGraphRefs(Gen.Name, Gen.EventGraph);
+	}
+
+	for (const auto& Cue : ManifestData.GameplayCues)
+	{
+		Ref(Cue.Name, Cue.ParentClass);
+		NamedGraphRefs(Cue.Name, Cue.EventGraph);
+	}
+
+	for (const auto& Service : ManifestData.BTServices)
+	{
+		Ref(Service.Name, Service.ParentClass);
+		NamedGraphRefs(Service.Name, Service.EventGraph);
+	}
+
+	for (const auto& Task : ManifestData.BTTasks)
+	{
+		Ref(Task.Name, Task.ParentClass);
+		NamedGraphRefs(Task.Name, Task.EventGraph);
+	}
+
+	for (const auto& Notify : ManifestData.AnimationNotifies)
+	{
+		Ref(Notify.Name, Notify.NotifyClass);
+		NamedGraphRefs(Notify.Name, Notify.EventGraph);
+	}
+
+	// BT -> BB, plus custom BP task/decorator/service classes used as nodes
+	for (const auto& BT : ManifestData.BehaviorTrees)
+	{
+		Ref(BT.Name, BT.BlackboardAsset);
+		for (const auto& Node : BT.Nodes)
+		{
+			Ref(BT.Name, Node.TaskClass);
+			for (const auto& Decorator : Node.Decorators)
+			{
+				Ref(BT.Name, Decorator.Class);
+			}
+			for (const auto& Service : Node.Services)
+			{
+				Ref(BT.Name, Service.Class);
+			}
+		}
+	}
+
+	// Material -> MaterialFunction (MaterialFunctionCall expressions)
+	for (const auto& Mat : ManifestData.Materials)
+	{
+		for (const auto& Expr : Mat.Expressions)
+		{
+			Ref(Mat.Name, Expr.Function);
+		}
+	}
+
+	for (const auto& MI : ManifestData.MaterialInstances)
+	{
+		Ref(MI.Name, MI.ParentMaterial);
+	}
+
+	auto ItemRefs = [&](const FManifestEquippableItemDefinition& Item)
+	{
+		Ref(Item.Name, Item.ParentClass);
+		Ref(Item.Name, Item.EquipmentModifierGE);
+		Ref(Item.Name, Item.GameplayEffectClass);
+		Ref(Item.Name, Item.WeaponVisualClass);
+		Ref(Item.Name, Item.RequiredAmmo);
+		Ref(Item.Name, Item.CrosshairWidget);
+		Ref(Item.Name, Item.ItemWidgetOverride);
+		Refs(Item.Name, Item.AbilitiesToGrant);
+		Refs(Item.Name, Item.EquipmentAbilities);
+		Refs(Item.Name, Item.WeaponAbilities);
+		Refs(Item.Name, Item.MainhandAbilities);
+		Refs(Item.Name, Item.OffhandAbilities);
+		Refs(Item.Name, Item.ActivitiesToGrant);
+	};
+	for (const auto& Item : ManifestData.EquippableItems) { ItemRefs(Item); }
+	for (const auto& Item : ManifestData.ConsumableItems) { ItemRefs(Item); }
+	for (const auto& Item : ManifestData.AmmoItems) { ItemRefs(Item); }
+	for (const auto& Item : ManifestData.WeaponAttachments) { ItemRefs(Item); }
+
+	// Activities -> goals (v7.8.36 ordering fix, now an edge)
+	for (const auto& Act : ManifestData.Activities)
+	{
+		Ref(Act.Name, Act.ParentClass);
+		Ref(Act.Name, Act.BehaviorTree);
+		Ref(Act.Name, Act.SupportedGoalType);
+		Ref(Act.Name, Act.FollowGoal);
+		Ref(Act.Name, Act.InteractSubGoal);
+		Refs(Act.Name, Act.WeaponTypes);
+		NamedGraphRefs(Act.Name, Act.EventGraph);
+	}
+
+	for (const auto& Trigger : ManifestData.BlueprintTriggers)
+	{
+		Ref(Trigger.Name, Trigger.ParentClass);
+		Ref(Trigger.Name, Trigger.MarkerClass);
+		Refs(Trigger.Name, Trigger.NPCsToFollow);
+		NamedGraphRefs(Trigger.Name, Trigger.EventGraph);
+	}
+
+	for (const auto& AC : ManifestData.AbilityConfigurations)
+	{
+		Refs(AC.Name, AC.Abilities);
+		Refs(AC.Name, AC.StartupEffects);
+		Ref(AC.Name, AC.DefaultAttributes);
+	}
+
+	for (const auto& ActC : ManifestData.ActivityConfigurations)
+	{
+		Ref(ActC.Name, ActC.DefaultActivity);
+		Refs(ActC.Name, ActC.Activities);
+		Refs(ActC.Name, ActC.GoalGenerators);
+	}
+
+	for (const auto& Collection : ManifestData.ItemCollections)
+	{
+		Refs(Collection.Name, Collection.Items);
+		for (const auto& Entry : Collection.ItemsWithQuantity)
+		{
+			Ref(Collection.Name, Entry.ItemClass);
+		}
+	}
+
+	for (const auto& Event : ManifestData.NarrativeEvents)
+	{
+		Ref(Event.Name, Event.ParentClass);
+		Refs(Event.Name, Event.NPCTargets);
+		Refs(Event.Name, Event.CharacterTargets);
+		NamedGraphRefs(Event.Name, Event.EventGraph);
+	}
+
+	// v4.37: NPC -> AC/ActivityConfig; Dialogue -> NPC speakers
+	// v7.8.84: No NPC -> Dialogue edge - the NPC stores its dialogue as a soft class path (nothing loaded),
+	// while a dialogue loads its speakers' NPCDefinitions, so only that direction orders generation
+	for (const auto& NPC : ManifestData.NPCDefinitions)
+	{
+		Ref(NPC.Name, NPC.AbilityConfiguration);
+		Ref(NPC.Name, NPC.ActivityConfiguration);
+		Ref(NPC.Name, NPC.TaggedDialogueSet);
+		Ref(NPC.Name, NPC.DefaultAppearance);
+		Refs(NPC.Name, NPC.TriggerSets);
+		Refs(NPC.Name, NPC.ActivitySchedules);
+		Refs(NPC.Name, NPC.DefaultItemLoadoutCollections);
+	}
+
+	for (const auto& DBP : ManifestData.DialogueBlueprints)
+	{
+		for (const auto& Speaker : DBP.Speakers)
+		{
+			Ref(DBP.Name, Speaker.NPCDefinition);
+		}
+	}
+
+	for (const auto& CD : ManifestData.CharacterDefinitions)
+	{
+		Ref(CD.Name, CD.AbilityConfiguration);
+		Ref(CD.Name, CD.DefaultAppearance);
+		Refs(CD.Name, CD.TriggerSets);
+	}
+
+	for (const auto& TS : ManifestData.TriggerSets)
+	{
+		for (const auto& Trigger : TS.Triggers)
+		{
+			Ref(TS.Name, Trigger.TriggerClass);
+		}
+	}
+
+	for (const auto& Schedule : ManifestData.ActivitySchedules)
+	{
+		for (const auto& Behavior : Schedule.Behaviors)
+		{
+			Ref(Schedule.Name, Behavior.GoalClass);
+		}
+	}
+
+	for (const auto& Quest : ManifestData.Quests)
+	{
+		Ref(Quest.Name, Quest.Questgiver);
+		Ref(Quest.Name, Quest.Dialogue);
+	}
+}
@@ -0,0 +1,262 @@
+// GasAbilityGenerator v7.8.73 - Manifest watch mode
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+
+#include "GasAbilityGeneratorWatcher.h"
+#include "GasAbilityGeneratorParser.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasAbilityWatcher, Log, All);
+
+static FString NormalizeWatchPath(const FString& Path)
+{
+	FString Result = FPaths::ConvertRelativePathToFull(Path);
+	FPaths::NormalizeFilename(Result);
+	return Result;
+}
+
+static IDirectoryWatcher* GetDirectoryWatcher()
+{
+	FDirectoryWatcherModule& Module = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	return Module.Get();
+}
+
+FString FManifestWatchChange::Describe() const
+{
+	TArray<FString> Names;
+	for (const FString& File : ChangedFiles)
+	{
+		Names.Add(FPaths::GetCleanFilename(File));
+	}
+	return FString::Join(Names, TEXT(", "));
+}
+
+FManifestWatcher::~FManifestWatcher()
+{
+	Stop();
+}
+
+bool FManifestWatcher::Start(const FString& InManifestPath, const FString& InDialogueCSVPath, FOnManifestWatchTriggered InOnTriggered, float InDebounceSeconds)
+{
+	check(IsInGameThread());
+	Stop();
+
+	ManifestPath = NormalizeWatchPath(InManifestPath);
+	DialogueCSVPath = InDialogueCSVPath.IsEmpty() ? FString() : NormalizeWatchPath(InDialogueCSVPath);
+	OnTriggered = MoveTemp(InOnTriggered);
+	DebounceSeconds = FMath::Max(InDebounceSeconds, 0.0f);
+
+	IDirectoryWatcher* DirectoryWatcher = GetDirectoryWatcher();
+	if (!DirectoryWatcher)
+	{
+		UE_LOG(LogGasAbilityWatcher, Error, TEXT("DirectoryWatcher is not available on this platform"));
+		return false;
+	}
+
+	TArray<FString> Directories;
+	Directories.Add(FPaths::GetPath(ManifestPath));
+	if (!DialogueCSVPath.IsEmpty())
+	{
+		Directories.AddUnique(FPaths::GetPath(DialogueCSVPath));
+	}
+
+	for (const FString& Directory : Directories)
+	{
+		FDelegateHandle Handle;
+		if (!DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(Directory,
+			IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FManifestWatcher::OnDirectoryChanged), Handle))
+		{
+			UE_LOG(LogGasAbilityWatcher, Error, TEXT("Failed to watch directory: %s"), *Directory);
+			Stop();
+			return false;
+		}
+		Registrations.Emplace(Directory, Handle);
+	}
+
+	// Baseline content - the first trigger fires only for files that really changed after Start
+	UpdateContentHash(ManifestPath);
+	if (!DialogueCSVPath.IsEmpty())
+	{
+		UpdateContentHash(DialogueCSVPath);
+	}
+	TArray<FString> IncrementalFiles;
+	FindIncrementalFiles(ManifestPath, IncrementalFiles);
+	for (const FString& File : IncrementalFiles)
+	{
+		UpdateContentHash(File);
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FManifestWatcher::Tick), 0.1f);
+
+	UE_LOG(LogGasAbilityWatcher, Display, TEXT("Watching %s (%d incremental file(s)%s, debounce %.2fs)"),
+		*ManifestPath, IncrementalFiles.Num(), DialogueCSVPath.IsEmpty() ? TEXT("") : TEXT(", dialogue CSV"), DebounceSeconds);
+	return true;
+}
+
+void FManifestWatcher::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (Registrations.Num() > 0)
+	{
+		// The module may already be gone during editor shutdown
+		if (FDirectoryWatcherModule* Module = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+		{
+			if (IDirectoryWatcher* DirectoryWatcher = Module->Get())
+			{
+				for (const TPair<FString, FDelegateHandle>& Registration : Registrations)
+				{
+					DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Registration.Key, Registration.Value);
+				}
+			}
+		}
+		Registrations.Reset();
+	}
+
+	PendingFiles.Reset();
+	ContentHashes.Reset();
+	bPaused = false;
+}
+
+FManifestWatcher::EWatchedFile FManifestWatcher::Classify(const FString& Filename) const
+{
+	if (FPaths::IsSamePath(Filename, ManifestPath))
+	{
+		return EWatchedFile::Manifest;
+	}
+	if (!DialogueCSVPath.IsEmpty() && FPaths::IsSamePath(Filename, DialogueCSVPath))
+	{
+		return EWatchedFile::DialogueCSV;
+	}
+
+	// Editor swap/backup files (.manifest.yaml.swp, manifest.yaml~) don't match the extension check
+	const FString CleanName = FPaths::GetCleanFilename(Filename);
+	if (!CleanName.StartsWith(TEXT(".")) &&
+		FPaths::GetExtension(Filename).Equals(TEXT("yaml"), ESearchCase::IgnoreCase) &&
+		FPaths::IsSamePath(FPaths::GetPath(Filename), FPaths::GetPath(ManifestPath)))
+	{
+		return EWatchedFile::Incremental;
+	}
+
+	return EWatchedFile::None;
+}
+
+void FManifestWatcher::OnDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	for (const FFileChangeData& Change : Changes)
+	{
+		const FString Filename = NormalizeWatchPath(Change.Filename);
+		if (Classify(Filename) != EWatchedFile::None)
+		{
+			PendingFiles.Add(Filename);
+			LastEventTime = FPlatformTime::Seconds();
+		}
+	}
+}
+
+bool FManifestWatcher::Tick(float DeltaTime)
+{
+	if (bPaused || PendingFiles.Num() == 0 || FPlatformTime::Seconds() - LastEventTime < DebounceSeconds)
+	{
+		return true;
+	}
+
+	FManifestWatchChange Change;
+	for (const FString& Filename : PendingFiles)
+	{
+		if (!UpdateContentHash(Filename))
+		{
+			continue;
+		}
+
+		Change.ChangedFiles.Add(Filename);
+		switch (Classify(Filename))
+		{
+		case EWatchedFile::Manifest: Change.bManifestChanged = true; break;
+		case EWatchedFile::DialogueCSV: Change.bDialogueCSVChanged = true; break;
+		case EWatchedFile::Incremental: Change.bIncrementalFilesChanged = true; break;
+		default: break;
+		}
+	}
+	PendingFiles.Reset();
+
+	if (Change.ChangedFiles.Num() > 0)
+	{
+		Change.ChangedFiles.Sort();
+		UE_LOG(LogGasAbilityWatcher, Display, TEXT("Changed: %s"), *Change.Describe());
+		OnTriggered.ExecuteIfBound(Change);
+	}
+	return true;
+}
+
+bool FManifestWatcher::UpdateContentHash(const FString& Filename)
+{
+	uint64 Hash = 0;
+	TArray<uint8> Bytes;
+	if (FFileHelper::LoadFileToArray(Bytes, *Filename, FILEREAD_Silent))
+	{
+		// Never 0 for an existing file, so an empty file still differs from a deleted one
+		Hash = GeneratorHash::OfBytes(Bytes.GetData(), Bytes.Num()) | 1;
+	}
+
+	const uint64* Previous = ContentHashes.Find(Filename);
+	const bool bChanged = !Previous || *Previous != Hash;
+	ContentHashes.Add(Filename, Hash);
+	return bChanged;
+}
+
+void FManifestWatcher::FindIncrementalFiles(const FString& ManifestPath, TArray<FString>& OutFiles)
+{
+	OutFiles.Reset();
+
+	const FString Directory = FPaths::GetPath(ManifestPath);
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(Directory / TEXT("*.yaml")), true, false);
+	FileNames.Sort();
+
+	for (const FString& FileName : FileNames)
+	{
+		const FString FullPath = NormalizeWatchPath(Directory / FileName);
+		if (!FileName.StartsWith(TEXT(".")) && !FPaths::IsSamePath(FullPath, ManifestPath))
+		{
+			OutFiles.Add(FullPath);
+		}
+	}
+}
+
+int32 FManifestWatcher::ApplyIncrementalFiles(const FString& ManifestPath, FManifestData& InOutData, TArray<FString>* OutAssetNames)
+{
+	TArray<FString> Files;
+	FindIncrementalFiles(NormalizeWatchPath(ManifestPath), Files);
+
+	int32 AppliedCount = 0;
+	for (const FString& File : Files)
+	{
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *File))
+		{
+			UE_LOG(LogGasAbilityWatcher, Warning, TEXT("Failed to read incremental file: %s"), *File);
+			continue;
+		}
+
+		// Files without asset_name aren't incremental updates; whitelist failures are logged by the parser
+		FString AssetName;
+		if (FGasAbilityGeneratorParser::ParseIncrementalFile(Content, AssetName, InOutData))
+		{
+			AppliedCount++;
+			if (OutAssetNames)
+			{
+				OutAssetNames->Add(AssetName);
+			}
+		}
+	}
+	return AppliedCount;
+}
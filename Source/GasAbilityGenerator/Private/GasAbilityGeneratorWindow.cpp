@@ -1,5 +1,16 @@
-// GasAbilityGenerator v3.7
+// GasAbilityGenerator v7.8.84
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.84: Each generation run is its own profiler session (reports no longer accumulate across runs)
+// v7.8.83: Optional dialogue CSV merged into the manifest and watched; jobs run through the scheduler's shared helpers
+// v7.8.83: NPC input hash streamed through FGeneratorHashBuilder
+// v7.8.75: Generate Assets runs time-sliced from the core ticker - per-asset progress, Cancel, editor stays responsive
+// v7.8.74: Log output is a ring-buffered SGeneratorLogView (O(1) append, per-frame batches, streamed to disk)
+// v7.8.73: Watch mode - saves to manifest.yaml / incremental *.yaml regenerate only the change set
+// v7.8.72: Definition hash snapshot saved after each run for the next incremental pass
+// v7.8.65: Fresh function resolution cache per generation, stats in the log
+// v7.8.64: Fresh Blueprint/enum name index per generation
+// v7.8.62: 64-bit GeneratorHash manifest/NPC hashes; legacy-hash records regenerate once
+// v7.8.61: Parsed manifest reused while its content is unchanged
 // v3.7: Added NPC Creation feature - one-click NPC asset generation with v3.0 hash safety
 // v3.0: Added Dry Run and Force checkboxes for metadata-aware regeneration
 // v2.5.0: Renamed to GasAbilityGenerator for generic UE project compatibility
@@ -10,8 +21,15 @@
 #include "GasAbilityGeneratorGenerators.h"
 #include "Locked/GasAbilityGeneratorMetadata.h"  // v4.12.5: Explicit include for TryGetMetadata (compile-time guard rail)
 #include "GasAbilityGeneratorParser.h"
+#include "GasAbilityGeneratorDialogueCSVParser.h"  // v7.8.83
 #include "GasAbilityGeneratorPipeline.h"  // v4.12: Mesh-to-Item Pipeline
 #include "GasAbilityGeneratorReport.h"    // v4.12: Window report hooks
+#include "GasAbilityGeneratorAssetIndex.h"  // v7.8.64
+#include "GasAbilityGeneratorFunctionResolver.h"  // v7.8.65
+#include "GasAbilityGeneratorScheduler.h"  // v7.8.73: Watch passes
+#include "GasAbilityGeneratorWatcher.h"    // v7.8.73
+#include "GasAbilityGeneratorLogView.h"    // v7.8.74
+#include "GasAbilityGeneratorProfiler.h"   // v7.8.84
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SMultiLineEditableTextBox.h"
 #include "Widgets/Input/SButton.h"
@@ -20,6 +38,7 @@
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Notifications/SProgressBar.h"  // v7.8.75
 #include "DesktopPlatformModule.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/FileHelper.h"
@@ -51,21 +70,23 @@ static uint64 ComputeNPCInputHash(const FString& NPCName)
 {
 	// Hash includes all parameters that affect the generated NPC
 	// This creates a unique identifier for the current configuration
-	uint64 Hash = GetTypeHash(NPCName);
+	// v7.8.83: Streamed through FGeneratorHashBuilder like the definition hashes
+	FGeneratorHashBuilder Hash;
+	Hash.Field(TEXT("NPCName"), NPCName);
 
 	// Include fixed parameters (these are hardcoded in the UI for now)
-	Hash ^= GetTypeHash(FString(TEXT("AC_NPC_Default")));  // AbilityConfiguration
-	Hash ^= GetTypeHash(FString(TEXT("AC_RunAndGun")));    // ActivityConfiguration
-	Hash ^= GetTypeHash(FString(TEXT("TableToRoll")));     // Using TableToRoll method (like Seth)
-	Hash ^= GetTypeHash(FString(TEXT("Narrative.State.Invulnerable"))); // OwnedTags
-	Hash ^= GetTypeHash(FString(TEXT("Narrative.Factions.Heroes"))); // Factions
-	Hash ^= GetTypeHash(FString(TEXT("BuyItemPercentage=0.0"))); // Default non-vendor
-	Hash ^= GetTypeHash(FString(TEXT("SellItemPercentage=0.0"))); // Default non-vendor
+	Hash.Field(TEXT("AbilityConfiguration"), TEXT("AC_NPC_Default"));
+	Hash.Field(TEXT("ActivityConfiguration"), TEXT("AC_RunAndGun"));
+	Hash.Field(TEXT("SpawnMethod"), TEXT("TableToRoll"));  // Using TableToRoll method (like Seth)
+	Hash.Field(TEXT("OwnedTags"), TEXT("Narrative.State.Invulnerable"));
+	Hash.Field(TEXT("Factions"), TEXT("Narrative.Factions.Heroes"));
+	Hash.Field(TEXT("BuyItemPercentage"), 0.0f);  // Default non-vendor
+	Hash.Field(TEXT("SellItemPercentage"), 0.0f); // Default non-vendor
 
 	// Version identifier for hash compatibility
-	Hash ^= 0x37000002ULL; // v3.7 NPC UI version 2 (TableToRoll, 0% buy/sell)
+	Hash.Field(TEXT("UIVersion"), 0x37000002ULL); // v3.7 NPC UI version 2 (TableToRoll, 0% buy/sell)
 
-	return Hash;
+	return Hash.Finalize();
 }
 
 // v3.7: Check asset status using v3.0 metadata system
@@ -116,10 +137,12 @@ static ENPCAssetStatus CheckNPCAssetStatus(
 	}
 
 	// Has metadata - compare hashes using struct helpers (behavior-identical to UObject version)
-	bool bInputChanged = Metadata.HasInputChanged(InputHash);
+	// v7.8.62: Legacy-hash records regenerate once (input not comparable across hash versions)
+	const bool bLegacyHash = Metadata.HashVersion != GeneratorHash::Version;
+	bool bInputChanged = bLegacyHash || Metadata.HasInputChanged(InputHash);
 
 	// Compute current output hash
-	uint64 CurrentOutputHash = FGeneratorBase::ComputeDataAssetOutputHash(ExistingAsset);
+	uint64 CurrentOutputHash = FGeneratorBase::ComputeOutputHash(ExistingAsset, Metadata.HashVersion);
 	bool bOutputChanged = Metadata.HasOutputChanged(CurrentOutputHash);
 
 	if (!bInputChanged && !bOutputChanged)
@@ -162,6 +185,7 @@ static void StoreNPCAssetMetadata(
 	Metadata.GeneratorVersion = TEXT("3.7");
 	Metadata.Timestamp = FDateTime::Now();
 	Metadata.bIsGenerated = true;
+	Metadata.HashVersion = GeneratorHash::Version;
 
 	FGeneratorBase::StoreAssetMetadata(Asset, Metadata);
 }
@@ -217,6 +241,7 @@ void SGasAbilityGeneratorWindow::Construct(const FArguments& InArgs)
 				SNew(SButton)
 				.Text(LOCTEXT("Browse", "Browse..."))
 				.OnClicked(this, &SGasAbilityGeneratorWindow::OnBrowseClicked)
+				.IsEnabled(this, &SGasAbilityGeneratorWindow::IsIdle)
 			]
 		]
 
@@ -291,6 +316,33 @@ void SGasAbilityGeneratorWindow::Construct(const FArguments& InArgs)
 					.ToolTipText(LOCTEXT("ForceTooltip", "Regenerate all assets even if they were manually edited (overwrite conflicts)"))
 				]
 			]
+
+			// v7.8.73: Watch mode
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(20, 0, 0, 0)
+			[
+				SNew(SHorizontalBox)
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				[
+					SAssignNew(WatchCheckbox, SCheckBox)
+					.OnCheckStateChanged(this, &SGasAbilityGeneratorWindow::OnWatchCheckStateChanged)
+				]
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(4, 0, 0, 0)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("Watch", "Watch (Regenerate on Save)"))
+					.ToolTipText(LOCTEXT("WatchTooltip", "Watch manifest.yaml and incremental *.yaml files in the manifest folder; on save, reparse the edited sections and regenerate only the changed assets and their dependents"))
+				]
+			]
 		]
 
 		// Buttons
@@ -307,6 +359,7 @@ void SGasAbilityGeneratorWindow::Construct(const FArguments& InArgs)
 				SAssignNew(GenerateTagsButton, SButton)
 				.Text(LOCTEXT("GenerateTags", "Generate Tags"))
 				.OnClicked(this, &SGasAbilityGeneratorWindow::OnGenerateTagsClicked)
+				.IsEnabled(this, &SGasAbilityGeneratorWindow::IsIdle)
 			]
 
 			+ SHorizontalBox::Slot()
@@ -316,12 +369,29 @@ void SGasAbilityGeneratorWindow::Construct(const FArguments& InArgs)
 				SAssignNew(GenerateAssetsButton, SButton)
 				.Text(LOCTEXT("GenerateAssets", "Generate Assets"))
 				.OnClicked(this, &SGasAbilityGeneratorWindow::OnGenerateAssetsClicked)
+				.IsEnabled(this, &SGasAbilityGeneratorWindow::IsIdle)
 			]
 
+			// v7.8.75: Run progress (per asset) and cancel
 			+ SHorizontalBox::Slot()
 			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 10, 0)
 			[
-				SNullWidget::NullWidget
+				SNew(SProgressBar)
+				.Percent(this, &SGasAbilityGeneratorWindow::GetGenerationProgress)
+				.Visibility(this, &SGasAbilityGeneratorWindow::GetGenerationProgressVisibility)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0, 0, 10, 0)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("CancelGeneration", "Cancel"))
+				.ToolTipText(LOCTEXT("CancelGenerationTooltip", "Stop after the current asset; assets generated so far are saved and reported"))
+				.OnClicked(this, &SGasAbilityGeneratorWindow::OnCancelGenerationClicked)
+				.Visibility(this, &SGasAbilityGeneratorWindow::GetGenerationProgressVisibility)
 			]
 
 			+ SHorizontalBox::Slot()
@@ -436,13 +506,8 @@ void SGasAbilityGeneratorWindow::Construct(const FArguments& InArgs)
 			SNew(SBox)
 			.MinDesiredHeight(200)
 			[
-				SNew(SScrollBox)
-				+ SScrollBox::Slot()
-				[
-					SAssignNew(LogTextBox, SMultiLineEditableTextBox)
-					.IsReadOnly(true)
-					.BackgroundColor(FLinearColor(0.02f, 0.02f, 0.02f))
-				]
+				// v7.8.74: Virtualized - only visible rows are laid out
+				SAssignNew(LogView, SGeneratorLogView)
 			]
 		]
 	];
@@ -456,22 +521,40 @@ void SGasAbilityGeneratorWindow::Construct(const FArguments& InArgs)
 
 SGasAbilityGeneratorWindow::~SGasAbilityGeneratorWindow()
 {
+	// v7.8.75: Closed mid-run - stop here, but still save and report what was generated
+	if (ActiveRun.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(GenerationTickerHandle);
+		GenerationTickerHandle.Reset();
+		ActiveRun->bCancelRequested = true;
+		FinishGenerationRun(false);
+	}
+
+	StopWatching();
 	SaveConfig();
 }
 
 void SGasAbilityGeneratorWindow::LoadConfig()
 {
 	GConfig->GetString(TEXT("GasAbilityGenerator"), TEXT("ManifestFolderPath"), GuidesFolderPath, GEditorPerProjectIni);
+	GConfig->GetString(TEXT("GasAbilityGenerator"), TEXT("DialogueCSVPath"), DialogueCSVPath, GEditorPerProjectIni);
 }
 
 void SGasAbilityGeneratorWindow::SaveConfig()
 {
 	GConfig->SetString(TEXT("GasAbilityGenerator"), TEXT("ManifestFolderPath"), *GuidesFolderPath, GEditorPerProjectIni);
+	GConfig->SetString(TEXT("GasAbilityGenerator"), TEXT("DialogueCSVPath"), *DialogueCSVPath, GEditorPerProjectIni);
 	GConfig->Flush(false, GEditorPerProjectIni);
 }
 
 FReply SGasAbilityGeneratorWindow::OnBrowseClicked()
 {
+	// v7.8.75: A running generation reads ManifestData
+	if (bIsGenerating)
+	{
+		return FReply::Handled();
+	}
+
 	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
 	if (DesktopPlatform)
 	{
@@ -489,6 +572,12 @@ FReply SGasAbilityGeneratorWindow::OnBrowseClicked()
 			GuidesPathTextBox->SetText(FText::FromString(GuidesFolderPath));
 			SaveConfig();
 			LoadManifest();
+
+			// v7.8.73: Follow the new folder
+			if (ManifestWatcher.IsValid())
+			{
+				StartWatching();
+			}
 		}
 	}
 
@@ -543,7 +632,23 @@ bool SGasAbilityGeneratorWindow::LoadManifest()
 
 void SGasAbilityGeneratorWindow::ParseManifest(const FString& ManifestContent)
 {
-	FGasAbilityGeneratorParser::ParseManifest(ManifestContent, ManifestData);
+	// v7.8.73: While watching, reparse only the sections whose text changed since the last save
+	if (WatchSectionCache.IsValid())
+	{
+		WatchSectionCache->Parse(ManifestContent, ManifestData);
+		AppendLog(FString::Printf(TEXT("Reparsed %d section(s), reused %d"),
+			WatchSectionCache->GetLastReparsedCount(), WatchSectionCache->GetLastReusedCount()));
+	}
+	else
+	{
+		// v7.8.61: Reuse the previous parse when the manifest content is unchanged
+		bool bCacheHit = false;
+		ManifestData = *FManifestParseCache::GetOrParse(ManifestContent, &bCacheHit);
+		if (bCacheHit)
+		{
+			AppendLog(TEXT("Manifest unchanged since last load - reused cached parse"));
+		}
+	}
 
 	// v4.13: Category C - Expand FormStateEffects to GameplayEffects (P1.1)
 	if (ManifestData.FormStateEffects.Num() > 0)
@@ -565,6 +670,38 @@ void SGasAbilityGeneratorWindow::ParseManifest(const FString& ManifestContent)
 			}
 		}
 	}
+
+	// v7.8.83: Dialogue CSV, same precedence as the commandlet (CSV overrides YAML)
+	const FString CSVPath = GetDialogueCSVFilePath();
+	if (!CSVPath.IsEmpty())
+	{
+		TArray<FManifestDialogueBlueprintDefinition> CSVDialogues;
+		if (!FPaths::FileExists(CSVPath))
+		{
+			AppendLog(FString::Printf(TEXT("WARNING: Dialogue CSV not found: %s"), *CSVPath));
+		}
+		else if (FDialogueCSVParser::ParseCSVFile(CSVPath, CSVDialogues))
+		{
+			FDialogueCSVParser::ApplyToManifest(CSVDialogues, ManifestData);
+			AppendLog(FString::Printf(TEXT("Loaded %d dialogues from CSV: %s"), CSVDialogues.Num(), *CSVPath));
+		}
+		else
+		{
+			AppendLog(FString::Printf(TEXT("WARNING: Failed to parse dialogue CSV: %s"), *CSVPath));
+		}
+	}
+}
+
+FString SGasAbilityGeneratorWindow::GetDialogueCSVFilePath() const
+{
+	if (DialogueCSVPath.IsEmpty())
+	{
+		return FString();
+	}
+
+	FString CSVPath = FPaths::IsRelative(DialogueCSVPath) ? FPaths::Combine(GuidesFolderPath, DialogueCSVPath) : DialogueCSVPath;
+	FPaths::NormalizeFilename(CSVPath);
+	return CSVPath;
 }
 
 FReply SGasAbilityGeneratorWindow::OnGenerateTagsClicked()
@@ -590,9 +727,8 @@ FReply SGasAbilityGeneratorWindow::OnGenerateAssetsClicked()
 		return FReply::Handled();
 	}
 
-	bIsGenerating = true;
+	// v7.8.75: Time-sliced - bIsGenerating stays set until FinishGenerationRun
 	GenerateAssets();
-	bIsGenerating = false;
 
 	return FReply::Handled();
 }
@@ -604,11 +740,12 @@ FReply SGasAbilityGeneratorWindow::OnSettingsClicked()
 
 FReply SGasAbilityGeneratorWindow::OnCopyLogClicked()
 {
-	if (LogTextBox.IsValid())
+	if (LogView.IsValid())
 	{
-		FString LogContent = LogTextBox->GetText().ToString();
+		// v7.8.74: Selected or filtered lines in the view; the complete log is in the window's log file
+		FString LogContent = LogView->GetCopyText();
 		FPlatformApplicationMisc::ClipboardCopy(*LogContent);
-		UpdateStatus(TEXT("Log copied to clipboard"));
+		UpdateStatus(FString::Printf(TEXT("Log copied to clipboard (full log: %s)"), *LogView->GetLogFilePath()));
 	}
 	return FReply::Handled();
 }
@@ -663,6 +800,91 @@ void SGasAbilityGeneratorWindow::GenerateTags()
 	ShowResultsDialog(Summary);
 }
 
+// ============================================================================
+// v7.8.75: Time-sliced generation
+// ============================================================================
+
+/**
+ * v7.8.75: One window generation run. The core ticker steps it one asset at a time, so the editor
+ * keeps painting, the progress bar moves and Cancel is honored between assets.
+ */
+struct FWindowGenerationRun
+{
+	FGenerationScheduler Scheduler;
+	FGenerationSummary Summary;
+	FPipelineProcessor Pipeline;
+	FString ManifestPath;
+	FString CurrentAsset;
+	bool bDryRun = false;
+	bool bForce = false;
+	bool bChangeSetOnly = false;   // Watch pass: up-to-date jobs are reported skipped without generating
+	bool bCancelRequested = false;
+	bool bJobsDone = false;
+	int32 NextPipelineItem = 0;    // Pipeline items run after the scheduler jobs (full runs only)
+	int32 TotalSteps = 0;
+	int32 CompletedSteps = 0;
+	double StartSeconds = 0.0;
+};
+
+namespace WindowGeneration
+{
+	/** Generation time per editor frame - at least one asset runs every tick regardless */
+	static constexpr double FrameBudgetSeconds = 0.05;
+
+	static const TCHAR* GetStatusTag(EGenerationStatus Status)
+	{
+		return Status == EGenerationStatus::New ? TEXT("NEW") :
+			Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL");
+	}
+
+	// v4.12: Mesh-to-Item Pipeline
+	static FGenerationResult ProcessPipelineItem(FPipelineProcessor& Pipeline, const FManifestPipelineItemDefinition& ItemDef)
+	{
+		// Convert manifest definition to pipeline input
+		FPipelineMeshInput Input;
+		Input.MeshPath = ItemDef.Mesh;
+		Input.DisplayName = ItemDef.DisplayName;
+		Input.EquipmentSlot = ItemDef.Slot;
+		Input.TargetCollection = ItemDef.TargetCollection;
+
+		// Convert type string to enum
+		if (ItemDef.Type.Equals(TEXT("Weapon_Melee"), ESearchCase::IgnoreCase))
+		{
+			Input.ItemType = EPipelineItemType::Weapon_Melee;
+		}
+		else if (ItemDef.Type.Equals(TEXT("Weapon_Ranged"), ESearchCase::IgnoreCase))
+		{
+			Input.ItemType = EPipelineItemType::Weapon_Ranged;
+		}
+		else if (ItemDef.Type.Equals(TEXT("Consumable"), ESearchCase::IgnoreCase))
+		{
+			Input.ItemType = EPipelineItemType::Consumable;
+		}
+		else if (ItemDef.Type.Equals(TEXT("Generic"), ESearchCase::IgnoreCase))
+		{
+			Input.ItemType = EPipelineItemType::Generic;
+		}
+		else
+		{
+			Input.ItemType = EPipelineItemType::Clothing;  // Default
+		}
+
+		FPipelineProcessResult PipeResult = Pipeline.ProcessMesh(Input);
+
+		// Create generation result from pipeline result
+		FString ItemName = ItemDef.Name.IsEmpty() ? FPipelineMeshAnalyzer::GenerateItemAssetName(FPaths::GetBaseFilename(ItemDef.Mesh)) : ItemDef.Name;
+		FGenerationResult Result(
+			ItemName,
+			PipeResult.bSuccess ? EGenerationStatus::New : EGenerationStatus::Failed,
+			PipeResult.bSuccess ? TEXT("Pipeline item generated") : (PipeResult.Errors.Num() > 0 ? PipeResult.Errors[0] : TEXT("Pipeline failed"))
+		);
+		Result.GeneratorId = TEXT("Pipeline");
+		Result.AssetPath = PipeResult.GeneratedItemPath;
+		Result.DetermineCategory();
+		return Result;
+	}
+}
+
 void SGasAbilityGeneratorWindow::GenerateAssets()
 {
 	// v3.0: Check dry run and force modes from checkboxes
@@ -680,14 +902,38 @@ void SGasAbilityGeneratorWindow::GenerateAssets()
 
 	AppendLog(TEXT("Starting asset generation..."));
 
+	// v7.8.75: Returns immediately - the run is stepped from the core ticker
+	StartGenerationRun(bDryRun, bForce, false);
+}
+
+void SGasAbilityGeneratorWindow::StartGenerationRun(bool bDryRun, bool bForce, bool bChangeSetOnly)
+{
+	check(!ActiveRun.IsValid());
+	ActiveRun = MakeUnique<FWindowGenerationRun>();
+	FWindowGenerationRun& Run = *ActiveRun;
+	Run.ManifestPath = FPaths::Combine(GuidesFolderPath, TEXT("manifest.yaml"));
+	Run.bDryRun = bDryRun;
+	Run.bForce = bForce;
+	Run.bChangeSetOnly = bChangeSetOnly;
+	Run.StartSeconds = FPlatformTime::Seconds();
+
+	// ManifestData and the generator session state must not change until FinishGenerationRun
+	bIsGenerating = true;
+	if (ManifestWatcher.IsValid())
+	{
+		ManifestWatcher->SetPaused(true);
+	}
+
 	// v3.0: Set modes before generation
 	FGeneratorBase::SetDryRunMode(bDryRun);
 	FGeneratorBase::SetForceMode(bForce);
 	FGeneratorBase::ClearDryRunSummary();
 
 	// Set manifest path for metadata tracking
-	FString ManifestPath = FPaths::Combine(GuidesFolderPath, TEXT("manifest.yaml"));
-	FGeneratorBase::SetManifestPath(ManifestPath);
+	FGeneratorBase::SetManifestPath(Run.ManifestPath);
+
+	// v7.8.84: Fresh timings and counters per run - the report's profile covers this run only
+	FGeneratorProfiler::BeginSession(false);
 
 	FGeneratorBase::SetActiveManifest(&ManifestData);
 	AppendLog(FString::Printf(TEXT("Manifest validation enabled: %d assets whitelisted"),
@@ -697,393 +943,350 @@ void SGasAbilityGeneratorWindow::GenerateAssets()
 	FMaterialGenerator::ClearGeneratedMaterialsCache();
 	// v4.14: Clear session cache for BT blackboard lookup
 	FBlackboardGenerator::ClearGeneratedBlackboardsCache();
+	// v7.8.64: Fresh Blueprint/enum name index and negative cache per generation
+	FGeneratorAssetIndex::Reset();
+	// v7.8.65: Fresh function resolution cache per generation
+	FGasAbilityGeneratorFunctionResolver::ResetResolutionCache();
 	// v4.16.1: Clear hash collision map at start of generation session
-	UGeneratorMetadataRegistry* Registry = UGeneratorMetadataRegistry::GetOrCreateRegistry();
-	if (Registry)
+	if (UGeneratorMetadataRegistry* Registry = UGeneratorMetadataRegistry::GetOrCreateRegistry())
 	{
 		Registry->ClearCollisionMap();
 	}
 
-	FGenerationSummary Summary;
+	// Same dependency-ordered job list as the commandlet (one job per manifest asset)
+	Run.Scheduler.AddManifestJobs(ManifestData);
+	Run.Scheduler.AddManifestDependencies(ManifestData);
+	Run.Scheduler.Prepare();
+	AppendLog(FString::Printf(TEXT("[SCHEDULE] %d jobs, %d dependency edges, prepared in %.3fs"),
+		Run.Scheduler.NumJobs(), Run.Scheduler.NumEdges(), Run.Scheduler.GetPrepareSeconds()));
 
-	// PHASE 1: No Dependencies
-	for (const auto& Definition : ManifestData.Enumerations)
+	if (bChangeSetOnly)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FEnumerationGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		FDefinitionHashSnapshot PreviousHashes;
+		PreviousHashes.Load(Run.ManifestPath);
+		Run.Scheduler.ComputeChangeSet(PreviousHashes);
+		AppendLog(FString::Printf(TEXT("[WATCH] %d changed, %d dependent(s), %d up to date"),
+			Run.Scheduler.NumChanged(), Run.Scheduler.NumChangedDependents(), Run.Scheduler.NumUpToDate()));
 	}
-
-	for (const auto& Definition : ManifestData.FloatCurves)
+	else
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FFloatCurveGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		Run.Pipeline.SetProjectRoot(ManifestData.ProjectRoot);
 	}
 
-	for (const auto& Definition : ManifestData.InputActions)
-	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FInputActionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	Run.TotalSteps = Run.Scheduler.NumJobs() + (bChangeSetOnly ? 0 : ManifestData.PipelineItems.Num());
 
-	for (const auto& Definition : ManifestData.InputMappingContexts)
-	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FInputMappingContextGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	FGeneratorBase::BeginSaveBatch();
+	FGeneratorBase::BeginCompileBatch();
+	Run.Scheduler.Begin();
 
-	// PHASE 2: Base Assets
-	for (const auto& Definition : ManifestData.GameplayEffects)
-	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FGameplayEffectGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	GenerationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateSP(this, &SGasAbilityGeneratorWindow::TickGenerationRun));
+	UpdateStatus(FString::Printf(TEXT("Generating 0/%d..."), Run.TotalSteps));
+}
 
-	// Actor Blueprints must be generated BEFORE Gameplay Abilities
-	// because abilities may reference actor blueprints (e.g., BP_FatherCompanion)
-	for (const auto& Definition : ManifestData.ActorBlueprints)
-	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FActorBlueprintGenerator::Generate(Definition, ManifestData.ProjectRoot, &ManifestData);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+bool SGasAbilityGeneratorWindow::TickGenerationRun(float DeltaTime)
+{
+	FWindowGenerationRun& Run = *ActiveRun;
 
-	for (const auto& Definition : ManifestData.GameplayAbilities)
+	const double SliceStart = FPlatformTime::Seconds();
+	do
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FGameplayAbilityGenerator::Generate(Definition, ManifestData.ProjectRoot);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		if (Run.bCancelRequested || !RunGenerationStep())
+		{
+			GenerationTickerHandle.Reset();   // Returning false removes the ticker
+			FinishGenerationRun(true);
+			return false;
+		}
 	}
+	while (FPlatformTime::Seconds() - SliceStart < WindowGeneration::FrameBudgetSeconds);
 
-	for (const auto& Definition : ManifestData.AnimationMontages)
-	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FAnimationMontageGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	UpdateStatus(FString::Printf(TEXT("Generating %d/%d: %s"), Run.CompletedSteps, Run.TotalSteps, *Run.CurrentAsset));
+	return true;
+}
 
-	// v4.0: Pass ManifestData for event graph reference lookup
-	for (const auto& Definition : ManifestData.AnimationNotifies)
+bool SGasAbilityGeneratorWindow::RunGenerationStep()
+{
+	FWindowGenerationRun& Run = *ActiveRun;
+
+	int32 JobIndex = INDEX_NONE;
+	if (!Run.bJobsDone && Run.Scheduler.Next(JobIndex))
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FAnimationNotifyGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		const FGenerationJob& Job = Run.Scheduler.GetJob(JobIndex);
+		Run.CurrentAsset = Job.AssetName;
+
+		// v7.8.73: Up to date - counted as skipped (and recorded for the next pass) but not logged per asset
+		if (Run.bChangeSetOnly && Run.Scheduler.IsUpToDate(JobIndex))
+		{
+			Run.Summary.AddResult(Run.Scheduler.CompleteUpToDate(JobIndex, TEXT("No changes since last run")));
+			Run.CompletedSteps++;
+			return true;
+		}
+
+		// v7.8.83: Same requeue/deferral handling as the commandlet (FGenerationScheduler::RunJob)
+		FGenerationResult Result;
+		if (!Run.Scheduler.RunJob(JobIndex, Result))
+		{
+			return true;
+		}
+
+		Run.Summary.AddResult(Result);
+		AppendLog(FString::Printf(TEXT("[%s] %s"), WindowGeneration::GetStatusTag(Result.Status), *Result.AssetName));
+		Run.Scheduler.Complete(JobIndex);
+		Run.CompletedSteps++;
+		return true;
 	}
+	Run.bJobsDone = true;
 
-	// PHASE 3: Blueprint Assets
-	for (const auto& Definition : ManifestData.Blackboards)
+	// v4.12: Mesh-to-Item Pipeline (one item per step)
+	if (!Run.bChangeSetOnly && Run.NextPipelineItem < ManifestData.PipelineItems.Num())
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FBlackboardGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		if (Run.NextPipelineItem == 0)
+		{
+			AppendLog(TEXT(""));
+			AppendLog(TEXT("--- Processing Pipeline Items ---"));
+		}
+
+		const FManifestPipelineItemDefinition& ItemDef = ManifestData.PipelineItems[Run.NextPipelineItem++];
+		Run.CurrentAsset = FString::Printf(TEXT("Pipeline: %s"), *ItemDef.Mesh);
+
+		FGenerationResult Result = WindowGeneration::ProcessPipelineItem(Run.Pipeline, ItemDef);
+		Run.Summary.AddResult(Result);
+		AppendLog(FString::Printf(TEXT("[%s] Pipeline: %s"), WindowGeneration::GetStatusTag(Result.Status), *Result.AssetName));
+		Run.CompletedSteps++;
+
+		if (Run.NextPipelineItem == ManifestData.PipelineItems.Num())
+		{
+			AppendLog(FString::Printf(TEXT("Pipeline items processed: %d"), ManifestData.PipelineItems.Num()));
+		}
+		return true;
 	}
 
-	for (const auto& Definition : ManifestData.BehaviorTrees)
+	return false;
+}
+
+void SGasAbilityGeneratorWindow::FinishGenerationRun(bool bShowResults)
+{
+	FWindowGenerationRun& Run = *ActiveRun;
+	FGenerationSummary& Summary = Run.Summary;
+	const bool bCancelled = Run.bCancelRequested;
+
+	FGeneratorBase::ClearPreparedState();
+
+	// A cancelled run still saves everything it generated - the report then matches what is on disk
+	const FSaveBatchResult SaveBatch = FGeneratorBase::FlushSaveBatch();
+	for (const FGenerationResult* SaveFailure : FGenerationScheduler::ApplySaveFailures(Summary, SaveBatch.FailedAssets))
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FBehaviorTreeGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		AppendLog(FString::Printf(TEXT("[FAIL] %s - SavePackage failed"), *SaveFailure->AssetName));
 	}
+	FGeneratorBase::FlushCompileBatch();
 
-	for (const auto& Definition : ManifestData.Materials)
+	// v7.8.72: Hashes for the next incremental pass - assets not reached before a cancel stay out
+	if (!Run.bDryRun)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FMaterialGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		if (!Run.Scheduler.SaveSnapshot(Summary, Run.ManifestPath))
+		{
+			AppendLog(FString::Printf(TEXT("WARNING: Failed to save definition hashes: %s"), *FDefinitionHashSnapshot::GetSnapshotPath(Run.ManifestPath)));
+		}
+		GeneratorMetadataHelpers::SaveRegistryIfNeeded();
 	}
 
-	// ActorBlueprints moved to PHASE 2 (before GameplayAbilities)
+	FGeneratorBase::ClearActiveManifest();
 
-	for (const auto& Definition : ManifestData.WidgetBlueprints)
+	if (bCancelled)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FWidgetBlueprintGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		AppendLog(FString::Printf(TEXT("=== GENERATION CANCELLED - %d of %d assets processed, report covers those only ==="),
+			Run.CompletedSteps, Run.TotalSteps));
 	}
 
-	for (const auto& Definition : ManifestData.DialogueBlueprints)
-	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FDialogueBlueprintGenerator::Generate(Definition, ManifestData.ProjectRoot, &ManifestData);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
-	}
+	// v4.12: Generate report for both real-run and dry-run modes
+	// This provides machine-readable output for CI/CD and debugging
+	FString ManifestContent;
+	FFileHelper::LoadFileToString(ManifestContent, *Run.ManifestPath);
+	int64 ManifestHash = static_cast<int64>(GeneratorHash::Of(ManifestContent));  // v7.8.62: 64-bit
 
-	// PHASE 4: Data Assets
-	for (const auto& Definition : ManifestData.EquippableItems)
+	UGenerationReport* Report = Run.bDryRun
+		? FGenerationReportHelper::CreateAndSaveDryRunReport(Run.ManifestPath, ManifestHash, FGeneratorBase::GetDryRunSummary(), Run.bForce)
+		: FGenerationReportHelper::CreateAndSaveReport(Run.ManifestPath, ManifestHash, Summary.Results, Run.bForce);
+	if (Report)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FEquippableItemGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		AppendLog(FString::Printf(TEXT("Report saved: %s"), *FGenerationReportHelper::GetReportAssetPath()));
 	}
+	FGeneratorProfiler::EndSession();
 
-	for (const auto& Definition : ManifestData.Activities)
+	const double RunSeconds = FPlatformTime::Seconds() - Run.StartSeconds;
+	if (Run.bChangeSetOnly)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FActivityGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		AppendLog(FString::Printf(TEXT("[WATCH] New: %d, Skipped: %d, Failed: %d"), Summary.NewCount, Summary.SkippedCount, Summary.FailedCount));
+		AppendLog(FString::Printf(TEXT("[WATCH] Pass %s in %.2fs"), bCancelled ? TEXT("cancelled") : TEXT("finished"), RunSeconds));
+		UpdateStatus(Summary.FailedCount > 0
+			? FString::Printf(TEXT("Watching - last pass had %d failure(s)"), Summary.FailedCount)
+			: TEXT("Watching for manifest changes..."));
 	}
-
-	// v7.8.52: Blueprint Triggers (BPT_ quest task types)
-	for (const auto& Definition : ManifestData.BlueprintTriggers)
+	else
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FBlueprintTriggerGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		AppendLog(FString::Printf(TEXT("Generation %s in %.1fs"), bCancelled ? TEXT("cancelled") : TEXT("finished"), RunSeconds));
+		if (Run.bDryRun)
+		{
+			UpdateStatus(bCancelled ? TEXT("Dry run cancelled. No changes made.") : TEXT("Dry run complete. No changes made."));
+			if (bShowResults)
+			{
+				ShowDryRunResultsDialog(FGeneratorBase::GetDryRunSummary());
+			}
+		}
+		else
+		{
+			AppendLog(FGasAbilityGeneratorFunctionResolver::GetResolutionCacheStats().ToString());  // v7.8.65
+			UpdateStatus(bCancelled
+				? FString::Printf(TEXT("Generation cancelled after %d of %d assets. Refresh Content Browser."), Run.CompletedSteps, Run.TotalSteps)
+				: TEXT("Generation complete. Refresh Content Browser."));
+			if (bShowResults)
+			{
+				ShowResultsDialog(Summary);
+			}
+		}
 	}
 
-	for (const auto& Definition : ManifestData.AbilityConfigurations)
+	// v3.0: Clean up modes
+	FGeneratorBase::SetDryRunMode(false);
+	FGeneratorBase::SetForceMode(false);
+
+	ActiveRun.Reset();
+	bIsGenerating = false;
+	if (ManifestWatcher.IsValid())
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FAbilityConfigurationGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		ManifestWatcher->SetPaused(false);
 	}
+}
 
-	// v7.8.52: Pass ManifestData for EventGraph lookup
-	for (const auto& Definition : ManifestData.NarrativeEvents)
+FReply SGasAbilityGeneratorWindow::OnCancelGenerationClicked()
+{
+	if (ActiveRun.IsValid() && !ActiveRun->bCancelRequested)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FNarrativeEventGenerator::Generate(Definition, &ManifestData);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		ActiveRun->bCancelRequested = true;
+		AppendLog(TEXT("Cancelling - stopping after the current asset..."));
+		UpdateStatus(TEXT("Cancelling..."));
 	}
+	return FReply::Handled();
+}
 
-	// PHASE 5: Configuration Assets
-	for (const auto& Definition : ManifestData.ActivityConfigurations)
+TOptional<float> SGasAbilityGeneratorWindow::GetGenerationProgress() const
+{
+	if (!ActiveRun.IsValid() || ActiveRun->TotalSteps == 0)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FActivityConfigurationGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		return TOptional<float>();   // Marquee
 	}
+	return static_cast<float>(ActiveRun->CompletedSteps) / ActiveRun->TotalSteps;
+}
 
-	for (const auto& Definition : ManifestData.ItemCollections)
+EVisibility SGasAbilityGeneratorWindow::GetGenerationProgressVisibility() const
+{
+	return ActiveRun.IsValid() ? EVisibility::Visible : EVisibility::Hidden;
+}
+
+// ============================================================================
+// v7.8.73: Watch mode
+// ============================================================================
+
+void SGasAbilityGeneratorWindow::OnWatchCheckStateChanged(ECheckBoxState NewState)
+{
+	if (NewState == ECheckBoxState::Checked)
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FItemCollectionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		StartWatching();
 	}
-
-	// PHASE 6: Definition Assets
-	for (const auto& Definition : ManifestData.NPCDefinitions)
+	else
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FNPCDefinitionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		StopWatching();
+		AppendLog(TEXT("[WATCH] Stopped"));
+		UpdateStatus(TEXT("Ready"));
 	}
+}
+
+void SGasAbilityGeneratorWindow::StartWatching()
+{
+	StopWatching();
 
-	for (const auto& Definition : ManifestData.CharacterDefinitions)
+	const FString ManifestPath = FPaths::Combine(GuidesFolderPath, TEXT("manifest.yaml"));
+	if (GuidesFolderPath.IsEmpty() || !FPaths::FileExists(ManifestPath))
 	{
-		UpdateStatus(FString::Printf(TEXT("Generating: %s"), *Definition.Name));
-		FGenerationResult Result = FCharacterDefinitionGenerator::Generate(Definition);
-		Summary.AddResult(Result);
-		AppendLog(FString::Printf(TEXT("[%s] %s"),
-			Result.Status == EGenerationStatus::New ? TEXT("NEW") :
-			Result.Status == EGenerationStatus::Skipped ? TEXT("SKIP") : TEXT("FAIL"),
-			*Result.AssetName));
+		AppendLog(TEXT("[WATCH] ERROR: manifest.yaml not found - select a manifest folder first"));
+		if (WatchCheckbox.IsValid())
+		{
+			WatchCheckbox->SetIsChecked(ECheckBoxState::Unchecked);
+		}
+		return;
 	}
 
-	// v4.12: Mesh-to-Item Pipeline
-	if (ManifestData.PipelineItems.Num() > 0)
+	ManifestWatcher = MakeUnique<FManifestWatcher>();
+	// v7.8.83: Watched for saves even if it doesn't exist yet (empty = no CSV configured)
+	if (!ManifestWatcher->Start(ManifestPath, GetDialogueCSVFilePath(),
+		FOnManifestWatchTriggered::CreateSP(this, &SGasAbilityGeneratorWindow::OnManifestWatchTriggered)))
 	{
-		AppendLog(TEXT(""));
-		AppendLog(TEXT("--- Processing Pipeline Items ---"));
-
-		FPipelineProcessor Pipeline;
-		Pipeline.SetProjectRoot(ManifestData.ProjectRoot);
-
-		for (const auto& ItemDef : ManifestData.PipelineItems)
+		ManifestWatcher.Reset();
+		AppendLog(FString::Printf(TEXT("[WATCH] ERROR: Could not watch %s"), *GuidesFolderPath));
+		if (WatchCheckbox.IsValid())
 		{
-			UpdateStatus(FString::Printf(TEXT("Pipeline: %s"), *ItemDef.Mesh));
-
-			// Convert manifest definition to pipeline input
-			FPipelineMeshInput Input;
-			Input.MeshPath = ItemDef.Mesh;
-			Input.DisplayName = ItemDef.DisplayName;
-			Input.EquipmentSlot = ItemDef.Slot;
-			Input.TargetCollection = ItemDef.TargetCollection;
-
-			// Convert type string to enum
-			if (ItemDef.Type.Equals(TEXT("Weapon_Melee"), ESearchCase::IgnoreCase))
-			{
-				Input.ItemType = EPipelineItemType::Weapon_Melee;
-			}
-			else if (ItemDef.Type.Equals(TEXT("Weapon_Ranged"), ESearchCase::IgnoreCase))
-			{
-				Input.ItemType = EPipelineItemType::Weapon_Ranged;
-			}
-			else if (ItemDef.Type.Equals(TEXT("Consumable"), ESearchCase::IgnoreCase))
-			{
-				Input.ItemType = EPipelineItemType::Consumable;
-			}
-			else if (ItemDef.Type.Equals(TEXT("Generic"), ESearchCase::IgnoreCase))
-			{
-				Input.ItemType = EPipelineItemType::Generic;
-			}
-			else
-			{
-				Input.ItemType = EPipelineItemType::Clothing;  // Default
-			}
+			WatchCheckbox->SetIsChecked(ECheckBoxState::Unchecked);
+		}
+		return;
+	}
 
-			FPipelineProcessResult PipeResult = Pipeline.ProcessMesh(Input);
+	// The first save reparses everything once; later saves reuse untouched sections
+	WatchSectionCache = MakeUnique<FManifestSectionCache>();
 
-			// Create generation result from pipeline result
-			FString ItemName = ItemDef.Name.IsEmpty() ? FPipelineMeshAnalyzer::GenerateItemAssetName(FPaths::GetBaseFilename(ItemDef.Mesh)) : ItemDef.Name;
-			FGenerationResult Result(
-				ItemName,
-				PipeResult.bSuccess ? EGenerationStatus::New : EGenerationStatus::Failed,
-				PipeResult.bSuccess ? TEXT("Pipeline item generated") : (PipeResult.Errors.Num() > 0 ? PipeResult.Errors[0] : TEXT("Pipeline failed"))
-			);
-			Result.GeneratorId = TEXT("Pipeline");
-			Result.AssetPath = PipeResult.GeneratedItemPath;
-			Result.DetermineCategory();
+	// v7.8.75: Held until the running generation finishes
+	ManifestWatcher->SetPaused(bIsGenerating);
 
-			Summary.AddResult(Result);
+	AppendLog(FString::Printf(TEXT("[WATCH] Watching %s - saves to manifest.yaml or incremental *.yaml files regenerate changed assets"), *GuidesFolderPath));
+	if (!DialogueCSVPath.IsEmpty())
+	{
+		AppendLog(FString::Printf(TEXT("[WATCH] Watching dialogue CSV %s"), *GetDialogueCSVFilePath()));
+	}
+	UpdateStatus(TEXT("Watching for manifest changes..."));
+}
 
-			AppendLog(FString::Printf(TEXT("[%s] Pipeline: %s"),
-				PipeResult.bSuccess ? TEXT("NEW") : TEXT("FAIL"),
-				*ItemName));
-		}
+void SGasAbilityGeneratorWindow::StopWatching()
+{
+	ManifestWatcher.Reset();
+	WatchSectionCache.Reset();
+}
 
-		AppendLog(FString::Printf(TEXT("Pipeline items processed: %d"), ManifestData.PipelineItems.Num()));
+void SGasAbilityGeneratorWindow::OnManifestWatchTriggered(const FManifestWatchChange& Change)
+{
+	// The watcher is paused during generation runs; this only catches synchronous work (tags, NPC creation)
+	if (bIsGenerating)
+	{
+		AppendLog(FString::Printf(TEXT("[WATCH] Ignored change to %s - generation in progress"), *Change.Describe()));
+		return;
 	}
 
-	FGeneratorBase::ClearActiveManifest();
+	AppendLog(TEXT(""));
+	AppendLog(FString::Printf(TEXT("[WATCH] %s changed at %s"), *Change.Describe(), *FDateTime::Now().ToString(TEXT("%H:%M:%S"))));
 
-	// v4.12: Generate report for both real-run and dry-run modes
-	// This provides machine-readable output for CI/CD and debugging
+	const FString ManifestPath = FPaths::Combine(GuidesFolderPath, TEXT("manifest.yaml"));
 	FString ManifestContent;
-	FFileHelper::LoadFileToString(ManifestContent, *ManifestPath);
-	int64 ManifestHash = GetTypeHash(ManifestContent);
-
-	if (bDryRun)
+	if (!FFileHelper::LoadFileToString(ManifestContent, *ManifestPath))
 	{
-		// Create dry-run report
-		FDryRunSummary DryRunSummary = FGeneratorBase::GetDryRunSummary();
-		UGenerationReport* Report = FGenerationReportHelper::CreateAndSaveDryRunReport(
-			ManifestPath,
-			ManifestHash,
-			DryRunSummary,
-			bForce);
-
-		if (Report)
-		{
-			AppendLog(FString::Printf(TEXT("Report saved: %s"), *FGenerationReportHelper::GetReportAssetPath()));
-		}
-
-		UpdateStatus(TEXT("Dry run complete. No changes made."));
-		ShowDryRunResultsDialog(DryRunSummary);
+		AppendLog(TEXT("[WATCH] ERROR: Failed to read manifest.yaml"));
+		return;
 	}
-	else
-	{
-		// Create real-run report
-		UGenerationReport* Report = FGenerationReportHelper::CreateAndSaveReport(
-			ManifestPath,
-			ManifestHash,
-			Summary.Results,
-			bForce);
 
-		if (Report)
-		{
-			AppendLog(FString::Printf(TEXT("Report saved: %s"), *FGenerationReportHelper::GetReportAssetPath()));
-		}
+	ParseManifest(ManifestContent);
 
-		UpdateStatus(TEXT("Generation complete. Refresh Content Browser."));
-		ShowResultsDialog(Summary);
+	TArray<FString> IncrementalAssets;
+	if (FManifestWatcher::ApplyIncrementalFiles(ManifestPath, ManifestData, &IncrementalAssets) > 0)
+	{
+		AppendLog(FString::Printf(TEXT("[WATCH] Applied %d incremental file(s): %s"),
+			IncrementalAssets.Num(), *FString::Join(IncrementalAssets, TEXT(", "))));
 	}
 
-	// v3.0: Clean up modes
-	FGeneratorBase::SetDryRunMode(false);
-	FGeneratorBase::SetForceMode(false);
+	GenerateChangedAssets();
+}
+
+void SGasAbilityGeneratorWindow::GenerateChangedAssets()
+{
+	// Force would put every asset in the change set - watch passes honor Dry Run only
+	const bool bDryRun = DryRunCheckbox.IsValid() && DryRunCheckbox->IsChecked();
+	StartGenerationRun(bDryRun, false, true);
 }
 
 void SGasAbilityGeneratorWindow::ShowResultsDialog(const FGenerationSummary& Summary)
@@ -1139,23 +1342,18 @@ void SGasAbilityGeneratorWindow::ShowResultsDialog(const FGenerationSummary& Sum
 
 void SGasAbilityGeneratorWindow::AppendLog(const FString& Message)
 {
-	if (LogTextBox.IsValid())
+	// v7.8.74: Queued and shown on the next frame - no per-line text relayout
+	if (LogView.IsValid())
 	{
-		FString CurrentText = LogTextBox->GetText().ToString();
-		if (!CurrentText.IsEmpty())
-		{
-			CurrentText += TEXT("\n");
-		}
-		CurrentText += Message;
-		LogTextBox->SetText(FText::FromString(CurrentText));
+		LogView->AddMessage(Message);
 	}
 }
 
 void SGasAbilityGeneratorWindow::ClearLog()
 {
-	if (LogTextBox.IsValid())
+	if (LogView.IsValid())
 	{
-		LogTextBox->SetText(FText::GetEmpty());
+		LogView->Clear();
 	}
 }
 
@@ -1278,7 +1476,7 @@ bool SGasAbilityGeneratorWindow::IsCreateNPCButtonEnabled() const
 	}
 
 	FString NPCName = NPCNameTextBox->GetText().ToString().TrimStartAndEnd();
-	return !NPCName.IsEmpty();
+	return !NPCName.IsEmpty() && !bIsGenerating;   // v7.8.75
 }
 
 FReply SGasAbilityGeneratorWindow::OnCreateNPCClicked()
@@ -7,11 +7,14 @@ FItemValidationResult FItemTableValidator::ValidateAll(const TArray<FItemTableRo
 {
 	FItemValidationResult Result;
 
+	// v7.8.82: One index for the whole table - uniqueness is a hash lookup per row
+	const TTableKeyIndex<FString> ItemNames = BuildItemNameIndex(Rows);
+
 	for (const FItemTableRow& Row : Rows)
 	{
 		if (!Row.bDeleted)
 		{
-			TArray<FItemValidationIssue> RowIssues = ValidateRow(Row, Rows);
+			TArray<FItemValidationIssue> RowIssues = ValidateRow(Row, ItemNames);
 			Result.Issues.Append(RowIssues);
 		}
 	}
@@ -20,6 +23,11 @@ FItemValidationResult FItemTableValidator::ValidateAll(const TArray<FItemTableRo
 }
 
 TArray<FItemValidationIssue> FItemTableValidator::ValidateRow(const FItemTableRow& Row, const TArray<FItemTableRow>& AllRows)
+{
+	return ValidateRow(Row, BuildItemNameIndex(AllRows));
+}
+
+TArray<FItemValidationIssue> FItemTableValidator::ValidateRow(const FItemTableRow& Row, const TTableKeyIndex<FString>& ItemNames)
 {
 	TArray<FItemValidationIssue> Issues;
 
@@ -35,7 +43,7 @@ TArray<FItemValidationIssue> FItemTableValidator::ValidateRow(const FItemTableRo
 	}
 
 	// Item name uniqueness
-	if (!IsItemNameUnique(Row.ItemName, Row.RowId, AllRows))
+	if (!ItemNames.IsUnique(Row.ItemName, Row.RowId))
 	{
 		Issues.Add(FItemValidationIssue(
 			EItemValidationSeverity::Error,
@@ -69,11 +77,13 @@ FItemValidationResult FItemTableValidator::ValidateAllAndCache(TArray<FItemTable
 {
 	FItemValidationResult Result;
 
+	const TTableKeyIndex<FString> ItemNames = BuildItemNameIndex(Rows);
+
 	for (FItemTableRow& Row : Rows)
 	{
 		if (!Row.bDeleted)
 		{
-			TArray<FItemValidationIssue> RowIssues = ValidateRowAndCache(Row, Rows, ListsVersionGuid);
+			TArray<FItemValidationIssue> RowIssues = ValidateRowAndCache(Row, ItemNames, ListsVersionGuid);
 			Result.Issues.Append(RowIssues);
 		}
 	}
@@ -82,6 +92,11 @@ FItemValidationResult FItemTableValidator::ValidateAllAndCache(TArray<FItemTable
 }
 
 TArray<FItemValidationIssue> FItemTableValidator::ValidateRowAndCache(FItemTableRow& Row, const TArray<FItemTableRow>& AllRows, const FGuid& ListsVersionGuid)
+{
+	return ValidateRowAndCache(Row, BuildItemNameIndex(AllRows), ListsVersionGuid);
+}
+
+TArray<FItemValidationIssue> FItemTableValidator::ValidateRowAndCache(FItemTableRow& Row, const TTableKeyIndex<FString>& ItemNames, const FGuid& ListsVersionGuid)
 {
 	// Check if validation is stale
 	uint32 CurrentInputHash = ComputeValidationInputHash(Row, ListsVersionGuid);
@@ -92,7 +107,7 @@ TArray<FItemValidationIssue> FItemTableValidator::ValidateRowAndCache(FItemTable
 	}
 
 	// Perform validation
-	TArray<FItemValidationIssue> Issues = ValidateRow(Row, AllRows);
+	TArray<FItemValidationIssue> Issues = ValidateRow(Row, ItemNames);
 
 	// Update cache
 	Row.ValidationInputHash = CurrentInputHash;
@@ -135,16 +150,20 @@ uint32 FItemTableValidator::ComputeValidationInputHash(const FItemTableRow& Row,
 	return Hash;
 }
 
-bool FItemTableValidator::IsItemNameUnique(const FString& ItemName, const FGuid& RowId, const TArray<FItemTableRow>& AllRows)
+TTableKeyIndex<FString> FItemTableValidator::BuildItemNameIndex(const TArray<FItemTableRow>& AllRows)
 {
+	TTableKeyIndex<FString> ItemNames;
+	ItemNames.Reserve(AllRows.Num());
+
 	for (const FItemTableRow& Row : AllRows)
 	{
-		if (Row.RowId != RowId && !Row.bDeleted && Row.ItemName == ItemName)
+		// Deleted rows don't claim their name
+		if (!Row.bDeleted)
 		{
-			return false;
+			ItemNames.Add(Row.ItemName, Row.RowId);
 		}
 	}
-	return true;
+	return ItemNames;
 }
 
 TArray<FItemValidationIssue> FItemTableValidator::ValidateEquipmentSlot(const FItemTableRow& Row)
@@ -1,4 +1,5 @@
 // GasAbilityGenerator - Item Table Validator
+// v7.8.82: Whole-table validation is O(n) - ItemName uniqueness via a hash index
 // v4.8: Validates Item table rows for correctness before generation
 // Follows NPC/Dialogue validator patterns with validation cache support
 
@@ -6,6 +7,7 @@
 
 #include "CoreMinimal.h"
 #include "ItemTableEditor/ItemTableEditorTypes.h"
+#include "TableEditorKeyIndex.h"
 
 /**
  * Validation issue severity
@@ -154,8 +156,12 @@ public:
 	static uint32 ComputeValidationInputHash(const FItemTableRow& Row, const FGuid& ListsVersionGuid);
 
 private:
-	/** Check if ItemName is unique across all rows */
-	static bool IsItemNameUnique(const FString& ItemName, const FGuid& RowId, const TArray<FItemTableRow>& AllRows);
+	/** v7.8.82: ItemName owners of the non-deleted rows, built once per table for the uniqueness check */
+	static TTableKeyIndex<FString> BuildItemNameIndex(const TArray<FItemTableRow>& AllRows);
+
+	static TArray<FItemValidationIssue> ValidateRow(const FItemTableRow& Row, const TTableKeyIndex<FString>& ItemNames);
+
+	static TArray<FItemValidationIssue> ValidateRowAndCache(FItemTableRow& Row, const TTableKeyIndex<FString>& ItemNames, const FGuid& ListsVersionGuid);
 
 	/** Validate equipment slot for item type */
 	static TArray<FItemValidationIssue> ValidateEquipmentSlot(const FItemTableRow& Row);
@@ -1,225 +1,121 @@
 // GasAbilityGenerator - Item XLSX Reader Implementation
 // v4.12: Import Item table from Excel format
+// v7.8.78: Read in-process through FXLSXStreamReader (no temp extraction, shared strings supported)
 
 #include "ItemTableEditor/ItemXLSXReader.h"
 #include "ItemTableEditor/ItemXLSXWriter.h"
-#include "HAL/PlatformFileManager.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
+#include "XLSXSupport/XLSXStreamReader.h"
 
 bool FItemXLSXReader::ImportFromXLSX(const FString& FilePath, TArray<FItemTableRow>& OutRows, FString& OutError)
 {
-	// Extract XLSX to temp directory
-	FString TempDir;
-	if (!ExtractXLSX(FilePath, TempDir, OutError))
+	FXLSXStreamReader Workbook;
+	if (!Workbook.Open(FilePath, OutError))
 	{
 		return false;
 	}
 
-	// Read sheet1.xml (Items sheet)
-	FString Sheet1Path = TempDir / TEXT("xl/worksheets/sheet1.xml");
-	FString SheetXml;
-	if (!FFileHelper::LoadFileToString(SheetXml, *Sheet1Path))
+	// Stream sheet1.xml (Items sheet)
+	if (!Workbook.HasEntry(TEXT("xl/worksheets/sheet1.xml")))
 	{
 		OutError = TEXT("Failed to read Items sheet from XLSX");
-		IFileManager::Get().DeleteDirectory(*TempDir, false, true);
 		return false;
 	}
 
-	// Parse the sheet
-	bool bSuccess = ParseItemsSheet(SheetXml, OutRows, OutError);
-
-	// Clean up temp directory
-	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
-
-	return bSuccess;
+	return ParseItemsSheet(Workbook, OutRows, OutError);
 }
 
 bool FItemXLSXReader::IsValidItemXLSX(const FString& FilePath)
 {
-	FString TempDir;
+	FXLSXStreamReader Workbook;
 	FString Error;
-	if (!ExtractXLSX(FilePath, TempDir, Error))
+	if (!Workbook.Open(FilePath, Error))
 	{
 		return false;
 	}
 
-	FString Sheet1Path = TempDir / TEXT("xl/worksheets/sheet1.xml");
-	FString SheetXml;
-	if (!FFileHelper::LoadFileToString(SheetXml, *Sheet1Path))
+	// Check for sentinel marker (first cell of the first row - nothing else is read)
+	bool bValid = false;
+	Workbook.ReadSheet(TEXT("xl/worksheets/sheet1.xml"), [&bValid](int32 RowNumber, const TArray<FString>& Cells)
 	{
-		IFileManager::Get().DeleteDirectory(*TempDir, false, true);
+		bValid = Cells.Num() > 0 && Cells[0].Contains(FItemXLSXWriter::SHEET_SENTINEL);
 		return false;
-	}
-
-	// Check for sentinel marker
-	bool bValid = SheetXml.Contains(FItemXLSXWriter::SHEET_SENTINEL);
-
-	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
+	}, Error);
 	return bValid;
 }
 
 bool FItemXLSXReader::ReadMetadata(const FString& FilePath, FString& OutExportGuid, FString& OutTimestamp, uint32& OutContentHash)
 {
-	FString TempDir;
+	FXLSXStreamReader Workbook;
 	FString Error;
-	if (!ExtractXLSX(FilePath, TempDir, Error))
+	if (!Workbook.Open(FilePath, Error))
 	{
 		return false;
 	}
 
-	FString Sheet3Path = TempDir / TEXT("xl/worksheets/sheet3.xml");
-	FString SheetXml;
-	if (!FFileHelper::LoadFileToString(SheetXml, *Sheet3Path))
+	TMap<FString, FString> Metadata;
+	if (!ParseMetaSheet(Workbook, Metadata))
 	{
-		IFileManager::Get().DeleteDirectory(*TempDir, false, true);
 		return false;
 	}
 
-	TMap<FString, FString> Metadata;
-	ParseMetaSheet(SheetXml, Metadata);
-
 	OutExportGuid = Metadata.FindRef(TEXT("ExportGuid"));
 	OutTimestamp = Metadata.FindRef(TEXT("ExportTimestamp"));
 	FString HashStr = Metadata.FindRef(TEXT("ContentHash"));
 	OutContentHash = FCString::Atoi(*HashStr);
 
-	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
 	return true;
 }
 
-bool FItemXLSXReader::ExtractXLSX(const FString& FilePath, FString& OutTempDir, FString& OutError)
+bool FItemXLSXReader::ParseItemsSheet(const FXLSXStreamReader& Workbook, TArray<FItemTableRow>& OutRows, FString& OutError)
 {
-	OutTempDir = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("ItemXLSX_Read_"));
-	IFileManager& FM = IFileManager::Get();
-	FM.MakeDirectory(*OutTempDir, true);
-
-	// Use system command to extract ZIP
-	FString ExtractCommand;
-#if PLATFORM_WINDOWS
-	ExtractCommand = FString::Printf(TEXT("powershell -ExecutionPolicy Bypass -Command \"Expand-Archive -Path '%s' -DestinationPath '%s' -Force\""),
-		*FilePath, *OutTempDir);
-#else
-	ExtractCommand = FString::Printf(TEXT("unzip -o '%s' -d '%s'"), *FilePath, *OutTempDir);
-#endif
-
-	int32 ReturnCode = 0;
-	FString StdOut, StdErr;
-	FPlatformProcess::ExecProcess(*ExtractCommand, TEXT(""), &ReturnCode, &StdOut, &StdErr);
-
-	if (ReturnCode != 0)
-	{
-		OutError = FString::Printf(TEXT("Failed to extract XLSX: %s"), *StdErr);
-		FM.DeleteDirectory(*OutTempDir, false, true);
-		return false;
-	}
-
-	return true;
-}
-
-bool FItemXLSXReader::ParseItemsSheet(const FString& SheetXml, TArray<FItemTableRow>& OutRows, FString& OutError)
-{
-	// Build column mapping from sentinel row
-	TMap<int32, FString> ColumnMap;
-
-	// Find rows in sheetData
-	int32 SheetDataStart = SheetXml.Find(TEXT("<sheetData>"));
-	int32 SheetDataEnd = SheetXml.Find(TEXT("</sheetData>"));
-	if (SheetDataStart == INDEX_NONE || SheetDataEnd == INDEX_NONE)
-	{
-		OutError = TEXT("Invalid XLSX format: missing sheetData");
-		return false;
-	}
-
-	FString SheetDataContent = SheetXml.Mid(SheetDataStart, SheetDataEnd - SheetDataStart);
+	// Rows are taken in sheet order: sentinel row, header row, then data
+	int32 RowOrdinal = 0;
+	bool bSentinelInvalid = false;
+	TMap<FString, int32> ColumnIdToIndex;
 
-	// Parse rows
-	TArray<TMap<int32, FString>> AllRows;
-	int32 RowStart = 0;
-	while ((RowStart = SheetDataContent.Find(TEXT("<row"), ESearchCase::IgnoreCase, ESearchDir::FromStart, RowStart)) != INDEX_NONE)
+	const bool bRead = Workbook.ReadSheet(TEXT("xl/worksheets/sheet1.xml"), [&](int32 RowNumber, const TArray<FString>& RowData)
 	{
-		int32 RowEnd = SheetDataContent.Find(TEXT("</row>"), ESearchCase::IgnoreCase, ESearchDir::FromStart, RowStart);
-		if (RowEnd == INDEX_NONE) break;
-
-		FString RowContent = SheetDataContent.Mid(RowStart, RowEnd - RowStart + 6);
-		TMap<int32, FString> RowCells;
+		const int32 RowIdx = RowOrdinal++;
 
-		// Parse cells in this row
-		int32 CellStart = 0;
-		while ((CellStart = RowContent.Find(TEXT("<c "), ESearchCase::IgnoreCase, ESearchDir::FromStart, CellStart)) != INDEX_NONE)
+		// Row 0 is sentinel + column IDs
+		if (RowIdx == 0)
 		{
-			int32 CellEnd = RowContent.Find(TEXT("</c>"), ESearchCase::IgnoreCase, ESearchDir::FromStart, CellStart);
-			if (CellEnd == INDEX_NONE)
+			// Verify sentinel
+			if (RowData.Num() == 0 || !RowData[0].Contains(TEXT("#ITEM_SHEET")))
 			{
-				CellEnd = RowContent.Find(TEXT("/>"), ESearchCase::IgnoreCase, ESearchDir::FromStart, CellStart);
-				if (CellEnd == INDEX_NONE) break;
+				OutError = TEXT("Invalid XLSX format: missing sentinel marker");
+				bSentinelInvalid = true;
+				return false;
 			}
 
-			FString CellContent = RowContent.Mid(CellStart, CellEnd - CellStart + 4);
-
-			// Get cell reference (e.g., "A1")
-			int32 RefStart = CellContent.Find(TEXT("r=\"")) + 3;
-			int32 RefEnd = CellContent.Find(TEXT("\""), ESearchCase::IgnoreCase, ESearchDir::FromStart, RefStart);
-			FString CellRef = CellContent.Mid(RefStart, RefEnd - RefStart);
-
-			// Extract column letter from reference
-			FString ColLetters;
-			for (TCHAR Ch : CellRef)
+			// Build column ID to index mapping
+			for (int32 ColIdx = 1; ColIdx < RowData.Num(); ColIdx++)  // Skip sentinel cell
 			{
-				if (FChar::IsAlpha(Ch)) ColLetters += Ch;
-				else break;
+				if (!RowData[ColIdx].IsEmpty())
+				{
+					ColumnIdToIndex.Add(RowData[ColIdx], ColIdx);
+				}
 			}
-			int32 ColIdx = ColumnIndex(ColLetters);
-
-			// Get cell value
-			FString Value = ParseCellValue(CellContent);
-			RowCells.Add(ColIdx, Value);
-
-			CellStart = CellEnd + 1;
+			return true;
 		}
 
-		AllRows.Add(RowCells);
-		RowStart = RowEnd + 1;
-	}
-
-	if (AllRows.Num() < 3)
-	{
-		OutError = TEXT("XLSX file has no data rows");
-		return false;
-	}
-
-	// Row 0 is sentinel + column IDs
-	TMap<int32, FString>& SentinelRow = AllRows[0];
-
-	// Verify sentinel
-	FString Sentinel = SentinelRow.FindRef(0);
-	if (!Sentinel.Contains(TEXT("#ITEM_SHEET")))
-	{
-		OutError = TEXT("Invalid XLSX format: missing sentinel marker");
-		return false;
-	}
-
-	// Build column ID to index mapping
-	TMap<FString, int32> ColumnIdToIndex;
-	for (const auto& Cell : SentinelRow)
-	{
-		if (Cell.Key > 0)  // Skip sentinel cell
+		// Row 1 is headers (skip)
+		// Rows 2+ are data
+		if (RowIdx == 1)
 		{
-			ColumnIdToIndex.Add(Cell.Value, Cell.Key);
+			return true;
 		}
-	}
-
-	// Row 1 is headers (skip)
-	// Rows 2+ are data
 
-	for (int32 RowIdx = 2; RowIdx < AllRows.Num(); RowIdx++)
-	{
-		TMap<int32, FString>& RowData = AllRows[RowIdx];
+		auto GetValue = [&ColumnIdToIndex, &RowData](const TCHAR* ColumnId) -> FString
+		{
+			const int32* Index = ColumnIdToIndex.Find(ColumnId);
+			return (Index && RowData.IsValidIndex(*Index)) ? RowData[*Index] : FString();
+		};
 
 		FItemTableRow NewRow;
 
 		// Sync columns
-		FString RowGuidStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("#ROW_GUID")));
+		FString RowGuidStr = GetValue(TEXT("#ROW_GUID"));
 		if (!RowGuidStr.IsEmpty())
 		{
 			FGuid::Parse(RowGuidStr, NewRow.RowId);
@@ -229,94 +125,94 @@ bool FItemXLSXReader::ParseItemsSheet(const FString& SheetXml, TArray<FItemTable
 			NewRow.RowId = FGuid::NewGuid();
 		}
 
-		FString StateStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("#STATE")));
+		FString StateStr = GetValue(TEXT("#STATE"));
 		NewRow.bDeleted = StateStr.Equals(TEXT("DELETED"), ESearchCase::IgnoreCase);
 
 		// Core Identity
-		NewRow.ItemName = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ITEM_NAME")));
-		NewRow.DisplayName = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("DISPLAY_NAME")));
-		NewRow.ItemType = FItemTableRow::ParseItemType(RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ITEM_TYPE"))));
-		NewRow.Description = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("DESCRIPTION")));
+		NewRow.ItemName = GetValue(TEXT("ITEM_NAME"));
+		NewRow.DisplayName = GetValue(TEXT("DISPLAY_NAME"));
+		NewRow.ItemType = FItemTableRow::ParseItemType(GetValue(TEXT("ITEM_TYPE")));
+		NewRow.Description = GetValue(TEXT("DESCRIPTION"));
 
 		// Equipment
-		NewRow.EquipmentSlot = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("EQUIPMENT_SLOT")));
-		NewRow.BaseValue = FCString::Atoi(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("BASE_VALUE"))));
-		NewRow.Weight = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("WEIGHT"))));
-		NewRow.BaseScore = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("BASE_SCORE"))));
+		NewRow.EquipmentSlot = GetValue(TEXT("EQUIPMENT_SLOT"));
+		NewRow.BaseValue = FCString::Atoi(*GetValue(TEXT("BASE_VALUE")));
+		NewRow.Weight = FCString::Atof(*GetValue(TEXT("WEIGHT")));
+		NewRow.BaseScore = FCString::Atof(*GetValue(TEXT("BASE_SCORE")));
 
 		// Combat stats
-		NewRow.AttackRating = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ATTACK_RATING"))));
-		NewRow.ArmorRating = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ARMOR_RATING"))));
-		NewRow.StealthRating = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("STEALTH_RATING"))));
+		NewRow.AttackRating = FCString::Atof(*GetValue(TEXT("ATTACK_RATING")));
+		NewRow.ArmorRating = FCString::Atof(*GetValue(TEXT("ARMOR_RATING")));
+		NewRow.StealthRating = FCString::Atof(*GetValue(TEXT("STEALTH_RATING")));
 
 		// Weapon stats
-		NewRow.AttackDamage = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ATTACK_DAMAGE"))));
-		NewRow.HeavyAttackDamageMultiplier = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("HEAVY_ATTACK_MULT"))));
-		FString HeavyMult = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("HEAVY_ATTACK_MULT")));
+		NewRow.AttackDamage = FCString::Atof(*GetValue(TEXT("ATTACK_DAMAGE")));
+		NewRow.HeavyAttackDamageMultiplier = FCString::Atof(*GetValue(TEXT("HEAVY_ATTACK_MULT")));
+		FString HeavyMult = GetValue(TEXT("HEAVY_ATTACK_MULT"));
 		if (HeavyMult.IsEmpty()) NewRow.HeavyAttackDamageMultiplier = 1.5f;  // Default
 
-		NewRow.WeaponHand = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("WEAPON_HAND")));
+		NewRow.WeaponHand = GetValue(TEXT("WEAPON_HAND"));
 		if (NewRow.WeaponHand.IsEmpty()) NewRow.WeaponHand = TEXT("TwoHanded");  // Default
 
-		NewRow.ClipSize = FCString::Atoi(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("CLIP_SIZE"))));
-		NewRow.RequiredAmmo = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("REQUIRED_AMMO")));
+		NewRow.ClipSize = FCString::Atoi(*GetValue(TEXT("CLIP_SIZE")));
+		NewRow.RequiredAmmo = GetValue(TEXT("REQUIRED_AMMO"));
 
-		FString ReloadStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ALLOW_MANUAL_RELOAD")));
+		FString ReloadStr = GetValue(TEXT("ALLOW_MANUAL_RELOAD"));
 		NewRow.bAllowManualReload = ReloadStr.IsEmpty() || ReloadStr.Equals(TEXT("TRUE"), ESearchCase::IgnoreCase);
 
-		NewRow.BotAttackRange = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("BOT_ATTACK_RANGE"))));
+		NewRow.BotAttackRange = FCString::Atof(*GetValue(TEXT("BOT_ATTACK_RANGE")));
 		if (NewRow.BotAttackRange <= 0) NewRow.BotAttackRange = 200.0f;  // Default
 
 		// Ranged weapon stats
-		NewRow.BaseSpreadDegrees = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("BASE_SPREAD"))));
+		NewRow.BaseSpreadDegrees = FCString::Atof(*GetValue(TEXT("BASE_SPREAD")));
 		if (NewRow.BaseSpreadDegrees <= 0) NewRow.BaseSpreadDegrees = 1.0f;  // Default
 
-		NewRow.MaxSpreadDegrees = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("MAX_SPREAD"))));
+		NewRow.MaxSpreadDegrees = FCString::Atof(*GetValue(TEXT("MAX_SPREAD")));
 		if (NewRow.MaxSpreadDegrees <= 0) NewRow.MaxSpreadDegrees = 8.0f;  // Default
 
-		NewRow.SpreadFireBump = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("SPREAD_BUMP"))));
+		NewRow.SpreadFireBump = FCString::Atof(*GetValue(TEXT("SPREAD_BUMP")));
 		if (NewRow.SpreadFireBump <= 0) NewRow.SpreadFireBump = 0.5f;  // Default
 
-		NewRow.SpreadDecreaseSpeed = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("SPREAD_DECREASE"))));
+		NewRow.SpreadDecreaseSpeed = FCString::Atof(*GetValue(TEXT("SPREAD_DECREASE")));
 		if (NewRow.SpreadDecreaseSpeed <= 0) NewRow.SpreadDecreaseSpeed = 4.0f;  // Default
 
-		NewRow.AimFOVPct = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("AIM_FOV_PCT"))));
+		NewRow.AimFOVPct = FCString::Atof(*GetValue(TEXT("AIM_FOV_PCT")));
 		if (NewRow.AimFOVPct <= 0) NewRow.AimFOVPct = 0.7f;  // Default
 
 		// Consumable stats
-		FString ConsumeStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("CONSUME_ON_USE")));
+		FString ConsumeStr = GetValue(TEXT("CONSUME_ON_USE"));
 		NewRow.bConsumeOnUse = ConsumeStr.IsEmpty() || ConsumeStr.Equals(TEXT("TRUE"), ESearchCase::IgnoreCase);
 
-		NewRow.UseRechargeDuration = FCString::Atof(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("USE_RECHARGE"))));
+		NewRow.UseRechargeDuration = FCString::Atof(*GetValue(TEXT("USE_RECHARGE")));
 
-		FString ActivateStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("CAN_ACTIVATE")));
+		FString ActivateStr = GetValue(TEXT("CAN_ACTIVATE"));
 		NewRow.bCanActivate = ActivateStr.Equals(TEXT("TRUE"), ESearchCase::IgnoreCase);
 
-		NewRow.GameplayEffectClass = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("GAMEPLAY_EFFECT")));
+		NewRow.GameplayEffectClass = GetValue(TEXT("GAMEPLAY_EFFECT"));
 
 		// References
-		FString ModifierGEName = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("MODIFIER_GE")));
+		FString ModifierGEName = GetValue(TEXT("MODIFIER_GE"));
 		if (!ModifierGEName.IsEmpty())
 		{
 			NewRow.ModifierGE = FSoftObjectPath(FString::Printf(TEXT("/Game/Effects/%s.%s"), *ModifierGEName, *ModifierGEName));
 		}
 
-		NewRow.Abilities = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ABILITIES")));
-		NewRow.Fragments = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("FRAGMENTS")));
+		NewRow.Abilities = GetValue(TEXT("ABILITIES"));
+		NewRow.Fragments = GetValue(TEXT("FRAGMENTS"));
 
 		// Tags & Stacking
-		NewRow.ItemTags = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("ITEM_TAGS")));
+		NewRow.ItemTags = GetValue(TEXT("ITEM_TAGS"));
 
-		FString StackableStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("STACKABLE")));
+		FString StackableStr = GetValue(TEXT("STACKABLE"));
 		NewRow.bStackable = StackableStr.Equals(TEXT("TRUE"), ESearchCase::IgnoreCase);
 
-		NewRow.MaxStackSize = FCString::Atoi(*RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("MAX_STACK_SIZE"))));
+		NewRow.MaxStackSize = FCString::Atoi(*GetValue(TEXT("MAX_STACK_SIZE")));
 		if (NewRow.MaxStackSize <= 0) NewRow.MaxStackSize = 1;  // Default
 
 		// Meta
-		NewRow.Notes = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("NOTES")));
+		NewRow.Notes = GetValue(TEXT("NOTES"));
 
-		FString DeletedStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("DELETED")));
+		FString DeletedStr = GetValue(TEXT("DELETED"));
 		if (!DeletedStr.IsEmpty())
 		{
 			NewRow.bDeleted = DeletedStr.Equals(TEXT("TRUE"), ESearchCase::IgnoreCase);
@@ -326,105 +222,40 @@ bool FItemXLSXReader::ParseItemsSheet(const FString& SheetXml, TArray<FItemTable
 		NewRow.Status = EItemTableRowStatus::Synced;
 
 		// Read base hash for 3-way merge
-		FString BaseHashStr = RowData.FindRef(ColumnIdToIndex.FindRef(TEXT("#BASE_HASH")));
+		FString BaseHashStr = GetValue(TEXT("#BASE_HASH"));
 		if (!BaseHashStr.IsEmpty())
 		{
 			NewRow.LastSyncedHash = FCString::Atoi64(*BaseHashStr);
 		}
 
-		OutRows.Add(NewRow);
-	}
-
-	return true;
-}
+		OutRows.Add(MoveTemp(NewRow));
+		return true;
+	}, OutError);
 
-bool FItemXLSXReader::ParseMetaSheet(const FString& SheetXml, TMap<FString, FString>& OutMetadata)
-{
-	// Simple parsing: find key-value pairs in rows
-	int32 RowStart = 0;
-	while ((RowStart = SheetXml.Find(TEXT("<row"), ESearchCase::IgnoreCase, ESearchDir::FromStart, RowStart)) != INDEX_NONE)
+	if (!bRead || bSentinelInvalid)
 	{
-		int32 RowEnd = SheetXml.Find(TEXT("</row>"), ESearchCase::IgnoreCase, ESearchDir::FromStart, RowStart);
-		if (RowEnd == INDEX_NONE) break;
-
-		FString RowContent = SheetXml.Mid(RowStart, RowEnd - RowStart);
-
-		// Find cells A and B
-		FString Key, Value;
-		int32 CellStart = 0;
-		while ((CellStart = RowContent.Find(TEXT("<c "), ESearchCase::IgnoreCase, ESearchDir::FromStart, CellStart)) != INDEX_NONE)
-		{
-			int32 CellEnd = RowContent.Find(TEXT("</c>"), ESearchCase::IgnoreCase, ESearchDir::FromStart, CellStart);
-			if (CellEnd == INDEX_NONE) break;
-
-			FString CellContent = RowContent.Mid(CellStart, CellEnd - CellStart);
-
-			// Get cell reference
-			int32 RefStart = CellContent.Find(TEXT("r=\"")) + 3;
-			int32 RefEnd = CellContent.Find(TEXT("\""), ESearchCase::IgnoreCase, ESearchDir::FromStart, RefStart);
-			FString CellRef = CellContent.Mid(RefStart, RefEnd - RefStart);
-
-			if (CellRef.StartsWith(TEXT("A")))
-			{
-				Key = ParseCellValue(CellContent);
-			}
-			else if (CellRef.StartsWith(TEXT("B")))
-			{
-				Value = ParseCellValue(CellContent);
-			}
-
-			CellStart = CellEnd + 1;
-		}
-
-		if (!Key.IsEmpty())
-		{
-			OutMetadata.Add(Key, Value);
-		}
+		return false;
+	}
 
-		RowStart = RowEnd + 1;
+	if (RowOrdinal < 3)
+	{
+		OutError = TEXT("XLSX file has no data rows");
+		return false;
 	}
 
 	return true;
 }
 
-FString FItemXLSXReader::ParseCellValue(const FString& CellXml)
+bool FItemXLSXReader::ParseMetaSheet(const FXLSXStreamReader& Workbook, TMap<FString, FString>& OutMetadata)
 {
-	// Look for inline string: <is><t>value</t></is>
-	int32 IsStart = CellXml.Find(TEXT("<is>"));
-	if (IsStart != INDEX_NONE)
+	// Key in column A, value in column B
+	FString Error;
+	return Workbook.ReadSheet(TEXT("xl/worksheets/sheet3.xml"), [&OutMetadata](int32 RowNumber, const TArray<FString>& Cells)
 	{
-		int32 TStart = CellXml.Find(TEXT("<t>"), ESearchCase::IgnoreCase, ESearchDir::FromStart, IsStart);
-		int32 TEnd = CellXml.Find(TEXT("</t>"), ESearchCase::IgnoreCase, ESearchDir::FromStart, TStart);
-		if (TStart != INDEX_NONE && TEnd != INDEX_NONE)
+		if (Cells.Num() > 0 && !Cells[0].IsEmpty())
 		{
-			FString Value = CellXml.Mid(TStart + 3, TEnd - TStart - 3);
-			// Unescape XML entities
-			Value.ReplaceInline(TEXT("&amp;"), TEXT("&"));
-			Value.ReplaceInline(TEXT("&lt;"), TEXT("<"));
-			Value.ReplaceInline(TEXT("&gt;"), TEXT(">"));
-			Value.ReplaceInline(TEXT("&quot;"), TEXT("\""));
-			Value.ReplaceInline(TEXT("&apos;"), TEXT("'"));
-			return Value;
+			OutMetadata.Add(Cells[0], Cells.IsValidIndex(1) ? Cells[1] : FString());
 		}
-	}
-
-	// Look for value element: <v>value</v>
-	int32 VStart = CellXml.Find(TEXT("<v>"));
-	int32 VEnd = CellXml.Find(TEXT("</v>"));
-	if (VStart != INDEX_NONE && VEnd != INDEX_NONE)
-	{
-		return CellXml.Mid(VStart + 3, VEnd - VStart - 3);
-	}
-
-	return FString();
-}
-
-int32 FItemXLSXReader::ColumnIndex(const FString& ColumnLetter)
-{
-	int32 Index = 0;
-	for (int32 i = 0; i < ColumnLetter.Len(); i++)
-	{
-		Index = Index * 26 + (ColumnLetter[i] - TEXT('A') + 1);
-	}
-	return Index - 1;  // 0-based
+		return true;
+	}, Error);
 }
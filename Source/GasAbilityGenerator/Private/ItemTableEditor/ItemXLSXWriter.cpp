@@ -1,10 +1,10 @@
 // GasAbilityGenerator - Item XLSX Writer Implementation
 // v4.12: Export Item table to Excel format
+// v7.8.79: Written through FXLSXStreamWriter (deflate entries, shared string table)
 
 #include "ItemTableEditor/ItemXLSXWriter.h"
-#include "HAL/PlatformFileManager.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
+#include "XLSXSupport/XLSXStreamWriter.h"
+#include "Misc/DateTime.h"
 #include "Misc/Guid.h"
 
 // Static constants
@@ -78,61 +78,27 @@ TArray<FItemXLSXColumn> FItemXLSXWriter::GetColumnDefinitions()
 
 bool FItemXLSXWriter::ExportToXLSX(const TArray<FItemTableRow>& Rows, const FString& FilePath, FString& OutError)
 {
-	// Create temp directory for building XLSX structure
-	FString TempDir = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("ItemXLSX_"));
-	IFileManager& FM = IFileManager::Get();
-	FM.MakeDirectory(*TempDir, true);
-
-	// Create directory structure
-	FM.MakeDirectory(*(TempDir / TEXT("_rels")), true);
-	FM.MakeDirectory(*(TempDir / TEXT("xl")), true);
-	FM.MakeDirectory(*(TempDir / TEXT("xl/_rels")), true);
-	FM.MakeDirectory(*(TempDir / TEXT("xl/worksheets")), true);
-
-	// Write all XML files
-	bool bSuccess = true;
-
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateContentTypesXml(), *(TempDir / TEXT("[Content_Types].xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateRelsXml(), *(TempDir / TEXT("_rels/.rels")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateWorkbookXml(), *(TempDir / TEXT("xl/workbook.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateWorkbookRelsXml(), *(TempDir / TEXT("xl/_rels/workbook.xml.rels")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateStylesXml(), *(TempDir / TEXT("xl/styles.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-
-	// Write worksheets
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateItemsSheet(Rows), *(TempDir / TEXT("xl/worksheets/sheet1.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateListsSheet(Rows), *(TempDir / TEXT("xl/worksheets/sheet2.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	bSuccess &= FFileHelper::SaveStringToFile(GenerateMetaSheet(Rows), *(TempDir / TEXT("xl/worksheets/sheet3.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-
-	if (!bSuccess)
+	// v7.8.79: Written in-process through the streaming writer (deflate entries, shared strings) -
+	// no temp directory and no shell-out to PowerShell/zip
+	FXLSXStreamWriter Writer;
+	if (!Writer.Open(FilePath, OutError))
 	{
-		OutError = TEXT("Failed to write XLSX XML files");
-		FM.DeleteDirectory(*TempDir, false, true);
 		return false;
 	}
 
-	// Create ZIP archive using PowerShell
-	FString ZipCommand;
-#if PLATFORM_WINDOWS
-	ZipCommand = FString::Printf(TEXT("powershell -ExecutionPolicy Bypass -Command \"Compress-Archive -Path '%s\\*' -DestinationPath '%s' -Force\""),
-		*TempDir, *FilePath);
-#else
-	ZipCommand = FString::Printf(TEXT("cd '%s' && zip -r '%s' ."), *TempDir, *FilePath);
-#endif
-
-	int32 ReturnCode = 0;
-	FString StdOut, StdErr;
-	FPlatformProcess::ExecProcess(*ZipCommand, TEXT(""), &ReturnCode, &StdOut, &StdErr);
-
-	// Clean up temp directory
-	FM.DeleteDirectory(*TempDir, false, true);
+	// Write all XML parts
+	Writer.AddPart(TEXT("[Content_Types].xml"), GenerateContentTypesXml());
+	Writer.AddPart(TEXT("_rels/.rels"), GenerateRelsXml());
+	Writer.AddPart(TEXT("xl/workbook.xml"), GenerateWorkbookXml());
+	Writer.AddPart(TEXT("xl/_rels/workbook.xml.rels"), GenerateWorkbookRelsXml());
+	Writer.AddPart(TEXT("xl/styles.xml"), GenerateStylesXml());
 
-	if (ReturnCode != 0)
-	{
-		OutError = FString::Printf(TEXT("Failed to create XLSX archive: %s"), *StdErr);
-		return false;
-	}
+	// Write worksheets
+	WriteItemsSheet(Writer, Rows);
+	WriteListsSheet(Writer, Rows);
+	WriteMetaSheet(Writer, Rows);
 
-	return true;
+	return Writer.Close(OutError);
 }
 
 FString FItemXLSXWriter::GenerateContentTypesXml()
@@ -146,6 +112,7 @@ FString FItemXLSXWriter::GenerateContentTypesXml()
 <Override PartName="/xl/worksheets/sheet2.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>
 <Override PartName="/xl/worksheets/sheet3.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>
 <Override PartName="/xl/styles.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.styles+xml"/>
+<Override PartName="/xl/sharedStrings.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.sharedStrings+xml"/>
 </Types>)");
 }
 
@@ -177,6 +144,7 @@ FString FItemXLSXWriter::GenerateWorkbookRelsXml()
 <Relationship Id="rId2" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet2.xml"/>
 <Relationship Id="rId3" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet3.xml"/>
 <Relationship Id="rId4" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/styles" Target="styles.xml"/>
+<Relationship Id="rId5" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/sharedStrings" Target="sharedStrings.xml"/>
 </Relationships>)");
 }
 
@@ -207,48 +175,35 @@ FString FItemXLSXWriter::GenerateStylesXml()
 </styleSheet>)");
 }
 
-FString FItemXLSXWriter::GenerateItemsSheet(const TArray<FItemTableRow>& Rows)
+void FItemXLSXWriter::WriteItemsSheet(FXLSXStreamWriter& Writer, const TArray<FItemTableRow>& Rows)
 {
 	TArray<FItemXLSXColumn> Columns = GetColumnDefinitions();
-	FString SheetContent;
-
-	SheetContent += TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
-	SheetContent += TEXT("<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n");
-	SheetContent += TEXT("<sheetData>\n");
-
-	int32 RowNum = 1;
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet1.xml"));
 
 	// Row 1: Sentinel + Column IDs
-	SheetContent += FString::Printf(TEXT("<row r=\"%d\">\n"), RowNum);
+	Writer.BeginRow();
 	for (int32 ColIdx = 0; ColIdx < Columns.Num(); ColIdx++)
 	{
-		FString CellVal = (ColIdx == 0) ? SHEET_SENTINEL : Columns[ColIdx].ColumnId;
-		SheetContent += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx, RowNum), *EscapeXml(CellVal));
+		Writer.AddCell((ColIdx == 0) ? SHEET_SENTINEL : Columns[ColIdx].ColumnId);
 	}
-	SheetContent += TEXT("</row>\n");
-	RowNum++;
+	Writer.EndRow();
 
 	// Row 2: Human-readable headers
-	SheetContent += FString::Printf(TEXT("<row r=\"%d\">\n"), RowNum);
-	for (int32 ColIdx = 0; ColIdx < Columns.Num(); ColIdx++)
+	Writer.BeginRow();
+	for (const FItemXLSXColumn& Column : Columns)
 	{
-		SheetContent += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\" s=\"1\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx, RowNum), *EscapeXml(Columns[ColIdx].DisplayName));
+		Writer.AddCell(Column.DisplayName, 1);
 	}
-	SheetContent += TEXT("</row>\n");
-	RowNum++;
+	Writer.EndRow();
 
 	// Data rows
 	for (const FItemTableRow& Row : Rows)
 	{
-		SheetContent += FString::Printf(TEXT("<row r=\"%d\">\n"), RowNum);
+		Writer.BeginRow();
 
-		int32 ColIdx = 0;
-		auto WriteCell = [&](const FString& Value)
+		auto WriteCell = [&Writer](FStringView Value)
 		{
-			SheetContent += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-				*CellReference(ColIdx++, RowNum), *EscapeXml(Value));
+			Writer.AddCell(Value);
 		};
 
 		// Sync columns
@@ -309,48 +264,21 @@ FString FItemXLSXWriter::GenerateItemsSheet(const TArray<FItemTableRow>& Rows)
 		WriteCell(Row.Notes);
 		WriteCell(Row.bDeleted ? TEXT("TRUE") : TEXT("FALSE"));
 
-		SheetContent += TEXT("</row>\n");
-		RowNum++;
+		Writer.EndRow();
 	}
 
-	SheetContent += TEXT("</sheetData>\n");
-	SheetContent += TEXT("</worksheet>");
-
-	return SheetContent;
+	Writer.EndSheet();
 }
 
-FString FItemXLSXWriter::GenerateListsSheet(const TArray<FItemTableRow>& Rows)
+void FItemXLSXWriter::WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FItemTableRow>& Rows)
 {
-	FString SheetContent;
-
-	SheetContent += TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
-	SheetContent += TEXT("<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n");
-	SheetContent += TEXT("<sheetData>\n");
-
 	// Item types dropdown
-	SheetContent += TEXT("<row r=\"1\"><c r=\"A1\" t=\"inlineStr\"><is><t>ItemTypes</t></is></c></row>\n");
 	TArray<FString> Types = { TEXT("Consumable"), TEXT("Ammo"), TEXT("WeaponAttachment"),
 		TEXT("Equippable"), TEXT("Clothing"), TEXT("ThrowableWeapon"),
 		TEXT("MeleeWeapon"), TEXT("RangedWeapon"), TEXT("MagicWeapon") };
 
-	int32 Row = 2;
-	for (const FString& Type : Types)
-	{
-		SheetContent += FString::Printf(TEXT("<row r=\"%d\"><c r=\"A%d\" t=\"inlineStr\"><is><t>%s</t></is></c></row>\n"),
-			Row, Row, *Type);
-		Row++;
-	}
-
 	// Weapon hands dropdown
-	SheetContent += FString::Printf(TEXT("<row r=\"%d\"><c r=\"B1\" t=\"inlineStr\"><is><t>WeaponHands</t></is></c></row>\n"), 1);
 	TArray<FString> Hands = { TEXT("TwoHanded"), TEXT("MainHand"), TEXT("OffHand"), TEXT("DualWieldable") };
-	Row = 2;
-	for (const FString& Hand : Hands)
-	{
-		SheetContent += FString::Printf(TEXT("<row r=\"%d\"><c r=\"B%d\" t=\"inlineStr\"><is><t>%s</t></is></c></row>\n"),
-			Row, Row, *Hand);
-		Row++;
-	}
 
 	// Collect unique equipment slots
 	TSet<FString> UniqueSlots;
@@ -361,30 +289,32 @@ FString FItemXLSXWriter::GenerateListsSheet(const TArray<FItemTableRow>& Rows)
 			UniqueSlots.Add(ItemRow.EquipmentSlot);
 		}
 	}
+	TArray<FString> Slots = UniqueSlots.Array();
+
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet2.xml"));
+
+	// v7.8.79: One list per column (A/B/C) - rows are written once each, in order
+	Writer.BeginRow();
+	Writer.AddCell(TEXT("ItemTypes"));
+	Writer.AddCell(TEXT("WeaponHands"));
+	Writer.AddCell(TEXT("EquipmentSlots"));
+	Writer.EndRow();
 
-	SheetContent += FString::Printf(TEXT("<row r=\"%d\"><c r=\"C1\" t=\"inlineStr\"><is><t>EquipmentSlots</t></is></c></row>\n"), 1);
-	Row = 2;
-	for (const FString& Slot : UniqueSlots)
+	const int32 MaxRows = FMath::Max(Types.Num(), FMath::Max(Hands.Num(), Slots.Num()));
+	for (int32 i = 0; i < MaxRows; i++)
 	{
-		SheetContent += FString::Printf(TEXT("<row r=\"%d\"><c r=\"C%d\" t=\"inlineStr\"><is><t>%s</t></is></c></row>\n"),
-			Row, Row, *EscapeXml(Slot));
-		Row++;
+		Writer.BeginRow();
+		Writer.AddCell(Types.IsValidIndex(i) ? Types[i] : FString());
+		Writer.AddCell(Hands.IsValidIndex(i) ? Hands[i] : FString());
+		Writer.AddCell(Slots.IsValidIndex(i) ? Slots[i] : FString());
+		Writer.EndRow();
 	}
 
-	SheetContent += TEXT("</sheetData>\n");
-	SheetContent += TEXT("</worksheet>");
-
-	return SheetContent;
+	Writer.EndSheet();
 }
 
-FString FItemXLSXWriter::GenerateMetaSheet(const TArray<FItemTableRow>& Rows)
+void FItemXLSXWriter::WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FItemTableRow>& Rows)
 {
-	FString SheetContent;
-
-	SheetContent += TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
-	SheetContent += TEXT("<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n");
-	SheetContent += TEXT("<sheetData>\n");
-
 	// Compute content hash
 	uint32 ContentHash = 0;
 	for (const FItemTableRow& Row : Rows)
@@ -392,54 +322,25 @@ FString FItemXLSXWriter::GenerateMetaSheet(const TArray<FItemTableRow>& Rows)
 		ContentHash = HashCombine(ContentHash, Row.ComputeEditableFieldsHash());
 	}
 
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet3.xml"));
+
 	// Meta rows
-	auto WriteMetaRow = [&](int32 RowNum, const FString& Key, const FString& Value)
+	auto WriteMetaRow = [&Writer](const FString& Key, const FString& Value)
 	{
-		SheetContent += FString::Printf(TEXT("<row r=\"%d\">"), RowNum);
-		SheetContent += FString::Printf(TEXT("<c r=\"A%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"), RowNum, *Key);
-		SheetContent += FString::Printf(TEXT("<c r=\"B%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"), RowNum, *EscapeXml(Value));
-		SheetContent += TEXT("</row>\n");
+		Writer.BeginRow();
+		Writer.AddCell(Key);
+		Writer.AddCell(Value);
+		Writer.EndRow();
 	};
 
-	WriteMetaRow(1, TEXT("ExportGuid"), FGuid::NewGuid().ToString());
-	WriteMetaRow(2, TEXT("ExportTimestamp"), FDateTime::Now().ToString());
-	WriteMetaRow(3, TEXT("FormatVersion"), FORMAT_VERSION);
-	WriteMetaRow(4, TEXT("ContentHash"), FString::FromInt(ContentHash));
-	WriteMetaRow(5, TEXT("RowCount"), FString::FromInt(Rows.Num()));
-	WriteMetaRow(6, TEXT("SheetSentinel"), SHEET_SENTINEL);
-
-	SheetContent += TEXT("</sheetData>\n");
-	SheetContent += TEXT("</worksheet>");
-
-	return SheetContent;
-}
+	WriteMetaRow(TEXT("ExportGuid"), FGuid::NewGuid().ToString());
+	WriteMetaRow(TEXT("ExportTimestamp"), FDateTime::Now().ToString());
+	WriteMetaRow(TEXT("FormatVersion"), FORMAT_VERSION);
+	WriteMetaRow(TEXT("ContentHash"), FString::FromInt(ContentHash));
+	WriteMetaRow(TEXT("RowCount"), FString::FromInt(Rows.Num()));
+	WriteMetaRow(TEXT("SheetSentinel"), SHEET_SENTINEL);
 
-FString FItemXLSXWriter::EscapeXml(const FString& Text)
-{
-	FString Result = Text;
-	Result.ReplaceInline(TEXT("&"), TEXT("&amp;"));
-	Result.ReplaceInline(TEXT("<"), TEXT("&lt;"));
-	Result.ReplaceInline(TEXT(">"), TEXT("&gt;"));
-	Result.ReplaceInline(TEXT("\""), TEXT("&quot;"));
-	Result.ReplaceInline(TEXT("'"), TEXT("&apos;"));
-	return Result;
-}
-
-FString FItemXLSXWriter::CellReference(int32 Col, int32 Row)
-{
-	return FString::Printf(TEXT("%s%d"), *ColumnLetter(Col), Row);
-}
-
-FString FItemXLSXWriter::ColumnLetter(int32 ColIndex)
-{
-	FString Result;
-	int32 Idx = ColIndex;
-	while (Idx >= 0)
-	{
-		Result = FString::Chr(TEXT('A') + (Idx % 26)) + Result;
-		Idx = Idx / 26 - 1;
-	}
-	return Result;
+	Writer.EndSheet();
 }
 
 int64 FItemXLSXWriter::ComputeRowHash(const FItemTableRow& Row)
@@ -1532,6 +1532,7 @@ void SItemTableEditor::Construct(const FArguments& InArgs)
 	TableData = InArgs._TableData;
 	OnDirtyStateChanged = InArgs._OnDirtyStateChanged;
 	TransactionStack = MakeShared<FTableEditorTransactionStack>(50);  // v7.2: Initialize undo/redo stack
+	ColumnIndex.SetValueGetter([this](const TSharedPtr<FItemTableRow>& Row, FName ColumnId) { return GetColumnValue(Row, ColumnId); });
 
 	InitializeColumnFilters();
 	SyncFromTableData();
@@ -1899,6 +1900,7 @@ TSharedRef<SHeaderRow> SItemTableEditor::BuildHeaderRow()
 			.DefaultLabel(Col.DisplayName)
 			.ManualWidth(Col.ManualWidth)  // v4.12.5: Fixed pixel width
 			.SortMode(this, &SItemTableEditor::GetColumnSortMode, Col.ColumnId)
+			.SortPriority(this, &SItemTableEditor::GetColumnSortPriority, Col.ColumnId)  // v7.8.81: Shift-click adds a secondary sort
 			.OnSort(this, &SItemTableEditor::OnColumnSortModeChanged)
 			.HeaderContent()
 			[
@@ -1973,7 +1975,7 @@ TSharedRef<SWidget> SItemTableEditor::BuildColumnHeaderContent(const FItemTableC
 						{
 							FItemColumnFilterState* S = ColumnFilters.Find(ColumnId);
 							if (S) S->SelectedValues.Empty();
-							ApplyFilters();
+							RefilterRows();
 							return FReply::Handled();
 						})
 					]
@@ -1993,7 +1995,7 @@ TSharedRef<SWidget> SItemTableEditor::BuildColumnHeaderContent(const FItemTableC
 								S->SelectedValues.Empty();
 								S->SelectedValues.Add(TEXT("__NONE_SELECTED__"));
 							}
-							ApplyFilters();
+							RefilterRows();
 							return FReply::Handled();
 						})
 					]
@@ -2251,7 +2253,7 @@ TSharedRef<ITableRow> SItemTableEditor::OnGenerateRow(TSharedPtr<FItemTableRow>
 {
 	return SNew(SItemTableRow, OwnerTable)
 		.RowData(Item)
-		.OnRowModified(FSimpleDelegate::CreateSP(this, &SItemTableEditor::OnRowModified));
+		.OnRowModified(FSimpleDelegate::CreateSP(this, &SItemTableEditor::OnRowEdited, Item));
 }
 
 void SItemTableEditor::OnSelectionChanged(TSharedPtr<FItemTableRow> Item, ESelectInfo::Type SelectInfo)
@@ -2261,14 +2263,17 @@ void SItemTableEditor::OnSelectionChanged(TSharedPtr<FItemTableRow> Item, ESelec
 
 EColumnSortMode::Type SItemTableEditor::GetColumnSortMode(FName ColumnId) const
 {
-	if (SortColumn == ColumnId) return SortMode;
-	return EColumnSortMode::None;
+	return TableEditorSort::GetSortMode(SortColumns, ColumnId);
+}
+
+EColumnSortPriority::Type SItemTableEditor::GetColumnSortPriority(FName ColumnId) const
+{
+	return TableEditorSort::GetSortPriority(SortColumns, ColumnId);
 }
 
 void SItemTableEditor::OnColumnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type InSortMode)
 {
-	SortColumn = ColumnId;
-	SortMode = InSortMode;
+	TableEditorSort::SetSortColumn(SortColumns, Priority, ColumnId, InSortMode);
 	ApplySorting();
 }
 
@@ -2277,7 +2282,7 @@ void SItemTableEditor::OnColumnTextFilterChanged(FName ColumnId, const FText& Ne
 	if (FItemColumnFilterState* State = ColumnFilters.Find(ColumnId))
 	{
 		State->TextFilter = NewText.ToString();
-		ApplyFilters();
+		RefilterRows();
 	}
 }
 
@@ -2335,23 +2340,21 @@ void SItemTableEditor::OnColumnDropdownFilterChanged(FName ColumnId, const FStri
 		State->SelectedValues.Empty();
 	}
 
-	ApplyFilters();
+	RefilterRows();
 }
 
 TArray<FString> SItemTableEditor::GetUniqueColumnValues(FName ColumnId) const
 {
 	// Filter dropdowns show values from the current table data (AllRows)
-	TSet<FString> UniqueSet;
+	// v7.8.80: Distinct values come from the column index
+	TArray<FString> ColumnValues;
+	ColumnIndex.GetDistinctValues(AllRows, ColumnId, ColumnValues);
 
-	for (const TSharedPtr<FItemTableRow>& Row : AllRows)
+	TSet<FString> UniqueSet;
+	for (const FString& Value : ColumnValues)
 	{
-		FString Value = GetColumnValue(Row, ColumnId);
 		// Empty cells become "(None)" for display consistency
-		if (Value.IsEmpty())
-		{
-			Value = TEXT("(None)");
-		}
-		UniqueSet.Add(Value);
+		UniqueSet.Add(Value.IsEmpty() ? FString(TEXT("(None)")) : Value);
 	}
 
 	TArray<FString> Result = UniqueSet.Array();
@@ -2366,7 +2369,7 @@ FReply SItemTableEditor::OnClearFiltersClicked()
 		Pair.Value.TextFilter.Empty();
 		Pair.Value.SelectedValues.Empty();
 	}
-	ApplyFilters();
+	RefilterRows();
 	return FReply::Handled();
 }
 
@@ -2408,46 +2411,38 @@ FString SItemTableEditor::GetColumnValue(const TSharedPtr<FItemTableRow>& Row, F
 
 void SItemTableEditor::ApplyFilters()
 {
-	DisplayedRows.Empty();
+	ColumnIndex.Invalidate();
+	RefilterRows();
+}
 
-	for (const TSharedPtr<FItemTableRow>& Row : AllRows)
+void SItemTableEditor::RefilterRows()
+{
+	// v7.8.80: Each distinct column value is tested once; rows are narrowed through the column index
+	ColumnIndex.BeginFilter(AllRows);
+
+	for (const auto& Pair : ColumnFilters)
 	{
-		bool bPassesFilter = true;
+		const FItemColumnFilterState& State = Pair.Value;
 
-		for (const auto& Pair : ColumnFilters)
+		// Check text filter
+		if (!State.TextFilter.IsEmpty())
 		{
-			const FItemColumnFilterState& State = Pair.Value;
-			FString Value = GetColumnValue(Row, Pair.Key);
-
-			// Check text filter
-			if (!State.TextFilter.IsEmpty())
-			{
-				if (!Value.Contains(State.TextFilter))
-				{
-					bPassesFilter = false;
-					break;
-				}
-			}
-
-			// Check dropdown filter (SelectedValues)
-			if (State.SelectedValues.Num() > 0 && !State.SelectedValues.Contains(TEXT("__NONE_SELECTED__")))
-			{
-				// Normalize empty values to "(None)" for consistency with GetUniqueColumnValues
-				FString NormalizedValue = Value.IsEmpty() ? TEXT("(None)") : Value;
-				if (!State.SelectedValues.Contains(NormalizedValue))
-				{
-					bPassesFilter = false;
-					break;
-				}
-			}
+			ColumnIndex.MatchText(Pair.Key, State.TextFilter);
 		}
 
-		if (bPassesFilter)
+		// Check dropdown filter (SelectedValues)
+		if (State.SelectedValues.Num() > 0 && !State.SelectedValues.Contains(TEXT("__NONE_SELECTED__")))
 		{
-			DisplayedRows.Add(Row);
+			ColumnIndex.MatchValues(Pair.Key, [&State](const FString& Value)
+			{
+				// Normalize empty values to "(None)" for consistency with GetUniqueColumnValues
+				return State.SelectedValues.Contains(Value.IsEmpty() ? FString(TEXT("(None)")) : Value);
+			});
 		}
 	}
 
+	ColumnIndex.GetMatchingRows(DisplayedRows);
+
 	ApplySorting();
 
 	if (ListView.IsValid())
@@ -2459,21 +2454,39 @@ void SItemTableEditor::ApplyFilters()
 
 void SItemTableEditor::ApplySorting()
 {
-	if (SortColumn.IsNone() || SortMode == EColumnSortMode::None)
-	{
-		return;
-	}
+	// v7.8.81: Keys are extracted once per row; the sort compares typed keys only
+	TableEditorSort::SortRows<FItemTableRow>(DisplayedRows, SortColumns,
+		[this](const TSharedPtr<FItemTableRow>& Row, FName ColumnId) { return GetSortKey(Row, ColumnId); });
+}
 
-	DisplayedRows.Sort([this](const TSharedPtr<FItemTableRow>& A, const TSharedPtr<FItemTableRow>& B) {
-		FString ValueA = GetColumnValue(A, SortColumn);
-		FString ValueB = GetColumnValue(B, SortColumn);
+FTableSortKey SItemTableEditor::GetSortKey(const TSharedPtr<FItemTableRow>& Row, FName ColumnId) const
+{
+	if (!Row.IsValid()) return FTableSortKey();
 
-		if (SortMode == EColumnSortMode::Ascending)
-		{
-			return ValueA < ValueB;
-		}
-		return ValueA > ValueB;
-	});
+	const FItemTableRow& Data = *Row;
+
+	// Enums - declaration order
+	if (ColumnId == TEXT("Status")) return FTableSortKey::FromEnum(Data.Status);
+	if (ColumnId == TEXT("ItemType")) return FTableSortKey::FromEnum(Data.ItemType);
+
+	// Numbers - by value, not by their text ("9" before "10")
+	if (ColumnId == TEXT("BaseValue")) return FTableSortKey::FromNumber(Data.BaseValue);
+	if (ColumnId == TEXT("Weight")) return FTableSortKey::FromNumber(Data.Weight);
+	if (ColumnId == TEXT("AttackRating")) return FTableSortKey::FromNumber(Data.AttackRating);
+	if (ColumnId == TEXT("ArmorRating")) return FTableSortKey::FromNumber(Data.ArmorRating);
+	if (ColumnId == TEXT("AttackDamage")) return FTableSortKey::FromNumber(Data.AttackDamage);
+	if (ColumnId == TEXT("ClipSize")) return FTableSortKey::FromNumber(Data.ClipSize);
+	if (ColumnId == TEXT("HeavyAttackDamageMultiplier")) return FTableSortKey::FromNumber(Data.HeavyAttackDamageMultiplier);
+	if (ColumnId == TEXT("bAllowManualReload")) return FTableSortKey::FromNumber(Data.bAllowManualReload);
+	if (ColumnId == TEXT("BotAttackRange")) return FTableSortKey::FromNumber(Data.BotAttackRange);
+	if (ColumnId == TEXT("BaseSpreadDegrees")) return FTableSortKey::FromNumber(Data.BaseSpreadDegrees);
+	if (ColumnId == TEXT("MaxSpreadDegrees")) return FTableSortKey::FromNumber(Data.MaxSpreadDegrees);
+	if (ColumnId == TEXT("AimFOVPct")) return FTableSortKey::FromNumber(Data.AimFOVPct);
+	if (ColumnId == TEXT("bStackable")) return FTableSortKey::FromNumber(Data.bStackable);
+	if (ColumnId == TEXT("MaxStackSize")) return FTableSortKey::FromNumber(Data.MaxStackSize);
+
+	// Everything else - displayed text
+	return FTableSortKey::FromText(GetColumnValue(Row, ColumnId));
 }
 
 FReply SItemTableEditor::OnAddRowClicked()
@@ -3501,6 +3514,12 @@ void SItemTableEditor::MarkDirty()
 	OnDirtyStateChanged.ExecuteIfBound();
 }
 
+void SItemTableEditor::OnRowEdited(TSharedPtr<FItemTableRow> Row)
+{
+	ColumnIndex.InvalidateRow(Row);
+	OnRowModified();
+}
+
 void SItemTableEditor::OnRowModified()
 {
 	MarkDirty();
@@ -2,13 +2,20 @@
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
 // v3.1: Added UGeneratorMetadataRegistry for assets that don't support AssetUserData
 // v4.16.1: Hash collision detection for metadata integrity
+// v7.8.62: HashVersion round-trip
+// v7.8.63: Package file stamps on registry records, IsUpToDateInRegistry fast path
+// v7.8.67: IsUpToDateInRegistry accepts a prepared package stat
+// v7.8.76: Record changes journaled (FGeneratorMetadataJournal); registry saved only when changed, journal replayed after a killed run
 
 #include "Locked/GasAbilityGeneratorMetadata.h"
+#include "GasAbilityGeneratorMetadataJournal.h"  // v7.8.76
 #include "Engine/Blueprint.h"
 #include "Engine/DataAsset.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/SavePackage.h"
 #include "Misc/App.h"
+#include "Misc/PackageName.h"
+#include "HAL/FileManager.h"
 
 // v3.1: Dedicated log category
 DEFINE_LOG_CATEGORY_STATIC(LogGeneratorMetadata, Log, All);
@@ -24,6 +31,7 @@ UGeneratorAssetMetadata::UGeneratorAssetMetadata()
 	, OutputHash(0)
 	, Timestamp(FDateTime::Now())
 	, bIsGenerated(false)
+	, HashVersion(GeneratorHash::LegacyVersion)
 {
 }
 
@@ -39,6 +47,7 @@ FGeneratorMetadata UGeneratorAssetMetadata::ToMetadata() const
 	Meta.Timestamp = Timestamp;
 	Meta.Dependencies = Dependencies;
 	Meta.bIsGenerated = bIsGenerated;
+	Meta.HashVersion = HashVersion;
 	return Meta;
 }
 
@@ -53,6 +62,7 @@ void UGeneratorAssetMetadata::FromMetadata(const FGeneratorMetadata& InMetadata)
 	Timestamp = InMetadata.Timestamp;
 	Dependencies = InMetadata.Dependencies;
 	bIsGenerated = InMetadata.bIsGenerated;
+	HashVersion = InMetadata.HashVersion;
 }
 
 bool UGeneratorAssetMetadata::HasInputChanged(uint64 NewInputHash) const
@@ -92,6 +102,7 @@ FGeneratorMetadata FGeneratorMetadataRecord::ToMetadata() const
 	Meta.Timestamp = Timestamp;
 	Meta.Dependencies = Dependencies;
 	Meta.bIsGenerated = bIsGenerated;
+	Meta.HashVersion = HashVersion;
 	return Meta;
 }
 
@@ -106,6 +117,7 @@ void FGeneratorMetadataRecord::FromMetadata(const FGeneratorMetadata& InMetadata
 	Timestamp = InMetadata.Timestamp;
 	Dependencies = InMetadata.Dependencies;
 	bIsGenerated = InMetadata.bIsGenerated;
+	HashVersion = InMetadata.HashVersion;
 }
 
 // ============================================================================
@@ -124,11 +136,17 @@ FGeneratorMetadataRecord* UGeneratorMetadataRegistry::GetRecord(const FString& A
 void UGeneratorMetadataRegistry::SetRecord(const FString& AssetPath, const FGeneratorMetadataRecord& Record)
 {
 	Records.Add(AssetPath, Record);
+	// v7.8.63: The package is saved after the record is written - stamp it at registry save
+	PendingFileStamps.Add(AssetPath);
+	// v7.8.76: Write-ahead - the registry package itself is written once at the end of the run
+	FGeneratorMetadataJournal::Get().RecordSet(GetOutermost()->GetName(), AssetPath, Record);
 }
 
 void UGeneratorMetadataRegistry::RemoveRecord(const FString& AssetPath)
 {
 	Records.Remove(AssetPath);
+	PendingFileStamps.Remove(AssetPath);
+	FGeneratorMetadataJournal::Get().RecordRemove(GetOutermost()->GetName(), AssetPath);  // v7.8.76
 }
 
 bool UGeneratorMetadataRegistry::HasRecord(const FString& AssetPath) const
@@ -146,6 +164,8 @@ TArray<FString> UGeneratorMetadataRegistry::GetAllAssetPaths() const
 void UGeneratorMetadataRegistry::ClearAllRecords()
 {
 	Records.Empty();
+	PendingFileStamps.Empty();
+	FGeneratorMetadataJournal::Get().RecordClear(GetOutermost()->GetName());  // v7.8.76
 }
 
 UGeneratorMetadataRegistry* UGeneratorMetadataRegistry::GetOrCreateRegistry()
@@ -199,6 +219,12 @@ UGeneratorMetadataRegistry* UGeneratorMetadataRegistry::GetOrCreateRegistry()
 		}
 	}
 
+	// v7.8.76: Records of a run killed before its registry save
+	if (Registry)
+	{
+		FGeneratorMetadataJournal::Get().Replay(*Registry);
+	}
+
 	CachedRegistry = Registry;
 	return Registry;
 }
@@ -221,6 +247,10 @@ UGeneratorMetadataRegistry* UGeneratorMetadataRegistry::GetRegistry()
 
 	FString RegistryPath = FString::Printf(TEXT("/Game/%s/GeneratorMetadataRegistry"), *ProjectName);
 	UGeneratorMetadataRegistry* Registry = LoadObject<UGeneratorMetadataRegistry>(nullptr, *RegistryPath);
+	if (Registry)
+	{
+		FGeneratorMetadataJournal::Get().Replay(*Registry);  // v7.8.76
+	}
 	CachedRegistry = Registry;
 	return Registry;
 }
@@ -244,6 +274,9 @@ void UGeneratorMetadataRegistry::SaveRegistry()
 		return;
 	}
 
+	// v7.8.63: Generated packages are on disk by now - capture their file evidence
+	Registry->RefreshPendingFileStamps();
+
 	Package->MarkPackageDirty();
 
 	FString PackagePath = Package->GetPathName();
@@ -256,6 +289,8 @@ void UGeneratorMetadataRegistry::SaveRegistry()
 	if (UPackage::SavePackage(Package, Registry, *PackageFileName, SaveArgs))
 	{
 		UE_LOG(LogGeneratorMetadata, Display, TEXT("Saved metadata registry with %d records"), Registry->Records.Num());
+		// v7.8.76: The saved package supersedes the journal (kept on failure for the next attempt)
+		FGeneratorMetadataJournal::Get().Compacted();
 	}
 	else
 	{
@@ -295,6 +330,36 @@ void UGeneratorMetadataRegistry::CheckHashCollision(int64 Hash, const FString& A
 	}
 }
 
+// v7.8.63: Package file evidence for the registry fast path
+void UGeneratorMetadataRegistry::RefreshPendingFileStamps()
+{
+	for (const FString& AssetPath : PendingFileStamps)
+	{
+		FGeneratorMetadataRecord* Record = Records.Find(AssetPath);
+		if (!Record)
+		{
+			continue;
+		}
+
+		Record->PackageFileSize = 0;
+		Record->PackageFileTime = FDateTime();
+
+		FString FilePath;
+		if (FPackageName::TryConvertLongPackageNameToFilename(AssetPath, FilePath, FPackageName::GetAssetPackageExtension()))
+		{
+			const FFileStatData Stat = IFileManager::Get().GetStatData(*FilePath);
+			if (Stat.bIsValid && !Stat.bIsDirectory)
+			{
+				Record->PackageFileSize = Stat.FileSize;
+				Record->PackageFileTime = Stat.ModificationTime;
+			}
+		}
+	}
+
+	UE_LOG(LogGeneratorMetadata, Verbose, TEXT("Captured package file stamps for %d records"), PendingFileStamps.Num());
+	PendingFileStamps.Empty();
+}
+
 void UGeneratorMetadataRegistry::ClearCollisionMap()
 {
 	HashToAssetMap.Empty();
@@ -554,9 +619,71 @@ namespace GeneratorMetadataHelpers
 		}
 	}
 
+	// v7.8.63: Up-to-date check from the registry record and package file stamp - no package load
+	bool IsUpToDateInRegistry(
+		const FString& AssetPath,
+		uint64 InputHash,
+		const FString& GeneratorVersion,
+		FGeneratorMetadataRecord& OutRecord,
+		const FFileStatData* PreparedStat)
+	{
+		UGeneratorMetadataRegistry* Registry = UGeneratorMetadataRegistry::GetRegistry();
+		const FGeneratorMetadataRecord* Record = Registry ? Registry->GetRecord(AssetPath) : nullptr;
+		if (!Record || !Record->bIsGenerated || Record->PackageFileSize <= 0)
+		{
+			return false;
+		}
+
+		// Cheap evidence first: hashes and version strings from the record
+		if (Record->HashVersion != GeneratorHash::Version
+			|| static_cast<uint64>(Record->InputHash) != InputHash
+			|| Record->GeneratorVersion != GeneratorVersion)
+		{
+			return false;
+		}
+
+		// Unsaved edits in memory aren't visible on disk
+		if (UPackage* LoadedPackage = FindPackage(nullptr, *AssetPath))
+		{
+			if (LoadedPackage->IsDirty())
+			{
+				return false;
+			}
+		}
+
+		// Package untouched since the record was written => output hash unchanged
+		FFileStatData Stat;
+		if (PreparedStat)
+		{
+			Stat = *PreparedStat;
+		}
+		else
+		{
+			FString FilePath;
+			if (!FPackageName::TryConvertLongPackageNameToFilename(AssetPath, FilePath, FPackageName::GetAssetPackageExtension()))
+			{
+				return false;
+			}
+			Stat = IFileManager::Get().GetStatData(*FilePath);
+		}
+		if (!Stat.bIsValid || Stat.FileSize != Record->PackageFileSize || Stat.ModificationTime != Record->PackageFileTime)
+		{
+			return false;
+		}
+
+		OutRecord = *Record;
+		return true;
+	}
+
 	// v3.1: Save the registry after generation completes
 	void SaveRegistryIfNeeded()
 	{
+		// v7.8.76: Every record change is journaled - nothing journaled means the saved package is current
+		if (!FGeneratorMetadataJournal::Get().HasUncompactedChanges())
+		{
+			UE_LOG(LogGeneratorMetadata, Verbose, TEXT("Metadata registry unchanged - save skipped"));
+			return;
+		}
 		UGeneratorMetadataRegistry::SaveRegistry();
 	}
 }
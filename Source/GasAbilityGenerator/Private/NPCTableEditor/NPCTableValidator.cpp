@@ -7,9 +7,12 @@ FNPCValidationResult FNPCTableValidator::ValidateAll(const TArray<FNPCTableRow>&
 {
 	FNPCValidationResult Result;
 
+	// v7.8.82: One index for the whole table - uniqueness is a hash lookup per row
+	const FUniqueKeys UniqueKeys = BuildUniqueKeys(Rows);
+
 	for (const FNPCTableRow& Row : Rows)
 	{
-		TArray<FNPCValidationIssue> RowIssues = ValidateRow(Row, Rows);
+		TArray<FNPCValidationIssue> RowIssues = ValidateRow(Row, UniqueKeys);
 		Result.Issues.Append(RowIssues);
 	}
 
@@ -17,6 +20,25 @@ FNPCValidationResult FNPCTableValidator::ValidateAll(const TArray<FNPCTableRow>&
 }
 
 TArray<FNPCValidationIssue> FNPCTableValidator::ValidateRow(const FNPCTableRow& Row, const TArray<FNPCTableRow>& AllRows)
+{
+	return ValidateRow(Row, BuildUniqueKeys(AllRows));
+}
+
+FNPCTableValidator::FUniqueKeys FNPCTableValidator::BuildUniqueKeys(const TArray<FNPCTableRow>& AllRows)
+{
+	FUniqueKeys UniqueKeys;
+	UniqueKeys.NPCNames.Reserve(AllRows.Num());
+	UniqueKeys.NPCIds.Reserve(AllRows.Num());
+
+	for (const FNPCTableRow& Row : AllRows)
+	{
+		UniqueKeys.NPCNames.Add(Row.NPCName, Row.RowId);
+		UniqueKeys.NPCIds.Add(Row.NPCId, Row.RowId);
+	}
+	return UniqueKeys;
+}
+
+TArray<FNPCValidationIssue> FNPCTableValidator::ValidateRow(const FNPCTableRow& Row, const FUniqueKeys& UniqueKeys)
 {
 	TArray<FNPCValidationIssue> Issues;
 
@@ -51,7 +73,7 @@ TArray<FNPCValidationIssue> FNPCTableValidator::ValidateRow(const FNPCTableRow&
 		}
 
 		// NPCName must be unique
-		if (!IsNPCNameUnique(Row.NPCName, Row.RowId, AllRows))
+		if (!UniqueKeys.NPCNames.IsUnique(Row.NPCName, Row.RowId))
 		{
 			Issues.Add(FNPCValidationIssue(
 				ENPCValidationSeverity::Error,
@@ -75,7 +97,7 @@ TArray<FNPCValidationIssue> FNPCTableValidator::ValidateRow(const FNPCTableRow&
 	else
 	{
 		// NPCId must be unique
-		if (!IsNPCIdUnique(Row.NPCId, Row.RowId, AllRows))
+		if (!UniqueKeys.NPCIds.IsUnique(Row.NPCId, Row.RowId))
 		{
 			Issues.Add(FNPCValidationIssue(
 				ENPCValidationSeverity::Error,
@@ -210,42 +232,6 @@ TArray<FNPCValidationIssue> FNPCTableValidator::ValidateRow(const FNPCTableRow&
 	return Issues;
 }
 
-bool FNPCTableValidator::IsNPCIdUnique(const FString& NPCId, const FGuid& RowId, const TArray<FNPCTableRow>& AllRows)
-{
-	for (const FNPCTableRow& Row : AllRows)
-	{
-		// Skip self
-		if (Row.RowId == RowId)
-		{
-			continue;
-		}
-
-		if (Row.NPCId.Equals(NPCId, ESearchCase::IgnoreCase))
-		{
-			return false;
-		}
-	}
-	return true;
-}
-
-bool FNPCTableValidator::IsNPCNameUnique(const FString& NPCName, const FGuid& RowId, const TArray<FNPCTableRow>& AllRows)
-{
-	for (const FNPCTableRow& Row : AllRows)
-	{
-		// Skip self
-		if (Row.RowId == RowId)
-		{
-			continue;
-		}
-
-		if (Row.NPCName.Equals(NPCName, ESearchCase::IgnoreCase))
-		{
-			return false;
-		}
-	}
-	return true;
-}
-
 //=============================================================================
 // v4.5: Cache-writing validation methods
 //=============================================================================
@@ -259,9 +245,14 @@ uint32 FNPCTableValidator::ComputeValidationInputHash(const FNPCTableRow& Row, c
 }
 
 TArray<FNPCValidationIssue> FNPCTableValidator::ValidateRowAndCache(FNPCTableRow& Row, const TArray<FNPCTableRow>& AllRows, const FGuid& ListsVersionGuid)
+{
+	return ValidateRowAndCache(Row, BuildUniqueKeys(AllRows), ListsVersionGuid);
+}
+
+TArray<FNPCValidationIssue> FNPCTableValidator::ValidateRowAndCache(FNPCTableRow& Row, const FUniqueKeys& UniqueKeys, const FGuid& ListsVersionGuid)
 {
 	// Run standard validation
-	TArray<FNPCValidationIssue> Issues = ValidateRow(Row, AllRows);
+	TArray<FNPCValidationIssue> Issues = ValidateRow(Row, UniqueKeys);
 
 	// Count errors vs warnings
 	int32 ErrorCount = 0;
@@ -319,10 +310,13 @@ FNPCValidationResult FNPCTableValidator::ValidateAllAndCache(TArray<FNPCTableRow
 {
 	FNPCValidationResult Result;
 
+	// v7.8.82: Keys are read before any cache field is written - validation never edits them
+	const FUniqueKeys UniqueKeys = BuildUniqueKeys(Rows);
+
 	// Validate each row and write cache
 	for (FNPCTableRow& Row : Rows)
 	{
-		TArray<FNPCValidationIssue> RowIssues = ValidateRowAndCache(Row, Rows, ListsVersionGuid);
+		TArray<FNPCValidationIssue> RowIssues = ValidateRowAndCache(Row, UniqueKeys, ListsVersionGuid);
 		Result.Issues.Append(RowIssues);
 	}
 
@@ -1,10 +1,13 @@
 // GasAbilityGenerator - NPC Table Validator
+// v7.8.84: FUniqueKeys / BuildUniqueKeys public, so callers validating every row build the index once
+// v7.8.82: Whole-table validation is O(n) - NPCName/NPCId uniqueness via a hash index
 // v4.5: Validates NPC table rows for correctness before generation
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "NPCTableEditor/NPCTableEditorTypes.h"
+#include "TableEditorKeyIndex.h"
 
 /**
  * Validation issue severity
@@ -152,10 +155,18 @@ public:
 	 */
 	static uint32 ComputeValidationInputHash(const FNPCTableRow& Row, const FGuid& ListsVersionGuid);
 
-private:
-	/** Check if NPCId is unique across all rows */
-	static bool IsNPCIdUnique(const FString& NPCId, const FGuid& RowId, const TArray<FNPCTableRow>& AllRows);
+	/** v7.8.82: NPCName / NPCId owners, built once per table instead of rescanning it for every row */
+	struct FUniqueKeys
+	{
+		TTableKeyIndex<FString> NPCNames;
+		TTableKeyIndex<FString> NPCIds;
+	};
+
+	/** v7.8.84: Build once, then ValidateRow(Row, UniqueKeys) for each row of the same table */
+	static FUniqueKeys BuildUniqueKeys(const TArray<FNPCTableRow>& AllRows);
 
-	/** Check if NPCName is unique across all rows */
-	static bool IsNPCNameUnique(const FString& NPCName, const FGuid& RowId, const TArray<FNPCTableRow>& AllRows);
+	static TArray<FNPCValidationIssue> ValidateRow(const FNPCTableRow& Row, const FUniqueKeys& UniqueKeys);
+
+private:
+	static TArray<FNPCValidationIssue> ValidateRowAndCache(FNPCTableRow& Row, const FUniqueKeys& UniqueKeys, const FGuid& ListsVersionGuid);
 };
@@ -1,4 +1,5 @@
 // GasAbilityGenerator - NPC Apply Preview Window Implementation
+// v7.8.84: Rows validated against one NPCName/NPCId index instead of rebuilding it per row
 // v4.5: Full-screen preview for NPC changes
 
 #include "NPCTableEditor/SNPCApplyPreview.h"
@@ -670,6 +671,9 @@ void SNPCApplyPreview::LoadAndCompareData()
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
+	// Uniqueness is checked across the rows being applied - index them once
+	const FNPCTableValidator::FUniqueKeys UniqueKeys = FNPCTableValidator::BuildUniqueKeys(RowsToApply);
+
 	for (const FNPCTableRow& Row : RowsToApply)
 	{
 		TSharedPtr<FNPCChangeEntry> Entry = MakeShared<FNPCChangeEntry>();
@@ -678,8 +682,7 @@ void SNPCApplyPreview::LoadAndCompareData()
 		Entry->NPCId = Row.NPCId;
 		Entry->DisplayName = Row.DisplayName;
 
-		// Validate the row (pass empty array for AllRows since we're validating individually)
-		TArray<FNPCValidationIssue> Issues = FNPCTableValidator::ValidateRow(Row, RowsToApply);
+		TArray<FNPCValidationIssue> Issues = FNPCTableValidator::ValidateRow(Row, UniqueKeys);
 		for (const FNPCValidationIssue& Issue : Issues)
 		{
 			if (Issue.Severity == ENPCValidationSeverity::Error)
@@ -2440,6 +2440,7 @@ void SNPCTableEditor::Construct(const FArguments& InArgs)
 	TableData = InArgs._TableData;
 	OnDirtyStateChanged = InArgs._OnDirtyStateChanged;  // v4.6: Store delegate
 	TransactionStack = MakeShared<FTableEditorTransactionStack>(50);  // v7.2: Initialize undo/redo stack
+	ColumnIndex.SetValueGetter([this](const TSharedPtr<FNPCTableRow>& Row, FName ColumnId) { return GetColumnValue(Row, ColumnId); });
 	SyncFromTableData();
 	InitializeColumnFilters();
 	UpdateColumnFilterOptions();
@@ -2806,6 +2807,7 @@ TSharedRef<SHeaderRow> SNPCTableEditor::BuildHeaderRow()
 				.DefaultLabel(Col.DisplayName)
 				.ManualWidth(Col.ManualWidth)  // v4.12.5: Fixed pixel width
 				.SortMode(this, &SNPCTableEditor::GetColumnSortMode, Col.ColumnId)
+				.SortPriority(this, &SNPCTableEditor::GetColumnSortPriority, Col.ColumnId)  // v7.8.81: Shift-click adds a secondary sort
 				.OnSort(this, &SNPCTableEditor::OnColumnSortModeChanged)
 				.HeaderContent()
 				[
@@ -2880,7 +2882,7 @@ TSharedRef<SWidget> SNPCTableEditor::BuildColumnHeaderContent(const FNPCTableCol
 								{
 									FNPCColumnFilterState* S = ColumnFilters.Find(ColumnId);
 									if (S) S->SelectedValues.Empty();
-									ApplyFilters();
+									RefilterRows();
 									return FReply::Handled();
 								})
 						]
@@ -2900,7 +2902,7 @@ TSharedRef<SWidget> SNPCTableEditor::BuildColumnHeaderContent(const FNPCTableCol
 										S->SelectedValues.Empty();
 										S->SelectedValues.Add(TEXT("__NONE_SELECTED__"));
 									}
-									ApplyFilters();
+									RefilterRows();
 									return FReply::Handled();
 								})
 						]
@@ -3012,14 +3014,9 @@ void SNPCTableEditor::UpdateColumnFilterOptions()
 		State->DropdownOptions.Empty();
 		State->DropdownOptions.Add(MakeShared<FString>(TEXT(""))); // "(All)"
 
-		TSet<FString> UniqueValues;
-		for (const auto& Row : AllRows)
-		{
-			FString Value = GetColumnValue(Row, Col.ColumnId);
-			UniqueValues.Add(Value);
-		}
-
-		TArray<FString> SortedValues = UniqueValues.Array();
+		// v7.8.80: Distinct values come from the column index
+		TArray<FString> SortedValues;
+		ColumnIndex.GetDistinctValues(AllRows, Col.ColumnId, SortedValues);
 		SortedValues.Sort();
 
 		for (const FString& Value : SortedValues)
@@ -3035,7 +3032,7 @@ void SNPCTableEditor::OnColumnTextFilterChanged(FName ColumnId, const FText& New
 	if (State)
 	{
 		State->TextFilter = NewText.ToString();
-		ApplyFilters();
+		RefilterRows();
 	}
 }
 
@@ -3093,7 +3090,7 @@ void SNPCTableEditor::OnColumnDropdownFilterChanged(FName ColumnId, const FStrin
 		State->SelectedValues.Empty();
 	}
 
-	ApplyFilters();
+	RefilterRows();
 }
 
 FReply SNPCTableEditor::OnClearFiltersClicked()
@@ -3103,7 +3100,7 @@ FReply SNPCTableEditor::OnClearFiltersClicked()
 		FilterPair.Value.TextFilter.Empty();
 		FilterPair.Value.SelectedValues.Empty();
 	}
-	ApplyFilters();
+	RefilterRows();
 	return FReply::Handled();
 }
 
@@ -3202,15 +3199,9 @@ TArray<FString> SNPCTableEditor::GetUniqueColumnValues(FName ColumnId) const
 	// Filter dropdowns show values from the current table data (AllRows)
 	// Cell edit dropdowns (CreateAssetDropdownCell) separately scan project for all available assets
 	// Only include empty option if there are actually empty cells in that column
-	TSet<FString> UniqueSet;
-
-	for (const TSharedPtr<FNPCTableRow>& Row : AllRows)
-	{
-		FString Value = GetColumnValue(Row, ColumnId);
-		UniqueSet.Add(Value);
-	}
-
-	TArray<FString> Result = UniqueSet.Array();
+	// v7.8.80: Distinct values come from the column index
+	TArray<FString> Result;
+	ColumnIndex.GetDistinctValues(AllRows, ColumnId, Result);
 	Result.Sort();
 	return Result;
 }
@@ -3357,7 +3348,7 @@ TSharedRef<ITableRow> SNPCTableEditor::OnGenerateRow(TSharedPtr<FNPCTableRow> It
 {
 	return SNew(SNPCTableRow, OwnerTable)
 		.RowData(Item)
-		.OnRowModified(FSimpleDelegate::CreateSP(this, &SNPCTableEditor::OnRowModified));
+		.OnRowModified(FSimpleDelegate::CreateSP(this, &SNPCTableEditor::OnRowEdited, Item));
 }
 
 void SNPCTableEditor::OnSelectionChanged(TSharedPtr<FNPCTableRow> Item, ESelectInfo::Type SelectInfo)
@@ -3367,23 +3358,26 @@ void SNPCTableEditor::OnSelectionChanged(TSharedPtr<FNPCTableRow> Item, ESelectI
 
 EColumnSortMode::Type SNPCTableEditor::GetColumnSortMode(FName ColumnId) const
 {
-	if (SortColumn == ColumnId)
-	{
-		return SortMode;
-	}
-	return EColumnSortMode::None;
+	return TableEditorSort::GetSortMode(SortColumns, ColumnId);
+}
+
+EColumnSortPriority::Type SNPCTableEditor::GetColumnSortPriority(FName ColumnId) const
+{
+	return TableEditorSort::GetSortPriority(SortColumns, ColumnId);
 }
 
 void SNPCTableEditor::OnColumnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
 {
-	SortColumn = ColumnId;
-	SortMode = NewSortMode;
+	TableEditorSort::SetSortColumn(SortColumns, Priority, ColumnId, NewSortMode);
 	ApplySorting();
 	RefreshList();
 }
 
 void SNPCTableEditor::RefreshList()
 {
+	// v7.8.80: Callers refresh after changing rows in place (validation, generation, bulk edit)
+	ColumnIndex.Invalidate();
+
 	if (ListView.IsValid())
 	{
 		ListView->RequestListRefresh();
@@ -3416,111 +3410,98 @@ void SNPCTableEditor::SyncFromTableData()
 
 void SNPCTableEditor::ApplyFilters()
 {
-	DisplayedRows.Empty();
+	ColumnIndex.Invalidate();
+	RefilterRows();
+}
+
+void SNPCTableEditor::RefilterRows()
+{
+	// v7.8.80: Each distinct column value is tested once; rows are narrowed through the column index
+	ColumnIndex.BeginFilter(AllRows);
 
-	for (TSharedPtr<FNPCTableRow>& Row : AllRows)
+	// Check each column filter (text filter + multi-select dropdown)
+	for (const auto& FilterPair : ColumnFilters)
 	{
-		bool bPassesFilters = true;
+		const FName& ColumnId = FilterPair.Key;
+		const FNPCColumnFilterState& FilterState = FilterPair.Value;
 
-		// Check each column filter (text filter + multi-select dropdown)
-		for (const auto& FilterPair : ColumnFilters)
+		// 1. Text filter - case-insensitive contains
+		if (!FilterState.TextFilter.IsEmpty())
 		{
-			const FName& ColumnId = FilterPair.Key;
-			const FNPCColumnFilterState& FilterState = FilterPair.Value;
-			FString ColumnValue = GetColumnValue(Row, ColumnId);
+			ColumnIndex.MatchText(ColumnId, FilterState.TextFilter);
+		}
 
-			// 1. Text filter - case-insensitive contains
-			if (!FilterState.TextFilter.IsEmpty())
+		// 2. Multi-select dropdown filter
+		// Empty SelectedValues = show all (no filter)
+		// __NONE_SELECTED__ marker = show nothing
+		// Otherwise, only show rows where column value is in SelectedValues
+		if (FilterState.SelectedValues.Num() > 0)
+		{
+			if (FilterState.SelectedValues.Contains(TEXT("__NONE_SELECTED__")))
 			{
-				if (!ColumnValue.ToLower().Contains(FilterState.TextFilter.ToLower()))
-				{
-					bPassesFilters = false;
-					break;
-				}
+				// None selected - filter out everything
+				ColumnIndex.MatchNothing();
+				break;
 			}
 
-			// 2. Multi-select dropdown filter
-			// Empty SelectedValues = show all (no filter)
-			// __NONE_SELECTED__ marker = show nothing
-			// Otherwise, only show rows where column value is in SelectedValues
-			if (FilterState.SelectedValues.Num() > 0)
+			ColumnIndex.MatchValues(ColumnId, [&FilterState](const FString& ColumnValue)
 			{
-				if (FilterState.SelectedValues.Contains(TEXT("__NONE_SELECTED__")))
-				{
-					// None selected - filter out everything
-					bPassesFilters = false;
-					break;
-				}
-
-				// Check if column value is in the selected values set
-				if (!FilterState.SelectedValues.Contains(ColumnValue))
-				{
-					bPassesFilters = false;
-					break;
-				}
-			}
-		}
-
-		if (bPassesFilters)
-		{
-			DisplayedRows.Add(Row);
+				return FilterState.SelectedValues.Contains(ColumnValue);
+			});
 		}
 	}
 
+	ColumnIndex.GetMatchingRows(DisplayedRows);
+
 	ApplySorting();
-	RefreshList();
-}
 
-void SNPCTableEditor::ApplySorting()
-{
-	if (SortColumn == NAME_None || SortMode == EColumnSortMode::None)
+	// Not RefreshList() - that also drops the column index
+	if (ListView.IsValid())
 	{
-		return;
+		ListView->RequestListRefresh();
 	}
+	UpdateStatusBar();
+}
 
-	bool bAscending = (SortMode == EColumnSortMode::Ascending);
-
-	DisplayedRows.Sort([this, bAscending](const TSharedPtr<FNPCTableRow>& A, const TSharedPtr<FNPCTableRow>& B)
-	{
-		// String-based columns
-		if (SortColumn == TEXT("NPCName") || SortColumn == TEXT("NPCId") ||
-			SortColumn == TEXT("DisplayName") || SortColumn == TEXT("Status") ||
-			SortColumn == TEXT("Factions") || SortColumn == TEXT("ShopName") ||
-			SortColumn == TEXT("DefaultItems") || SortColumn == TEXT("SpawnerPOI") || SortColumn == TEXT("Notes"))
-		{
-			FString ValueA, ValueB;
-			if (SortColumn == TEXT("NPCName")) { ValueA = A->NPCName; ValueB = B->NPCName; }
-			else if (SortColumn == TEXT("NPCId")) { ValueA = A->NPCId; ValueB = B->NPCId; }
-			else if (SortColumn == TEXT("DisplayName")) { ValueA = A->DisplayName; ValueB = B->DisplayName; }
-			else if (SortColumn == TEXT("Status")) { ValueA = A->GetStatusString(); ValueB = B->GetStatusString(); }
-			else if (SortColumn == TEXT("Factions")) { ValueA = A->Factions; ValueB = B->Factions; }
-			else if (SortColumn == TEXT("ShopName")) { ValueA = A->ShopName; ValueB = B->ShopName; }
-			else if (SortColumn == TEXT("DefaultItems")) { ValueA = A->DefaultItems; ValueB = B->DefaultItems; }
-			else if (SortColumn == TEXT("SpawnerPOI")) { ValueA = A->SpawnerPOI; ValueB = B->SpawnerPOI; }
-			else if (SortColumn == TEXT("Notes")) { ValueA = A->Notes; ValueB = B->Notes; }
-			return bAscending ? (ValueA < ValueB) : (ValueA > ValueB);
-		}
-
-		// LevelRange - sort by MinLevel
-		if (SortColumn == TEXT("LevelRange"))
-		{
-			return bAscending ? (A->MinLevel < B->MinLevel) : (A->MinLevel > B->MinLevel);
-		}
-
-		// Float columns
-		if (SortColumn == TEXT("AttackPriority"))
-		{
-			return bAscending ? (A->AttackPriority < B->AttackPriority) : (A->AttackPriority > B->AttackPriority);
-		}
+void SNPCTableEditor::ApplySorting()
+{
+	// v7.8.81: Keys are extracted once per row; the sort compares typed keys only
+	TableEditorSort::SortRows<FNPCTableRow>(DisplayedRows, SortColumns,
+		[this](const TSharedPtr<FNPCTableRow>& Row, FName ColumnId) { return GetSortKey(Row, ColumnId); });
+}
 
-		// Boolean columns
-		if (SortColumn == TEXT("bIsVendor"))
-		{
-			return bAscending ? (A->bIsVendor < B->bIsVendor) : (A->bIsVendor > B->bIsVendor);
-		}
+FTableSortKey SNPCTableEditor::GetSortKey(const TSharedPtr<FNPCTableRow>& Row, FName ColumnId) const
+{
+	if (!Row.IsValid()) return FTableSortKey();
+
+	// Status - workflow order (New, Modified, Synced, Error)
+	if (ColumnId == TEXT("Status")) return FTableSortKey::FromEnum(Row->Status);
+
+	// LevelRange - sort by MinLevel
+	if (ColumnId == TEXT("LevelRange")) return FTableSortKey::FromNumber(Row->MinLevel);
+
+	// Number and boolean columns
+	if (ColumnId == TEXT("AttackPriority")) return FTableSortKey::FromNumber(Row->AttackPriority);
+	if (ColumnId == TEXT("bIsVendor")) return FTableSortKey::FromNumber(Row->bIsVendor);
+
+	// String columns - raw field (empty sorts first)
+	if (ColumnId == TEXT("NPCName")) return FTableSortKey::FromText(Row->NPCName);
+	if (ColumnId == TEXT("NPCId")) return FTableSortKey::FromText(Row->NPCId);
+	if (ColumnId == TEXT("DisplayName")) return FTableSortKey::FromText(Row->DisplayName);
+	if (ColumnId == TEXT("Factions")) return FTableSortKey::FromText(Row->Factions);
+	if (ColumnId == TEXT("ShopName")) return FTableSortKey::FromText(Row->ShopName);
+	if (ColumnId == TEXT("DefaultItems")) return FTableSortKey::FromText(Row->DefaultItems);
+	if (ColumnId == TEXT("SpawnerPOI")) return FTableSortKey::FromText(Row->SpawnerPOI);
+	if (ColumnId == TEXT("Notes")) return FTableSortKey::FromText(Row->Notes);
+
+	// Asset columns - displayed name
+	return FTableSortKey::FromText(GetColumnValue(Row, ColumnId));
+}
 
-		return false;
-	});
+void SNPCTableEditor::OnRowEdited(TSharedPtr<FNPCTableRow> Row)
+{
+	ColumnIndex.InvalidateRow(Row);
+	OnRowModified();
 }
 
 void SNPCTableEditor::OnRowModified()
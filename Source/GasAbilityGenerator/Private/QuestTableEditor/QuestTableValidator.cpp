@@ -7,13 +7,16 @@ FQuestValidationResult FQuestTableValidator::ValidateAll(const TArray<FQuestTabl
 {
 	FQuestValidationResult Result;
 
+	// v7.8.82: One index for the whole table - state uniqueness and parent branches are hash lookups
+	const FQuestStateIndex QuestStates = BuildQuestStateIndex(Rows);
+
 	// Group by quest for structure validation
 	TMap<FString, TArray<const FQuestTableRow*>> QuestGroups;
 	for (const FQuestTableRow& Row : Rows)
 	{
 		if (!Row.bDeleted)
 		{
-			TArray<FQuestValidationIssue> RowIssues = ValidateRow(Row, Rows);
+			TArray<FQuestValidationIssue> RowIssues = ValidateRow(Row, QuestStates);
 			Result.Issues.Append(RowIssues);
 
 			if (!Row.QuestName.IsEmpty())
@@ -34,6 +37,11 @@ FQuestValidationResult FQuestTableValidator::ValidateAll(const TArray<FQuestTabl
 }
 
 TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRow(const FQuestTableRow& Row, const TArray<FQuestTableRow>& AllRows)
+{
+	return ValidateRow(Row, BuildQuestStateIndex(AllRows));
+}
+
+TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRow(const FQuestTableRow& Row, const FQuestStateIndex& QuestStates)
 {
 	TArray<FQuestValidationIssue> Issues;
 
@@ -61,7 +69,7 @@ TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRow(const FQuestTabl
 	// State ID uniqueness within quest
 	if (!Row.StateID.IsEmpty() && !Row.QuestName.IsEmpty())
 	{
-		if (!IsStateIdUnique(Row.QuestName, Row.StateID, Row.RowId, AllRows))
+		if (!QuestStates.IsUnique(MakeTuple(Row.QuestName, Row.StateID), Row.RowId))
 		{
 			Issues.Add(FQuestValidationIssue(
 				EQuestValidationSeverity::Error,
@@ -72,10 +80,10 @@ TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRow(const FQuestTabl
 		}
 	}
 
-	// Parent branch validation
+	// Parent branch validation - must reference an existing StateID in the same quest
 	if (!Row.ParentBranch.IsEmpty() && !Row.QuestName.IsEmpty())
 	{
-		if (!IsParentBranchValid(Row.QuestName, Row.ParentBranch, AllRows))
+		if (!QuestStates.Contains(MakeTuple(Row.QuestName, Row.ParentBranch)))
 		{
 			Issues.Add(FQuestValidationIssue(
 				EQuestValidationSeverity::Warning,
@@ -171,11 +179,13 @@ FQuestValidationResult FQuestTableValidator::ValidateAllAndCache(TArray<FQuestTa
 {
 	FQuestValidationResult Result;
 
+	const FQuestStateIndex QuestStates = BuildQuestStateIndex(Rows);
+
 	for (FQuestTableRow& Row : Rows)
 	{
 		if (!Row.bDeleted)
 		{
-			TArray<FQuestValidationIssue> RowIssues = ValidateRowAndCache(Row, Rows, ListsVersionGuid);
+			TArray<FQuestValidationIssue> RowIssues = ValidateRowAndCache(Row, QuestStates, ListsVersionGuid);
 			Result.Issues.Append(RowIssues);
 		}
 	}
@@ -184,6 +194,11 @@ FQuestValidationResult FQuestTableValidator::ValidateAllAndCache(TArray<FQuestTa
 }
 
 TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRowAndCache(FQuestTableRow& Row, const TArray<FQuestTableRow>& AllRows, const FGuid& ListsVersionGuid)
+{
+	return ValidateRowAndCache(Row, BuildQuestStateIndex(AllRows), ListsVersionGuid);
+}
+
+TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRowAndCache(FQuestTableRow& Row, const FQuestStateIndex& QuestStates, const FGuid& ListsVersionGuid)
 {
 	// Check if validation is stale
 	uint32 CurrentInputHash = ComputeValidationInputHash(Row, ListsVersionGuid);
@@ -194,7 +209,7 @@ TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRowAndCache(FQuestTa
 	}
 
 	// Perform validation
-	TArray<FQuestValidationIssue> Issues = ValidateRow(Row, AllRows);
+	TArray<FQuestValidationIssue> Issues = ValidateRow(Row, QuestStates);
 
 	// Update cache
 	Row.ValidationInputHash = CurrentInputHash;
@@ -237,17 +252,20 @@ uint32 FQuestTableValidator::ComputeValidationInputHash(const FQuestTableRow& Ro
 	return Hash;
 }
 
-bool FQuestTableValidator::IsStateIdUnique(const FString& QuestName, const FString& StateID, const FGuid& RowId, const TArray<FQuestTableRow>& AllRows)
+FQuestTableValidator::FQuestStateIndex FQuestTableValidator::BuildQuestStateIndex(const TArray<FQuestTableRow>& AllRows)
 {
+	FQuestStateIndex QuestStates;
+	QuestStates.Reserve(AllRows.Num());
+
 	for (const FQuestTableRow& Row : AllRows)
 	{
-		if (Row.RowId != RowId && !Row.bDeleted &&
-			Row.QuestName == QuestName && Row.StateID == StateID)
+		// Deleted rows neither claim a state nor serve as a parent branch
+		if (!Row.bDeleted)
 		{
-			return false;
+			QuestStates.Add(MakeTuple(Row.QuestName, Row.StateID), Row.RowId);
 		}
 	}
-	return true;
+	return QuestStates;
 }
 
 TArray<FQuestValidationIssue> FQuestTableValidator::ValidateTasksToken(const FQuestTableRow& Row)
@@ -388,16 +406,3 @@ TArray<FQuestValidationIssue> FQuestTableValidator::ValidateRewardsToken(const F
 
 	return Issues;
 }
-
-bool FQuestTableValidator::IsParentBranchValid(const FString& QuestName, const FString& ParentBranch, const TArray<FQuestTableRow>& AllRows)
-{
-	// ParentBranch should reference an existing StateID in the same quest
-	for (const FQuestTableRow& Row : AllRows)
-	{
-		if (!Row.bDeleted && Row.QuestName == QuestName && Row.StateID == ParentBranch)
-		{
-			return true;
-		}
-	}
-	return false;
-}
@@ -1,4 +1,5 @@
 // GasAbilityGenerator - Quest Table Validator
+// v7.8.82: Whole-table validation is O(n) - (QuestName, StateID) hash index for uniqueness and parent branches
 // v4.8: Validates Quest table rows for correctness before generation
 // Follows NPC/Dialogue validator patterns with validation cache support
 
@@ -6,6 +7,7 @@
 
 #include "CoreMinimal.h"
 #include "QuestTableEditor/QuestTableEditorTypes.h"
+#include "TableEditorKeyIndex.h"
 
 /**
  * Validation issue severity
@@ -164,8 +166,14 @@ public:
 	static uint32 ComputeValidationInputHash(const FQuestTableRow& Row, const FGuid& ListsVersionGuid);
 
 private:
-	/** Check if StateID is unique within quest */
-	static bool IsStateIdUnique(const FString& QuestName, const FString& StateID, const FGuid& RowId, const TArray<FQuestTableRow>& AllRows);
+	/** v7.8.82: (QuestName, StateID) owners of the non-deleted rows, built once per table */
+	using FQuestStateIndex = TTableKeyIndex<TPair<FString, FString>>;
+
+	static FQuestStateIndex BuildQuestStateIndex(const TArray<FQuestTableRow>& AllRows);
+
+	static TArray<FQuestValidationIssue> ValidateRow(const FQuestTableRow& Row, const FQuestStateIndex& QuestStates);
+
+	static TArray<FQuestValidationIssue> ValidateRowAndCache(FQuestTableRow& Row, const FQuestStateIndex& QuestStates, const FGuid& ListsVersionGuid);
 
 	/** Validate Tasks token syntax */
 	static TArray<FQuestValidationIssue> ValidateTasksToken(const FQuestTableRow& Row);
@@ -178,7 +186,4 @@ private:
 
 	/** Validate Rewards token syntax */
 	static TArray<FQuestValidationIssue> ValidateRewardsToken(const FQuestTableRow& Row);
-
-	/** Check if ParentBranch references a valid state */
-	static bool IsParentBranchValid(const FString& QuestName, const FString& ParentBranch, const TArray<FQuestTableRow>& AllRows);
 };
@@ -1,21 +1,11 @@
 // GasAbilityGenerator - Quest XLSX Writer Implementation
 // v4.12: Export Quest table to Excel format
+// v7.8.79: Written through FXLSXStreamWriter (deflate entries, shared string table)
 
 #include "QuestTableEditor/QuestXLSXWriter.h"
-#include "HAL/PlatformFileManager.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
-#include "Serialization/Archive.h"
-#include "Compression/OodleDataCompressionUtil.h"
-
-// Use miniz for ZIP creation
-#if PLATFORM_WINDOWS
-#include "Windows/AllowWindowsPlatformTypes.h"
-#endif
-#include "Compression/lz4.h"
-#if PLATFORM_WINDOWS
-#include "Windows/HideWindowsPlatformTypes.h"
-#endif
+#include "XLSXSupport/XLSXStreamWriter.h"
+#include "Misc/DateTime.h"
+#include "Misc/Guid.h"
 
 const FString FQuestXLSXWriter::SHEET_SENTINEL = TEXT("#QUEST_SHEET_V1");
 const FString FQuestXLSXWriter::FORMAT_VERSION = TEXT("1.0");
@@ -48,50 +38,25 @@ TArray<FQuestXLSXColumn> FQuestXLSXWriter::GetColumnDefinitions()
 
 bool FQuestXLSXWriter::ExportToXLSX(const TArray<FQuestTableRow>& Rows, const FString& FilePath, FString& OutError)
 {
-	// Create temp directory for XLSX parts
-	FString TempDir = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("QuestXLSX_"));
-	IFileManager& FM = IFileManager::Get();
-	FM.MakeDirectory(*TempDir, true);
-	FM.MakeDirectory(*(TempDir / TEXT("_rels")), true);
-	FM.MakeDirectory(*(TempDir / TEXT("xl")), true);
-	FM.MakeDirectory(*(TempDir / TEXT("xl/_rels")), true);
-	FM.MakeDirectory(*(TempDir / TEXT("xl/worksheets")), true);
-
-	// Write XML parts
-	FFileHelper::SaveStringToFile(GenerateContentTypesXml(), *(TempDir / TEXT("[Content_Types].xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	FFileHelper::SaveStringToFile(GenerateRelsXml(), *(TempDir / TEXT("_rels/.rels")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	FFileHelper::SaveStringToFile(GenerateWorkbookXml(), *(TempDir / TEXT("xl/workbook.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	FFileHelper::SaveStringToFile(GenerateWorkbookRelsXml(), *(TempDir / TEXT("xl/_rels/workbook.xml.rels")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	FFileHelper::SaveStringToFile(GenerateStylesXml(), *(TempDir / TEXT("xl/styles.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	FFileHelper::SaveStringToFile(GenerateQuestsSheet(Rows), *(TempDir / TEXT("xl/worksheets/sheet1.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	FFileHelper::SaveStringToFile(GenerateListsSheet(Rows), *(TempDir / TEXT("xl/worksheets/sheet2.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-	FFileHelper::SaveStringToFile(GenerateMetaSheet(Rows), *(TempDir / TEXT("xl/worksheets/sheet3.xml")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
-
-	// Create ZIP file using system command (portable approach)
-	FString ZipCommand;
-#if PLATFORM_WINDOWS
-	// Use PowerShell Compress-Archive
-	ZipCommand = FString::Printf(TEXT("powershell -ExecutionPolicy Bypass -Command \"Compress-Archive -Path '%s/*' -DestinationPath '%s' -Force\""),
-		*TempDir, *FilePath);
-#else
-	// Use zip command on Unix
-	ZipCommand = FString::Printf(TEXT("cd '%s' && zip -r '%s' ."), *TempDir, *FilePath);
-#endif
-
-	int32 ReturnCode = 0;
-	FString StdOut, StdErr;
-	FPlatformProcess::ExecProcess(*ZipCommand, TEXT(""), &ReturnCode, &StdOut, &StdErr);
-
-	// Clean up temp directory
-	FM.DeleteDirectory(*TempDir, false, true);
-
-	if (ReturnCode != 0)
+	// v7.8.79: Written in-process through the streaming writer (deflate entries, shared strings) -
+	// no temp directory and no shell-out to PowerShell/zip
+	FXLSXStreamWriter Writer;
+	if (!Writer.Open(FilePath, OutError))
 	{
-		OutError = FString::Printf(TEXT("Failed to create XLSX: %s"), *StdErr);
 		return false;
 	}
 
-	return true;
+	// Write XML parts
+	Writer.AddPart(TEXT("[Content_Types].xml"), GenerateContentTypesXml());
+	Writer.AddPart(TEXT("_rels/.rels"), GenerateRelsXml());
+	Writer.AddPart(TEXT("xl/workbook.xml"), GenerateWorkbookXml());
+	Writer.AddPart(TEXT("xl/_rels/workbook.xml.rels"), GenerateWorkbookRelsXml());
+	Writer.AddPart(TEXT("xl/styles.xml"), GenerateStylesXml());
+	WriteQuestsSheet(Writer, Rows);
+	WriteListsSheet(Writer, Rows);
+	WriteMetaSheet(Writer, Rows);
+
+	return Writer.Close(OutError);
 }
 
 FString FQuestXLSXWriter::GenerateContentTypesXml()
@@ -105,6 +70,7 @@ FString FQuestXLSXWriter::GenerateContentTypesXml()
 		TEXT("  <Override PartName=\"/xl/worksheets/sheet2.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>\n")
 		TEXT("  <Override PartName=\"/xl/worksheets/sheet3.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>\n")
 		TEXT("  <Override PartName=\"/xl/styles.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.styles+xml\"/>\n")
+		TEXT("  <Override PartName=\"/xl/sharedStrings.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.sharedStrings+xml\"/>\n")
 		TEXT("</Types>");
 }
 
@@ -136,6 +102,7 @@ FString FQuestXLSXWriter::GenerateWorkbookRelsXml()
 		TEXT("  <Relationship Id=\"rId2\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet\" Target=\"worksheets/sheet2.xml\"/>\n")
 		TEXT("  <Relationship Id=\"rId3\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet\" Target=\"worksheets/sheet3.xml\"/>\n")
 		TEXT("  <Relationship Id=\"rId4\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/styles\" Target=\"styles.xml\"/>\n")
+		TEXT("  <Relationship Id=\"rId5\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/sharedStrings\" Target=\"sharedStrings.xml\"/>\n")
 		TEXT("</Relationships>");
 }
 
@@ -160,89 +127,58 @@ FString FQuestXLSXWriter::GenerateStylesXml()
 		TEXT("</styleSheet>");
 }
 
-FString FQuestXLSXWriter::GenerateQuestsSheet(const TArray<FQuestTableRow>& Rows)
+void FQuestXLSXWriter::WriteQuestsSheet(FXLSXStreamWriter& Writer, const TArray<FQuestTableRow>& Rows)
 {
 	TArray<FQuestXLSXColumn> Columns = GetColumnDefinitions();
-
-	FString SheetData;
-	SheetData += TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
-	SheetData += TEXT("<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n");
-	SheetData += TEXT("  <sheetData>\n");
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet1.xml"));
 
 	// Row 1: Sentinel + Column IDs
-	SheetData += TEXT("    <row r=\"1\">\n");
+	Writer.BeginRow();
 	for (int32 i = 0; i < Columns.Num(); i++)
 	{
-		FString CellRef = CellReference(i, 1);
-		FString Value = (i == 0) ? SHEET_SENTINEL : Columns[i].ColumnId;
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellRef, *EscapeXml(Value));
+		Writer.AddCell((i == 0) ? SHEET_SENTINEL : Columns[i].ColumnId);
 	}
-	SheetData += TEXT("    </row>\n");
+	Writer.EndRow();
 
 	// Row 2: Human-readable headers (bold)
-	SheetData += TEXT("    <row r=\"2\">\n");
-	for (int32 i = 0; i < Columns.Num(); i++)
+	Writer.BeginRow();
+	for (const FQuestXLSXColumn& Column : Columns)
 	{
-		FString CellRef = CellReference(i, 2);
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\" s=\"1\"><is><t>%s</t></is></c>\n"),
-			*CellRef, *EscapeXml(Columns[i].DisplayName));
+		Writer.AddCell(Column.DisplayName, 1);
 	}
-	SheetData += TEXT("    </row>\n");
+	Writer.EndRow();
 
 	// Data rows
-	int32 RowNum = 3;
 	for (const FQuestTableRow& Row : Rows)
 	{
-		SheetData += FString::Printf(TEXT("    <row r=\"%d\">\n"), RowNum);
-
-		int32 ColIdx = 0;
+		Writer.BeginRow();
 
 		// Sync columns
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.RowId.ToString()));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), Row.bDeleted ? TEXT("DELETED") : TEXT("ACTIVE"));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%lld</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), ComputeRowHash(Row));
+		Writer.AddCell(Row.RowId.ToString());
+		Writer.AddCell(Row.bDeleted ? TEXT("DELETED") : TEXT("ACTIVE"));
+		Writer.AddCell(FString::Printf(TEXT("%lld"), ComputeRowHash(Row)));
 
 		// Data columns
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.QuestName));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.DisplayName));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.StateID));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.GetStateTypeString()));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.Description));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.ParentBranch));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.Tasks));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.Events));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.Conditions));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.Rewards));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), *EscapeXml(Row.Notes));
-		SheetData += FString::Printf(TEXT("      <c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-			*CellReference(ColIdx++, RowNum), Row.bDeleted ? TEXT("TRUE") : TEXT("FALSE"));
-
-		SheetData += TEXT("    </row>\n");
-		RowNum++;
+		Writer.AddCell(Row.QuestName);
+		Writer.AddCell(Row.DisplayName);
+		Writer.AddCell(Row.StateID);
+		Writer.AddCell(Row.GetStateTypeString());
+		Writer.AddCell(Row.Description);
+		Writer.AddCell(Row.ParentBranch);
+		Writer.AddCell(Row.Tasks);
+		Writer.AddCell(Row.Events);
+		Writer.AddCell(Row.Conditions);
+		Writer.AddCell(Row.Rewards);
+		Writer.AddCell(Row.Notes);
+		Writer.AddCell(Row.bDeleted ? TEXT("TRUE") : TEXT("FALSE"));
+
+		Writer.EndRow();
 	}
 
-	SheetData += TEXT("  </sheetData>\n");
-	SheetData += TEXT("</worksheet>");
-
-	return SheetData;
+	Writer.EndSheet();
 }
 
-FString FQuestXLSXWriter::GenerateListsSheet(const TArray<FQuestTableRow>& Rows)
+void FQuestXLSXWriter::WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FQuestTableRow>& Rows)
 {
 	// Collect unique values for dropdowns
 	TSet<FString> QuestNames;
@@ -256,16 +192,13 @@ FString FQuestXLSXWriter::GenerateListsSheet(const TArray<FQuestTableRow>& Rows)
 		if (!Row.QuestName.IsEmpty()) QuestNames.Add(Row.QuestName);
 	}
 
-	FString SheetData;
-	SheetData += TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
-	SheetData += TEXT("<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n");
-	SheetData += TEXT("  <sheetData>\n");
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet2.xml"));
 
 	// Headers
-	SheetData += TEXT("    <row r=\"1\">\n");
-	SheetData += TEXT("      <c r=\"A1\" t=\"inlineStr\" s=\"1\"><is><t>Quest Names</t></is></c>\n");
-	SheetData += TEXT("      <c r=\"B1\" t=\"inlineStr\" s=\"1\"><is><t>State Types</t></is></c>\n");
-	SheetData += TEXT("    </row>\n");
+	Writer.BeginRow();
+	Writer.AddCell(TEXT("Quest Names"), 1);
+	Writer.AddCell(TEXT("State Types"), 1);
+	Writer.EndRow();
 
 	// Data
 	int32 MaxRows = FMath::Max(QuestNames.Num(), StateTypes.Num());
@@ -274,27 +207,16 @@ FString FQuestXLSXWriter::GenerateListsSheet(const TArray<FQuestTableRow>& Rows)
 
 	for (int32 i = 0; i < MaxRows; i++)
 	{
-		SheetData += FString::Printf(TEXT("    <row r=\"%d\">\n"), i + 2);
-		if (i < QuestArray.Num())
-		{
-			SheetData += FString::Printf(TEXT("      <c r=\"A%d\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-				i + 2, *EscapeXml(QuestArray[i]));
-		}
-		if (i < StateArray.Num())
-		{
-			SheetData += FString::Printf(TEXT("      <c r=\"B%d\" t=\"inlineStr\"><is><t>%s</t></is></c>\n"),
-				i + 2, *EscapeXml(StateArray[i]));
-		}
-		SheetData += TEXT("    </row>\n");
+		Writer.BeginRow();
+		Writer.AddCell(QuestArray.IsValidIndex(i) ? QuestArray[i] : FString());
+		Writer.AddCell(StateArray.IsValidIndex(i) ? StateArray[i] : FString());
+		Writer.EndRow();
 	}
 
-	SheetData += TEXT("  </sheetData>\n");
-	SheetData += TEXT("</worksheet>");
-
-	return SheetData;
+	Writer.EndSheet();
 }
 
-FString FQuestXLSXWriter::GenerateMetaSheet(const TArray<FQuestTableRow>& Rows)
+void FQuestXLSXWriter::WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FQuestTableRow>& Rows)
 {
 	FString ExportGuid = FGuid::NewGuid().ToString();
 	FString Timestamp = FDateTime::Now().ToString();
@@ -306,50 +228,24 @@ FString FQuestXLSXWriter::GenerateMetaSheet(const TArray<FQuestTableRow>& Rows)
 		ContentHash = HashCombine(ContentHash, Row.ComputeEditableFieldsHash());
 	}
 
-	FString SheetData;
-	SheetData += TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
-	SheetData += TEXT("<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">\n");
-	SheetData += TEXT("  <sheetData>\n");
-
-	SheetData += TEXT("    <row r=\"1\"><c r=\"A1\" t=\"inlineStr\" s=\"1\"><is><t>Metadata Key</t></is></c><c r=\"B1\" t=\"inlineStr\" s=\"1\"><is><t>Value</t></is></c></row>\n");
-	SheetData += FString::Printf(TEXT("    <row r=\"2\"><c r=\"A2\" t=\"inlineStr\"><is><t>ExportGuid</t></is></c><c r=\"B2\" t=\"inlineStr\"><is><t>%s</t></is></c></row>\n"), *ExportGuid);
-	SheetData += FString::Printf(TEXT("    <row r=\"3\"><c r=\"A3\" t=\"inlineStr\"><is><t>ExportTimestamp</t></is></c><c r=\"B3\" t=\"inlineStr\"><is><t>%s</t></is></c></row>\n"), *Timestamp);
-	SheetData += FString::Printf(TEXT("    <row r=\"4\"><c r=\"A4\" t=\"inlineStr\"><is><t>ContentHash</t></is></c><c r=\"B4\" t=\"inlineStr\"><is><t>%u</t></is></c></row>\n"), ContentHash);
-	SheetData += FString::Printf(TEXT("    <row r=\"5\"><c r=\"A5\" t=\"inlineStr\"><is><t>RowCount</t></is></c><c r=\"B5\" t=\"inlineStr\"><is><t>%d</t></is></c></row>\n"), Rows.Num());
-	SheetData += FString::Printf(TEXT("    <row r=\"6\"><c r=\"A6\" t=\"inlineStr\"><is><t>FormatVersion</t></is></c><c r=\"B6\" t=\"inlineStr\"><is><t>%s</t></is></c></row>\n"), *FORMAT_VERSION);
-
-	SheetData += TEXT("  </sheetData>\n");
-	SheetData += TEXT("</worksheet>");
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet3.xml"));
 
-	return SheetData;
-}
-
-FString FQuestXLSXWriter::EscapeXml(const FString& Text)
-{
-	FString Escaped = Text;
-	Escaped.ReplaceInline(TEXT("&"), TEXT("&amp;"));
-	Escaped.ReplaceInline(TEXT("<"), TEXT("&lt;"));
-	Escaped.ReplaceInline(TEXT(">"), TEXT("&gt;"));
-	Escaped.ReplaceInline(TEXT("\""), TEXT("&quot;"));
-	Escaped.ReplaceInline(TEXT("'"), TEXT("&apos;"));
-	return Escaped;
-}
-
-FString FQuestXLSXWriter::CellReference(int32 Col, int32 Row)
-{
-	return ColumnLetter(Col) + FString::FromInt(Row);
-}
-
-FString FQuestXLSXWriter::ColumnLetter(int32 ColIndex)
-{
-	FString Letters;
-	int32 Remaining = ColIndex;
-	do
+	auto WriteMetaRow = [&Writer](const FString& Key, const FString& Value, int32 StyleIndex = 0)
 	{
-		Letters = FString::Chr(TEXT('A') + (Remaining % 26)) + Letters;
-		Remaining = Remaining / 26 - 1;
-	} while (Remaining >= 0);
-	return Letters;
+		Writer.BeginRow();
+		Writer.AddCell(Key, StyleIndex);
+		Writer.AddCell(Value, StyleIndex);
+		Writer.EndRow();
+	};
+
+	WriteMetaRow(TEXT("Metadata Key"), TEXT("Value"), 1);
+	WriteMetaRow(TEXT("ExportGuid"), ExportGuid);
+	WriteMetaRow(TEXT("ExportTimestamp"), Timestamp);
+	WriteMetaRow(TEXT("ContentHash"), FString::Printf(TEXT("%u"), ContentHash));
+	WriteMetaRow(TEXT("RowCount"), FString::Printf(TEXT("%d"), Rows.Num()));
+	WriteMetaRow(TEXT("FormatVersion"), FORMAT_VERSION);
+
+	Writer.EndSheet();
 }
 
 int64 FQuestXLSXWriter::ComputeRowHash(const FQuestTableRow& Row)
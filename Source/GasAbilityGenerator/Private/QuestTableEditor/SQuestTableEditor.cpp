@@ -568,6 +568,7 @@ void SQuestTableEditor::Construct(const FArguments& InArgs)
 	TableData = InArgs._TableData;
 	OnDirtyStateChanged = InArgs._OnDirtyStateChanged;
 	TransactionStack = MakeShared<FTableEditorTransactionStack>(50);  // v7.2: Initialize undo/redo stack
+	ColumnIndex.SetValueGetter([this](const TSharedPtr<FQuestTableRowEx>& Row, FName ColumnId) { return GetColumnValue(Row, ColumnId); });
 
 	InitializeColumnFilters();
 	SyncFromTableData();
@@ -947,6 +948,7 @@ TSharedRef<SHeaderRow> SQuestTableEditor::BuildHeaderRow()
 			.DefaultLabel(Col.DisplayName)
 			.ManualWidth(Col.ManualWidth)  // v4.12.5: Fixed pixel width
 			.SortMode(this, &SQuestTableEditor::GetColumnSortMode, Col.ColumnId)
+			.SortPriority(this, &SQuestTableEditor::GetColumnSortPriority, Col.ColumnId)  // v7.8.81: Shift-click adds a secondary sort
 			.OnSort(this, &SQuestTableEditor::OnColumnSortModeChanged)
 			.HeaderContent()
 			[
@@ -1021,7 +1023,7 @@ TSharedRef<SWidget> SQuestTableEditor::BuildColumnHeaderContent(const FQuestTabl
 						{
 							FQuestColumnFilterState* S = ColumnFilters.Find(ColumnId);
 							if (S) S->SelectedValues.Empty();
-							ApplyFilters();
+							RefilterRows();
 							return FReply::Handled();
 						})
 					]
@@ -1041,7 +1043,7 @@ TSharedRef<SWidget> SQuestTableEditor::BuildColumnHeaderContent(const FQuestTabl
 								S->SelectedValues.Empty();
 								S->SelectedValues.Add(TEXT("__NONE_SELECTED__"));
 							}
-							ApplyFilters();
+							RefilterRows();
 							return FReply::Handled();
 						})
 					]
@@ -1310,7 +1312,7 @@ TSharedRef<ITableRow> SQuestTableEditor::OnGenerateRow(TSharedPtr<FQuestTableRow
 {
 	return SNew(SQuestTableRow, OwnerTable)
 		.RowData(Item)
-		.OnRowModified(FSimpleDelegate::CreateSP(this, &SQuestTableEditor::OnRowModified));
+		.OnRowModified(FSimpleDelegate::CreateSP(this, &SQuestTableEditor::OnRowEdited, Item));
 }
 
 void SQuestTableEditor::OnSelectionChanged(TSharedPtr<FQuestTableRowEx> Item, ESelectInfo::Type SelectInfo)
@@ -1320,17 +1322,17 @@ void SQuestTableEditor::OnSelectionChanged(TSharedPtr<FQuestTableRowEx> Item, ES
 
 EColumnSortMode::Type SQuestTableEditor::GetColumnSortMode(FName ColumnId) const
 {
-	if (SortColumn == ColumnId)
-	{
-		return SortMode;
-	}
-	return EColumnSortMode::None;
+	return TableEditorSort::GetSortMode(SortColumns, ColumnId);
+}
+
+EColumnSortPriority::Type SQuestTableEditor::GetColumnSortPriority(FName ColumnId) const
+{
+	return TableEditorSort::GetSortPriority(SortColumns, ColumnId);
 }
 
 void SQuestTableEditor::OnColumnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type InSortMode)
 {
-	SortColumn = ColumnId;
-	SortMode = InSortMode;
+	TableEditorSort::SetSortColumn(SortColumns, Priority, ColumnId, InSortMode);
 	ApplySorting();
 }
 
@@ -1339,7 +1341,7 @@ void SQuestTableEditor::OnColumnTextFilterChanged(FName ColumnId, const FText& N
 	if (FQuestColumnFilterState* State = ColumnFilters.Find(ColumnId))
 	{
 		State->TextFilter = NewText.ToString();
-		ApplyFilters();
+		RefilterRows();
 	}
 }
 
@@ -1397,23 +1399,21 @@ void SQuestTableEditor::OnColumnDropdownFilterChanged(FName ColumnId, const FStr
 		State->SelectedValues.Empty();
 	}
 
-	ApplyFilters();
+	RefilterRows();
 }
 
 TArray<FString> SQuestTableEditor::GetUniqueColumnValues(FName ColumnId) const
 {
 	// Filter dropdowns show values from the current table data (AllRows)
-	TSet<FString> UniqueSet;
+	// v7.8.80: Distinct values come from the column index
+	TArray<FString> ColumnValues;
+	ColumnIndex.GetDistinctValues(AllRows, ColumnId, ColumnValues);
 
-	for (const TSharedPtr<FQuestTableRowEx>& Row : AllRows)
+	TSet<FString> UniqueSet;
+	for (const FString& Value : ColumnValues)
 	{
-		FString Value = GetColumnValue(Row, ColumnId);
 		// Empty cells become "(None)" for display consistency
-		if (Value.IsEmpty())
-		{
-			Value = TEXT("(None)");
-		}
-		UniqueSet.Add(Value);
+		UniqueSet.Add(Value.IsEmpty() ? FString(TEXT("(None)")) : Value);
 	}
 
 	TArray<FString> Result = UniqueSet.Array();
@@ -1428,7 +1428,7 @@ FReply SQuestTableEditor::OnClearFiltersClicked()
 		Pair.Value.TextFilter.Empty();
 		Pair.Value.SelectedValues.Empty();
 	}
-	ApplyFilters();
+	RefilterRows();
 	return FReply::Handled();
 }
 
@@ -1456,46 +1456,38 @@ FString SQuestTableEditor::GetColumnValue(const TSharedPtr<FQuestTableRowEx>& Ro
 
 void SQuestTableEditor::ApplyFilters()
 {
-	DisplayedRows.Empty();
+	ColumnIndex.Invalidate();
+	RefilterRows();
+}
+
+void SQuestTableEditor::RefilterRows()
+{
+	// v7.8.80: Each distinct column value is tested once; rows are narrowed through the column index
+	ColumnIndex.BeginFilter(AllRows);
 
-	for (const TSharedPtr<FQuestTableRowEx>& Row : AllRows)
+	for (const auto& Pair : ColumnFilters)
 	{
-		bool bPassesFilter = true;
+		const FQuestColumnFilterState& State = Pair.Value;
 
-		for (const auto& Pair : ColumnFilters)
+		// Check text filter
+		if (!State.TextFilter.IsEmpty())
 		{
-			const FQuestColumnFilterState& State = Pair.Value;
-			FString Value = GetColumnValue(Row, Pair.Key);
-
-			// Check text filter
-			if (!State.TextFilter.IsEmpty())
-			{
-				if (!Value.Contains(State.TextFilter))
-				{
-					bPassesFilter = false;
-					break;
-				}
-			}
-
-			// Check dropdown filter (SelectedValues)
-			if (State.SelectedValues.Num() > 0 && !State.SelectedValues.Contains(TEXT("__NONE_SELECTED__")))
-			{
-				// Normalize empty values to "(None)" for consistency with GetUniqueColumnValues
-				FString NormalizedValue = Value.IsEmpty() ? TEXT("(None)") : Value;
-				if (!State.SelectedValues.Contains(NormalizedValue))
-				{
-					bPassesFilter = false;
-					break;
-				}
-			}
+			ColumnIndex.MatchText(Pair.Key, State.TextFilter);
 		}
 
-		if (bPassesFilter)
+		// Check dropdown filter (SelectedValues)
+		if (State.SelectedValues.Num() > 0 && !State.SelectedValues.Contains(TEXT("__NONE_SELECTED__")))
 		{
-			DisplayedRows.Add(Row);
+			ColumnIndex.MatchValues(Pair.Key, [&State](const FString& Value)
+			{
+				// Normalize empty values to "(None)" for consistency with GetUniqueColumnValues
+				return State.SelectedValues.Contains(Value.IsEmpty() ? FString(TEXT("(None)")) : Value);
+			});
 		}
 	}
 
+	ColumnIndex.GetMatchingRows(DisplayedRows);
+
 	ApplySorting();
 
 	if (ListView.IsValid())
@@ -1507,42 +1499,49 @@ void SQuestTableEditor::ApplyFilters()
 
 void SQuestTableEditor::ApplySorting()
 {
-	if (SortColumn.IsNone() || SortMode == EColumnSortMode::None)
+	if (SortColumns.Num() == 0)
 	{
 		ApplyQuestGrouping();
 		return;
 	}
 
-	DisplayedRows.Sort([this](const TSharedPtr<FQuestTableRowEx>& A, const TSharedPtr<FQuestTableRowEx>& B) {
-		FString ValueA = GetColumnValue(A, SortColumn);
-		FString ValueB = GetColumnValue(B, SortColumn);
+	// v7.8.81: Keys are extracted once per row; the sort compares typed keys only
+	TableEditorSort::SortRows<FQuestTableRowEx>(DisplayedRows, SortColumns,
+		[this](const TSharedPtr<FQuestTableRowEx>& Row, FName ColumnId) { return GetSortKey(Row, ColumnId); });
+}
 
-		if (SortMode == EColumnSortMode::Ascending)
-		{
-			return ValueA < ValueB;
-		}
-		return ValueA > ValueB;
-	});
+FTableSortKey SQuestTableEditor::GetSortKey(const TSharedPtr<FQuestTableRowEx>& Row, FName ColumnId) const
+{
+	if (!Row.IsValid() || !Row->Data.IsValid()) return FTableSortKey();
+
+	// Enums - declaration order
+	if (ColumnId == TEXT("Status")) return FTableSortKey::FromEnum(Row->Data->Status);
+	if (ColumnId == TEXT("StateType")) return FTableSortKey::FromEnum(Row->Data->StateType);
+
+	return FTableSortKey::FromText(GetColumnValue(Row, ColumnId));
 }
 
 void SQuestTableEditor::ApplyQuestGrouping()
 {
 	// Sort by quest name, then by state (to group quest states together)
-	DisplayedRows.Sort([](const TSharedPtr<FQuestTableRowEx>& A, const TSharedPtr<FQuestTableRowEx>& B) {
-		if (!A->Data.IsValid() || !B->Data.IsValid()) return false;
+	static const FName StartStateFirst(TEXT("StartStateFirst"));
+	const FTableSortColumn Grouping[] = {
+		{ FName(TEXT("QuestName")), EColumnSortMode::Ascending },
+		{ StartStateFirst, EColumnSortMode::Ascending },
+		{ FName(TEXT("StateID")), EColumnSortMode::Ascending }
+	};
 
-		if (A->Data->QuestName != B->Data->QuestName)
+	TableEditorSort::SortRows<FQuestTableRowEx>(DisplayedRows, Grouping,
+		[this](const TSharedPtr<FQuestTableRowEx>& Row, FName ColumnId)
 		{
-			return A->Data->QuestName < B->Data->QuestName;
-		}
-
-		// Put Start state first
-		bool AIsStart = A->Data->StateID.Equals(TEXT("Start"), ESearchCase::IgnoreCase);
-		bool BIsStart = B->Data->StateID.Equals(TEXT("Start"), ESearchCase::IgnoreCase);
-		if (AIsStart != BIsStart) return AIsStart;
-
-		return A->Data->StateID < B->Data->StateID;
-	});
+			// Put Start state first
+			if (ColumnId == StartStateFirst)
+			{
+				const bool bIsStart = Row.IsValid() && Row->Data.IsValid() && Row->Data->StateID.Equals(TEXT("Start"), ESearchCase::IgnoreCase);
+				return FTableSortKey::FromNumber(bIsStart ? 0 : 1);
+			}
+			return GetSortKey(Row, ColumnId);
+		});
 }
 
 FReply SQuestTableEditor::OnAddRowClicked()
@@ -2310,6 +2309,12 @@ void SQuestTableEditor::MarkDirty()
 	OnDirtyStateChanged.ExecuteIfBound();
 }
 
+void SQuestTableEditor::OnRowEdited(TSharedPtr<FQuestTableRowEx> Row)
+{
+	ColumnIndex.InvalidateRow(Row);
+	OnRowModified();
+}
+
 void SQuestTableEditor::OnRowModified()
 {
 	MarkDirty();
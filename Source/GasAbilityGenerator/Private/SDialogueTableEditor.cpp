@@ -1637,6 +1637,7 @@ void SDialogueTableEditor::Construct(const FArguments& InArgs)
 	TableData = InArgs._TableData;
 	OnDirtyStateChanged = InArgs._OnDirtyStateChanged;  // v4.6: Store delegate
 	TransactionStack = MakeShared<FTableEditorTransactionStack>(50);  // v7.2: Initialize undo/redo stack
+	ColumnIndex.SetValueGetter([this](const TSharedPtr<FDialogueTableRowEx>& Row, FName ColumnId) { return GetColumnValue(*Row, ColumnId); });
 	SyncFromTableData();
 	InitializeColumnFilters();
 	UpdateColumnFilterOptions();
@@ -2080,7 +2081,7 @@ TSharedRef<SWidget> SDialogueTableEditor::BuildColumnHeaderContent(const FDialog
 								.OnClicked_Lambda([this, ColumnId, State]()
 								{
 									State->SelectedValues.Empty();
-									ApplyFilters();
+									RefilterRows();
 									return FReply::Handled();
 								})
 								.ButtonStyle(FAppStyle::Get(), "SimpleButton")
@@ -2096,7 +2097,7 @@ TSharedRef<SWidget> SDialogueTableEditor::BuildColumnHeaderContent(const FDialog
 									// Select all options (which will filter to nothing if all are selected)
 									// Actually, we want "None" to mean clear selection = show all
 									State->SelectedValues.Empty();
-									ApplyFilters();
+									RefilterRows();
 									return FReply::Handled();
 								})
 								.ButtonStyle(FAppStyle::Get(), "SimpleButton")
@@ -2141,7 +2142,7 @@ TSharedRef<SWidget> SDialogueTableEditor::BuildColumnHeaderContent(const FDialog
 											State->SelectedValues.Add(TEXT("__NONE_SELECTED__"));
 										}
 									}
-									ApplyFilters();
+									RefilterRows();
 								})
 								[
 									SNew(STextBlock)
@@ -2197,6 +2198,7 @@ TSharedRef<SHeaderRow> SDialogueTableEditor::BuildHeaderRow()
 				.DefaultLabel(Col.DisplayName)
 				.ManualWidth(Col.ManualWidth)  // v4.12.5: Fixed pixel width
 				.SortMode(this, &SDialogueTableEditor::GetColumnSortMode, Col.ColumnId)
+				.SortPriority(this, &SDialogueTableEditor::GetColumnSortPriority, Col.ColumnId)  // v7.8.81: Shift-click adds a secondary sort
 				.OnSort(this, &SDialogueTableEditor::OnColumnSortModeChanged)
 				.HeaderContent()
 				[
@@ -2379,7 +2381,7 @@ TSharedRef<ITableRow> SDialogueTableEditor::OnGenerateRow(TSharedPtr<FDialogueTa
 {
 	return SNew(SDialogueTableRow, OwnerTable)
 		.RowData(Item)
-		.OnRowModified(FSimpleDelegate::CreateSP(this, &SDialogueTableEditor::OnRowModified));
+		.OnRowModified(FSimpleDelegate::CreateSP(this, &SDialogueTableEditor::OnRowEdited, Item));
 }
 
 void SDialogueTableEditor::OnSelectionChanged(TSharedPtr<FDialogueTableRowEx> Item, ESelectInfo::Type SelectInfo)
@@ -2389,19 +2391,26 @@ void SDialogueTableEditor::OnSelectionChanged(TSharedPtr<FDialogueTableRowEx> It
 
 EColumnSortMode::Type SDialogueTableEditor::GetColumnSortMode(FName ColumnId) const
 {
-	return (SortColumn == ColumnId) ? SortMode : EColumnSortMode::None;
+	return TableEditorSort::GetSortMode(SortColumns, ColumnId);
+}
+
+EColumnSortPriority::Type SDialogueTableEditor::GetColumnSortPriority(FName ColumnId) const
+{
+	return TableEditorSort::GetSortPriority(SortColumns, ColumnId);
 }
 
 void SDialogueTableEditor::OnColumnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
 {
-	SortColumn = ColumnId;
-	SortMode = NewSortMode;
+	TableEditorSort::SetSortColumn(SortColumns, Priority, ColumnId, NewSortMode);
 	ApplySorting();
 	RefreshList();
 }
 
 void SDialogueTableEditor::RefreshList()
 {
+	// v7.8.80: Callers refresh after changing rows in place (validation, generation, bulk edit)
+	ColumnIndex.Invalidate();
+
 	if (ListView.IsValid())
 	{
 		ListView->RequestListRefresh();
@@ -2612,11 +2621,14 @@ void SDialogueTableEditor::UpdateColumnFilterOptions()
 		State->DropdownOptions.Empty();
 		State->DropdownOptions.Add(MakeShared<FString>(TEXT(""))); // "(All)" placeholder
 
+		// v7.8.80: Distinct values come from the column index
+		TArray<FString> ColumnValues;
+		ColumnIndex.GetDistinctValues(AllRows, Col.ColumnId, ColumnValues);
+
 		TSet<FString> UniqueValues;
 		bool bHasEmptyValues = false;
-		for (const auto& RowEx : AllRows)
+		for (const FString& Value : ColumnValues)
 		{
-			FString Value = GetColumnValue(*RowEx, Col.ColumnId);
 			if (Value.IsEmpty())
 			{
 				bHasEmptyValues = true;
@@ -2788,7 +2800,7 @@ void SDialogueTableEditor::OnColumnTextFilterChanged(FName ColumnId, const FText
 	if (State)
 	{
 		State->TextFilter = NewText.ToString();
-		ApplyFilters();
+		RefilterRows();
 	}
 }
 
@@ -2800,39 +2812,37 @@ void SDialogueTableEditor::OnColumnDropdownFilterChanged(FName ColumnId, TShared
 	{
 		State->SelectedValues.Empty();
 		State->SelectedValues.Add(*NewValue);
-		ApplyFilters();
+		RefilterRows();
 	}
 }
 
 void SDialogueTableEditor::ApplyFilters()
 {
-	DisplayedRows.Empty();
+	ColumnIndex.Invalidate();
+	RefilterRows();
+}
 
-	for (TSharedPtr<FDialogueTableRowEx>& RowEx : AllRows)
+void SDialogueTableEditor::RefilterRows()
+{
+	// v7.8.80: Each distinct column value is tested once; rows are narrowed through the column index
+	ColumnIndex.BeginFilter(AllRows);
+
+	for (const auto& FilterPair : ColumnFilters)
 	{
-		bool bPassesAllFilters = true;
+		const FName& ColumnId = FilterPair.Key;
+		const FColumnFilterState& FilterState = FilterPair.Value;
 
-		for (const auto& FilterPair : ColumnFilters)
+		// Text filter
+		if (!FilterState.TextFilter.IsEmpty())
 		{
-			const FName& ColumnId = FilterPair.Key;
-			const FColumnFilterState& FilterState = FilterPair.Value;
-
-			FString ColumnValue = GetColumnValue(*RowEx, ColumnId);
-
-			// Text filter
-			if (!FilterState.TextFilter.IsEmpty())
-			{
-				if (!ColumnValue.ToLower().Contains(FilterState.TextFilter.ToLower()))
-				{
-					bPassesAllFilters = false;
-					break;
-				}
-			}
+			ColumnIndex.MatchText(ColumnId, FilterState.TextFilter);
+		}
 
-			// Multi-select dropdown filter (empty = all pass, otherwise OR logic)
-			if (FilterState.SelectedValues.Num() > 0)
+		// Multi-select dropdown filter (empty = all pass, otherwise OR logic)
+		if (FilterState.SelectedValues.Num() > 0)
+		{
+			ColumnIndex.MatchValues(ColumnId, [&FilterState](const FString& ColumnValue)
 			{
-				bool bMatchesAny = false;
 				for (const FString& SelectedValue : FilterState.SelectedValues)
 				{
 					// Special handling for "(Empty)" filter
@@ -2840,131 +2850,68 @@ void SDialogueTableEditor::ApplyFilters()
 					{
 						if (ColumnValue.IsEmpty())
 						{
-							bMatchesAny = true;
-							break;
+							return true;
 						}
 					}
 					else if (ColumnValue == SelectedValue)
 					{
-						bMatchesAny = true;
-						break;
+						return true;
 					}
 				}
-				if (!bMatchesAny)
-				{
-					bPassesAllFilters = false;
-					break;
-				}
-			}
-		}
-
-		if (bPassesAllFilters)
-		{
-			DisplayedRows.Add(RowEx);
+				return false;
+			});
 		}
 	}
 
+	ColumnIndex.GetMatchingRows(DisplayedRows);
+
 	ApplySorting();
-	RefreshList();
+
+	// Not RefreshList() - that also drops the column index
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+	UpdateStatusBar();
 }
 
 void SDialogueTableEditor::ApplySorting()
 {
-	if (SortColumn == NAME_None || SortMode == EColumnSortMode::None)
-	{
-		return;
-	}
+	// v7.8.81: Keys are extracted once per row; the sort compares typed keys only
+	TableEditorSort::SortRows<FDialogueTableRowEx>(DisplayedRows, SortColumns,
+		[this](const TSharedPtr<FDialogueTableRowEx>& RowEx, FName ColumnId) { return GetSortKey(*RowEx, ColumnId); });
+}
 
-	bool bAscending = (SortMode == EColumnSortMode::Ascending);
+FTableSortKey SDialogueTableEditor::GetSortKey(const FDialogueTableRowEx& RowEx, FName ColumnId) const
+{
+	// Seq - tree traversal order, not "1.10" before "1.2"
+	if (ColumnId == TEXT("Seq")) return FTableSortKey::FromNumber(RowEx.Sequence);
 
-	DisplayedRows.Sort([this, bAscending](const TSharedPtr<FDialogueTableRowEx>& A, const TSharedPtr<FDialogueTableRowEx>& B)
+	if (RowEx.Data.IsValid())
 	{
-		FString ValueA = GetColumnValue(*A, SortColumn);
-		FString ValueB = GetColumnValue(*B, SortColumn);
-		return bAscending ? (ValueA < ValueB) : (ValueA > ValueB);
-	});
+		if (ColumnId == TEXT("Status")) return FTableSortKey::FromEnum(RowEx.Data->Status);
+		if (ColumnId == TEXT("NodeType")) return FTableSortKey::FromEnum(RowEx.Data->NodeType);
+		if (ColumnId == TEXT("Skippable")) return FTableSortKey::FromNumber(RowEx.Data->bSkippable);
+	}
+
+	return FTableSortKey::FromText(GetColumnValue(RowEx, ColumnId));
 }
 
 void SDialogueTableEditor::ApplyFlowOrder()
 {
 	// Reset sort state
-	SortColumn = NAME_None;
-	SortMode = EColumnSortMode::None;
+	SortColumns.Reset();
 
 	// First apply filters to get the filtered set
-	DisplayedRows.Empty();
-	for (TSharedPtr<FDialogueTableRowEx>& RowEx : AllRows)
-	{
-		bool bPassesAllFilters = true;
-
-		for (const auto& FilterPair : ColumnFilters)
-		{
-			const FName& ColumnId = FilterPair.Key;
-			const FColumnFilterState& FilterState = FilterPair.Value;
-
-			FString ColumnValue = GetColumnValue(*RowEx, ColumnId);
-
-			// Text filter
-			if (!FilterState.TextFilter.IsEmpty())
-			{
-				if (!ColumnValue.ToLower().Contains(FilterState.TextFilter.ToLower()))
-				{
-					bPassesAllFilters = false;
-					break;
-				}
-			}
-
-			// Multi-select dropdown filter (empty = all pass, otherwise OR logic)
-			if (FilterState.SelectedValues.Num() > 0)
-			{
-				bool bMatchesAny = false;
-				for (const FString& SelectedValue : FilterState.SelectedValues)
-				{
-					// Special handling for "(Empty)" filter
-					if (SelectedValue == TEXT("(Empty)"))
-					{
-						if (ColumnValue.IsEmpty())
-						{
-							bMatchesAny = true;
-							break;
-						}
-					}
-					else if (ColumnValue == SelectedValue)
-					{
-						bMatchesAny = true;
-						break;
-					}
-				}
-				if (!bMatchesAny)
-				{
-					bPassesAllFilters = false;
-					break;
-				}
-			}
-		}
-
-		if (bPassesAllFilters)
-		{
-			DisplayedRows.Add(RowEx);
-		}
-	}
+	ApplyFilters();
 
 	// Then sort by DialogueID first, then by Sequence (flow order)
-	DisplayedRows.Sort([](const TSharedPtr<FDialogueTableRowEx>& A, const TSharedPtr<FDialogueTableRowEx>& B)
-	{
-		if (!A->Data.IsValid() || !B->Data.IsValid()) return false;
-
-		// First by DialogueID
-		FString DialogueA = A->Data->DialogueID.ToString();
-		FString DialogueB = B->Data->DialogueID.ToString();
-		if (DialogueA != DialogueB)
-		{
-			return DialogueA < DialogueB;
-		}
-
-		// Then by Sequence (tree traversal order)
-		return A->Sequence < B->Sequence;
-	});
+	const FTableSortColumn FlowOrder[] = {
+		{ FName(TEXT("DialogueID")), EColumnSortMode::Ascending },
+		{ FName(TEXT("Seq")), EColumnSortMode::Ascending }
+	};
+	TableEditorSort::SortRows<FDialogueTableRowEx>(DisplayedRows, FlowOrder,
+		[this](const TSharedPtr<FDialogueTableRowEx>& RowEx, FName ColumnId) { return GetSortKey(*RowEx, ColumnId); });
 
 	RefreshList();
 }
@@ -2987,9 +2934,16 @@ void SDialogueTableEditor::MarkDirty()
 	}
 }
 
+void SDialogueTableEditor::OnRowEdited(TSharedPtr<FDialogueTableRowEx> Row)
+{
+	ColumnIndex.InvalidateRow(Row);
+	OnRowModified();
+}
+
 void SDialogueTableEditor::OnRowModified()
 {
 	CalculateSequences();
+	ColumnIndex.InvalidateColumn(TEXT("Seq"));  // v7.8.80: Sequence numbers depend on the other rows
 	UpdateColumnFilterOptions();
 	MarkDirty();
 }
@@ -4286,6 +4240,7 @@ FReply SDialogueTableEditor::OnSyncFromAssetsClicked()
 	// Recalculate sequences and refresh
 	CalculateSequences();
 	SyncToTableData();
+	ColumnIndex.Invalidate();  // v7.8.80: Existing rows were updated in place
 	UpdateColumnFilterOptions();
 	ApplyFilters();
 	RefreshList();
@@ -16,6 +16,8 @@
 #include "DialogueTableEditorTypes.h"
 #include "XLSXSupport/DialogueTokenRegistry.h"
 #include "TableEditorTransaction.h"  // v7.2: Undo/Redo support
+#include "TableEditorColumnIndex.h"  // v7.8.80: Cached filter lookups
+#include "TableEditorSort.h"  // v7.8.81: Typed multi-column sorting
 
 class SEditableText;
 class SSearchBox;
@@ -148,9 +150,9 @@ private:
 	TSharedPtr<SListView<TSharedPtr<FDialogueTableRowEx>>> ListView;
 	TSharedPtr<SHeaderRow> HeaderRow;
 
-	FName SortColumn;
-	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+	TArray<FTableSortColumn> SortColumns;  // v7.8.81: Sort levels, primary first
 	TMap<FName, FColumnFilterState> ColumnFilters;  // Per-column filter state
+	TTableColumnIndex<FDialogueTableRowEx> ColumnIndex;  // v7.8.80: Cached column values behind filters and dropdowns
 
 	// UI Construction
 	TSharedRef<SWidget> BuildToolbar();
@@ -169,6 +171,7 @@ private:
 	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FDialogueTableRowEx> Item, const TSharedRef<STableViewBase>& OwnerTable);
 	void OnSelectionChanged(TSharedPtr<FDialogueTableRowEx> Item, ESelectInfo::Type SelectInfo);
 	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+	EColumnSortPriority::Type GetColumnSortPriority(FName ColumnId) const;
 	void OnColumnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
 
 	// Actions
@@ -188,7 +191,8 @@ private:
 	FReply OnSaveClicked();  // v4.12.3: Save table data
 
 	// Filtering & Sorting
-	void ApplyFilters();
+	void ApplyFilters();  // Row data may have changed - re-reads cached columns
+	void RefilterRows();  // v7.8.80: Filter edit only - uses the column index as is
 	void ApplySorting();
 	void ApplyFlowOrder();  // Sort by dialogue flow
 	void InitializeColumnFilters();
@@ -196,6 +200,7 @@ private:
 	void OnColumnTextFilterChanged(FName ColumnId, const FText& NewText);
 	void OnColumnDropdownFilterChanged(FName ColumnId, TSharedPtr<FString> NewValue, ESelectInfo::Type SelectInfo);
 	FString GetColumnValue(const FDialogueTableRowEx& Row, FName ColumnId) const;
+	FTableSortKey GetSortKey(const FDialogueTableRowEx& Row, FName ColumnId) const;  // v7.8.81: Typed sort key
 	TSharedRef<SWidget> BuildColumnHeaderContent(const FDialogueTableColumn& Col);
 
 	// Sequence/Depth Calculation
@@ -207,6 +212,7 @@ private:
 	void SyncToTableData();
 	void MarkDirty();
 	void OnRowModified();
+	void OnRowEdited(TSharedPtr<FDialogueTableRowEx> Row);  // v7.8.80: Re-reads only that row in the column index
 
 	/** v4.6: Delegate for notifying owner of dirty state changes */
 	FOnDialogueTableDirtyStateChanged OnDirtyStateChanged;
@@ -1,5 +1,6 @@
 // GasAbilityGenerator - Dialogue Token Registry Implementation
 // v4.4: Validated token system for Excel dialogue authoring
+// v7.8.77: Hash-indexed lookups
 
 #include "XLSXSupport/DialogueTokenRegistry.h"
 #include "UObject/UObjectGlobals.h"
@@ -11,6 +12,20 @@
 // Static empty set for invalid lookups
 TSet<FString> FDialogueTokenRegistry::EmptySet;
 
+namespace DialogueTokenLookup
+{
+	// v7.8.77: Lookup key for a user-supplied name. FNAME_Find never grows the name table, and a name
+	// that was never registered anywhere cannot match a spec, so NAME_None is a safe miss.
+	static FName FindKey(const FString& Name)
+	{
+		if (Name.IsEmpty() || Name.Len() >= NAME_SIZE)
+		{
+			return NAME_None;
+		}
+		return FName(*Name, FNAME_Find);
+	}
+}
+
 FDialogueTokenRegistry& FDialogueTokenRegistry::Get()
 {
 	static FDialogueTokenRegistry Instance;
@@ -24,16 +39,25 @@ FDialogueTokenRegistry::FDialogueTokenRegistry()
 
 void FDialogueTokenRegistry::RegisterTokenSpec(const FDialogueTokenSpec& Spec)
 {
-	// Check for duplicate
-	for (const auto& Existing : Specs)
+	// Check for duplicate (FName compares case-insensitively)
+	const FName TokenKey(*Spec.TokenName);
+	if (TokenNameIndex.Contains(TokenKey))
 	{
-		if (Existing.TokenName.Equals(Spec.TokenName, ESearchCase::IgnoreCase))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("DialogueTokenRegistry: Token '%s' already registered, skipping"), *Spec.TokenName);
-			return;
-		}
+		UE_LOG(LogTemp, Warning, TEXT("DialogueTokenRegistry: Token '%s' already registered, skipping"), *Spec.TokenName);
+		return;
 	}
-	Specs.Add(Spec);
+
+	const int32 SpecIndex = Specs.Add(Spec);
+	TokenNameIndex.Add(TokenKey, SpecIndex);
+	if (!Spec.UEClassName.IsEmpty())
+	{
+		// Keep the first spec for a shared class name - the order the linear scan used to resolve
+		ClassNameIndex.FindOrAdd(FName(*Spec.UEClassName), SpecIndex);
+	}
+
+	// A new spec can turn a cached miss into a hit
+	FScopeLock ScopeLock(&ClassResolutionLock);
+	ClassResolutionCache.Reset();
 }
 
 void FDialogueTokenRegistry::RegisterBuiltInTokens()
@@ -860,40 +884,51 @@ bool FDialogueTokenSpec::MatchesClass(UClass* Class) const
 
 const FDialogueTokenSpec* FDialogueTokenRegistry::FindByTokenName(const FString& TokenName) const
 {
-	for (const auto& Spec : Specs)
-	{
-		if (Spec.TokenName.Equals(TokenName, ESearchCase::IgnoreCase))
-		{
-			return &Spec;
-		}
-	}
-	return nullptr;
+	const int32* SpecIndex = TokenNameIndex.Find(DialogueTokenLookup::FindKey(TokenName));
+	return SpecIndex ? &Specs[*SpecIndex] : nullptr;
 }
 
 const FDialogueTokenSpec* FDialogueTokenRegistry::FindByClass(UClass* Class) const
 {
 	if (!Class) return nullptr;
 
-	for (const auto& Spec : Specs)
+	// v7.8.77: Resolve each class once - serialization asks for the same few classes on every row
+	const TObjectKey<UClass> ClassKey(Class);
 	{
-		if (Spec.MatchesClass(Class))
+		FScopeLock ScopeLock(&ClassResolutionLock);
+		if (const int32* Cached = ClassResolutionCache.Find(ClassKey))
 		{
-			return &Spec;
+			return *Cached != INDEX_NONE ? &Specs[*Cached] : nullptr;
 		}
 	}
-	return nullptr;
-}
 
-const FDialogueTokenSpec* FDialogueTokenRegistry::FindByClassName(const FString& ClassName) const
-{
-	for (const auto& Spec : Specs)
+	// Same rules as FDialogueTokenSpec::MatchesClass: exact class name, or the name minus the Blueprint _C suffix
+	const FString ClassName = Class->GetName();
+	int32 SpecIndex = FindSpecIndexByClassName(ClassName);
+	if (ClassName.EndsWith(TEXT("_C"), ESearchCase::IgnoreCase))
 	{
-		if (Spec.UEClassName.Equals(ClassName, ESearchCase::IgnoreCase))
+		const int32 BaseIndex = FindSpecIndexByClassName(ClassName.LeftChop(2));
+		if (BaseIndex != INDEX_NONE && (SpecIndex == INDEX_NONE || BaseIndex < SpecIndex))
 		{
-			return &Spec;
+			SpecIndex = BaseIndex;
 		}
 	}
-	return nullptr;
+
+	FScopeLock ScopeLock(&ClassResolutionLock);
+	ClassResolutionCache.Add(ClassKey, SpecIndex);
+	return SpecIndex != INDEX_NONE ? &Specs[SpecIndex] : nullptr;
+}
+
+const FDialogueTokenSpec* FDialogueTokenRegistry::FindByClassName(const FString& ClassName) const
+{
+	const int32 SpecIndex = FindSpecIndexByClassName(ClassName);
+	return SpecIndex != INDEX_NONE ? &Specs[SpecIndex] : nullptr;
+}
+
+int32 FDialogueTokenRegistry::FindSpecIndexByClassName(const FString& ClassName) const
+{
+	const int32* SpecIndex = ClassNameIndex.Find(DialogueTokenLookup::FindKey(ClassName));
+	return SpecIndex ? *SpecIndex : INDEX_NONE;
 }
 
 // ============================================
@@ -1072,11 +1107,12 @@ bool FDialogueTokenRegistry::ValidateToken(const FParsedToken& Token, const FDia
 	// Validate parameter types
 	for (const auto& Pair : Token.Params)
 	{
-		// Find matching param def
+		// Find matching param def (v7.8.77: FName compare - case-insensitive, no string building)
+		const FName ParamKey = DialogueTokenLookup::FindKey(Pair.Key);
 		const FDialogueTokenParam* ParamDef = nullptr;
 		for (const auto& P : Spec.Params)
 		{
-			if (P.ParamName.ToString().Equals(Pair.Key, ESearchCase::IgnoreCase))
+			if (P.ParamName == ParamKey)
 			{
 				ParamDef = &P;
 				break;
@@ -1,15 +1,10 @@
 // GasAbilityGenerator - Dialogue XLSX Reader Implementation
 // v4.4: Import dialogue table from Excel format with token support
+// v7.8.78: Streamed through FXLSXStreamReader
 
 #include "XLSXSupport/DialogueXLSXReader.h"
 #include "XLSXSupport/DialogueTokenRegistry.h"
-#include "HAL/PlatformFileManager.h"
-#include "Misc/FileHelper.h"
-#include "XmlFile.h"
-
-#if WITH_EDITOR
-#include "FileUtilities/ZipArchiveReader.h"
-#endif
+#include "XLSXSupport/XLSXStreamReader.h"
 
 const FString FDialogueXLSXReader::EXPECTED_SENTINEL = TEXT("#DIALOGUE_SHEET_V1");
 
@@ -18,32 +13,30 @@ FDialogueXLSXImportResult FDialogueXLSXReader::ImportFromXLSX(const FString& Fil
 	FDialogueXLSXImportResult Result;
 
 #if WITH_EDITOR
-	// Extract ZIP contents
-	TMap<FString, TArray<uint8>> ZipContents;
-	if (!ExtractZipContents(FilePath, ZipContents, Result.ErrorMessage))
+	// Open the workbook (zip directory + shared strings; sheets are inflated one at a time)
+	FXLSXStreamReader Workbook;
+	if (!Workbook.Open(FilePath, Result.ErrorMessage))
 	{
 		return Result;
 	}
 
 	// Find the dialogues sheet (sheet1.xml)
-	TArray<uint8>* Sheet1Data = ZipContents.Find(TEXT("xl/worksheets/sheet1.xml"));
-	if (!Sheet1Data)
+	if (!Workbook.HasEntry(TEXT("xl/worksheets/sheet1.xml")))
 	{
 		Result.ErrorMessage = TEXT("Could not find dialogues sheet (xl/worksheets/sheet1.xml)");
 		return Result;
 	}
 
 	// Parse dialogues
-	if (!ParseDialoguesSheet(*Sheet1Data, Result.Rows, Result.ErrorMessage))
+	if (!ParseDialoguesSheet(Workbook, Result.Rows, Result.ErrorMessage))
 	{
 		return Result;
 	}
 
 	// Parse metadata if available
-	TArray<uint8>* Sheet3Data = ZipContents.Find(TEXT("xl/worksheets/sheet3.xml"));
-	if (Sheet3Data)
+	if (Workbook.HasEntry(TEXT("xl/worksheets/sheet3.xml")))
 	{
-		ParseMetaSheet(*Sheet3Data, Result);
+		ParseMetaSheet(Workbook, Result);
 	}
 
 	Result.bSuccess = true;
@@ -54,72 +47,47 @@ FDialogueXLSXImportResult FDialogueXLSXReader::ImportFromXLSX(const FString& Fil
 	return Result;
 }
 
-#if WITH_EDITOR
-bool FDialogueXLSXReader::ExtractZipContents(const FString& FilePath, TMap<FString, TArray<uint8>>& OutFiles, FString& OutError)
+bool FDialogueXLSXReader::ParseDialoguesSheet(const FXLSXStreamReader& Workbook, TArray<FDialogueTableRow>& OutRows, FString& OutError)
 {
-	IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath);
-	if (!FileHandle)
-	{
-		OutError = FString::Printf(TEXT("Could not open file: %s"), *FilePath);
-		return false;
-	}
+	TMap<FString, int32> ColumnMap;
+	bool bSentinelRead = false;
+	bool bSentinelInvalid = false;
+	int32 LastRowNumber = 0;
 
-	FZipArchiveReader ZipReader(FileHandle);
-	if (!ZipReader.IsValid())
+	const bool bRead = Workbook.ReadSheet(TEXT("xl/worksheets/sheet1.xml"), [&](int32 RowNumber, const TArray<FString>& RowValues)
 	{
-		OutError = TEXT("Invalid or corrupt XLSX file");
-		return false;
-	}
+		LastRowNumber = FMath::Max(LastRowNumber, RowNumber);
 
-	TArray<FString> FileNames = ZipReader.GetFileNames();
-	for (const FString& FileName : FileNames)
-	{
-		TArray<uint8> FileData;
-		if (ZipReader.TryReadFile(FileName, FileData))
+		// Row 1: Sentinel + Column IDs
+		if (!bSentinelRead)
 		{
-			OutFiles.Add(FileName, MoveTemp(FileData));
-		}
-	}
-
-	return true;
-}
-#endif
-
-bool FDialogueXLSXReader::ParseDialoguesSheet(const TArray<uint8>& XmlData, TArray<FDialogueTableRow>& OutRows, FString& OutError)
-{
-	// Parse to grid
-	TArray<TArray<FString>> Grid = ParseSheetToGrid(XmlData);
-
-	if (Grid.Num() < 3)
-	{
-		OutError = TEXT("Sheet has fewer than 3 rows (need sentinel + headers + data)");
-		return false;
-	}
+			const bool bIsFirstRow = RowNumber == 1 && RowValues.Num() > 0;
+			if (!bIsFirstRow || RowValues[0] != EXPECTED_SENTINEL)
+			{
+				OutError = FString::Printf(TEXT("Invalid sentinel. Expected '%s', got '%s'"),
+					*EXPECTED_SENTINEL, bIsFirstRow ? *RowValues[0] : TEXT("(empty)"));
+				bSentinelInvalid = true;
+				return false;
+			}
 
-	// Row 1: Sentinel + Column IDs
-	const TArray<FString>& SentinelRow = Grid[0];
-	if (SentinelRow.Num() == 0 || SentinelRow[0] != EXPECTED_SENTINEL)
-	{
-		OutError = FString::Printf(TEXT("Invalid sentinel. Expected '%s', got '%s'"),
-			*EXPECTED_SENTINEL, SentinelRow.Num() > 0 ? *SentinelRow[0] : TEXT("(empty)"));
-		return false;
-	}
+			// Build column map from sentinel row (Column ID -> Index)
+			for (int32 i = 0; i < RowValues.Num(); i++)
+			{
+				if (!RowValues[i].IsEmpty())
+				{
+					ColumnMap.Add(RowValues[i], i);
+				}
+			}
+			bSentinelRead = true;
+			return true;
+		}
 
-	// Build column map from sentinel row (Column ID -> Index)
-	TMap<FString, int32> ColumnMap;
-	for (int32 i = 0; i < SentinelRow.Num(); i++)
-	{
-		if (!SentinelRow[i].IsEmpty())
+		// Row 2: Human headers (skip)
+		// Row 3+: Data rows
+		if (RowNumber < 3)
 		{
-			ColumnMap.Add(SentinelRow[i], i);
+			return true;
 		}
-	}
-
-	// Row 2: Human headers (skip)
-	// Row 3+: Data rows
-	for (int32 RowIdx = 2; RowIdx < Grid.Num(); RowIdx++)
-	{
-		const TArray<FString>& RowValues = Grid[RowIdx];
 
 		// Skip empty rows
 		bool bAllEmpty = true;
@@ -131,7 +99,7 @@ bool FDialogueXLSXReader::ParseDialoguesSheet(const TArray<uint8>& XmlData, TArr
 				break;
 			}
 		}
-		if (bAllEmpty) continue;
+		if (bAllEmpty) return true;
 
 		// Parse row
 		FDialogueTableRow DialogueRow = ParseRowFromValues(ColumnMap, RowValues);
@@ -139,194 +107,61 @@ bool FDialogueXLSXReader::ParseDialoguesSheet(const TArray<uint8>& XmlData, TArr
 		// Only add rows with valid DialogueID and NodeID
 		if (!DialogueRow.DialogueID.IsNone() && !DialogueRow.NodeID.IsNone())
 		{
-			OutRows.Add(DialogueRow);
+			OutRows.Add(MoveTemp(DialogueRow));
 		}
-	}
-
-	return true;
-}
-
-bool FDialogueXLSXReader::ParseMetaSheet(const TArray<uint8>& XmlData, FDialogueXLSXImportResult& OutResult)
-{
-	TArray<TArray<FString>> Grid = ParseSheetToGrid(XmlData);
+		return true;
+	}, OutError);
 
-	// Parse key-value pairs (Property in col A, Value in col B)
-	for (int32 i = 1; i < Grid.Num(); i++)  // Skip header row
+	if (!bRead || bSentinelInvalid)
 	{
-		if (Grid[i].Num() >= 2)
-		{
-			const FString& Key = Grid[i][0];
-			const FString& Value = Grid[i][1];
+		return false;
+	}
 
-			if (Key == TEXT("EXPORT_GUID"))
-			{
-				OutResult.ExportGuid = Value;
-			}
-			else if (Key == TEXT("EXPORTED_AT"))
-			{
-				OutResult.ExportedAt = Value;
-			}
-			else if (Key == TEXT("FORMAT_VERSION"))
-			{
-				OutResult.FormatVersion = Value;
-			}
-			else if (Key == TEXT("ROW_COUNT"))
-			{
-				OutResult.OriginalRowCount = FCString::Atoi(*Value);
-			}
-			else if (Key == TEXT("CONTENT_HASH"))
-			{
-				OutResult.ContentHash = FCString::Atoi64(*Value);
-			}
-		}
+	if (LastRowNumber < 3)
+	{
+		OutError = TEXT("Sheet has fewer than 3 rows (need sentinel + headers + data)");
+		return false;
 	}
 
 	return true;
 }
 
-TArray<TArray<FString>> FDialogueXLSXReader::ParseSheetToGrid(const TArray<uint8>& XmlData)
+bool FDialogueXLSXReader::ParseMetaSheet(const FXLSXStreamReader& Workbook, FDialogueXLSXImportResult& OutResult)
 {
-	TArray<TArray<FString>> Grid;
-
-	// Convert to string
-	FString XmlString;
-	FFileHelper::BufferToString(XmlString, XmlData.GetData(), XmlData.Num());
-
-	// Parse XML
-	FXmlFile XmlFile(XmlString, EConstructMethod::ConstructFromBuffer);
-	if (!XmlFile.IsValid())
-	{
-		return Grid;
-	}
-
-	const FXmlNode* RootNode = XmlFile.GetRootNode();
-	if (!RootNode)
-	{
-		return Grid;
-	}
-
-	// Find sheetData node
-	const FXmlNode* SheetDataNode = RootNode->FindChildNode(TEXT("sheetData"));
-	if (!SheetDataNode)
-	{
-		return Grid;
-	}
-
-	// Find max row number
-	int32 MaxRow = 0;
-	int32 MaxCol = 0;
-
-	for (const FXmlNode* RowNode : SheetDataNode->GetChildrenNodes())
+	// Parse key-value pairs (Property in col A, Value in col B)
+	FString Error;
+	return Workbook.ReadSheet(TEXT("xl/worksheets/sheet3.xml"), [&OutResult](int32 RowNumber, const TArray<FString>& Cells)
 	{
-		if (RowNode->GetTag() != TEXT("row")) continue;
-
-		int32 RowNum = FCString::Atoi(*RowNode->GetAttribute(TEXT("r")));
-		MaxRow = FMath::Max(MaxRow, RowNum);
-
-		for (const FXmlNode* CellNode : RowNode->GetChildrenNodes())
+		if (RowNumber < 2 || Cells.Num() == 0)  // Skip header row
 		{
-			if (CellNode->GetTag() != TEXT("c")) continue;
-
-			FString CellRef = CellNode->GetAttribute(TEXT("r"));
-			int32 Col, Row;
-			ParseCellReference(CellRef, Col, Row);
-			MaxCol = FMath::Max(MaxCol, Col + 1);
+			return true;
 		}
-	}
-
-	// Initialize grid
-	Grid.SetNum(MaxRow);
-	for (int32 i = 0; i < MaxRow; i++)
-	{
-		Grid[i].SetNum(MaxCol);
-	}
-
-	// Fill grid with values
-	for (const FXmlNode* RowNode : SheetDataNode->GetChildrenNodes())
-	{
-		if (RowNode->GetTag() != TEXT("row")) continue;
 
-		int32 RowNum = FCString::Atoi(*RowNode->GetAttribute(TEXT("r")));
-		int32 RowIdx = RowNum - 1;  // 0-indexed
+		const FString& Key = Cells[0];
+		const FString Value = Cells.IsValidIndex(1) ? Cells[1] : FString();
 
-		for (const FXmlNode* CellNode : RowNode->GetChildrenNodes())
+		if (Key == TEXT("EXPORT_GUID"))
 		{
-			if (CellNode->GetTag() != TEXT("c")) continue;
-
-			FString CellRef = CellNode->GetAttribute(TEXT("r"));
-			int32 ColIdx, RowFromRef;
-			ParseCellReference(CellRef, ColIdx, RowFromRef);
-
-			// Get cell value
-			FString CellValue;
-			FString CellType = CellNode->GetAttribute(TEXT("t"));
-
-			// Find value node
-			const FXmlNode* ValueNode = CellNode->FindChildNode(TEXT("v"));
-			const FXmlNode* InlineStrNode = CellNode->FindChildNode(TEXT("is"));
-
-			if (InlineStrNode)
-			{
-				// Inline string <is><t>value</t></is>
-				const FXmlNode* TextNode = InlineStrNode->FindChildNode(TEXT("t"));
-				if (TextNode)
-				{
-					CellValue = TextNode->GetContent();
-				}
-			}
-			else if (ValueNode)
-			{
-				CellValue = ValueNode->GetContent();
-			}
-
-			if (RowIdx >= 0 && RowIdx < Grid.Num() && ColIdx >= 0 && ColIdx < Grid[RowIdx].Num())
-			{
-				Grid[RowIdx][ColIdx] = CellValue;
-			}
+			OutResult.ExportGuid = Value;
 		}
-	}
-
-	return Grid;
-}
-
-int32 FDialogueXLSXReader::ColumnLetterToIndex(const FString& Letter)
-{
-	int32 Index = 0;
-	for (int32 i = 0; i < Letter.Len(); i++)
-	{
-		TCHAR Ch = Letter[i];
-		if (Ch >= TEXT('A') && Ch <= TEXT('Z'))
+		else if (Key == TEXT("EXPORTED_AT"))
 		{
-			Index = Index * 26 + (Ch - TEXT('A') + 1);
+			OutResult.ExportedAt = Value;
 		}
-		else if (Ch >= TEXT('a') && Ch <= TEXT('z'))
+		else if (Key == TEXT("FORMAT_VERSION"))
 		{
-			Index = Index * 26 + (Ch - TEXT('a') + 1);
+			OutResult.FormatVersion = Value;
 		}
-	}
-	return Index - 1;  // 0-indexed
-}
-
-void FDialogueXLSXReader::ParseCellReference(const FString& CellRef, int32& OutCol, int32& OutRow)
-{
-	FString ColPart;
-	FString RowPart;
-
-	for (int32 i = 0; i < CellRef.Len(); i++)
-	{
-		TCHAR Ch = CellRef[i];
-		if ((Ch >= TEXT('A') && Ch <= TEXT('Z')) || (Ch >= TEXT('a') && Ch <= TEXT('z')))
+		else if (Key == TEXT("ROW_COUNT"))
 		{
-			ColPart.AppendChar(Ch);
+			OutResult.OriginalRowCount = FCString::Atoi(*Value);
 		}
-		else if (Ch >= TEXT('0') && Ch <= TEXT('9'))
+		else if (Key == TEXT("CONTENT_HASH"))
 		{
-			RowPart.AppendChar(Ch);
+			OutResult.ContentHash = FCString::Atoi64(*Value);
 		}
-	}
-
-	OutCol = ColumnLetterToIndex(ColPart);
-	OutRow = FCString::Atoi(*RowPart);
+		return true;
+	}, Error);
 }
 
 FDialogueTableRow FDialogueXLSXReader::ParseRowFromValues(const TMap<FString, int32>& ColumnMap, const TArray<FString>& Values)
@@ -1,20 +1,15 @@
 // GasAbilityGenerator - Dialogue XLSX Writer Implementation
 // v4.4 Phase 3: Export dialogue table to Excel format with asset sync support
+// v7.8.79: Written through FXLSXStreamWriter (deflate entries, shared string table)
 
 #include "XLSXSupport/DialogueXLSXWriter.h"
 #include "XLSXSupport/DialogueTokenRegistry.h"
 #include "XLSXSupport/DialogueAssetSync.h"
-#include "HAL/PlatformFileManager.h"
-#include "HAL/FileManager.h"
-#include "Misc/FileHelper.h"
+#include "XLSXSupport/XLSXStreamWriter.h"
 #include "Misc/DateTime.h"
 #include "Misc/Guid.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 
-#if WITH_ENGINE
-#include "FileUtilities/ZipArchiveWriter.h"
-#endif
-
 // Static constants
 const FString FDialogueXLSXWriter::SHEET_SENTINEL = TEXT("#DIALOGUE_SHEET_V1");
 const FString FDialogueXLSXWriter::FORMAT_VERSION = TEXT("1.0");
@@ -51,99 +46,42 @@ TArray<FDialogueXLSXColumn> FDialogueXLSXWriter::GetColumnDefinitions()
 
 bool FDialogueXLSXWriter::ExportToXLSX(const TArray<FDialogueTableRow>& Rows, const FString& FilePath, FString& OutError)
 {
-#if WITH_ENGINE
-	// Scan project assets to populate valid IDs for _Lists sheet
-	ScanAssetsForValidIds();
-
-	// Create the output file
-	IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath);
-	if (!FileHandle)
-	{
-		// v4.8.4: Improved error message - file lock is most common cause
-		OutError = FString::Printf(TEXT("Cannot write to file: %s\n\nIf the file is open in Excel, please close it and try again."), *FilePath);
-		return false;
-	}
-
-	// Create ZIP writer with no compression (STORE mode)
-	FZipArchiveWriter ZipWriter(FileHandle, EZipArchiveOptions::None);
-	FDateTime Now = FDateTime::Now();
-
-	// Add all required XLSX files
-	auto AddXmlFile = [&ZipWriter, &Now](const FString& Path, const FString& Content)
-	{
-		TArray<uint8> Data;
-		FTCHARToUTF8 Converter(*Content);
-		Data.Append((const uint8*)Converter.Get(), Converter.Length());
-		ZipWriter.AddFile(Path, Data, Now);
-	};
-
-	// Core XLSX structure
-	AddXmlFile(TEXT("[Content_Types].xml"), GenerateContentTypesXml());
-	AddXmlFile(TEXT("_rels/.rels"), GenerateRelsXml());
-	AddXmlFile(TEXT("xl/workbook.xml"), GenerateWorkbookXml());
-	AddXmlFile(TEXT("xl/_rels/workbook.xml.rels"), GenerateWorkbookRelsXml());
-	AddXmlFile(TEXT("xl/styles.xml"), GenerateStylesXml());
-
-	// Worksheets
-	AddXmlFile(TEXT("xl/worksheets/sheet1.xml"), GenerateDialoguesSheet(Rows));
-	AddXmlFile(TEXT("xl/worksheets/sheet2.xml"), GenerateListsSheet(Rows));
-	AddXmlFile(TEXT("xl/worksheets/sheet3.xml"), GenerateMetaSheet(Rows));
-
-	// ZipWriter destructor will finalize and close the file
-	return true;
-#else
-	OutError = TEXT("XLSX export requires WITH_ENGINE");
-	return false;
-#endif
+	return ExportWorkbook(Rows, FilePath, nullptr, OutError);
 }
 
 bool FDialogueXLSXWriter::ExportToXLSX(const TArray<FDialogueTableRow>& Rows, const FString& FilePath,
 	const FDialogueAssetSyncResult& AssetSync, FString& OutError)
 {
-#if WITH_ENGINE
+	return ExportWorkbook(Rows, FilePath, &AssetSync, OutError);
+}
+
+bool FDialogueXLSXWriter::ExportWorkbook(const TArray<FDialogueTableRow>& Rows, const FString& FilePath,
+	const FDialogueAssetSyncResult* AssetSync, FString& OutError)
+{
 	// Scan project assets to populate valid IDs for _Lists sheet
 	ScanAssetsForValidIds();
 
-	// Create the output file
-	IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath);
-	if (!FileHandle)
+	// v7.8.79: Streaming writer - deflate entries, shared strings, no whole-sheet FString
+	FXLSXStreamWriter Writer;
+	if (!Writer.Open(FilePath, OutError))
 	{
-		// v4.8.4: Improved error message - file lock is most common cause
-		OutError = FString::Printf(TEXT("Cannot write to file: %s\n\nIf the file is open in Excel, please close it and try again."), *FilePath);
 		return false;
 	}
 
-	// Create ZIP writer with no compression (STORE mode)
-	FZipArchiveWriter ZipWriter(FileHandle, EZipArchiveOptions::None);
-	FDateTime Now = FDateTime::Now();
-
-	// Add all required XLSX files
-	auto AddXmlFile = [&ZipWriter, &Now](const FString& Path, const FString& Content)
-	{
-		TArray<uint8> Data;
-		FTCHARToUTF8 Converter(*Content);
-		Data.Append((const uint8*)Converter.Get(), Converter.Length());
-		ZipWriter.AddFile(Path, Data, Now);
-	};
-
 	// Core XLSX structure
-	AddXmlFile(TEXT("[Content_Types].xml"), GenerateContentTypesXml());
-	AddXmlFile(TEXT("_rels/.rels"), GenerateRelsXml());
-	AddXmlFile(TEXT("xl/workbook.xml"), GenerateWorkbookXml());
-	AddXmlFile(TEXT("xl/_rels/workbook.xml.rels"), GenerateWorkbookRelsXml());
-	AddXmlFile(TEXT("xl/styles.xml"), GenerateStylesXml());
-
-	// Worksheets - use overload with asset sync for dialogues sheet
-	AddXmlFile(TEXT("xl/worksheets/sheet1.xml"), GenerateDialoguesSheet(Rows, &AssetSync));
-	AddXmlFile(TEXT("xl/worksheets/sheet2.xml"), GenerateListsSheet(Rows));
-	AddXmlFile(TEXT("xl/worksheets/sheet3.xml"), GenerateMetaSheet(Rows));
-
-	// ZipWriter destructor will finalize and close the file
-	return true;
-#else
-	OutError = TEXT("XLSX export requires WITH_ENGINE");
-	return false;
-#endif
+	Writer.AddPart(TEXT("[Content_Types].xml"), GenerateContentTypesXml());
+	Writer.AddPart(TEXT("_rels/.rels"), GenerateRelsXml());
+	Writer.AddPart(TEXT("xl/workbook.xml"), GenerateWorkbookXml());
+	Writer.AddPart(TEXT("xl/_rels/workbook.xml.rels"), GenerateWorkbookRelsXml());
+	Writer.AddPart(TEXT("xl/styles.xml"), GenerateStylesXml());
+
+	// Worksheets - asset sync (if any) fills the [RO] columns of the dialogues sheet
+	WriteDialoguesSheet(Writer, Rows, AssetSync);
+	WriteListsSheet(Writer, Rows);
+	WriteMetaSheet(Writer, Rows);
+
+	// Writes xl/sharedStrings.xml and finalizes the archive
+	return Writer.Close(OutError);
 }
 
 FString FDialogueXLSXWriter::GenerateContentTypesXml()
@@ -157,6 +95,7 @@ FString FDialogueXLSXWriter::GenerateContentTypesXml()
   <Override PartName="/xl/worksheets/sheet2.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>
   <Override PartName="/xl/worksheets/sheet3.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>
   <Override PartName="/xl/styles.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.styles+xml"/>
+  <Override PartName="/xl/sharedStrings.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.sharedStrings+xml"/>
 </Types>)");
 }
 
@@ -188,6 +127,7 @@ FString FDialogueXLSXWriter::GenerateWorkbookRelsXml()
   <Relationship Id="rId2" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet2.xml"/>
   <Relationship Id="rId3" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet3.xml"/>
   <Relationship Id="rId4" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/styles" Target="styles.xml"/>
+  <Relationship Id="rId5" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/sharedStrings" Target="sharedStrings.xml"/>
 </Relationships>)");
 }
 
@@ -217,41 +157,38 @@ FString FDialogueXLSXWriter::GenerateStylesXml()
 </styleSheet>)");
 }
 
-FString FDialogueXLSXWriter::GenerateDialoguesSheet(const TArray<FDialogueTableRow>& Rows)
-{
-	// Call overload with no asset sync data
-	return GenerateDialoguesSheet(Rows, nullptr);
-}
-
-FString FDialogueXLSXWriter::GenerateDialoguesSheet(const TArray<FDialogueTableRow>& Rows, const FDialogueAssetSyncResult* AssetSync)
+void FDialogueXLSXWriter::WriteDialoguesSheet(FXLSXStreamWriter& Writer, const TArray<FDialogueTableRow>& Rows, const FDialogueAssetSyncResult* AssetSync)
 {
 	TArray<FDialogueXLSXColumn> Columns = GetColumnDefinitions();
-	FString SheetData;
+
+	// Column widths
+	TArray<float> Widths;
+	for (const FDialogueXLSXColumn& Column : Columns)
+	{
+		Widths.Add(Column.Width);
+	}
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet1.xml"), Widths);
 
 	// Row 1: Sentinel with column IDs
-	SheetData += TEXT("<row r=\"1\">");
+	Writer.BeginRow();
 	for (int32 i = 0; i < Columns.Num(); i++)
 	{
-		FString CellValue = (i == 0) ? SHEET_SENTINEL : Columns[i].ColumnId;
-		SheetData += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-			*CellReference(i, 1), *EscapeXml(CellValue));
+		Writer.AddCell((i == 0) ? SHEET_SENTINEL : Columns[i].ColumnId);
 	}
-	SheetData += TEXT("</row>");
+	Writer.EndRow();
 
 	// Row 2: Human-readable headers (bold - style 1)
-	SheetData += TEXT("<row r=\"2\">");
-	for (int32 i = 0; i < Columns.Num(); i++)
+	Writer.BeginRow();
+	for (const FDialogueXLSXColumn& Column : Columns)
 	{
-		SheetData += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\" s=\"1\"><is><t>%s</t></is></c>"),
-			*CellReference(i, 2), *EscapeXml(Columns[i].DisplayName));
+		Writer.AddCell(Column.DisplayName, 1);
 	}
-	SheetData += TEXT("</row>");
+	Writer.EndRow();
 
-	// Data rows (starting at row 3)
-	int32 RowNum = 3;
+	// Data rows (starting at row 3) - streamed, one row at a time
 	for (const FDialogueTableRow& Row : Rows)
 	{
-		SheetData += FString::Printf(TEXT("<row r=\"%d\">"), RowNum);
+		Writer.BeginRow();
 
 		// Build NextNodeIDs as comma-separated string
 		FString NextNodesStr;
@@ -264,9 +201,7 @@ FString FDialogueXLSXWriter::GenerateDialoguesSheet(const TArray<FDialogueTableR
 		// v4.4 Phase 3: Token strings from row and asset sync
 		// EVENTS/CONDITIONS = Editable tokens (what user authored in Excel)
 		// [RO]EVENTS_CURRENT/[RO]CONDITIONS_CURRENT = UE's current state from asset sync
-		FString EventsStr = Row.EventsTokenStr;           // Editable tokens
 		FString EventsCurrentStr;                         // [RO] UE's current state
-		FString ConditionsStr = Row.ConditionsTokenStr;   // Editable tokens
 		FString ConditionsCurrentStr;                     // [RO] UE's current state
 
 		// Lookup [RO] columns from asset sync if available
@@ -284,55 +219,32 @@ FString FDialogueXLSXWriter::GenerateDialoguesSheet(const TArray<FDialogueTableR
 		// Compute hash for this row (includes editable fields only)
 		int64 RowHash = ComputeRowHash(Row);
 
-		// Column values in order (must match GetColumnDefinitions)
-		TArray<FString> Values = {
-			Row.RowId.ToString(),                                           // #ROW_GUID
-			Row.DialogueID.ToString(),                                      // DIALOGUE_ID
-			Row.NodeID.ToString(),                                          // NODE_ID
-			Row.NodeType == EDialogueTableNodeType::NPC ? TEXT("NPC") : TEXT("Player"), // [RO]NODE_TYPE
-			Row.Speaker.ToString(),                                         // SPEAKER
-			Row.Text,                                                       // TEXT
-			Row.OptionText,                                                 // OPTION_TEXT
-			EventsStr,                                                      // EVENTS (editable)
-			EventsCurrentStr,                                               // [RO]EVENTS_CURRENT
-			ConditionsStr,                                                  // CONDITIONS (editable)
-			ConditionsCurrentStr,                                           // [RO]CONDITIONS_CURRENT
-			Row.ParentNodeID.ToString(),                                    // [RO]PARENT_NODE_ID
-			NextNodesStr,                                                   // [RO]NEXT_NODE_IDS
-			Row.bSkippable ? TEXT("Yes") : TEXT("No"),                      // SKIPPABLE
-			Row.Notes,                                                      // NOTES
-			TEXT("Synced"),                                                 // #STATE
-			FString::Printf(TEXT("%lld"), RowHash),                         // #BASE_HASH
-		};
-
-		for (int32 i = 0; i < Values.Num(); i++)
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				*CellReference(i, RowNum), *EscapeXml(Values[i]));
-		}
-
-		SheetData += TEXT("</row>");
-		RowNum++;
+		// Cell values in order (must match GetColumnDefinitions)
+		Writer.AddCell(Row.RowId.ToString());                                           // #ROW_GUID
+		Writer.AddCell(Row.DialogueID.ToString());                                      // DIALOGUE_ID
+		Writer.AddCell(Row.NodeID.ToString());                                          // NODE_ID
+		Writer.AddCell(Row.NodeType == EDialogueTableNodeType::NPC ? TEXT("NPC") : TEXT("Player")); // [RO]NODE_TYPE
+		Writer.AddCell(Row.Speaker.ToString());                                         // SPEAKER
+		Writer.AddCell(Row.Text);                                                       // TEXT
+		Writer.AddCell(Row.OptionText);                                                 // OPTION_TEXT
+		Writer.AddCell(Row.EventsTokenStr);                                             // EVENTS (editable)
+		Writer.AddCell(EventsCurrentStr);                                               // [RO]EVENTS_CURRENT
+		Writer.AddCell(Row.ConditionsTokenStr);                                         // CONDITIONS (editable)
+		Writer.AddCell(ConditionsCurrentStr);                                           // [RO]CONDITIONS_CURRENT
+		Writer.AddCell(Row.ParentNodeID.ToString());                                    // [RO]PARENT_NODE_ID
+		Writer.AddCell(NextNodesStr);                                                   // [RO]NEXT_NODE_IDS
+		Writer.AddCell(Row.bSkippable ? TEXT("Yes") : TEXT("No"));                      // SKIPPABLE
+		Writer.AddCell(Row.Notes);                                                      // NOTES
+		Writer.AddCell(TEXT("Synced"));                                                 // #STATE
+		Writer.AddCell(FString::Printf(TEXT("%lld"), RowHash));                         // #BASE_HASH
+
+		Writer.EndRow();
 	}
 
-	// Build column widths
-	FString ColsXml = TEXT("<cols>");
-	for (int32 i = 0; i < Columns.Num(); i++)
-	{
-		ColsXml += FString::Printf(TEXT("<col min=\"%d\" max=\"%d\" width=\"%.1f\" customWidth=\"1\"/>"),
-			i + 1, i + 1, Columns[i].Width);
-	}
-	ColsXml += TEXT("</cols>");
-
-	// Full worksheet XML
-	return FString::Printf(TEXT(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>
-<worksheet xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main">
-  %s
-  <sheetData>%s</sheetData>
-</worksheet>)"), *ColsXml, *SheetData);
+	Writer.EndSheet();
 }
 
-FString FDialogueXLSXWriter::GenerateListsSheet(const TArray<FDialogueTableRow>& Rows)
+void FDialogueXLSXWriter::WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FDialogueTableRow>& Rows)
 {
 	// Collect unique values for dropdowns and token validation
 	TSet<FString> DialogueIds;
@@ -383,95 +295,52 @@ FString FDialogueXLSXWriter::GenerateListsSheet(const TArray<FDialogueTableRow>&
 		ItemIds.Add(ItemId);
 	}
 
-	FString SheetData;
+	const float Widths[] = { 20.0f, 20.0f, 15.0f, 25.0f, 25.0f, 25.0f, 25.0f };
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet2.xml"), Widths);
 
 	// Header row
-	SheetData += TEXT("<row r=\"1\">");
-	SheetData += TEXT("<c r=\"A1\" t=\"inlineStr\" s=\"1\"><is><t>DIALOGUE_ID</t></is></c>");
-	SheetData += TEXT("<c r=\"B1\" t=\"inlineStr\" s=\"1\"><is><t>SPEAKER_ID</t></is></c>");
-	SheetData += TEXT("<c r=\"C1\" t=\"inlineStr\" s=\"1\"><is><t>NODE_TYPE</t></is></c>");
-	SheetData += TEXT("<c r=\"D1\" t=\"inlineStr\" s=\"1\"><is><t>QUEST_ID</t></is></c>");
-	SheetData += TEXT("<c r=\"E1\" t=\"inlineStr\" s=\"1\"><is><t>ITEM_ID</t></is></c>");
-	SheetData += TEXT("<c r=\"F1\" t=\"inlineStr\" s=\"1\"><is><t>EVENT_TOKENS</t></is></c>");
-	SheetData += TEXT("<c r=\"G1\" t=\"inlineStr\" s=\"1\"><is><t>CONDITION_TOKENS</t></is></c>");
-	SheetData += TEXT("</row>");
+	Writer.BeginRow();
+	Writer.AddCell(TEXT("DIALOGUE_ID"), 1);
+	Writer.AddCell(TEXT("SPEAKER_ID"), 1);
+	Writer.AddCell(TEXT("NODE_TYPE"), 1);
+	Writer.AddCell(TEXT("QUEST_ID"), 1);
+	Writer.AddCell(TEXT("ITEM_ID"), 1);
+	Writer.AddCell(TEXT("EVENT_TOKENS"), 1);
+	Writer.AddCell(TEXT("CONDITION_TOKENS"), 1);
+	Writer.EndRow();
 
 	// Data rows - fill each column with unique values
-	TArray<FString> DialogueIdArr = DialogueIds.Array();
-	TArray<FString> SpeakerArr = Speakers.Array();
-	TArray<FString> NodeTypeArr = NodeTypes.Array();
-	TArray<FString> QuestIdArr = QuestIds.Array();
-	TArray<FString> ItemIdArr = ItemIds.Array();
-	TArray<FString> EventTokenArr = EventTokens.Array();
-	TArray<FString> ConditionTokenArr = ConditionTokens.Array();
-
-	int32 MaxRows = FMath::Max(DialogueIdArr.Num(), SpeakerArr.Num());
-	MaxRows = FMath::Max(MaxRows, NodeTypeArr.Num());
-	MaxRows = FMath::Max(MaxRows, QuestIdArr.Num());
-	MaxRows = FMath::Max(MaxRows, ItemIdArr.Num());
-	MaxRows = FMath::Max(MaxRows, EventTokenArr.Num());
-	MaxRows = FMath::Max(MaxRows, ConditionTokenArr.Num());
+	const TArray<FString> ListColumns[] = {
+		DialogueIds.Array(),
+		Speakers.Array(),
+		NodeTypes.Array(),
+		QuestIds.Array(),
+		ItemIds.Array(),
+		EventTokens.Array(),
+		ConditionTokens.Array(),
+	};
 
-	for (int32 i = 0; i < MaxRows; i++)
+	int32 MaxRows = 0;
+	for (const TArray<FString>& List : ListColumns)
 	{
-		int32 RowNum = i + 2;
-		SheetData += FString::Printf(TEXT("<row r=\"%d\">"), RowNum);
+		MaxRows = FMath::Max(MaxRows, List.Num());
+	}
 
-		if (i < DialogueIdArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"A%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(DialogueIdArr[i]));
-		}
-		if (i < SpeakerArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"B%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(SpeakerArr[i]));
-		}
-		if (i < NodeTypeArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"C%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(NodeTypeArr[i]));
-		}
-		if (i < QuestIdArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"D%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(QuestIdArr[i]));
-		}
-		if (i < ItemIdArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"E%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(ItemIdArr[i]));
-		}
-		if (i < EventTokenArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"F%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(EventTokenArr[i]));
-		}
-		if (i < ConditionTokenArr.Num())
+	for (int32 i = 0; i < MaxRows; i++)
+	{
+		Writer.BeginRow();
+		for (const TArray<FString>& List : ListColumns)
 		{
-			SheetData += FString::Printf(TEXT("<c r=\"G%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(ConditionTokenArr[i]));
+			// A column that ran out of values leaves its cell empty
+			Writer.AddCell(List.IsValidIndex(i) ? List[i] : FString());
 		}
-
-		SheetData += TEXT("</row>");
+		Writer.EndRow();
 	}
 
-	return FString::Printf(TEXT(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>
-<worksheet xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main">
-  <cols>
-    <col min="1" max="1" width="20" customWidth="1"/>
-    <col min="2" max="2" width="20" customWidth="1"/>
-    <col min="3" max="3" width="15" customWidth="1"/>
-    <col min="4" max="4" width="25" customWidth="1"/>
-    <col min="5" max="5" width="25" customWidth="1"/>
-    <col min="6" max="6" width="25" customWidth="1"/>
-    <col min="7" max="7" width="25" customWidth="1"/>
-  </cols>
-  <sheetData>%s</sheetData>
-</worksheet>)"), *SheetData);
+	Writer.EndSheet();
 }
 
-FString FDialogueXLSXWriter::GenerateMetaSheet(const TArray<FDialogueTableRow>& Rows)
+void FDialogueXLSXWriter::WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FDialogueTableRow>& Rows)
 {
 	FString ExportGuid = FGuid::NewGuid().ToString();
 	FString ExportTime = FDateTime::Now().ToString();
@@ -483,13 +352,14 @@ FString FDialogueXLSXWriter::GenerateMetaSheet(const TArray<FDialogueTableRow>&
 		ContentHash ^= ComputeRowHash(Row);
 	}
 
-	FString SheetData;
+	const float Widths[] = { 20.0f, 40.0f };
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet3.xml"), Widths);
 
 	// Headers
-	SheetData += TEXT("<row r=\"1\">");
-	SheetData += TEXT("<c r=\"A1\" t=\"inlineStr\" s=\"1\"><is><t>Property</t></is></c>");
-	SheetData += TEXT("<c r=\"B1\" t=\"inlineStr\" s=\"1\"><is><t>Value</t></is></c>");
-	SheetData += TEXT("</row>");
+	Writer.BeginRow();
+	Writer.AddCell(TEXT("Property"), 1);
+	Writer.AddCell(TEXT("Value"), 1);
+	Writer.EndRow();
 
 	// Metadata values
 	TArray<TPair<FString, FString>> MetaValues = {
@@ -501,56 +371,15 @@ FString FDialogueXLSXWriter::GenerateMetaSheet(const TArray<FDialogueTableRow>&
 		{ TEXT("TABLE_TYPE"), TEXT("Dialogue") },
 	};
 
-	for (int32 i = 0; i < MetaValues.Num(); i++)
-	{
-		int32 RowNum = i + 2;
-		SheetData += FString::Printf(TEXT("<row r=\"%d\">"), RowNum);
-		SheetData += FString::Printf(TEXT("<c r=\"A%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-			RowNum, *EscapeXml(MetaValues[i].Key));
-		SheetData += FString::Printf(TEXT("<c r=\"B%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-			RowNum, *EscapeXml(MetaValues[i].Value));
-		SheetData += TEXT("</row>");
-	}
-
-	return FString::Printf(TEXT(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>
-<worksheet xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main">
-  <cols>
-    <col min="1" max="1" width="20" customWidth="1"/>
-    <col min="2" max="2" width="40" customWidth="1"/>
-  </cols>
-  <sheetData>%s</sheetData>
-</worksheet>)"), *SheetData);
-}
-
-FString FDialogueXLSXWriter::EscapeXml(const FString& Text)
-{
-	FString Result = Text;
-	Result.ReplaceInline(TEXT("&"), TEXT("&amp;"));
-	Result.ReplaceInline(TEXT("<"), TEXT("&lt;"));
-	Result.ReplaceInline(TEXT(">"), TEXT("&gt;"));
-	Result.ReplaceInline(TEXT("\""), TEXT("&quot;"));
-	Result.ReplaceInline(TEXT("'"), TEXT("&apos;"));
-	return Result;
-}
-
-FString FDialogueXLSXWriter::CellReference(int32 Col, int32 Row)
-{
-	return ColumnLetter(Col) + FString::Printf(TEXT("%d"), Row);
-}
-
-FString FDialogueXLSXWriter::ColumnLetter(int32 ColIndex)
-{
-	FString Result;
-	int32 Col = ColIndex;
-
-	do
+	for (const TPair<FString, FString>& Meta : MetaValues)
 	{
-		Result = FString::Chr(TEXT('A') + (Col % 26)) + Result;
-		Col = Col / 26 - 1;
+		Writer.BeginRow();
+		Writer.AddCell(Meta.Key);
+		Writer.AddCell(Meta.Value);
+		Writer.EndRow();
 	}
-	while (Col >= 0);
 
-	return Result;
+	Writer.EndSheet();
 }
 
 int64 FDialogueXLSXWriter::ComputeRowHash(const FDialogueTableRow& Row)
@@ -1,17 +1,11 @@
 // GasAbilityGenerator - NPC XLSX Reader Implementation
 // v4.4: Import NPC table from Excel format
+// v7.8.78: Sheets streamed through FXLSXStreamReader (shared strings, no DOM or grid)
 //
-// Uses UE's XML parser (FXmlFile) and ZIP reader (FZipArchiveReader).
 // Designed to be robust against user modifications in Excel.
 
 #include "XLSXSupport/NPCXLSXReader.h"
-#include "HAL/PlatformFileManager.h"
-#include "Misc/FileHelper.h"
-#include "XmlFile.h"
-
-#if WITH_EDITOR
-#include "FileUtilities/ZipArchiveReader.h"
-#endif
+#include "XLSXSupport/XLSXStreamReader.h"
 
 //=============================================================================
 // Static Constants
@@ -28,31 +22,29 @@ FNPCXLSXImportResult FNPCXLSXReader::ImportFromXLSX(const FString& FilePath)
 	FNPCXLSXImportResult Result;
 
 #if WITH_EDITOR
-	// Step 1: Extract ZIP contents
-	TMap<FString, TArray<uint8>> ZipContents;
-	if (!ExtractZipContents(FilePath, ZipContents, Result.ErrorMessage))
+	// Step 1: Open the workbook (zip directory + shared string table only)
+	FXLSXStreamReader Workbook;
+	if (!Workbook.Open(FilePath, Result.ErrorMessage))
 	{
 		return Result;
 	}
 
 	// Step 2: Find and parse the NPCs sheet (sheet1.xml)
-	TArray<uint8>* Sheet1Data = ZipContents.Find(TEXT("xl/worksheets/sheet1.xml"));
-	if (!Sheet1Data)
+	if (!Workbook.HasEntry(TEXT("xl/worksheets/sheet1.xml")))
 	{
 		Result.ErrorMessage = TEXT("Could not find NPCs sheet (xl/worksheets/sheet1.xml)");
 		return Result;
 	}
 
-	if (!ParseNPCsSheet(*Sheet1Data, Result.Rows, Result.ErrorMessage))
+	if (!ParseNPCsSheet(Workbook, Result.Rows, Result.ErrorMessage))
 	{
 		return Result;
 	}
 
 	// Step 3: Parse metadata if available (optional - file still valid without it)
-	TArray<uint8>* Sheet3Data = ZipContents.Find(TEXT("xl/worksheets/sheet3.xml"));
-	if (Sheet3Data)
+	if (Workbook.HasEntry(TEXT("xl/worksheets/sheet3.xml")))
 	{
-		ParseMetaSheet(*Sheet3Data, Result);
+		ParseMetaSheet(Workbook, Result);
 	}
 
 	Result.bSuccess = true;
@@ -64,88 +56,55 @@ FNPCXLSXImportResult FNPCXLSXReader::ImportFromXLSX(const FString& FilePath)
 }
 
 //=============================================================================
-// ZIP Extraction
+// Sheet Parsing
 //=============================================================================
 
-#if WITH_EDITOR
-bool FNPCXLSXReader::ExtractZipContents(const FString& FilePath, TMap<FString, TArray<uint8>>& OutFiles, FString& OutError)
+bool FNPCXLSXReader::ParseNPCsSheet(const FXLSXStreamReader& Workbook, TArray<FNPCTableRow>& OutRows, FString& OutError)
 {
-	// Open the XLSX file (which is a ZIP container)
-	IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath);
-	if (!FileHandle)
-	{
-		OutError = FString::Printf(TEXT("Could not open file: %s"), *FilePath);
-		return false;
-	}
+	TMap<FString, int32> ColumnMap;
+	bool bSentinelRead = false;
+	bool bSentinelInvalid = false;
+	int32 LastRowNumber = 0;
 
-	// Create ZIP reader
-	FZipArchiveReader ZipReader(FileHandle);
-	if (!ZipReader.IsValid())
+	const bool bRead = Workbook.ReadSheet(TEXT("xl/worksheets/sheet1.xml"), [&](int32 RowNumber, const TArray<FString>& RowValues)
 	{
-		OutError = TEXT("Invalid or corrupt XLSX file (not a valid ZIP container)");
-		return false;
-	}
+		LastRowNumber = FMath::Max(LastRowNumber, RowNumber);
 
-	// Extract all files to memory
-	TArray<FString> FileNames = ZipReader.GetFileNames();
-	for (const FString& FileName : FileNames)
-	{
-		TArray<uint8> FileData;
-		if (ZipReader.TryReadFile(FileName, FileData))
+		//-------------------------------------------------------------------------
+		// Row 1: Sentinel + Column IDs
+		//-------------------------------------------------------------------------
+		if (!bSentinelRead)
 		{
-			OutFiles.Add(FileName, MoveTemp(FileData));
-		}
-	}
-
-	return true;
-}
-#endif
-
-//=============================================================================
-// Sheet Parsing
-//=============================================================================
-
-bool FNPCXLSXReader::ParseNPCsSheet(const TArray<uint8>& XmlData, TArray<FNPCTableRow>& OutRows, FString& OutError)
-{
-	// Parse XML to 2D grid
-	TArray<TArray<FString>> Grid = ParseSheetToGrid(XmlData);
-
-	// Validate minimum structure (sentinel + headers + at least potential for data)
-	if (Grid.Num() < 2)
-	{
-		OutError = TEXT("Sheet has fewer than 2 rows (need sentinel row + header row)");
-		return false;
-	}
+			const bool bIsFirstRow = RowNumber == 1 && RowValues.Num() > 0;
+			if (!bIsFirstRow || RowValues[0] != EXPECTED_SENTINEL)
+			{
+				OutError = FString::Printf(TEXT("Invalid sentinel. Expected '%s', got '%s'"),
+					*EXPECTED_SENTINEL, bIsFirstRow ? *RowValues[0] : TEXT("(empty)"));
+				bSentinelInvalid = true;
+				return false;
+			}
 
-	//-------------------------------------------------------------------------
-	// Row 1: Sentinel + Column IDs
-	//-------------------------------------------------------------------------
-	const TArray<FString>& SentinelRow = Grid[0];
-	if (SentinelRow.Num() == 0 || SentinelRow[0] != EXPECTED_SENTINEL)
-	{
-		OutError = FString::Printf(TEXT("Invalid sentinel. Expected '%s', got '%s'"),
-			*EXPECTED_SENTINEL, SentinelRow.Num() > 0 ? *SentinelRow[0] : TEXT("(empty)"));
-		return false;
-	}
+			// Build column ID -> index mapping from sentinel row
+			// This makes parsing robust against column reordering
+			for (int32 i = 0; i < RowValues.Num(); i++)
+			{
+				if (!RowValues[i].IsEmpty())
+				{
+					ColumnMap.Add(RowValues[i], i);
+				}
+			}
+			bSentinelRead = true;
+			return true;
+		}
 
-	// Build column ID -> index mapping from sentinel row
-	// This makes parsing robust against column reordering
-	TMap<FString, int32> ColumnMap;
-	for (int32 i = 0; i < SentinelRow.Num(); i++)
-	{
-		if (!SentinelRow[i].IsEmpty())
+		//-------------------------------------------------------------------------
+		// Row 2: Human headers (skipped - we use column IDs from row 1)
+		// Row 3+: Data rows
+		//-------------------------------------------------------------------------
+		if (RowNumber < 3)
 		{
-			ColumnMap.Add(SentinelRow[i], i);
+			return true;
 		}
-	}
-
-	//-------------------------------------------------------------------------
-	// Row 2: Human headers (skipped - we use column IDs from row 1)
-	// Row 3+: Data rows
-	//-------------------------------------------------------------------------
-	for (int32 RowIdx = 2; RowIdx < Grid.Num(); RowIdx++)
-	{
-		const TArray<FString>& RowValues = Grid[RowIdx];
 
 		// Skip completely empty rows
 		bool bAllEmpty = true;
@@ -157,7 +116,7 @@ bool FNPCXLSXReader::ParseNPCsSheet(const TArray<uint8>& XmlData, TArray<FNPCTab
 				break;
 			}
 		}
-		if (bAllEmpty) continue;
+		if (bAllEmpty) return true;
 
 		// Parse row using column mapping
 		FNPCTableRow NPCRow = ParseRowFromValues(ColumnMap, RowValues);
@@ -165,212 +124,63 @@ bool FNPCXLSXReader::ParseNPCsSheet(const TArray<uint8>& XmlData, TArray<FNPCTab
 		// Only add rows that have at least an NPC name (basic validity check)
 		if (!NPCRow.NPCName.IsEmpty())
 		{
-			OutRows.Add(NPCRow);
+			OutRows.Add(MoveTemp(NPCRow));
 		}
-	}
-
-	return true;
-}
+		return true;
+	}, OutError);
 
-bool FNPCXLSXReader::ParseMetaSheet(const TArray<uint8>& XmlData, FNPCXLSXImportResult& OutResult)
-{
-	TArray<TArray<FString>> Grid = ParseSheetToGrid(XmlData);
-
-	// Parse key-value pairs (Property in col A, Value in col B)
-	// Skip header row (index 0)
-	for (int32 i = 1; i < Grid.Num(); i++)
+	if (!bRead || bSentinelInvalid)
 	{
-		if (Grid[i].Num() >= 2)
-		{
-			const FString& Key = Grid[i][0];
-			const FString& Value = Grid[i][1];
+		return false;
+	}
 
-			if (Key == TEXT("EXPORT_GUID"))
-			{
-				OutResult.ExportGuid = Value;
-			}
-			else if (Key == TEXT("EXPORTED_AT"))
-			{
-				OutResult.ExportedAt = Value;
-			}
-			else if (Key == TEXT("FORMAT_VERSION"))
-			{
-				OutResult.FormatVersion = Value;
-			}
-			else if (Key == TEXT("ROW_COUNT"))
-			{
-				OutResult.OriginalRowCount = FCString::Atoi(*Value);
-			}
-			else if (Key == TEXT("CONTENT_HASH"))
-			{
-				OutResult.ContentHash = FCString::Atoi64(*Value);
-			}
-		}
+	// Validate minimum structure (sentinel + headers + at least potential for data)
+	if (LastRowNumber < 2)
+	{
+		OutError = TEXT("Sheet has fewer than 2 rows (need sentinel row + header row)");
+		return false;
 	}
 
 	return true;
 }
 
-//=============================================================================
-// XML Grid Parsing
-//=============================================================================
-
-TArray<TArray<FString>> FNPCXLSXReader::ParseSheetToGrid(const TArray<uint8>& XmlData)
+bool FNPCXLSXReader::ParseMetaSheet(const FXLSXStreamReader& Workbook, FNPCXLSXImportResult& OutResult)
 {
-	TArray<TArray<FString>> Grid;
-
-	// Convert raw bytes to string
-	FString XmlString;
-	FFileHelper::BufferToString(XmlString, XmlData.GetData(), XmlData.Num());
-
-	// Parse XML
-	FXmlFile XmlFile(XmlString, EConstructMethod::ConstructFromBuffer);
-	if (!XmlFile.IsValid())
-	{
-		return Grid;
-	}
-
-	const FXmlNode* RootNode = XmlFile.GetRootNode();
-	if (!RootNode)
-	{
-		return Grid;
-	}
-
-	// Find sheetData node (contains all rows)
-	const FXmlNode* SheetDataNode = RootNode->FindChildNode(TEXT("sheetData"));
-	if (!SheetDataNode)
-	{
-		return Grid;
-	}
-
-	//-------------------------------------------------------------------------
-	// First pass: determine grid dimensions
-	//-------------------------------------------------------------------------
-	int32 MaxRow = 0;
-	int32 MaxCol = 0;
-
-	for (const FXmlNode* RowNode : SheetDataNode->GetChildrenNodes())
+	// Parse key-value pairs (Property in col A, Value in col B)
+	// Skip header row (row 1)
+	FString Error;
+	return Workbook.ReadSheet(TEXT("xl/worksheets/sheet3.xml"), [&OutResult](int32 RowNumber, const TArray<FString>& Cells)
 	{
-		if (RowNode->GetTag() != TEXT("row")) continue;
-
-		int32 RowNum = FCString::Atoi(*RowNode->GetAttribute(TEXT("r")));
-		MaxRow = FMath::Max(MaxRow, RowNum);
-
-		for (const FXmlNode* CellNode : RowNode->GetChildrenNodes())
+		if (RowNumber < 2 || Cells.Num() == 0)
 		{
-			if (CellNode->GetTag() != TEXT("c")) continue;
-
-			FString CellRef = CellNode->GetAttribute(TEXT("r"));
-			int32 Col, Row;
-			ParseCellReference(CellRef, Col, Row);
-			MaxCol = FMath::Max(MaxCol, Col + 1);
+			return true;
 		}
-	}
 
-	//-------------------------------------------------------------------------
-	// Initialize grid with empty strings
-	//-------------------------------------------------------------------------
-	Grid.SetNum(MaxRow);
-	for (int32 i = 0; i < MaxRow; i++)
-	{
-		Grid[i].SetNum(MaxCol);
-	}
+		const FString& Key = Cells[0];
+		const FString Value = Cells.IsValidIndex(1) ? Cells[1] : FString();
 
-	//-------------------------------------------------------------------------
-	// Second pass: fill grid with cell values
-	//-------------------------------------------------------------------------
-	for (const FXmlNode* RowNode : SheetDataNode->GetChildrenNodes())
-	{
-		if (RowNode->GetTag() != TEXT("row")) continue;
-
-		int32 RowNum = FCString::Atoi(*RowNode->GetAttribute(TEXT("r")));
-		int32 RowIdx = RowNum - 1;  // Convert to 0-based index
-
-		for (const FXmlNode* CellNode : RowNode->GetChildrenNodes())
+		if (Key == TEXT("EXPORT_GUID"))
 		{
-			if (CellNode->GetTag() != TEXT("c")) continue;
-
-			FString CellRef = CellNode->GetAttribute(TEXT("r"));
-			int32 ColIdx, RowFromRef;
-			ParseCellReference(CellRef, ColIdx, RowFromRef);
-
-			// Extract cell value (supports both inline strings and value nodes)
-			FString CellValue;
-			FString CellType = CellNode->GetAttribute(TEXT("t"));
-
-			// Check for inline string <is><t>value</t></is>
-			const FXmlNode* InlineStrNode = CellNode->FindChildNode(TEXT("is"));
-			const FXmlNode* ValueNode = CellNode->FindChildNode(TEXT("v"));
-
-			if (InlineStrNode)
-			{
-				const FXmlNode* TextNode = InlineStrNode->FindChildNode(TEXT("t"));
-				if (TextNode)
-				{
-					CellValue = TextNode->GetContent();
-				}
-			}
-			else if (ValueNode)
-			{
-				CellValue = ValueNode->GetContent();
-			}
-
-			// Store in grid if within bounds
-			if (RowIdx >= 0 && RowIdx < Grid.Num() && ColIdx >= 0 && ColIdx < Grid[RowIdx].Num())
-			{
-				Grid[RowIdx][ColIdx] = CellValue;
-			}
+			OutResult.ExportGuid = Value;
 		}
-	}
-
-	return Grid;
-}
-
-//=============================================================================
-// Cell Reference Helpers
-//=============================================================================
-
-int32 FNPCXLSXReader::ColumnLetterToIndex(const FString& Letter)
-{
-	// Convert Excel column letters to 0-based index
-	// "A" = 0, "Z" = 25, "AA" = 26, "AB" = 27, etc.
-	int32 Index = 0;
-	for (int32 i = 0; i < Letter.Len(); i++)
-	{
-		TCHAR Ch = Letter[i];
-		if (Ch >= TEXT('A') && Ch <= TEXT('Z'))
+		else if (Key == TEXT("EXPORTED_AT"))
 		{
-			Index = Index * 26 + (Ch - TEXT('A') + 1);
+			OutResult.ExportedAt = Value;
 		}
-		else if (Ch >= TEXT('a') && Ch <= TEXT('z'))
+		else if (Key == TEXT("FORMAT_VERSION"))
 		{
-			Index = Index * 26 + (Ch - TEXT('a') + 1);
+			OutResult.FormatVersion = Value;
 		}
-	}
-	return Index - 1;  // Convert to 0-based
-}
-
-void FNPCXLSXReader::ParseCellReference(const FString& CellRef, int32& OutCol, int32& OutRow)
-{
-	// Split cell reference (e.g., "AA123") into column letters and row number
-	FString ColPart;
-	FString RowPart;
-
-	for (int32 i = 0; i < CellRef.Len(); i++)
-	{
-		TCHAR Ch = CellRef[i];
-		if ((Ch >= TEXT('A') && Ch <= TEXT('Z')) || (Ch >= TEXT('a') && Ch <= TEXT('z')))
+		else if (Key == TEXT("ROW_COUNT"))
 		{
-			ColPart.AppendChar(Ch);
+			OutResult.OriginalRowCount = FCString::Atoi(*Value);
 		}
-		else if (Ch >= TEXT('0') && Ch <= TEXT('9'))
+		else if (Key == TEXT("CONTENT_HASH"))
 		{
-			RowPart.AppendChar(Ch);
+			OutResult.ContentHash = FCString::Atoi64(*Value);
 		}
-	}
-
-	OutCol = ColumnLetterToIndex(ColPart);
-	OutRow = FCString::Atoi(*RowPart);
+		return true;
+	}, Error);
 }
 
 //=============================================================================
@@ -1,20 +1,14 @@
 // GasAbilityGenerator - NPC XLSX Writer Implementation
 // v4.4: Export NPC table to Excel format
 //
-// Generates XLSX (ZIP container with XML files) using UE's FZipArchiveWriter.
-// Uses STORE mode (no compression) for maximum Excel compatibility.
+// Generates XLSX (ZIP container with XML files) using FXLSXStreamWriter.
+// v7.8.79: Rows stream into deflate-compressed entries; cell text goes through the shared string table.
 
 #include "XLSXSupport/NPCXLSXWriter.h"
-#include "HAL/PlatformFileManager.h"
-#include "HAL/FileManager.h"
-#include "Misc/FileHelper.h"
+#include "XLSXSupport/XLSXStreamWriter.h"
 #include "Misc/DateTime.h"
 #include "Misc/Guid.h"
 
-#if WITH_ENGINE
-#include "FileUtilities/ZipArchiveWriter.h"
-#endif
-
 //=============================================================================
 // Static Constants
 //=============================================================================
@@ -76,48 +70,27 @@ TArray<FNPCXLSXColumn> FNPCXLSXWriter::GetColumnDefinitions()
 
 bool FNPCXLSXWriter::ExportToXLSX(const TArray<FNPCTableRow>& Rows, const FString& FilePath, FString& OutError)
 {
-#if WITH_ENGINE
-	// Create output file handle
-	IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath);
-	if (!FileHandle)
+	// v7.8.79: Streaming writer - deflate entries, shared strings, no whole-sheet FString
+	FXLSXStreamWriter Writer;
+	if (!Writer.Open(FilePath, OutError))
 	{
-		// v4.8.4: Improved error message - file lock is most common cause
-		OutError = FString::Printf(TEXT("Cannot write to file: %s\n\nIf the file is open in Excel, please close it and try again."), *FilePath);
 		return false;
 	}
 
-	// Create ZIP writer with STORE mode (no compression) for Excel compatibility
-	// EZipArchiveOptions::None = STORE method
-	FZipArchiveWriter ZipWriter(FileHandle, EZipArchiveOptions::None);
-	FDateTime Now = FDateTime::Now();
-
-	// Helper lambda to add XML content as UTF-8 encoded file
-	auto AddXmlFile = [&ZipWriter, &Now](const FString& Path, const FString& Content)
-	{
-		TArray<uint8> Data;
-		FTCHARToUTF8 Converter(*Content);
-		Data.Append((const uint8*)Converter.Get(), Converter.Length());
-		ZipWriter.AddFile(Path, Data, Now);
-	};
-
 	// Add core XLSX structure files
-	AddXmlFile(TEXT("[Content_Types].xml"), GenerateContentTypesXml());
-	AddXmlFile(TEXT("_rels/.rels"), GenerateRelsXml());
-	AddXmlFile(TEXT("xl/workbook.xml"), GenerateWorkbookXml());
-	AddXmlFile(TEXT("xl/_rels/workbook.xml.rels"), GenerateWorkbookRelsXml());
-	AddXmlFile(TEXT("xl/styles.xml"), GenerateStylesXml());
+	Writer.AddPart(TEXT("[Content_Types].xml"), GenerateContentTypesXml());
+	Writer.AddPart(TEXT("_rels/.rels"), GenerateRelsXml());
+	Writer.AddPart(TEXT("xl/workbook.xml"), GenerateWorkbookXml());
+	Writer.AddPart(TEXT("xl/_rels/workbook.xml.rels"), GenerateWorkbookRelsXml());
+	Writer.AddPart(TEXT("xl/styles.xml"), GenerateStylesXml());
 
 	// Add worksheets
-	AddXmlFile(TEXT("xl/worksheets/sheet1.xml"), GenerateNPCsSheet(Rows));
-	AddXmlFile(TEXT("xl/worksheets/sheet2.xml"), GenerateListsSheet(Rows));
-	AddXmlFile(TEXT("xl/worksheets/sheet3.xml"), GenerateMetaSheet(Rows));
-
-	// ZipWriter destructor finalizes and closes the file
-	return true;
-#else
-	OutError = TEXT("XLSX export requires WITH_ENGINE (Editor builds only)");
-	return false;
-#endif
+	WriteNPCsSheet(Writer, Rows);
+	WriteListsSheet(Writer, Rows);
+	WriteMetaSheet(Writer, Rows);
+
+	// Writes xl/sharedStrings.xml and finalizes the archive
+	return Writer.Close(OutError);
 }
 
 //=============================================================================
@@ -136,6 +109,7 @@ FString FNPCXLSXWriter::GenerateContentTypesXml()
   <Override PartName="/xl/worksheets/sheet2.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>
   <Override PartName="/xl/worksheets/sheet3.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>
   <Override PartName="/xl/styles.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.styles+xml"/>
+  <Override PartName="/xl/sharedStrings.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.sharedStrings+xml"/>
 </Types>)");
 }
 
@@ -163,13 +137,14 @@ FString FNPCXLSXWriter::GenerateWorkbookXml()
 
 FString FNPCXLSXWriter::GenerateWorkbookRelsXml()
 {
-	// Relationships from workbook to sheets and styles
+	// Relationships from workbook to sheets, styles and shared strings
 	return TEXT(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>
 <Relationships xmlns="http://schemas.openxmlformats.org/package/2006/relationships">
   <Relationship Id="rId1" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet1.xml"/>
   <Relationship Id="rId2" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet2.xml"/>
   <Relationship Id="rId3" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet3.xml"/>
   <Relationship Id="rId4" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/styles" Target="styles.xml"/>
+  <Relationship Id="rId5" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/sharedStrings" Target="sharedStrings.xml"/>
 </Relationships>)");
 }
 
@@ -204,117 +179,94 @@ FString FNPCXLSXWriter::GenerateStylesXml()
 // Worksheet Generators
 //=============================================================================
 
-FString FNPCXLSXWriter::GenerateNPCsSheet(const TArray<FNPCTableRow>& Rows)
+void FNPCXLSXWriter::WriteNPCsSheet(FXLSXStreamWriter& Writer, const TArray<FNPCTableRow>& Rows)
 {
 	TArray<FNPCXLSXColumn> Columns = GetColumnDefinitions();
-	FString SheetData;
+
+	// Column width definitions
+	TArray<float> Widths;
+	for (const FNPCXLSXColumn& Column : Columns)
+	{
+		Widths.Add(Column.Width);
+	}
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet1.xml"), Widths);
 
 	//-------------------------------------------------------------------------
 	// Row 1: Sentinel with column IDs (machine-readable)
 	// First cell contains sentinel value, rest contain column IDs
 	//-------------------------------------------------------------------------
-	SheetData += TEXT("<row r=\"1\">");
+	Writer.BeginRow();
 	for (int32 i = 0; i < Columns.Num(); i++)
 	{
-		FString CellValue = (i == 0) ? SHEET_SENTINEL : Columns[i].ColumnId;
-		SheetData += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-			*CellReference(i, 1), *EscapeXml(CellValue));
+		Writer.AddCell((i == 0) ? SHEET_SENTINEL : Columns[i].ColumnId);
 	}
-	SheetData += TEXT("</row>");
+	Writer.EndRow();
 
 	//-------------------------------------------------------------------------
 	// Row 2: Human-readable headers (bold style - s="1")
 	//-------------------------------------------------------------------------
-	SheetData += TEXT("<row r=\"2\">");
-	for (int32 i = 0; i < Columns.Num(); i++)
+	Writer.BeginRow();
+	for (const FNPCXLSXColumn& Column : Columns)
 	{
-		SheetData += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\" s=\"1\"><is><t>%s</t></is></c>"),
-			*CellReference(i, 2), *EscapeXml(Columns[i].DisplayName));
+		Writer.AddCell(Column.DisplayName, 1);
 	}
-	SheetData += TEXT("</row>");
+	Writer.EndRow();
 
 	//-------------------------------------------------------------------------
-	// Data rows (starting at row 3)
+	// Data rows (starting at row 3) - streamed, one row at a time
 	//-------------------------------------------------------------------------
-	int32 RowNum = 3;
 	for (const FNPCTableRow& Row : Rows)
 	{
-		SheetData += FString::Printf(TEXT("<row r=\"%d\">"), RowNum);
+		Writer.BeginRow();
 
 		// Compute hash for this row (for 3-way merge)
 		int64 RowHash = ComputeRowHash(Row);
 
-		// Build column values in the same order as column definitions
-		TArray<FString> Values = {
-			// Sync column
-			Row.RowId.ToString(),                                           // #ROW_GUID
-
-			// Core Identity
-			Row.NPCName,                                                    // NPC_NAME
-			Row.NPCId,                                                      // NPC_ID
-			Row.DisplayName,                                                // DISPLAY_NAME
-			GetAssetName(Row.Blueprint),                                    // BLUEPRINT
-
-			// AI & Behavior
-			GetAssetName(Row.AbilityConfig),                                // ABILITY_CONFIG
-			GetAssetName(Row.ActivityConfig),                               // ACTIVITY_CONFIG
-			GetAssetName(Row.Schedule),                                     // SCHEDULE
-			GetAssetName(Row.BehaviorTree),                                 // BEHAVIOR_TREE
-
-			// Combat
-			FString::Printf(TEXT("%d"), Row.MinLevel),                      // MIN_LEVEL
-			FString::Printf(TEXT("%d"), Row.MaxLevel),                      // MAX_LEVEL
-			Row.GetFactionsDisplay(),                                       // FACTIONS (short names)
-			FString::Printf(TEXT("%.2f"), Row.AttackPriority),              // ATTACK_PRIORITY
-
-			// Vendor
-			Row.bIsVendor ? TEXT("Yes") : TEXT("No"),                       // IS_VENDOR
-			Row.ShopName,                                                   // SHOP_NAME
-
-			// Items & Spawning
-			Row.DefaultItems,                                               // DEFAULT_ITEMS
-			Row.SpawnerPOI,                                                 // SPAWNER_POI
-
-			// Meta
-			GetAssetName(Row.Appearance),                                   // APPEARANCE
-			Row.Notes,                                                      // NOTES
-
-			// Sync tracking
-			TEXT("Synced"),                                                 // #STATE
-			FString::Printf(TEXT("%lld"), RowHash),                         // #BASE_HASH
-		};
-
-		// Write all cell values
-		for (int32 i = 0; i < Values.Num(); i++)
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"%s\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				*CellReference(i, RowNum), *EscapeXml(Values[i]));
-		}
-
-		SheetData += TEXT("</row>");
-		RowNum++;
+		// Cell values in the same order as column definitions
+		// Sync column
+		Writer.AddCell(Row.RowId.ToString());                                    // #ROW_GUID
+
+		// Core Identity
+		Writer.AddCell(Row.NPCName);                                             // NPC_NAME
+		Writer.AddCell(Row.NPCId);                                               // NPC_ID
+		Writer.AddCell(Row.DisplayName);                                         // DISPLAY_NAME
+		Writer.AddCell(GetAssetName(Row.Blueprint));                             // BLUEPRINT
+
+		// AI & Behavior
+		Writer.AddCell(GetAssetName(Row.AbilityConfig));                         // ABILITY_CONFIG
+		Writer.AddCell(GetAssetName(Row.ActivityConfig));                        // ACTIVITY_CONFIG
+		Writer.AddCell(GetAssetName(Row.Schedule));                              // SCHEDULE
+		Writer.AddCell(GetAssetName(Row.BehaviorTree));                          // BEHAVIOR_TREE
+
+		// Combat
+		Writer.AddCell(FString::Printf(TEXT("%d"), Row.MinLevel));               // MIN_LEVEL
+		Writer.AddCell(FString::Printf(TEXT("%d"), Row.MaxLevel));               // MAX_LEVEL
+		Writer.AddCell(Row.GetFactionsDisplay());                                // FACTIONS (short names)
+		Writer.AddCell(FString::Printf(TEXT("%.2f"), Row.AttackPriority));       // ATTACK_PRIORITY
+
+		// Vendor
+		Writer.AddCell(Row.bIsVendor ? TEXT("Yes") : TEXT("No"));                // IS_VENDOR
+		Writer.AddCell(Row.ShopName);                                            // SHOP_NAME
+
+		// Items & Spawning
+		Writer.AddCell(Row.DefaultItems);                                        // DEFAULT_ITEMS
+		Writer.AddCell(Row.SpawnerPOI);                                          // SPAWNER_POI
+
+		// Meta
+		Writer.AddCell(GetAssetName(Row.Appearance));                            // APPEARANCE
+		Writer.AddCell(Row.Notes);                                               // NOTES
+
+		// Sync tracking
+		Writer.AddCell(TEXT("Synced"));                                          // #STATE
+		Writer.AddCell(FString::Printf(TEXT("%lld"), RowHash));                  // #BASE_HASH
+
+		Writer.EndRow();
 	}
 
-	//-------------------------------------------------------------------------
-	// Column width definitions
-	//-------------------------------------------------------------------------
-	FString ColsXml = TEXT("<cols>");
-	for (int32 i = 0; i < Columns.Num(); i++)
-	{
-		ColsXml += FString::Printf(TEXT("<col min=\"%d\" max=\"%d\" width=\"%.1f\" customWidth=\"1\"/>"),
-			i + 1, i + 1, Columns[i].Width);
-	}
-	ColsXml += TEXT("</cols>");
-
-	// Assemble full worksheet XML
-	return FString::Printf(TEXT(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>
-<worksheet xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main">
-  %s
-  <sheetData>%s</sheetData>
-</worksheet>)"), *ColsXml, *SheetData);
+	Writer.EndSheet();
 }
 
-FString FNPCXLSXWriter::GenerateListsSheet(const TArray<FNPCTableRow>& Rows)
+void FNPCXLSXWriter::WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FNPCTableRow>& Rows)
 {
 	// Collect unique values for potential dropdown validation
 	TSet<FString> Blueprints;
@@ -345,15 +297,16 @@ FString FNPCXLSXWriter::GenerateListsSheet(const TArray<FNPCTableRow>& Rows)
 		if (!Row.SpawnerPOI.IsEmpty()) POIs.Add(Row.SpawnerPOI);
 	}
 
-	FString SheetData;
+	const float Widths[] = { 25.0f, 25.0f, 20.0f, 25.0f };
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet2.xml"), Widths);
 
 	// Header row (bold)
-	SheetData += TEXT("<row r=\"1\">");
-	SheetData += TEXT("<c r=\"A1\" t=\"inlineStr\" s=\"1\"><is><t>BLUEPRINT</t></is></c>");
-	SheetData += TEXT("<c r=\"B1\" t=\"inlineStr\" s=\"1\"><is><t>ABILITY_CONFIG</t></is></c>");
-	SheetData += TEXT("<c r=\"C1\" t=\"inlineStr\" s=\"1\"><is><t>FACTION</t></is></c>");
-	SheetData += TEXT("<c r=\"D1\" t=\"inlineStr\" s=\"1\"><is><t>POI</t></is></c>");
-	SheetData += TEXT("</row>");
+	Writer.BeginRow();
+	Writer.AddCell(TEXT("BLUEPRINT"), 1);
+	Writer.AddCell(TEXT("ABILITY_CONFIG"), 1);
+	Writer.AddCell(TEXT("FACTION"), 1);
+	Writer.AddCell(TEXT("POI"), 1);
+	Writer.EndRow();
 
 	// Convert sets to arrays for indexed access
 	TArray<FString> BlueprintArr = Blueprints.Array();
@@ -366,49 +319,21 @@ FString FNPCXLSXWriter::GenerateListsSheet(const TArray<FNPCTableRow>& Rows)
 		FMath::Max(FactionArr.Num(), POIArr.Num())
 	);
 
-	// Data rows
+	// Data rows - a column that ran out of values leaves its cell empty
 	for (int32 i = 0; i < MaxRows; i++)
 	{
-		int32 RowNum = i + 2;
-		SheetData += FString::Printf(TEXT("<row r=\"%d\">"), RowNum);
-
-		if (i < BlueprintArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"A%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(BlueprintArr[i]));
-		}
-		if (i < ACArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"B%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(ACArr[i]));
-		}
-		if (i < FactionArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"C%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(FactionArr[i]));
-		}
-		if (i < POIArr.Num())
-		{
-			SheetData += FString::Printf(TEXT("<c r=\"D%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-				RowNum, *EscapeXml(POIArr[i]));
-		}
-
-		SheetData += TEXT("</row>");
+		Writer.BeginRow();
+		Writer.AddCell(BlueprintArr.IsValidIndex(i) ? BlueprintArr[i] : FString());
+		Writer.AddCell(ACArr.IsValidIndex(i) ? ACArr[i] : FString());
+		Writer.AddCell(FactionArr.IsValidIndex(i) ? FactionArr[i] : FString());
+		Writer.AddCell(POIArr.IsValidIndex(i) ? POIArr[i] : FString());
+		Writer.EndRow();
 	}
 
-	return FString::Printf(TEXT(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>
-<worksheet xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main">
-  <cols>
-    <col min="1" max="1" width="25" customWidth="1"/>
-    <col min="2" max="2" width="25" customWidth="1"/>
-    <col min="3" max="3" width="20" customWidth="1"/>
-    <col min="4" max="4" width="25" customWidth="1"/>
-  </cols>
-  <sheetData>%s</sheetData>
-</worksheet>)"), *SheetData);
+	Writer.EndSheet();
 }
 
-FString FNPCXLSXWriter::GenerateMetaSheet(const TArray<FNPCTableRow>& Rows)
+void FNPCXLSXWriter::WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FNPCTableRow>& Rows)
 {
 	// Generate unique export identifier and timestamp
 	FString ExportGuid = FGuid::NewGuid().ToString();
@@ -421,13 +346,14 @@ FString FNPCXLSXWriter::GenerateMetaSheet(const TArray<FNPCTableRow>& Rows)
 		ContentHash ^= ComputeRowHash(Row);
 	}
 
-	FString SheetData;
+	const float Widths[] = { 20.0f, 40.0f };
+	Writer.BeginSheet(TEXT("xl/worksheets/sheet3.xml"), Widths);
 
 	// Headers (bold)
-	SheetData += TEXT("<row r=\"1\">");
-	SheetData += TEXT("<c r=\"A1\" t=\"inlineStr\" s=\"1\"><is><t>Property</t></is></c>");
-	SheetData += TEXT("<c r=\"B1\" t=\"inlineStr\" s=\"1\"><is><t>Value</t></is></c>");
-	SheetData += TEXT("</row>");
+	Writer.BeginRow();
+	Writer.AddCell(TEXT("Property"), 1);
+	Writer.AddCell(TEXT("Value"), 1);
+	Writer.EndRow();
 
 	// Metadata key-value pairs
 	TArray<TPair<FString, FString>> MetaValues = {
@@ -439,66 +365,21 @@ FString FNPCXLSXWriter::GenerateMetaSheet(const TArray<FNPCTableRow>& Rows)
 		{ TEXT("TABLE_TYPE"),     TEXT("NPC") },
 	};
 
-	for (int32 i = 0; i < MetaValues.Num(); i++)
+	for (const TPair<FString, FString>& Meta : MetaValues)
 	{
-		int32 RowNum = i + 2;
-		SheetData += FString::Printf(TEXT("<row r=\"%d\">"), RowNum);
-		SheetData += FString::Printf(TEXT("<c r=\"A%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-			RowNum, *EscapeXml(MetaValues[i].Key));
-		SheetData += FString::Printf(TEXT("<c r=\"B%d\" t=\"inlineStr\"><is><t>%s</t></is></c>"),
-			RowNum, *EscapeXml(MetaValues[i].Value));
-		SheetData += TEXT("</row>");
+		Writer.BeginRow();
+		Writer.AddCell(Meta.Key);
+		Writer.AddCell(Meta.Value);
+		Writer.EndRow();
 	}
 
-	return FString::Printf(TEXT(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>
-<worksheet xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main">
-  <cols>
-    <col min="1" max="1" width="20" customWidth="1"/>
-    <col min="2" max="2" width="40" customWidth="1"/>
-  </cols>
-  <sheetData>%s</sheetData>
-</worksheet>)"), *SheetData);
+	Writer.EndSheet();
 }
 
 //=============================================================================
 // Utility Functions
 //=============================================================================
 
-FString FNPCXLSXWriter::EscapeXml(const FString& Text)
-{
-	// Escape XML special characters to prevent malformed XML
-	FString Result = Text;
-	Result.ReplaceInline(TEXT("&"), TEXT("&amp;"));   // Must be first!
-	Result.ReplaceInline(TEXT("<"), TEXT("&lt;"));
-	Result.ReplaceInline(TEXT(">"), TEXT("&gt;"));
-	Result.ReplaceInline(TEXT("\""), TEXT("&quot;"));
-	Result.ReplaceInline(TEXT("'"), TEXT("&apos;"));
-	return Result;
-}
-
-FString FNPCXLSXWriter::CellReference(int32 Col, int32 Row)
-{
-	// Combine column letter(s) with row number (e.g., "A1", "AA100")
-	return ColumnLetter(Col) + FString::Printf(TEXT("%d"), Row);
-}
-
-FString FNPCXLSXWriter::ColumnLetter(int32 ColIndex)
-{
-	// Convert 0-based index to Excel column letters
-	// 0 = "A", 25 = "Z", 26 = "AA", 27 = "AB", etc.
-	FString Result;
-	int32 Col = ColIndex;
-
-	do
-	{
-		Result = FString::Chr(TEXT('A') + (Col % 26)) + Result;
-		Col = Col / 26 - 1;
-	}
-	while (Col >= 0);
-
-	return Result;
-}
-
 int64 FNPCXLSXWriter::ComputeRowHash(const FNPCTableRow& Row)
 {
 	// Hash all content fields (excludes RowId which is for identity tracking)
@@ -0,0 +1,545 @@
+// GasAbilityGenerator - Streaming XLSX Reader Implementation
+// v7.8.78: Forward-only tag scanner over the UTF-8 bytes of each worksheet entry
+// v7.8.84: Shared string reserve capped by the part size (uniqueCount is untrusted file data)
+
+#include "XLSXSupport/XLSXStreamReader.h"
+#include "HAL/PlatformFileManager.h"
+
+#if WITH_EDITOR
+#include "FileUtilities/ZipArchiveReader.h"
+#endif
+
+namespace XLSXStream
+{
+	/** One scanned tag: local name (namespace prefix stripped) and its attribute bytes */
+	struct FTag
+	{
+		FAnsiStringView Name;
+		FAnsiStringView Attributes;
+		bool bClosing = false;       // </name>
+		bool bSelfClosing = false;   // <name ... />
+	};
+
+	/** XML names and our literals are case-sensitive (TStringView's operator== is not) */
+	static bool Matches(FAnsiStringView A, FAnsiStringView B)
+	{
+		return A.Equals(B, ESearchCase::CaseSensitive);
+	}
+
+	static bool IsSpace(ANSICHAR Ch)
+	{
+		return Ch == ' ' || Ch == '\t' || Ch == '\r' || Ch == '\n';
+	}
+
+	/**
+	 * Advance Pos past the next element tag and describe it. Declarations, processing instructions and
+	 * comments are skipped; text between tags is left for ReadText. Returns false at end of data.
+	 */
+	static bool ReadTag(FAnsiStringView Xml, int32& Pos, FTag& OutTag)
+	{
+		const int32 Num = Xml.Len();
+		while (Pos < Num)
+		{
+			int32 Open = Pos;
+			while (Open < Num && Xml[Open] != '<')
+			{
+				Open++;
+			}
+			if (Open + 1 >= Num)
+			{
+				Pos = Num;
+				return false;
+			}
+
+			// <?xml ...?>, <!-- ... -->, <!DOCTYPE ...>
+			if (Xml[Open + 1] == '?' || Xml[Open + 1] == '!')
+			{
+				const bool bComment = Matches(Xml.Mid(Open, 4), "<!--");
+				const int32 End = bComment ? Xml.Find("-->", Open + 4) : Xml.Find(">", Open + 2);
+				if (End == INDEX_NONE)
+				{
+					Pos = Num;
+					return false;
+				}
+				Pos = End + (bComment ? 3 : 1);
+				continue;
+			}
+
+			int32 Cursor = Open + 1;
+			OutTag.bClosing = Xml[Cursor] == '/';
+			if (OutTag.bClosing)
+			{
+				Cursor++;
+			}
+
+			const int32 NameStart = Cursor;
+			int32 LocalStart = Cursor;
+			while (Cursor < Num && !IsSpace(Xml[Cursor]) && Xml[Cursor] != '/' && Xml[Cursor] != '>')
+			{
+				if (Xml[Cursor] == ':')
+				{
+					LocalStart = Cursor + 1;
+				}
+				Cursor++;
+			}
+			OutTag.Name = Xml.Mid(LocalStart, Cursor - LocalStart);
+
+			// Find the end of the tag; '>' may legally appear inside a quoted attribute value
+			const int32 AttrStart = Cursor;
+			ANSICHAR Quote = 0;
+			while (Cursor < Num && (Quote || Xml[Cursor] != '>'))
+			{
+				const ANSICHAR Ch = Xml[Cursor];
+				if (Quote)
+				{
+					Quote = (Ch == Quote) ? 0 : Quote;
+				}
+				else if (Ch == '"' || Ch == '\'')
+				{
+					Quote = Ch;
+				}
+				Cursor++;
+			}
+			if (Cursor >= Num || Cursor == NameStart)
+			{
+				Pos = Num;
+				return false;
+			}
+
+			OutTag.bSelfClosing = Xml[Cursor - 1] == '/';
+			OutTag.Attributes = Xml.Mid(AttrStart, Cursor - AttrStart - (OutTag.bSelfClosing ? 1 : 0));
+			Pos = Cursor + 1;
+			return true;
+		}
+		return false;
+	}
+
+	/** Raw (still escaped) value of an unprefixed attribute, empty if absent */
+	static FAnsiStringView GetAttribute(FAnsiStringView Attributes, FAnsiStringView AttrName)
+	{
+		int32 Cursor = 0;
+		const int32 Num = Attributes.Len();
+		while (Cursor < Num)
+		{
+			while (Cursor < Num && IsSpace(Attributes[Cursor]))
+			{
+				Cursor++;
+			}
+			const int32 NameStart = Cursor;
+			while (Cursor < Num && Attributes[Cursor] != '=' && !IsSpace(Attributes[Cursor]))
+			{
+				Cursor++;
+			}
+			const FAnsiStringView Name = Attributes.Mid(NameStart, Cursor - NameStart);
+			while (Cursor < Num && (IsSpace(Attributes[Cursor]) || Attributes[Cursor] == '='))
+			{
+				Cursor++;
+			}
+			if (Cursor >= Num || (Attributes[Cursor] != '"' && Attributes[Cursor] != '\''))
+			{
+				return FAnsiStringView();
+			}
+			const ANSICHAR Quote = Attributes[Cursor++];
+			const int32 ValueStart = Cursor;
+			while (Cursor < Num && Attributes[Cursor] != Quote)
+			{
+				Cursor++;
+			}
+			if (Matches(Name, AttrName))
+			{
+				return Attributes.Mid(ValueStart, Cursor - ValueStart);
+			}
+			Cursor++;
+		}
+		return FAnsiStringView();
+	}
+
+	static void AppendCodepoint(FString& Out, uint32 Codepoint)
+	{
+		if (Codepoint == 0 || Codepoint > 0x10FFFF)
+		{
+			return;
+		}
+		if (sizeof(TCHAR) == 2 && Codepoint > 0xFFFF)
+		{
+			Codepoint -= 0x10000;
+			Out.AppendChar(static_cast<TCHAR>(0xD800 + (Codepoint >> 10)));
+			Out.AppendChar(static_cast<TCHAR>(0xDC00 + (Codepoint & 0x3FF)));
+			return;
+		}
+		Out.AppendChar(static_cast<TCHAR>(Codepoint));
+	}
+
+	/** Decode escaped UTF-8 text (entities and character references) and append it */
+	static void AppendDecoded(FAnsiStringView Escaped, FString& Out)
+	{
+		if (Escaped.IsEmpty())
+		{
+			return;
+		}
+
+		int32 Run = 0;
+		auto FlushRun = [&](int32 End)
+		{
+			if (End > Run)
+			{
+				const FUTF8ToTCHAR Converted(Escaped.GetData() + Run, End - Run);
+				Out.AppendChars(Converted.Get(), Converted.Length());
+			}
+		};
+
+		for (int32 Index = 0; Index < Escaped.Len(); ++Index)
+		{
+			if (Escaped[Index] != '&')
+			{
+				continue;
+			}
+			const int32 Semi = Escaped.Find(";", Index + 1);
+			if (Semi == INDEX_NONE || Semi - Index > 10)
+			{
+				continue;   // Stray ampersand - keep it literally
+			}
+
+			FlushRun(Index);
+			const FAnsiStringView Entity = Escaped.Mid(Index + 1, Semi - Index - 1);
+			if (Matches(Entity, "amp")) Out.AppendChar(TEXT('&'));
+			else if (Matches(Entity, "lt")) Out.AppendChar(TEXT('<'));
+			else if (Matches(Entity, "gt")) Out.AppendChar(TEXT('>'));
+			else if (Matches(Entity, "quot")) Out.AppendChar(TEXT('"'));
+			else if (Matches(Entity, "apos")) Out.AppendChar(TEXT('\''));
+			else if (Entity.Len() > 1 && Entity[0] == '#')
+			{
+				const bool bHex = Entity[1] == 'x' || Entity[1] == 'X';
+				uint32 Codepoint = 0;
+				for (const ANSICHAR Ch : Entity.Mid(bHex ? 2 : 1))
+				{
+					const int32 Digit = (Ch >= '0' && Ch <= '9') ? Ch - '0'
+						: (bHex && Ch >= 'a' && Ch <= 'f') ? Ch - 'a' + 10
+						: (bHex && Ch >= 'A' && Ch <= 'F') ? Ch - 'A' + 10 : -1;
+					if (Digit < 0 || Codepoint > 0x10FFFF)
+					{
+						Codepoint = 0;
+						break;
+					}
+					Codepoint = Codepoint * (bHex ? 16 : 10) + Digit;
+				}
+				AppendCodepoint(Out, Codepoint);
+			}
+			else
+			{
+				// Unknown entity - keep it literally
+				const FUTF8ToTCHAR Literal(Escaped.GetData() + Index, Semi - Index + 1);
+				Out.AppendChars(Literal.Get(), Literal.Length());
+			}
+			Index = Semi;
+			Run = Semi + 1;
+		}
+		FlushRun(Escaped.Len());
+	}
+
+	/** Text from Pos up to the next tag (element content of <v> / <t>) */
+	static FAnsiStringView ReadText(FAnsiStringView Xml, int32& Pos)
+	{
+		const int32 Start = Pos;
+		while (Pos < Xml.Len() && Xml[Pos] != '<')
+		{
+			Pos++;
+		}
+		return Xml.Mid(Start, Pos - Start);
+	}
+
+	static int32 ParseInt(FAnsiStringView Digits)
+	{
+		int64 Value = 0;
+		for (const ANSICHAR Ch : Digits)
+		{
+			if (Ch < '0' || Ch > '9' || Value > MAX_int32 / 10)
+			{
+				break;
+			}
+			Value = Value * 10 + (Ch - '0');
+		}
+		return static_cast<int32>(Value);
+	}
+
+	/** Column of a cell reference ("AB12" -> 27), INDEX_NONE if it has no letters */
+	static int32 ParseColumn(FAnsiStringView CellRef)
+	{
+		int32 Index = 0;
+		int32 Letters = 0;
+		for (const ANSICHAR Ch : CellRef)
+		{
+			const ANSICHAR Upper = (Ch >= 'a' && Ch <= 'z') ? static_cast<ANSICHAR>(Ch - ('a' - 'A')) : Ch;
+			if (Upper < 'A' || Upper > 'Z' || Index > FXLSXStreamReader::MaxColumns)
+			{
+				break;
+			}
+			Index = Index * 26 + (Upper - 'A' + 1);
+			Letters++;
+		}
+		return Letters > 0 ? Index - 1 : INDEX_NONE;
+	}
+
+	static FAnsiStringView MakeView(const TArray<uint8>& Data)
+	{
+		return FAnsiStringView(reinterpret_cast<const ANSICHAR*>(Data.GetData()), Data.Num());
+	}
+}
+
+FXLSXStreamReader::FXLSXStreamReader() = default;
+FXLSXStreamReader::~FXLSXStreamReader() = default;
+
+bool FXLSXStreamReader::Open(const FString& FilePath, FString& OutError)
+{
+#if WITH_EDITOR
+	ZipReader.Reset();
+	EntryNames.Reset();
+	SharedStrings.Reset();
+
+	IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath);
+	if (!FileHandle)
+	{
+		OutError = FString::Printf(TEXT("Could not open file: %s"), *FilePath);
+		return false;
+	}
+
+	ZipReader = MakeUnique<FZipArchiveReader>(FileHandle);
+	if (!ZipReader->IsValid())
+	{
+		ZipReader.Reset();
+		OutError = TEXT("Invalid or corrupt XLSX file (not a valid ZIP container)");
+		return false;
+	}
+
+	// Only the directory is read here - entry data is inflated when a sheet is requested
+	EntryNames.Append(ZipReader->GetFileNames());
+
+	TArray<uint8> SharedStringsXml;
+	if (ReadEntry(TEXT("xl/sharedStrings.xml"), SharedStringsXml))
+	{
+		ParseSharedStrings(SharedStringsXml);
+	}
+	return true;
+#else
+	OutError = TEXT("XLSX import requires WITH_EDITOR (Editor builds only)");
+	return false;
+#endif
+}
+
+bool FXLSXStreamReader::HasEntry(const FString& EntryPath) const
+{
+	return EntryNames.Contains(EntryPath);
+}
+
+bool FXLSXStreamReader::ReadEntry(const FString& EntryPath, TArray<uint8>& OutData) const
+{
+#if WITH_EDITOR
+	return ZipReader.IsValid() && HasEntry(EntryPath) && ZipReader->TryReadFile(EntryPath, OutData);
+#else
+	return false;
+#endif
+}
+
+void FXLSXStreamReader::ParseSharedStrings(const TArray<uint8>& XmlData)
+{
+	using namespace XLSXStream;
+
+	const FAnsiStringView Xml = MakeView(XmlData);
+	int32 Pos = 0;
+	FTag Tag;
+	FString Current;
+	bool bInItem = false;
+	bool bInPhonetic = false;
+
+	while (ReadTag(Xml, Pos, Tag))
+	{
+		if (Matches(Tag.Name, "sst") && !Tag.bClosing)
+		{
+			// uniqueCount comes from the file - a corrupt or hostile value must not drive the allocation.
+			// The reserve is only a hint: cap it at one item per 8 bytes of XML (<si><t/></si> is 14).
+			const int32 UniqueCount = ParseInt(GetAttribute(Tag.Attributes, "uniqueCount"));
+			SharedStrings.Reserve(FMath::Clamp(UniqueCount, 0, XmlData.Num() / 8));
+		}
+		else if (Matches(Tag.Name, "si"))
+		{
+			if (Tag.bClosing || Tag.bSelfClosing)
+			{
+				// Index positions must stay aligned with <si> order, so empty items are kept too
+				SharedStrings.Add(MoveTemp(Current));
+				Current.Reset();
+				bInItem = false;
+			}
+			else
+			{
+				bInItem = true;
+			}
+		}
+		else if (Matches(Tag.Name, "rPh") && !Tag.bSelfClosing)
+		{
+			bInPhonetic = !Tag.bClosing;
+		}
+		else if (Matches(Tag.Name, "t") && bInItem && !bInPhonetic && !Tag.bClosing && !Tag.bSelfClosing)
+		{
+			AppendDecoded(ReadText(Xml, Pos), Current);
+		}
+	}
+}
+
+bool FXLSXStreamReader::ReadSheet(const FString& SheetPath, FRowCallback OnRow, FString& OutError) const
+{
+	using namespace XLSXStream;
+
+	TArray<uint8> XmlData;
+	if (!ReadEntry(SheetPath, XmlData))
+	{
+		OutError = FString::Printf(TEXT("Could not find sheet (%s)"), *SheetPath);
+		return false;
+	}
+
+	const FAnsiStringView Xml = MakeView(XmlData);
+	int32 Pos = 0;
+	FTag Tag;
+
+	bool bInSheetData = false;
+	bool bInRow = false;
+	int32 RowNumber = 0;
+	TArray<FString> Cells;
+
+	// Current cell
+	bool bInCell = false;
+	bool bInInlineString = false;
+	bool bInPhonetic = false;
+	int32 CellColumn = 0;
+	FAnsiStringView CellType;
+	FAnsiStringView CellValue;
+	FString CellText;
+
+	auto FinishCell = [&]()
+	{
+		FString Value;
+		if (Matches(CellType, "s"))
+		{
+			const int32 Index = ParseInt(CellValue);
+			if (!CellValue.IsEmpty() && SharedStrings.IsValidIndex(Index))
+			{
+				Value = SharedStrings[Index];
+			}
+		}
+		else if (Matches(CellType, "inlineStr"))
+		{
+			Value = MoveTemp(CellText);
+		}
+		else
+		{
+			AppendDecoded(CellValue, Value);
+		}
+
+		if (CellColumn >= 0 && CellColumn < MaxColumns)
+		{
+			if (Cells.Num() <= CellColumn)
+			{
+				Cells.SetNum(CellColumn + 1);
+			}
+			Cells[CellColumn] = MoveTemp(Value);
+		}
+		bInCell = false;
+	};
+
+	auto FinishRow = [&]() -> bool
+	{
+		bInRow = false;
+		return OnRow(RowNumber, Cells);
+	};
+
+	while (ReadTag(Xml, Pos, Tag))
+	{
+		if (!bInSheetData)
+		{
+			if (Matches(Tag.Name, "sheetData") && !Tag.bClosing)
+			{
+				if (Tag.bSelfClosing)
+				{
+					break;   // <sheetData/> - no rows
+				}
+				bInSheetData = true;
+			}
+			continue;
+		}
+
+		if (Matches(Tag.Name, "sheetData"))
+		{
+			break;   // </sheetData> - worksheet tail (merge cells, validations) is not needed
+		}
+
+		if (Matches(Tag.Name, "row"))
+		{
+			if (Tag.bClosing)
+			{
+				if (bInRow && !FinishRow())
+				{
+					break;
+				}
+				continue;
+			}
+
+			const FAnsiStringView RowRef = GetAttribute(Tag.Attributes, "r");
+			RowNumber = RowRef.IsEmpty() ? RowNumber + 1 : ParseInt(RowRef);
+			Cells.Reset();
+			CellColumn = -1;
+			bInRow = true;
+			if (Tag.bSelfClosing && !FinishRow())
+			{
+				break;
+			}
+		}
+		else if (Matches(Tag.Name, "c") && bInRow)
+		{
+			if (Tag.bClosing)
+			{
+				if (bInCell)
+				{
+					FinishCell();
+				}
+				continue;
+			}
+
+			const int32 RefColumn = ParseColumn(GetAttribute(Tag.Attributes, "r"));
+			CellColumn = RefColumn != INDEX_NONE ? RefColumn : CellColumn + 1;
+			CellType = GetAttribute(Tag.Attributes, "t");
+			CellValue = FAnsiStringView();
+			CellText.Reset();
+			bInInlineString = false;
+			bInPhonetic = false;
+			bInCell = true;
+			if (Tag.bSelfClosing)
+			{
+				FinishCell();
+			}
+		}
+		else if (!bInCell || Tag.bSelfClosing)
+		{
+			continue;
+		}
+		else if (Matches(Tag.Name, "v"))
+		{
+			if (!Tag.bClosing)
+			{
+				CellValue = ReadText(Xml, Pos);
+			}
+		}
+		else if (Matches(Tag.Name, "is"))
+		{
+			bInInlineString = !Tag.bClosing;
+		}
+		else if (Matches(Tag.Name, "rPh"))
+		{
+			bInPhonetic = !Tag.bClosing;
+		}
+		else if (Matches(Tag.Name, "t") && !Tag.bClosing && bInInlineString && !bInPhonetic)
+		{
+			AppendDecoded(ReadText(Xml, Pos), CellText);
+		}
+	}
+
+	return true;
+}
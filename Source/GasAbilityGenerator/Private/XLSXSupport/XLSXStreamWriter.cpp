@@ -0,0 +1,493 @@
+// GasAbilityGenerator - Streaming XLSX Writer Implementation
+// v7.8.79: Chunked deflate zip entries with a shared string table
+// v7.8.84: Temp file + move on Close - write/compression errors leave the target workbook intact
+//
+// FZipArchiveWriter only accepts whole entries, so the zip container is written here: every entry is
+// raw deflate (method 8) with the CRC and sizes in a trailing data descriptor (flag bit 3), which lets
+// the local header go out before the entry's size is known. No zip64 - a part is capped at 4 GB.
+
+#include "XLSXSupport/XLSXStreamWriter.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace XLSXZip
+{
+	static constexpr uint32 LocalHeaderSignature = 0x04034b50;
+	static constexpr uint32 DataDescriptorSignature = 0x08074b50;
+	static constexpr uint32 CentralHeaderSignature = 0x02014b50;
+	static constexpr uint32 EndOfDirectorySignature = 0x06054b50;
+	static constexpr uint16 VersionNeeded = 20;                 // 2.0 - deflate
+	static constexpr uint16 EntryFlags = (1 << 3) | (1 << 11);  // Data descriptor, UTF-8 names
+	static constexpr uint16 MethodDeflate = 8;
+
+	static void Put16(TArray<uint8>& Out, uint16 Value)
+	{
+		Out.Add(static_cast<uint8>(Value & 0xFF));
+		Out.Add(static_cast<uint8>(Value >> 8));
+	}
+
+	static void Put32(TArray<uint8>& Out, uint32 Value)
+	{
+		Put16(Out, static_cast<uint16>(Value & 0xFFFF));
+		Put16(Out, static_cast<uint16>(Value >> 16));
+	}
+}
+
+/** zlib state of the entry currently being written */
+struct FXLSXStreamWriter::FEntryStream
+{
+	z_stream Stream;
+	bool bDeflateReady = false;
+	FDirectoryEntry Record;
+	uint64 UncompressedSize = 0;
+	uint64 CompressedSize = 0;
+};
+
+FXLSXStreamWriter::FXLSXStreamWriter() = default;
+
+FXLSXStreamWriter::~FXLSXStreamWriter()
+{
+	// Abandoned mid-write (Close not reached) - release zlib state and drop the partial temp file
+	if (Entry.IsValid() && Entry->bDeflateReady)
+	{
+		deflateEnd(&Entry->Stream);
+	}
+	DiscardTempFile();
+}
+
+bool FXLSXStreamWriter::Open(const FString& FilePath, FString& OutError)
+{
+	TargetPath = FilePath;
+	TempPath = FilePath + TEXT(".tmp");
+	FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*TempPath));
+	if (!FileHandle.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Cannot write to file: %s"), *TempPath);
+		TempPath.Empty();
+		return false;
+	}
+
+	const FDateTime Now = FDateTime::Now();
+	DosTime = static_cast<uint16>((Now.GetHour() << 11) | (Now.GetMinute() << 5) | (Now.GetSecond() / 2));
+	DosDate = static_cast<uint16>(((FMath::Max(Now.GetYear(), 1980) - 1980) << 9) | (Now.GetMonth() << 5) | Now.GetDay());
+
+	Chunk.Reserve(ChunkSize + 4096);
+	Deflated.SetNumUninitialized(ChunkSize);
+	return true;
+}
+
+void FXLSXStreamWriter::AddPart(const FString& EntryPath, const FString& Xml)
+{
+	BeginEntry(EntryPath);
+	const FTCHARToUTF8 Utf8(*Xml);
+	Chunk.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	EndEntry();
+}
+
+//=============================================================================
+// Worksheets
+//=============================================================================
+
+void FXLSXStreamWriter::BeginSheet(const FString& EntryPath, TConstArrayView<float> ColumnWidths)
+{
+	BeginEntry(EntryPath);
+	AppendAscii("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
+	AppendAscii("<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\">");
+
+	if (ColumnWidths.Num() > 0)
+	{
+		AppendAscii("<cols>");
+		for (int32 Index = 0; Index < ColumnWidths.Num(); ++Index)
+		{
+			ANSICHAR Col[96];
+			FCStringAnsi::Snprintf(Col, UE_ARRAY_COUNT(Col), "<col min=\"%d\" max=\"%d\" width=\"%.1f\" customWidth=\"1\"/>",
+				Index + 1, Index + 1, ColumnWidths[Index]);
+			AppendAscii(Col);
+		}
+		AppendAscii("</cols>");
+	}
+
+	AppendAscii("<sheetData>");
+	RowNumber = 0;
+	ColumnIndex = 0;
+}
+
+void FXLSXStreamWriter::BeginRow()
+{
+	RowNumber++;
+	ColumnIndex = 0;
+	AppendAscii("<row r=\"");
+	AppendNumber(RowNumber);
+	AppendAscii("\">");
+}
+
+void FXLSXStreamWriter::AddCell(FStringView Value, int32 StyleIndex)
+{
+	const int32 Column = ColumnIndex++;
+	if (Value.IsEmpty())
+	{
+		return;
+	}
+
+	// Element ids are dense insertion indices - nothing is ever removed from the set
+	const FSetElementId Id = SharedStrings.Add(FString(Value));
+	SharedStringRefs++;
+
+	AppendAscii("<c r=\"");
+	AppendCellReference(Column, RowNumber);
+	if (StyleIndex > 0)
+	{
+		AppendAscii("\" s=\"");
+		AppendNumber(StyleIndex);
+	}
+	AppendAscii("\" t=\"s\"><v>");
+	AppendNumber(Id.AsInteger());
+	AppendAscii("</v></c>");
+}
+
+void FXLSXStreamWriter::EndRow()
+{
+	AppendAscii("</row>");
+	if (Chunk.Num() >= ChunkSize)
+	{
+		FlushChunk(false);
+	}
+}
+
+void FXLSXStreamWriter::EndSheet()
+{
+	AppendAscii("</sheetData></worksheet>");
+	EndEntry();
+}
+
+bool FXLSXStreamWriter::Close(FString& OutError)
+{
+	if (!FileHandle.IsValid())
+	{
+		OutError = Error.IsEmpty() ? FString(TEXT("XLSX writer is not open")) : Error;
+		return false;
+	}
+	check(!Entry.IsValid());
+
+	// Shared strings go last - the table is only complete once every sheet has been written
+	BeginEntry(TEXT("xl/sharedStrings.xml"));
+	AppendAscii("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
+	AppendAscii("<sst xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\" count=\"");
+	AppendNumber(SharedStringRefs);
+	AppendAscii("\" uniqueCount=\"");
+	AppendNumber(SharedStrings.Num());
+	AppendAscii("\">");
+	for (int32 Index = 0; Index < SharedStrings.Num(); ++Index)
+	{
+		const FString& Value = SharedStrings.Get(FSetElementId::FromInteger(Index));
+		const bool bPreserve = FChar::IsWhitespace(Value[0]) || FChar::IsWhitespace(Value[Value.Len() - 1]);
+		AppendAscii(bPreserve ? "<si><t xml:space=\"preserve\">" : "<si><t>");
+		AppendEscaped(Value);
+		AppendAscii("</t></si>");
+		if (Chunk.Num() >= ChunkSize)
+		{
+			FlushChunk(false);
+		}
+	}
+	AppendAscii("</sst>");
+	EndEntry();
+
+	// Central directory and end record
+	const int64 DirectoryOffset = FileHandle->Tell();
+	TArray<uint8> Trailer;
+	for (const FDirectoryEntry& Record : Directory)
+	{
+		XLSXZip::Put32(Trailer, XLSXZip::CentralHeaderSignature);
+		XLSXZip::Put16(Trailer, XLSXZip::VersionNeeded);   // Version made by
+		XLSXZip::Put16(Trailer, XLSXZip::VersionNeeded);
+		XLSXZip::Put16(Trailer, XLSXZip::EntryFlags);
+		XLSXZip::Put16(Trailer, XLSXZip::MethodDeflate);
+		XLSXZip::Put16(Trailer, DosTime);
+		XLSXZip::Put16(Trailer, DosDate);
+		XLSXZip::Put32(Trailer, Record.Crc);
+		XLSXZip::Put32(Trailer, Record.CompressedSize);
+		XLSXZip::Put32(Trailer, Record.UncompressedSize);
+		XLSXZip::Put16(Trailer, static_cast<uint16>(Record.PathUtf8.Num()));
+		XLSXZip::Put16(Trailer, 0);   // Extra field length
+		XLSXZip::Put16(Trailer, 0);   // Comment length
+		XLSXZip::Put16(Trailer, 0);   // Disk number
+		XLSXZip::Put16(Trailer, 0);   // Internal attributes
+		XLSXZip::Put32(Trailer, 0);   // External attributes
+		XLSXZip::Put32(Trailer, Record.HeaderOffset);
+		Trailer.Append(Record.PathUtf8);
+	}
+	const uint32 DirectorySize = static_cast<uint32>(Trailer.Num());
+
+	XLSXZip::Put32(Trailer, XLSXZip::EndOfDirectorySignature);
+	XLSXZip::Put16(Trailer, 0);   // This disk
+	XLSXZip::Put16(Trailer, 0);   // Directory disk
+	XLSXZip::Put16(Trailer, static_cast<uint16>(Directory.Num()));
+	XLSXZip::Put16(Trailer, static_cast<uint16>(Directory.Num()));
+	XLSXZip::Put32(Trailer, DirectorySize);
+	XLSXZip::Put32(Trailer, static_cast<uint32>(DirectoryOffset));
+	XLSXZip::Put16(Trailer, 0);   // Comment length
+	WriteBytes(Trailer.GetData(), Trailer.Num());
+
+	// Releasing the handle flushes and closes the file
+	FileHandle.Reset();
+
+	if (!Error.IsEmpty())
+	{
+		OutError = Error;
+		DiscardTempFile();
+		return false;
+	}
+
+	// The complete workbook replaces the target in one step
+	if (!IFileManager::Get().Move(*TargetPath, *TempPath, true, true))
+	{
+		// v4.8.4: Improved error message - file lock is most common cause
+		OutError = FString::Printf(TEXT("Cannot write to file: %s\n\nIf the file is open in Excel, please close it and try again."), *TargetPath);
+		DiscardTempFile();
+		return false;
+	}
+	TempPath.Empty();
+	return true;
+}
+
+void FXLSXStreamWriter::DiscardTempFile()
+{
+	FileHandle.Reset();
+	if (!TempPath.IsEmpty())
+	{
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		TempPath.Empty();
+	}
+}
+
+//=============================================================================
+// Zip Entries
+//=============================================================================
+
+void FXLSXStreamWriter::BeginEntry(const FString& EntryPath)
+{
+	check(!Entry.IsValid());
+	Entry = MakeUnique<FEntryStream>();
+	FMemory::Memzero(Entry->Stream);
+
+	// Negative window bits = raw deflate (zip entries carry no zlib header)
+	Entry->bDeflateReady = deflateInit2(&Entry->Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+	if (!Entry->bDeflateReady && Error.IsEmpty())
+	{
+		Error = FString::Printf(TEXT("Failed to initialize compression for %s"), *EntryPath);
+	}
+
+	const FTCHARToUTF8 PathUtf8(*EntryPath);
+	Entry->Record.PathUtf8.Append(reinterpret_cast<const uint8*>(PathUtf8.Get()), PathUtf8.Length());
+	Entry->Record.HeaderOffset = FileHandle.IsValid() ? static_cast<uint32>(FileHandle->Tell()) : 0;
+
+	// CRC and sizes are unknown until the entry ends - they follow the data in the descriptor
+	TArray<uint8> Header;
+	XLSXZip::Put32(Header, XLSXZip::LocalHeaderSignature);
+	XLSXZip::Put16(Header, XLSXZip::VersionNeeded);
+	XLSXZip::Put16(Header, XLSXZip::EntryFlags);
+	XLSXZip::Put16(Header, XLSXZip::MethodDeflate);
+	XLSXZip::Put16(Header, DosTime);
+	XLSXZip::Put16(Header, DosDate);
+	XLSXZip::Put32(Header, 0);   // CRC-32
+	XLSXZip::Put32(Header, 0);   // Compressed size
+	XLSXZip::Put32(Header, 0);   // Uncompressed size
+	XLSXZip::Put16(Header, static_cast<uint16>(Entry->Record.PathUtf8.Num()));
+	XLSXZip::Put16(Header, 0);   // Extra field length
+	Header.Append(Entry->Record.PathUtf8);
+	WriteBytes(Header.GetData(), Header.Num());
+}
+
+void FXLSXStreamWriter::EndEntry()
+{
+	check(Entry.IsValid());
+	FlushChunk(true);
+
+	FEntryStream& Current = *Entry;
+	if (Current.bDeflateReady)
+	{
+		deflateEnd(&Current.Stream);
+		Current.bDeflateReady = false;
+	}
+
+	if ((Current.UncompressedSize > MAX_uint32 || Current.CompressedSize > MAX_uint32) && Error.IsEmpty())
+	{
+		Error = TEXT("XLSX part exceeds 4 GB (zip64 is not supported)");
+	}
+	Current.Record.CompressedSize = static_cast<uint32>(Current.CompressedSize);
+	Current.Record.UncompressedSize = static_cast<uint32>(Current.UncompressedSize);
+
+	TArray<uint8> Descriptor;
+	XLSXZip::Put32(Descriptor, XLSXZip::DataDescriptorSignature);
+	XLSXZip::Put32(Descriptor, Current.Record.Crc);
+	XLSXZip::Put32(Descriptor, Current.Record.CompressedSize);
+	XLSXZip::Put32(Descriptor, Current.Record.UncompressedSize);
+	WriteBytes(Descriptor.GetData(), Descriptor.Num());
+
+	Directory.Add(MoveTemp(Current.Record));
+	Entry.Reset();
+}
+
+void FXLSXStreamWriter::FlushChunk(bool bFinish)
+{
+	if (!Entry.IsValid() || !Entry->bDeflateReady || !Error.IsEmpty())
+	{
+		Chunk.Reset();
+		return;
+	}
+
+	FEntryStream& Current = *Entry;
+	Current.Record.Crc = crc32(Current.Record.Crc, Chunk.GetData(), static_cast<uInt>(Chunk.Num()));
+	Current.UncompressedSize += Chunk.Num();
+
+	Current.Stream.next_in = Chunk.GetData();
+	Current.Stream.avail_in = static_cast<uInt>(Chunk.Num());
+	for (;;)
+	{
+		Current.Stream.next_out = Deflated.GetData();
+		Current.Stream.avail_out = static_cast<uInt>(Deflated.Num());
+		const int Result = deflate(&Current.Stream, bFinish ? Z_FINISH : Z_NO_FLUSH);
+		if (Result == Z_STREAM_ERROR)
+		{
+			Error = TEXT("XLSX compression failed");
+			break;
+		}
+
+		const uint32 Produced = static_cast<uint32>(Deflated.Num()) - Current.Stream.avail_out;
+		Current.CompressedSize += Produced;
+		if (Produced > 0 && !WriteBytes(Deflated.GetData(), Produced))
+		{
+			break;
+		}
+
+		// Without Z_FINISH deflate keeps what it cannot emit yet; a full output buffer means there is more
+		if (bFinish ? Result == Z_STREAM_END : Current.Stream.avail_out != 0)
+		{
+			break;
+		}
+	}
+
+	Chunk.Reset();
+}
+
+bool FXLSXStreamWriter::WriteBytes(const uint8* Data, int64 Size)
+{
+	if (!FileHandle.IsValid() || !Error.IsEmpty())
+	{
+		return false;
+	}
+	if (!FileHandle->Write(Data, Size))
+	{
+		Error = TEXT("Failed to write XLSX file (disk full or file locked?)");
+		return false;
+	}
+	return true;
+}
+
+//=============================================================================
+// UTF-8 Output
+//=============================================================================
+
+void FXLSXStreamWriter::AppendAscii(const ANSICHAR* Text)
+{
+	Chunk.Append(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+}
+
+void FXLSXStreamWriter::AppendNumber(uint32 Value)
+{
+	uint8 Digits[10];
+	int32 Count = 0;
+	do
+	{
+		Digits[Count++] = static_cast<uint8>('0' + Value % 10);
+		Value /= 10;
+	}
+	while (Value > 0);
+
+	while (Count > 0)
+	{
+		Chunk.Add(Digits[--Count]);
+	}
+}
+
+void FXLSXStreamWriter::AppendCellReference(int32 Column, int32 Row)
+{
+	// 0 = "A", 25 = "Z", 26 = "AA" (at most three letters up to XFD)
+	uint8 Letters[4];
+	int32 Count = 0;
+	do
+	{
+		Letters[Count++] = static_cast<uint8>('A' + Column % 26);
+		Column = Column / 26 - 1;
+	}
+	while (Column >= 0 && Count < 4);
+
+	while (Count > 0)
+	{
+		Chunk.Add(Letters[--Count]);
+	}
+	AppendNumber(Row);
+}
+
+void FXLSXStreamWriter::AppendEscaped(FStringView Text)
+{
+	for (int32 Index = 0; Index < Text.Len(); ++Index)
+	{
+		uint32 Code = static_cast<uint32>(Text[Index]);
+
+		if (Code < 0x80)
+		{
+			switch (Code)
+			{
+			case '&': AppendAscii("&amp;"); break;
+			case '<': AppendAscii("&lt;"); break;
+			case '>': AppendAscii("&gt;"); break;
+			case '"': AppendAscii("&quot;"); break;
+			default:
+				// Other control characters are not allowed in XML 1.0 - drop them
+				if (Code >= 0x20 || Code == '\t' || Code == '\n' || Code == '\r')
+				{
+					Chunk.Add(static_cast<uint8>(Code));
+				}
+				break;
+			}
+			continue;
+		}
+
+		// Combine UTF-16 surrogate pairs; a lone surrogate becomes U+FFFD
+		if (Code >= 0xD800 && Code <= 0xDBFF && Index + 1 < Text.Len() &&
+			static_cast<uint32>(Text[Index + 1]) >= 0xDC00 && static_cast<uint32>(Text[Index + 1]) <= 0xDFFF)
+		{
+			Code = 0x10000 + ((Code - 0xD800) << 10) + (static_cast<uint32>(Text[Index + 1]) - 0xDC00);
+			++Index;
+		}
+		else if ((Code >= 0xD800 && Code <= 0xDFFF) || Code > 0x10FFFF)
+		{
+			Code = 0xFFFD;
+		}
+
+		if (Code < 0x800)
+		{
+			Chunk.Add(static_cast<uint8>(0xC0 | (Code >> 6)));
+			Chunk.Add(static_cast<uint8>(0x80 | (Code & 0x3F)));
+		}
+		else if (Code < 0x10000)
+		{
+			Chunk.Add(static_cast<uint8>(0xE0 | (Code >> 12)));
+			Chunk.Add(static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F)));
+			Chunk.Add(static_cast<uint8>(0x80 | (Code & 0x3F)));
+		}
+		else
+		{
+			Chunk.Add(static_cast<uint8>(0xF0 | (Code >> 18)));
+			Chunk.Add(static_cast<uint8>(0x80 | ((Code >> 12) & 0x3F)));
+			Chunk.Add(static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F)));
+			Chunk.Add(static_cast<uint8>(0x80 | (Code & 0x3F)));
+		}
+	}
+}
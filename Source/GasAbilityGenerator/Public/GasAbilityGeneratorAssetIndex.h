@@ -0,0 +1,78 @@
+// GasAbilityGenerator v7.8.84 - Name-indexed asset lookup
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.64: FGeneratorAssetIndex - Blueprint/UserDefinedEnum lookup by name, negative cache
+// v7.8.68: AddPendingAsset - generated assets whose registry notification is batched
+// v7.8.83: RemovePendingAsset - a pending asset whose queued save was replaced
+// v7.8.84: Shutdown - unbinds the Asset Registry events on module shutdown
+//
+// Session-scoped AssetName -> FAssetData index for Blueprint and UserDefinedEnum assets.
+// Replaces per-lookup GetAssetsByClass + linear name scans in FGeneratorBase::FindParentClass,
+// FGeneratorBase::FindUserDefinedEnum and FGasAbilityGeneratorFunctionResolver::FindClassByName.
+// Kept current via Asset Registry add/remove/rename events; also holds a negative cache for
+// names that failed full resolution.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+class GASABILITYGENERATOR_API FGeneratorAssetIndex
+{
+public:
+	/**
+	 * Blueprint assets (any UBlueprint subclass) named AssetName, case-insensitive, registry order.
+	 * Builds the index on first use. Returns false if no Blueprint has this name.
+	 */
+	static bool FindBlueprints(FName AssetName, TArray<FAssetData>& OutAssets);
+
+	/** UserDefinedEnum assets named AssetName (case-insensitive) */
+	static bool FindUserDefinedEnums(FName AssetName, TArray<FAssetData>& OutAssets);
+
+	/**
+	 * Negative cache - names that failed a full lookup this session.
+	 * Domain separates lookups with different fallbacks (e.g. "ParentClass", "Enum").
+	 * Cleared whenever an asset is added or renamed, since that may make the name resolvable.
+	 */
+	static bool IsKnownMissing(const TCHAR* Domain, const FString& Name);
+	static void MarkMissing(const TCHAR* Domain, const FString& Name);
+
+	/**
+	 * v7.8.68: Index an in-memory asset the Asset Registry hasn't been told about yet
+	 * (save batch defers AssetCreated to the flush). Same effect as the OnAssetAdded event.
+	 */
+	static void AddPendingAsset(const FAssetData& AssetData);
+
+	/** v7.8.83: Undo AddPendingAsset (its queued save was replaced before the flush) */
+	static void RemovePendingAsset(const FAssetData& AssetData);
+
+	/** Drop the index and negative cache (call at generation session start) */
+	static void Reset();
+
+	/** Build the index now if it isn't built (scans NarrativePro content first) */
+	static void EnsureBuilt();
+
+	/** v7.8.84: Unbind the Asset Registry events and drop the index (module shutdown / reload) */
+	static void Shutdown();
+
+	/** Lookup stats for logging */
+	static int32 GetIndexedBlueprintCount();
+	static int32 GetNegativeHitCount();
+
+private:
+	static void OnAssetAdded(const FAssetData& AssetData);
+	static void OnAssetRemoved(const FAssetData& AssetData);
+	static void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	static void AddToIndex(const FAssetData& AssetData);
+	static void RemoveFromIndex(FName AssetName, const FSoftObjectPath& ObjectPath);
+
+	static FCriticalSection IndexLock;
+	static TMap<FName, TArray<FAssetData>> BlueprintsByName;
+	static TMap<FName, TArray<FAssetData>> EnumsByName;
+	static TSet<FString> MissingNames;
+	static int32 NegativeHits;
+	static bool bBuilt;
+	static FDelegateHandle AssetAddedHandle;    // v7.8.84: Kept for Shutdown
+	static FDelegateHandle AssetRemovedHandle;
+	static FDelegateHandle AssetRenamedHandle;
+};
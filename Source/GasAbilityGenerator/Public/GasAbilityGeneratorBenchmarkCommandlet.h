@@ -0,0 +1,57 @@
+// GasAbilityGeneratorBenchmarkCommandlet.h
+// v7.8.71: Benchmark suite for parser, pre-validator, scheduler and generators
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GasAbilityGeneratorBenchmarkCommandlet.generated.h"
+
+class FJsonObject;
+
+/**
+ * Synthesizes manifests of configurable scale from a template manifest and times each pipeline stage.
+ *
+ * Usage (headless, Linux/Windows):
+ *   UnrealEditor-Cmd ProjectName.uproject -run=GasAbilityGeneratorBenchmark -unattended -nullrhi
+ *
+ * Parameters:
+ *   -template=<path>   : Template manifest (default: <plugin>/ClaudeContext/manifest.yaml)
+ *   -scales=<list>     : Comma-separated target asset counts (default: 1000,10000,50000)
+ *   -iterations=<N>    : Timed repetitions per stage, median reported (default: 3)
+ *   -output=<path>     : Results JSON (default: Saved/GasAbilityGenerator/Benchmarks/Benchmark_<version>_<timestamp>.json)
+ *   -nodryrun          : Skip the dry-run generation stage
+ *   -full              : Also run one full generation per scale (writes assets under /Game/GasAbilityGeneratorBenchmark)
+ *
+ * Each template copy renames every manifest asset with a _B<copy> suffix (references included), so a
+ * synthesized manifest keeps the template's section mix and dependency shape at N times the size.
+ * Stages: parseManifest, preValidate, dependencyGraph, prepare, dryRunGeneration, fullGeneration.
+ * Generation stages run through UGasAbilityGeneratorCommandlet and report its profiler phases.
+ * v7.8.83: They pass -force -noincremental -noparsecache, so content or snapshots left by earlier
+ * runs never turn a run into the skip path.
+ * v7.8.84: A generation run that fails (non-zero exit) or records no Generate phase contributes no
+ * sample and fails the benchmark.
+ */
+UCLASS()
+class GASABILITYGENERATOR_API UGasAbilityGeneratorBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGasAbilityGeneratorBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** {medianMs, minMs, maxMs, samplesMs} */
+	static TSharedRef<FJsonObject> MakeStageStats(TArray<double> SamplesMs);
+
+	/** Time Iterations runs of Stage (Setup runs untimed before each) */
+	static TSharedRef<FJsonObject> TimeStage(int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Stage);
+
+	/**
+	 * Run the generation commandlet on ManifestPath; returns {exitCode, wallMs, phases} with phases in ms.
+	 * v7.8.84: Also generateMs (the Generate phase), only when the run succeeded and recorded that phase.
+	 */
+	static TSharedRef<FJsonObject> RunGeneration(const FString& ManifestPath, bool bDryRun);
+};
@@ -1,6 +1,11 @@
 // GasAbilityGeneratorCommandlet.h
 // Commandlet for automated asset generation from command line
 // v4.25: Dependency ordering with cascade skip logic
+// v7.8.66: Scheduler-driven generation order
+// v7.8.70: -profile trace/CSV export
+// v7.8.72: Incremental regeneration (-noincremental to disable)
+// v7.8.73: -watch mode
+// v7.8.83: On-disk parse cache (-noparsecache to disable)
 
 #pragma once
 
@@ -13,25 +18,7 @@ struct FManifestData;
 struct FGenerationResult;
 struct FGenerationSummary;
 class FDependencyGraph;
-
-/**
- * v2.6.7: Deferred asset info for retry mechanism
- */
-struct FDeferredAsset
-{
-	FString AssetName;
-	FString AssetType;  // "ActorBlueprint", "GameplayAbility", "GameplayEffect", etc.
-	FString MissingDependency;
-	FString MissingDependencyType;
-	int32 DefinitionIndex;  // Index in the manifest array for this asset type
-	int32 RetryCount = 0;
-
-	FDeferredAsset() : DefinitionIndex(-1) {}
-	FDeferredAsset(const FString& InName, const FString& InType, const FString& InMissingDep,
-		const FString& InMissingDepType, int32 InIndex)
-		: AssetName(InName), AssetType(InType), MissingDependency(InMissingDep)
-		, MissingDependencyType(InMissingDepType), DefinitionIndex(InIndex) {}
-};
+class FManifestSectionCache;
 
 /**
  * Commandlet to generate assets from a YAML manifest without opening the editor UI.
@@ -45,8 +32,18 @@ struct FDeferredAsset
  *   -assets           : Generate assets
  *   -all              : Generate both tags and assets (default)
  *   -output=<path>    : Output log file path (optional)
+ *   -profile          : Write a Chrome trace (.json) and per-asset CSV to Saved/GasAbilityGenerator/Profiles
+ *   -noincremental    : Run every manifest asset's generator instead of only the change set
+ *   -noparsecache     : Always parse the manifest instead of loading Saved/GasAbilityGenerator/ParseCache
+ *   -watch            : Stay running; re-run on saves to the manifest, incremental *.yaml files beside it
+ *                       or the -dialoguecsv file (Ctrl+C to stop)
+ *   -debounce=<sec>   : Watch mode quiet period before a pass starts (default 0.75)
  *
- * v2.6.7: Automatic dependency resolution with retry mechanism
+ * v7.8.66: Assets generated in dependency order (FGenerationScheduler); no deferred retry passes
+ * v7.8.72: Only definitions whose input hash changed since the last run (plus their transitive
+ *          dependents) are generated; the rest are reported as skipped. -force regenerates everything.
+ * v7.8.73: Watch passes reparse only the manifest sections whose text changed and apply incremental files
+ *          (asset_name: files, whitelisted assets only) over the manifest definitions.
  */
 UCLASS()
 class GASABILITYGENERATOR_API UGasAbilityGeneratorCommandlet : public UCommandlet
@@ -59,24 +56,24 @@ public:
 	virtual int32 Main(const FString& Params) override;
 
 private:
+	// v7.8.73: One generation pass (the former Main body); Main loops it in watch mode
+	int32 RunGeneration(const FString& Params);
+	int32 RunWatchLoop(const FString& Params);
+
 	void GenerateTags(const FManifestData& ManifestData);
 	void GenerateAssets(const FManifestData& ManifestData);
 
-	// v2.6.7: Retry deferred assets
-	void ProcessDeferredAssets(const FManifestData& ManifestData);
-	bool TryGenerateDeferredAsset(const FDeferredAsset& Deferred, const FManifestData& ManifestData, FGenerationResult& OutResult);
-	bool IsDependencyResolved(const FString& DependencyName, const FString& DependencyType) const;
-
 	void LogMessage(const FString& Message);
 	void LogError(const FString& Message);
 
+	// v7.8.70: Export the profiling session and log the slowest phases
+	void WriteProfile();
+
 	FString OutputLogPath;
 	TArray<FString> LogMessages;
 
-	// v2.6.7: Deferred asset tracking
-	TArray<FDeferredAsset> DeferredAssets;
-	TSet<FString> GeneratedAssets;  // Track successfully generated assets for dependency checking
-	static constexpr int32 MaxRetryAttempts = 3;
+	// v2.6.7: Assets generated or already up to date this run
+	TSet<FString> GeneratedAssets;
 
 	// v2.8.4: Verification tracking
 	TSet<FString> ProcessedAssets;  // Track ALL processed assets (new + skipped + failed)
@@ -93,6 +90,14 @@ private:
 	int64 CachedManifestHash = 0;
 	bool bCachedForceMode = false;
 
+	// v7.8.72: Incremental regeneration
+	bool bIncrementalMode = true;
+
+	// v7.8.73: Watch mode - section fragments kept between passes
+	bool bWatchMode = false;
+	TSharedPtr<FManifestSectionCache> WatchSectionCache;
+	FString CachedDialogueCSVPath;
+
 	// v3.9.9: Level actor placement
 	void GenerateLevelActors(const FManifestData& ManifestData, UWorld* TargetWorld);
 	void SaveWorldPackage(UWorld* World);
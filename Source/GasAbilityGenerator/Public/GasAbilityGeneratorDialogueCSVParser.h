@@ -54,14 +54,16 @@ struct FParsedDialogueData
 	/** Compute hash for v3.0 change detection */
 	uint64 ComputeHash() const
 	{
-		FString Combined;
-		Combined += DialogueName;
+		// v7.8.83: Length-prefixed fields - plain concatenation hashed "ab"+"c" the same as "a"+"bc"
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("DialogueName"), DialogueName);
+		Hash.Field(TEXT("Nodes"), Nodes.Num());
 		for (const auto& Node : Nodes)
 		{
-			Combined += Node.NodeID + Node.Type + Node.Speaker + Node.Text +
-			            Node.OptionText + Node.Replies + Node.Conditions + Node.Events;
+			Hash.Add(Node.NodeID).Add(Node.Type).Add(Node.Speaker).Add(Node.Text)
+				.Add(Node.OptionText).Add(Node.Replies).Add(Node.Conditions).Add(Node.Events);
 		}
-		return FCrc::StrCrc32(*Combined);
+		return Hash.Finalize();
 	}
 };
 
@@ -109,6 +111,14 @@ public:
 	 */
 	static bool ConvertToManifestDefinition(const FParsedDialogueData& ParsedData, FManifestDialogueBlueprintDefinition& OutDefinition);
 
+	/**
+	 * v7.8.83: Merge CSV dialogues into manifest data (CSV overrides YAML definitions of the same name)
+	 * Shared by the commandlet (-dialoguecsv=) and the generator window.
+	 * @param CSVDialogues Output of ParseCSVFile
+	 * @param ManifestData Manifest data to update
+	 */
+	static void ApplyToManifest(const TArray<FManifestDialogueBlueprintDefinition>& CSVDialogues, FManifestData& ManifestData);
+
 private:
 
 	/** Parse a single CSV line into a row struct */
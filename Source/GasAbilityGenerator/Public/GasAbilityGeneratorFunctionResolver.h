@@ -1,5 +1,8 @@
-// GasAbilityGenerator v4.31 - Function Resolution Parity System
+// GasAbilityGenerator v7.8.84 - Function Resolution Parity System
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v4.31: Shared resolver - identical function resolution for Generator and PreValidator
+// v7.8.65: Memoizing resolution cache (steps 1-4) shared by Generator and PreValidator, with stats
+// v7.8.84: Shutdown removes the Blueprint compile hook
 //
 // Shared function resolver for Generator and PreValidator.
 // Implements identical resolution behavior per PreValidator_Generator_Parity_Audit_v1.md.
@@ -30,6 +33,29 @@ struct GASABILITYGENERATOR_API FResolvedFunction
 	FString ResolutionPath;
 };
 
+/**
+ * v7.8.65: Resolution cache counters (one run = between ResetResolutionCache calls)
+ */
+struct GASABILITYGENERATOR_API FFunctionResolverCacheStats
+{
+	int32 Hits = 0;
+	int32 Misses = 0;
+	int32 Invalidations = 0;
+	int32 Entries = 0;
+
+	float GetHitRate() const
+	{
+		const int32 Total = Hits + Misses;
+		return Total > 0 ? static_cast<float>(Hits) / static_cast<float>(Total) : 0.0f;
+	}
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("FunctionResolver cache: %d hits, %d misses (%.1f%% hit rate), %d entries, %d invalidated"),
+			Hits, Misses, GetHitRate() * 100.0f, Entries, Invalidations);
+	}
+};
+
 /**
  * Shared function resolver for Generator and PreValidator.
  *
@@ -93,7 +119,30 @@ public:
 	 */
 	static UClass* FindClassByName(const FString& ClassName);
 
+	/**
+	 * v7.8.65: Resolution cache control.
+	 * Steps 1-4 (WellKnown, explicit class, Blueprint asset, parent chain, library fallback) are
+	 * memoized on (FunctionName, ExplicitClassName, ParentClass, bTargetSelf), including misses.
+	 * Step 5 depends on the Blueprint being generated and is never cached.
+	 * Entries touching a Blueprint are dropped when that Blueprint is compiled in-session.
+	 */
+	static void ResetResolutionCache();
+	static FFunctionResolverCacheStats GetResolutionCacheStats();
+
+	/** v7.8.84: Remove the Blueprint compile hook and drop the cache (module shutdown / reload) */
+	static void Shutdown();
+
 private:
+	/** v7.8.65: Steps 1-4 of the cascade (cacheable part) */
+	static FResolvedFunction ResolveUncached(
+		const FString& FunctionName,
+		const FString& ExplicitClassName,
+		UClass* ParentClass,
+		bool bTargetSelf);
+
+	/** v7.8.65: Drop cache entries that depend on a Blueprint about to be recompiled */
+	static void OnBlueprintPreCompile(class UBlueprint* Blueprint);
+
 	/** Initialize WellKnownFunctions table if not already done */
 	static void EnsureWellKnownFunctionsInitialized();
 
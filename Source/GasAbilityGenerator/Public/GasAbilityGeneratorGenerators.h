@@ -1,5 +1,12 @@
-// GasAbilityGenerator v7.8.56
+// GasAbilityGenerator v7.8.84
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.84: MODIFY'd packages bypass the save batch (their old file is already deleted)
+// v7.8.83: Save batch drops replaced queued assets, verifies writes against the pre-save file stamp
+// v7.8.72: IsUpToDateInRegistry - registry fast-path evidence for incremental change sets
+// v7.8.69: Compile batch - all Blueprint compiles routed through FGeneratorBase::CompileBlueprint, GC batched
+// v7.8.68: Save batch - queued package saves flushed in one pass with a single registry update
+// v7.8.67: Prepared input hashes / package stats from the parallel prepare stage (GetInputHash)
+// v7.8.62: ComputeOutputHash(Asset, HashVersion) for hash algorithm migration
 // v7.8.56: GA_FatherMark - ArrayLength, ArrayRemove, ArrayRemoveIndex for mark limit/rotation
 // v3.0: Regen/Diff Safety System - metadata tracking, dry run mode, hash-based change detection
 // v2.8.3: Function override support for parent class functions (HandleDeath, etc.)
@@ -22,6 +29,9 @@
 #include "CoreMinimal.h"
 #include "Locked/GasAbilityGeneratorTypes.h"
 #include "Locked/GasAbilityGeneratorMetadata.h"
+#include "HAL/FileManager.h"  // v7.8.67: FFileStatData for prepared package stats
+#include "UObject/StrongObjectPtr.h"  // v7.8.68: Queued saves keep their packages alive
+#include "AssetRegistry/AssetData.h"  // v7.8.83: Pending asset entries in the save batch
 
 // Forward declarations
 class UBlueprint;
@@ -39,6 +49,7 @@ class UK2Node;
 class UK2Node_CallFunction;
 class UEdGraph;
 class UEdGraphPin;
+class FCompilerResultsLog;
 
 /**
  * v7.8.31: Result of pin connection attempt
@@ -57,6 +68,26 @@ enum class EConnectResult : uint8
  */
 typedef TFunction<void(const FString&)> FGeneratorLogCallback;
 
+/**
+ * v7.8.68: Outcome of FGeneratorBase::FlushSaveBatch
+ */
+struct FSaveBatchResult
+{
+	int32 SavedCount = 0;
+	TArray<FString> FailedAssets;   // AssetName of each queued package that did not reach disk
+	double Seconds = 0.0;
+};
+
+/**
+ * v7.8.69: Outcome of FGeneratorBase::FlushCompileBatch
+ */
+struct FCompileBatchResult
+{
+	int32 CompileCount = 0;
+	int32 GarbageCollections = 0;   // Including the final one at flush
+	double CompileSeconds = 0.0;
+};
+
 /**
  * Base generator class - all generators inherit from this
  */
@@ -243,6 +274,12 @@ public:
 	 */
 	static uint64 ComputeDataAssetOutputHash(UObject* DataAsset);
 
+	/**
+	 * v7.8.62: Output hash of any generated asset using the algorithm a metadata record was written with
+	 * @param HashVersion FGeneratorMetadata::HashVersion (GeneratorHash::LegacyVersion for pre-v7.8.62 records)
+	 */
+	static uint64 ComputeOutputHash(UObject* Asset, int32 HashVersion = GeneratorHash::Version);
+
 	/**
 	 * Enable/disable dry run mode
 	 * In dry run mode, generators compute what would happen without making changes
@@ -314,6 +351,53 @@ public:
 		FGenerationResult& OutResult,
 		EDryRunStatus* OutDryRunStatus = nullptr);
 
+	/**
+	 * v7.8.67: Publish results of the parallel prepare stage before the game-thread commit stage
+	 * @param InputHashes Definition address -> ComputeHash() (exact definition instance, so duplicate names can't collide)
+	 * @param PackageStats Asset path -> package file stat, consumed by the first CheckExistsWithMetadata for that path
+	 */
+	static void SetPreparedState(TMap<const void*, uint64>&& InputHashes, TMap<FString, FFileStatData>&& PackageStats);
+
+	/** v7.8.67: Drop prepared state (end of run) */
+	static void ClearPreparedState();
+
+	/**
+	 * v7.8.72: Registry fast-path evidence without a result - record matches InputHash and the current
+	 * generator/hash versions, and the package file is unchanged since the record was written.
+	 * Used by incremental runs to leave a job out of the change set; false whenever CheckExistsWithMetadata
+	 * could reach a different verdict than SKIP.
+	 */
+	static bool IsUpToDateInRegistry(const FString& PackagePath, uint64 InputHash, const FFileStatData* PreparedStat = nullptr);
+
+	/** v7.8.67: Input hash of a definition - prepared value when the prepare stage hashed this instance, else computed now */
+	template <typename TDefinition>
+	static uint64 GetInputHash(const TDefinition& Definition)
+	{
+		if (const uint64* Prepared = PreparedInputHashes.Find(&Definition))
+		{
+			return *Prepared;
+		}
+		return Definition.ComputeHash();
+	}
+
+	/**
+	 * v7.8.68: Batched package saving
+	 * While a batch is open, SafeSavePackage and NotifyAssetCreated queue instead of acting immediately.
+	 * FlushSaveBatch() saves every queued package in one pass (async file writes, one wait for all of
+	 * them) and updates the Asset Registry with a single scan of the saved files. Queued assets stay in
+	 * memory until the flush and are added to FGeneratorAssetIndex on notify, so same-session lookups
+	 * still resolve them.
+	 * v7.8.84: A package whose old file was deleted by the MODIFY path is saved immediately instead -
+	 * it would otherwise have no file on disk until the end-of-run flush.
+	 */
+	static void BeginSaveBatch();
+	static bool IsSaveBatchActive() { return bSaveBatchActive; }
+	static FSaveBatchResult FlushSaveBatch();
+
+	/** v7.8.69: Compile batch - see CompileBlueprint. Flush after the save batch (runs the deferred GC). */
+	static void BeginCompileBatch();
+	static FCompileBatchResult FlushCompileBatch();
+
 protected:
 	/**
 	 * Log generation message to editor output
@@ -331,6 +415,19 @@ protected:
 	 */
 	static bool SafeSavePackage(UPackage* Package, UObject* Asset, const FString& PackageFileName, const FString& AssetName);
 
+	/** v7.8.68: FAssetRegistryModule::AssetCreated, deferred to FlushSaveBatch while a save batch is open */
+	static void NotifyAssetCreated(UObject* Asset);
+
+	/**
+	 * v7.8.69: All generator Blueprint compiles go through here.
+	 * Outside a compile batch this is FKismetEditorUtilities::CompileBlueprint. Inside one, the
+	 * per-compile garbage collection is skipped and run once every CompileGCInterval compiles
+	 * (and at FlushCompileBatch) instead - each full compile otherwise ends in its own GC pass.
+	 * @param Results Compiler log for the Contract 10 compile gate (may be null)
+	 * @param bSkipGarbageCollection Never collect at this compile (skeleton syncs mid-graph)
+	 */
+	static void CompileBlueprint(UBlueprint* Blueprint, FCompilerResultsLog* Results = nullptr, bool bSkipGarbageCollection = false);
+
 	/**
 	 * v4.22: Get the active manifest for reference checking
 	 * Used to determine if a referenced asset is defined in the manifest (vs external plugin)
@@ -356,6 +453,36 @@ private:
 	static FDryRunSummary DryRunSummary;
 	static FString CurrentManifestPath;
 
+	// v7.8.67: Prepare-stage results (game thread only; published after the parallel stage completes)
+	static TMap<const void*, uint64> PreparedInputHashes;
+	static TMap<FString, FFileStatData> PreparedPackageStats;
+
+	// v7.8.68: Save batch (game thread only)
+	struct FQueuedPackageSave
+	{
+		TStrongObjectPtr<UPackage> Package;
+		TStrongObjectPtr<UObject> Asset;
+		FString PackageFileName;
+		FString AssetName;
+		FFileStatData PreSaveStat;  // v7.8.83: Package file before the save - an unchanged stamp means the write didn't land
+	};
+	struct FQueuedAssetCreation
+	{
+		TStrongObjectPtr<UObject> Asset;
+		FAssetData AssetData;  // As given to FGeneratorAssetIndex::AddPendingAsset
+	};
+	static bool bSaveBatchActive;
+	static TArray<FQueuedPackageSave> QueuedSaves;
+	static TMap<FString, int32> QueuedSaveIndexByPackage;
+	static TMap<UObject*, FQueuedAssetCreation> QueuedAssetCreations;  // Notified while batching, keyed for de-dup
+	static TSet<FString> ImmediateSavePackages;  // v7.8.84: Old file deleted for MODIFY - never left waiting on the flush
+
+	// v7.8.69: Compile batch
+	static constexpr int32 CompileGCInterval = 32;
+	static bool bCompileBatchActive;
+	static int32 CompilesSinceGC;
+	static FCompileBatchResult CompileBatchStats;
+
 	// v7.5.5: Log callback for commandlet integration
 	static FGeneratorLogCallback LogCallback;
 
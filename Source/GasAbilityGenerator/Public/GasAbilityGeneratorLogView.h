@@ -0,0 +1,117 @@
+// GasAbilityGenerator v7.8.74 - Generator window log view
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+//
+// Virtualized log for SGasAbilityGeneratorWindow. AddMessage only queues the line (and streams it to
+// the log file); queued lines move into a bounded ring buffer once per frame, and the SListView lays out
+// just the rows on screen. Appending is O(1) however long the log gets. When the ring buffer is full the
+// oldest lines drop out of the view - the file under Saved/GasAbilityGenerator/Logs keeps everything.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Styling/SlateTypes.h"
+
+class ITableRow;
+class STableViewBase;
+class STextBlock;
+
+/**
+ * v7.8.74: Severity, classified from the message text (ERROR / WARNING / [NEW] / [SKIP] / [FAIL])
+ */
+enum class EGeneratorLogSeverity : uint8
+{
+	Info,
+	Success,   // [NEW]
+	Skip,      // [SKIP]
+	Warning,
+	Error
+};
+
+/**
+ * v7.8.74: One displayed log line
+ */
+struct FGeneratorLogLine
+{
+	FString Text;
+	FString AssetName;   // From "[NEW|SKIP|FAIL|...] <AssetName>" lines, empty otherwise
+	EGeneratorLogSeverity Severity = EGeneratorLogSeverity::Info;
+	int64 Sequence = 0;  // Monotonic - orders the filtered view against ring buffer eviction
+};
+
+/**
+ * v7.8.74: Ring-buffered, filterable log list (game thread only)
+ */
+class GASABILITYGENERATOR_API SGeneratorLogView : public SCompoundWidget
+{
+public:
+	static constexpr int32 DefaultMaxLines = 20000;
+
+	SLATE_BEGIN_ARGS(SGeneratorLogView)
+		: _MaxLines(DefaultMaxLines)
+	{}
+		/** Ring buffer capacity (lines kept for display) */
+		SLATE_ARGUMENT(int32, MaxLines)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+	virtual ~SGeneratorLogView();
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	/** Queue a message (split on newlines); shown on the next frame */
+	void AddMessage(const FString& Message);
+
+	/** Clear the view - the log file is not truncated */
+	void Clear();
+
+	/** Selected lines, or every line passing the filter when nothing is selected */
+	FString GetCopyText() const;
+
+	const FString& GetLogFilePath() const { return LogFilePath; }
+
+	/** Classify one line: severity and, for per-asset result lines, the asset name */
+	static EGeneratorLogSeverity ClassifyLine(const FString& Line, FString& OutAssetName);
+
+private:
+	using FLogLinePtr = TSharedPtr<FGeneratorLogLine>;
+
+	/** Move queued lines into the ring buffer and filtered view; one list refresh per batch */
+	void FlushPending();
+
+	/** Rebuild FilteredLines from the ring buffer (filter changed) */
+	void RebuildFilteredLines();
+
+	bool PassesFilter(const FGeneratorLogLine& Line) const;
+	int32 GetRingLineCount() const { return Ring.Num(); }
+	const FLogLinePtr& GetRingLine(int32 Index) const { return Ring[(RingHead + Index) % Ring.Num()]; }
+
+	TSharedRef<ITableRow> OnGenerateRow(FLogLinePtr Line, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnFilterTextChanged(const FText& NewText);
+	void OnSeverityFilterChanged(ECheckBoxState NewState, EGeneratorLogSeverity Severity);
+	ECheckBoxState IsSeverityShown(EGeneratorLogSeverity Severity) const;
+	FText GetLineCountText() const;
+
+	void OpenLogFile();
+	void CloseLogFile();
+
+	int32 MaxLines = DefaultMaxLines;
+
+	// Ring buffer: grows to MaxLines, then RingHead marks the oldest line and is overwritten first
+	TArray<FLogLinePtr> Ring;
+	int32 RingHead = 0;
+	int64 NextSequence = 0;
+	int64 TotalLineCount = 0;
+
+	TArray<FLogLinePtr> PendingLines;
+	TArray<FLogLinePtr> FilteredLines;   // SListView items, oldest first
+
+	FString FilterText;
+	uint8 HiddenSeverities = 0;          // Bit per EGeneratorLogSeverity
+
+	TSharedPtr<SListView<FLogLinePtr>> ListView;
+
+	FString LogFilePath;
+	TUniquePtr<FArchive> LogFile;
+};
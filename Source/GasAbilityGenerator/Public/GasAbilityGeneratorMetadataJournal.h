@@ -0,0 +1,65 @@
+// GasAbilityGenerator v7.8.84 - Metadata registry write-ahead journal
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.76: Append-only journal of registry record changes, replayed after an interrupted run
+// v7.8.84: A journal is counted once per replay-to-compaction cycle (registry reloads re-apply, don't re-count)
+//
+// Every UGeneratorMetadataRegistry mutation is appended to Saved/GasAbilityGenerator/Journal as one
+// line while the run is going; the registry package itself is written once, at the end of the run
+// (SaveRegistryIfNeeded), after which the journal is deleted. A run that is killed before that save
+// leaves the journal behind, and the next registry load replays it - so records of packages that did
+// reach disk are not lost, and the end-of-run save is skipped entirely when nothing changed.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGeneratorMetadataRecord;
+class UGeneratorMetadataRegistry;
+
+/**
+ * v7.8.76: Append-only journal of registry record changes (thread-safe)
+ *
+ * Line format (UTF-8, tab-separated):
+ *   GASGEN_METADATA_JOURNAL <version> <registry package>   header
+ *   S <utc ticks> <asset path> <record json>               SetRecord
+ *   R <utc ticks> <asset path>                             RemoveRecord
+ *   C <utc ticks>                                          ClearAllRecords
+ */
+class GASABILITYGENERATOR_API FGeneratorMetadataJournal
+{
+public:
+	static FGeneratorMetadataJournal& Get();
+	static FString GetJournalPath();
+
+	void RecordSet(const FString& RegistryPackage, const FString& AssetPath, const FGeneratorMetadataRecord& Record);
+	void RecordRemove(const FString& RegistryPackage, const FString& AssetPath);
+	void RecordClear(const FString& RegistryPackage);
+
+	/**
+	 * Apply a journal left by a run that never reached its registry save. A set is applied only if its
+	 * package file was written after the entry (a record for a package that never hit disk would claim
+	 * an up-to-date asset); replayed records carry no package file stamp, so the registry fast path
+	 * stays inconclusive for them and the asset itself is checked. The journal is kept until the
+	 * registry is saved. Returns the number of entries applied.
+	 * v7.8.84: A registry reloaded after GC (before the save) gets the entries applied again - the fresh
+	 * object doesn't have them - but they count towards HasUncompactedChanges only once.
+	 */
+	int32 Replay(UGeneratorMetadataRegistry& Registry);
+
+	/** Changes since the last compaction (appended this session or replayed) */
+	bool HasUncompactedChanges() const;
+
+	/** The registry package was saved - its contents supersede the journal */
+	void Compacted();
+
+private:
+	FGeneratorMetadataJournal() = default;
+
+	void AppendLine(const FString& RegistryPackage, const FString& Line);
+	void CloseWriter();
+
+	mutable FCriticalSection Lock;
+	TUniquePtr<FArchive> Writer;
+	int32 UncompactedCount = 0;
+	bool bReplayed = false;   // v7.8.84: The journal file's entries are already counted (until Compacted)
+};
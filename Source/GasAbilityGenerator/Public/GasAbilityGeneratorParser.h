@@ -1,5 +1,13 @@
-// GasAbilityGenerator v3.9
+// GasAbilityGenerator v7.8.84
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.84: Parse cache file key = versions + manifest text (no build stamps - reproducible builds)
+// v7.8.83: FManifestParseCache::LoadOrParse - on-disk parse cache for commandlet runs
+// v7.8.83: FManifestLineStream keeps one source buffer plus per-line offsets (was a raw and a trimmed FString per line)
+// v7.8.73: FManifestSectionCache - watch-mode reparse of changed sections only; incremental files use the section parsers
+// v7.8.61: FManifestParseCache - parsed manifest reused while SHA-1(content) + parser version match
+// v7.8.60: ParseManifest parses top-level sections in parallel (ParallelFor) and merges in document order
+// v7.8.59: Section offset index + FLazyManifestData parse-on-first-touch, table-driven section dispatch
+// v7.8.58: Single-pass FManifestLineStream tokenizer - section parsers consume cached tokens
 // v3.9: NPC Pipeline - ActivitySchedules, GoalItems, Quests parsing
 // v2.8.3: Function override parsing for parent class functions (HandleDeath, etc.)
 // v2.6.14: Prefix validation for all asset types as secondary safeguard against parser bugs
@@ -16,6 +24,90 @@
 
 #include "CoreMinimal.h"
 #include "Locked/GasAbilityGeneratorTypes.h"
+#include "Misc/SecureHash.h"
+
+/**
+ * v7.8.58: Per-line token produced once by FManifestLineStream
+ * Holds everything the section parsers used to recompute on every visit
+ * (trim offset, indent, array-item flag, key/value split).
+ */
+struct FManifestLineToken
+{
+	int32 Offset = 0;              // v7.8.83: First char of the raw line in the stream's source buffer
+	int32 Length = 0;              // v7.8.83: Raw line length (terminator excluded)
+	int32 TrimOffset = 0;          // v7.8.83: Leading whitespace chars (TrimStart rule)
+	int32 LineNumber = 0;          // 1-based line in the source document
+	int32 Indent = 0;              // Leading whitespace, tab = 2 (same rule as GetIndentLevel)
+	int32 KeyLen = INDEX_NONE;     // Chars before first ':' in trimmed text, INDEX_NONE if no colon
+	bool bComment = false;         // Trimmed text starts with '#'
+	bool bArrayItem = false;       // Trimmed text starts with "- "
+
+	bool HasColon() const { return KeyLen != INDEX_NONE; }
+};
+
+/**
+ * v7.8.58: Single-pass tokenized view of a YAML document
+ * Splits the content once, annotating each non-empty line with its indent, trimmed
+ * text and key/value split. Indexes match the old ParseIntoArrayLines() array
+ * (empty lines culled) so section parsers keep their LineIndex bookkeeping.
+ * v7.8.83: Lines are views into one copy of the content - no per-line strings are stored.
+ */
+class GASABILITYGENERATOR_API FManifestLineStream
+{
+public:
+	FManifestLineStream() = default;
+	explicit FManifestLineStream(const FString& Content) { Tokenize(Content); }
+
+	/** Tokenize Content in one pass (replaces any previous contents) */
+	void Tokenize(const FString& Content);
+
+	int32 Num() const { return Tokens.Num(); }
+	bool IsValidIndex(int32 Index) const { return Tokens.IsValidIndex(Index); }
+
+	/** Raw line (leading whitespace preserved) - valid while the stream is alive and unchanged */
+	FStringView operator[](int32 Index) const
+	{
+		const FManifestLineToken& Token = Tokens[Index];
+		return FStringView(*Source + Token.Offset, Token.Length);
+	}
+
+	/** Line with leading whitespace removed - equivalent to Lines[i].TrimStart() */
+	FStringView GetTrimmed(int32 Index) const
+	{
+		const FManifestLineToken& Token = Tokens[Index];
+		return FStringView(*Source + Token.Offset + Token.TrimOffset, Token.Length - Token.TrimOffset);
+	}
+
+	const FManifestLineToken& GetToken(int32 Index) const { return Tokens[Index]; }
+	int32 GetIndent(int32 Index) const { return Tokens[Index].Indent; }
+	int32 GetLineNumber(int32 Index) const { return Tokens[Index].LineNumber; }
+
+	/** True for comment-only lines (empty lines are culled during tokenization) */
+	bool IsComment(int32 Index) const { return Tokens[Index].bComment; }
+	bool IsArrayItem(int32 Index) const { return Tokens[Index].bArrayItem; }
+
+	/** Key before the first ':' (without "- " array prefix), empty view if no colon */
+	FStringView GetKey(int32 Index) const;
+
+	/** Text after the first ':' with surrounding whitespace removed (quotes/comments untouched) */
+	FStringView GetRawValue(int32 Index) const;
+
+private:
+	FString Source;
+	TArray<FManifestLineToken> Tokens;
+};
+
+/**
+ * v7.8.59: Top-level manifest section located by FGasAbilityGeneratorParser::BuildSectionIndex
+ * A key may appear many times (e.g. one tags: block per NPC system); each occurrence is its own span.
+ */
+struct FManifestSectionSpan
+{
+	FString Key;              // Canonical section key (aliases/suffix forms folded, e.g. "blueprints:" -> actor_blueprints)
+	int32 StartIndex = 0;     // FManifestLineStream index of the header line
+	int32 EndIndex = 0;       // One past the last line before the next top-level section
+	int32 LineNumber = 0;     // 1-based source line of the header
+};
 
 /**
  * YAML Parser for manifest and incremental files
@@ -34,6 +126,8 @@ public:
 
 	/**
 	 * Parse an incremental *.yaml file for a single asset
+	 * v7.8.73: The asset's fields are parsed by its manifest section parser (any whitelisted type, not
+	 * only GA_/GE_) and the result replaces the manifest definition of the same name.
 	 * @param YamlContent Raw YAML content
 	 * @param OutAssetName The asset name extracted from the file
 	 * @param OutData The manifest data to update with the parsed asset
@@ -41,83 +135,118 @@ public:
 	 */
 	static bool ParseIncrementalFile(const FString& YamlContent, FString& OutAssetName, FManifestData& OutData);
 
+	/**
+	 * v7.8.59: Pre-scan top-level section offsets without running any section parser
+	 * @param Lines Tokenized manifest
+	 * @param OutSections One span per top-level section header, in document order
+	 * @param OutScalars Optional - receives project_root / tags_ini_path
+	 */
+	static void BuildSectionIndex(const FManifestLineStream& Lines, TArray<FManifestSectionSpan>& OutSections, FManifestData* OutScalars = nullptr);
+
+	/** v7.8.59: Parse the single section whose header is at Lines[HeaderIndex] into OutData */
+	static void ParseSectionAt(const FManifestLineStream& Lines, int32 HeaderIndex, FManifestData& OutData);
+
+	/** v7.8.58: Fill OutData.SourceLineNumbers from "- name:" tokens */
+	static void CollectSourceLineNumbers(const FManifestLineStream& Lines, FManifestData& OutData);
+
 private:
+	// v7.8.59: Table-driven section dispatch shared by ParseManifest and the section index
+	typedef void (*FSectionParseFn)(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	struct FSectionHandler
+	{
+		const TCHAR* Header;      // Matched with StartsWith (prefix table) or EndsWith (suffix table)
+		const TCHAR* Canonical;   // FManifestSectionSpan::Key
+		FSectionParseFn Parse;
+	};
+	static const FSectionHandler* FindSectionHandler(const FString& TrimmedLine);
+
+	// v7.8.60: Parallel section parsing - below this many top-level spans a serial parse is cheaper
+	static constexpr int32 ParallelSectionThreshold = 8;
+	static void ParseLineRange(const FManifestLineStream& Lines, int32 Begin, int32 End, FManifestData& OutData);
+	static void MergeManifestFragment(FManifestData& Into, FManifestData&& Fragment, const FString& SectionKey);
+
+	// v7.8.73: Incremental files - header of the manifest section defining AssetName; replace-by-name merge
+	static const TCHAR* FindDefiningSectionHeader(const FManifestData& Data, const FString& AssetName);
+	static int32 ReplaceDefinitions(FManifestData& Into, FManifestData&& Fragment);
+
+	friend class FManifestSectionCache;
+
 	// Section parsers
-	static void ParseTags(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseEnumerations(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseInputActions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseInputMappingContexts(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseGameplayEffects(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseGameplayAbilities(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseActorBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseWidgetBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseComponentBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v4.19
-	static void ParseBlueprintConditions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
-	static void ParseBlackboards(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseBehaviorTrees(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseMaterials(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseMaterialFunctions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v2.6.12
-	static void ParseMaterialInstances(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v4.9
-	static void ParseEventGraphs(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseTags(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseEnumerations(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseInputActions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseInputMappingContexts(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseGameplayEffects(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseGameplayAbilities(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseActorBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseWidgetBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseComponentBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v4.19
+	static void ParseBlueprintConditions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
+	static void ParseBlackboards(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseBehaviorTrees(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseMaterials(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseMaterialFunctions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v2.6.12
+	static void ParseMaterialInstances(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v4.9
+	static void ParseEventGraphs(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
 
 	// v2.3.0: New asset type parsers
-	static void ParseFloatCurves(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseAnimationMontages(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseAnimationNotifies(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseDialogueBlueprints(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseEquippableItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseFloatCurves(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseAnimationMontages(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseAnimationNotifies(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseDialogueBlueprints(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseEquippableItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
 	// v4.28: Option C manifest sections - per Item_Generation_Capability_Audit.md
-	static void ParseConsumableItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseAmmoItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseWeaponAttachments(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseActivities(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseBlueprintTriggers(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
-	static void ParseAbilityConfigurations(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseActivityConfigurations(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseItemCollections(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseNarrativeEvents(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseNPCDefinitions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseCharacterDefinitions(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseCharacterAppearances(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v4.8.3
-	static void ParseTaggedDialogueSets(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseNiagaraSystems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v2.6.5
-	static void ParseFXPresets(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v4.9
+	static void ParseConsumableItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseAmmoItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseWeaponAttachments(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseActivities(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseBlueprintTriggers(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
+	static void ParseAbilityConfigurations(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseActivityConfigurations(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseItemCollections(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseNarrativeEvents(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseNPCDefinitions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseCharacterDefinitions(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseCharacterAppearances(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v4.8.3
+	static void ParseTaggedDialogueSets(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseNiagaraSystems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v2.6.5
+	static void ParseFXPresets(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v4.9
 
 	// v3.9: NPC Pipeline parsers
-	static void ParseActivitySchedules(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseGoalItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseGoalGenerators(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
-	static void ParseGameplayCues(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
-	static void ParseBTServices(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
-	static void ParseBTTasks(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
-	static void ParseQuests(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseActivitySchedules(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseGoalItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseGoalGenerators(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
+	static void ParseGameplayCues(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
+	static void ParseBTServices(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
+	static void ParseBTTasks(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);  // v7.8.52
+	static void ParseQuests(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
 
 	// v4.9: TriggerSet parser
-	static void ParseTriggerSets(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseTriggerSets(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
 
 	// v4.13: Category C - FormStateEffects preset parser (P1.1)
-	static void ParseFormStateEffects(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseFormStateEffects(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
 
 	// v3.9.8: Mesh-to-Item Pipeline parsers
-	static void ParsePipelineConfig(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParsePipelineItems(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParsePipelineCollections(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParsePipelineLoadouts(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParsePipelineConfig(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParsePipelineItems(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParsePipelineCollections(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParsePipelineLoadouts(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
 
 	// v3.9.9: POI & NPC Spawner Placement parsers
-	static void ParsePOIPlacements(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
-	static void ParseNPCSpawnerPlacements(const TArray<FString>& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParsePOIPlacements(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
+	static void ParseNPCSpawnerPlacements(const FManifestLineStream& Lines, int32& LineIndex, FManifestData& OutData);
 
 	// v2.2.0: Event graph helper parsers
-	static void ParseGraphNodes(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph);
-	static void ParseGraphConnections(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph);
+	static void ParseGraphNodes(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph);
+	static void ParseGraphConnections(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, FManifestEventGraphDefinition& OutGraph);
 	static FManifestGraphPinReference ParsePinReference(const FString& Value);
 
 	// v2.8.3: Function override parser
-	static void ParseFunctionOverrides(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestFunctionOverrideDefinition>& OutOverrides);
+	static void ParseFunctionOverrides(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestFunctionOverrideDefinition>& OutOverrides);
 
 	// v4.14: Custom function parser (new Blueprint functions, not overrides)
-	static void ParseCustomFunctions(const TArray<FString>& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestCustomFunctionDefinition>& OutFunctions);
+	static void ParseCustomFunctions(const FManifestLineStream& Lines, int32& LineIndex, int32 SubsectionIndent, TArray<FManifestCustomFunctionDefinition>& OutFunctions);
 
 	// Helper functions
 	static FString StripYamlComment(const FString& Value);  // v3.9.10: Strip inline YAML comments
@@ -127,7 +256,126 @@ private:
 	static FString GetArrayItemValue(const FString& Line);
 	static bool IsSectionHeader(const FString& Line, const FString& SectionName);
 	static bool ShouldExitSection(const FString& Line, int32 SectionIndent);
+	static bool ShouldExitSection(const FManifestLineStream& Lines, int32 LineIndex, int32 SectionIndent);  // v7.8.58: Token-based
 	// v3.9.8: Vector/Rotator string parsing helpers
 	static FVector ParseVectorFromString(const FString& VectorStr);
 	static FRotator ParseRotatorFromString(const FString& RotatorStr);
 };
+
+/**
+ * v7.8.59: Lazily parsed manifest
+ * Initialize() tokenizes and indexes section offsets only; each section is parsed on first
+ * EnsureSection() call. Tag-only runs touch just "tags" instead of the whole document.
+ * EnsureAll() produces the same FManifestData as FGasAbilityGeneratorParser::ParseManifest.
+ */
+class GASABILITYGENERATOR_API FLazyManifestData
+{
+public:
+	/** Tokenize and pre-scan section offsets - no section is parsed yet */
+	void Initialize(const FString& ManifestContent);
+
+	/** Parse every span of SectionKey (canonical key, e.g. "npc_definitions") on first touch */
+	const FManifestData& EnsureSection(const FString& SectionKey);
+
+	/** Parse all sections not yet touched and run the parse-time lints */
+	const FManifestData& EnsureAll();
+
+	bool IsSectionParsed(const FString& SectionKey) const { return bAllParsed || ParsedSections.Contains(SectionKey); }
+	const TArray<FManifestSectionSpan>& GetSections() const { return Sections; }
+	int32 GetSectionLineCount(const FString& SectionKey) const;
+
+	/** Data parsed so far (only touched sections are populated) */
+	const FManifestData& GetData() const { return Data; }
+
+private:
+	FManifestLineStream Lines;
+	TArray<FManifestSectionSpan> Sections;
+	TSet<FString> ParsedSections;
+	FManifestData Data;
+	bool bAllParsed = false;
+};
+
+/**
+ * v7.8.61: Parsed manifest cache keyed by content hash
+ * Key = SHA-1 over (ParserVersion, manifest text). GetOrParse keeps the last parse in memory, so
+ * reloading an unchanged manifest in the editor reuses the previous FManifestData instead of
+ * re-tokenizing and re-parsing. Bump ParserVersion whenever parser output changes.
+ * v7.8.83: LoadOrParse backs this with one cache file per manifest (Saved/GasAbilityGenerator/ParseCache),
+ * so a fresh process - every commandlet / CI run - also skips the cold parse.
+ */
+class GASABILITYGENERATOR_API FManifestParseCache
+{
+public:
+	static constexpr int32 ParserVersion = 1;
+
+	/**
+	 * v7.8.83: Cache file layout - bump whenever the serialized layout changes: a field added to, removed
+	 * from or reordered in any manifest definition struct (and its SerializeField in
+	 * GasAbilityGeneratorManifestArchive.cpp), or a changed field type. Stale files are then reparsed.
+	 */
+	static constexpr int32 CacheFileVersion = 1;
+
+	/**
+	 * Return the parsed manifest for ManifestContent, parsing only on a cache miss
+	 * @param bOutCacheHit Optional - true when the previous parse was reused
+	 */
+	static TSharedRef<const FManifestData> GetOrParse(const FString& ManifestContent, bool* bOutCacheHit = nullptr);
+
+	/** Content key used by the cache (also usable as a strong manifest identity) */
+	static FSHAHash ComputeContentKey(const FString& ManifestContent);
+
+	static void Clear();
+
+	/**
+	 * v7.8.83: Parse through the on-disk cache
+	 * The file is used when its key matches SHA-1 over (ParserVersion, CacheFileVersion, manifest text).
+	 * A missing, stale or corrupt file falls back to a full parse and is rewritten; failed parses are
+	 * never written.
+	 * @param bOutCacheHit Optional - true when the cache file was used
+	 * @return false if the manifest failed to parse
+	 */
+	static bool LoadOrParse(const FString& ManifestPath, const FString& ManifestContent, FManifestData& OutData, bool* bOutCacheHit = nullptr);
+
+	/** Cache file of ManifestPath */
+	static FString GetCacheFilePath(const FString& ManifestPath);
+
+private:
+	static FSHAHash ComputeFileKey(const FString& ManifestContent);
+	static bool ReadCacheFile(const TArray<uint8>& FileBytes, const FSHAHash& Key, FManifestData& OutData);
+	static bool WriteCacheFile(const FString& CachePath, const FSHAHash& Key, FManifestData& Data);
+
+	/** Field-by-field FManifestData serializer (GasAbilityGeneratorManifestArchive.cpp) */
+	static void SerializeManifestData(FArchive& Ar, FManifestData& Data);
+
+	static FCriticalSection CacheLock;
+	static FSHAHash CachedKey;
+	static TSharedPtr<const FManifestData> CachedData;
+};
+
+/**
+ * v7.8.73: Section-granular reparse for watch mode
+ * Keeps each top-level section's parsed fragment keyed by a hash of its raw lines. Parse() tokenizes
+ * the new content, reparses only the sections whose text changed and merges cached fragments for the
+ * rest in document order - the result matches FGasAbilityGeneratorParser::ParseManifest. Fragments of
+ * sections that disappeared are dropped on each call.
+ */
+class GASABILITYGENERATOR_API FManifestSectionCache
+{
+public:
+	bool Parse(const FString& ManifestContent, FManifestData& OutData);
+
+	/** Sections parsed / reused by the last Parse() */
+	int32 GetLastReparsedCount() const { return LastReparsedCount; }
+	int32 GetLastReusedCount() const { return LastReusedCount; }
+
+	/** Canonical keys of the sections the last Parse() had to parse */
+	const TSet<FString>& GetLastReparsedKeys() const { return LastReparsedKeys; }
+
+	void Reset();
+
+private:
+	TMap<uint64, FManifestData> Fragments;   // Hash(key, raw section lines) -> parsed fragment
+	TSet<FString> LastReparsedKeys;
+	int32 LastReparsedCount = 0;
+	int32 LastReusedCount = 0;
+};
@@ -0,0 +1,132 @@
+// GasAbilityGenerator v7.8.70 - Generation profiler
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+//
+// Scoped phase and per-asset timers plus run counters (loads, compiles, saves, registry queries).
+// Aggregates are always collected and land in the generation report; the commandlet's -profile
+// switch also records every scope as an event and exports a Chrome trace JSON and a per-asset CSV.
+// Every scope is an Unreal Insights CPU event on GasAbilityGeneratorChannel as well.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+UE_TRACE_CHANNEL_EXTERN(GasAbilityGeneratorChannel, GASABILITYGENERATOR_API);
+
+/**
+ * v7.8.70: Run counters
+ */
+enum class EGeneratorCounter : uint8
+{
+	Load,            // Assets loaded from disk (FCoreUObjectDelegates::OnAssetLoaded)
+	Compile,         // Blueprint compiles (FGeneratorBase::CompileBlueprint)
+	Save,            // Package saves
+	RegistryQuery,   // Asset Registry queries and scans
+	Num
+};
+
+/**
+ * v7.8.70: Aggregated time for one phase name (inclusive of nested phases)
+ */
+struct FGeneratorPhaseStats
+{
+	double Seconds = 0.0;
+	int32 Calls = 0;
+};
+
+/**
+ * v7.8.70: Time and counters attributed to one asset's generation
+ */
+struct FGeneratorAssetStats
+{
+	FString AssetName;
+	FString AssetType;
+	double Seconds = 0.0;
+	int32 Counters[static_cast<int32>(EGeneratorCounter::Num)] = {};
+	TMap<FString, double> PhaseSeconds;   // Phases entered while this asset was generating
+
+	int32 GetCounter(EGeneratorCounter Counter) const { return Counters[static_cast<int32>(Counter)]; }
+};
+
+/**
+ * v7.8.70: Generation profiler (game thread only - calls from other threads are ignored)
+ */
+class GASABILITYGENERATOR_API FGeneratorProfiler
+{
+public:
+	/** Reset all stats. bCaptureEvents keeps every scope for WriteChromeTrace (-profile). */
+	static void BeginSession(bool bCaptureEvents);
+	static void EndSession();
+	static bool IsCapturingEvents() { return bCaptureEvents; }
+
+	static void BeginScope(const TCHAR* Name);
+	static void EndScope();
+
+	/** Asset scopes don't nest; phases and counters inside one are attributed to that asset. Empty AssetType keeps the recorded one. */
+	static void BeginAsset(const FString& AssetName, const FString& AssetType);
+	static void EndAsset();
+
+	static void Increment(EGeneratorCounter Counter, int32 Delta = 1);
+
+	static const TMap<FString, FGeneratorPhaseStats>& GetPhases() { return Phases; }
+	static const FGeneratorAssetStats* FindAsset(const FString& AssetName) { return Assets.Find(AssetName); }
+	static int32 GetCounter(EGeneratorCounter Counter) { return Counters[static_cast<int32>(Counter)]; }
+	static const TCHAR* GetCounterName(EGeneratorCounter Counter);
+
+	/** Chrome trace event format (chrome://tracing, Perfetto). Requires a capturing session. */
+	static bool WriteChromeTrace(const FString& OutputPath);
+
+	/** One row per asset: name, type, duration, counters */
+	static bool WriteCsv(const FString& OutputPath);
+
+	/** Saved/GasAbilityGenerator/Profiles */
+	static FString GetProfileOutputDir();
+
+private:
+	struct FOpenScope
+	{
+		FString Name;
+		double StartTime = 0.0;
+	};
+
+	struct FTraceEvent
+	{
+		FString Name;
+		FString Category;
+		FString AssetName;
+		double StartTime = 0.0;
+		double Duration = 0.0;
+	};
+
+	static void OnAssetLoaded(UObject* Asset);
+
+	static bool bCaptureEvents;
+	static double SessionStartTime;
+	static TArray<FOpenScope> ScopeStack;
+	static TMap<FString, FGeneratorPhaseStats> Phases;
+	static TMap<FString, FGeneratorAssetStats> Assets;
+	static FGeneratorAssetStats* CurrentAsset;
+	static double CurrentAssetStartTime;
+	static int32 Counters[static_cast<int32>(EGeneratorCounter::Num)];
+	static TArray<FTraceEvent> Events;
+	static FDelegateHandle AssetLoadedHandle;
+};
+
+/** v7.8.70: RAII phase scope - use GASGEN_PROFILE_SCOPE */
+struct FGeneratorProfileScope
+{
+	explicit FGeneratorProfileScope(const TCHAR* Name) { FGeneratorProfiler::BeginScope(Name); }
+	~FGeneratorProfileScope() { FGeneratorProfiler::EndScope(); }
+};
+
+/** v7.8.70: RAII asset scope */
+struct FGeneratorAssetProfileScope
+{
+	FGeneratorAssetProfileScope(const FString& AssetName, const FString& AssetType) { FGeneratorProfiler::BeginAsset(AssetName, AssetType); }
+	~FGeneratorAssetProfileScope() { FGeneratorProfiler::EndAsset(); }
+};
+
+/** Timed phase + Insights CPU event. Name must be a string literal. */
+#define GASGEN_PROFILE_SCOPE(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, GasAbilityGeneratorChannel); \
+	FGeneratorProfileScope PREPROCESSOR_JOIN(GeneratorProfileScope_, __LINE__)(TEXT(Name))
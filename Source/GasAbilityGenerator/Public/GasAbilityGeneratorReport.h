@@ -1,6 +1,7 @@
 // GasAbilityGeneratorReport.h
 // v4.7: Machine-readable generation report system for CI/CD and debugging
 // Reports are saved as UDataAsset + JSON mirror for maximum accessibility
+// v7.8.70: Per-asset and per-phase timings plus run counters (from FGeneratorProfiler)
 
 #pragma once
 
@@ -93,6 +94,27 @@ struct FGenerationReportItem
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TArray<FString> Warnings;
 
+	// v7.8.70: Wall time spent generating this asset (all scheduler attempts)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float DurationMs = 0.0f;
+
+	// v7.8.70: Time per profiled phase while this asset was generating (e.g. "Compile", "EventGraph")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TMap<FString, float> PhaseDurationsMs;
+
+	// v7.8.70: Counters attributed to this asset
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 LoadCount = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 CompileCount = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 SaveCount = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 RegistryQueryCount = 0;
+
 	FGenerationReportItem() = default;
 
 	// Create from FGenerationResult
@@ -102,6 +124,27 @@ struct FGenerationReportItem
 	static FGenerationReportItem FromDryRunResult(const struct FDryRunResult& Result);
 };
 
+/**
+ * v7.8.70: Aggregated time for one profiled phase of the run
+ */
+USTRUCT(BlueprintType)
+struct FGenerationPhaseTiming
+{
+	GENERATED_BODY()
+
+	// Phase name (e.g. "Parse", "PreValidation", "Generate", "SaveFlush")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString Name;
+
+	// Total wall time, inclusive of nested phases
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float DurationMs = 0.0f;
+
+	// Number of times the phase was entered
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Calls = 0;
+};
+
 /**
  * v4.7: Generation report - machine-readable audit trail
  * Saved as UDataAsset for in-editor inspection and JSON for CI/CD
@@ -170,6 +213,22 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	int32 CountConflicted = 0;
 
+	// v7.8.70: Run profile - phases sorted by duration, run-wide counters
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FGenerationPhaseTiming> PhaseTimings;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 TotalLoads = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 TotalCompiles = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 TotalSaves = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 TotalRegistryQueries = 0;
+
 public:
 	/** Initialize report with run metadata */
 	void Initialize(const FString& InManifestPath, int64 InManifestHash, bool bInDryRun, bool bInForce);
@@ -183,6 +242,9 @@ public:
 	/** Finalize counts after all items added */
 	void Finalize();
 
+	/** v7.8.70: Copy phase timings and counters from FGeneratorProfiler */
+	void AddProfile();
+
 	/** Save report as JSON to Saved/ directory */
 	bool SaveAsJson(const FString& OutputPath) const;
 
@@ -0,0 +1,247 @@
+// GasAbilityGenerator v7.8.84 - Dependency-ordered generation scheduler
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.66: FGenerationJob / FGenerationScheduler - Kahn scheduler over manifest jobs
+// v7.8.67: Parallel prepare stage (input hashes, package stats) ahead of the game-thread commit loop
+// v7.8.72: Incremental change sets - previous run's definition hashes + transitive dependents
+// v7.8.83: Shared job runner helpers for the commandlet and the editor window
+// v7.8.84: Cycle release picks a job from a blocking strongly connected component (FindCycleRelease)
+//
+// Replaces the hard-coded per-type phase loops in the commandlet. Every manifest asset becomes a
+// job; every reference between manifest assets (parent classes, GE/GA refs, BT->BB, dialogue->NPC,
+// activities->goals, event graph class refs, ...) becomes an edge. Jobs run in topological order,
+// ties broken by registration order (the legacy phase order), so each asset is generated once
+// after everything it references.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Locked/GasAbilityGeneratorTypes.h"
+#include "HAL/FileManager.h"
+
+/**
+ * v7.8.66: One schedulable generation unit (one manifest asset)
+ */
+struct FGenerationJob
+{
+	FString AssetName;
+	FString AssetType;         // Generator id, e.g. "ActorBlueprint", "GameplayAbility"
+	int32 Order = 0;           // Registration order - tie-break between independent jobs
+	bool bCheckUpstreamFailure = false;  // v4.25 cascade gate (GameplayAbility only)
+	TFunction<FGenerationResult()> Generate;
+
+	// v7.8.67: Prepare stage - thread-safe, reads only the manifest definition
+	const void* Definition = nullptr;
+	TFunction<uint64()> ComputeInputHash;
+};
+
+/**
+ * v7.8.67: Output of the prepare stage for one job
+ */
+struct FGenerationPlan
+{
+	uint64 InputHash = 0;
+	bool bHasInputHash = false;
+	FString PackagePath;       // From the metadata registry record of a previous run (empty = never generated)
+	FFileStatData PackageStat;
+	bool bHasPackageStat = false;
+};
+
+/**
+ * v7.8.72: Definition input hashes recorded by the last real run of a manifest
+ * One JSON file per manifest under Saved/GasAbilityGenerator/Incremental. Only assets that finished the
+ * run New or Skipped are recorded, so failed, cascaded and never-generated assets are always in the next
+ * run's change set. Files written with another format or hash version load as empty.
+ */
+class GASABILITYGENERATOR_API FDefinitionHashSnapshot
+{
+public:
+	struct FEntry
+	{
+		FString AssetType;
+		uint64 InputHash = 0;
+	};
+
+	/** False if there is no usable snapshot for this manifest (the snapshot is then empty) */
+	bool Load(const FString& ManifestPath);
+	bool Save(const FString& ManifestPath) const;
+
+	const FEntry* Find(const FString& AssetName) const { return Entries.Find(AssetName); }
+	void Set(const FString& AssetName, const FString& AssetType, uint64 InputHash);
+	int32 Num() const { return Entries.Num(); }
+
+	static FString GetSnapshotPath(const FString& ManifestPath);
+
+private:
+	static constexpr int32 FormatVersion = 1;
+	TMap<FString, FEntry> Entries;
+};
+
+/**
+ * v7.8.66: Kahn scheduler over manifest jobs
+ *
+ * Usage:
+ *   FGenerationScheduler Scheduler;
+ *   Scheduler.AddManifestJobs(ManifestData);
+ *   Scheduler.AddManifestDependencies(ManifestData);
+ *   Scheduler.Prepare();        // worker threads
+ *   Scheduler.Begin();
+ *   int32 JobIndex;
+ *   while (Scheduler.Next(JobIndex)) { ...run...; Scheduler.Complete(JobIndex); }
+ *
+ * A job that still returns Deferred on a manifest asset that hasn't run yet means the static
+ * edge set missed a reference; DeferUntil() adds that edge and parks the job until the dependency
+ * completes, so it runs exactly once more instead of blind retry passes.
+ */
+class GASABILITYGENERATOR_API FGenerationScheduler
+{
+public:
+	/** Register a job. Returns false (and keeps the first job) if AssetName is already registered. */
+	bool AddJob(const FString& AssetName, const FString& AssetType, TFunction<FGenerationResult()> Generate, bool bCheckUpstreamFailure = false);
+
+	/** Dependent runs after Dependency. Ignored unless both are jobs; self-references are ignored. */
+	void AddDependency(const FString& Dependent, const FString& Dependency);
+
+	/** AddJob for a manifest definition; also registers its ComputeHash() for the prepare stage */
+	template <typename TDefinition>
+	bool AddDefinitionJob(const TDefinition& Definition, const FString& AssetType, TFunction<FGenerationResult()> Generate, bool bCheckUpstreamFailure = false)
+	{
+		if (!AddJob(Definition.Name, AssetType, MoveTemp(Generate), bCheckUpstreamFailure))
+		{
+			return false;
+		}
+		FGenerationJob& Job = Jobs.Last();
+		Job.Definition = &Definition;
+		Job.ComputeInputHash = [&Definition]() { return Definition.ComputeHash(); };
+		return true;
+	}
+
+	/** One job per manifest asset, registered in the legacy phase order */
+	void AddManifestJobs(const FManifestData& ManifestData);
+
+	/** Edges for every manifest-to-manifest reference */
+	void AddManifestDependencies(const FManifestData& ManifestData);
+
+	/**
+	 * v7.8.67: Prepare stage. Hashes every job's definition and stats the package file recorded for it
+	 * in the metadata registry, in parallel (ParallelFor over all jobs - preparation reads only manifest
+	 * data, so no job's prepare depends on another's output). Results are published to FGeneratorBase,
+	 * where the game-thread commit stage (the generators) picks them up via GetInputHash and
+	 * CheckExistsWithMetadata. Call FGeneratorBase::ClearPreparedState() when the run ends.
+	 */
+	void Prepare();
+
+	/** v7.8.67: Wall time of the last Prepare() */
+	double GetPrepareSeconds() const { return PrepareSeconds; }
+
+	/** v7.8.72: Prepare() output for a job (default plan if Prepare() wasn't run) */
+	const FGenerationPlan& GetPlan(int32 JobIndex) const;
+
+	/**
+	 * v7.8.72: Incremental change set - call after Prepare(), before Begin().
+	 * A job is changed when its prepared input hash or type differs from Previous (or it has no entry),
+	 * or when its registry record and package file no longer prove it up to date (deleted or edited
+	 * package, generator/hash version bump, force mode). Changed jobs and everything transitively
+	 * depending on them are generated; IsUpToDate() is true for the rest, which the caller reports as
+	 * skipped without calling Generate.
+	 */
+	void ComputeChangeSet(const FDefinitionHashSnapshot& Previous);
+	bool IsUpToDate(int32 JobIndex) const { return UpToDate.IsValidIndex(JobIndex) && UpToDate[JobIndex]; }
+	int32 NumChanged() const { return ChangedCount; }
+	int32 NumChangedDependents() const { return ChangedDependentCount; }
+	int32 NumUpToDate() const { return UpToDateCount; }
+
+	/** v7.8.72: This run's prepared hashes for the jobs ShouldRecord accepts */
+	FDefinitionHashSnapshot MakeSnapshot(TFunctionRef<bool(const FGenerationJob&)> ShouldRecord) const;
+
+	/**
+	 * v7.8.83: Record the hashes of every job that ended the run New or Skipped (per Summary) for the
+	 * next incremental run. Jobs that failed, or never ran (cancelled), stay out. Returns false if the
+	 * snapshot file couldn't be written.
+	 */
+	bool SaveSnapshot(const FGenerationSummary& Summary, const FString& ManifestPath) const;
+
+	/** Reset in-degrees and seed the ready queue */
+	void Begin();
+
+	/**
+	 * Pop the next runnable job (lowest Order among ready jobs).
+	 * If nothing is ready but jobs remain, a cycle exists. v7.8.84: The waiting jobs are split into
+	 * strongly connected components (Tarjan); among components with no waiting dependency outside
+	 * themselves (the cycles everything else is stuck behind), the lowest-Order member is released
+	 * and flagged (WasReleasedFromCycle) so generation still visits it once. Jobs merely downstream
+	 * of a cycle are never released early - they run normally once the cycle completes.
+	 * Returns false when every job has completed.
+	 */
+	bool Next(int32& OutJobIndex);
+
+	/** Mark a job finished and release its dependents */
+	void Complete(int32 JobIndex);
+
+	/**
+	 * Park a job until Dependency completes. Returns false if Dependency is not a pending job
+	 * (external asset, already completed, the job itself) or the job was released from a cycle -
+	 * in that case the caller keeps the result as final.
+	 */
+	bool DeferUntil(int32 JobIndex, const FString& Dependency);
+
+	/**
+	 * v7.8.83: Skipped result for an IsUpToDate() job - also records the WillSkip dry-run entry in
+	 * dry-run mode - and completes the job. The caller adds the result to its summary.
+	 */
+	FGenerationResult CompleteUpToDate(int32 JobIndex, const FString& Reason);
+
+	/**
+	 * v7.8.83: Run a job's generator (profiled per asset). A requeued job runs in force mode, since
+	 * its first run may have left a partial Blueprint in memory. Returns false if the result deferred
+	 * on a pending manifest asset and DeferUntil() parked the job - it runs again later. Otherwise the
+	 * caller records OutResult and calls Complete().
+	 */
+	bool RunJob(int32 JobIndex, FGenerationResult& OutResult);
+
+	/**
+	 * v7.8.83: Turn the New/Skipped result of every asset whose package save failed
+	 * (FSaveBatchResult::FailedAssets) into a failure, keeping Summary's counts in step.
+	 * Returns the relabeled results.
+	 */
+	static TArray<FGenerationResult*> ApplySaveFailures(FGenerationSummary& Summary, const TArray<FString>& FailedAssets);
+
+	const FGenerationJob& GetJob(int32 JobIndex) const { return Jobs[JobIndex]; }
+	bool WasReleasedFromCycle(int32 JobIndex) const { return ReleasedFromCycle.Contains(JobIndex); }
+	bool WasRequeued(int32 JobIndex) const { return RequeuedJobs.Contains(JobIndex); }
+	bool Contains(const FString& AssetName) const { return JobIndexByName.Contains(AssetName); }
+
+	int32 NumJobs() const { return Jobs.Num(); }
+	int32 NumEdges() const { return EdgeCount; }
+	int32 NumCycleReleases() const { return ReleasedFromCycle.Num(); }
+	int32 NumRequeued() const { return RequeuedJobs.Num(); }
+
+private:
+	enum class EJobState : uint8 { Waiting, Ready, Running, Done };
+
+	void AddReference(int32 DependentIndex, const FString& Reference);
+	const int32* FindJobByReference(const FString& Reference) const;  // v7.8.83: Shared by AddReference/DeferUntil
+	void PushReady(int32 JobIndex);
+	int32 FindCycleRelease() const;  // v7.8.84: Lowest-Order job of a waiting cycle with no waiting dependencies outside it
+
+	TArray<FGenerationJob> Jobs;
+	TMap<FString, int32> JobIndexByName;
+	TArray<TArray<int32>> Dependents;      // Dependency -> jobs waiting on it
+	TArray<int32> StaticInDegree;
+	int32 EdgeCount = 0;
+	double PrepareSeconds = 0.0;
+	TArray<FGenerationPlan> Plans;          // v7.8.72: Kept after Prepare() for the change set and snapshot
+
+	// v7.8.72: Incremental change set (empty = every job runs)
+	TBitArray<> UpToDate;
+	int32 ChangedCount = 0;
+	int32 ChangedDependentCount = 0;
+	int32 UpToDateCount = 0;
+
+	// Run state (Begin)
+	TArray<int32> InDegree;
+	TArray<EJobState> State;
+	TArray<int32> ReadyHeap;               // Job indices, min-heap on index (== Order)
+	int32 Remaining = 0;
+	TSet<int32> ReleasedFromCycle;
+	TSet<int32> RequeuedJobs;
+};
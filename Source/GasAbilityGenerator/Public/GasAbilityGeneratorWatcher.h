@@ -0,0 +1,96 @@
+// GasAbilityGenerator v7.8.73 - Manifest watch mode
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+//
+// Watches the manifest folder (and the dialogue CSV's folder) through the DirectoryWatcher module.
+// Saves to manifest.yaml, incremental *.yaml files next to it and the dialogue CSV are debounced into
+// one trigger; files whose content didn't change (double saves, touch) are dropped. The trigger's
+// handler reparses with FManifestSectionCache and generates through the incremental change set, so
+// only edited sections are parsed and only their definitions (plus dependents) are regenerated.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+struct FManifestData;
+struct FFileChangeData;
+
+/**
+ * v7.8.73: Files that changed since the last trigger (content compared, not timestamps)
+ */
+struct FManifestWatchChange
+{
+	TArray<FString> ChangedFiles;
+	bool bManifestChanged = false;
+	bool bDialogueCSVChanged = false;
+	bool bIncrementalFilesChanged = false;
+
+	/** Comma-separated clean filenames for logging */
+	FString Describe() const;
+};
+
+DECLARE_DELEGATE_OneParam(FOnManifestWatchTriggered, const FManifestWatchChange&);
+
+/**
+ * v7.8.73: Debounced manifest folder watcher (game thread)
+ * The editor ticks the DirectoryWatcher module and FTSTicker itself; a commandlet must call
+ * IDirectoryWatcher::Tick and FTSTicker::GetCoreTicker().Tick from its own loop.
+ */
+class GASABILITYGENERATOR_API FManifestWatcher
+{
+public:
+	static constexpr float DefaultDebounceSeconds = 0.75f;
+
+	FManifestWatcher() = default;
+	~FManifestWatcher();
+
+	FManifestWatcher(const FManifestWatcher&) = delete;
+	FManifestWatcher& operator=(const FManifestWatcher&) = delete;
+
+	/** DialogueCSVPath may be empty. Returns false if the manifest folder can't be watched. */
+	bool Start(const FString& InManifestPath, const FString& InDialogueCSVPath, FOnManifestWatchTriggered InOnTriggered, float InDebounceSeconds = DefaultDebounceSeconds);
+	void Stop();
+	bool IsWatching() const { return TickerHandle.IsValid(); }
+
+	/** Hold triggers while a generation pass runs - changes saved meanwhile fire once it's resumed */
+	void SetPaused(bool bInPaused) { bPaused = bInPaused; }
+
+	/** *.yaml files beside the manifest, excluding the manifest itself */
+	static void FindIncrementalFiles(const FString& ManifestPath, TArray<FString>& OutFiles);
+
+	/**
+	 * Apply every incremental file to InOutData (FGasAbilityGeneratorParser::ParseIncrementalFile -
+	 * whitelisted assets only, replacing the manifest definition). Files are left in place.
+	 * @return Number of files applied
+	 */
+	static int32 ApplyIncrementalFiles(const FString& ManifestPath, FManifestData& InOutData, TArray<FString>* OutAssetNames = nullptr);
+
+private:
+	enum class EWatchedFile : uint8
+	{
+		None,
+		Manifest,
+		DialogueCSV,
+		Incremental
+	};
+
+	EWatchedFile Classify(const FString& Filename) const;
+	void OnDirectoryChanged(const TArray<FFileChangeData>& Changes);
+	bool Tick(float DeltaTime);
+
+	/** Re-hash Filename (0 = missing); true if it differs from the last recorded content */
+	bool UpdateContentHash(const FString& Filename);
+
+	FString ManifestPath;
+	FString DialogueCSVPath;
+	FOnManifestWatchTriggered OnTriggered;
+	float DebounceSeconds = DefaultDebounceSeconds;
+
+	TArray<TPair<FString, FDelegateHandle>> Registrations;   // Watched directory -> DirectoryWatcher handle
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	TSet<FString> PendingFiles;
+	double LastEventTime = 0.0;
+	bool bPaused = false;
+	TMap<FString, uint64> ContentHashes;
+};
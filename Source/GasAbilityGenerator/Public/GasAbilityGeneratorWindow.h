@@ -1,5 +1,9 @@
-// GasAbilityGenerator v3.7
+// GasAbilityGenerator v7.8.83
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.83: Optional dialogue CSV (DialogueCSVPath in editor config) merged into the manifest and watched
+// v7.8.75: Time-sliced, cancellable generation with progress
+// v7.8.74: Ring-buffered virtualized log view
+// v7.8.73: Watch mode - regenerate changed assets when the manifest or an incremental file is saved
 // v3.7: Added NPC Creation feature - one-click NPC asset generation
 // v3.0: Added Dry Run and Force checkboxes for metadata-aware regeneration
 
@@ -8,16 +12,25 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Styling/SlateTypes.h"
+#include "Containers/Ticker.h"
 #include "Locked/GasAbilityGeneratorTypes.h"
 
-class SMultiLineEditableTextBox;
+class SGeneratorLogView;
 class SEditableTextBox;
 class SButton;
 class STextBlock;
 class SCheckBox;
+class FManifestWatcher;
+class FManifestSectionCache;
+struct FManifestWatchChange;
+struct FWindowGenerationRun;
 
 /**
  * Main UI Window for GAS Ability Generator
+ * v7.8.75: Generate Assets steps one asset at a time from the core ticker (progress bar, Cancel)
+ * v7.8.74: Log output in SGeneratorLogView - severity/asset filters, full log streamed to Saved/GasAbilityGenerator/Logs
+ * v7.8.73: Watch checkbox - debounced regeneration of the incremental change set on file save
  * v3.7: Added NPC Creation feature - one-click NPC asset generation
  * v3.0: Added Dry Run and Force checkboxes for metadata-aware regeneration
  * v2.5.0: Renamed to GasAbilityGenerator for generic UE project compatibility
@@ -39,7 +52,7 @@ public:
 private:
 	// UI Elements
 	TSharedPtr<SEditableTextBox> GuidesPathTextBox;
-	TSharedPtr<SMultiLineEditableTextBox> LogTextBox;
+	TSharedPtr<SGeneratorLogView> LogView;   // v7.8.74: Was SMultiLineEditableTextBox (O(n) relayout per line)
 	TSharedPtr<STextBlock> StatusText;
 	TSharedPtr<SButton> GenerateTagsButton;
 	TSharedPtr<SButton> GenerateAssetsButton;
@@ -49,17 +62,27 @@ private:
 	TSharedPtr<SCheckBox> DryRunCheckbox;
 	TSharedPtr<SCheckBox> ForceCheckbox;
 
+	// v7.8.73: Watch mode
+	TSharedPtr<SCheckBox> WatchCheckbox;
+	TUniquePtr<FManifestWatcher> ManifestWatcher;
+	TUniquePtr<FManifestSectionCache> WatchSectionCache;
+
 	// v3.7: NPC Creation UI elements
 	TSharedPtr<SEditableTextBox> NPCNameTextBox;
 	TSharedPtr<SButton> CreateNPCButton;
 
 	// State
 	FString GuidesFolderPath;
+	FString DialogueCSVPath;  // v7.8.83: Optional, relative to GuidesFolderPath (like the commandlet's -dialoguecsv=)
 	FManifestData ManifestData;
 
 	/** v2.0.9 FIX: Guard flag to prevent duplicate generation passes */
 	bool bIsGenerating;
 
+	/** v7.8.75: Generation run in progress (stepped by GenerationTickerHandle) */
+	TUniquePtr<FWindowGenerationRun> ActiveRun;
+	FTSTicker::FDelegateHandle GenerationTickerHandle;
+
 	// Button Handlers
 	FReply OnBrowseClicked();
 	FReply OnGenerateTagsClicked();
@@ -78,6 +101,7 @@ private:
 	void SaveConfig();
 	bool LoadManifest();
 	void ParseManifest(const FString& ManifestContent);
+	FString GetDialogueCSVFilePath() const;
 	void AppendLog(const FString& Message);
 	void ClearLog();
 	void UpdateStatus(const FString& Status);
@@ -88,8 +112,27 @@ private:
 	void GenerateTags();
 	void GenerateAssets();
 
-	/** Run the full generation pipeline with guard check */
-	void RunGeneration();
+	// v7.8.73: Watch mode
+	void OnWatchCheckStateChanged(ECheckBoxState NewState);
+	void StartWatching();
+	void StopWatching();
+	void OnManifestWatchTriggered(const FManifestWatchChange& Change);
+	/** Scheduler-ordered pass over the incremental change set only (no dialogs) */
+	void GenerateChangedAssets();
+
+	// v7.8.75: Time-sliced generation runs
+	/** Set up modes, caches and the scheduler, then return - the core ticker steps the run */
+	void StartGenerationRun(bool bDryRun, bool bForce, bool bChangeSetOnly);
+	/** Steps the run for up to one frame budget; false once it has finished */
+	bool TickGenerationRun(float DeltaTime);
+	/** Generate one asset (scheduler job or pipeline item); false when nothing is left */
+	bool RunGenerationStep();
+	/** Flush saves and compiles, record hashes, write the report (also after Cancel) */
+	void FinishGenerationRun(bool bShowResults);
+	FReply OnCancelGenerationClicked();
+	TOptional<float> GetGenerationProgress() const;
+	EVisibility GetGenerationProgressVisibility() const;
+	bool IsIdle() const { return !bIsGenerating; }
 
 	// v3.7: NPC Creation Functions
 	/** Creates all NPC assets (8 types) in Content/NPC/{NPCName}/ folder */
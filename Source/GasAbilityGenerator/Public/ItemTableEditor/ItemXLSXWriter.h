@@ -14,6 +14,8 @@
 #include "CoreMinimal.h"
 #include "ItemTableEditorTypes.h"
 
+class FXLSXStreamWriter;
+
 /**
  * Column definition for Item XLSX export
  */
@@ -59,14 +61,11 @@ private:
 	static FString GenerateWorkbookRelsXml();
 	static FString GenerateStylesXml();
 
-	// Worksheet Generators
-	static FString GenerateItemsSheet(const TArray<FItemTableRow>& Rows);
-	static FString GenerateListsSheet(const TArray<FItemTableRow>& Rows);
-	static FString GenerateMetaSheet(const TArray<FItemTableRow>& Rows);
+	// Worksheet Writers (v7.8.79: streamed row by row)
+	static void WriteItemsSheet(FXLSXStreamWriter& Writer, const TArray<FItemTableRow>& Rows);
+	static void WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FItemTableRow>& Rows);
+	static void WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FItemTableRow>& Rows);
 
 	// Utility Helpers
-	static FString EscapeXml(const FString& Text);
-	static FString CellReference(int32 Col, int32 Row);
-	static FString ColumnLetter(int32 ColIndex);
 	static int64 ComputeRowHash(const FItemTableRow& Row);
 };
@@ -12,6 +12,8 @@
 #include "Widgets/Views/SHeaderRow.h"
 #include "ItemTableEditorTypes.h"
 #include "TableEditorTransaction.h"  // v7.2: Undo/Redo support
+#include "TableEditorColumnIndex.h"  // v7.8.80: Cached filter lookups
+#include "TableEditorSort.h"  // v7.8.81: Typed multi-column sorting
 
 class SEditableText;
 class SCheckBox;
@@ -249,9 +251,11 @@ private:
 	/** Per-column filter state (text + multi-select) */
 	TMap<FName, FItemColumnFilterState> ColumnFilters;
 
-	/** Current sort column */
-	FName SortColumn;
-	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+	/** v7.8.80: Cached column values behind the filters and filter dropdowns */
+	mutable TTableColumnIndex<FItemTableRow> ColumnIndex;
+
+	/** v7.8.81: Sort levels, primary first (shift-click a header to add a secondary) */
+	TArray<FTableSortColumn> SortColumns;
 
 	/** Current item type filter for dynamic column visibility */
 	TOptional<EItemType> ItemTypeFilter;
@@ -305,6 +309,9 @@ private:
 	/** Get column value from row */
 	FString GetColumnValue(const TSharedPtr<FItemTableRow>& Row, FName ColumnId) const;
 
+	/** v7.8.81: Typed sort key from row (numbers and enums by value, everything else by display text) */
+	FTableSortKey GetSortKey(const TSharedPtr<FItemTableRow>& Row, FName ColumnId) const;
+
 	/** Update column visibility based on selected item type */
 	void UpdateDynamicColumnVisibility();
 
@@ -320,6 +327,7 @@ private:
 
 	/** Column sort clicked */
 	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+	EColumnSortPriority::Type GetColumnSortPriority(FName ColumnId) const;
 	void OnColumnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type SortMode);
 
 	//=========================================================================
@@ -363,9 +371,12 @@ private:
 	// Filtering & Sorting
 	//=========================================================================
 
-	/** Apply all filters and refresh display */
+	/** Apply all filters and refresh display (row data may have changed - re-reads cached columns) */
 	void ApplyFilters();
 
+	/** v7.8.80: Re-apply the filters after a filter edit (row data unchanged - uses the column index as is) */
+	void RefilterRows();
+
 	/** Apply sorting to displayed rows */
 	void ApplySorting();
 
@@ -382,6 +393,9 @@ private:
 	/** Row was modified callback */
 	void OnRowModified();
 
+	/** v7.8.80: Inline edit of one row - re-reads only that row in the column index */
+	void OnRowEdited(TSharedPtr<FItemTableRow> Row);
+
 	/** Delegate for notifying owner of dirty state changes */
 	FOnItemTableDirtyStateChanged OnDirtyStateChanged;
 
@@ -0,0 +1,223 @@
+// GasAbilityGenerator v7.8.83
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.62: Shared 64-bit content hasher for InputHash / OutputHash / manifest hash
+//          Replaces per-field 32-bit GetTypeHash (and index-based FName hashes, which differ per session)
+// v7.8.83: FGeneratorHashBuilder::Field/Add - definition hashes stream tagged fields in order (hash version 3)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+#include <type_traits>
+
+/**
+ * v7.8.62: Generator content hashing
+ *
+ * Compute*OutputHash feed fields through GeneratorHash::Of(), which hashes the raw bytes
+ * with xxHash64. Strings hash their characters, FNames hash their display string (stable
+ * across sessions), numbers and enums hash their value bytes. Types without an overload
+ * fall back to a 64-bit mix of GetTypeHash.
+ *
+ * v7.8.83: Definition ComputeHash() methods stream every field through one
+ * FGeneratorHashBuilder instead of xor-combining per-field hashes (where swapped values
+ * collided and duplicate entries cancelled out).
+ *
+ * GeneratorHash::Version is stored with every metadata record. Records written before
+ * v7.8.62 load as version 0 (LegacyVersion) and are migrated by CheckExistsWithMetadata.
+ */
+namespace GeneratorHash
+{
+	/** 0 = legacy 32-bit GetTypeHash combining, 2 = xxHash64 field hashing, 3 = streamed definition hashes */
+	static constexpr int32 LegacyVersion = 0;
+	static constexpr int32 Version = 3;
+
+	/** 64-bit finalizer (splitmix64) - spreads 32-bit fallbacks across all 64 bits */
+	FORCEINLINE uint64 Mix64(uint64 X)
+	{
+		X ^= X >> 30; X *= 0xbf58476d1ce4e5b9ULL;
+		X ^= X >> 27; X *= 0x94d049bb133111ebULL;
+		X ^= X >> 31;
+		return X;
+	}
+
+	FORCEINLINE uint64 OfBytes(const void* Data, uint64 Size)
+	{
+		return FXxHash64::HashBuffer(Data, Size).Hash;
+	}
+
+	FORCEINLINE uint64 Of(const TCHAR* Str)
+	{
+		return Str ? OfBytes(Str, FCString::Strlen(Str) * sizeof(TCHAR)) : OfBytes(nullptr, 0);
+	}
+
+	FORCEINLINE uint64 Of(const FString& Str)
+	{
+		return OfBytes(*Str, Str.Len() * sizeof(TCHAR));
+	}
+
+	FORCEINLINE uint64 Of(FStringView Str)
+	{
+		return OfBytes(Str.GetData(), Str.Len() * sizeof(TCHAR));
+	}
+
+	FORCEINLINE uint64 Of(const FName& Name)
+	{
+		return Of(Name.ToString());
+	}
+
+	FORCEINLINE uint64 Of(const FText& Text)
+	{
+		return Of(Text.ToString());
+	}
+
+	FORCEINLINE uint64 Of(bool bValue)
+	{
+		const uint8 Byte = bValue ? 1 : 0;
+		return OfBytes(&Byte, 1);
+	}
+
+	FORCEINLINE uint64 Of(float Value)
+	{
+		// Normalize -0.0 so equal values hash equally
+		const float Normalized = (Value == 0.0f) ? 0.0f : Value;
+		return OfBytes(&Normalized, sizeof(Normalized));
+	}
+
+	FORCEINLINE uint64 Of(double Value)
+	{
+		const double Normalized = (Value == 0.0) ? 0.0 : Value;
+		return OfBytes(&Normalized, sizeof(Normalized));
+	}
+
+	/** Integers and enums hash their value bytes */
+	template <typename T>
+	FORCEINLINE typename TEnableIf<std::is_integral_v<T> || std::is_enum_v<T>, uint64>::Type Of(T Value)
+	{
+		const int64 Wide = static_cast<int64>(Value);
+		return OfBytes(&Wide, sizeof(Wide));
+	}
+
+	/** Anything else with a GetTypeHash (vectors, tags, containers) */
+	template <typename T>
+	FORCEINLINE typename TEnableIf<!std::is_arithmetic_v<T> && !std::is_enum_v<T>, uint64>::Type Of(const T& Value)
+	{
+		return Mix64(static_cast<uint64>(GetTypeHash(Value)));
+	}
+
+	/** v7.8.83: Manifest definitions (and anything else) with a uint64 ComputeHash() */
+	template <typename T, typename = void>
+	struct THasComputeHash : std::false_type {};
+
+	template <typename T>
+	struct THasComputeHash<T, std::void_t<decltype(std::declval<const T&>().ComputeHash())>> : std::true_type {};
+}
+
+/**
+ * v7.8.62: Streaming 64-bit hasher over raw bytes
+ * Order-sensitive; use for content where field order matters (manifest text, output hashes,
+ * definition ComputeHash()).
+ */
+class FGeneratorHashBuilder
+{
+public:
+	FGeneratorHashBuilder& UpdateBytes(const void* Data, uint64 Size)
+	{
+		Builder.Update(Data, Size);
+		return *this;
+	}
+
+	FGeneratorHashBuilder& Update(FStringView Str)
+	{
+		// Length prefix keeps ("ab","c") distinct from ("a","bc")
+		const int32 Len = Str.Len();
+		Builder.Update(&Len, sizeof(Len));
+		Builder.Update(Str.GetData(), Len * sizeof(TCHAR));
+		return *this;
+	}
+
+	FGeneratorHashBuilder& Update(uint64 Value)
+	{
+		Builder.Update(&Value, sizeof(Value));
+		return *this;
+	}
+
+	/**
+	 * v7.8.83: Field tag, then the value
+	 * The tag keeps an omitted (conditional) field from shifting its neighbours onto each other.
+	 */
+	template <typename T>
+	FGeneratorHashBuilder& Field(const TCHAR* Tag, const T& Value)
+	{
+		Update(FStringView(Tag));
+		return Add(Value);
+	}
+
+	FGeneratorHashBuilder& Add(FStringView Str) { return Update(Str); }
+	FGeneratorHashBuilder& Add(const TCHAR* Str) { return Update(FStringView(Str)); }
+	FGeneratorHashBuilder& Add(const FString& Str) { return Update(FStringView(Str)); }
+	FGeneratorHashBuilder& Add(const FName& Name) { return Add(Name.ToString()); }
+	FGeneratorHashBuilder& Add(const FText& Text) { return Add(Text.ToString()); }
+
+	/** Numbers and enums stream their value bytes, definitions their ComputeHash(), anything else GeneratorHash::Of */
+	template <typename T>
+	FGeneratorHashBuilder& Add(const T& Value)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			const uint8 Byte = Value ? 1 : 0;
+			return UpdateBytes(&Byte, 1);
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			// Normalize -0.0 so equal values hash equally
+			const T Normalized = (Value == T(0)) ? T(0) : Value;
+			return UpdateBytes(&Normalized, sizeof(Normalized));
+		}
+		else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+		{
+			const int64 Wide = static_cast<int64>(Value);
+			return UpdateBytes(&Wide, sizeof(Wide));
+		}
+		else if constexpr (GeneratorHash::THasComputeHash<T>::value)
+		{
+			return Update(static_cast<uint64>(Value.ComputeHash()));
+		}
+		else
+		{
+			return Update(GeneratorHash::Of(Value));
+		}
+	}
+
+	/** Count prefix, then the elements in order */
+	template <typename ElementType, typename AllocatorType>
+	FGeneratorHashBuilder& Add(const TArray<ElementType, AllocatorType>& Array)
+	{
+		Add(Array.Num());
+		for (const ElementType& Element : Array)
+		{
+			Add(Element);
+		}
+		return *this;
+	}
+
+	/** Count prefix, then key/value pairs in iteration (manifest) order */
+	template <typename KeyType, typename ValueType, typename SetAllocator, typename KeyFuncs>
+	FGeneratorHashBuilder& Add(const TMap<KeyType, ValueType, SetAllocator, KeyFuncs>& Map)
+	{
+		Add(Map.Num());
+		for (const auto& Pair : Map)
+		{
+			Add(Pair.Key);
+			Add(Pair.Value);
+		}
+		return *this;
+	}
+
+	uint64 Finalize() const
+	{
+		return Builder.Finalize().Hash;
+	}
+
+private:
+	FXxHash64Builder Builder;
+};
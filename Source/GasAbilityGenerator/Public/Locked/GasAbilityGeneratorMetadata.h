@@ -3,6 +3,10 @@
 // v3.0: UGeneratorAssetMetadata - Persistent metadata storage for generated assets
 // v3.1: UGeneratorMetadataRegistry - Central registry for assets that don't support AssetUserData
 // v4.16.1: Hash collision detection for metadata integrity
+// v7.8.62: HashVersion persisted alongside InputHash/OutputHash for hash algorithm migration
+// v7.8.63: Package file evidence on registry records - up-to-date check without loading the asset
+// v7.8.67: IsUpToDateInRegistry optional prepared package stat
+// v7.8.76: Registry changes journaled; SaveRegistryIfNeeded saves only when something changed
 
 #pragma once
 
@@ -12,6 +16,8 @@
 #include "Locked/GasAbilityGeneratorTypes.h"
 #include "GasAbilityGeneratorMetadata.generated.h"
 
+struct FFileStatData;
+
 /**
  * v3.0: Persistent metadata attached to generated assets via UAssetUserData
  *
@@ -68,6 +74,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Generator")
 	bool bIsGenerated;
 
+	/** v7.8.62: GeneratorHash version of InputHash/OutputHash (0 = legacy 32-bit hashing) */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	int32 HashVersion;
+
 	/** Convert to FGeneratorMetadata struct */
 	FGeneratorMetadata ToMetadata() const;
 
@@ -119,6 +129,18 @@ struct GASABILITYGENERATOR_API FGeneratorMetadataRecord
 	UPROPERTY(EditAnywhere, Category = "Generator")
 	bool bIsGenerated = false;
 
+	/** v7.8.62: GeneratorHash version of InputHash/OutputHash (0 = legacy 32-bit hashing) */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	int32 HashVersion = 0;
+
+	/** v7.8.63: Size of the saved package file when this record was written (0 = unknown) */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	int64 PackageFileSize = 0;
+
+	/** v7.8.63: Modification time of the saved package file when this record was written */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	FDateTime PackageFileTime;
+
 	/** Convert to FGeneratorMetadata struct */
 	FGeneratorMetadata ToMetadata() const;
 
@@ -182,6 +204,12 @@ public:
 	/** Clear the collision map (call at start of generation session) */
 	void ClearCollisionMap();
 
+	/**
+	 * v7.8.63: Capture package file size/timestamp for records written this session
+	 * Called by SaveRegistry, after generated packages have been saved
+	 */
+	void RefreshPendingFileStamps();
+
 private:
 	static TWeakObjectPtr<UGeneratorMetadataRegistry> CachedRegistry;
 
@@ -190,6 +218,9 @@ private:
 
 	/** v4.16.1: Transient map for collision detection (Hash string -> first asset path) */
 	TMap<FString, FString> HashToAssetMap;
+
+	/** v7.8.63: Records written this session whose package file evidence is not yet captured */
+	TSet<FString> PendingFileStamps;
 };
 
 /**
@@ -243,9 +274,27 @@ namespace GeneratorMetadataHelpers
 		uint64 NewInputHash,
 		TFunction<uint64(UObject*)> ComputeCurrentOutputHash = nullptr);
 
+	/**
+	 * v7.8.63: Registry-only up-to-date check (no package load)
+	 * True only when the registry record is conclusive: generated, same hash version,
+	 * same InputHash and GeneratorVersion, package file size/timestamp unchanged since the
+	 * record was written, and no dirty in-memory copy. False means "inconclusive" - the
+	 * caller must fall back to loading the asset.
+	 * v7.8.67: PreparedStat, if given, is a stat of the package file taken earlier this run
+	 * (scheduler prepare stage) and is used instead of stat'ing again.
+	 */
+	bool IsUpToDateInRegistry(
+		const FString& AssetPath,
+		uint64 InputHash,
+		const FString& GeneratorVersion,
+		FGeneratorMetadataRecord& OutRecord,
+		const FFileStatData* PreparedStat = nullptr);
+
 	/**
 	 * v3.1: Save the metadata registry after generation completes
 	 * Call this at the end of asset generation to persist registry changes
+	 * v7.8.76: Skipped when no record changed since the last save (FGeneratorMetadataJournal);
+	 * a successful save deletes the journal
 	 */
 	void SaveRegistryIfNeeded();
 
@@ -1,5 +1,8 @@
-// GasAbilityGenerator v4.30
+// GasAbilityGenerator v7.8.83
 // Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+// v7.8.83: ComputeHash() streams tagged fields in order through FGeneratorHashBuilder (hash version 3)
+// v7.8.62: ComputeHash() fields hashed with GeneratorHash::Of (64-bit xxHash); FGeneratorMetadata::HashVersion
+// v7.8.58: FManifestData::SourceLineNumbers - manifest line of each asset's "- name:" entry
 // v4.30: Automation Gap Closure - MeshMaterials/Morphs/SequenceAssets struct automation, deferred resolution
 // v4.25: Dependency Ordering with Cascade Skip - EGenerationStatus::SkippedCascaded, cascade tracking fields
 // v4.10: Widget Property Enhancement - dotted properties, struct types, enums, machine-readable warnings
@@ -16,6 +19,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Locked/GasAbilityGeneratorHash.h"
 
 /**
  * Generation result status enum
@@ -585,6 +589,9 @@ struct FPreValidationIssue
 	FString AttemptedClass;     // Class we tried to find
 	FString AttemptedMember;    // Function/property/asset we tried to find
 
+	// v7.8.58: 1-based manifest line of ItemId's "- name:" entry (0 = unknown)
+	int32 ManifestLine = 0;
+
 	FPreValidationIssue() = default;
 
 	FPreValidationIssue(const FString& InRuleId, const FString& InErrorCode, EValidationSeverity InSeverity,
@@ -602,6 +609,10 @@ struct FPreValidationIssue
 		{
 			Result += FString::Printf(TEXT(" | %s"), *YAMLPath);
 		}
+		if (ManifestLine > 0)
+		{
+			Result += FString::Printf(TEXT(" | line %d"), ManifestLine);
+		}
 		return Result;
 	}
 };
@@ -705,14 +716,11 @@ struct FManifestEnumerationDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		for (const FString& Val : Values)
-		{
-			Hash ^= GetTypeHash(Val);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		Hash.Field(TEXT("Values"), Values);
+		return Hash.Finalize();
 	}
 };
 
@@ -728,10 +736,11 @@ struct FManifestInputActionDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ValueType) << 8;
-		Hash ^= GetTypeHash(TriggerType) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ValueType"), ValueType);
+		Hash.Field(TEXT("TriggerType"), TriggerType);
+		return Hash.Finalize();
 	}
 };
 
@@ -748,19 +757,12 @@ struct FManifestInputMappingBinding
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(ActionName);
-		Hash ^= GetTypeHash(Key) << 8;
-		for (const FString& Mod : Modifiers)
-		{
-			Hash ^= GetTypeHash(Mod);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Trig : Triggers)
-		{
-			Hash ^= GetTypeHash(Trig);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("ActionName"), ActionName);
+		Hash.Field(TEXT("Key"), Key);
+		Hash.Field(TEXT("Modifiers"), Modifiers);
+		Hash.Field(TEXT("Triggers"), Triggers);
+		return Hash.Finalize();
 	}
 };
 
@@ -775,13 +777,10 @@ struct FManifestInputMappingContextDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		for (const auto& Binding : Bindings)
-		{
-			Hash ^= Binding.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Bindings"), Bindings);
+		return Hash.Finalize();
 	}
 };
 
@@ -795,10 +794,10 @@ struct FManifestTagRequirement
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = 0;
-		for (const FString& Tag : MustHaveTags) { Hash ^= GetTypeHash(Tag); Hash = (Hash << 2) | (Hash >> 62); }
-		for (const FString& Tag : MustNotHaveTags) { Hash ^= GetTypeHash(Tag) << 4; Hash = (Hash << 2) | (Hash >> 62); }
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("MustHaveTags"), MustHaveTags);
+		Hash.Field(TEXT("MustNotHaveTags"), MustNotHaveTags);
+		return Hash.Finalize();
 	}
 
 	bool IsEmpty() const { return MustHaveTags.Num() == 0 && MustNotHaveTags.Num() == 0; }
@@ -828,16 +827,17 @@ struct FManifestAttributeBasedMagnitude
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(FMath::RoundToInt(Coefficient * 1000.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(PreMultiplyAdditiveValue * 1000.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(PostMultiplyAdditiveValue * 1000.f)) << 16;
-		Hash ^= static_cast<uint64>(GetTypeHash(AttributeToCapture)) << 24;
-		Hash ^= static_cast<uint64>(GetTypeHash(AttributeSource)) << 28;
-		Hash ^= (bSnapshot ? 1ULL : 0ULL) << 32;
-		Hash ^= static_cast<uint64>(GetTypeHash(CurveTable)) << 36;
-		Hash ^= static_cast<uint64>(GetTypeHash(CurveRowName)) << 40;
-		Hash ^= static_cast<uint64>(GetTypeHash(AttributeCalculationType)) << 44;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Coefficient"), FMath::RoundToInt(Coefficient * 1000.f));
+		Hash.Field(TEXT("PreMultiplyAdditiveValue"), FMath::RoundToInt(PreMultiplyAdditiveValue * 1000.f));
+		Hash.Field(TEXT("PostMultiplyAdditiveValue"), FMath::RoundToInt(PostMultiplyAdditiveValue * 1000.f));
+		Hash.Field(TEXT("AttributeToCapture"), AttributeToCapture);
+		Hash.Field(TEXT("AttributeSource"), AttributeSource);
+		Hash.Field(TEXT("bSnapshot"), bSnapshot);
+		Hash.Field(TEXT("CurveTable"), CurveTable);
+		Hash.Field(TEXT("CurveRowName"), CurveRowName);
+		Hash.Field(TEXT("AttributeCalculationType"), AttributeCalculationType);
+		return Hash.Finalize();
 	}
 };
 
@@ -863,15 +863,16 @@ struct FManifestGEExecutionModifier
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(CapturedAttribute);
-		Hash ^= GetTypeHash(CapturedSource) << 4;
-		Hash ^= GetTypeHash(CapturedStatus) << 8;
-		Hash ^= GetTypeHash(ModifierOp) << 12;
-		Hash ^= GetTypeHash(MagnitudeType) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ScalableFloatValue * 1000.f)) << 20;
-		Hash ^= GetTypeHash(SetByCallerTag) << 28;
-		Hash ^= AttributeBased.ComputeHash() << 4;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("CapturedAttribute"), CapturedAttribute);
+		Hash.Field(TEXT("CapturedSource"), CapturedSource);
+		Hash.Field(TEXT("CapturedStatus"), CapturedStatus);
+		Hash.Field(TEXT("ModifierOp"), ModifierOp);
+		Hash.Field(TEXT("MagnitudeType"), MagnitudeType);
+		Hash.Field(TEXT("ScalableFloatValue"), FMath::RoundToInt(ScalableFloatValue * 1000.f));
+		Hash.Field(TEXT("SetByCallerTag"), SetByCallerTag);
+		Hash.Field(TEXT("AttributeBased"), AttributeBased);
+		return Hash.Finalize();
 	}
 };
 
@@ -886,9 +887,10 @@ struct FManifestConditionalGameplayEffect
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(EffectClass);
-		for (const FString& Tag : RequiredSourceTags) { Hash ^= GetTypeHash(Tag); Hash = (Hash << 3) | (Hash >> 61); }
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("EffectClass"), EffectClass);
+		Hash.Field(TEXT("RequiredSourceTags"), RequiredSourceTags);
+		return Hash.Finalize();
 	}
 };
 
@@ -904,10 +906,11 @@ struct FManifestGEExecution
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(CalculationClass);
-		for (const auto& Mod : Modifiers) { Hash ^= Mod.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		for (const auto& Cond : ConditionalEffects) { Hash ^= Cond.ComputeHash(); Hash = (Hash << 5) | (Hash >> 59); }
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("CalculationClass"), CalculationClass);
+		Hash.Field(TEXT("Modifiers"), Modifiers);
+		Hash.Field(TEXT("ConditionalEffects"), ConditionalEffects);
+		return Hash.Finalize();
 	}
 };
 
@@ -934,16 +937,17 @@ struct FManifestModifierDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Attribute);
-		Hash ^= GetTypeHash(Operation) << 4;
-		Hash ^= GetTypeHash(MagnitudeType) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ScalableFloatValue * 1000.f)) << 12;
-		Hash ^= GetTypeHash(SetByCallerTag) << 20;
-		Hash ^= AttributeBased.ComputeHash() << 4;
-		Hash ^= GetTypeHash(CustomCalculationClass) << 28;
-		Hash ^= SourceTags.ComputeHash() << 32;
-		Hash ^= TargetTags.ComputeHash() << 36;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Attribute"), Attribute);
+		Hash.Field(TEXT("Operation"), Operation);
+		Hash.Field(TEXT("MagnitudeType"), MagnitudeType);
+		Hash.Field(TEXT("ScalableFloatValue"), FMath::RoundToInt(ScalableFloatValue * 1000.f));
+		Hash.Field(TEXT("SetByCallerTag"), SetByCallerTag);
+		Hash.Field(TEXT("AttributeBased"), AttributeBased);
+		Hash.Field(TEXT("CustomCalculationClass"), CustomCalculationClass);
+		Hash.Field(TEXT("SourceTags"), SourceTags);
+		Hash.Field(TEXT("TargetTags"), TargetTags);
+		return Hash.Finalize();
 	}
 };
 
@@ -958,13 +962,10 @@ struct FManifestGEComponentDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(ComponentClass);
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("ComponentClass"), ComponentClass);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -998,38 +999,31 @@ struct FManifestGameplayEffectDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(DurationPolicy) << 4;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(DurationMagnitude * 1000.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Period * 1000.f)) << 16;
-		Hash ^= (bExecutePeriodicOnApplication ? 1ULL : 0ULL) << 24;
-		Hash ^= GetTypeHash(PeriodicInhibitionPolicy) << 25;
-		Hash ^= static_cast<uint64>(StackLimitCount) << 28;
-		Hash ^= static_cast<uint64>(GetTypeHash(StackingType)) << 32;
+		Hash.Field(TEXT("DurationPolicy"), DurationPolicy);
+		Hash.Field(TEXT("DurationMagnitude"), FMath::RoundToInt(DurationMagnitude * 1000.f));
+		Hash.Field(TEXT("Period"), FMath::RoundToInt(Period * 1000.f));
+		Hash.Field(TEXT("bExecutePeriodicOnApplication"), bExecutePeriodicOnApplication);
+		Hash.Field(TEXT("PeriodicInhibitionPolicy"), PeriodicInhibitionPolicy);
+		Hash.Field(TEXT("StackLimitCount"), StackLimitCount);
+		Hash.Field(TEXT("StackingType"), StackingType);
 
 		// Tags
-		for (const FString& Tag : GrantedTags) Hash ^= GetTypeHash(Tag);
-		for (const FString& Tag : RemoveGameplayEffectsWithTags) Hash ^= GetTypeHash(Tag) << 2;
-		for (const FString& Tag : SetByCallerTags) Hash ^= GetTypeHash(Tag) << 4;
-		for (const FString& Exec : ExecutionClasses) Hash ^= GetTypeHash(Exec) << 6;
+		Hash.Field(TEXT("GrantedTags"), GrantedTags);
+		Hash.Field(TEXT("RemoveGameplayEffectsWithTags"), RemoveGameplayEffectsWithTags);
+		Hash.Field(TEXT("SetByCallerTags"), SetByCallerTags);
+		Hash.Field(TEXT("ExecutionClasses"), ExecutionClasses);
 
 		// v7.8.52: Full executions
-		for (const auto& Exec : Executions) { Hash ^= Exec.ComputeHash(); Hash = (Hash << 7) | (Hash >> 57); }
+		Hash.Field(TEXT("Executions"), Executions);
 
 		// Modifiers and Components
-		for (const auto& Mod : Modifiers)
-		{
-			Hash ^= Mod.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Comp : Components)
-		{
-			Hash ^= Comp.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("Modifiers"), Modifiers);
+		Hash.Field(TEXT("Components"), Components);
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -1047,10 +1041,11 @@ struct FManifestFormStateEffectDefinition
 	/** v4.13: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Form);
-		Hash ^= (bInvulnerable ? 1ULL : 0ULL) << 8;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Form"), Form);
+		Hash.Field(TEXT("bInvulnerable"), bInvulnerable);
 		// NOTE: Folder excluded - presentational only
-		return Hash;
+		return Hash.Finalize();
 	}
 
 	/** Expand to a GameplayEffect definition for generation */
@@ -1081,9 +1076,10 @@ struct FManifestCueTriggerDefinition
 	/** Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Trigger);
-		Hash ^= GetTypeHash(CueTag) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Trigger"), Trigger);
+		Hash.Field(TEXT("CueTag"), CueTag);
+		return Hash.Finalize();
 	}
 };
 
@@ -1102,12 +1098,13 @@ struct FManifestVFXSpawnDefinition
 	/** Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(NiagaraSystem) << 4;
-		Hash ^= GetTypeHash(AttachTo) << 8;
-		Hash ^= GetTypeHash(Socket) << 12;
-		Hash ^= (bDestroyOnEndAbility ? 1ULL : 0ULL) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("NiagaraSystem"), NiagaraSystem);
+		Hash.Field(TEXT("AttachTo"), AttachTo);
+		Hash.Field(TEXT("Socket"), Socket);
+		Hash.Field(TEXT("bDestroyOnEndAbility"), bDestroyOnEndAbility);
+		return Hash.Finalize();
 	}
 };
 
@@ -1128,13 +1125,14 @@ struct FManifestDelegateBindingDefinition
 	/** Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(Delegate) << 4;
-		Hash ^= GetTypeHash(Source) << 8;
-		Hash ^= GetTypeHash(Attribute) << 12;
-		Hash ^= GetTypeHash(Handler) << 16;
-		Hash ^= (bUnbindOnEnd ? 1ULL : 0ULL) << 20;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("Delegate"), Delegate);
+		Hash.Field(TEXT("Source"), Source);
+		Hash.Field(TEXT("Attribute"), Attribute);
+		Hash.Field(TEXT("Handler"), Handler);
+		Hash.Field(TEXT("bUnbindOnEnd"), bUnbindOnEnd);
+		return Hash.Finalize();
 	}
 };
 
@@ -1158,15 +1156,16 @@ struct FManifestAttributeBindingDefinition
 	/** Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(AttributeSet) << 4;
-		Hash ^= GetTypeHash(Attribute) << 8;
-		Hash ^= GetTypeHash(Source) << 12;
-		Hash ^= GetTypeHash(Handler) << 16;
-		Hash ^= (bTriggerOnce ? 1ULL : 0ULL) << 20;
-		Hash ^= GetTypeHash(WithTag) << 24;
-		Hash ^= GetTypeHash(WithoutTag) << 28;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("AttributeSet"), AttributeSet);
+		Hash.Field(TEXT("Attribute"), Attribute);
+		Hash.Field(TEXT("Source"), Source);
+		Hash.Field(TEXT("Handler"), Handler);
+		Hash.Field(TEXT("bTriggerOnce"), bTriggerOnce);
+		Hash.Field(TEXT("WithTag"), WithTag);
+		Hash.Field(TEXT("WithoutTag"), WithoutTag);
+		return Hash.Finalize();
 	}
 };
 
@@ -1191,19 +1190,19 @@ struct FManifestAbilityTagsDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = 0;
-		for (const FString& Tag : AbilityTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag));
-		for (const FString& Tag : CancelAbilitiesWithTag) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 4;
-		for (const FString& Tag : ActivationOwnedTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 8;
-		for (const FString& Tag : ActivationRequiredTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 12;
-		for (const FString& Tag : ActivationBlockedTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 16;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("AbilityTags"), AbilityTags);
+		Hash.Field(TEXT("CancelAbilitiesWithTag"), CancelAbilitiesWithTag);
+		Hash.Field(TEXT("ActivationOwnedTags"), ActivationOwnedTags);
+		Hash.Field(TEXT("ActivationRequiredTags"), ActivationRequiredTags);
+		Hash.Field(TEXT("ActivationBlockedTags"), ActivationBlockedTags);
 		// v7.8.55: Include new tag containers in hash
-		for (const FString& Tag : BlockAbilitiesWithTag) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 20;
-		for (const FString& Tag : SourceRequiredTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 24;
-		for (const FString& Tag : SourceBlockedTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 28;
-		for (const FString& Tag : TargetRequiredTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 32;
-		for (const FString& Tag : TargetBlockedTags) Hash ^= static_cast<uint64>(GetTypeHash(Tag)) << 36;
-		return Hash;
+		Hash.Field(TEXT("BlockAbilitiesWithTag"), BlockAbilitiesWithTag);
+		Hash.Field(TEXT("SourceRequiredTags"), SourceRequiredTags);
+		Hash.Field(TEXT("SourceBlockedTags"), SourceBlockedTags);
+		Hash.Field(TEXT("TargetRequiredTags"), TargetRequiredTags);
+		Hash.Field(TEXT("TargetBlockedTags"), TargetBlockedTags);
+		return Hash.Finalize();
 	}
 };
 
@@ -1227,16 +1226,17 @@ struct FManifestActorVariableDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(Class) << 8;
-		Hash ^= GetTypeHash(Container) << 10;  // v7.8.51: Include container in hash
-		Hash ^= GetTypeHash(KeyType) << 13;    // v7.8.56: Include Map key type
-		Hash ^= GetTypeHash(ValueType) << 15;  // v7.8.56: Include Map value type
-		Hash ^= GetTypeHash(DefaultValue) << 18;
-		Hash ^= (bReplicated ? 1ULL : 0ULL) << 22;
-		Hash ^= (bInstanceEditable ? 1ULL : 0ULL) << 23;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Class"), Class);
+		Hash.Field(TEXT("Container"), Container);  // v7.8.51: Include container in hash
+		Hash.Field(TEXT("KeyType"), KeyType);  // v7.8.56: Include Map key type
+		Hash.Field(TEXT("ValueType"), ValueType);  // v7.8.56: Include Map value type
+		Hash.Field(TEXT("DefaultValue"), DefaultValue);
+		Hash.Field(TEXT("bReplicated"), bReplicated);
+		Hash.Field(TEXT("bInstanceEditable"), bInstanceEditable);
+		return Hash.Finalize();
 	}
 };
 
@@ -1262,7 +1262,10 @@ struct FManifestGraphPinReference
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		return GetTypeHash(NodeId) ^ (GetTypeHash(PinName) << 16);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("NodeId"), NodeId);
+		Hash.Field(TEXT("PinName"), PinName);
+		return Hash.Finalize();
 	}
 };
 
@@ -1308,15 +1311,12 @@ struct FManifestGraphNodeDefinition
 	/** v3.0: Compute hash for change detection (excludes position - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(Type) << 8;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("Type"), Type);
 		// NOTE: PositionX, PositionY, bHasPosition are excluded - presentational only
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-		}
-		return Hash;
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -1331,7 +1331,10 @@ struct FManifestGraphConnectionDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		return From.ComputeHash() ^ (To.ComputeHash() << 32);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("From"), From);
+		Hash.Field(TEXT("To"), To);
+		return Hash.Finalize();
 	}
 };
 
@@ -1355,19 +1358,12 @@ struct FManifestEventGraphDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Description) << 8;
-		for (const auto& Node : Nodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61); // Rotate to avoid position-dependence
-		}
-		for (const auto& Conn : Connections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59); // Rotate
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Description"), Description);
+		Hash.Field(TEXT("Nodes"), Nodes);
+		Hash.Field(TEXT("Connections"), Connections);
+		return Hash.Finalize();
 	}
 };
 
@@ -1388,10 +1384,11 @@ struct FManifestFunctionParameterDefinition
 	/** v4.14: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(Default) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Default"), Default);
+		return Hash.Finalize();
 	}
 };
 
@@ -1412,29 +1409,14 @@ struct FManifestCustomFunctionDefinition
 	/** v4.14: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(FunctionName);
-		Hash ^= (bPure ? 1ULL : 0ULL) << 4;
-		for (const auto& Input : Inputs)
-		{
-			Hash ^= Input.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Output : Outputs)
-		{
-			Hash ^= Output.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Node : Nodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		for (const auto& Conn : Connections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 9) | (Hash >> 55);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("FunctionName"), FunctionName);
+		Hash.Field(TEXT("bPure"), bPure);
+		Hash.Field(TEXT("Inputs"), Inputs);
+		Hash.Field(TEXT("Outputs"), Outputs);
+		Hash.Field(TEXT("Nodes"), Nodes);
+		Hash.Field(TEXT("Connections"), Connections);
+		return Hash.Finalize();
 	}
 };
 
@@ -1451,9 +1433,10 @@ struct FManifestAbilityTriggerDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(TriggerTag);
-		Hash ^= GetTypeHash(TriggerSource) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("TriggerTag"), TriggerTag);
+		Hash.Field(TEXT("TriggerSource"), TriggerSource);
+		return Hash.Finalize();
 	}
 };
 
@@ -1540,108 +1523,73 @@ struct FManifestGameplayAbilityDefinition
 	/** v4.14: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentClass) << 4;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(InstancingPolicy) << 8;
-		Hash ^= GetTypeHash(NetExecutionPolicy) << 12;
-		Hash ^= GetTypeHash(CooldownGameplayEffectClass) << 16;
+		Hash.Field(TEXT("InstancingPolicy"), InstancingPolicy);
+		Hash.Field(TEXT("NetExecutionPolicy"), NetExecutionPolicy);
+		Hash.Field(TEXT("CooldownGameplayEffectClass"), CooldownGameplayEffectClass);
 		// v7.8.55: CDO Audit - include new properties in hash
-		Hash ^= GetTypeHash(CostGameplayEffectClass) << 18;
-		Hash ^= GetTypeHash(NetSecurityPolicy) << 19;
-		Hash ^= Tags.ComputeHash() << 20;
+		Hash.Field(TEXT("CostGameplayEffectClass"), CostGameplayEffectClass);
+		Hash.Field(TEXT("NetSecurityPolicy"), NetSecurityPolicy);
+		Hash.Field(TEXT("Tags"), Tags);
 
 		// v4.8: Include new NarrativeGameplayAbility properties
-		Hash ^= static_cast<uint64>(GetTypeHash(InputTag)) << 32;
-		Hash ^= (bActivateAbilityOnGranted ? 1ULL : 0ULL) << 40;
+		Hash.Field(TEXT("InputTag"), InputTag);
+		Hash.Field(TEXT("bActivateAbilityOnGranted"), bActivateAbilityOnGranted);
 
 		// v7.8.52: Additional NarrativeGameplayAbility properties
-		Hash ^= (bRequiresAmmo ? 1ULL : 0ULL) << 41;
-		Hash ^= (bDrawDebugTraces ? 1ULL : 0ULL) << 42;
-		Hash ^= static_cast<uint64>(GetTypeHash(FireCueTag)) << 43;
-		Hash ^= static_cast<uint64>(GetTypeHash(FireCueTagNoImpact)) << 44;
-		Hash ^= static_cast<uint64>(GetTypeHash(DamageEffectClass)) << 45;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(DefaultAttackDamage * 100.f)) << 46;
+		Hash.Field(TEXT("bRequiresAmmo"), bRequiresAmmo);
+		Hash.Field(TEXT("bDrawDebugTraces"), bDrawDebugTraces);
+		Hash.Field(TEXT("FireCueTag"), FireCueTag);
+		Hash.Field(TEXT("FireCueTagNoImpact"), FireCueTagNoImpact);
+		Hash.Field(TEXT("DamageEffectClass"), DamageEffectClass);
+		Hash.Field(TEXT("DefaultAttackDamage"), FMath::RoundToInt(DefaultAttackDamage * 100.f));
 
 		// v7.8.52: Ability triggers
-		for (const auto& Trigger : AbilityTriggers)
-		{
-			Hash ^= Trigger.ComputeHash();
-			Hash = (Hash << 2) | (Hash >> 62);
-		}
+		Hash.Field(TEXT("AbilityTriggers"), AbilityTriggers);
 
 		// v7.8.52: Firearm config
-		Hash ^= (bIsAutomatic ? 1ULL : 0ULL) << 47;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(RateOfFire * 1000.f)) << 48;
-		Hash ^= static_cast<uint64>(BurstAmount + 1000) << 49;  // +1000 to handle -1
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TraceDistance)) << 50;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TraceRadius * 10.f)) << 51;
-		Hash ^= (bTraceMulti ? 1ULL : 0ULL) << 52;
+		Hash.Field(TEXT("bIsAutomatic"), bIsAutomatic);
+		Hash.Field(TEXT("RateOfFire"), FMath::RoundToInt(RateOfFire * 1000.f));
+		Hash.Field(TEXT("BurstAmount"), BurstAmount);
+		Hash.Field(TEXT("TraceDistance"), FMath::RoundToInt(TraceDistance));
+		Hash.Field(TEXT("TraceRadius"), FMath::RoundToInt(TraceRadius * 10.f));
+		Hash.Field(TEXT("bTraceMulti"), bTraceMulti);
 
 		// v7.8.52: Warping config
-		Hash ^= (bShouldWarp ? 1ULL : 0ULL) << 53;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(WarpMaintainDist)) << 54;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(MinWarpDist)) << 55;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(MaxWarpDist)) << 56;
+		Hash.Field(TEXT("bShouldWarp"), bShouldWarp);
+		Hash.Field(TEXT("WarpMaintainDist"), FMath::RoundToInt(WarpMaintainDist));
+		Hash.Field(TEXT("MinWarpDist"), FMath::RoundToInt(MinWarpDist));
+		Hash.Field(TEXT("MaxWarpDist"), FMath::RoundToInt(MaxWarpDist));
 
 		// v7.8.52: Execution config
-		Hash ^= static_cast<uint64>(GetTypeHash(ExecutionGameplayTag)) << 57;
-		Hash ^= (bExecutionInvulnerability ? 1ULL : 0ULL) << 58;
+		Hash.Field(TEXT("ExecutionGameplayTag"), ExecutionGameplayTag);
+		Hash.Field(TEXT("bExecutionInvulnerability"), bExecutionInvulnerability);
 
 		// Variables
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("Variables"), Variables);
 
 		// Event graph
-		Hash ^= GetTypeHash(EventGraphName) << 24;
-		Hash ^= (bHasInlineEventGraph ? 1ULL : 0ULL) << 28;
+		Hash.Field(TEXT("EventGraphName"), EventGraphName);
+		Hash.Field(TEXT("bHasInlineEventGraph"), bHasInlineEventGraph);
 
-		for (const auto& Node : EventGraphNodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Conn : EventGraphConnections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
+		Hash.Field(TEXT("EventGraphNodes"), EventGraphNodes);
+		Hash.Field(TEXT("EventGraphConnections"), EventGraphConnections);
 
 		// v4.13: Category C features
-		for (const auto& Cue : CueTriggers)
-		{
-			Hash ^= Cue.ComputeHash();
-			Hash = (Hash << 9) | (Hash >> 55);
-		}
-		for (const auto& VFX : VFXSpawns)
-		{
-			Hash ^= VFX.ComputeHash();
-			Hash = (Hash << 11) | (Hash >> 53);
-		}
-		for (const auto& Del : DelegateBindings)
-		{
-			Hash ^= Del.ComputeHash();
-			Hash = (Hash << 13) | (Hash >> 51);
-		}
+		Hash.Field(TEXT("CueTriggers"), CueTriggers);
+		Hash.Field(TEXT("VFXSpawns"), VFXSpawns);
+		Hash.Field(TEXT("DelegateBindings"), DelegateBindings);
 
 		// v4.22: Attribute bindings
-		for (const auto& Attr : AttributeBindings)
-		{
-			Hash ^= Attr.ComputeHash();
-			Hash = (Hash << 14) | (Hash >> 50);
-		}
+		Hash.Field(TEXT("AttributeBindings"), AttributeBindings);
 
 		// v4.14: Custom functions
-		for (const auto& Func : CustomFunctions)
-		{
-			Hash ^= Func.ComputeHash();
-			Hash = (Hash << 15) | (Hash >> 49);
-		}
+		Hash.Field(TEXT("CustomFunctions"), CustomFunctions);
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -1657,14 +1605,11 @@ struct FManifestActorComponentDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 8;
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -1694,16 +1639,17 @@ struct FManifestAISenseConfig
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(SenseType);
-		Hash ^= GetTypeHash(FMath::RoundToInt(SightRadius * 10)) << 4;
-		Hash ^= GetTypeHash(FMath::RoundToInt(LoseSightRadius * 10)) << 8;
-		Hash ^= GetTypeHash(FMath::RoundToInt(PeripheralVisionAngleDegrees * 10)) << 12;
-		Hash ^= (bDetectEnemies ? 1ULL : 0ULL) << 16;
-		Hash ^= (bDetectNeutrals ? 1ULL : 0ULL) << 17;
-		Hash ^= (bDetectFriendlies ? 1ULL : 0ULL) << 18;
-		Hash ^= GetTypeHash(FMath::RoundToInt(MaxAge * 10)) << 20;
-		Hash ^= (bStartsEnabled ? 1ULL : 0ULL) << 24;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("SenseType"), SenseType);
+		Hash.Field(TEXT("SightRadius"), FMath::RoundToInt(SightRadius * 10));
+		Hash.Field(TEXT("LoseSightRadius"), FMath::RoundToInt(LoseSightRadius * 10));
+		Hash.Field(TEXT("PeripheralVisionAngleDegrees"), FMath::RoundToInt(PeripheralVisionAngleDegrees * 10));
+		Hash.Field(TEXT("bDetectEnemies"), bDetectEnemies);
+		Hash.Field(TEXT("bDetectNeutrals"), bDetectNeutrals);
+		Hash.Field(TEXT("bDetectFriendlies"), bDetectFriendlies);
+		Hash.Field(TEXT("MaxAge"), FMath::RoundToInt(MaxAge * 10));
+		Hash.Field(TEXT("bStartsEnabled"), bStartsEnabled);
+		return Hash.Finalize();
 	}
 };
 
@@ -1718,13 +1664,10 @@ struct FManifestAIPerceptionConfig
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(DominantSense);
-		for (const auto& Sense : Senses)
-		{
-			Hash ^= Sense.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("DominantSense"), DominantSense);
+		Hash.Field(TEXT("Senses"), Senses);
+		return Hash.Finalize();
 	}
 };
 
@@ -1742,19 +1685,12 @@ struct FManifestFunctionOverrideDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(FunctionName);
-		Hash ^= (bCallParent ? 1ULL : 0ULL) << 8;
-		for (const auto& Node : Nodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Conn : Connections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("FunctionName"), FunctionName);
+		Hash.Field(TEXT("bCallParent"), bCallParent);
+		Hash.Field(TEXT("Nodes"), Nodes);
+		Hash.Field(TEXT("Connections"), Connections);
+		return Hash.Finalize();
 	}
 };
 
@@ -1817,82 +1753,54 @@ struct FManifestActorBlueprintDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentClass) << 4;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
 		// NOTE: Folder excluded - presentational only
 
 		// Components
-		for (const auto& Comp : Components)
-		{
-			Hash ^= Comp.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("Components"), Components);
 
 		// Variables
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("Variables"), Variables);
 
 		// Event graph
-		Hash ^= GetTypeHash(EventGraphName) << 8;
-		Hash ^= (bHasInlineEventGraph ? 1ULL : 0ULL) << 12;
+		Hash.Field(TEXT("EventGraphName"), EventGraphName);
+		Hash.Field(TEXT("bHasInlineEventGraph"), bHasInlineEventGraph);
 
-		for (const auto& Node : EventGraphNodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		for (const auto& Conn : EventGraphConnections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 11) | (Hash >> 53);
-		}
+		Hash.Field(TEXT("EventGraphNodes"), EventGraphNodes);
+		Hash.Field(TEXT("EventGraphConnections"), EventGraphConnections);
 
 		// Function overrides
-		for (const auto& Override : FunctionOverrides)
-		{
-			Hash ^= Override.ComputeHash();
-			Hash = (Hash << 13) | (Hash >> 51);
-		}
+		Hash.Field(TEXT("FunctionOverrides"), FunctionOverrides);
 
 		// v4.33: Delegate bindings
-		for (const auto& Del : DelegateBindings)
-		{
-			Hash ^= Del.ComputeHash();
-			Hash = (Hash << 15) | (Hash >> 49);
-		}
+		Hash.Field(TEXT("DelegateBindings"), DelegateBindings);
 
 		// v4.35: Custom functions
-		for (const auto& Func : CustomFunctions)
-		{
-			Hash ^= Func.ComputeHash();
-			Hash = (Hash << 16) | (Hash >> 48);
-		}
+		Hash.Field(TEXT("CustomFunctions"), CustomFunctions);
 
 		// v7.8.22: AIPerception config
 		if (bHasAIPerceptionConfig)
 		{
-			Hash ^= AIPerceptionConfig.ComputeHash();
-			Hash = (Hash << 17) | (Hash >> 47);
+			Hash.Field(TEXT("AIPerceptionConfig"), AIPerceptionConfig);
 		}
 
 		// v7.8.35: Goal/Activity CDO properties
-		Hash ^= GetTypeHash(ActivityName) << 18;
-		Hash ^= GetTypeHash(BehaviorTree) << 19;
-		Hash ^= GetTypeHash(SupportedGoalType) << 20;
-		Hash ^= (bIsInterruptable ? 1ULL : 0ULL) << 21;
-		Hash ^= (bSaveActivity ? 1ULL : 0ULL) << 22;
-		Hash ^= GetTypeHash(FMath::RoundToInt(DefaultScore * 100)) << 23;
-		Hash ^= GetTypeHash(FMath::RoundToInt(GoalLifetime * 100)) << 24;
-		Hash ^= (bRemoveOnSucceeded ? 1ULL : 0ULL) << 25;
-		Hash ^= (bSaveGoal ? 1ULL : 0ULL) << 26;
-		for (const auto& Tag : OwnedTags) { Hash ^= GetTypeHash(Tag); }
-		for (const auto& Tag : BlockTags) { Hash ^= GetTypeHash(Tag); }
-		for (const auto& Tag : RequireTags) { Hash ^= GetTypeHash(Tag); }
+		Hash.Field(TEXT("ActivityName"), ActivityName);
+		Hash.Field(TEXT("BehaviorTree"), BehaviorTree);
+		Hash.Field(TEXT("SupportedGoalType"), SupportedGoalType);
+		Hash.Field(TEXT("bIsInterruptable"), bIsInterruptable);
+		Hash.Field(TEXT("bSaveActivity"), bSaveActivity);
+		Hash.Field(TEXT("DefaultScore"), FMath::RoundToInt(DefaultScore * 100));
+		Hash.Field(TEXT("GoalLifetime"), FMath::RoundToInt(GoalLifetime * 100));
+		Hash.Field(TEXT("bRemoveOnSucceeded"), bRemoveOnSucceeded);
+		Hash.Field(TEXT("bSaveGoal"), bSaveGoal);
+		Hash.Field(TEXT("OwnedTags"), OwnedTags);
+		Hash.Field(TEXT("BlockTags"), BlockTags);
+		Hash.Field(TEXT("RequireTags"), RequireTags);
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -1910,12 +1818,13 @@ struct FManifestWidgetVariableDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(DefaultValue) << 8;
-		Hash ^= (bInstanceEditable ? 1ULL : 0ULL) << 12;
-		Hash ^= (bExposeOnSpawn ? 1ULL : 0ULL) << 13;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("DefaultValue"), DefaultValue);
+		Hash.Field(TEXT("bInstanceEditable"), bInstanceEditable);
+		Hash.Field(TEXT("bExposeOnSpawn"), bExposeOnSpawn);
+		return Hash.Finalize();
 	}
 };
 
@@ -1943,17 +1852,18 @@ struct FManifestWidgetSlotDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(GetTypeHash(Anchors));
-		Hash ^= static_cast<uint64>(GetTypeHash(Position)) << 4;
-		Hash ^= static_cast<uint64>(GetTypeHash(Size)) << 8;
-		Hash ^= static_cast<uint64>(GetTypeHash(Alignment)) << 12;
-		Hash ^= (bAutoSize ? 1ULL : 0ULL) << 16;
-		Hash ^= static_cast<uint64>(GetTypeHash(HorizontalAlignment)) << 20;
-		Hash ^= static_cast<uint64>(GetTypeHash(VerticalAlignment)) << 24;
-		Hash ^= static_cast<uint64>(GetTypeHash(SizeRule)) << 28;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(FillWeight * 1000.f)) << 32;
-		Hash ^= static_cast<uint64>(GetTypeHash(Padding)) << 40;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Anchors"), Anchors);
+		Hash.Field(TEXT("Position"), Position);
+		Hash.Field(TEXT("Size"), Size);
+		Hash.Field(TEXT("Alignment"), Alignment);
+		Hash.Field(TEXT("bAutoSize"), bAutoSize);
+		Hash.Field(TEXT("HorizontalAlignment"), HorizontalAlignment);
+		Hash.Field(TEXT("VerticalAlignment"), VerticalAlignment);
+		Hash.Field(TEXT("SizeRule"), SizeRule);
+		Hash.Field(TEXT("FillWeight"), FMath::RoundToInt(FillWeight * 1000.f));
+		Hash.Field(TEXT("Padding"), Padding);
+		return Hash.Finalize();
 	}
 };
 
@@ -1984,26 +1894,18 @@ struct FManifestWidgetNodeDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(Name) << 8;
-		Hash ^= (bIsVariable ? 1ULL : 0ULL) << 12;
-		Hash ^= Slot.ComputeHash() << 16;
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Child : Children)
-		{
-			Hash ^= GetTypeHash(Child);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		Hash ^= GetTypeHash(Text) << 20;
-		Hash ^= GetTypeHash(ImagePath) << 24;
-		Hash ^= GetTypeHash(StyleClass) << 28;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("bIsVariable"), bIsVariable);
+		Hash.Field(TEXT("Slot"), Slot);
+		Hash.Field(TEXT("Properties"), Properties);
+		Hash.Field(TEXT("Children"), Children);
+		Hash.Field(TEXT("Text"), Text);
+		Hash.Field(TEXT("ImagePath"), ImagePath);
+		Hash.Field(TEXT("StyleClass"), StyleClass);
+		return Hash.Finalize();
 	}
 };
 
@@ -2017,13 +1919,10 @@ struct FManifestWidgetTreeDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(RootWidget);
-		for (const auto& Widget : Widgets)
-		{
-			Hash ^= Widget.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("RootWidget"), RootWidget);
+		Hash.Field(TEXT("Widgets"), Widgets);
+		return Hash.Finalize();
 	}
 };
 
@@ -2051,29 +1950,18 @@ struct FManifestWidgetBlueprintDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentClass) << 4;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
 		// NOTE: Folder excluded - presentational only
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		Hash ^= GetTypeHash(EventGraphName) << 8;
-		Hash ^= (bHasInlineEventGraph ? 1ULL : 0ULL) << 12;
-		for (const auto& Node : EventGraphNodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Conn : EventGraphConnections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraphName"), EventGraphName);
+		Hash.Field(TEXT("bHasInlineEventGraph"), bHasInlineEventGraph);
+		Hash.Field(TEXT("EventGraphNodes"), EventGraphNodes);
+		Hash.Field(TEXT("EventGraphConnections"), EventGraphConnections);
 		// v4.3: Include widget tree in hash
-		Hash ^= WidgetTree.ComputeHash();
-		return Hash;
+		Hash.Field(TEXT("WidgetTree"), WidgetTree);
+		return Hash.Finalize();
 	}
 };
 
@@ -2091,9 +1979,10 @@ struct FManifestDispatcherParam
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		return Hash.Finalize();
 	}
 };
 
@@ -2107,13 +1996,10 @@ struct FManifestEventDispatcherDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		for (const auto& Param : Parameters)
-		{
-			Hash ^= Param.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Parameters"), Parameters);
+		return Hash.Finalize();
 	}
 };
 
@@ -2127,9 +2013,10 @@ struct FManifestFunctionParam
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		return Hash.Finalize();
 	}
 };
 
@@ -2145,19 +2032,12 @@ struct FManifestFunctionDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= (bPure ? 1ULL : 0ULL) << 4;
-		for (const auto& Param : InputParams)
-		{
-			Hash ^= Param.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Param : OutputParams)
-		{
-			Hash ^= Param.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("bPure"), bPure);
+		Hash.Field(TEXT("InputParams"), InputParams);
+		Hash.Field(TEXT("OutputParams"), OutputParams);
+		return Hash.Finalize();
 	}
 };
 
@@ -2190,40 +2070,29 @@ struct FManifestComponentBlueprintDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentClass) << 4;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
 		// NOTE: Folder excluded - presentational only
 
 		// Variables
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("Variables"), Variables);
 
 		// Event Dispatchers
-		for (const auto& Disp : EventDispatchers)
-		{
-			Hash ^= Disp.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("EventDispatchers"), EventDispatchers);
 
 		// Functions
-		for (const auto& Func : Functions)
-		{
-			Hash ^= Func.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
+		Hash.Field(TEXT("Functions"), Functions);
 
 		// Tick configuration
-		Hash ^= (bCanEverTick ? 1ULL : 0ULL) << 8;
-		Hash ^= (bStartWithTickEnabled ? 1ULL : 0ULL) << 9;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TickInterval * 1000.f)) << 10;
+		Hash.Field(TEXT("bCanEverTick"), bCanEverTick);
+		Hash.Field(TEXT("bStartWithTickEnabled"), bStartWithTickEnabled);
+		Hash.Field(TEXT("TickInterval"), FMath::RoundToInt(TickInterval * 1000.f));
 
 		// v7.8.52: Activation
-		Hash ^= (bAutoActivate ? 1ULL : 0ULL) << 11;
+		Hash.Field(TEXT("bAutoActivate"), bAutoActivate);
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -2261,60 +2130,32 @@ struct FManifestBlueprintConditionDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentClass) << 4;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= (bNot ? 1ULL : 0ULL) << 8;
-		Hash ^= GetTypeHash(ConditionFilter) << 12;
-		Hash ^= GetTypeHash(PartyConditionPolicy) << 16;
+		Hash.Field(TEXT("bNot"), bNot);
+		Hash.Field(TEXT("ConditionFilter"), ConditionFilter);
+		Hash.Field(TEXT("PartyConditionPolicy"), PartyConditionPolicy);
 
 		// Targets
-		for (const auto& Target : CharacterTargets)
-		{
-			Hash ^= GetTypeHash(Target);
-			Hash = (Hash << 2) | (Hash >> 62);
-		}
-		for (const auto& Target : NPCTargets)
-		{
-			Hash ^= GetTypeHash(Target);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Target : PlayerTargets)
-		{
-			Hash ^= GetTypeHash(Target);
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
+		Hash.Field(TEXT("CharacterTargets"), CharacterTargets);
+		Hash.Field(TEXT("NPCTargets"), NPCTargets);
+		Hash.Field(TEXT("PlayerTargets"), PlayerTargets);
 
 		// Properties
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("Properties"), Properties);
 
 		// Variables
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 6) | (Hash >> 58);
-		}
+		Hash.Field(TEXT("Variables"), Variables);
 
 		// Event graph
-		Hash ^= GetTypeHash(EventGraphName) << 20;
-		Hash ^= (bHasInlineEventGraph ? 1ULL : 0ULL) << 24;
-		for (const auto& Node : EventGraphNodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		for (const auto& Conn : EventGraphConnections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 8) | (Hash >> 56);
-		}
+		Hash.Field(TEXT("EventGraphName"), EventGraphName);
+		Hash.Field(TEXT("bHasInlineEventGraph"), bHasInlineEventGraph);
+		Hash.Field(TEXT("EventGraphNodes"), EventGraphNodes);
+		Hash.Field(TEXT("EventGraphConnections"), EventGraphConnections);
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -2335,11 +2176,12 @@ struct FManifestBlackboardKeyDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 8;
-		Hash ^= (bInstanceSynced ? 1ULL : 0ULL) << 16;
-		Hash ^= GetTypeHash(BaseClass) << 24;  // v4.0
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("bInstanceSynced"), bInstanceSynced);
+		Hash.Field(TEXT("BaseClass"), BaseClass);  // v4.0
+		return Hash.Finalize();
 	}
 };
 
@@ -2358,14 +2200,11 @@ struct FManifestBlackboardDefinition
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Parent) << 4;  // v4.0
-		for (const auto& Key : Keys)
-		{
-			Hash ^= Key.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Parent"), Parent);  // v4.0
+		Hash.Field(TEXT("Keys"), Keys);
+		return Hash.Finalize();
 	}
 };
 
@@ -2389,18 +2228,15 @@ struct FManifestBTDecoratorDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Class);
-		Hash ^= GetTypeHash(BlackboardKey) << 8;
-		Hash ^= GetTypeHash(Operation) << 16;
-		Hash ^= static_cast<uint64>(bInverseCondition ? 1 : 0) << 24;
-		Hash ^= GetTypeHash(FlowAbortMode) << 28;
-		Hash ^= static_cast<uint64>(GetTypeHash(NotifyObserver)) << 32;  // Cast to uint64 before shifting
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Class"), Class);
+		Hash.Field(TEXT("BlackboardKey"), BlackboardKey);
+		Hash.Field(TEXT("Operation"), Operation);
+		Hash.Field(TEXT("bInverseCondition"), bInverseCondition);
+		Hash.Field(TEXT("FlowAbortMode"), FlowAbortMode);
+		Hash.Field(TEXT("NotifyObserver"), NotifyObserver);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -2421,17 +2257,14 @@ struct FManifestBTServiceDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Class);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Interval * 1000.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(RandomDeviation * 1000.f)) << 16;
-		Hash ^= static_cast<uint64>(bCallTickOnSearchStart ? 1 : 0) << 24;
-		Hash ^= static_cast<uint64>(bRestartTimerOnActivation ? 1 : 0) << 28;
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Class"), Class);
+		Hash.Field(TEXT("Interval"), FMath::RoundToInt(Interval * 1000.f));
+		Hash.Field(TEXT("RandomDeviation"), FMath::RoundToInt(RandomDeviation * 1000.f));
+		Hash.Field(TEXT("bCallTickOnSearchStart"), bCallTickOnSearchStart);
+		Hash.Field(TEXT("bRestartTimerOnActivation"), bRestartTimerOnActivation);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -2452,33 +2285,17 @@ struct FManifestBTNodeDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(TaskClass) << 8;
-		Hash ^= GetTypeHash(BlackboardKey) << 12;
-		for (const FString& Child : Children)
-		{
-			Hash ^= GetTypeHash(Child);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Decorator : Decorators)
-		{
-			Hash ^= Decorator.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Service : Services)
-		{
-			Hash ^= Service.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("TaskClass"), TaskClass);
+		Hash.Field(TEXT("BlackboardKey"), BlackboardKey);
+		Hash.Field(TEXT("Children"), Children);
+		Hash.Field(TEXT("Decorators"), Decorators);
+		Hash.Field(TEXT("Services"), Services);
 		// v4.0: Include properties in hash
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-			Hash = (Hash << 2) | (Hash >> 62);
-		}
-		return Hash;
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -2497,16 +2314,13 @@ struct FManifestBehaviorTreeDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(BlackboardAsset) << 8;
-		Hash ^= GetTypeHash(RootType) << 16;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("BlackboardAsset"), BlackboardAsset);
+		Hash.Field(TEXT("RootType"), RootType);
 		// NOTE: Folder excluded - presentational only
-		for (const auto& Node : Nodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		Hash.Field(TEXT("Nodes"), Nodes);
+		return Hash.Finalize();
 	}
 };
 
@@ -2542,36 +2356,22 @@ struct FManifestMaterialExpression
 	/** v3.0: Compute hash for change detection (excludes PosX, PosY - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(Name) << 8;
-		Hash ^= GetTypeHash(DefaultValue) << 12;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("DefaultValue"), DefaultValue);
 		// NOTE: PosX, PosY excluded - presentational only
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value) << 4;
-		}
+		Hash.Field(TEXT("Properties"), Properties);
 		// v4.0: Include texture properties in hash
-		Hash ^= GetTypeHash(TexturePath) << 16;
-		Hash ^= GetTypeHash(SamplerType) << 20;
-		// v4.10: Include switch inputs in hash (use prime multiplication to avoid collisions)
-		uint32 InputsHash = 0;
-		for (const auto& Input : Inputs)
-		{
-			InputsHash = InputsHash * 31 + GetTypeHash(Input.Key);
-			InputsHash = InputsHash * 37 + GetTypeHash(Input.Value);
-		}
-		Hash ^= InputsHash;
+		Hash.Field(TEXT("TexturePath"), TexturePath);
+		Hash.Field(TEXT("SamplerType"), SamplerType);
+		// v4.10: Include switch inputs in hash
+		Hash.Field(TEXT("Inputs"), Inputs);
 		// v4.10: Include function call properties in hash
-		uint32 FuncHash = GetTypeHash(Function);
-		for (const auto& FuncInput : FunctionInputs)
-		{
-			FuncHash = FuncHash * 41 + GetTypeHash(FuncInput.Key);
-			FuncHash = FuncHash * 43 + GetTypeHash(FuncInput.Value);
-		}
-		Hash ^= FuncHash << 4;  // Slight offset to reduce XOR collisions
-		return Hash;
+		Hash.Field(TEXT("Function"), Function);
+		Hash.Field(TEXT("FunctionInputs"), FunctionInputs);
+		return Hash.Finalize();
 	}
 };
 
@@ -2588,11 +2388,12 @@ struct FManifestMaterialConnection
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(FromId);
-		Hash ^= GetTypeHash(FromOutput) << 4;
-		Hash ^= GetTypeHash(ToId) << 8;
-		Hash ^= GetTypeHash(ToInput) << 12;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("FromId"), FromId);
+		Hash.Field(TEXT("FromOutput"), FromOutput);
+		Hash.Field(TEXT("ToId"), ToId);
+		Hash.Field(TEXT("ToInput"), ToInput);
+		return Hash.Finalize();
 	}
 };
 
@@ -2628,38 +2429,27 @@ struct FManifestMaterialDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(BlendMode) << 4;
-		Hash ^= GetTypeHash(ShadingModel) << 8;
-		Hash ^= (bTwoSided ? 1ULL : 0ULL) << 12;
-		for (const auto& Param : Parameters)
-		{
-			Hash ^= GetTypeHash(Param.Key);
-			Hash ^= GetTypeHash(Param.Value) << 4;
-		}
-		for (const auto& Expr : Expressions)
-		{
-			Hash ^= Expr.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Conn : Connections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("BlendMode"), BlendMode);
+		Hash.Field(TEXT("ShadingModel"), ShadingModel);
+		Hash.Field(TEXT("bTwoSided"), bTwoSided);
+		Hash.Field(TEXT("Parameters"), Parameters);
+		Hash.Field(TEXT("Expressions"), Expressions);
+		Hash.Field(TEXT("Connections"), Connections);
 		// v4.0: Include extended properties
-		Hash ^= GetTypeHash(MaterialDomain) << 16;
-		Hash ^= GetTypeHash(CullMode) << 20;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(OpacityMaskClipValue * 1000.f)) << 24;
-		Hash ^= GetTypeHash(TranslucencyPass) << 28;
-		Hash ^= (bEnableSeparateTranslucency ? 1ULL : 0ULL) << 32;
-		Hash ^= (bEnableResponsiveAA ? 1ULL : 0ULL) << 33;
-		Hash ^= static_cast<uint64>(GetTypeHash(DecalResponse)) << 36;
-		Hash ^= (bCastDynamicShadow ? 1ULL : 0ULL) << 40;
-		Hash ^= (bAffectDynamicIndirectLighting ? 1ULL : 0ULL) << 41;
-		Hash ^= (bBlockGI ? 1ULL : 0ULL) << 42;
-		return Hash;
+		Hash.Field(TEXT("MaterialDomain"), MaterialDomain);
+		Hash.Field(TEXT("CullMode"), CullMode);
+		Hash.Field(TEXT("OpacityMaskClipValue"), FMath::RoundToInt(OpacityMaskClipValue * 1000.f));
+		Hash.Field(TEXT("TranslucencyPass"), TranslucencyPass);
+		Hash.Field(TEXT("bEnableSeparateTranslucency"), bEnableSeparateTranslucency);
+		Hash.Field(TEXT("bEnableResponsiveAA"), bEnableResponsiveAA);
+		Hash.Field(TEXT("DecalResponse"), DecalResponse);
+		Hash.Field(TEXT("bCastDynamicShadow"), bCastDynamicShadow);
+		Hash.Field(TEXT("bAffectDynamicIndirectLighting"), bAffectDynamicIndirectLighting);
+		Hash.Field(TEXT("bBlockGI"), bBlockGI);
+		return Hash.Finalize();
 	}
 };
 
@@ -2673,9 +2463,10 @@ struct FManifestMaterialInstanceScalarParam
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Value * 10000.f)) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Value"), FMath::RoundToInt(Value * 10000.f));
+		return Hash.Finalize();
 	}
 };
 
@@ -2689,12 +2480,13 @@ struct FManifestMaterialInstanceVectorParam
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Value.R * 1000.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Value.G * 1000.f)) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Value.B * 1000.f)) << 24;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Value.A * 1000.f)) << 32;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Value.R"), FMath::RoundToInt(Value.R * 1000.f));
+		Hash.Field(TEXT("Value.G"), FMath::RoundToInt(Value.G * 1000.f));
+		Hash.Field(TEXT("Value.B"), FMath::RoundToInt(Value.B * 1000.f));
+		Hash.Field(TEXT("Value.A"), FMath::RoundToInt(Value.A * 1000.f));
+		return Hash.Finalize();
 	}
 };
 
@@ -2708,9 +2500,10 @@ struct FManifestMaterialInstanceTextureParam
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(TexturePath) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("TexturePath"), TexturePath);
+		return Hash.Finalize();
 	}
 };
 
@@ -2730,24 +2523,13 @@ struct FManifestMaterialInstanceDefinition
 	/** v4.9: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentMaterial) << 4;
-		for (const auto& Param : ScalarParams)
-		{
-			Hash ^= Param.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Param : VectorParams)
-		{
-			Hash ^= Param.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Param : TextureParams)
-		{
-			Hash ^= Param.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentMaterial"), ParentMaterial);
+		Hash.Field(TEXT("ScalarParams"), ScalarParams);
+		Hash.Field(TEXT("VectorParams"), VectorParams);
+		Hash.Field(TEXT("TextureParams"), TextureParams);
+		return Hash.Finalize();
 	}
 };
 
@@ -2764,11 +2546,12 @@ struct FManifestMaterialFunctionInput
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(DefaultValue) << 8;
-		Hash ^= static_cast<uint64>(SortPriority) << 12;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("DefaultValue"), DefaultValue);
+		Hash.Field(TEXT("SortPriority"), SortPriority);
+		return Hash.Finalize();
 	}
 };
 
@@ -2784,10 +2567,11 @@ struct FManifestMaterialFunctionOutput
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= static_cast<uint64>(SortPriority) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("SortPriority"), SortPriority);
+		return Hash.Finalize();
 	}
 };
 
@@ -2808,31 +2592,16 @@ struct FManifestMaterialFunctionDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(Description) << 4;
-		Hash ^= (bExposeToLibrary ? 1ULL : 0ULL) << 8;
-		for (const auto& In : Inputs)
-		{
-			Hash ^= In.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Out : Outputs)
-		{
-			Hash ^= Out.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Expr : Expressions)
-		{
-			Hash ^= Expr.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		for (const auto& Conn : Connections)
-		{
-			Hash ^= Conn.ComputeHash();
-			Hash = (Hash << 11) | (Hash >> 53);
-		}
-		return Hash;
+		Hash.Field(TEXT("Description"), Description);
+		Hash.Field(TEXT("bExposeToLibrary"), bExposeToLibrary);
+		Hash.Field(TEXT("Inputs"), Inputs);
+		Hash.Field(TEXT("Outputs"), Outputs);
+		Hash.Field(TEXT("Expressions"), Expressions);
+		Hash.Field(TEXT("Connections"), Connections);
+		return Hash.Finalize();
 	}
 };
 
@@ -2862,13 +2631,14 @@ struct FManifestFloatCurveKeyDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(FMath::RoundToInt(Time * 1000.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Value * 1000.f)) << 16;
-		Hash ^= static_cast<uint64>(GetTypeHash(InterpMode)) << 32;
-		Hash ^= static_cast<uint64>(GetTypeHash(TangentMode)) << 40;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ArriveTangent * 100.f)) << 48;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(LeaveTangent * 100.f)) << 56;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Time"), FMath::RoundToInt(Time * 1000.f));
+		Hash.Field(TEXT("Value"), FMath::RoundToInt(Value * 1000.f));
+		Hash.Field(TEXT("InterpMode"), InterpMode);
+		Hash.Field(TEXT("TangentMode"), TangentMode);
+		Hash.Field(TEXT("ArriveTangent"), FMath::RoundToInt(ArriveTangent * 100.f));
+		Hash.Field(TEXT("LeaveTangent"), FMath::RoundToInt(LeaveTangent * 100.f));
+		return Hash.Finalize();
 	}
 };
 
@@ -2892,16 +2662,13 @@ struct FManifestFloatCurveDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(ExtrapolationBefore) << 4;
-		Hash ^= GetTypeHash(ExtrapolationAfter) << 8;
-		for (const auto& Key : Keys)
-		{
-			Hash ^= Key.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		Hash.Field(TEXT("ExtrapolationBefore"), ExtrapolationBefore);
+		Hash.Field(TEXT("ExtrapolationAfter"), ExtrapolationAfter);
+		Hash.Field(TEXT("Keys"), Keys);
+		return Hash.Finalize();
 	}
 };
 
@@ -2918,15 +2685,12 @@ struct FManifestAnimationMontageDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(Skeleton) << 8;
-		for (const FString& Section : Sections)
-		{
-			Hash ^= GetTypeHash(Section);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		Hash.Field(TEXT("Skeleton"), Skeleton);
+		Hash.Field(TEXT("Sections"), Sections);
+		return Hash.Finalize();
 	}
 };
 
@@ -2950,18 +2714,15 @@ struct FManifestAnimationNotifyDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(NotifyClass) << 8;
+		Hash.Field(TEXT("NotifyClass"), NotifyClass);
 		// v4.0: Include variables and event graph in hash
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		Hash ^= GetTypeHash(EventGraph) << 16;
-		Hash ^= InlineEventGraph.ComputeHash() << 24;
-		return Hash;
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		Hash.Field(TEXT("InlineEventGraph"), InlineEventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -2978,11 +2739,12 @@ struct FManifestDialogueLineDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Text);
-		Hash ^= GetTypeHash(Audio) << 4;
-		Hash ^= GetTypeHash(Montage) << 8;
-		Hash ^= GetTypeHash(FacialAnimation) << 12;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Text"), Text);
+		Hash.Field(TEXT("Audio"), Audio);
+		Hash.Field(TEXT("Montage"), Montage);
+		Hash.Field(TEXT("FacialAnimation"), FacialAnimation);
+		return Hash.Finalize();
 	}
 };
 
@@ -2997,14 +2759,11 @@ struct FManifestDialogueEventDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Type);
-		Hash ^= GetTypeHash(Runtime) << 4;
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Runtime"), Runtime);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -3019,14 +2778,11 @@ struct FManifestDialogueConditionDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Type);
-		Hash ^= bNot ? 1ULL : 0ULL;
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("bNot"), bNot);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -3068,37 +2824,35 @@ struct FManifestDialogueNodeDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(Type) << 4;
-		Hash ^= GetTypeHash(Speaker) << 8;
-		Hash ^= static_cast<uint64>(GetTypeHash(Text)) << 12;
-		Hash ^= static_cast<uint64>(GetTypeHash(OptionText)) << 16;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Speaker"), Speaker);
+		Hash.Field(TEXT("Text"), Text);
+		Hash.Field(TEXT("OptionText"), OptionText);
 		// v4.1: Include HintText and FacialAnimation in hash
-		Hash ^= static_cast<uint64>(GetTypeHash(HintText)) << 18;
-		Hash ^= static_cast<uint64>(GetTypeHash(Audio)) << 20;
-		Hash ^= static_cast<uint64>(GetTypeHash(Montage)) << 24;
-		Hash ^= static_cast<uint64>(GetTypeHash(FacialAnimation)) << 26;
-		Hash ^= static_cast<uint64>(GetTypeHash(Duration)) << 28;
-		Hash ^= static_cast<uint64>(GetTypeHash(static_cast<int32>(DurationSeconds * 1000.f))) << 32;
-		Hash ^= (bAutoSelect ? 1ULL : 0ULL) << 36;
-		Hash ^= (bAutoSelectIfOnly ? 1ULL : 0ULL) << 37;
-		Hash ^= (bIsSkippable ? 1ULL : 0ULL) << 38;
-		Hash ^= static_cast<uint64>(GetTypeHash(DirectedAt)) << 40;
-		for (const auto& Reply : NPCReplies) { Hash ^= GetTypeHash(Reply); }
-		for (const auto& Reply : PlayerReplies) { Hash ^= GetTypeHash(Reply); }
-		for (const auto& Alt : AlternativeLines) { Hash ^= Alt.ComputeHash(); }
-		for (const auto& Evt : Events) { Hash ^= Evt.ComputeHash(); }
-		for (const auto& Cond : Conditions) { Hash ^= Cond.ComputeHash(); }
+		Hash.Field(TEXT("HintText"), HintText);
+		Hash.Field(TEXT("Audio"), Audio);
+		Hash.Field(TEXT("Montage"), Montage);
+		Hash.Field(TEXT("FacialAnimation"), FacialAnimation);
+		Hash.Field(TEXT("Duration"), Duration);
+		Hash.Field(TEXT("DurationSeconds"), static_cast<int32>(DurationSeconds * 1000.f));
+		Hash.Field(TEXT("bAutoSelect"), bAutoSelect);
+		Hash.Field(TEXT("bAutoSelectIfOnly"), bAutoSelectIfOnly);
+		Hash.Field(TEXT("bIsSkippable"), bIsSkippable);
+		Hash.Field(TEXT("DirectedAt"), DirectedAt);
+		Hash.Field(TEXT("NPCReplies"), NPCReplies);
+		Hash.Field(TEXT("PlayerReplies"), PlayerReplies);
+		Hash.Field(TEXT("AlternativeLines"), AlternativeLines);
+		Hash.Field(TEXT("Events"), Events);
+		Hash.Field(TEXT("Conditions"), Conditions);
 		// v3.9.6: Include quest shortcuts in hash
-		Hash ^= static_cast<uint64>(GetTypeHash(StartQuest));
-		Hash = (Hash << 3) | (Hash >> 61);
-		Hash ^= static_cast<uint64>(GetTypeHash(CompleteQuestBranch));
-		Hash = (Hash << 3) | (Hash >> 61);
-		Hash ^= static_cast<uint64>(GetTypeHash(FailQuest));
-		Hash = (Hash << 3) | (Hash >> 61);
+		Hash.Field(TEXT("StartQuest"), StartQuest);
+		Hash.Field(TEXT("CompleteQuestBranch"), CompleteQuestBranch);
+		Hash.Field(TEXT("FailQuest"), FailQuest);
 		// v4.2: Include custom event callback in hash
-		Hash ^= static_cast<uint64>(GetTypeHash(OnPlayNodeFuncName));
-		return Hash;
+		Hash.Field(TEXT("OnPlayNodeFuncName"), OnPlayNodeFuncName);
+		return Hash.Finalize();
 	}
 };
 
@@ -3112,13 +2866,10 @@ struct FManifestDialogueTreeDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(RootNodeId);
-		for (const auto& Node : Nodes)
-		{
-			Hash ^= Node.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("RootNodeId"), RootNodeId);
+		Hash.Field(TEXT("Nodes"), Nodes);
+		return Hash.Finalize();
 	}
 };
 
@@ -3136,16 +2887,13 @@ struct FManifestDialogueSpeakerDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(NPCDefinition);
-		Hash ^= GetTypeHash(SpeakerID) << 4;
-		Hash ^= GetTypeHash(NodeColor) << 8;
-		Hash ^= (bIsPlayer ? 1ULL : 0ULL) << 12;
-		for (const auto& Tag : OwnedTags)
-		{
-			Hash ^= GetTypeHash(Tag);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("NPCDefinition"), NPCDefinition);
+		Hash.Field(TEXT("SpeakerID"), SpeakerID);
+		Hash.Field(TEXT("NodeColor"), NodeColor);
+		Hash.Field(TEXT("bIsPlayer"), bIsPlayer);
+		Hash.Field(TEXT("OwnedTags"), OwnedTags);
+		return Hash.Finalize();
 	}
 };
 
@@ -3160,10 +2908,11 @@ struct FManifestPlayerSpeakerDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(SpeakerID);
-		Hash ^= GetTypeHash(NodeColor) << 8;
-		Hash ^= GetTypeHash(SelectingReplyShot) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("SpeakerID"), SpeakerID);
+		Hash.Field(TEXT("NodeColor"), NodeColor);
+		Hash.Field(TEXT("SelectingReplyShot"), SelectingReplyShot);
+		return Hash.Finalize();
 	}
 };
 
@@ -3192,16 +2941,17 @@ struct FManifestTransformDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(FMath::RoundToInt(LocationX * 100.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(LocationY * 100.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(LocationZ * 100.f)) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(RotationPitch * 100.f)) << 24;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(RotationYaw * 100.f)) << 32;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(RotationRoll * 100.f)) << 40;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ScaleX * 100.f)) << 48;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ScaleY * 100.f)) << 52;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ScaleZ * 100.f)) << 56;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("LocationX"), FMath::RoundToInt(LocationX * 100.f));
+		Hash.Field(TEXT("LocationY"), FMath::RoundToInt(LocationY * 100.f));
+		Hash.Field(TEXT("LocationZ"), FMath::RoundToInt(LocationZ * 100.f));
+		Hash.Field(TEXT("RotationPitch"), FMath::RoundToInt(RotationPitch * 100.f));
+		Hash.Field(TEXT("RotationYaw"), FMath::RoundToInt(RotationYaw * 100.f));
+		Hash.Field(TEXT("RotationRoll"), FMath::RoundToInt(RotationRoll * 100.f));
+		Hash.Field(TEXT("ScaleX"), FMath::RoundToInt(ScaleX * 100.f));
+		Hash.Field(TEXT("ScaleY"), FMath::RoundToInt(ScaleY * 100.f));
+		Hash.Field(TEXT("ScaleZ"), FMath::RoundToInt(ScaleZ * 100.f));
+		return Hash.Finalize();
 	}
 };
 
@@ -3226,19 +2976,16 @@ struct FManifestDialogueSequenceDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(SequenceClass);
-		for (const FString& Asset : SequenceAssets)
-		{
-			Hash ^= GetTypeHash(Asset);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		Hash ^= static_cast<uint64>(GetTypeHash(AnchorOriginRule)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AnchorOriginNudgeX * 100.f)) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AnchorOriginNudgeY * 100.f)) << 24;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AnchorOriginNudgeZ * 100.f)) << 32;
-		Hash ^= static_cast<uint64>(GetTypeHash(AnchorRotationRule)) << 40;
-		Hash ^= (bUse180DegreeRule ? 1ULL : 0ULL) << 48;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("SequenceClass"), SequenceClass);
+		Hash.Field(TEXT("SequenceAssets"), SequenceAssets);
+		Hash.Field(TEXT("AnchorOriginRule"), AnchorOriginRule);
+		Hash.Field(TEXT("AnchorOriginNudgeX"), FMath::RoundToInt(AnchorOriginNudgeX * 100.f));
+		Hash.Field(TEXT("AnchorOriginNudgeY"), FMath::RoundToInt(AnchorOriginNudgeY * 100.f));
+		Hash.Field(TEXT("AnchorOriginNudgeZ"), FMath::RoundToInt(AnchorOriginNudgeZ * 100.f));
+		Hash.Field(TEXT("AnchorRotationRule"), AnchorRotationRule);
+		Hash.Field(TEXT("bUse180DegreeRule"), bUse180DegreeRule);
+		return Hash.Finalize();
 	}
 };
 
@@ -3296,58 +3043,45 @@ struct FManifestDialogueBlueprintDefinition
 	/** v4.8: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentClass) << 4;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
 		// NOTE: Folder excluded - presentational only
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		Hash ^= GetTypeHash(EventGraphName) << 8;
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraphName"), EventGraphName);
 		// v3.2: Include new configuration in hash
-		Hash ^= (bFreeMovement ? 1ULL : 0ULL) << 12;
-		Hash ^= (bUnskippable ? 1ULL : 0ULL) << 13;
-		Hash ^= (bCanBeExited ? 1ULL : 0ULL) << 14;
-		Hash ^= (bShowCinematicBars ? 1ULL : 0ULL) << 15;
-		Hash ^= (bAutoRotateSpeakers ? 1ULL : 0ULL) << 16;
-		Hash ^= (bAutoStopMovement ? 1ULL : 0ULL) << 17;
-		Hash ^= GetTypeHash(Priority) << 18;
-		Hash ^= GetTypeHash(static_cast<int32>(EndDialogueDist)) << 22;
+		Hash.Field(TEXT("bFreeMovement"), bFreeMovement);
+		Hash.Field(TEXT("bUnskippable"), bUnskippable);
+		Hash.Field(TEXT("bCanBeExited"), bCanBeExited);
+		Hash.Field(TEXT("bShowCinematicBars"), bShowCinematicBars);
+		Hash.Field(TEXT("bAutoRotateSpeakers"), bAutoRotateSpeakers);
+		Hash.Field(TEXT("bAutoStopMovement"), bAutoStopMovement);
+		Hash.Field(TEXT("Priority"), Priority);
+		Hash.Field(TEXT("EndDialogueDist"), static_cast<int32>(EndDialogueDist));
 		// v3.5: Additional properties
-		Hash ^= GetTypeHash(DefaultHeadBoneName) << 26;
-		Hash ^= GetTypeHash(static_cast<int32>(DialogueBlendOutTime * 1000.f)) << 30;
-		Hash ^= (bAdjustPlayerTransform ? 1ULL : 0ULL) << 34;
+		Hash.Field(TEXT("DefaultHeadBoneName"), DefaultHeadBoneName);
+		Hash.Field(TEXT("DialogueBlendOutTime"), static_cast<int32>(DialogueBlendOutTime * 1000.f));
+		Hash.Field(TEXT("bAdjustPlayerTransform"), bAdjustPlayerTransform);
 		// v4.1: Include camera shake in hash
-		Hash ^= static_cast<uint64>(GetTypeHash(CameraShake)) << 36;
+		Hash.Field(TEXT("CameraShake"), CameraShake);
 		// v4.8.3: Include new dialogue properties
-		Hash ^= static_cast<uint64>(GetTypeHash(DialogueSoundAttenuation)) << 38;
+		Hash.Field(TEXT("DialogueSoundAttenuation"), DialogueSoundAttenuation);
 		if (!PlayerAutoAdjustTransform.IsDefault())
 		{
-			Hash ^= PlayerAutoAdjustTransform.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
+			Hash.Field(TEXT("PlayerAutoAdjustTransform"), PlayerAutoAdjustTransform);
 		}
 		if (!DefaultDialogueShot.IsEmpty())
 		{
-			Hash ^= DefaultDialogueShot.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Speaker : Speakers)
-		{
-			Hash ^= Speaker.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
+			Hash.Field(TEXT("DefaultDialogueShot"), DefaultDialogueShot);
 		}
+		Hash.Field(TEXT("Speakers"), Speakers);
 		// v4.0: Include player speaker in hash
-		Hash ^= PlayerSpeaker.ComputeHash() << 40;
+		Hash.Field(TEXT("PlayerSpeaker"), PlayerSpeaker);
 		// v4.8: Include party speaker info in hash
-		for (const auto& PartySpeaker : PartySpeakerInfo)
-		{
-			Hash ^= PartySpeaker.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("PartySpeakerInfo"), PartySpeakerInfo);
 		// v3.7: Include dialogue tree in hash
-		Hash ^= DialogueTree.ComputeHash() << 44;
-		return Hash;
+		Hash.Field(TEXT("DialogueTree"), DialogueTree);
+		return Hash.Finalize();
 	}
 };
 
@@ -3421,7 +3155,10 @@ struct FManifestMaterialParamBinding
 
 	uint64 ComputeHash() const
 	{
-		return GetTypeHash(ParameterName) ^ (GetTypeHash(TagId) << 16);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("ParameterName"), ParameterName);
+		Hash.Field(TEXT("TagId"), TagId);
+		return Hash.Finalize();
 	}
 };
 
@@ -3436,18 +3173,11 @@ struct FManifestClothingMaterial
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Material);
-		for (const auto& VP : VectorParams)
-		{
-			Hash ^= VP.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& SP : ScalarParams)
-		{
-			Hash ^= SP.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Material"), Material);
+		Hash.Field(TEXT("VectorParams"), VectorParams);
+		Hash.Field(TEXT("ScalarParams"), ScalarParams);
+		return Hash.Finalize();
 	}
 };
 
@@ -3461,13 +3191,10 @@ struct FManifestClothingMorph
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(ScalarTag);
-		for (const FString& Name : MorphNames)
-		{
-			Hash ^= GetTypeHash(Name);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("ScalarTag"), ScalarTag);
+		Hash.Field(TEXT("MorphNames"), MorphNames);
+		return Hash.Finalize();
 	}
 };
 
@@ -3492,26 +3219,19 @@ struct FManifestClothingMeshConfig
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Mesh);
-		Hash ^= (bUseLeaderPose ? 1ULL : 0ULL) << 4;
-		Hash ^= (bIsStaticMesh ? 1ULL : 0ULL) << 5;
-		Hash ^= GetTypeHash(StaticMesh) << 8;
-		Hash ^= GetTypeHash(AttachSocket) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AttachLocation.X * 10.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AttachLocation.Y * 10.f)) << 10;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AttachLocation.Z * 10.f)) << 20;
-		Hash ^= GetTypeHash(MeshAnimBP) << 24;
-		for (const auto& Mat : Materials)
-		{
-			Hash ^= Mat.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Morph : Morphs)
-		{
-			Hash ^= Morph.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Mesh"), Mesh);
+		Hash.Field(TEXT("bUseLeaderPose"), bUseLeaderPose);
+		Hash.Field(TEXT("bIsStaticMesh"), bIsStaticMesh);
+		Hash.Field(TEXT("StaticMesh"), StaticMesh);
+		Hash.Field(TEXT("AttachSocket"), AttachSocket);
+		Hash.Field(TEXT("AttachLocation.X"), FMath::RoundToInt(AttachLocation.X * 10.f));
+		Hash.Field(TEXT("AttachLocation.Y"), FMath::RoundToInt(AttachLocation.Y * 10.f));
+		Hash.Field(TEXT("AttachLocation.Z"), FMath::RoundToInt(AttachLocation.Z * 10.f));
+		Hash.Field(TEXT("MeshAnimBP"), MeshAnimBP);
+		Hash.Field(TEXT("Materials"), Materials);
+		Hash.Field(TEXT("Morphs"), Morphs);
+		return Hash.Finalize();
 	}
 };
 
@@ -3528,11 +3248,12 @@ struct FManifestWeaponAttachmentSlot
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Slot);
-		Hash ^= GetTypeHash(Socket) << 4;
-		Hash ^= GetTypeHash(Offset.ToString()) << 8;
-		Hash ^= GetTypeHash(Rotation.ToString()) << 12;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Slot"), Slot);
+		Hash.Field(TEXT("Socket"), Socket);
+		Hash.Field(TEXT("Offset.ToString()"), Offset.ToString());
+		Hash.Field(TEXT("Rotation.ToString()"), Rotation.ToString());
+		return Hash.Finalize();
 	}
 };
 
@@ -3551,12 +3272,13 @@ struct FManifestWeaponAttachmentConfigEntry
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Slot);
-		Hash ^= GetTypeHash(SocketName) << 4;
-		Hash ^= GetTypeHash(Location.ToString()) << 8;
-		Hash ^= GetTypeHash(Rotation.ToString()) << 12;
-		Hash ^= GetTypeHash(Scale.ToString()) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Slot"), Slot);
+		Hash.Field(TEXT("SocketName"), SocketName);
+		Hash.Field(TEXT("Location.ToString()"), Location.ToString());
+		Hash.Field(TEXT("Rotation.ToString()"), Rotation.ToString());
+		Hash.Field(TEXT("Scale.ToString()"), Scale.ToString());
+		return Hash.Finalize();
 	}
 };
 
@@ -3573,13 +3295,10 @@ struct FManifestPickupMeshDataDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(PickupMesh);
-		for (const FString& Mat : PickupMeshMaterials)
-		{
-			Hash ^= GetTypeHash(Mat);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("PickupMesh"), PickupMesh);
+		Hash.Field(TEXT("PickupMeshMaterials"), PickupMeshMaterials);
+		return Hash.Finalize();
 	}
 };
 
@@ -3597,10 +3316,11 @@ struct FManifestCombatTraceDataDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(FMath::RoundToInt(TraceDistance * 10.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TraceRadius * 100.f)) << 16;
-		Hash ^= (bTraceMulti ? 1ULL : 0ULL) << 32;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("TraceDistance"), FMath::RoundToInt(TraceDistance * 10.f));
+		Hash.Field(TEXT("TraceRadius"), FMath::RoundToInt(TraceRadius * 100.f));
+		Hash.Field(TEXT("bTraceMulti"), bTraceMulti);
+		return Hash.Finalize();
 	}
 };
 
@@ -3617,10 +3337,11 @@ struct FManifestItemStatDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(StatDisplayName);
-		Hash ^= GetTypeHash(StringVariable) << 8;
-		Hash ^= GetTypeHash(StatTooltip) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("StatDisplayName"), StatDisplayName);
+		Hash.Field(TEXT("StringVariable"), StringVariable);
+		Hash.Field(TEXT("StatTooltip"), StatTooltip);
+		return Hash.Finalize();
 	}
 };
 
@@ -3636,9 +3357,10 @@ struct FManifestFragmentPropertyDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Key);
-		Hash ^= GetTypeHash(Value) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Key"), Key);
+		Hash.Field(TEXT("Value"), Value);
+		return Hash.Finalize();
 	}
 };
 
@@ -3653,13 +3375,10 @@ struct FManifestFragmentDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Class);
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= Prop.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Class"), Class);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -3804,244 +3523,145 @@ struct FManifestEquippableItemDefinition
 	/** v4.8.2: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(ParentClass) << 4;
-		Hash ^= GetTypeHash(DisplayName) << 8;
-		Hash ^= GetTypeHash(Description) << 12;
-		Hash ^= GetTypeHash(EquipmentSlot) << 16;
-		Hash ^= GetTypeHash(EquipmentModifierGE) << 20;
-		for (const FString& Ability : AbilitiesToGrant)
-		{
-			Hash ^= GetTypeHash(Ability);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("DisplayName"), DisplayName);
+		Hash.Field(TEXT("Description"), Description);
+		Hash.Field(TEXT("EquipmentSlot"), EquipmentSlot);
+		Hash.Field(TEXT("EquipmentModifierGE"), EquipmentModifierGE);
+		Hash.Field(TEXT("AbilitiesToGrant"), AbilitiesToGrant);
 
 		// v3.3: Hash NarrativeItem/EquippableItem properties
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AttackRating * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ArmorRating * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(StealthRating * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(Thumbnail);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Weight * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(BaseValue);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(BaseScore * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= (bStackable ? 1ULL : 0ULL);
-		Hash ^= static_cast<uint64>(MaxStackSize) << 4;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(UseRechargeDuration * 100.f)) << 12;
-		for (const FString& Tag : ItemTags)
-		{
-			Hash ^= GetTypeHash(Tag);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("AttackRating"), FMath::RoundToInt(AttackRating * 100.f));
+		Hash.Field(TEXT("ArmorRating"), FMath::RoundToInt(ArmorRating * 100.f));
+		Hash.Field(TEXT("StealthRating"), FMath::RoundToInt(StealthRating * 100.f));
+		Hash.Field(TEXT("Thumbnail"), Thumbnail);
+		Hash.Field(TEXT("Weight"), FMath::RoundToInt(Weight * 100.f));
+		Hash.Field(TEXT("BaseValue"), BaseValue);
+		Hash.Field(TEXT("BaseScore"), FMath::RoundToInt(BaseScore * 100.f));
+		Hash.Field(TEXT("bStackable"), bStackable);
+		Hash.Field(TEXT("MaxStackSize"), MaxStackSize);
+		Hash.Field(TEXT("UseRechargeDuration"), FMath::RoundToInt(UseRechargeDuration * 100.f));
+		Hash.Field(TEXT("ItemTags"), ItemTags);
 
 		// v3.4: Hash WeaponItem properties
-		Hash ^= GetTypeHash(WeaponVisualClass);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(WeaponHand);
-		Hash = (Hash << 5) | (Hash >> 59);
-		for (const FString& Ability : WeaponAbilities)
-		{
-			Hash ^= GetTypeHash(Ability);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Ability : MainhandAbilities)
-		{
-			Hash ^= GetTypeHash(Ability);
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
-		for (const FString& Ability : OffhandAbilities)
-		{
-			Hash ^= GetTypeHash(Ability);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		Hash ^= (bPawnFollowsControlRotation ? 1ULL : 0ULL) << 6;
-		Hash ^= (bPawnOrientsRotationToMovement ? 1ULL : 0ULL) << 7;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AttackDamage * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(HeavyAttackDamageMultiplier * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= (bAllowManualReload ? 1ULL : 0ULL) << 8;
-		Hash ^= GetTypeHash(RequiredAmmo);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= (bBotsConsumeAmmo ? 1ULL : 0ULL) << 9;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(BotAttackRange));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(ClipSize) << 10;
+		Hash.Field(TEXT("WeaponVisualClass"), WeaponVisualClass);
+		Hash.Field(TEXT("WeaponHand"), WeaponHand);
+		Hash.Field(TEXT("WeaponAbilities"), WeaponAbilities);
+		Hash.Field(TEXT("MainhandAbilities"), MainhandAbilities);
+		Hash.Field(TEXT("OffhandAbilities"), OffhandAbilities);
+		Hash.Field(TEXT("bPawnFollowsControlRotation"), bPawnFollowsControlRotation);
+		Hash.Field(TEXT("bPawnOrientsRotationToMovement"), bPawnOrientsRotationToMovement);
+		Hash.Field(TEXT("AttackDamage"), FMath::RoundToInt(AttackDamage * 100.f));
+		Hash.Field(TEXT("HeavyAttackDamageMultiplier"), FMath::RoundToInt(HeavyAttackDamageMultiplier * 100.f));
+		Hash.Field(TEXT("bAllowManualReload"), bAllowManualReload);
+		Hash.Field(TEXT("RequiredAmmo"), RequiredAmmo);
+		Hash.Field(TEXT("bBotsConsumeAmmo"), bBotsConsumeAmmo);
+		Hash.Field(TEXT("BotAttackRange"), FMath::RoundToInt(BotAttackRange));
+		Hash.Field(TEXT("ClipSize"), ClipSize);
 
 		// v3.4: Hash RangedWeaponItem properties
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AimFOVPct * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(BaseSpreadDegrees * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(MaxSpreadDegrees * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(SpreadFireBump * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(SpreadDecreaseSpeed * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
+		Hash.Field(TEXT("AimFOVPct"), FMath::RoundToInt(AimFOVPct * 100.f));
+		Hash.Field(TEXT("BaseSpreadDegrees"), FMath::RoundToInt(BaseSpreadDegrees * 100.f));
+		Hash.Field(TEXT("MaxSpreadDegrees"), FMath::RoundToInt(MaxSpreadDegrees * 100.f));
+		Hash.Field(TEXT("SpreadFireBump"), FMath::RoundToInt(SpreadFireBump * 100.f));
+		Hash.Field(TEXT("SpreadDecreaseSpeed"), FMath::RoundToInt(SpreadDecreaseSpeed * 100.f));
 
 		// v3.10: Hash additional RangedWeaponItem properties
-		Hash ^= GetTypeHash(CrosshairWidget);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AimWeaponRenderFOV * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AimWeaponFStop * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(MoveSpeedAddDegrees * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(CrouchSpreadMultiplier * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AimSpreadMultiplier * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(RecoilImpulseTranslationMin.ToString());
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(RecoilImpulseTranslationMax.ToString());
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(HipRecoilImpulseTranslationMin.ToString());
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(HipRecoilImpulseTranslationMax.ToString());
-		Hash = (Hash << 5) | (Hash >> 59);
+		Hash.Field(TEXT("CrosshairWidget"), CrosshairWidget);
+		Hash.Field(TEXT("AimWeaponRenderFOV"), FMath::RoundToInt(AimWeaponRenderFOV * 100.f));
+		Hash.Field(TEXT("AimWeaponFStop"), FMath::RoundToInt(AimWeaponFStop * 100.f));
+		Hash.Field(TEXT("MoveSpeedAddDegrees"), FMath::RoundToInt(MoveSpeedAddDegrees * 100.f));
+		Hash.Field(TEXT("CrouchSpreadMultiplier"), FMath::RoundToInt(CrouchSpreadMultiplier * 100.f));
+		Hash.Field(TEXT("AimSpreadMultiplier"), FMath::RoundToInt(AimSpreadMultiplier * 100.f));
+		Hash.Field(TEXT("RecoilImpulseTranslationMin.ToString()"), RecoilImpulseTranslationMin.ToString());
+		Hash.Field(TEXT("RecoilImpulseTranslationMax.ToString()"), RecoilImpulseTranslationMax.ToString());
+		Hash.Field(TEXT("HipRecoilImpulseTranslationMin.ToString()"), HipRecoilImpulseTranslationMin.ToString());
+		Hash.Field(TEXT("HipRecoilImpulseTranslationMax.ToString()"), HipRecoilImpulseTranslationMax.ToString());
 
 		// v3.10: Hash weapon attachment slots TMap
-		for (const FManifestWeaponAttachmentSlot& Slot : WeaponAttachmentSlots)
-		{
-			Hash ^= Slot.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("WeaponAttachmentSlots"), WeaponAttachmentSlots);
 
 		// v3.9.6: Hash usage properties
-		Hash ^= (bAddDefaultUseOption ? 1ULL : 0ULL) << 11;
-		Hash ^= (bConsumeOnUse ? 1ULL : 0ULL) << 12;
-		Hash ^= (bUsedWithOtherItem ? 1ULL : 0ULL) << 13;
-		Hash ^= GetTypeHash(UseActionText);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= (bCanActivate ? 1ULL : 0ULL) << 14;
-		Hash ^= (bToggleActiveOnUse ? 1ULL : 0ULL) << 15;
-		Hash ^= GetTypeHash(UseSound);
-		Hash = (Hash << 5) | (Hash >> 59);
+		Hash.Field(TEXT("bAddDefaultUseOption"), bAddDefaultUseOption);
+		Hash.Field(TEXT("bConsumeOnUse"), bConsumeOnUse);
+		Hash.Field(TEXT("bUsedWithOtherItem"), bUsedWithOtherItem);
+		Hash.Field(TEXT("UseActionText"), UseActionText);
+		Hash.Field(TEXT("bCanActivate"), bCanActivate);
+		Hash.Field(TEXT("bToggleActiveOnUse"), bToggleActiveOnUse);
+		Hash.Field(TEXT("UseSound"), UseSound);
 
 		// v3.9.6: Hash weapon attachment configs (legacy parallel arrays)
-		for (int32 i = 0; i < HolsterAttachmentSlots.Num(); i++)
-		{
-			Hash ^= GetTypeHash(HolsterAttachmentSlots[i]);
-			if (HolsterAttachmentSockets.IsValidIndex(i)) Hash ^= GetTypeHash(HolsterAttachmentSockets[i]);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (int32 i = 0; i < WieldAttachmentSlots.Num(); i++)
-		{
-			Hash ^= GetTypeHash(WieldAttachmentSlots[i]);
-			if (WieldAttachmentSockets.IsValidIndex(i)) Hash ^= GetTypeHash(WieldAttachmentSockets[i]);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("HolsterAttachmentSlots"), HolsterAttachmentSlots);
+		Hash.Field(TEXT("HolsterAttachmentSockets"), HolsterAttachmentSockets);
+		Hash.Field(TEXT("WieldAttachmentSlots"), WieldAttachmentSlots);
+		Hash.Field(TEXT("WieldAttachmentSockets"), WieldAttachmentSockets);
 
 		// v7.8.52: Hash TMap-style attachment configs
-		for (const auto& Config : HolsterAttachmentConfigs)
-		{
-			Hash ^= Config.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
-		for (const auto& Config : WieldAttachmentConfigs)
-		{
-			Hash ^= Config.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
+		Hash.Field(TEXT("HolsterAttachmentConfigs"), HolsterAttachmentConfigs);
+		Hash.Field(TEXT("WieldAttachmentConfigs"), WieldAttachmentConfigs);
 
 		// v3.9.8: Hash clothing mesh config
 		if (!ClothingMesh.IsEmpty())
 		{
-			Hash ^= ClothingMesh.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
+			Hash.Field(TEXT("ClothingMesh"), ClothingMesh);
 		}
 
 
 		// v3.9.12: Hash equipment effect values
+		Hash.Field(TEXT("EquipmentEffectValues"), EquipmentEffectValues.Num());
 		for (const auto& Pair : EquipmentEffectValues)
 		{
-			Hash ^= GetTypeHash(Pair.Key);
-			Hash ^= static_cast<uint64>(FMath::RoundToInt(Pair.Value * 100.f));
-			Hash = (Hash << 4) | (Hash >> 60);
+			Hash.Add(Pair.Key);
+			Hash.Add(FMath::RoundToInt(Pair.Value * 100.f));
 		}
 
 		// v4.2: Hash equipment abilities
-		for (const FString& Ability : EquipmentAbilities)
-		{
-			Hash ^= GetTypeHash(Ability);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("EquipmentAbilities"), EquipmentAbilities);
 
 		// v4.8: Hash stats array and activities to grant
-		for (const auto& Stat : Stats)
-		{
-			Hash ^= Stat.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const FString& Activity : ActivitiesToGrant)
-		{
-			Hash ^= GetTypeHash(Activity);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("Stats"), Stats);
+		Hash.Field(TEXT("ActivitiesToGrant"), ActivitiesToGrant);
 
 		// v4.8.2: Hash additional NarrativeItem properties
-		Hash ^= GetTypeHash(ItemWidgetOverride);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= (bWantsTickByDefault ? 1ULL : 0ULL) << 16;
+		Hash.Field(TEXT("ItemWidgetOverride"), ItemWidgetOverride);
+		Hash.Field(TEXT("bWantsTickByDefault"), bWantsTickByDefault);
 		if (!PickupMeshData.IsEmpty())
 		{
-			Hash ^= PickupMeshData.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
+			Hash.Field(TEXT("PickupMeshData"), PickupMeshData);
 		}
 
 		// v4.8.2: Hash TraceData for RangedWeaponItem
 		if (!TraceData.IsDefault())
 		{
-			Hash ^= TraceData.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
+			Hash.Field(TEXT("TraceData"), TraceData);
 		}
 
 		// v4.27: Hash function overrides
-		for (const auto& Override : FunctionOverrides)
-		{
-			Hash ^= Override.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("FunctionOverrides"), FunctionOverrides);
 
 		// v4.28: Hash fragments
-		for (const auto& Fragment : Fragments)
-		{
-			Hash ^= Fragment.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("Fragments"), Fragments);
 
 		// v4.28: Hash GameplayEffectItem properties
-		Hash ^= GetTypeHash(GameplayEffectClass);
-		Hash = (Hash << 5) | (Hash >> 59);
+		Hash.Field(TEXT("GameplayEffectClass"), GameplayEffectClass);
+		Hash.Field(TEXT("SetByCallerValues"), SetByCallerValues.Num());
 		for (const auto& Pair : SetByCallerValues)
 		{
-			Hash ^= GetTypeHash(Pair.Key);
-			Hash ^= static_cast<uint64>(FMath::RoundToInt(Pair.Value * 100.f));
-			Hash = (Hash << 4) | (Hash >> 60);
+			Hash.Add(Pair.Key);
+			Hash.Add(FMath::RoundToInt(Pair.Value * 100.f));
 		}
 
 		// v4.28: Hash WeaponAttachmentItem properties
-		Hash ^= GetTypeHash(WeaponAttachmentSlot);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(AttachmentMesh);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(FOVOverride * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(WeaponRenderFOVOverride * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(WeaponAimFStopOverride * 100.f));
-		Hash = (Hash << 5) | (Hash >> 59);
+		Hash.Field(TEXT("WeaponAttachmentSlot"), WeaponAttachmentSlot);
+		Hash.Field(TEXT("AttachmentMesh"), AttachmentMesh);
+		Hash.Field(TEXT("FOVOverride"), FMath::RoundToInt(FOVOverride * 100.f));
+		Hash.Field(TEXT("WeaponRenderFOVOverride"), FMath::RoundToInt(WeaponRenderFOVOverride * 100.f));
+		Hash.Field(TEXT("WeaponAimFStopOverride"), FMath::RoundToInt(WeaponAimFStopOverride * 100.f));
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -4083,49 +3703,30 @@ struct FManifestActivityDefinition
 	/** v3.3: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(ParentClass) << 4;
-		Hash ^= GetTypeHash(BehaviorTree) << 8;
-		Hash ^= GetTypeHash(Description) << 12;
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("BehaviorTree"), BehaviorTree);
+		Hash.Field(TEXT("Description"), Description);
 
 		// v3.3: Hash new properties
-		Hash ^= GetTypeHash(ActivityName) << 16;
-		Hash ^= GetTypeHash(SupportedGoalType) << 20;
-		Hash ^= (bIsInterruptable ? 1ULL : 0ULL) << 24;
-		Hash ^= (bSaveActivity ? 1ULL : 0ULL) << 25;
-		for (const FString& Tag : OwnedTags)
-		{
-			Hash ^= GetTypeHash(Tag);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Tag : BlockTags)
-		{
-			Hash ^= GetTypeHash(Tag);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const FString& Tag : RequireTags)
-		{
-			Hash ^= GetTypeHash(Tag);
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
+		Hash.Field(TEXT("ActivityName"), ActivityName);
+		Hash.Field(TEXT("SupportedGoalType"), SupportedGoalType);
+		Hash.Field(TEXT("bIsInterruptable"), bIsInterruptable);
+		Hash.Field(TEXT("bSaveActivity"), bSaveActivity);
+		Hash.Field(TEXT("OwnedTags"), OwnedTags);
+		Hash.Field(TEXT("BlockTags"), BlockTags);
+		Hash.Field(TEXT("RequireTags"), RequireTags);
 		// v7.8.52: Hash enhanced properties
-		Hash ^= GetTypeHash(AttackTaggedDialogue) << 26;
-		for (const FString& WeaponType : WeaponTypes)
-		{
-			Hash ^= GetTypeHash(WeaponType);
-			Hash = (Hash << 2) | (Hash >> 62);
-		}
-		Hash ^= GetTypeHash(FollowGoal) << 28;
-		Hash ^= GetTypeHash(InteractSubGoal) << 30;
-		Hash ^= static_cast<uint64>(GetTypeHash(BBKeyFollowDistance)) << 32;
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
-		Hash ^= static_cast<uint64>(GetTypeHash(EventGraph)) << 36;
-		return Hash;
+		Hash.Field(TEXT("AttackTaggedDialogue"), AttackTaggedDialogue);
+		Hash.Field(TEXT("WeaponTypes"), WeaponTypes);
+		Hash.Field(TEXT("FollowGoal"), FollowGoal);
+		Hash.Field(TEXT("InteractSubGoal"), InteractSubGoal);
+		Hash.Field(TEXT("BBKeyFollowDistance"), BBKeyFollowDistance);
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -4181,33 +3782,26 @@ struct FManifestBlueprintTriggerDefinition
 	/** Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(ParentClass) << 4;
-		Hash ^= (bIsActive ? 1ULL : 0ULL) << 8;
-		Hash ^= static_cast<uint64>(RequiredQuantity) << 9;
-		Hash ^= GetTypeHash(DescriptionOverride) << 12;
-		Hash ^= (bOptional ? 1ULL : 0ULL) << 16;
-		Hash ^= (bHidden ? 1ULL : 0ULL) << 17;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TickInterval * 100.f)) << 18;
-		Hash ^= (bAddNavigationMarker ? 1ULL : 0ULL) << 22;
-		Hash ^= (bDrawBreadcrumbs ? 1ULL : 0ULL) << 23;
-		Hash ^= GetTypeHash(MarkerClass) << 24;
-		Hash ^= GetTypeHash(GoalLocationProvider) << 28;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(DistanceTolerance)) << 32;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TimeStart)) << 36;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TimeEnd)) << 40;
-		for (const FString& NPC : NPCsToFollow)
-		{
-			Hash ^= GetTypeHash(NPC);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
-		Hash ^= static_cast<uint64>(GetTypeHash(EventGraph)) << 44;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("bIsActive"), bIsActive);
+		Hash.Field(TEXT("RequiredQuantity"), RequiredQuantity);
+		Hash.Field(TEXT("DescriptionOverride"), DescriptionOverride);
+		Hash.Field(TEXT("bOptional"), bOptional);
+		Hash.Field(TEXT("bHidden"), bHidden);
+		Hash.Field(TEXT("TickInterval"), FMath::RoundToInt(TickInterval * 100.f));
+		Hash.Field(TEXT("bAddNavigationMarker"), bAddNavigationMarker);
+		Hash.Field(TEXT("bDrawBreadcrumbs"), bDrawBreadcrumbs);
+		Hash.Field(TEXT("MarkerClass"), MarkerClass);
+		Hash.Field(TEXT("GoalLocationProvider"), GoalLocationProvider);
+		Hash.Field(TEXT("DistanceTolerance"), FMath::RoundToInt(DistanceTolerance));
+		Hash.Field(TEXT("TimeStart"), FMath::RoundToInt(TimeStart));
+		Hash.Field(TEXT("TimeEnd"), FMath::RoundToInt(TimeEnd));
+		Hash.Field(TEXT("NPCsToFollow"), NPCsToFollow);
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -4226,20 +3820,13 @@ struct FManifestAbilityConfigurationDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		for (const FString& Ability : Abilities)
-		{
-			Hash ^= GetTypeHash(Ability);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Effect : StartupEffects)
-		{
-			Hash ^= GetTypeHash(Effect);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		Hash ^= GetTypeHash(DefaultAttributes) << 16;
-		return Hash;
+		Hash.Field(TEXT("Abilities"), Abilities);
+		Hash.Field(TEXT("StartupEffects"), StartupEffects);
+		Hash.Field(TEXT("DefaultAttributes"), DefaultAttributes);
+		return Hash.Finalize();
 	}
 };
 
@@ -4259,21 +3846,14 @@ struct FManifestActivityConfigurationDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(RescoreInterval * 1000.f)) << 8;
-		Hash ^= GetTypeHash(DefaultActivity) << 16;
-		for (const FString& Activity : Activities)
-		{
-			Hash ^= GetTypeHash(Activity);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Generator : GoalGenerators)
-		{
-			Hash ^= GetTypeHash(Generator);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		Hash.Field(TEXT("RescoreInterval"), FMath::RoundToInt(RescoreInterval * 1000.f));
+		Hash.Field(TEXT("DefaultActivity"), DefaultActivity);
+		Hash.Field(TEXT("Activities"), Activities);
+		Hash.Field(TEXT("GoalGenerators"), GoalGenerators);
+		return Hash.Finalize();
 	}
 };
 
@@ -4288,9 +3868,10 @@ struct FManifestItemWithQuantity
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(ItemClass);
-		Hash ^= static_cast<uint64>(Quantity) << 32;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("ItemClass"), ItemClass);
+		Hash.Field(TEXT("Quantity"), Quantity);
+		return Hash.Finalize();
 	}
 };
 
@@ -4307,19 +3888,12 @@ struct FManifestItemCollectionDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		for (const FString& Item : Items)
-		{
-			Hash ^= GetTypeHash(Item);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& ItemQ : ItemsWithQuantity)
-		{
-			Hash ^= ItemQ.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		Hash.Field(TEXT("Items"), Items);
+		Hash.Field(TEXT("ItemsWithQuantity"), ItemsWithQuantity);
+		return Hash.Finalize();
 	}
 };
 
@@ -4365,53 +3939,29 @@ struct FManifestNarrativeEventDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(ParentClass) << 4;
-		Hash ^= GetTypeHash(EventTag) << 8;
-		Hash ^= GetTypeHash(EventType) << 12;
-		Hash ^= GetTypeHash(Description) << 16;
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("EventTag"), EventTag);
+		Hash.Field(TEXT("EventType"), EventType);
+		Hash.Field(TEXT("Description"), Description);
 		// v3.2: Include new configuration in hash
-		Hash ^= GetTypeHash(EventRuntime) << 20;
-		Hash ^= GetTypeHash(EventFilter) << 24;
-		Hash ^= GetTypeHash(PartyEventPolicy) << 28;
-		Hash ^= (bRefireOnLoad ? 1ULL : 0ULL) << 32;
-		for (const auto& Target : NPCTargets)
-		{
-			Hash ^= GetTypeHash(Target);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Target : CharacterTargets)
-		{
-			Hash ^= GetTypeHash(Target);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		for (const auto& Target : PlayerTargets)
-		{
-			Hash ^= GetTypeHash(Target);
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
+		Hash.Field(TEXT("EventRuntime"), EventRuntime);
+		Hash.Field(TEXT("EventFilter"), EventFilter);
+		Hash.Field(TEXT("PartyEventPolicy"), PartyEventPolicy);
+		Hash.Field(TEXT("bRefireOnLoad"), bRefireOnLoad);
+		Hash.Field(TEXT("NPCTargets"), NPCTargets);
+		Hash.Field(TEXT("CharacterTargets"), CharacterTargets);
+		Hash.Field(TEXT("PlayerTargets"), PlayerTargets);
 		// v4.1: Include child class properties in hash
-		for (const auto& Pair : Properties)
-		{
-			Hash ^= GetTypeHash(Pair.Key);
-			Hash ^= GetTypeHash(Pair.Value);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("Properties"), Properties);
 		// v4.3: Include event conditions in hash
-		for (const auto& Condition : Conditions)
-		{
-			Hash ^= Condition.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
+		Hash.Field(TEXT("Conditions"), Conditions);
 		// v7.8.52: Include variables and event graph in hash
-		for (const auto& Var : Variables)
-		{
-			Hash ^= Var.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		Hash ^= static_cast<uint64>(GetTypeHash(EventGraph)) << 36;
-		return Hash;
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -4427,9 +3977,10 @@ struct FManifestItemWithQuantityDefinition
 	/** v3.9.5: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Item);
-		Hash ^= static_cast<uint64>(Quantity) << 8;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Item"), Item);
+		Hash.Field(TEXT("Quantity"), Quantity);
+		return Hash.Finalize();
 	}
 };
 
@@ -4448,22 +3999,13 @@ struct FManifestLootTableRollDefinition
 	/** v3.9.5: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = 0;
-		for (const auto& ItemDef : ItemsToGrant)
-		{
-			Hash ^= ItemDef.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Collection : ItemCollectionsToGrant)
-		{
-			Hash ^= GetTypeHash(Collection);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		Hash ^= GetTypeHash(TableToRoll);
-		Hash = (Hash << 7) | (Hash >> 57);
-		Hash ^= static_cast<uint64>(NumRolls) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Chance * 1000.f)) << 24;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("ItemsToGrant"), ItemsToGrant);
+		Hash.Field(TEXT("ItemCollectionsToGrant"), ItemCollectionsToGrant);
+		Hash.Field(TEXT("TableToRoll"), TableToRoll);
+		Hash.Field(TEXT("NumRolls"), NumRolls);
+		Hash.Field(TEXT("Chance"), FMath::RoundToInt(Chance * 1000.f));
+		return Hash.Finalize();
 	}
 };
 
@@ -4526,81 +4068,46 @@ struct FManifestNPCDefinitionDefinition
 	/** v4.8: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(NPCID) << 4;
-		Hash ^= GetTypeHash(NPCName) << 8;
-		Hash ^= GetTypeHash(NPCClassPath) << 12;
-		Hash ^= GetTypeHash(AbilityConfiguration) << 16;
-		Hash ^= GetTypeHash(ActivityConfiguration) << 20;
-		Hash ^= static_cast<uint64>(MinLevel) << 24;
-		Hash ^= static_cast<uint64>(MaxLevel) << 32;
-		Hash ^= (bAllowMultipleInstances ? 1ULL : 0ULL) << 40;
-		Hash ^= (bIsVendor ? 1ULL : 0ULL) << 41;
+		Hash.Field(TEXT("NPCID"), NPCID);
+		Hash.Field(TEXT("NPCName"), NPCName);
+		Hash.Field(TEXT("NPCClassPath"), NPCClassPath);
+		Hash.Field(TEXT("AbilityConfiguration"), AbilityConfiguration);
+		Hash.Field(TEXT("ActivityConfiguration"), ActivityConfiguration);
+		Hash.Field(TEXT("MinLevel"), MinLevel);
+		Hash.Field(TEXT("MaxLevel"), MaxLevel);
+		Hash.Field(TEXT("bAllowMultipleInstances"), bAllowMultipleInstances);
+		Hash.Field(TEXT("bIsVendor"), bIsVendor);
 
 		// v4.8: Hash UniqueNPCGUID and TriggerSets
-		Hash ^= static_cast<uint64>(GetTypeHash(UniqueNPCGUID)) << 45;
-		for (const FString& TriggerSet : TriggerSets)
-		{
-			Hash ^= GetTypeHash(TriggerSet);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("UniqueNPCGUID"), UniqueNPCGUID);
+		Hash.Field(TEXT("TriggerSets"), TriggerSets);
 
-		// v3.3: Hash new properties (using rotation to avoid overflow)
-		Hash ^= GetTypeHash(Dialogue);
-		Hash = (Hash << 7) | (Hash >> 57);
-		Hash ^= GetTypeHash(TaggedDialogueSet);
-		Hash = (Hash << 7) | (Hash >> 57);
-		Hash ^= static_cast<uint64>(TradingCurrency);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(BuyItemPercentage * 1000.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(SellItemPercentage * 1000.f));
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(ShopFriendlyName);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(DefaultAppearance);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(DefaultCurrency);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AttackPriority * 1000.f));
-		for (const FString& Tag : DefaultOwnedTags)
-		{
-			Hash ^= GetTypeHash(Tag);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Faction : DefaultFactions)
-		{
-			Hash ^= GetTypeHash(Faction);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		// v3.3: Hash new properties
+		Hash.Field(TEXT("Dialogue"), Dialogue);
+		Hash.Field(TEXT("TaggedDialogueSet"), TaggedDialogueSet);
+		Hash.Field(TEXT("TradingCurrency"), TradingCurrency);
+		Hash.Field(TEXT("BuyItemPercentage"), FMath::RoundToInt(BuyItemPercentage * 1000.f));
+		Hash.Field(TEXT("SellItemPercentage"), FMath::RoundToInt(SellItemPercentage * 1000.f));
+		Hash.Field(TEXT("ShopFriendlyName"), ShopFriendlyName);
+		Hash.Field(TEXT("DefaultAppearance"), DefaultAppearance);
+		Hash.Field(TEXT("DefaultCurrency"), DefaultCurrency);
+		Hash.Field(TEXT("AttackPriority"), FMath::RoundToInt(AttackPriority * 1000.f));
+		Hash.Field(TEXT("DefaultOwnedTags"), DefaultOwnedTags);
+		Hash.Field(TEXT("DefaultFactions"), DefaultFactions);
 		// v3.6: Hash activity schedules
-		for (const FString& Schedule : ActivitySchedules)
-		{
-			Hash ^= GetTypeHash(Schedule);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("ActivitySchedules"), ActivitySchedules);
 		// v3.7: Hash auto-create flags and item loadout collections
-		Hash ^= (bAutoCreateDialogue ? 1ULL : 0ULL) << 42;
-		Hash ^= (bAutoCreateTaggedDialogue ? 1ULL : 0ULL) << 43;
-		Hash ^= (bAutoCreateItemLoadout ? 1ULL : 0ULL) << 44;
-		for (const FString& Collection : DefaultItemLoadoutCollections)
-		{
-			Hash ^= GetTypeHash(Collection);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("bAutoCreateDialogue"), bAutoCreateDialogue);
+		Hash.Field(TEXT("bAutoCreateTaggedDialogue"), bAutoCreateTaggedDialogue);
+		Hash.Field(TEXT("bAutoCreateItemLoadout"), bAutoCreateItemLoadout);
+		Hash.Field(TEXT("DefaultItemLoadoutCollections"), DefaultItemLoadoutCollections);
 		// v3.9.5: Hash full loot table rolls
-		for (const auto& Roll : DefaultItemLoadout)
-		{
-			Hash ^= Roll.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		for (const auto& Roll : TradingItemLoadout)
-		{
-			Hash ^= Roll.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		return Hash;
+		Hash.Field(TEXT("DefaultItemLoadout"), DefaultItemLoadout);
+		Hash.Field(TEXT("TradingItemLoadout"), TradingItemLoadout);
+		return Hash.Finalize();
 	}
 };
 
@@ -4631,34 +4138,19 @@ struct FManifestCharacterDefinitionDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		for (const FString& Tag : DefaultOwnedTags)
-		{
-			Hash ^= GetTypeHash(Tag);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& Faction : DefaultFactions)
-		{
-			Hash ^= GetTypeHash(Faction);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		Hash ^= static_cast<uint64>(DefaultCurrency) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(AttackPriority * 1000.f)) << 32;
-		Hash ^= GetTypeHash(DefaultAppearance) << 4;
-		for (const FString& TriggerSet : TriggerSets)
-		{
-			Hash ^= GetTypeHash(TriggerSet);
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		Hash ^= GetTypeHash(AbilityConfiguration) << 8;
+		Hash.Field(TEXT("DefaultOwnedTags"), DefaultOwnedTags);
+		Hash.Field(TEXT("DefaultFactions"), DefaultFactions);
+		Hash.Field(TEXT("DefaultCurrency"), DefaultCurrency);
+		Hash.Field(TEXT("AttackPriority"), FMath::RoundToInt(AttackPriority * 1000.f));
+		Hash.Field(TEXT("DefaultAppearance"), DefaultAppearance);
+		Hash.Field(TEXT("TriggerSets"), TriggerSets);
+		Hash.Field(TEXT("AbilityConfiguration"), AbilityConfiguration);
 		// v7.8.53: Include DefaultItemLoadout in hash
-		for (const auto& LootRoll : DefaultItemLoadout)
-		{
-			Hash ^= LootRoll.ComputeHash();
-			Hash = (Hash << 9) | (Hash >> 55);
-		}
-		return Hash;
+		Hash.Field(TEXT("DefaultItemLoadout"), DefaultItemLoadout);
+		return Hash.Finalize();
 	}
 };
 
@@ -4683,30 +4175,18 @@ struct FManifestCharacterAppearanceDefinition
 	/** v4.8.3: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		for (const auto& MeshPair : Meshes)
-		{
-			Hash ^= GetTypeHash(MeshPair.Key);
-			for (const FString& MeshPath : MeshPair.Value)
-			{
-				Hash ^= GetTypeHash(MeshPath);
-				Hash = (Hash << 3) | (Hash >> 61);
-			}
-		}
+		Hash.Field(TEXT("Meshes"), Meshes);
+		Hash.Field(TEXT("ScalarValues"), ScalarValues.Num());
 		for (const auto& ScalarPair : ScalarValues)
 		{
-			Hash ^= GetTypeHash(ScalarPair.Key);
-			Hash ^= static_cast<uint64>(FMath::RoundToInt(ScalarPair.Value * 1000.f)) << 8;
-			Hash = (Hash << 5) | (Hash >> 59);
+			Hash.Add(ScalarPair.Key);
+			Hash.Add(FMath::RoundToInt(ScalarPair.Value * 1000.f));
 		}
-		for (const auto& VectorPair : VectorValues)
-		{
-			Hash ^= GetTypeHash(VectorPair.Key);
-			Hash ^= GetTypeHash(VectorPair.Value) << 16;
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		return Hash;
+		Hash.Field(TEXT("VectorValues"), VectorValues);
+		return Hash.Finalize();
 	}
 };
 
@@ -4725,21 +4205,14 @@ struct FManifestTaggedDialogueEntry
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Tag);
-		Hash ^= GetTypeHash(DialogueClass) << 4;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Cooldown * 1000.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(MaxDistance * 10.f)) << 24;
-		for (const FString& ReqTag : RequiredTags)
-		{
-			Hash ^= GetTypeHash(ReqTag);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const FString& BlkTag : BlockedTags)
-		{
-			Hash ^= GetTypeHash(BlkTag);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Tag"), Tag);
+		Hash.Field(TEXT("DialogueClass"), DialogueClass);
+		Hash.Field(TEXT("Cooldown"), FMath::RoundToInt(Cooldown * 1000.f));
+		Hash.Field(TEXT("MaxDistance"), FMath::RoundToInt(MaxDistance * 10.f));
+		Hash.Field(TEXT("RequiredTags"), RequiredTags);
+		Hash.Field(TEXT("BlockedTags"), BlockedTags);
+		return Hash.Finalize();
 	}
 };
 
@@ -4755,14 +4228,11 @@ struct FManifestTaggedDialogueSetDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		for (const auto& Dialogue : Dialogues)
-		{
-			Hash ^= Dialogue.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		Hash.Field(TEXT("Dialogues"), Dialogues);
+		return Hash.Finalize();
 	}
 };
 
@@ -4779,10 +4249,11 @@ struct FManifestNiagaraUserParameter
 	/** v3.0: Compute hash for change detection */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Type) << 8;
-		Hash ^= GetTypeHash(DefaultValue) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("DefaultValue"), DefaultValue);
+		return Hash.Finalize();
 	}
 };
 
@@ -4808,18 +4279,14 @@ struct FManifestNiagaraEmitterOverride
 	/** v4.9/v4.11: Compute hash for change detection - includes all enable fields */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(EmitterName);
-		Hash ^= (bEnabled ? 1ULL : 0ULL) << 8;
-		Hash ^= (bHasEnabled ? 1ULL : 0ULL) << 9;
-		Hash ^= (bStructuralEnabled ? 1ULL : 0ULL) << 10;
-		Hash ^= (bHasStructuralEnabled ? 1ULL : 0ULL) << 11;
-		for (const auto& Param : Parameters)
-		{
-			Hash ^= GetTypeHash(Param.Key);
-			Hash ^= GetTypeHash(Param.Value) << 4;
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("EmitterName"), EmitterName);
+		Hash.Field(TEXT("bEnabled"), bEnabled);
+		Hash.Field(TEXT("bHasEnabled"), bHasEnabled);
+		Hash.Field(TEXT("bStructuralEnabled"), bStructuralEnabled);
+		Hash.Field(TEXT("bHasStructuralEnabled"), bHasStructuralEnabled);
+		Hash.Field(TEXT("Parameters"), Parameters);
+		return Hash.Finalize();
 	}
 };
 
@@ -4886,7 +4353,7 @@ struct FManifestFXDescriptor
 	 */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = 0;
+		FGeneratorHashBuilder Hash;
 
 		// Hash emitter toggles (bit flags)
 		uint32 EmitterFlags = 0;
@@ -4897,13 +4364,13 @@ struct FManifestFXDescriptor
 		if (bLightEnabled) EmitterFlags |= (1 << 4);
 		if (bSmokeEnabled) EmitterFlags |= (1 << 5);
 		if (bSparkEnabled) EmitterFlags |= (1 << 6);
-		Hash ^= static_cast<uint64>(EmitterFlags);
+		Hash.Field(TEXT("EmitterFlags"), EmitterFlags);
 
 		// Hash core emission (convert floats to stable ints)
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(SpawnRate * 100.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(LifetimeMin * 1000.f)) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(LifetimeMax * 1000.f)) << 24;
-		Hash ^= static_cast<uint64>(MaxParticles) << 32;
+		Hash.Field(TEXT("SpawnRate"), FMath::RoundToInt(SpawnRate * 100.f));
+		Hash.Field(TEXT("LifetimeMin"), FMath::RoundToInt(LifetimeMin * 1000.f));
+		Hash.Field(TEXT("LifetimeMax"), FMath::RoundToInt(LifetimeMax * 1000.f));
+		Hash.Field(TEXT("MaxParticles"), MaxParticles);
 
 		// Hash appearance (color as packed RGBA)
 		uint32 PackedColor =
@@ -4911,14 +4378,14 @@ struct FManifestFXDescriptor
 			(FMath::Clamp(FMath::RoundToInt(Color.G * 255.f), 0, 255) << 8) |
 			(FMath::Clamp(FMath::RoundToInt(Color.B * 255.f), 0, 255) << 16) |
 			(FMath::Clamp(FMath::RoundToInt(Color.A * 255.f), 0, 255) << 24);
-		Hash ^= static_cast<uint64>(PackedColor) << 40;
+		Hash.Field(TEXT("PackedColor"), PackedColor);
 
 		// Hash sizes and motion
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(SizeMin * 100.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(SizeMax * 100.f)) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Opacity * 1000.f)) << 32;
+		Hash.Field(TEXT("SizeMin"), FMath::RoundToInt(SizeMin * 100.f));
+		Hash.Field(TEXT("SizeMax"), FMath::RoundToInt(SizeMax * 100.f));
+		Hash.Field(TEXT("Opacity"), FMath::RoundToInt(Opacity * 1000.f));
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -5077,6 +4544,7 @@ struct FFXGeneratorMetadata
 				else if (Key == TEXT("Hash")) Meta.DescriptorHash = FCString::Strtoui64(*Value, nullptr, 10);
 				else if (Key == TEXT("Time")) FDateTime::Parse(Value, Meta.GeneratedTime);
 				else if (Key == TEXT("Gen")) Meta.bIsGenerated = (Value == TEXT("1"));
+				else if (Key == TEXT("HashVer")) Meta.HashVersion = FCString::Atoi(*Value);
 			}
 		}
 		return Meta;
@@ -5103,6 +4571,7 @@ struct FGeneratorMetadata
 	FDateTime Timestamp;           // When asset was last generated
 	TArray<FString> Dependencies;  // Assets this asset depends on
 	bool bIsGenerated = false;     // True if this asset was generator-created
+	int32 HashVersion = GeneratorHash::LegacyVersion; // v7.8.62: Hash algorithm that produced InputHash/OutputHash
 
 	FGeneratorMetadata() : Timestamp(FDateTime::Now()) {}
 
@@ -5122,10 +4591,10 @@ struct FGeneratorMetadata
 	FString ToString() const
 	{
 		FString DepsStr = FString::Join(Dependencies, TEXT(";"));
-		return FString::Printf(TEXT("GenId:%s|Path:%s|Key:%s|InHash:%llu|OutHash:%llu|Ver:%s|Time:%s|Deps:%s|Gen:%d"),
+		return FString::Printf(TEXT("GenId:%s|Path:%s|Key:%s|InHash:%llu|OutHash:%llu|Ver:%s|Time:%s|Deps:%s|Gen:%d|HashVer:%d"),
 			*GeneratorId, *ManifestPath, *ManifestAssetKey,
 			InputHash, OutputHash, *GeneratorVersion,
-			*Timestamp.ToString(), *DepsStr, bIsGenerated ? 1 : 0);
+			*Timestamp.ToString(), *DepsStr, bIsGenerated ? 1 : 0, HashVersion);
 	}
 
 	/** Parse from serialized string stored in asset metadata */
@@ -5358,15 +4827,11 @@ struct FManifestFXPresetDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(BasePreset) << 4;
-		for (const auto& Pair : Parameters)
-		{
-			Hash ^= GetTypeHash(Pair.Key);
-			Hash ^= GetTypeHash(Pair.Value);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("BasePreset"), BasePreset);
+		Hash.Field(TEXT("Parameters"), Parameters);
+		return Hash.Finalize();
 	}
 };
 
@@ -5430,66 +4895,55 @@ struct FManifestNiagaraSystemDefinition
 	/** v3.0: Compute hash for change detection (excludes Folder - presentational only) */
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(TemplateSystem) << 4;
-		for (const FString& Emitter : Emitters)
-		{
-			Hash ^= GetTypeHash(Emitter);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		Hash.Field(TEXT("TemplateSystem"), TemplateSystem);
+		Hash.Field(TEXT("Emitters"), Emitters);
 
 		// Warmup settings
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(WarmupTime * 1000.f)) << 8;
-		Hash ^= static_cast<uint64>(WarmupTickCount) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(WarmupTickDelta * 10000.f)) << 24;
+		Hash.Field(TEXT("WarmupTime"), FMath::RoundToInt(WarmupTime * 1000.f));
+		Hash.Field(TEXT("WarmupTickCount"), WarmupTickCount);
+		Hash.Field(TEXT("WarmupTickDelta"), FMath::RoundToInt(WarmupTickDelta * 10000.f));
 
 		// Bounds settings
-		Hash ^= (bFixedBounds ? 1ULL : 0ULL) << 32;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(BoundsMin.X * 10.f)) << 33;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(BoundsMax.X * 10.f)) << 40;
+		Hash.Field(TEXT("bFixedBounds"), bFixedBounds);
+		Hash.Field(TEXT("BoundsMin.X"), FMath::RoundToInt(BoundsMin.X * 10.f));
+		Hash.Field(TEXT("BoundsMax.X"), FMath::RoundToInt(BoundsMax.X * 10.f));
 
 		// Determinism settings
-		Hash ^= (bDeterminism ? 1ULL : 0ULL) << 48;
-		Hash ^= static_cast<uint64>(RandomSeed) << 49;
+		Hash.Field(TEXT("bDeterminism"), bDeterminism);
+		Hash.Field(TEXT("RandomSeed"), RandomSeed);
 
 		// v4.9: Emitter overrides
-		for (const auto& Override : EmitterOverrides)
-		{
-			Hash ^= Override.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("EmitterOverrides"), EmitterOverrides);
 
 		// Effect type settings
-		Hash ^= GetTypeHash(EffectType);
-		Hash ^= GetTypeHash(PoolingMethod) << 4;
-		Hash ^= static_cast<uint64>(MaxPoolSize) << 56;
+		Hash.Field(TEXT("EffectType"), EffectType);
+		Hash.Field(TEXT("PoolingMethod"), PoolingMethod);
+		Hash.Field(TEXT("MaxPoolSize"), MaxPoolSize);
 
 		// v4.9: FX Preset
-		Hash ^= GetTypeHash(Preset);
+		Hash.Field(TEXT("Preset"), Preset);
 
 		// User parameters
-		for (const auto& Param : UserParameters)
-		{
-			Hash ^= Param.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
+		Hash.Field(TEXT("UserParameters"), UserParameters);
 
 		// FX Descriptor
-		Hash ^= FXDescriptor.ComputeHash();
+		Hash.Field(TEXT("FXDescriptor"), FXDescriptor);
 
 		// v4.9: LOD/Scalability settings
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(CullDistanceLow * 10.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(CullDistanceMedium * 10.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(CullDistanceHigh * 10.f)) << 16;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(CullDistanceEpic * 10.f)) << 24;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(CullDistanceCinematic * 10.f)) << 32;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(CullMaxDistance * 10.f)) << 40;
-		Hash ^= static_cast<uint64>(MaxParticleBudget) << 48;
-		Hash ^= GetTypeHash(ScalabilityMode);
-		Hash ^= (bAllowCullingForLocalPlayers ? 1ULL : 0ULL) << 56;
+		Hash.Field(TEXT("CullDistanceLow"), FMath::RoundToInt(CullDistanceLow * 10.f));
+		Hash.Field(TEXT("CullDistanceMedium"), FMath::RoundToInt(CullDistanceMedium * 10.f));
+		Hash.Field(TEXT("CullDistanceHigh"), FMath::RoundToInt(CullDistanceHigh * 10.f));
+		Hash.Field(TEXT("CullDistanceEpic"), FMath::RoundToInt(CullDistanceEpic * 10.f));
+		Hash.Field(TEXT("CullDistanceCinematic"), FMath::RoundToInt(CullDistanceCinematic * 10.f));
+		Hash.Field(TEXT("CullMaxDistance"), FMath::RoundToInt(CullMaxDistance * 10.f));
+		Hash.Field(TEXT("MaxParticleBudget"), MaxParticleBudget);
+		Hash.Field(TEXT("ScalabilityMode"), ScalabilityMode);
+		Hash.Field(TEXT("bAllowCullingForLocalPlayers"), bAllowCullingForLocalPlayers);
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -5508,13 +4962,14 @@ struct FManifestScheduledBehaviorDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(FMath::RoundToInt(StartTime * 100.f));
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(EndTime * 100.f)) << 16;
-		Hash ^= static_cast<uint64>(GetTypeHash(GoalClass)) << 32;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(ScoreOverride * 100.f)) << 40;
-		Hash ^= (bReselect ? 1ULL : 0ULL) << 48;
-		Hash ^= static_cast<uint64>(GetTypeHash(Location)) << 52;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("StartTime"), FMath::RoundToInt(StartTime * 100.f));
+		Hash.Field(TEXT("EndTime"), FMath::RoundToInt(EndTime * 100.f));
+		Hash.Field(TEXT("GoalClass"), GoalClass);
+		Hash.Field(TEXT("ScoreOverride"), FMath::RoundToInt(ScoreOverride * 100.f));
+		Hash.Field(TEXT("bReselect"), bReselect);
+		Hash.Field(TEXT("Location"), Location);
+		return Hash.Finalize();
 	}
 };
 
@@ -5530,14 +4985,11 @@ struct FManifestActivityScheduleDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		for (const auto& Behavior : Behaviors)
-		{
-			Hash ^= Behavior.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		Hash.Field(TEXT("Behaviors"), Behaviors);
+		return Hash.Finalize();
 	}
 };
 
@@ -5567,20 +5019,21 @@ struct FManifestGoalItemDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(ParentClass) << 4;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(DefaultScore * 100.f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(GoalLifetime * 100.f)) << 16;
-		Hash ^= (bRemoveOnSucceeded ? 1ULL : 0ULL) << 24;
-		Hash ^= (bSaveGoal ? 1ULL : 0ULL) << 25;
-		for (const auto& Tag : OwnedTags) { Hash ^= GetTypeHash(Tag); Hash = (Hash << 3) | (Hash >> 61); }
-		for (const auto& Tag : BlockTags) { Hash ^= GetTypeHash(Tag); Hash = (Hash << 4) | (Hash >> 60); }
-		for (const auto& Tag : RequireTags) { Hash ^= GetTypeHash(Tag); Hash = (Hash << 5) | (Hash >> 59); }
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("DefaultScore"), FMath::RoundToInt(DefaultScore * 100.f));
+		Hash.Field(TEXT("GoalLifetime"), FMath::RoundToInt(GoalLifetime * 100.f));
+		Hash.Field(TEXT("bRemoveOnSucceeded"), bRemoveOnSucceeded);
+		Hash.Field(TEXT("bSaveGoal"), bSaveGoal);
+		Hash.Field(TEXT("OwnedTags"), OwnedTags);
+		Hash.Field(TEXT("BlockTags"), BlockTags);
+		Hash.Field(TEXT("RequireTags"), RequireTags);
 		// v7.8.52: Hash variables and event graph
-		for (const auto& Var : Variables) { Hash ^= Var.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		Hash ^= GetTypeHash(EventGraph) << 26;
-		return Hash;
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -5604,13 +5057,14 @@ struct FManifestGoalGeneratorDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(ParentClass) << 4;
-		Hash ^= (bSaveGoalGenerator ? 1ULL : 0ULL) << 8;
-		for (const auto& Var : Variables) { Hash ^= Var.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		Hash ^= GetTypeHash(EventGraph) << 12;
-		return Hash;
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("bSaveGoalGenerator"), bSaveGoalGenerator);
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -5633,12 +5087,13 @@ struct FManifestSpawnConditionOverride
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(LocallyControlledSource);
-		Hash ^= GetTypeHash(LocallyControlledPolicy) << 4;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(ChanceToPlay)) << 8;
-		for (const auto& S : AllowedSurfaceTypes) { Hash ^= GetTypeHash(S); }
-		for (const auto& S : RejectedSurfaceTypes) { Hash ^= GetTypeHash(S); }
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("LocallyControlledSource"), LocallyControlledSource);
+		Hash.Field(TEXT("LocallyControlledPolicy"), LocallyControlledPolicy);
+		Hash.Field(TEXT("ChanceToPlay"), ChanceToPlay);
+		Hash.Field(TEXT("AllowedSurfaceTypes"), AllowedSurfaceTypes);
+		Hash.Field(TEXT("RejectedSurfaceTypes"), RejectedSurfaceTypes);
+		return Hash.Finalize();
 	}
 };
 
@@ -5656,12 +5111,13 @@ struct FManifestPlacementInfoOverride
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(SocketName);
-		Hash ^= GetTypeHash(AttachPolicy) << 4;
-		Hash ^= GetTypeHash(AttachmentRule) << 8;
-		Hash ^= GetTypeHash(RotationOverride.ToString()) << 12;
-		Hash ^= GetTypeHash(ScaleOverride.ToString()) << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("SocketName"), SocketName);
+		Hash.Field(TEXT("AttachPolicy"), AttachPolicy);
+		Hash.Field(TEXT("AttachmentRule"), AttachmentRule);
+		Hash.Field(TEXT("RotationOverride.ToString()"), RotationOverride.ToString());
+		Hash.Field(TEXT("ScaleOverride.ToString()"), ScaleOverride.ToString());
+		return Hash.Finalize();
 	}
 };
 
@@ -5677,11 +5133,12 @@ struct FManifestBurstParticleEffect
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(NiagaraSystem);
-		Hash ^= (bCastShadow ? 1ULL : 0ULL) << 4;
-		Hash ^= SpawnCondition.ComputeHash() << 8;
-		Hash ^= Placement.ComputeHash() << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("NiagaraSystem"), NiagaraSystem);
+		Hash.Field(TEXT("bCastShadow"), bCastShadow);
+		Hash.Field(TEXT("SpawnCondition"), SpawnCondition);
+		Hash.Field(TEXT("Placement"), Placement);
+		return Hash.Finalize();
 	}
 };
 
@@ -5698,12 +5155,13 @@ struct FManifestBurstSoundEffect
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Sound);
-		Hash ^= GetTypeHash(FString::SanitizeFloat(VolumeMultiplier)) << 4;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(PitchMultiplier)) << 8;
-		Hash ^= SpawnCondition.ComputeHash() << 12;
-		Hash ^= Placement.ComputeHash() << 20;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Sound"), Sound);
+		Hash.Field(TEXT("VolumeMultiplier"), VolumeMultiplier);
+		Hash.Field(TEXT("PitchMultiplier"), PitchMultiplier);
+		Hash.Field(TEXT("SpawnCondition"), SpawnCondition);
+		Hash.Field(TEXT("Placement"), Placement);
+		return Hash.Finalize();
 	}
 };
 
@@ -5724,14 +5182,15 @@ struct FManifestBurstCameraShake
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(CameraShakeClass);
-		Hash ^= GetTypeHash(FString::SanitizeFloat(ShakeScale)) << 4;
-		Hash ^= GetTypeHash(PlaySpace) << 8;
-		Hash ^= (bPlayInWorld ? 1ULL : 0ULL) << 12;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(WorldInnerRadius)) << 16;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(WorldOuterRadius)) << 20;
-		Hash ^= SpawnCondition.ComputeHash() << 24;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("CameraShakeClass"), CameraShakeClass);
+		Hash.Field(TEXT("ShakeScale"), ShakeScale);
+		Hash.Field(TEXT("PlaySpace"), PlaySpace);
+		Hash.Field(TEXT("bPlayInWorld"), bPlayInWorld);
+		Hash.Field(TEXT("WorldInnerRadius"), WorldInnerRadius);
+		Hash.Field(TEXT("WorldOuterRadius"), WorldOuterRadius);
+		Hash.Field(TEXT("SpawnCondition"), SpawnCondition);
+		return Hash.Finalize();
 	}
 };
 
@@ -5749,12 +5208,13 @@ struct FManifestBurstCameraLensEffect
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(CameraLensEffectClass);
-		Hash ^= (bPlayInWorld ? 1ULL : 0ULL) << 4;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(WorldInnerRadius)) << 8;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(WorldOuterRadius)) << 12;
-		Hash ^= SpawnCondition.ComputeHash() << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("CameraLensEffectClass"), CameraLensEffectClass);
+		Hash.Field(TEXT("bPlayInWorld"), bPlayInWorld);
+		Hash.Field(TEXT("WorldInnerRadius"), WorldInnerRadius);
+		Hash.Field(TEXT("WorldOuterRadius"), WorldOuterRadius);
+		Hash.Field(TEXT("SpawnCondition"), SpawnCondition);
+		return Hash.Finalize();
 	}
 };
 
@@ -5774,13 +5234,14 @@ struct FManifestBurstForceFeedback
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(ForceFeedbackEffect);
-		Hash ^= GetTypeHash(ForceFeedbackTag) << 4;
-		Hash ^= (bIsLooping ? 1ULL : 0ULL) << 8;
-		Hash ^= (bPlayInWorld ? 1ULL : 0ULL) << 9;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(WorldIntensity)) << 12;
-		Hash ^= SpawnCondition.ComputeHash() << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("ForceFeedbackEffect"), ForceFeedbackEffect);
+		Hash.Field(TEXT("ForceFeedbackTag"), ForceFeedbackTag);
+		Hash.Field(TEXT("bIsLooping"), bIsLooping);
+		Hash.Field(TEXT("bPlayInWorld"), bPlayInWorld);
+		Hash.Field(TEXT("WorldIntensity"), WorldIntensity);
+		Hash.Field(TEXT("SpawnCondition"), SpawnCondition);
+		return Hash.Finalize();
 	}
 };
 
@@ -5799,13 +5260,14 @@ struct FManifestBurstDecal
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(DecalMaterial);
-		Hash ^= GetTypeHash(DecalSize.ToString()) << 4;
-		Hash ^= (bOverrideFadeOut ? 1ULL : 0ULL) << 8;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(FadeOutStartDelay)) << 12;
-		Hash ^= GetTypeHash(FString::SanitizeFloat(FadeOutDuration)) << 16;
-		Hash ^= SpawnCondition.ComputeHash() << 20;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("DecalMaterial"), DecalMaterial);
+		Hash.Field(TEXT("DecalSize.ToString()"), DecalSize.ToString());
+		Hash.Field(TEXT("bOverrideFadeOut"), bOverrideFadeOut);
+		Hash.Field(TEXT("FadeOutStartDelay"), FadeOutStartDelay);
+		Hash.Field(TEXT("FadeOutDuration"), FadeOutDuration);
+		Hash.Field(TEXT("SpawnCondition"), SpawnCondition);
+		return Hash.Finalize();
 	}
 };
 
@@ -5823,14 +5285,14 @@ struct FManifestGCNEffects
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = 0;
-		for (const auto& P : BurstParticles) { Hash ^= P.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		for (const auto& S : BurstSounds) { Hash ^= S.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		Hash ^= BurstCameraShake.ComputeHash() << 4;
-		Hash ^= BurstCameraLensEffect.ComputeHash() << 8;
-		Hash ^= BurstForceFeedback.ComputeHash() << 12;
-		Hash ^= BurstDecal.ComputeHash() << 16;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("BurstParticles"), BurstParticles);
+		Hash.Field(TEXT("BurstSounds"), BurstSounds);
+		Hash.Field(TEXT("BurstCameraShake"), BurstCameraShake);
+		Hash.Field(TEXT("BurstCameraLensEffect"), BurstCameraLensEffect);
+		Hash.Field(TEXT("BurstForceFeedback"), BurstForceFeedback);
+		Hash.Field(TEXT("BurstDecal"), BurstDecal);
+		return Hash.Finalize();
 	}
 };
 
@@ -5844,7 +5306,10 @@ struct FManifestGCNDefaults
 
 	uint64 ComputeHash() const
 	{
-		return DefaultSpawnCondition.ComputeHash() ^ (DefaultPlacementInfo.ComputeHash() << 16);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("DefaultSpawnCondition"), DefaultSpawnCondition);
+		Hash.Field(TEXT("DefaultPlacementInfo"), DefaultPlacementInfo);
+		return Hash.Finalize();
 	}
 };
 
@@ -5862,12 +5327,13 @@ struct FManifestCueFunctionDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(FunctionName);
-		Hash ^= GetTypeHash(Replicates) << 4;
-		Hash ^= (bReliable ? 1ULL : 0ULL) << 8;
-		for (const auto& I : Inputs) { Hash ^= I.ComputeHash(); }
-		for (const auto& O : Outputs) { Hash ^= O.ComputeHash(); }
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("FunctionName"), FunctionName);
+		Hash.Field(TEXT("Replicates"), Replicates);
+		Hash.Field(TEXT("bReliable"), bReliable);
+		Hash.Field(TEXT("Inputs"), Inputs);
+		Hash.Field(TEXT("Outputs"), Outputs);
+		return Hash.Finalize();
 	}
 };
 
@@ -5915,22 +5381,23 @@ struct FManifestGameplayCueDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(GetTypeHash(Name));
-		Hash ^= static_cast<uint64>(GetTypeHash(ParentClass)) << 4;
-		Hash ^= static_cast<uint64>(GetTypeHash(GameplayCueTag)) << 8;
-		Hash ^= (bAutoAttachToOwner ? 1ULL : 0ULL) << 12;
-		Hash ^= (bIsOverride ? 1ULL : 0ULL) << 13;
-		Hash ^= (bUniqueInstancePerInstigator ? 1ULL : 0ULL) << 14;
-		Hash ^= (bUniqueInstancePerSourceObject ? 1ULL : 0ULL) << 15;
-		Hash ^= (bAllowMultipleOnBurstEvents ? 1ULL : 0ULL) << 16;
-		Hash ^= static_cast<uint64>(NumPreallocatedInstances) << 20;
-		Hash ^= (bAutoDestroyOnRemove ? 1ULL : 0ULL) << 24;
-		Hash ^= GCNDefaults.ComputeHash() << 28;
-		Hash ^= GCNEffects.ComputeHash() << 32;
-		for (const auto& V : Variables) { Hash ^= V.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		for (const auto& F : Functions) { Hash ^= F.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		Hash ^= static_cast<uint64>(GetTypeHash(EventGraph)) << 40;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("GameplayCueTag"), GameplayCueTag);
+		Hash.Field(TEXT("bAutoAttachToOwner"), bAutoAttachToOwner);
+		Hash.Field(TEXT("bIsOverride"), bIsOverride);
+		Hash.Field(TEXT("bUniqueInstancePerInstigator"), bUniqueInstancePerInstigator);
+		Hash.Field(TEXT("bUniqueInstancePerSourceObject"), bUniqueInstancePerSourceObject);
+		Hash.Field(TEXT("bAllowMultipleOnBurstEvents"), bAllowMultipleOnBurstEvents);
+		Hash.Field(TEXT("NumPreallocatedInstances"), NumPreallocatedInstances);
+		Hash.Field(TEXT("bAutoDestroyOnRemove"), bAutoDestroyOnRemove);
+		Hash.Field(TEXT("GCNDefaults"), GCNDefaults);
+		Hash.Field(TEXT("GCNEffects"), GCNEffects);
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("Functions"), Functions);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -5950,14 +5417,10 @@ struct FManifestQuestRequirementDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Type);
-		for (const auto& Prop : Properties)
-		{
-			Hash ^= GetTypeHash(Prop.Key);
-			Hash ^= GetTypeHash(Prop.Value);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -5975,12 +5438,13 @@ struct FManifestQuestTaskDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(TaskClass);
-		Hash ^= GetTypeHash(Argument) << 4;
-		Hash ^= static_cast<uint64>(Quantity) << 8;
-		Hash ^= (bOptional ? 1ULL : 0ULL) << 16;
-		Hash ^= (bHidden ? 1ULL : 0ULL) << 17;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("TaskClass"), TaskClass);
+		Hash.Field(TEXT("Argument"), Argument);
+		Hash.Field(TEXT("Quantity"), Quantity);
+		Hash.Field(TEXT("bOptional"), bOptional);
+		Hash.Field(TEXT("bHidden"), bHidden);
+		return Hash.Finalize();
 	}
 };
 
@@ -6001,22 +5465,15 @@ struct FManifestQuestBranchDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(DestinationState) << 4;
-		Hash ^= (bHidden ? 1ULL : 0ULL) << 8;
-		for (const auto& Task : Tasks)
-		{
-			Hash ^= Task.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Event : Events)
-		{
-			Hash ^= Event.ComputeHash();
-			Hash = (Hash << 2) | (Hash >> 62);
-		}
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("DestinationState"), DestinationState);
+		Hash.Field(TEXT("bHidden"), bHidden);
+		Hash.Field(TEXT("Tasks"), Tasks);
+		Hash.Field(TEXT("Events"), Events);
 		// v4.2: Include custom event callback in hash
-		Hash ^= static_cast<uint64>(GetTypeHash(OnEnteredFuncName));
-		return Hash;
+		Hash.Field(TEXT("OnEnteredFuncName"), OnEnteredFuncName);
+		return Hash.Finalize();
 	}
 };
 
@@ -6037,22 +5494,15 @@ struct FManifestQuestStateDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Id);
-		Hash ^= GetTypeHash(Description) << 4;
-		Hash ^= GetTypeHash(Type) << 8;
-		for (const auto& Branch : Branches)
-		{
-			Hash ^= Branch.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		for (const auto& Event : Events)
-		{
-			Hash ^= Event.ComputeHash();
-			Hash = (Hash << 2) | (Hash >> 62);
-		}
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Id"), Id);
+		Hash.Field(TEXT("Description"), Description);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Branches"), Branches);
+		Hash.Field(TEXT("Events"), Events);
 		// v4.2: Include custom event callback in hash
-		Hash ^= static_cast<uint64>(GetTypeHash(OnEnteredFuncName));
-		return Hash;
+		Hash.Field(TEXT("OnEnteredFuncName"), OnEnteredFuncName);
+		return Hash.Finalize();
 	}
 };
 
@@ -6082,17 +5532,18 @@ struct FManifestDialoguePlayParamsDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(StartFromID);
-		Hash ^= static_cast<uint64>(Priority) << 8;
-		Hash ^= (bOverride_bFreeMovement ? 1ULL : 0ULL) << 16;
-		Hash ^= (bFreeMovement ? 1ULL : 0ULL) << 17;
-		Hash ^= (bOverride_bStopMovement ? 1ULL : 0ULL) << 18;
-		Hash ^= (bStopMovement ? 1ULL : 0ULL) << 19;
-		Hash ^= (bOverride_bUnskippable ? 1ULL : 0ULL) << 20;
-		Hash ^= (bUnskippable ? 1ULL : 0ULL) << 21;
-		Hash ^= (bOverride_bCanBeExited ? 1ULL : 0ULL) << 22;
-		Hash ^= (bCanBeExited ? 1ULL : 0ULL) << 23;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("StartFromID"), StartFromID);
+		Hash.Field(TEXT("Priority"), Priority);
+		Hash.Field(TEXT("bOverride_bFreeMovement"), bOverride_bFreeMovement);
+		Hash.Field(TEXT("bFreeMovement"), bFreeMovement);
+		Hash.Field(TEXT("bOverride_bStopMovement"), bOverride_bStopMovement);
+		Hash.Field(TEXT("bStopMovement"), bStopMovement);
+		Hash.Field(TEXT("bOverride_bUnskippable"), bOverride_bUnskippable);
+		Hash.Field(TEXT("bUnskippable"), bUnskippable);
+		Hash.Field(TEXT("bOverride_bCanBeExited"), bOverride_bCanBeExited);
+		Hash.Field(TEXT("bCanBeExited"), bCanBeExited);
+		return Hash.Finalize();
 	}
 };
 
@@ -6108,16 +5559,16 @@ struct FManifestQuestRewardDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(Currency);
-		Hash ^= static_cast<uint64>(XP) << 16;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Currency"), Currency);
+		Hash.Field(TEXT("XP"), XP);
+		Hash.Field(TEXT("Items"), Items.Num());
 		for (int32 i = 0; i < Items.Num(); i++)
 		{
-			Hash ^= GetTypeHash(Items[i]);
-			int32 Qty = ItemQuantities.IsValidIndex(i) ? ItemQuantities[i] : 1;
-			Hash ^= static_cast<uint64>(Qty) << 8;
-			Hash = (Hash << 3) | (Hash >> 61);
+			Hash.Add(Items[i]);
+			Hash.Add(ItemQuantities.IsValidIndex(i) ? ItemQuantities[i] : 1);
 		}
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -6154,34 +5605,26 @@ struct FManifestQuestDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
 		// NOTE: Folder excluded - presentational only
-		Hash ^= GetTypeHash(QuestName) << 4;
-		Hash ^= GetTypeHash(QuestDescription) << 8;
-		Hash ^= (bTracked ? 1ULL : 0ULL) << 12;
-		Hash ^= GetTypeHash(Dialogue) << 16;
-		Hash ^= GetTypeHash(StartState) << 20;
+		Hash.Field(TEXT("QuestName"), QuestName);
+		Hash.Field(TEXT("QuestDescription"), QuestDescription);
+		Hash.Field(TEXT("bTracked"), bTracked);
+		Hash.Field(TEXT("Dialogue"), Dialogue);
+		Hash.Field(TEXT("StartState"), StartState);
 		// v4.1: Include quest visibility and dialogue control in hash
-		Hash ^= (bHidden ? 1ULL : 0ULL) << 22;
-		Hash ^= (bResumeDialogueAfterLoad ? 1ULL : 0ULL) << 23;
+		Hash.Field(TEXT("bHidden"), bHidden);
+		Hash.Field(TEXT("bResumeDialogueAfterLoad"), bResumeDialogueAfterLoad);
 		// v4.2: Include dialogue play params in hash
-		Hash ^= DialoguePlayParams.ComputeHash();
-		Hash = (Hash << 5) | (Hash >> 59);
+		Hash.Field(TEXT("DialoguePlayParams"), DialoguePlayParams);
 		// v3.9.6: Include questgiver and rewards in hash
-		Hash ^= GetTypeHash(Questgiver) << 24;
-		Hash ^= Rewards.ComputeHash() << 28;
+		Hash.Field(TEXT("Questgiver"), Questgiver);
+		Hash.Field(TEXT("Rewards"), Rewards);
 		// v4.3: Include requirements in hash
-		for (const auto& Req : Requirements)
-		{
-			Hash ^= Req.ComputeHash();
-			Hash = (Hash << 4) | (Hash >> 60);
-		}
-		for (const auto& State : States)
-		{
-			Hash ^= State.ComputeHash();
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		Hash.Field(TEXT("Requirements"), Requirements);
+		Hash.Field(TEXT("States"), States);
+		return Hash.Finalize();
 	}
 };
 
@@ -6196,10 +5639,11 @@ struct FManifestPipelineConfig
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(DefaultFolder);
-		Hash ^= bAutoCreateCollections ? 1 : 0;
-		Hash ^= bAutoCreateLoadouts ? 2 : 0;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("DefaultFolder"), DefaultFolder);
+		Hash.Field(TEXT("bAutoCreateCollections"), bAutoCreateCollections);
+		Hash.Field(TEXT("bAutoCreateLoadouts"), bAutoCreateLoadouts);
+		return Hash.Finalize();
 	}
 };
 
@@ -6220,28 +5664,18 @@ struct FManifestPipelineItemDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Mesh);
-		Hash ^= GetTypeHash(Name);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(Type);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(Slot);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(DisplayName);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(Folder);
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= ClothingMesh.ComputeHash();
-		Hash = (Hash << 5) | (Hash >> 59);
-		Hash ^= GetTypeHash(TargetCollection);
-		for (const auto& Stat : Stats)
-		{
-			Hash ^= GetTypeHash(Stat.Key);
-			Hash ^= GetTypeHash(Stat.Value);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Mesh"), Mesh);
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Type"), Type);
+		Hash.Field(TEXT("Slot"), Slot);
+		Hash.Field(TEXT("DisplayName"), DisplayName);
+		Hash.Field(TEXT("Folder"), Folder);
+		Hash.Field(TEXT("ClothingMesh"), ClothingMesh);
+		Hash.Field(TEXT("TargetCollection"), TargetCollection);
+		Hash.Field(TEXT("Stats"), Stats);
 
-		return Hash;
+		return Hash.Finalize();
 	}
 };
 
@@ -6256,14 +5690,11 @@ struct FManifestPipelineCollectionDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Folder) << 16;
-		for (const FString& Item : Items)
-		{
-			Hash ^= GetTypeHash(Item);
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Folder"), Folder);
+		Hash.Field(TEXT("Items"), Items);
+		return Hash.Finalize();
 	}
 };
 
@@ -6277,13 +5708,10 @@ struct FManifestPipelineLoadoutDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(NPCDefinition);
-		for (const FString& Collection : Collections)
-		{
-			Hash ^= GetTypeHash(Collection);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("NPCDefinition"), NPCDefinition);
+		Hash.Field(TEXT("Collections"), Collections);
+		return Hash.Finalize();
 	}
 };
 
@@ -6304,23 +5732,20 @@ struct FManifestPOIPlacement
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(POITag);
-		Hash ^= GetTypeHash(FMath::RoundToInt(Location.X));
-		Hash ^= GetTypeHash(FMath::RoundToInt(Location.Y));
-		Hash ^= GetTypeHash(FMath::RoundToInt(Location.Z));
-		Hash ^= GetTypeHash(FMath::RoundToInt(Rotation.Pitch));
-		Hash ^= GetTypeHash(FMath::RoundToInt(Rotation.Yaw));
-		Hash ^= GetTypeHash(FMath::RoundToInt(Rotation.Roll));
-		Hash ^= GetTypeHash(DisplayName);
-		Hash ^= (bCreateMapMarker ? 1ULL : 0ULL) << 1;
-		Hash ^= (bSupportsFastTravel ? 1ULL : 0ULL) << 2;
-		Hash ^= GetTypeHash(MapIcon);
-		for (const FString& Link : LinkedPOIs)
-		{
-			Hash ^= GetTypeHash(Link);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("POITag"), POITag);
+		Hash.Field(TEXT("Location.X"), FMath::RoundToInt(Location.X));
+		Hash.Field(TEXT("Location.Y"), FMath::RoundToInt(Location.Y));
+		Hash.Field(TEXT("Location.Z"), FMath::RoundToInt(Location.Z));
+		Hash.Field(TEXT("Rotation.Pitch"), FMath::RoundToInt(Rotation.Pitch));
+		Hash.Field(TEXT("Rotation.Yaw"), FMath::RoundToInt(Rotation.Yaw));
+		Hash.Field(TEXT("Rotation.Roll"), FMath::RoundToInt(Rotation.Roll));
+		Hash.Field(TEXT("DisplayName"), DisplayName);
+		Hash.Field(TEXT("bCreateMapMarker"), bCreateMapMarker);
+		Hash.Field(TEXT("bSupportsFastTravel"), bSupportsFastTravel);
+		Hash.Field(TEXT("MapIcon"), MapIcon);
+		Hash.Field(TEXT("LinkedPOIs"), LinkedPOIs);
+		return Hash.Finalize();
 	}
 };
 
@@ -6343,13 +5768,17 @@ struct FManifestNPCSpawnParams
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = 0;
-		if (bOverrideLevelRange) Hash ^= (uint64(MinLevel) << 8) | uint64(MaxLevel);
-		for (const FString& Tag : DefaultOwnedTags) { Hash ^= GetTypeHash(Tag); }
-		for (const FString& Faction : DefaultFactions) { Hash ^= GetTypeHash(Faction); }
-		Hash ^= GetTypeHash(ActivityConfiguration);
-		Hash ^= GetTypeHash(DefaultAppearance);
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		if (bOverrideLevelRange)
+		{
+			Hash.Field(TEXT("MinLevel"), MinLevel);
+			Hash.Field(TEXT("MaxLevel"), MaxLevel);
+		}
+		Hash.Field(TEXT("DefaultOwnedTags"), DefaultOwnedTags);
+		Hash.Field(TEXT("DefaultFactions"), DefaultFactions);
+		Hash.Field(TEXT("ActivityConfiguration"), ActivityConfiguration);
+		Hash.Field(TEXT("DefaultAppearance"), DefaultAppearance);
+		return Hash.Finalize();
 	}
 };
 
@@ -6368,15 +5797,16 @@ struct FManifestNPCSpawnEntry
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(NPCDefinition);
-		Hash ^= GetTypeHash(FMath::RoundToInt(RelativeLocation.X * 10.f));
-		Hash ^= GetTypeHash(FMath::RoundToInt(RelativeLocation.Y * 10.f));
-		Hash ^= GetTypeHash(FMath::RoundToInt(RelativeLocation.Z * 10.f));
-		Hash ^= SpawnParams.ComputeHash();
-		Hash ^= (bDontSpawnIfKilled ? 1ULL : 0ULL) << 4;
-		Hash ^= GetTypeHash(OptionalGoal);
-		Hash ^= GetTypeHash(FMath::RoundToInt(UntetherDistance));
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("NPCDefinition"), NPCDefinition);
+		Hash.Field(TEXT("RelativeLocation.X"), FMath::RoundToInt(RelativeLocation.X * 10.f));
+		Hash.Field(TEXT("RelativeLocation.Y"), FMath::RoundToInt(RelativeLocation.Y * 10.f));
+		Hash.Field(TEXT("RelativeLocation.Z"), FMath::RoundToInt(RelativeLocation.Z * 10.f));
+		Hash.Field(TEXT("SpawnParams"), SpawnParams);
+		Hash.Field(TEXT("bDontSpawnIfKilled"), bDontSpawnIfKilled);
+		Hash.Field(TEXT("OptionalGoal"), OptionalGoal);
+		Hash.Field(TEXT("UntetherDistance"), FMath::RoundToInt(UntetherDistance));
+		return Hash.Finalize();
 	}
 };
 
@@ -6401,23 +5831,20 @@ struct FManifestNPCSpawnerPlacement
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(FMath::RoundToInt(Location.X));
-		Hash ^= GetTypeHash(FMath::RoundToInt(Location.Y));
-		Hash ^= GetTypeHash(FMath::RoundToInt(Location.Z));
-		Hash ^= GetTypeHash(NearPOI);
-		Hash ^= GetTypeHash(FMath::RoundToInt(POIOffset.X));
-		Hash ^= GetTypeHash(FMath::RoundToInt(POIOffset.Y));
-		Hash ^= GetTypeHash(FMath::RoundToInt(POIOffset.Z));
-		Hash ^= (bActivateOnBeginPlay ? 1ULL : 0ULL) << 5;
-		Hash ^= GetTypeHash(ActivationEvent);
-		Hash ^= GetTypeHash(DeactivationEvent);
-		for (const FManifestNPCSpawnEntry& NPC : NPCs)
-		{
-			Hash ^= NPC.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Location.X"), FMath::RoundToInt(Location.X));
+		Hash.Field(TEXT("Location.Y"), FMath::RoundToInt(Location.Y));
+		Hash.Field(TEXT("Location.Z"), FMath::RoundToInt(Location.Z));
+		Hash.Field(TEXT("NearPOI"), NearPOI);
+		Hash.Field(TEXT("POIOffset.X"), FMath::RoundToInt(POIOffset.X));
+		Hash.Field(TEXT("POIOffset.Y"), FMath::RoundToInt(POIOffset.Y));
+		Hash.Field(TEXT("POIOffset.Z"), FMath::RoundToInt(POIOffset.Z));
+		Hash.Field(TEXT("bActivateOnBeginPlay"), bActivateOnBeginPlay);
+		Hash.Field(TEXT("ActivationEvent"), ActivationEvent);
+		Hash.Field(TEXT("DeactivationEvent"), DeactivationEvent);
+		Hash.Field(TEXT("NPCs"), NPCs);
+		return Hash.Finalize();
 	}
 };
 
@@ -6430,15 +5857,11 @@ struct FManifestTriggerEventDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(EventClass);
-		Hash ^= GetTypeHash(Runtime);
-		for (const auto& Pair : Properties)
-		{
-			Hash ^= GetTypeHash(Pair.Key);
-			Hash ^= GetTypeHash(Pair.Value);
-			Hash = (Hash << 3) | (Hash >> 61);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("EventClass"), EventClass);
+		Hash.Field(TEXT("Runtime"), Runtime);
+		Hash.Field(TEXT("Properties"), Properties);
+		return Hash.Finalize();
 	}
 };
 
@@ -6452,15 +5875,12 @@ struct FManifestTriggerDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(TriggerClass);
-		Hash ^= GetTypeHash(FMath::RoundToInt(StartTime * 10));
-		Hash ^= GetTypeHash(FMath::RoundToInt(EndTime * 10));
-		for (const auto& Event : Events)
-		{
-			Hash ^= Event.ComputeHash();
-			Hash = (Hash << 5) | (Hash >> 59);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("TriggerClass"), TriggerClass);
+		Hash.Field(TEXT("StartTime"), FMath::RoundToInt(StartTime * 10));
+		Hash.Field(TEXT("EndTime"), FMath::RoundToInt(EndTime * 10));
+		Hash.Field(TEXT("Events"), Events);
+		return Hash.Finalize();
 	}
 };
 
@@ -6473,14 +5893,11 @@ struct FManifestTriggerSetDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = GetTypeHash(Name);
-		Hash ^= GetTypeHash(Folder);
-		for (const auto& Trigger : Triggers)
-		{
-			Hash ^= Trigger.ComputeHash();
-			Hash = (Hash << 7) | (Hash >> 57);
-		}
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("Folder"), Folder);
+		Hash.Field(TEXT("Triggers"), Triggers);
+		return Hash.Finalize();
 	}
 };
 
@@ -6513,16 +5930,17 @@ struct FManifestBTServiceBPDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(GetTypeHash(Name));
-		Hash ^= static_cast<uint64>(GetTypeHash(ParentClass)) << 4;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(Interval * 1000.0f)) << 8;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(RandomDeviation * 1000.0f)) << 16;
-		Hash ^= (bCallTickOnSearchStart ? 1ULL : 0ULL) << 24;
-		Hash ^= (bRestartTimerOnEachActivation ? 1ULL : 0ULL) << 25;
-		Hash ^= static_cast<uint64>(GetTypeHash(CustomDescription)) << 28;
-		for (const auto& V : Variables) { Hash ^= V.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		Hash ^= static_cast<uint64>(GetTypeHash(EventGraph)) << 40;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("Interval"), FMath::RoundToInt(Interval * 1000.0f));
+		Hash.Field(TEXT("RandomDeviation"), FMath::RoundToInt(RandomDeviation * 1000.0f));
+		Hash.Field(TEXT("bCallTickOnSearchStart"), bCallTickOnSearchStart);
+		Hash.Field(TEXT("bRestartTimerOnEachActivation"), bRestartTimerOnEachActivation);
+		Hash.Field(TEXT("CustomDescription"), CustomDescription);
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -6552,14 +5970,15 @@ struct FManifestBTTaskBPDefinition
 
 	uint64 ComputeHash() const
 	{
-		uint64 Hash = static_cast<uint64>(GetTypeHash(Name));
-		Hash ^= static_cast<uint64>(GetTypeHash(ParentClass)) << 4;
-		Hash ^= static_cast<uint64>(FMath::RoundToInt(TickInterval * 1000.0f)) << 8;
-		Hash ^= (bIgnoreRestartSelf ? 1ULL : 0ULL) << 16;
-		Hash ^= static_cast<uint64>(GetTypeHash(CustomDescription)) << 20;
-		for (const auto& V : Variables) { Hash ^= V.ComputeHash(); Hash = (Hash << 3) | (Hash >> 61); }
-		Hash ^= static_cast<uint64>(GetTypeHash(EventGraph)) << 32;
-		return Hash;
+		FGeneratorHashBuilder Hash;
+		Hash.Field(TEXT("Name"), Name);
+		Hash.Field(TEXT("ParentClass"), ParentClass);
+		Hash.Field(TEXT("TickInterval"), FMath::RoundToInt(TickInterval * 1000.0f));
+		Hash.Field(TEXT("bIgnoreRestartSelf"), bIgnoreRestartSelf);
+		Hash.Field(TEXT("CustomDescription"), CustomDescription);
+		Hash.Field(TEXT("Variables"), Variables);
+		Hash.Field(TEXT("EventGraph"), EventGraph);
+		return Hash.Finalize();
 	}
 };
 
@@ -6646,6 +6065,9 @@ struct FManifestData
 	TArray<FManifestPOIPlacement> POIPlacements;
 	TArray<FManifestNPCSpawnerPlacement> NPCSpawnerPlacements;
 
+	// v7.8.58: Asset name -> 1-based manifest line of its "- name:" entry (from FManifestLineStream)
+	TMap<FString, int32> SourceLineNumbers;
+
 	// Cached whitelist of all asset names for validation
 	mutable TSet<FString> AssetWhitelist;
 	mutable bool bWhitelistBuilt = false;
@@ -11,6 +11,8 @@
 #include "Widgets/Views/SHeaderRow.h"
 #include "NPCTableEditorTypes.h"
 #include "TableEditorTransaction.h"
+#include "TableEditorColumnIndex.h"  // v7.8.80: Cached filter lookups
+#include "TableEditorSort.h"  // v7.8.81: Typed multi-column sorting
 
 class SEditableText;
 class SCheckBox;
@@ -289,9 +291,11 @@ private:
 	/** Per-column filter state (text + multi-select) */
 	TMap<FName, FNPCColumnFilterState> ColumnFilters;
 
-	/** Current sort column */
-	FName SortColumn;
-	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+	/** v7.8.80: Cached column values behind the filters and filter dropdowns */
+	mutable TTableColumnIndex<FNPCTableRow> ColumnIndex;
+
+	/** v7.8.81: Sort levels, primary first (shift-click a header to add a secondary) */
+	TArray<FTableSortColumn> SortColumns;
 
 	//=========================================================================
 	// Status Bar (v4.5 - stored widget references for direct SetText() updates)
@@ -341,6 +345,9 @@ private:
 	/** Get column value from row */
 	FString GetColumnValue(const TSharedPtr<FNPCTableRow>& Row, FName ColumnId) const;
 
+	/** v7.8.81: Typed sort key from row (numbers and enums by value, everything else by display text) */
+	FTableSortKey GetSortKey(const TSharedPtr<FNPCTableRow>& Row, FName ColumnId) const;
+
 	//=========================================================================
 	// List View Callbacks
 	//=========================================================================
@@ -353,6 +360,7 @@ private:
 
 	/** Column sort clicked */
 	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+	EColumnSortPriority::Type GetColumnSortPriority(FName ColumnId) const;
 	void OnColumnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type SortMode);
 
 	//=========================================================================
@@ -396,9 +404,12 @@ private:
 	// Filtering & Sorting
 	//=========================================================================
 
-	/** Apply all filters and refresh display */
+	/** Apply all filters and refresh display (row data may have changed - re-reads cached columns) */
 	void ApplyFilters();
 
+	/** v7.8.80: Re-apply the filters after a filter edit (row data unchanged - uses the column index as is) */
+	void RefilterRows();
+
 	/** Apply sorting to displayed rows */
 	void ApplySorting();
 
@@ -415,6 +426,9 @@ private:
 	/** Row was modified callback */
 	void OnRowModified();
 
+	/** v7.8.80: Inline edit of one row - re-reads only that row in the column index */
+	void OnRowEdited(TSharedPtr<FNPCTableRow> Row);
+
 	/** v4.6: Delegate for notifying owner of dirty state changes */
 	FOnTableDirtyStateChanged OnDirtyStateChanged;
 
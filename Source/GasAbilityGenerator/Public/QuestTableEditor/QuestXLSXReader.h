@@ -1,11 +1,14 @@
 // GasAbilityGenerator - Quest XLSX Reader
 // v4.12: Import Quest table from Excel format with validation
+// v7.8.78: Streamed through the shared FXLSXStreamReader
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "QuestTableEditorTypes.h"
 
+class FXLSXStreamReader;
+
 /**
  * Reads Quest table data from XLSX format
  */
@@ -39,18 +42,9 @@ public:
 	static bool ReadMetadata(const FString& FilePath, FString& OutExportGuid, FString& OutTimestamp, uint32& OutContentHash);
 
 private:
-	/** Extract ZIP archive to temp directory */
-	static bool ExtractXLSX(const FString& FilePath, FString& OutTempDir, FString& OutError);
-
 	/** Parse sheet1.xml (Quests sheet) */
-	static bool ParseQuestsSheet(const FString& SheetXml, TArray<FQuestTableRow>& OutRows, FString& OutError);
+	static bool ParseQuestsSheet(const FXLSXStreamReader& Workbook, TArray<FQuestTableRow>& OutRows, FString& OutError);
 
 	/** Parse sheet3.xml (Meta sheet) */
-	static bool ParseMetaSheet(const FString& SheetXml, TMap<FString, FString>& OutMetadata);
-
-	/** Parse a single cell value from XML */
-	static FString ParseCellValue(const FString& CellXml);
-
-	/** Convert column letter to index (A=0, B=1, AA=26) */
-	static int32 ColumnIndex(const FString& ColumnLetter);
+	static bool ParseMetaSheet(const FXLSXStreamReader& Workbook, TMap<FString, FString>& OutMetadata);
 };
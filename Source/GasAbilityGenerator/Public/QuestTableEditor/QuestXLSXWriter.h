@@ -14,6 +14,8 @@
 #include "CoreMinimal.h"
 #include "QuestTableEditorTypes.h"
 
+class FXLSXStreamWriter;
+
 /**
  * Column definition for Quest XLSX export
  */
@@ -59,14 +61,11 @@ private:
 	static FString GenerateWorkbookRelsXml();
 	static FString GenerateStylesXml();
 
-	// Worksheet Generators
-	static FString GenerateQuestsSheet(const TArray<FQuestTableRow>& Rows);
-	static FString GenerateListsSheet(const TArray<FQuestTableRow>& Rows);
-	static FString GenerateMetaSheet(const TArray<FQuestTableRow>& Rows);
+	// Worksheet Writers (v7.8.79: streamed row by row)
+	static void WriteQuestsSheet(FXLSXStreamWriter& Writer, const TArray<FQuestTableRow>& Rows);
+	static void WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FQuestTableRow>& Rows);
+	static void WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FQuestTableRow>& Rows);
 
 	// Utility Helpers
-	static FString EscapeXml(const FString& Text);
-	static FString CellReference(int32 Col, int32 Row);
-	static FString ColumnLetter(int32 ColIndex);
 	static int64 ComputeRowHash(const FQuestTableRow& Row);
 };
@@ -0,0 +1,258 @@
+// GasAbilityGenerator - Table Editor Column Index
+// v7.8.80: Cached column values and inverted indexes for table editor filtering
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-column value cache behind the table editors' filter row
+ *
+ * Every distinct display value of a column is stored once, together with its lowercase fold for
+ * the text filter and the list of rows showing it (value -> rows). A filter pass is then:
+ * - test each distinct value once (substring or dropdown selection), not each row
+ * - intersect the surviving rows into a row bitset, column by column
+ *
+ * Columns are read lazily, the first time a filter or dropdown needs them, and stay cached:
+ * - InvalidateRow re-reads one row on next use (inline cell edits)
+ * - InvalidateColumn re-reads one column (values derived from other rows, e.g. dialogue Seq)
+ * - Invalidate drops everything (bulk edits, validation, generation, undo)
+ * - A different row set (added, removed, re-synced rows) is detected and rebuilt automatically
+ *
+ * Values are matched case-insensitively, like the TSet<FString> the filter selections live in.
+ */
+template<typename RowType>
+class TTableColumnIndex
+{
+public:
+	using FRowPtr = TSharedPtr<RowType>;
+
+	/** Display value of one cell (the editor's GetColumnValue) */
+	using FValueGetter = TFunction<FString(const FRowPtr& Row, FName ColumnId)>;
+
+	void SetValueGetter(FValueGetter InGetValue)
+	{
+		GetValue = MoveTemp(InGetValue);
+		Invalidate();
+	}
+
+	/** Forget all cached values */
+	void Invalidate()
+	{
+		bStale = true;
+	}
+
+	/** Re-read one column on next use */
+	void InvalidateColumn(FName ColumnId)
+	{
+		Columns.Remove(ColumnId);
+	}
+
+	/** Re-read one row on next use (unknown rows are picked up by the row set check) */
+	void InvalidateRow(const FRowPtr& Row)
+	{
+		if (const int32* RowIndex = RowIndices.Find(Row.Get()))
+		{
+			for (auto& Pair : Columns)
+			{
+				Pair.Value.DirtyRows.AddUnique(*RowIndex);
+			}
+		}
+	}
+
+	/** Start a filter pass over Rows - every row matches until a Match* call rules it out */
+	void BeginFilter(const TArray<FRowPtr>& InRows)
+	{
+		SyncRows(InRows);
+		Matches.Init(true, Rows.Num());
+		MatchCount = Rows.Num();
+	}
+
+	/** Keep rows whose value contains TextFilter (case-insensitive) */
+	void MatchText(FName ColumnId, const FString& TextFilter)
+	{
+		const FString Needle = TextFilter.ToLower();
+		MatchValueIds(ColumnId, [&Needle](const FColumn& Column, int32 ValueId)
+		{
+			return Column.FoldedValues[ValueId].Contains(Needle, ESearchCase::CaseSensitive);
+		});
+	}
+
+	/** Keep rows whose value passes Predicate (called once per distinct value) */
+	void MatchValues(FName ColumnId, TFunctionRef<bool(const FString& Value)> Predicate)
+	{
+		MatchValueIds(ColumnId, [&Predicate](const FColumn& Column, int32 ValueId)
+		{
+			return Predicate(Column.Values[ValueId]);
+		});
+	}
+
+	/** Rule out every row */
+	void MatchNothing()
+	{
+		Matches.Init(false, Rows.Num());
+		MatchCount = 0;
+	}
+
+	/** Rows still matching, in row order */
+	void GetMatchingRows(TArray<FRowPtr>& OutRows) const
+	{
+		OutRows.Reset(MatchCount);
+		for (TConstSetBitIterator<> It(Matches); It; ++It)
+		{
+			OutRows.Add(Rows[It.GetIndex()]);
+		}
+	}
+
+	/** Distinct values of a column across Rows (first-seen spelling, unsorted) */
+	void GetDistinctValues(const TArray<FRowPtr>& InRows, FName ColumnId, TArray<FString>& OutValues)
+	{
+		SyncRows(InRows);
+		const FColumn& Column = GetColumn(ColumnId);
+
+		OutValues.Reset(Column.Values.Num());
+		for (int32 ValueId = 0; ValueId < Column.Values.Num(); ++ValueId)
+		{
+			if (Column.RowsByValue[ValueId].Num() > 0)
+			{
+				OutValues.Add(Column.Values[ValueId]);
+			}
+		}
+	}
+
+private:
+	struct FColumn
+	{
+		TArray<int32> RowValues;            // Value id of each row
+		TArray<FString> Values;             // Display value by id
+		TArray<FString> FoldedValues;       // Lowercase display value by id
+		TArray<TArray<int32>> RowsByValue;  // Inverted index: value id -> rows showing it
+		TMap<FString, int32> ValueIds;      // Display value -> id (case-insensitive)
+		TArray<int32> DirtyRows;            // Rows to re-read before the next lookup
+	};
+
+	void SyncRows(const TArray<FRowPtr>& InRows)
+	{
+		bool bSameRows = !bStale && InRows.Num() == Rows.Num();
+		for (int32 RowIndex = 0; bSameRows && RowIndex < InRows.Num(); ++RowIndex)
+		{
+			bSameRows = InRows[RowIndex] == Rows[RowIndex];
+		}
+		if (bSameRows)
+		{
+			return;
+		}
+
+		Rows = InRows;
+		RowIndices.Reset();
+		RowIndices.Reserve(Rows.Num());
+		for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+		{
+			RowIndices.Add(Rows[RowIndex].Get(), RowIndex);
+		}
+		Columns.Reset();
+		Matches.Init(true, Rows.Num());
+		MatchCount = Rows.Num();
+		bStale = false;
+	}
+
+	int32 InternValue(FColumn& Column, FString&& Value) const
+	{
+		if (const int32* ExistingId = Column.ValueIds.Find(Value))
+		{
+			return *ExistingId;
+		}
+
+		const int32 ValueId = Column.Values.Num();
+		Column.ValueIds.Add(Value, ValueId);
+		Column.FoldedValues.Add(Value.ToLower());
+		Column.Values.Add(MoveTemp(Value));
+		Column.RowsByValue.AddDefaulted();
+		return ValueId;
+	}
+
+	FColumn& GetColumn(FName ColumnId)
+	{
+		if (FColumn* Column = Columns.Find(ColumnId))
+		{
+			for (const int32 RowIndex : Column->DirtyRows)
+			{
+				const int32 OldId = Column->RowValues[RowIndex];
+				const int32 NewId = InternValue(*Column, GetValue(Rows[RowIndex], ColumnId));
+				if (NewId != OldId)
+				{
+					Column->RowsByValue[OldId].RemoveSingleSwap(RowIndex);
+					Column->RowsByValue[NewId].Add(RowIndex);
+					Column->RowValues[RowIndex] = NewId;
+				}
+			}
+			Column->DirtyRows.Reset();
+			return *Column;
+		}
+
+		FColumn& Column = Columns.Add(ColumnId);
+		Column.RowValues.SetNumUninitialized(Rows.Num());
+		for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+		{
+			const int32 ValueId = InternValue(Column, GetValue(Rows[RowIndex], ColumnId));
+			Column.RowValues[RowIndex] = ValueId;
+			Column.RowsByValue[ValueId].Add(RowIndex);
+		}
+		return Column;
+	}
+
+	void MatchValueIds(FName ColumnId, TFunctionRef<bool(const FColumn& Column, int32 ValueId)> ValuePasses)
+	{
+		if (MatchCount == 0)
+		{
+			return;
+		}
+
+		const FColumn& Column = GetColumn(ColumnId);
+		TBitArray<> PassingValues(false, Column.Values.Num());
+		int32 PassingRows = 0;
+		for (int32 ValueId = 0; ValueId < Column.Values.Num(); ++ValueId)
+		{
+			if (Column.RowsByValue[ValueId].Num() > 0 && ValuePasses(Column, ValueId))
+			{
+				PassingValues[ValueId] = true;
+				PassingRows += Column.RowsByValue[ValueId].Num();
+			}
+		}
+
+		if (PassingRows < MatchCount)
+		{
+			// Narrow filter - gather the passing rows from the inverted index and intersect
+			TBitArray<> ColumnMatches(false, Rows.Num());
+			for (TConstSetBitIterator<> It(PassingValues); It; ++It)
+			{
+				for (const int32 RowIndex : Column.RowsByValue[It.GetIndex()])
+				{
+					ColumnMatches[RowIndex] = true;
+				}
+			}
+			Matches.CombineWithBitwiseAND(ColumnMatches, EBitwiseOperatorFlags::MaintainSize);
+		}
+		else
+		{
+			// Broad filter - check the rows still matching against their cached value id
+			for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+			{
+				if (Matches[RowIndex] && !PassingValues[Column.RowValues[RowIndex]])
+				{
+					Matches[RowIndex] = false;
+				}
+			}
+		}
+		MatchCount = Matches.CountSetBits();
+	}
+
+	FValueGetter GetValue;
+	TArray<FRowPtr> Rows;
+	TMap<const RowType*, int32> RowIndices;
+	TMap<FName, FColumn> Columns;
+	TBitArray<> Matches;
+	int32 MatchCount = 0;
+	bool bStale = true;
+};
@@ -0,0 +1,57 @@
+// GasAbilityGenerator - Table Editor Key Index
+// v7.8.82: Hashed uniqueness and reference lookups for the table validators
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Key -> owning row ids, built once per validation pass
+ *
+ * Replaces the per-row scans of the whole table (O(n^2) for ValidateAll) with one hash lookup per
+ * check. Keys compare the way the scans did: FString keys (and tuples of them) are case-insensitive.
+ */
+template<typename KeyType>
+class TTableKeyIndex
+{
+public:
+	void Reserve(int32 Num)
+	{
+		Owners.Reserve(Num);
+	}
+
+	void Add(const KeyType& Key, const FGuid& RowId)
+	{
+		if (FOwners* Existing = Owners.Find(Key))
+		{
+			Existing->bOtherRowIds |= (Existing->FirstRowId != RowId);
+		}
+		else
+		{
+			Owners.Add(Key, FOwners{ RowId, false });
+		}
+	}
+
+	/** True if any row has this key */
+	bool Contains(const KeyType& Key) const
+	{
+		return Owners.Contains(Key);
+	}
+
+	/** True if no row other than RowId has this key */
+	bool IsUnique(const KeyType& Key, const FGuid& RowId) const
+	{
+		const FOwners* Existing = Owners.Find(Key);
+		return !Existing || (!Existing->bOtherRowIds && Existing->FirstRowId == RowId);
+	}
+
+private:
+	struct FOwners
+	{
+		FGuid FirstRowId;
+		bool bOtherRowIds = false;  // A second, different RowId has the key
+	};
+
+	TMap<KeyType, FOwners> Owners;
+};
@@ -0,0 +1,164 @@
+// GasAbilityGenerator - Table Editor Sorting
+// v7.8.81: Typed, precomputed sort keys and multi-column sorting for all table editors
+// Copyright (c) Erdem - Second Chance RPG. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/Sort.h"
+#include "Widgets/Views/SHeaderRow.h"
+
+/**
+ * One typed sort key of one row
+ * Numbers cover int, float, bool and enum columns; text is case-folded once on extraction
+ */
+struct FTableSortKey
+{
+	double Number = 0.0;
+	FString Text;
+	bool bIsText = false;
+
+	static FTableSortKey FromNumber(double InNumber)
+	{
+		FTableSortKey Key;
+		Key.Number = InNumber;
+		return Key;
+	}
+
+	/** Enums sort in declaration order */
+	template<typename EnumType>
+	static FTableSortKey FromEnum(EnumType Value)
+	{
+		return FromNumber(static_cast<double>(static_cast<int64>(Value)));
+	}
+
+	static FTableSortKey FromText(const FString& InText)
+	{
+		FTableSortKey Key;
+		Key.Text = InText.ToLower();
+		Key.bIsText = true;
+		return Key;
+	}
+
+	/** <0, 0 or >0 - numbers sort before text */
+	int32 Compare(const FTableSortKey& Other) const
+	{
+		if (bIsText != Other.bIsText)
+		{
+			return bIsText ? 1 : -1;
+		}
+		if (bIsText)
+		{
+			return Text.Compare(Other.Text, ESearchCase::CaseSensitive);
+		}
+		return Number < Other.Number ? -1 : (Number > Other.Number ? 1 : 0);
+	}
+};
+
+/** One level of a multi-column sort (index 0 = primary) */
+struct FTableSortColumn
+{
+	FName ColumnId;
+	EColumnSortMode::Type SortMode = EColumnSortMode::Ascending;
+};
+
+namespace TableEditorSort
+{
+	/**
+	 * Apply a header click to the sort levels
+	 * Primary (plain click) replaces the sort; Secondary (shift-click) keeps the primary column and sorts ties by ColumnId
+	 */
+	inline void SetSortColumn(TArray<FTableSortColumn>& SortColumns, EColumnSortPriority::Type Priority, FName ColumnId, EColumnSortMode::Type SortMode)
+	{
+		if (Priority == EColumnSortPriority::Secondary && SortColumns.Num() > 0 && SortColumns[0].ColumnId != ColumnId)
+		{
+			SortColumns.SetNum(1);
+		}
+		else
+		{
+			SortColumns.Reset();
+		}
+
+		if (SortMode != EColumnSortMode::None)
+		{
+			SortColumns.Add({ ColumnId, SortMode });
+		}
+	}
+
+	/** Sort mode shown in a column header */
+	inline EColumnSortMode::Type GetSortMode(TConstArrayView<FTableSortColumn> SortColumns, FName ColumnId)
+	{
+		for (const FTableSortColumn& SortColumn : SortColumns)
+		{
+			if (SortColumn.ColumnId == ColumnId)
+			{
+				return SortColumn.SortMode;
+			}
+		}
+		return EColumnSortMode::None;
+	}
+
+	/** Sort priority shown in a column header */
+	inline EColumnSortPriority::Type GetSortPriority(TConstArrayView<FTableSortColumn> SortColumns, FName ColumnId)
+	{
+		return (SortColumns.Num() > 1 && SortColumns[1].ColumnId == ColumnId) ? EColumnSortPriority::Secondary : EColumnSortPriority::Primary;
+	}
+
+	/**
+	 * Stable multi-column sort
+	 * Keys are extracted once per row and sort level, then row indices are sorted against the key
+	 * array - the comparator never touches the rows. Rows with equal keys keep their current order.
+	 * @param Rows - Rows to reorder in place
+	 * @param SortColumns - Sort levels, primary first
+	 * @param GetSortKey - Typed key of one row for one column
+	 */
+	template<typename RowType>
+	void SortRows(TArray<TSharedPtr<RowType>>& Rows, TConstArrayView<FTableSortColumn> SortColumns,
+		TFunctionRef<FTableSortKey(const TSharedPtr<RowType>& Row, FName ColumnId)> GetSortKey)
+	{
+		const int32 NumRows = Rows.Num();
+		const int32 NumKeys = SortColumns.Num();
+		if (NumKeys == 0 || NumRows < 2)
+		{
+			return;
+		}
+
+		TArray<FTableSortKey> Keys;
+		Keys.Reserve(NumRows * NumKeys);
+		for (const TSharedPtr<RowType>& Row : Rows)
+		{
+			for (const FTableSortColumn& SortColumn : SortColumns)
+			{
+				Keys.Add(GetSortKey(Row, SortColumn.ColumnId));
+			}
+		}
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumRows);
+		for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+		{
+			Order[RowIndex] = RowIndex;
+		}
+
+		Algo::Sort(Order, [&Keys, SortColumns, NumKeys](int32 A, int32 B)
+		{
+			for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+			{
+				const int32 Result = Keys[A * NumKeys + KeyIndex].Compare(Keys[B * NumKeys + KeyIndex]);
+				if (Result != 0)
+				{
+					return SortColumns[KeyIndex].SortMode == EColumnSortMode::Descending ? Result > 0 : Result < 0;
+				}
+			}
+			return A < B;
+		});
+
+		TArray<TSharedPtr<RowType>> SortedRows;
+		SortedRows.Reserve(NumRows);
+		for (const int32 RowIndex : Order)
+		{
+			SortedRows.Add(MoveTemp(Rows[RowIndex]));
+		}
+		Rows = MoveTemp(SortedRows);
+	}
+}
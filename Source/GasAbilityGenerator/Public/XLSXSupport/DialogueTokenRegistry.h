@@ -1,5 +1,6 @@
 // GasAbilityGenerator - Dialogue Token Registry
 // v4.4: Validated token system for Excel dialogue authoring
+// v7.8.77: Hash-indexed token/class lookups with a per-UClass resolution cache
 //
 // Provides bidirectional mapping between token strings and UE event/condition objects.
 // Safety principle: Invalid tokens NEVER wipe UE data - they preserve and flag errors.
@@ -8,6 +9,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "UObject/ObjectKey.h"
 
 // Forward declarations
 class UNarrativeEvent;
@@ -136,7 +138,7 @@ public:
 	void RegisterTokenSpec(const FDialogueTokenSpec& Spec);
 	void RegisterBuiltInTokens();
 
-	// Lookup
+	// Lookup (v7.8.77: O(1), case-insensitive - FName keys built by RegisterTokenSpec)
 	const FDialogueTokenSpec* FindByTokenName(const FString& TokenName) const;
 	const FDialogueTokenSpec* FindByClass(UClass* Class) const;
 	const FDialogueTokenSpec* FindByClassName(const FString& ClassName) const;
@@ -178,9 +180,18 @@ private:
 	TArray<FDialogueTokenSpec> Specs;
 	TMap<FString, TSet<FString>> ValidIdSets;	// IdType -> Valid IDs
 
+	// v7.8.77: Spec indices keyed by FName (case-insensitive compare and hash); first registration wins
+	TMap<FName, int32> TokenNameIndex;
+	TMap<FName, int32> ClassNameIndex;
+
+	// v7.8.77: UClass -> spec index (INDEX_NONE cached too); TObjectKey survives GC address reuse
+	mutable TMap<TObjectKey<UClass>, int32> ClassResolutionCache;
+	mutable FCriticalSection ClassResolutionLock;
+
 	static TSet<FString> EmptySet;
 
 	// Internal helpers
+	int32 FindSpecIndexByClassName(const FString& ClassName) const;
 	UObject* InstantiateFromSpec(const FDialogueTokenSpec& Spec, const FParsedToken& Token, UObject* Outer, FString& OutError) const;
 	bool SetPropertyFromParam(UObject* Object, const FDialogueTokenParam& ParamDef, const FString& Value, FString& OutError) const;
 	FString GetPropertyAsString(UObject* Object, const FDialogueTokenParam& ParamDef) const;
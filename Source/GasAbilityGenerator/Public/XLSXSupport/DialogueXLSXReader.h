@@ -5,12 +5,15 @@
 // - Sentinel row detection (#DIALOGUE_SHEET_V1)
 // - Column ID mapping (immune to Excel reorder)
 // - Row GUID preservation for sync
+// v7.8.78: Rows streamed from FXLSXStreamReader (shared strings supported, no DOM/grid)
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "DialogueTableEditorTypes.h"
 
+class FXLSXStreamReader;
+
 /**
  * Result of XLSX import operation
  */
@@ -45,18 +48,9 @@ public:
 	static const FString EXPECTED_SENTINEL;
 
 private:
-	// ZIP extraction
-	static bool ExtractZipContents(const FString& FilePath, TMap<FString, TArray<uint8>>& OutFiles, FString& OutError);
-
-	// XML parsing
-	static bool ParseDialoguesSheet(const TArray<uint8>& XmlData, TArray<FDialogueTableRow>& OutRows, FString& OutError);
-	static bool ParseMetaSheet(const TArray<uint8>& XmlData, FDialogueXLSXImportResult& OutResult);
-
-	// Cell extraction helpers
-	static TArray<TArray<FString>> ParseSheetToGrid(const TArray<uint8>& XmlData);
-	static FString GetCellValue(const FString& CellXml);
-	static int32 ColumnLetterToIndex(const FString& Letter);
-	static void ParseCellReference(const FString& CellRef, int32& OutCol, int32& OutRow);
+	// Sheet parsing (v7.8.78: streamed row by row)
+	static bool ParseDialoguesSheet(const FXLSXStreamReader& Workbook, TArray<FDialogueTableRow>& OutRows, FString& OutError);
+	static bool ParseMetaSheet(const FXLSXStreamReader& Workbook, FDialogueXLSXImportResult& OutResult);
 
 	// Row conversion
 	static FDialogueTableRow ParseRowFromValues(const TMap<FString, int32>& ColumnMap, const TArray<FString>& Values);
@@ -14,6 +14,7 @@
 #include "DialogueTableEditorTypes.h"
 
 struct FDialogueAssetSyncResult;
+class FXLSXStreamWriter;
 
 /**
  * Column definition for XLSX export
@@ -40,6 +41,7 @@ struct FDialogueXLSXColumn
  * - xl/worksheets/sheet3.xml (_Meta)
  * - xl/_rels/workbook.xml.rels
  * - xl/styles.xml
+ * - xl/sharedStrings.xml (v7.8.79: all cell text)
  */
 class GASABILITYGENERATOR_API FDialogueXLSXWriter
 {
@@ -80,6 +82,10 @@ public:
 	static const FString FORMAT_VERSION;
 
 private:
+	/** v7.8.79: Shared body of both ExportToXLSX overloads (AssetSync may be null) */
+	static bool ExportWorkbook(const TArray<FDialogueTableRow>& Rows, const FString& FilePath,
+		const FDialogueAssetSyncResult* AssetSync, FString& OutError);
+
 	// XML content generators
 	static FString GenerateContentTypesXml();
 	static FString GenerateRelsXml();
@@ -87,15 +93,11 @@ private:
 	static FString GenerateWorkbookRelsXml();
 	static FString GenerateStylesXml();
 
-	// Sheet generators
-	static FString GenerateDialoguesSheet(const TArray<FDialogueTableRow>& Rows);
-	static FString GenerateDialoguesSheet(const TArray<FDialogueTableRow>& Rows, const FDialogueAssetSyncResult* AssetSync);
-	static FString GenerateListsSheet(const TArray<FDialogueTableRow>& Rows);
-	static FString GenerateMetaSheet(const TArray<FDialogueTableRow>& Rows);
+	// Sheet writers (v7.8.79: streamed row by row)
+	static void WriteDialoguesSheet(FXLSXStreamWriter& Writer, const TArray<FDialogueTableRow>& Rows, const FDialogueAssetSyncResult* AssetSync);
+	static void WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FDialogueTableRow>& Rows);
+	static void WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FDialogueTableRow>& Rows);
 
 	// Helpers
-	static FString EscapeXml(const FString& Text);
-	static FString CellReference(int32 Col, int32 Row);
-	static FString ColumnLetter(int32 ColIndex);
 	static int64 ComputeRowHash(const FDialogueTableRow& Row);
 };
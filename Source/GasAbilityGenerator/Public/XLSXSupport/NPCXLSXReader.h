@@ -12,12 +12,15 @@
 // - Extra columns (ignored)
 // - Reordered columns (mapped by ID, not position)
 // - Empty rows (skipped)
+// - Shared strings written by Excel on re-save (v7.8.78: FXLSXStreamReader)
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "NPCTableEditor/NPCTableEditorTypes.h"
 
+class FXLSXStreamReader;
+
 /**
  * Result of NPC XLSX import operation
  * Contains imported rows and sync metadata
@@ -40,8 +43,8 @@ struct FNPCXLSXImportResult
  * Imports NPC table data from XLSX format
  *
  * Import process:
- * 1. Extract ZIP contents to memory
- * 2. Parse sheet1.xml (NPCs)
+ * 1. Open the ZIP container (directory + shared strings; sheets are inflated on demand)
+ * 2. Stream sheet1.xml (NPCs) row by row
  *    - Detect sentinel row (#NPC_SHEET_V1)
  *    - Build column ID -> index mapping
  *    - Parse data rows using column mapping
@@ -67,64 +70,25 @@ public:
 
 private:
 	//=========================================================================
-	// ZIP Extraction
-	//=========================================================================
-
-	/**
-	 * Extract all files from XLSX (ZIP) container
-	 * @param FilePath - Path to .xlsx file
-	 * @param OutFiles - Map of internal path -> file contents
-	 * @param OutError - Error message on failure
-	 * @return true if extraction succeeded
-	 */
-	static bool ExtractZipContents(const FString& FilePath, TMap<FString, TArray<uint8>>& OutFiles, FString& OutError);
-
-	//=========================================================================
-	// XML Sheet Parsing
+	// Sheet Parsing (v7.8.78: streamed row by row)
 	//=========================================================================
 
 	/**
 	 * Parse the NPCs sheet (sheet1.xml)
-	 * @param XmlData - Raw XML bytes
+	 * @param Workbook - Opened workbook
 	 * @param OutRows - Parsed NPC rows
 	 * @param OutError - Error message on failure
 	 * @return true if parsing succeeded
 	 */
-	static bool ParseNPCsSheet(const TArray<uint8>& XmlData, TArray<FNPCTableRow>& OutRows, FString& OutError);
+	static bool ParseNPCsSheet(const FXLSXStreamReader& Workbook, TArray<FNPCTableRow>& OutRows, FString& OutError);
 
 	/**
 	 * Parse the _Meta sheet (sheet3.xml) for sync metadata
-	 * @param XmlData - Raw XML bytes
+	 * @param Workbook - Opened workbook
 	 * @param OutResult - Import result to populate with metadata
 	 * @return true if parsing succeeded
 	 */
-	static bool ParseMetaSheet(const TArray<uint8>& XmlData, FNPCXLSXImportResult& OutResult);
-
-	//=========================================================================
-	// Cell/Grid Helpers
-	//=========================================================================
-
-	/**
-	 * Parse XML sheet data into a 2D string grid
-	 * Handles sparse cell data (empty cells in the middle)
-	 * @param XmlData - Raw XML bytes
-	 * @return 2D grid [row][col] of cell values
-	 */
-	static TArray<TArray<FString>> ParseSheetToGrid(const TArray<uint8>& XmlData);
-
-	/**
-	 * Convert Excel column letters to 0-based index
-	 * "A" -> 0, "Z" -> 25, "AA" -> 26, etc.
-	 */
-	static int32 ColumnLetterToIndex(const FString& Letter);
-
-	/**
-	 * Parse Excel cell reference (e.g., "AA123") into column index and row number
-	 * @param CellRef - Cell reference string (e.g., "B5")
-	 * @param OutCol - 0-based column index
-	 * @param OutRow - 1-based row number
-	 */
-	static void ParseCellReference(const FString& CellRef, int32& OutCol, int32& OutRow);
+	static bool ParseMetaSheet(const FXLSXStreamReader& Workbook, FNPCXLSXImportResult& OutResult);
 
 	//=========================================================================
 	// Row Conversion
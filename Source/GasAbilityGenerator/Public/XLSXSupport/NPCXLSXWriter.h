@@ -14,6 +14,8 @@
 #include "CoreMinimal.h"
 #include "NPCTableEditor/NPCTableEditorTypes.h"
 
+class FXLSXStreamWriter;
+
 /**
  * Column definition for NPC XLSX export
  * Maps machine-readable IDs to human-friendly display names
@@ -40,6 +42,7 @@ struct FNPCXLSXColumn
  * - xl/worksheets/sheet3.xml    - _Meta (sync metadata)
  * - xl/_rels/workbook.xml.rels  - Workbook relationships
  * - xl/styles.xml               - Cell styles (bold headers, etc.)
+ * - xl/sharedStrings.xml        - v7.8.79: Shared string table (all cell text)
  *
  * Sheet1 Layout:
  * - Row 1: Sentinel (#NPC_SHEET_V1) + Column IDs
@@ -86,38 +89,29 @@ private:
 	/** Generate xl/workbook.xml - Workbook with sheet definitions */
 	static FString GenerateWorkbookXml();
 
-	/** Generate xl/_rels/workbook.xml.rels - Sheet and style relationships */
+	/** Generate xl/_rels/workbook.xml.rels - Sheet, style and shared string relationships */
 	static FString GenerateWorkbookRelsXml();
 
 	/** Generate xl/styles.xml - Cell formatting (bold headers) */
 	static FString GenerateStylesXml();
 
 	//=========================================================================
-	// Worksheet Generators
+	// Worksheet Writers (v7.8.79: streamed row by row)
 	//=========================================================================
 
-	/** Generate sheet1.xml - Main NPC data with sentinel row and column mapping */
-	static FString GenerateNPCsSheet(const TArray<FNPCTableRow>& Rows);
+	/** Write sheet1.xml - Main NPC data with sentinel row and column mapping */
+	static void WriteNPCsSheet(FXLSXStreamWriter& Writer, const TArray<FNPCTableRow>& Rows);
 
-	/** Generate sheet2.xml - Lists of unique values for dropdown validation */
-	static FString GenerateListsSheet(const TArray<FNPCTableRow>& Rows);
+	/** Write sheet2.xml - Lists of unique values for dropdown validation */
+	static void WriteListsSheet(FXLSXStreamWriter& Writer, const TArray<FNPCTableRow>& Rows);
 
-	/** Generate sheet3.xml - Sync metadata (export GUID, timestamp, content hash) */
-	static FString GenerateMetaSheet(const TArray<FNPCTableRow>& Rows);
+	/** Write sheet3.xml - Sync metadata (export GUID, timestamp, content hash) */
+	static void WriteMetaSheet(FXLSXStreamWriter& Writer, const TArray<FNPCTableRow>& Rows);
 
 	//=========================================================================
 	// Utility Helpers
 	//=========================================================================
 
-	/** Escape special XML characters (&, <, >, ", ') */
-	static FString EscapeXml(const FString& Text);
-
-	/** Convert column index (0-based) and row number to Excel cell reference (e.g., "A1", "AA100") */
-	static FString CellReference(int32 Col, int32 Row);
-
-	/** Convert 0-based column index to Excel letter(s) (0="A", 25="Z", 26="AA") */
-	static FString ColumnLetter(int32 ColIndex);
-
 	/** Compute content hash for a row (excludes RowId for identity-independent comparison) */
 	static int64 ComputeRowHash(const FNPCTableRow& Row);
 
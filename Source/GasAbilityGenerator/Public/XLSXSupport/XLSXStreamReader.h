@@ -0,0 +1,67 @@
+// GasAbilityGenerator - Streaming XLSX Reader
+// v7.8.78: Shared sheet reader for the Dialogue, NPC, Item and Quest table editors
+//
+// Reads worksheet XML as a forward-only tag stream over the raw UTF-8 bytes of the zip entry and
+// hands each <row> to a callback - no FString copy of the sheet, no FXmlFile DOM, no dense grid.
+// Handles everything Excel writes when it re-saves one of our exports:
+// - Shared strings (t="s") - xl/sharedStrings.xml is decoded once into an indexed table on Open
+// - Inline strings (t="inlineStr"), rich-text runs (<r><t>) and phonetic runs (<rPh>, skipped)
+// - Omitted r="" attributes on rows/cells (position follows the previous row/cell)
+// - Namespace-prefixed tags (<x:row>) and XML character references (&#10;)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FZipArchiveReader;
+
+/**
+ * Streaming reader for one XLSX workbook (zip entries are read on demand, one at a time)
+ */
+class GASABILITYGENERATOR_API FXLSXStreamReader
+{
+public:
+	/**
+	 * Row callback
+	 * @param RowNumber - 1-based sheet row number
+	 * @param Cells - Values by 0-based column, dense up to the row's last cell (buffer is reused - copy what you keep)
+	 * @return false to stop reading the sheet
+	 */
+	using FRowCallback = TFunctionRef<bool(int32 RowNumber, const TArray<FString>& Cells)>;
+
+	/** Excel's column limit (XFD) - cells beyond it are ignored */
+	static constexpr int32 MaxColumns = 16384;
+
+	FXLSXStreamReader();
+	~FXLSXStreamReader();
+
+	/**
+	 * Open the workbook and decode its shared string table
+	 * @param FilePath - Input file path (.xlsx)
+	 * @param OutError - Error message on failure
+	 * @return true if the file is a readable zip container
+	 */
+	bool Open(const FString& FilePath, FString& OutError);
+
+	/** True if the workbook contains the entry (e.g. "xl/worksheets/sheet3.xml") */
+	bool HasEntry(const FString& EntryPath) const;
+
+	/**
+	 * Stream the rows of one worksheet
+	 * @param SheetPath - Zip entry path (e.g. "xl/worksheets/sheet1.xml")
+	 * @param OnRow - Called for each row in sheet order
+	 * @param OutError - Error message on failure
+	 * @return true if the sheet was found and read (also when OnRow stopped early)
+	 */
+	bool ReadSheet(const FString& SheetPath, FRowCallback OnRow, FString& OutError) const;
+
+	int32 GetSharedStringCount() const { return SharedStrings.Num(); }
+
+private:
+	bool ReadEntry(const FString& EntryPath, TArray<uint8>& OutData) const;
+	void ParseSharedStrings(const TArray<uint8>& XmlData);
+
+	TUniquePtr<FZipArchiveReader> ZipReader;
+	TSet<FString> EntryNames;
+	TArray<FString> SharedStrings;
+};
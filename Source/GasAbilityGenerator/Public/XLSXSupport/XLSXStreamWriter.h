@@ -0,0 +1,128 @@
+// GasAbilityGenerator - Streaming XLSX Writer
+// v7.8.79: Shared workbook writer for the Dialogue, NPC, Item and Quest table editors
+// v7.8.84: Written to <file>.tmp and moved over the target only when Close succeeds
+//
+// Rows are serialized straight to UTF-8 into a small chunk buffer; every full chunk is deflated into
+// the open zip entry and written to disk, so peak memory no longer scales with the sheet - there is no
+// whole-sheet FString and no full UTF-8 copy of it. Cell text goes through a shared string table
+// (xl/sharedStrings.xml, written on Close), so repeated values - speakers, factions, item tags, the
+// #STATE column - are stored once and each cell only carries an index.
+//
+// Workbooks written with this class must declare the shared string part themselves:
+// - [Content_Types].xml:        <Override PartName="/xl/sharedStrings.xml" ContentType="...spreadsheetml.sharedStrings+xml"/>
+// - xl/_rels/workbook.xml.rels: a .../relationships/sharedStrings relationship to "sharedStrings.xml"
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+/**
+ * Forward-only XLSX package writer (one zip entry open at a time)
+ *
+ * Usage: Open, AddPart for the fixed parts, then per worksheet BeginSheet / (BeginRow / AddCell... / EndRow)* /
+ * EndSheet, and finally Close. Rows and cells are numbered automatically from A1.
+ */
+class GASABILITYGENERATOR_API FXLSXStreamWriter
+{
+public:
+	/** Uncompressed bytes gathered before they are deflated and written */
+	static constexpr int32 ChunkSize = 64 * 1024;
+
+	FXLSXStreamWriter();
+	~FXLSXStreamWriter();
+
+	/**
+	 * Create the output file
+	 * v7.8.84: The workbook is written to FilePath + ".tmp"; FilePath itself is only replaced by a
+	 * successful Close, so a failed or abandoned write never leaves a truncated workbook behind.
+	 * @param FilePath - Output file path (.xlsx)
+	 * @param OutError - Error message on failure
+	 * @return true if the file could be opened for writing
+	 */
+	bool Open(const FString& FilePath, FString& OutError);
+
+	/** Write a complete small part (content types, relationships, workbook, styles) */
+	void AddPart(const FString& EntryPath, const FString& Xml);
+
+	/**
+	 * Start a worksheet entry
+	 * @param EntryPath - Zip entry path (e.g. "xl/worksheets/sheet1.xml")
+	 * @param ColumnWidths - Optional custom widths (Excel character units) by 0-based column
+	 */
+	void BeginSheet(const FString& EntryPath, TConstArrayView<float> ColumnWidths = {});
+
+	/** Start the next row */
+	void BeginRow();
+
+	/**
+	 * Write the next cell of the current row as a shared string
+	 * Empty values are not written (the column is skipped, which reads back as empty)
+	 * @param StyleIndex - cellXfs index from styles.xml (0 = default)
+	 */
+	void AddCell(FStringView Value, int32 StyleIndex = 0);
+
+	/** Finish the current row */
+	void EndRow();
+
+	/** Finish the worksheet entry */
+	void EndSheet();
+
+	/**
+	 * Write xl/sharedStrings.xml and the zip directory, close the file and move it over the target
+	 * @param OutError - Error message on failure (the target is then left untouched)
+	 * @return true if every part reached the disk and the target was replaced
+	 */
+	bool Close(FString& OutError);
+
+private:
+	struct FEntryStream;
+
+	/** Central directory record of a finished entry */
+	struct FDirectoryEntry
+	{
+		TArray<uint8> PathUtf8;
+		uint32 Crc = 0;
+		uint32 CompressedSize = 0;
+		uint32 UncompressedSize = 0;
+		uint32 HeaderOffset = 0;
+	};
+
+	/** Shared strings are matched case-sensitively ("Guard" and "guard" are different cells) */
+	struct FSharedStringKeyFuncs : BaseKeyFuncs<FString, FString, false>
+	{
+		static const FString& GetSetKey(const FString& Element) { return Element; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	void DiscardTempFile();
+
+	void BeginEntry(const FString& EntryPath);
+	void EndEntry();
+	void FlushChunk(bool bFinish);
+	bool WriteBytes(const uint8* Data, int64 Size);
+
+	void AppendAscii(const ANSICHAR* Text);
+	void AppendNumber(uint32 Value);
+	void AppendCellReference(int32 Column, int32 Row);
+	void AppendEscaped(FStringView Text);
+
+	TUniquePtr<IFileHandle> FileHandle;
+	FString TargetPath;   // v7.8.84: The user's workbook - replaced on a successful Close only
+	FString TempPath;
+	TUniquePtr<FEntryStream> Entry;
+	TArray<FDirectoryEntry> Directory;
+	TArray<uint8> Chunk;
+	TArray<uint8> Deflated;
+
+	TSet<FString, FSharedStringKeyFuncs> SharedStrings;
+	uint32 SharedStringRefs = 0;
+
+	int32 RowNumber = 0;
+	int32 ColumnIndex = 0;
+	uint16 DosTime = 0;
+	uint16 DosDate = 0;
+	FString Error;
+};
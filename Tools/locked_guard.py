@@ -31,6 +31,7 @@ LOCKED_GLOBS = [
 
     # Contract 2: Regen/Diff types (in Locked/ folder)
     "Source/GasAbilityGenerator/Public/Locked/GasAbilityGeneratorTypes.h",
+    "Source/GasAbilityGenerator/Public/Locked/GasAbilityGeneratorHash.h",
 
     # Contracts 3-5: Generator core (temporary - until monolith split)
     "Source/GasAbilityGenerator/Private/GasAbilityGeneratorGenerators.cpp",